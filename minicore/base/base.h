@@ -10,7 +10,9 @@
 #ifndef BASE_H_
 #define BASE_H_
 
+#include "cpu.h"
 #include "error.h"
+#include "hashmap.h"
 #include "memory.h"
 #include "parallel.h"
 
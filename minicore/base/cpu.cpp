@@ -0,0 +1,113 @@
+//
+// cpu.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <cstdint>
+#include "cpu.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define BASE_CPU_X86
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define BASE_CPU_X86
+#endif
+
+namespace Base {
+
+#ifdef BASE_CPU_X86
+///
+/// @brief Query cpuid with the specified leaf and subleaf.
+///
+static void Cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, (int) leaf, (int) subleaf);
+    for (int i = 0; i < 4; ++i) {
+        regs[i] = (uint32_t) info[i];
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+///
+/// @brief Return the extended control register with the register state
+/// enabled by the operating system.
+///
+static uint64_t Xgetbv()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t) edx << 32) | eax;
+#endif
+}
+#endif // BASE_CPU_X86
+
+///
+/// @brief Detect the instruction set extensions supported by the cpu.
+///
+static CpuFeatures DetectCpuFeatures()
+{
+    CpuFeatures features = {};
+
+#ifdef BASE_CPU_X86
+    uint32_t regs[4];
+    Cpuid(0, 0, regs);
+    const uint32_t max_leaf = regs[0];
+    if (max_leaf < 1) {
+        return features;
+    }
+
+    // Leaf 1: SSE2, SSE4.1, AVX, FMA, F16C and the OS register state.
+    Cpuid(1, 0, regs);
+    const uint32_t ecx1 = regs[2];
+    const uint32_t edx1 = regs[3];
+    features.sse2 = (edx1 >> 26) & 1;
+    features.sse41 = (ecx1 >> 19) & 1;
+
+    // The ymm and zmm registers are usable only if the OS saves their state.
+    bool osxsave = (ecx1 >> 27) & 1;
+    uint64_t xcr0 = osxsave ? Xgetbv() : 0;
+    bool ymm_state = (xcr0 & 0x06) == 0x06;
+    bool zmm_state = (xcr0 & 0xe6) == 0xe6;
+
+    features.avx = ymm_state && ((ecx1 >> 28) & 1);
+    features.fma = features.avx && ((ecx1 >> 12) & 1);
+    features.f16c = features.avx && ((ecx1 >> 29) & 1);
+
+    // Leaf 7: AVX2 and AVX-512 foundation and extensions.
+    if (max_leaf >= 7) {
+        Cpuid(7, 0, regs);
+        const uint32_t ebx7 = regs[1];
+        features.avx2 = features.avx && ((ebx7 >> 5) & 1);
+        features.avx512f = zmm_state && ((ebx7 >> 16) & 1);
+        features.avx512dq = features.avx512f && ((ebx7 >> 17) & 1);
+        features.avx512bw = features.avx512f && ((ebx7 >> 30) & 1);
+        features.avx512vl = features.avx512f && ((ebx7 >> 31) & 1);
+    }
+#endif // BASE_CPU_X86
+
+    return features;
+}
+
+///
+/// @brief Return the instruction set extensions supported by the cpu. The cpu
+/// is queried on the first call only.
+///
+const CpuFeatures &GetCpuFeatures()
+{
+    static const CpuFeatures features = DetectCpuFeatures();
+    return features;
+}
+
+} // namespace Base
@@ -0,0 +1,43 @@
+//
+// cpu.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef BASE_CPU_H_
+#define BASE_CPU_H_
+
+namespace Base {
+
+///
+/// @brief CpuFeatures maintains the instruction set extensions supported by
+/// the cpu. The features are queried once with cpuid. The AVX and AVX-512
+/// features also require the operating system to save the extended register
+/// state, which is checked with xgetbv.
+///
+/// SIMD kernels compiled for a given instruction set live in their own
+/// translation units and are selected at runtime through function pointers,
+/// so a single binary runs on cpus with and without the extensions.
+///
+struct CpuFeatures {
+    bool sse2;
+    bool sse41;
+    bool avx;
+    bool avx2;
+    bool fma;
+    bool f16c;
+    bool avx512f;
+    bool avx512dq;
+    bool avx512bw;
+    bool avx512vl;
+};
+
+/// @brief Return the instruction set extensions supported by the cpu.
+const CpuFeatures &GetCpuFeatures();
+
+} // namespace Base
+
+#endif // BASE_CPU_H_
@@ -0,0 +1,327 @@
+//
+// hashmap.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "cpu.h"
+#include "hashmap.h"
+#include "parallel.h"
+#include "simd/hashmap.h"
+
+namespace Base {
+
+///
+/// @brief Hashmap constants.
+///
+const uint32_t Hashmap::kEmpty;
+const uint64_t Hashmap::kEmptySlot;
+const uint32_t Hashmap::kMinBits;
+const uint32_t Hashmap::kMaxBits;
+const uint32_t Hashmap::kMinSize;
+const uint32_t Hashmap::kMaxSize;
+
+///
+/// @brief Atomic load and compare-and-swap of a 64-bit slot.
+///
+static inline uint64_t LoadSlot(const uint64_t *slot)
+{
+    return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+}
+
+static inline bool CompareAndSwapSlot(
+    uint64_t *slot,
+    uint64_t oldval,
+    uint64_t newval)
+{
+    return __atomic_compare_exchange_n(
+        slot, &oldval, newval, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+///
+/// @brief Scan at most count slots starting at the specified slot. Return the
+/// first slot containing the key, or the empty flag if an empty slot is found
+/// first or no slots are left.
+///
+static uint32_t ProbeScalar(
+    const uint64_t *data,
+    const uint32_t mask,
+    const uint32_t key,
+    uint32_t slot,
+    uint32_t count)
+{
+    for (; count > 0; --count) {
+        Hashmap::KeyValue kv = Hashmap::Unpack(LoadSlot(&data[slot]));
+        if (kv.key == key) {
+            return slot;
+        }
+
+        if (kv.key == Hashmap::kEmpty) {
+            return Hashmap::kEmpty;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+    return Hashmap::kEmpty;
+}
+
+///
+/// @brief Return the first slot of each key in an array of keys.
+///
+static void BeginScalar(
+    const uint64_t *data,
+    const uint32_t mask,
+    const uint32_t *keys,
+    uint32_t *slots,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        slots[i] = ProbeScalar(data, mask, keys[i], keys[i] & mask, mask + 1);
+    }
+}
+
+///
+/// @brief Probe kernels. Select the AVX2 kernels once if the cpu supports them.
+/// The AVX2 kernels read a group of slots with a single vector load, and read
+/// an empty slot again with an atomic load before ending the probe, so they
+/// are safe to run concurrently with inserts, as the scalar kernels.
+///
+struct ProbeKernels {
+    uint32_t (*probe)(const uint64_t *, const uint32_t, const uint32_t,
+        uint32_t, uint32_t);
+    void (*begin)(const uint64_t *, const uint32_t, const uint32_t *,
+        uint32_t *, const size_t);
+};
+
+static ProbeKernels SelectProbeKernels()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    if (GetCpuFeatures().avx2) {
+        return {HashmapProbeAvx2, HashmapBeginAvx2};
+    }
+#endif
+    return {ProbeScalar, BeginScalar};
+}
+
+static const ProbeKernels &GetProbeKernels()
+{
+    static const ProbeKernels kernels = SelectProbeKernels();
+    return kernels;
+}
+
+///
+/// @brief Number of keys in each block of a parallel find.
+///
+static const size_t kFindBlockSize = 256;
+
+///
+/// @brief Maximum load factor before a bulk insert grows the table. Linear
+/// probing sequences grow quickly as the table approaches full occupancy.
+///
+static const uint64_t kMaxLoadNum = 7;
+static const uint64_t kMaxLoadDen = 8;
+
+///
+/// @brief Return the key-value item stored at the specified slot.
+///
+Hashmap::KeyValue Hashmap::at(const uint32_t slot) const
+{
+    return Unpack(LoadSlot(&mData[slot]));
+}
+
+///
+/// @brief Clear the hash table key-value items and set their state to empty.
+///
+void Hashmap::clear()
+{
+    mNumItems = 0;
+    std::fill(mData.begin(), mData.end(), kEmptySlot);
+}
+
+///
+/// @brief Rehash the table items into a new table with the next power of two
+/// of the given capacity. The new capacity must hold all the current items.
+///
+void Hashmap::resize(const uint32_t min_capacity)
+{
+    if (min_capacity < mNumItems) {
+        throw std::runtime_error("invalid hashmap capacity");
+    }
+
+    Hashmap hashmap = Create(min_capacity);
+    std::vector<uint32_t> keys;
+    std::vector<uint32_t> values;
+    keys.reserve(mNumItems);
+    values.reserve(mNumItems);
+    for (auto &item : mData) {
+        if (item != kEmptySlot) {
+            KeyValue kv = Unpack(item);
+            keys.push_back(kv.key);
+            values.push_back(kv.value);
+        }
+    }
+    hashmap.insert(keys.data(), values.data(), keys.size());
+    *this = std::move(hashmap);
+}
+
+///
+/// @brief Insert a key-value item into the table. Start iterating at the slot
+/// given by the key masked by the capacity. If the slot is empty, atomically
+/// swap it with the key-value item. Return false if the key is the reserved
+/// empty key or the table is full.
+///
+bool Hashmap::insert(const uint32_t key, const uint32_t value)
+{
+    if (key == kEmpty) {
+        return false;
+    }
+
+    const uint64_t item = Pack(key, value);
+    uint32_t slot = key & mMask;
+    for (uint32_t probe = 0; probe < mCapacity; ++probe) {
+        if (CompareAndSwapSlot(&mData[slot], kEmptySlot, item)) {
+            __atomic_fetch_add(&mNumItems, 1, __ATOMIC_RELAXED);
+            return true;
+        }
+        slot = (slot + 1) & mMask;
+    }
+    return false;
+}
+
+///
+/// @brief Insert an array of key-value items into the table. Grow the table
+/// beforehand if the final load factor exceeds the maximum, then insert the
+/// items in parallel over the thread pool. If values is null, the value of
+/// each key is its index in the array. Throw if any key is the reserved empty
+/// key, before inserting any item.
+///
+void Hashmap::insert(
+    const uint32_t *keys,
+    const uint32_t *values,
+    const size_t count)
+{
+    if (std::find(keys, keys + count, kEmpty) != keys + count) {
+        throw std::runtime_error("invalid hashmap key");
+    }
+
+    uint64_t num_items = (uint64_t) mNumItems + count;
+    if (kMaxLoadDen * num_items > kMaxLoadNum * mCapacity) {
+        resize((uint32_t) std::min<uint64_t>(2 * num_items, kMaxSize - 1));
+    }
+
+    struct InsertData {
+        Hashmap *hashmap;
+        const uint32_t *keys;
+        const uint32_t *values;
+    } data = {this, keys, values};
+
+    auto run = [](size_t i, void *arg) {
+        InsertData *data = static_cast<InsertData *>(arg);
+        uint32_t value = data->values ? data->values[i] : (uint32_t) i;
+        data->hashmap->insert(data->keys[i], value);
+    };
+
+    ParallelForIf(run, count, &data, true);
+}
+
+///
+/// @brief Return the first slot containing the specified key. If no key is found
+/// return the empty state mask. The mask is then used to signal that no further
+/// slots in the map contain the specified key.
+///
+uint32_t Hashmap::begin(const uint32_t key) const
+{
+    return GetProbeKernels().probe(
+        mData.data(), mMask, key, key & mMask, mCapacity);
+}
+
+///
+/// @brief Return the first slot of each key in an array of keys. The initial
+/// slots of a batch of keys are probed at once. Missing keys have the empty
+/// slot. Unlike the bulk find, the keys are processed in the calling thread.
+///
+void Hashmap::begin(
+    const uint32_t *keys,
+    uint32_t *slots,
+    const size_t count) const
+{
+    GetProbeKernels().begin(mData.data(), mMask, keys, slots, count);
+}
+
+///
+/// @brief Return the next slot containing the specified key. Stop if the probe
+/// sequence wraps around to the key's initial slot in a full table.
+///
+uint32_t Hashmap::next(const uint32_t key, uint32_t slot) const
+{
+    const uint32_t home = key & mMask;
+    slot = (slot + 1) & mMask;
+    return GetProbeKernels().probe(
+        mData.data(), mMask, key, slot, (home - slot) & mMask);
+}
+
+///
+/// @brief Find the first value of each key in the array in parallel over the
+/// thread pool. Each task looks up a block of keys with the batched begin.
+/// Missing keys have the empty value.
+///
+void Hashmap::find(
+    const uint32_t *keys,
+    uint32_t *values,
+    const size_t count) const
+{
+    struct FindData {
+        const Hashmap *hashmap;
+        const uint32_t *keys;
+        uint32_t *values;
+        size_t count;
+    } data = {this, keys, values, count};
+
+    auto run = [](size_t block, void *arg) {
+        FindData *data = static_cast<FindData *>(arg);
+        size_t first = block * kFindBlockSize;
+        size_t last = std::min(first + kFindBlockSize, data->count);
+        uint32_t *values = data->values + first;
+        data->hashmap->begin(data->keys + first, values, last - first);
+        for (size_t i = 0; i < last - first; ++i) {
+            if (values[i] != kEmpty) {
+                values[i] = data->hashmap->get(values[i]);
+            }
+        }
+    };
+
+    size_t num_blocks = (count + kFindBlockSize - 1) / kFindBlockSize;
+    ParallelForIf(run, num_blocks, &data, true);
+}
+
+///
+/// @brief Create a hashmap with the next power of two of the given capacity.
+///
+Hashmap Hashmap::Create(const uint32_t min_capacity)
+{
+    if (min_capacity >= kMaxSize) {
+        throw std::runtime_error("invalid hashmap capacity");
+    }
+
+    // Compute the next power of two capacity
+    uint32_t capacity = kMinSize;
+    while (capacity <= min_capacity) {
+        capacity = capacity << 1;
+    }
+
+    // Setup an empty hash table with no items.
+    Hashmap hashmap;
+    hashmap.mCapacity = capacity;
+    hashmap.mMask = capacity - 1;
+    hashmap.mNumItems = 0;
+    hashmap.mData.resize(capacity, kEmptySlot);
+    return hashmap;
+}
+
+} // namespace Base
@@ -0,0 +1,123 @@
+//
+// hashmap.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef BASE_HASHMAP_H_
+#define BASE_HASHMAP_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "memory.h"
+
+namespace Base {
+
+///
+/// @brief Hashmap maintains an array of key-value items using open addressing
+/// with linear probing to handle collision resolution of keys with the same
+/// hash value.
+///
+/// Each key-value item is packed into a single 64-bit slot, with the key in
+/// the lower 32 bits and the value in the upper 32 bits. During insertion, the
+/// key selects the initial slot, ie the key is masked with the power of two
+/// capacity. Collision resolution is handled by iterating through the hash
+/// table array, starting at the key's initial slot location. At each slot,
+/// perform an atomic compare-and-swap of the slot with the empty item. If the
+/// slot is empty, the key and value are published together in one atomic
+/// operation. Concurrent insertions from several threads are therefore safe.
+///
+/// A key may be inserted several times with different values. Iterate over
+/// all values of a given key with begin/next until end is returned. Lookups
+/// compare a group of slots per instruction and a batch of keys can be looked
+/// up at once with the batched begin, if the cpu supports AVX2.
+///
+/// @note The keys are expected to be hash values. The empty key 0xffffffff
+/// is reserved and cannot be inserted, the single insert returns false and the
+/// bulk insert throws. Insert and lookup are safe to run concurrently with
+/// other inserts and lookups, with the scalar and the AVX2 probes alike. A
+/// lookup running concurrently with the insert of its key may or may not find
+/// it. Clear and resize are not safe to run concurrently.
+///
+struct Hashmap {
+    // Hashmap key-value item type.
+    struct KeyValue {
+        uint32_t key;
+        uint32_t value;
+    };
+
+    // Hashmap constants.
+    static const uint32_t kEmpty = 0xffffffff;          // empty key flag
+    static const uint64_t kEmptySlot = 0xffffffffffffffff;
+    static const uint32_t kMinBits = 3;                 // min 8 items
+    static const uint32_t kMaxBits = 31;                // max 2147483648 items
+    static const uint32_t kMinSize = 1U << kMinBits;
+    static const uint32_t kMaxSize = 1U << kMaxBits;
+
+    // Member variables.
+    uint32_t mCapacity;             // max number of items in the table
+    uint32_t mMask;                 // slot mask, ie capacity - 1
+    uint32_t mNumItems;             // number of items in the table
+    std::vector<uint64_t, Allocator<uint64_t>> mData;   // hashmap table
+
+    // Return the max number of key-value items in the hash table.
+    const uint32_t &capacity() const { return mCapacity; }
+
+    // Return the number of key-value items in the hash table.
+    const uint32_t &size() const { return mNumItems; }
+
+    // Return the key-value item stored at the specified slot.
+    KeyValue at(const uint32_t slot) const;
+
+    // Clear the hash table key-value items and set their state to empty.
+    void clear();
+
+    // Rehash the table items into a table with the new capacity.
+    void resize(const uint32_t min_capacity);
+
+    // Insert a key-value item into the table.
+    bool insert(const uint32_t key, const uint32_t value);
+
+    // Insert an array of key-value items into the table in parallel.
+    void insert(
+        const uint32_t *keys,
+        const uint32_t *values,
+        const size_t count);
+
+    // Return the first slot containing the specified key.
+    uint32_t begin(const uint32_t key) const;
+
+    // Return the first slot of each key in an array of keys.
+    void begin(const uint32_t *keys, uint32_t *slots, const size_t count) const;
+
+    // Return the past-the-end element indicating an empty slot.
+    uint32_t end() const { return kEmpty; }
+
+    // Return the next slot containing the specified key.
+    uint32_t next(const uint32_t key, uint32_t slot) const;
+
+    // Return the value of the current slot.
+    uint32_t get(const uint32_t slot) const { return at(slot).value; }
+
+    // Find the first value of each key in an array of keys in parallel.
+    void find(const uint32_t *keys, uint32_t *values, const size_t count) const;
+
+    // Pack and unpack a key-value item into a 64-bit slot.
+    static uint64_t Pack(const uint32_t key, const uint32_t value) {
+        return ((uint64_t) value << 32) | (uint64_t) key;
+    }
+    static KeyValue Unpack(const uint64_t item) {
+        return {(uint32_t) item, (uint32_t) (item >> 32)};
+    }
+
+    // Hashmap factory function.
+    static Hashmap Create(const uint32_t min_capacity);
+};
+
+} // namespace Base
+
+#endif // BASE_HASHMAP_H_
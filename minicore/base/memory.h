@@ -14,6 +14,7 @@
 #include <cstring>
 #include <exception>
 #include <memory>
+#include <stdexcept>
 
 namespace Base {
 
@@ -125,6 +126,17 @@ inline void *AlignRealloc(void *ptr, size_t oldsize, size_t newsize)
 }
 
 /// ---- Templated aligned memory allocation ------------------------------------
+/// @brief Return the alignment of an object of type T. This is the default
+/// alignment, unless the type requires a stricter one, eg the vector types
+/// aligned to 32 bytes in builds without AVX.
+///
+template<typename T>
+constexpr size_t AlignOf()
+{
+    return alignof(T) > kAlignmentSize ? alignof(T) : kAlignmentSize;
+}
+
+///
 /// @brief Allocate a block of memory of with a single object of type T, with
 /// size sizeof(T) bytes and default alignment. Initialize the object by calling
 /// directly the T constructor at the newly allocated address with placement new.
@@ -132,7 +144,7 @@ inline void *AlignRealloc(void *ptr, size_t oldsize, size_t newsize)
 template<typename T, typename... Args>
 T *AlignAlloc(Args&&... args)
 {
-    T *ptr = (T *) AlignAlloc(sizeof(T));
+    T *ptr = (T *) AlignAlloc(sizeof(T), AlignOf<T>());
     if (!ptr) {
         throw std::runtime_error("failed to allocate");
     }
@@ -176,7 +188,7 @@ T *AlignArrayAlloc(size_t n, Args&&... args)
         throw std::runtime_error("invalid array length");
     }
 
-    T *ptr = (T *) AlignAlloc(n * sizeof(T));
+    T *ptr = (T *) AlignAlloc(n * sizeof(T), AlignOf<T>());
     if (!ptr) {
         throw std::runtime_error("failed to allocate");
     }
@@ -260,7 +272,7 @@ T *Allocator<T>::allocate(const size_t n) const
         throw std::runtime_error("invalid array length");
     }
 
-    void * const ptr = AlignAlloc(n * sizeof(T));
+    void * const ptr = AlignAlloc(n * sizeof(T), AlignOf<T>());
     if (!ptr) {
         throw std::runtime_error("failed to allocate");
     }
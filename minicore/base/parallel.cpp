@@ -27,6 +27,7 @@ static pthread_cond_t gWorkFinished;
 static std::vector<pthread_t> gWorkThreads;
 static std::unordered_map<pthread_t, size_t> gWorkThreadId;
 static std::queue<ThreadPool::Work> gWorkQueue;
+static thread_local bool gIsPoolThread = false;
 
 ///
 /// @brief Initialize the thread pool with a specified number of threads using
@@ -49,7 +50,8 @@ void ThreadPool::Initialize(const uint32_t numThreads)
 
 ///
 /// @brief Destroy the thread pool and terminate all threads. Set terminate flag
-/// and wake up any threads so they can terminate.
+/// and wake up any threads so they can terminate. The pool is then empty and
+/// the parallel functions run in the calling thread.
 ///
 void ThreadPool::Terminate()
 {
@@ -60,6 +62,8 @@ void ThreadPool::Terminate()
     for (auto &thread : gWorkThreads) {
         pthread_join(thread, NULL);
     }
+    gWorkThreads.clear();
+    gWorkThreadId.clear();
 }
 
 ///
@@ -73,6 +77,7 @@ void ThreadPool::Terminate()
 ///
 void *ThreadPool::Execute(void *arg)
 {
+    gIsPoolThread = true;
     while (true) {
         Work work;
 
@@ -150,6 +155,14 @@ size_t ThreadPool::GetThreadId()
     return gWorkThreadId[thread];
 }
 
+///
+/// @brief Return true if the calling thread is one of the pool threads.
+///
+bool ThreadPool::IsPoolThread()
+{
+    return gIsPoolThread;
+}
+
 ///
 /// @brief Return the number of threads in the pool.
 ///
@@ -200,4 +213,28 @@ void ParallelFor(void (*run) (size_t, void *), const size_t count, void *data)
     ThreadPool::Wait();
 }
 
+///
+/// @brief Parallel for loop over an array of items, or a sequential loop in the
+/// calling thread if parallel is not set, the pool is empty or the caller is a
+/// pool thread. ThreadPool::Wait returns once the work count is zero, and the
+/// work item of a pool thread is counted until it returns, so a nested loop
+/// over the pool would never finish.
+///
+void ParallelForIf(
+    void (*run) (size_t, void *),
+    const size_t count,
+    void *data,
+    const bool parallel)
+{
+    if (!parallel ||
+        ThreadPool::GetNumThreads() == 0 ||
+        ThreadPool::IsPoolThread()) {
+        for (size_t id = 0; id < count; ++id) {
+            run(id, data);
+        }
+        return;
+    }
+    ParallelFor(run, count, data);
+}
+
 } // namespace Base
@@ -10,6 +10,9 @@
 #ifndef BASE_PARALLEL_H_
 #define BASE_PARALLEL_H_
 
+#include <cstdint>
+#include <cstddef>
+
 namespace Base {
 
 ///
@@ -30,12 +33,23 @@ struct ThreadPool {
     static void Wait();
     static size_t GetNumThreads();
     static size_t GetThreadId();
+    static bool IsPoolThread();
     static size_t RoundUp(size_t count);
 };
 
 /// @brief Parallel for loop over an array of items.
 void ParallelFor(void (*run) (size_t, void *), const size_t count, void *data);
 
+/// @brief Parallel for loop over an array of items if parallel is set, the pool
+/// is running and the caller is not a pool thread. Otherwise, run the items in
+/// order in the calling thread, since a pool thread waiting on the pool would
+/// wait on its own work item.
+void ParallelForIf(
+    void (*run) (size_t, void *),
+    const size_t count,
+    void *data,
+    const bool parallel);
+
 } // namespace Base
 
 #endif // BASE_PARALLEL_H_
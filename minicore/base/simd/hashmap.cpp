@@ -0,0 +1,161 @@
+//
+// hashmap.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <immintrin.h>
+#include "hashmap.h"
+
+namespace Base {
+
+static const uint32_t kEmpty = 0xffffffff;
+static const uint32_t kGroupSize = 4;
+static const uint32_t kBatchSize = 8;
+
+///
+/// @brief Atomic load of the key of a 64-bit slot.
+///
+static inline uint32_t LoadKey(const uint64_t *slot)
+{
+    return (uint32_t) __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+}
+
+///
+/// @brief Return the first slot containing the key in a group of slots.
+/// @fn _mm256_cmpeq_epi32(__m256i a, __m256i b)
+///  dst[i+31:i] := (a[i+31:i] == b[i+31:i]) ? 0xFFFFFFFF : 0
+///
+/// @fn _mm256_movemask_ps(__m256 a)
+///  dst[j] := a[32*j+31], j = 0..7
+///
+/// Each 64-bit slot spans two 32-bit lanes, {key, value}. Only the even lanes
+/// hold keys, so the movemask is reduced with 0b01010101.
+///
+/// A slot is written once, from empty to its item, so a key found by the group
+/// load is final. The group load is not atomic as a whole, and an empty slot
+/// may have been filled by a concurrent insert since. The first empty slot of
+/// a group is read again with an atomic load, and the scan continues past it
+/// if it is no longer empty.
+///
+uint32_t HashmapProbeAvx2(
+    const uint64_t *data,
+    const uint32_t mask,
+    const uint32_t key,
+    uint32_t slot,
+    uint32_t count)
+{
+    const __m256i vkey = _mm256_set1_epi32((int) key);
+    const __m256i vempty = _mm256_set1_epi32((int) kEmpty);
+    const uint32_t capacity = mask + 1;
+
+    while (count > 0) {
+        if (count >= kGroupSize && slot + kGroupSize <= capacity) {
+            __m256i group = _mm256_loadu_si256((const __m256i *) (data + slot));
+            int match = _mm256_movemask_ps(_mm256_castsi256_ps(
+                _mm256_cmpeq_epi32(group, vkey))) & 0b01010101;
+            int empty = _mm256_movemask_ps(_mm256_castsi256_ps(
+                _mm256_cmpeq_epi32(group, vempty))) & 0b01010101;
+            if ((match | empty) == 0) {
+                slot = (slot + kGroupSize) & mask;
+                count -= kGroupSize;
+                continue;
+            }
+
+            int first = __builtin_ctz(match | empty);
+            if (match & (1 << first)) {
+                return slot + first / 2;
+            }
+            slot += first / 2;
+            count -= first / 2;
+        }
+
+        uint32_t slot_key = LoadKey(&data[slot]);
+        if (slot_key == key) {
+            return slot;
+        }
+        if (slot_key == kEmpty) {
+            return kEmpty;
+        }
+        slot = (slot + 1) & mask;
+        count -= 1;
+    }
+    return kEmpty;
+}
+
+///
+/// @brief Return the first slot of each key in an array of keys.
+/// @fn _mm256_i32gather_epi32(int const *base, __m256i vindex, const int scale)
+///  dst[i+31:i] := base[vindex[i+31:i] * scale], i = 0..7
+///
+/// The gather index of the key of a slot is 2*slot in 32-bit units, so the
+/// batched path requires a capacity of at most 2^30 slots.
+///
+void HashmapBeginAvx2(
+    const uint64_t *data,
+    const uint32_t mask,
+    const uint32_t *keys,
+    uint32_t *slots,
+    const size_t count)
+{
+    const __m256i vmask = _mm256_set1_epi32((int) mask);
+    const __m256i vempty = _mm256_set1_epi32((int) kEmpty);
+    const uint32_t capacity = mask + 1;
+
+    size_t i = 0;
+    if (capacity <= (1U << 30)) {
+        for (; i + kBatchSize <= count; i += kBatchSize) {
+            //
+            // Gather the key of the initial slot of each key in the batch.
+            //
+            __m256i vkeys = _mm256_loadu_si256((const __m256i *) (keys + i));
+            __m256i vslots = _mm256_and_si256(vkeys, vmask);
+            __m256i vindex = _mm256_slli_epi32(vslots, 1);
+            __m256i vfound = _mm256_i32gather_epi32(
+                (const int *) data, vindex, 4);
+            //
+            // Found keys return their initial slot, empty slots return the
+            // empty flag. The remaining keys collide with a different key.
+            //
+            __m256i hit = _mm256_cmpeq_epi32(vfound, vkeys);
+            __m256i empty = _mm256_cmpeq_epi32(vfound, vempty);
+            __m256i result = _mm256_blendv_epi8(vempty, vslots, hit);
+            _mm256_storeu_si256((__m256i *) (slots + i), result);
+
+            int pending = ~_mm256_movemask_ps(_mm256_castsi256_ps(
+                _mm256_or_si256(hit, empty))) & 0xff;
+            while (pending) {
+                int j = __builtin_ctz(pending);
+                pending &= pending - 1;
+                uint32_t key = keys[i + j];
+                slots[i + j] = HashmapProbeAvx2(
+                    data, mask, key, (key + 1) & mask, capacity - 1);
+            }
+
+            //
+            // The gather is not atomic, read each empty initial slot again
+            // and probe the keys whose slot was filled since.
+            //
+            int missing = _mm256_movemask_ps(_mm256_castsi256_ps(empty));
+            while (missing) {
+                int j = __builtin_ctz(missing);
+                missing &= missing - 1;
+                uint32_t key = keys[i + j];
+                if (LoadKey(&data[key & mask]) != kEmpty) {
+                    slots[i + j] = HashmapProbeAvx2(
+                        data, mask, key, key & mask, capacity);
+                }
+            }
+        }
+    }
+
+    for (; i < count; ++i) {
+        slots[i] = HashmapProbeAvx2(
+            data, mask, keys[i], keys[i] & mask, capacity);
+    }
+}
+
+} // namespace Base
@@ -0,0 +1,47 @@
+//
+// hashmap.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef BASE_SIMD_HASHMAP_H_
+#define BASE_SIMD_HASHMAP_H_
+
+#include <cstdint>
+#include <cstddef>
+
+namespace Base {
+
+///
+/// @brief AVX2 hashmap probing kernels. The kernels are compiled in their own
+/// translation unit with AVX2 enabled and are only called if the cpu supports
+/// the instruction set.
+///
+/// HashmapProbeAvx2 scans at most count slots starting at the given slot and
+/// returns the first slot containing the key, or the empty flag if an empty
+/// slot is found first. Each iteration compares a group of 4 slots at once.
+///
+/// HashmapBeginAvx2 returns the first slot of each key in an array of keys.
+/// Keys are processed in batches of 8 by gathering the key of each initial
+/// slot at once. Keys not resolved at the initial slot are group probed.
+///
+uint32_t HashmapProbeAvx2(
+    const uint64_t *data,
+    const uint32_t mask,
+    const uint32_t key,
+    uint32_t slot,
+    uint32_t count);
+
+void HashmapBeginAvx2(
+    const uint64_t *data,
+    const uint32_t mask,
+    const uint32_t *keys,
+    uint32_t *slots,
+    const size_t count);
+
+} // namespace Base
+
+#endif // BASE_SIMD_HASHMAP_H_
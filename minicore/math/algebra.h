@@ -14,29 +14,31 @@
 #include <type_traits>
 #include "vector.h"
 #include "matrix.h"
+#include "simd/isa.h"
 
 namespace Math {
+inline namespace MATH_SIMD_ISA {
 
 /// ---- Vector algebra function declarations ---------------------------------
 /// @brief Return the 2-dimensional dot product.
 ///
-template<typename T> inline T Dot(const Vec2<T> &a, const Vec2<T> &b);
-template<typename T> inline Vec2<T> Dot(const Mat2<T> &a, const Vec2<T> &b);
-template<typename T> inline Mat2<T> Dot(const Mat2<T> &a, const Mat2<T> &b);
+template<typename T> constexpr T Dot(const Vec2<T> &a, const Vec2<T> &b);
+template<typename T> constexpr Vec2<T> Dot(const Mat2<T> &a, const Vec2<T> &b);
+template<typename T> constexpr Mat2<T> Dot(const Mat2<T> &a, const Mat2<T> &b);
 
 ///
 /// @brief Return the 3-dimensional dot product.
 ///
-template<typename T> inline T Dot(const Vec3<T> &a, const Vec3<T> &b);
-template<typename T> inline Vec3<T> Dot(const Mat3<T> &a, const Vec3<T> &b);
-template<typename T> inline Mat3<T> Dot(const Mat3<T> &a, const Mat3<T> &b);
+template<typename T> constexpr T Dot(const Vec3<T> &a, const Vec3<T> &b);
+template<typename T> constexpr Vec3<T> Dot(const Mat3<T> &a, const Vec3<T> &b);
+template<typename T> constexpr Mat3<T> Dot(const Mat3<T> &a, const Mat3<T> &b);
 
 ///
 /// @brief Return the 4-dimensional dot product.
 ///
-template<typename T> inline T Dot(const Vec4<T> &a, const Vec4<T> &b);
-template<typename T> inline Vec4<T> Dot(const Mat4<T> &a, const Vec4<T> &b);
-template<typename T> inline Mat4<T> Dot(const Mat4<T> &a, const Mat4<T> &b);
+template<typename T> constexpr T Dot(const Vec4<T> &a, const Vec4<T> &b);
+template<typename T> constexpr Vec4<T> Dot(const Mat4<T> &a, const Vec4<T> &b);
+template<typename T> constexpr Mat4<T> Dot(const Mat4<T> &a, const Mat4<T> &b);
 
 ///
 /// @brief Return the norm of the specified vector.
@@ -62,257 +64,191 @@ template<typename T> inline T Distance(const Vec4<T> &a, const Vec4<T> &b);
 ///
 /// @brief Return the cross product of two vectors.
 ///
-template<typename T> inline Vec3<T> Cross(
+template<typename T> constexpr Vec3<T> Cross(
     const Vec3<T> &a, const Vec3<T> &b);
 
 /// ---- Matrix algebra function declarations ---------------------------------
 /// @brief Return the transpose of the matrix.
 ///
-template<typename T> inline Mat2<T> Transpose(const Mat2<T> &a);
-template<typename T> inline Mat3<T> Transpose(const Mat3<T> &a);
-template<typename T> inline Mat4<T> Transpose(const Mat4<T> &a);
+template<typename T> constexpr Mat2<T> Transpose(const Mat2<T> &a);
+template<typename T> constexpr Mat3<T> Transpose(const Mat3<T> &a);
+template<typename T> constexpr Mat4<T> Transpose(const Mat4<T> &a);
 
 ///
 /// @brief Return the determinant of the matrix.
 ///
-template<typename T> inline T Determinant(const Mat2<T> &a);
-template<typename T> inline T Determinant(const Mat3<T> &a);
-template<typename T> inline T Determinant(const Mat4<T> &a);
+template<typename T> constexpr T Determinant(const Mat2<T> &a);
+template<typename T> constexpr T Determinant(const Mat3<T> &a);
+template<typename T> constexpr T Determinant(const Mat4<T> &a);
 
 ///
 /// @brief Return the inverse of the matrix.
 ///
-template<typename T> inline Mat2<T> Inverse(const Mat2<T> &a);
-template<typename T> inline Mat3<T> Inverse(const Mat3<T> &a);
-template<typename T> inline Mat4<T> Inverse(const Mat4<T> &a);
+template<typename T> constexpr Mat2<T> Inverse(const Mat2<T> &a);
+template<typename T> constexpr Mat3<T> Inverse(const Mat3<T> &a);
+template<typename T> constexpr Mat4<T> Inverse(const Mat4<T> &a);
 
-/// ---- Vector algebra function implementations ------------------------------
-/// @brief Return the 2-dimensional dot product.
+/// ---- Scalar algebra implementations ---------------------------------------
+/// @brief Scalar implementations of the algebra functions, used by the generic
+/// functions and by the simd specializations in a constant evaluation.
 ///
-template<typename T>
-inline T Dot(const Vec2<T> &a, const Vec2<T> &b)
-{
-    static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.x * b.x + a.y * b.y};
-}
-
-template<typename T>
-inline Vec2<T> Dot(const Mat2<T> &a, const Vec2<T> &b)
-{
-    static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.xx * b.x + a.xy * b.y,
-            a.yx * b.x + a.yy * b.y};
-}
-
-template<typename T>
-inline Mat2<T> Dot(const Mat2<T> &a, const Mat2<T> &b)
-{
-    static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.xx * b.xx + a.xy * b.yx,
-            a.xx * b.xy + a.xy * b.yy,
-            a.yx * b.xx + a.yy * b.yx,
-            a.yx * b.xy + a.yy * b.yy};
-}
+namespace Detail {
 
 ///
-/// @brief Return the 3-dimensional dot product.
-///
-template<typename T>
-inline T Dot(const Vec3<T> &a, const Vec3<T> &b)
-{
-    static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.x * b.x + a.y * b.y + a.z * b.z};
-}
-
-template<typename T>
-inline Vec3<T> Dot(const Mat3<T> &a, const Vec3<T> &b)
-{
-    static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.xx * b.x + a.xy * b.y + a.xz * b.z,
-            a.yx * b.x + a.yy * b.y + a.yz * b.z,
-            a.zx * b.x + a.zy * b.y + a.zz * b.z};
-}
-
-template<typename T>
-inline Mat3<T> Dot(const Mat3<T> &a, const Mat3<T> &b)
-{
-    static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.xx * b.xx + a.xy * b.yx + a.xz * b.zx,
-            a.xx * b.xy + a.xy * b.yy + a.xz * b.zy,
-            a.xx * b.xz + a.xy * b.yz + a.xz * b.zz,
-
-            a.yx * b.xx + a.yy * b.yx + a.yz * b.zx,
-            a.yx * b.xy + a.yy * b.yy + a.yz * b.zy,
-            a.yx * b.xz + a.yy * b.yz + a.yz * b.zz,
-
-            a.zx * b.xx + a.zy * b.yx + a.zz * b.zx,
-            a.zx * b.xy + a.zy * b.yy + a.zz * b.zy,
-            a.zx * b.xz + a.zy * b.yz + a.zz * b.zz};
-}
-
-///
-/// @brief Return the 4-dimensional dot product.
+/// @brief Return the 2-dimensional dot product.
 ///
 template<typename T>
-inline T Dot(const Vec4<T> &a, const Vec4<T> &b)
+constexpr T ScalarDot(const Vec2<T> &a, const Vec2<T> &b)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w};
+    return {a[0] * b[0] + a[1] * b[1]};
 }
 
 template<typename T>
-inline Vec4<T> Dot(const Mat4<T> &a, const Vec4<T> &b)
+constexpr Vec2<T> ScalarDot(const Mat2<T> &a, const Vec2<T> &b)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.xx * b.x + a.xy * b.y + a.xz * b.z + a.xw * b.w,
-            a.yx * b.x + a.yy * b.y + a.yz * b.z + a.yw * b.w,
-            a.zx * b.x + a.zy * b.y + a.zz * b.z + a.zw * b.w,
-            a.wx * b.x + a.wy * b.y + a.wz * b.z + a.ww * b.w};
+    return {a[0] * b[0] + a[1] * b[1],
+            a[2] * b[0] + a[3] * b[1]};
 }
 
 template<typename T>
-inline Mat4<T> Dot(const Mat4<T> &a, const Mat4<T> &b)
+constexpr Mat2<T> ScalarDot(const Mat2<T> &a, const Mat2<T> &b)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.xx * b.xx + a.xy * b.yx + a.xz * b.zx + a.xw * b.wx,
-            a.xx * b.xy + a.xy * b.yy + a.xz * b.zy + a.xw * b.wy,
-            a.xx * b.xz + a.xy * b.yz + a.xz * b.zz + a.xw * b.wz,
-            a.xx * b.xw + a.xy * b.yw + a.xz * b.zw + a.xw * b.ww,
-
-            a.yx * b.xx + a.yy * b.yx + a.yz * b.zx + a.yw * b.wx,
-            a.yx * b.xy + a.yy * b.yy + a.yz * b.zy + a.yw * b.wy,
-            a.yx * b.xz + a.yy * b.yz + a.yz * b.zz + a.yw * b.wz,
-            a.yx * b.xw + a.yy * b.yw + a.yz * b.zw + a.yw * b.ww,
-
-            a.zx * b.xx + a.zy * b.yx + a.zz * b.zx + a.zw * b.wx,
-            a.zx * b.xy + a.zy * b.yy + a.zz * b.zy + a.zw * b.wy,
-            a.zx * b.xz + a.zy * b.yz + a.zz * b.zz + a.zw * b.wz,
-            a.zx * b.xw + a.zy * b.yw + a.zz * b.zw + a.zw * b.ww,
-
-            a.wx * b.xx + a.wy * b.yx + a.wz * b.zx + a.ww * b.wx,
-            a.wx * b.xy + a.wy * b.yy + a.wz * b.zy + a.ww * b.wy,
-            a.wx * b.xz + a.wy * b.yz + a.wz * b.zz + a.ww * b.wz,
-            a.wx * b.xw + a.wy * b.yw + a.wz * b.zw + a.ww * b.ww};
+    return {a[0] * b[0] + a[1] * b[2],
+            a[0] * b[1] + a[1] * b[3],
+            a[2] * b[0] + a[3] * b[2],
+            a[2] * b[1] + a[3] * b[3]};
 }
 
 ///
-/// @brief Return the norm of the specified vector.
+/// @brief Return the 3-dimensional dot product.
 ///
 template<typename T>
-inline T Norm(const Vec2<T> &a)
-{
-    static_assert(std::is_floating_point<T>::value, "non floating point");
-    return std::sqrt(Dot(a,a));
-}
-
-template<typename T>
-inline T Norm(const Vec3<T> &a)
+constexpr T ScalarDot(const Vec3<T> &a, const Vec3<T> &b)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return std::sqrt(Dot(a,a));
+    return {a[0] * b[0] + a[1] * b[1] + a[2] * b[2]};
 }
 
 template<typename T>
-inline T Norm(const Vec4<T> &a)
+constexpr Vec3<T> ScalarDot(const Mat3<T> &a, const Vec3<T> &b)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return std::sqrt(Dot(a,a));
+    return {a[0] * b[0] + a[1] * b[1] + a[2] * b[2],
+            a[3] * b[0] + a[4] * b[1] + a[5] * b[2],
+            a[6] * b[0] + a[7] * b[1] + a[8] * b[2]};
 }
 
-///
-/// @brief Return the normalized vector.
-///
 template<typename T>
-inline Vec2<T> Normalize(const Vec2<T> &a)
+constexpr Mat3<T> ScalarDot(const Mat3<T> &a, const Mat3<T> &b)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return (a / Norm(a));
-}
+    return {a[0] * b[0] + a[1] * b[3] + a[2] * b[6],
+            a[0] * b[1] + a[1] * b[4] + a[2] * b[7],
+            a[0] * b[2] + a[1] * b[5] + a[2] * b[8],
 
-template<typename T>
-inline Vec3<T> Normalize(const Vec3<T> &a)
-{
-    static_assert(std::is_floating_point<T>::value, "non floating point");
-    return (a / Norm(a));
-}
+            a[3] * b[0] + a[4] * b[3] + a[5] * b[6],
+            a[3] * b[1] + a[4] * b[4] + a[5] * b[7],
+            a[3] * b[2] + a[4] * b[5] + a[5] * b[8],
 
-template<typename T>
-inline Vec4<T> Normalize(const Vec4<T> &a)
-{
-    static_assert(std::is_floating_point<T>::value, "non floating point");
-    return (a / Norm(a));
+            a[6] * b[0] + a[7] * b[3] + a[8] * b[6],
+            a[6] * b[1] + a[7] * b[4] + a[8] * b[7],
+            a[6] * b[2] + a[7] * b[5] + a[8] * b[8]};
 }
 
 ///
-/// @brief Return the distance between two points.
+/// @brief Return the 4-dimensional dot product.
 ///
 template<typename T>
-inline T Distance(const Vec2<T> &a, const Vec2<T> &b)
+constexpr T ScalarDot(const Vec4<T> &a, const Vec4<T> &b)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return Norm(a - b);
+    return {a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]};
 }
 
 template<typename T>
-inline T Distance(const Vec3<T> &a, const Vec3<T> &b)
+constexpr Vec4<T> ScalarDot(const Mat4<T> &a, const Vec4<T> &b)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return Norm(a - b);
+    return {a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3],
+            a[4] * b[0] + a[5] * b[1] + a[6] * b[2] + a[7] * b[3],
+            a[8] * b[0] + a[9] * b[1] + a[10] * b[2] + a[11] * b[3],
+            a[12] * b[0] + a[13] * b[1] + a[14] * b[2] + a[15] * b[3]};
 }
 
 template<typename T>
-inline T Distance(const Vec4<T> &a, const Vec4<T> &b)
+constexpr Mat4<T> ScalarDot(const Mat4<T> &a, const Mat4<T> &b)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return Norm(a - b);
+    return {a[0] * b[0] + a[1] * b[4] + a[2] * b[8] + a[3] * b[12],
+            a[0] * b[1] + a[1] * b[5] + a[2] * b[9] + a[3] * b[13],
+            a[0] * b[2] + a[1] * b[6] + a[2] * b[10] + a[3] * b[14],
+            a[0] * b[3] + a[1] * b[7] + a[2] * b[11] + a[3] * b[15],
+
+            a[4] * b[0] + a[5] * b[4] + a[6] * b[8] + a[7] * b[12],
+            a[4] * b[1] + a[5] * b[5] + a[6] * b[9] + a[7] * b[13],
+            a[4] * b[2] + a[5] * b[6] + a[6] * b[10] + a[7] * b[14],
+            a[4] * b[3] + a[5] * b[7] + a[6] * b[11] + a[7] * b[15],
+
+            a[8] * b[0] + a[9] * b[4] + a[10] * b[8] + a[11] * b[12],
+            a[8] * b[1] + a[9] * b[5] + a[10] * b[9] + a[11] * b[13],
+            a[8] * b[2] + a[9] * b[6] + a[10] * b[10] + a[11] * b[14],
+            a[8] * b[3] + a[9] * b[7] + a[10] * b[11] + a[11] * b[15],
+
+            a[12] * b[0] + a[13] * b[4] + a[14] * b[8] + a[15] * b[12],
+            a[12] * b[1] + a[13] * b[5] + a[14] * b[9] + a[15] * b[13],
+            a[12] * b[2] + a[13] * b[6] + a[14] * b[10] + a[15] * b[14],
+            a[12] * b[3] + a[13] * b[7] + a[14] * b[11] + a[15] * b[15]};
 }
 
 ///
 /// @brief Return the cross product of two vectors.
 ///
 template<typename T>
-inline Vec3<T> Cross(const Vec3<T> &a, const Vec3<T> &b)
+constexpr Vec3<T> ScalarCross(const Vec3<T> &a, const Vec3<T> &b)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.y * b.z - a.z * b.y,
-            a.z * b.x - a.x * b.z,
-            a.x * b.y - a.y * b.x};
+    return {a[1] * b[2] - a[2] * b[1],
+            a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0]};
 }
 
-/// ---- Matrix algebra function implementations ------------------------------
+///
 /// @brief Return the transpose of the matrix.
 ///
 template<typename T>
-inline Mat2<T> Transpose(const Mat2<T> &a)
+constexpr Mat2<T> ScalarTranspose(const Mat2<T> &a)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.xx, a.yx, a.xy, a.yy};
+    return {a[0], a[2], a[1], a[3]};
 }
 
 template<typename T>
-inline Mat3<T> Transpose(const Mat3<T> &a)
+constexpr Mat3<T> ScalarTranspose(const Mat3<T> &a)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.xx, a.yx, a.zx,
-            a.xy, a.yy, a.zy,
-            a.xz, a.yz, a.zz};
+    return {a[0], a[3], a[6],
+            a[1], a[4], a[7],
+            a[2], a[5], a[8]};
 }
 
 template<typename T>
-inline Mat4<T> Transpose(const Mat4<T> &a)
+constexpr Mat4<T> ScalarTranspose(const Mat4<T> &a)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {a.xx, a.yx, a.zx, a.wx,
-            a.xy, a.yy, a.zy, a.wy,
-            a.xz, a.yz, a.zz, a.wz,
-            a.xw, a.yw, a.zw, a.ww};
+    return {a[0], a[4], a[8], a[12],
+            a[1], a[5], a[9], a[13],
+            a[2], a[6], a[10], a[14],
+            a[3], a[7], a[11], a[15]};
 }
 
 ///
 /// @brief Return the determinant of the matrix.
 ///
 template<typename T>
-inline T Determinant(const Mat2<T> &a)
+constexpr T ScalarDeterminant(const Mat2<T> &a)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
     //
@@ -321,12 +257,12 @@ inline T Determinant(const Mat2<T> &a)
     // det(M) = +m0 * m3
     //          -m1 * m2
     //
-    T det = a.xx * a.yy - a.xy * a.yx;
+    T det = a[0] * a[3] - a[1] * a[2];
     return det;
 }
 
 template<typename T>
-inline T Determinant(const Mat3<T> &a)
+constexpr T ScalarDeterminant(const Mat3<T> &a)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
     //
@@ -340,15 +276,15 @@ inline T Determinant(const Mat3<T> &a)
     //          +m2 * m3 * m7
     //          -m2 * m4 * m6
     //
-    T minor0 = a.yy * a.zz - a.yz * a.zy;
-    T minor1 = a.yz * a.zx - a.yx * a.zz;
-    T minor2 = a.yx * a.zy - a.yy * a.zx;
-    T det = a.xx * minor0 + a.xy * minor1 + a.xz * minor2;
+    T minor0 = a[4] * a[8] - a[5] * a[7];
+    T minor1 = a[5] * a[6] - a[3] * a[8];
+    T minor2 = a[3] * a[7] - a[4] * a[6];
+    T det = a[0] * minor0 + a[1] * minor1 + a[2] * minor2;
     return det;
 }
 
 template<typename T>
-inline T Determinant(const Mat4<T> &a)
+constexpr T ScalarDeterminant(const Mat4<T> &a)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
     //
@@ -381,26 +317,26 @@ inline T Determinant(const Mat4<T> &a)
     //          +m15 * m2  * m4  * m9
     //          -m15 * m2  * m5  * m8
     //
-    T minor0  = a.zz * a.ww - a.zw * a.wz;
-    T minor1  = a.zw * a.wy - a.zy * a.ww;
-    T minor2  = a.zy * a.wz - a.zz * a.wy;
-
-    T minor3  = a.zw * a.wz - a.zz * a.ww;
-    T minor4  = a.zx * a.ww - a.zw * a.wx;
-    T minor5  = a.zz * a.wx - a.zx * a.wz;
-
-    T minor6  = a.zy * a.ww - a.zw * a.wy;
-    T minor7  = a.zw * a.wx - a.zx * a.ww;
-    T minor8  = a.zx * a.wy - a.zy * a.wx;
-
-    T minor9  = a.zz * a.wy - a.zy * a.wz;
-    T minor10 = a.zx * a.wz - a.zz * a.wx;
-    T minor11 = a.zy * a.wx - a.zx * a.wy;
-
-    T det = a.xx * (a.yy * minor0 + a.yz * minor1  + a.yw * minor2) +
-            a.xy * (a.yx * minor3 + a.yz * minor4  + a.yw * minor5) +
-            a.xz * (a.yx * minor6 + a.yy * minor7  + a.yw * minor8) +
-            a.xw * (a.yx * minor9 + a.yy * minor10 + a.yz * minor11);
+    T minor0  = a[10] * a[15] - a[11] * a[14];
+    T minor1  = a[11] * a[13] - a[9] * a[15];
+    T minor2  = a[9] * a[14] - a[10] * a[13];
+
+    T minor3  = a[11] * a[14] - a[10] * a[15];
+    T minor4  = a[8] * a[15] - a[11] * a[12];
+    T minor5  = a[10] * a[12] - a[8] * a[14];
+
+    T minor6  = a[9] * a[15] - a[11] * a[13];
+    T minor7  = a[11] * a[12] - a[8] * a[15];
+    T minor8  = a[8] * a[13] - a[9] * a[12];
+
+    T minor9  = a[10] * a[13] - a[9] * a[14];
+    T minor10 = a[8] * a[14] - a[10] * a[12];
+    T minor11 = a[9] * a[12] - a[8] * a[13];
+
+    T det = a[0] * (a[5] * minor0 + a[6] * minor1  + a[7] * minor2) +
+            a[1] * (a[4] * minor3 + a[6] * minor4  + a[7] * minor5) +
+            a[2] * (a[4] * minor6 + a[5] * minor7  + a[7] * minor8) +
+            a[3] * (a[4] * minor9 + a[5] * minor10 + a[6] * minor11);
     return det;
 }
 
@@ -408,7 +344,7 @@ inline T Determinant(const Mat4<T> &a)
 /// @brief Return the inverse of the matrix.
 ///
 template<typename T>
-inline Mat2<T> Inverse(const Mat2<T> &a)
+constexpr Mat2<T> ScalarInverse(const Mat2<T> &a)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
     //
@@ -417,18 +353,18 @@ inline Mat2<T> Inverse(const Mat2<T> &a)
     // adj(M) = { m3, -m1,
     //           -m2,  m0}
     //
-    Mat2<T> adj = { a.yy, -a.xy,
-                   -a.yx,  a.xx};
+    Mat2<T> adj = { a[3], -a[1],
+                   -a[2],  a[0]};
 
     // Compute determinant from Laplace's expansion
-    T det = a.xx * adj.xx + a.xy * adj.yx;
-    det = std::fabs(det) > (T) 0 ? (T) 1 / det : (T) 0;
+    T det = a[0] * adj[0] + a[1] * adj[2];
+    det = (det < (T) 0 || det > (T) 0) ? (T) 1 / det : (T) 0;
 
     return (adj *= det);
 }
 
 template<typename T>
-inline Mat3<T> Inverse(const Mat3<T> &a)
+constexpr Mat3<T> ScalarInverse(const Mat3<T> &a)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
     //
@@ -444,29 +380,29 @@ inline Mat3<T> Inverse(const Mat3<T> &a)
     //            +m1 * m6 - m0 * m7,
     //            +m0 * m4 - m1 * m3}
     //
-    Mat3<T> adj = {a.yy * a.zz - a.yz * a.zy,
-                   a.xz * a.zy - a.xy * a.zz,
-                   a.xy * a.yz - a.xz * a.yy,
+    Mat3<T> adj = {a[4] * a[8] - a[5] * a[7],
+                   a[2] * a[7] - a[1] * a[8],
+                   a[1] * a[5] - a[2] * a[4],
 
-                   a.yz * a.zx - a.yx * a.zz,
-                   a.xx * a.zz - a.xz * a.zx,
-                   a.xz * a.yx - a.xx * a.yz,
+                   a[5] * a[6] - a[3] * a[8],
+                   a[0] * a[8] - a[2] * a[6],
+                   a[2] * a[3] - a[0] * a[5],
 
-                   a.yx * a.zy - a.yy * a.zx,
-                   a.xy * a.zx - a.xx * a.zy,
-                   a.xx * a.yy - a.xy * a.yx};
+                   a[3] * a[7] - a[4] * a[6],
+                   a[1] * a[6] - a[0] * a[7],
+                   a[0] * a[4] - a[1] * a[3]};
 
     // Compute determinant from Laplace's expansion
-    T det = a.xx * adj.xx +
-            a.xy * adj.yx +
-            a.xz * adj.zx;
-    det = std::fabs(det) > (T) 0 ? (T) 1 / det : (T) 0;
+    T det = a[0] * adj[0] +
+            a[1] * adj[3] +
+            a[2] * adj[6];
+    det = (det < (T) 0 || det > (T) 0) ? (T) 1 / det : (T) 0;
 
     return (adj *= det);
 }
 
 template<typename T>
-inline Mat4<T> Inverse(const Mat4<T> &a)
+constexpr Mat4<T> ScalarInverse(const Mat4<T> &a)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
     //
@@ -521,80 +457,284 @@ inline Mat4<T> Inverse(const Mat4<T> &a)
     //      -m1 *m10*m4  +m2 *m9 *m4  +m0 *m10*m5
     //      -m2 *m5 *m8  +m1 *m6 *m8  -m0 *m6 *m9}
     //
-    Mat4<T> adj = {a.yy * (a.zz * a.ww - a.zw * a.wz) +
-                   a.yz * (a.zw * a.wy - a.zy * a.ww) +
-                   a.yw * (a.zy * a.wz - a.zz * a.wy),
+    Mat4<T> adj = {a[5] * (a[10] * a[15] - a[11] * a[14]) +
+                   a[6] * (a[11] * a[13] - a[9] * a[15]) +
+                   a[7] * (a[9] * a[14] - a[10] * a[13]),
 
-                   a.xy * (a.zw * a.wz - a.zz * a.ww) +
-                   a.xz * (a.zy * a.ww - a.zw * a.wy) +
-                   a.xw * (a.zz * a.wy - a.zy * a.wz),
+                   a[1] * (a[11] * a[14] - a[10] * a[15]) +
+                   a[2] * (a[9] * a[15] - a[11] * a[13]) +
+                   a[3] * (a[10] * a[13] - a[9] * a[14]),
 
-                   a.yy * (a.xw * a.wz - a.xz * a.ww) +
-                   a.yz * (a.xy * a.ww - a.xw * a.wy) +
-                   a.yw * (a.xz * a.wy - a.xy * a.wz),
+                   a[5] * (a[3] * a[14] - a[2] * a[15]) +
+                   a[6] * (a[1] * a[15] - a[3] * a[13]) +
+                   a[7] * (a[2] * a[13] - a[1] * a[14]),
 
-                   a.yy * (a.xz * a.zw - a.zz * a.xw) +
-                   a.yz * (a.xw * a.zy - a.xy * a.zw) +
-                   a.yw * (a.xy * a.zz - a.xz * a.zy),
+                   a[5] * (a[2] * a[11] - a[10] * a[3]) +
+                   a[6] * (a[3] * a[9] - a[1] * a[11]) +
+                   a[7] * (a[1] * a[10] - a[2] * a[9]),
 
-                   a.yx * (a.zw * a.wz - a.zz * a.ww) +
-                   a.yz * (a.zx * a.ww - a.zw * a.wx) +
-                   a.yw * (a.zz * a.wx - a.zx * a.wz),
+                   a[4] * (a[11] * a[14] - a[10] * a[15]) +
+                   a[6] * (a[8] * a[15] - a[11] * a[12]) +
+                   a[7] * (a[10] * a[12] - a[8] * a[14]),
 
-                   a.xx * (a.zz * a.ww - a.zw * a.wz) +
-                   a.xz * (a.zw * a.wx - a.zx * a.ww) +
-                   a.xw * (a.zx * a.wz - a.zz * a.wx),
+                   a[0] * (a[10] * a[15] - a[11] * a[14]) +
+                   a[2] * (a[11] * a[12] - a[8] * a[15]) +
+                   a[3] * (a[8] * a[14] - a[10] * a[12]),
 
-                   a.xx * (a.yw * a.wz - a.yz * a.ww) +
-                   a.xz * (a.yx * a.ww - a.yw * a.wx) +
-                   a.xw * (a.yz * a.wx - a.yx * a.wz),
+                   a[0] * (a[7] * a[14] - a[6] * a[15]) +
+                   a[2] * (a[4] * a[15] - a[7] * a[12]) +
+                   a[3] * (a[6] * a[12] - a[4] * a[14]),
 
-                   a.xx * (a.yz * a.zw - a.yw * a.zz) +
-                   a.xz * (a.yw * a.zx - a.yx * a.zw) +
-                   a.xw * (a.yx * a.zz - a.yz * a.zx),
+                   a[0] * (a[6] * a[11] - a[7] * a[10]) +
+                   a[2] * (a[7] * a[8] - a[4] * a[11]) +
+                   a[3] * (a[4] * a[10] - a[6] * a[8]),
 
-                   a.yx * (a.zy * a.ww - a.zw * a.wy) +
-                   a.yy * (a.zw * a.wx - a.zx * a.ww) +
-                   a.yw * (a.zx * a.wy - a.zy * a.wx),
+                   a[4] * (a[9] * a[15] - a[11] * a[13]) +
+                   a[5] * (a[11] * a[12] - a[8] * a[15]) +
+                   a[7] * (a[8] * a[13] - a[9] * a[12]),
 
-                   a.xx * (a.zw * a.wy - a.zy * a.ww) +
-                   a.xy * (a.zx * a.ww - a.zw * a.wx) +
-                   a.xw * (a.zy * a.wx - a.zx * a.wy),
+                   a[0] * (a[11] * a[13] - a[9] * a[15]) +
+                   a[1] * (a[8] * a[15] - a[11] * a[12]) +
+                   a[3] * (a[9] * a[12] - a[8] * a[13]),
 
-                   a.xx * (a.yy * a.ww - a.yw * a.wy) +
-                   a.xy * (a.yw * a.wx - a.yx * a.ww) +
-                   a.xw * (a.yx * a.wy - a.yy * a.wx),
+                   a[0] * (a[5] * a[15] - a[7] * a[13]) +
+                   a[1] * (a[7] * a[12] - a[4] * a[15]) +
+                   a[3] * (a[4] * a[13] - a[5] * a[12]),
 
-                   a.xx * (a.yw * a.zy - a.yy * a.zw) +
-                   a.xy * (a.yx * a.zw - a.yw * a.zx) +
-                   a.xw * (a.yy * a.zx - a.zy * a.yx),
+                   a[0] * (a[7] * a[9] - a[5] * a[11]) +
+                   a[1] * (a[4] * a[11] - a[7] * a[8]) +
+                   a[3] * (a[5] * a[8] - a[9] * a[4]),
 
-                   a.yx * (a.zz * a.wy - a.zy * a.wz) +
-                   a.yy * (a.zx * a.wz - a.zz * a.wx) +
-                   a.yz * (a.zy * a.wx - a.zx * a.wy),
+                   a[4] * (a[10] * a[13] - a[9] * a[14]) +
+                   a[5] * (a[8] * a[14] - a[10] * a[12]) +
+                   a[6] * (a[9] * a[12] - a[8] * a[13]),
 
-                   a.xx * (a.zy * a.wz - a.zz * a.wy) +
-                   a.xy * (a.zz * a.wx - a.zx * a.wz) +
-                   a.xz * (a.zx * a.wy - a.zy * a.wx),
+                   a[0] * (a[9] * a[14] - a[10] * a[13]) +
+                   a[1] * (a[10] * a[12] - a[8] * a[14]) +
+                   a[2] * (a[8] * a[13] - a[9] * a[12]),
 
-                   a.xx * (a.yz * a.wy - a.yy * a.wz) +
-                   a.xy * (a.yx * a.wz - a.yz * a.wx) +
-                   a.xz * (a.yy * a.wx - a.yx * a.wy),
+                   a[0] * (a[6] * a[13] - a[5] * a[14]) +
+                   a[1] * (a[4] * a[14] - a[6] * a[12]) +
+                   a[2] * (a[5] * a[12] - a[4] * a[13]),
 
-                   a.xx * (a.yy * a.zz - a.yz * a.zy) +
-                   a.xy * (a.yz * a.zx - a.yx * a.zz) +
-                   a.xz * (a.yx * a.zy - a.yy * a.zx)};
+                   a[0] * (a[5] * a[10] - a[6] * a[9]) +
+                   a[1] * (a[6] * a[8] - a[4] * a[10]) +
+                   a[2] * (a[4] * a[9] - a[5] * a[8])};
 
     // Compute inverse matrix using Laplace's expansion
-    T det = a.xx * adj.xx +
-            a.xy * adj.yx +
-            a.xz * adj.zx +
-            a.xw * adj.wx;
-    det = std::fabs(det) > (T) 0 ? (T) 1 / det : (T) 0;
+    T det = a[0] * adj[0] +
+            a[1] * adj[4] +
+            a[2] * adj[8] +
+            a[3] * adj[12];
+    det = (det < (T) 0 || det > (T) 0) ? (T) 1 / det : (T) 0;
 
     return (adj *= det);
 }
 
+} // namespace Detail
+
+/// ---- Vector algebra function implementations ------------------------------
+/// @brief Return the dot product.
+///
+template<typename T>
+constexpr T Dot(const Vec2<T> &a, const Vec2<T> &b)
+{
+    return Detail::ScalarDot(a, b);
+}
+
+template<typename T>
+constexpr Vec2<T> Dot(const Mat2<T> &a, const Vec2<T> &b)
+{
+    return Detail::ScalarDot(a, b);
+}
+
+template<typename T>
+constexpr Mat2<T> Dot(const Mat2<T> &a, const Mat2<T> &b)
+{
+    return Detail::ScalarDot(a, b);
+}
+
+template<typename T>
+constexpr T Dot(const Vec3<T> &a, const Vec3<T> &b)
+{
+    return Detail::ScalarDot(a, b);
+}
+
+template<typename T>
+constexpr Vec3<T> Dot(const Mat3<T> &a, const Vec3<T> &b)
+{
+    return Detail::ScalarDot(a, b);
+}
+
+template<typename T>
+constexpr Mat3<T> Dot(const Mat3<T> &a, const Mat3<T> &b)
+{
+    return Detail::ScalarDot(a, b);
+}
+
+template<typename T>
+constexpr T Dot(const Vec4<T> &a, const Vec4<T> &b)
+{
+    return Detail::ScalarDot(a, b);
+}
+
+template<typename T>
+constexpr Vec4<T> Dot(const Mat4<T> &a, const Vec4<T> &b)
+{
+    return Detail::ScalarDot(a, b);
+}
+
+template<typename T>
+constexpr Mat4<T> Dot(const Mat4<T> &a, const Mat4<T> &b)
+{
+    return Detail::ScalarDot(a, b);
+}
+
+///
+/// @brief Return the norm of the specified vector.
+///
+template<typename T>
+inline T Norm(const Vec2<T> &a)
+{
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    return std::sqrt(Dot(a,a));
+}
+
+template<typename T>
+inline T Norm(const Vec3<T> &a)
+{
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    return std::sqrt(Dot(a,a));
+}
+
+template<typename T>
+inline T Norm(const Vec4<T> &a)
+{
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    return std::sqrt(Dot(a,a));
+}
+
+///
+/// @brief Return the normalized vector.
+///
+template<typename T>
+inline Vec2<T> Normalize(const Vec2<T> &a)
+{
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    return (a / Norm(a));
+}
+
+template<typename T>
+inline Vec3<T> Normalize(const Vec3<T> &a)
+{
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    return (a / Norm(a));
+}
+
+template<typename T>
+inline Vec4<T> Normalize(const Vec4<T> &a)
+{
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    return (a / Norm(a));
+}
+
+///
+/// @brief Return the distance between two points.
+///
+template<typename T>
+inline T Distance(const Vec2<T> &a, const Vec2<T> &b)
+{
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    return Norm(a - b);
+}
+
+template<typename T>
+inline T Distance(const Vec3<T> &a, const Vec3<T> &b)
+{
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    return Norm(a - b);
+}
+
+template<typename T>
+inline T Distance(const Vec4<T> &a, const Vec4<T> &b)
+{
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    return Norm(a - b);
+}
+
+///
+/// @brief Return the cross product of two vectors.
+///
+template<typename T>
+constexpr Vec3<T> Cross(const Vec3<T> &a, const Vec3<T> &b)
+{
+    return Detail::ScalarCross(a, b);
+}
+
+/// ---- Matrix algebra function implementations ------------------------------
+/// @brief Return the transpose of the matrix.
+///
+template<typename T>
+constexpr Mat2<T> Transpose(const Mat2<T> &a)
+{
+    return Detail::ScalarTranspose(a);
+}
+
+template<typename T>
+constexpr Mat3<T> Transpose(const Mat3<T> &a)
+{
+    return Detail::ScalarTranspose(a);
+}
+
+template<typename T>
+constexpr Mat4<T> Transpose(const Mat4<T> &a)
+{
+    return Detail::ScalarTranspose(a);
+}
+
+///
+/// @brief Return the determinant of the matrix.
+///
+template<typename T>
+constexpr T Determinant(const Mat2<T> &a)
+{
+    return Detail::ScalarDeterminant(a);
+}
+
+template<typename T>
+constexpr T Determinant(const Mat3<T> &a)
+{
+    return Detail::ScalarDeterminant(a);
+}
+
+template<typename T>
+constexpr T Determinant(const Mat4<T> &a)
+{
+    return Detail::ScalarDeterminant(a);
+}
+
+///
+/// @brief Return the inverse of the matrix.
+///
+template<typename T>
+constexpr Mat2<T> Inverse(const Mat2<T> &a)
+{
+    return Detail::ScalarInverse(a);
+}
+
+template<typename T>
+constexpr Mat3<T> Inverse(const Mat3<T> &a)
+{
+    return Detail::ScalarInverse(a);
+}
+
+template<typename T>
+constexpr Mat4<T> Inverse(const Mat4<T> &a)
+{
+    return Detail::ScalarInverse(a);
+}
+
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 /// ---- simd implementations ------------------------------------------------
@@ -15,8 +15,10 @@
 #include <type_traits>
 #include <algorithm>
 #include "vector.h"
+#include "simd/isa.h"
 
 namespace Math {
+inline namespace MATH_SIMD_ISA {
 
 /// ---- Function declarations ------------------------------------------------
 /// @brief Floating point functions.
@@ -63,23 +65,23 @@ template<typename T> inline Vec3<T> SmoothStep(
 template<typename T> inline Vec4<T> SmoothStep(
     const Vec4<T> &lo, const Vec4<T> &hi, const Vec4<T> &u);
 
-template<typename T> inline T Lerp(const T lo, const T hi,  T u);
-template<typename T> inline Vec2<T> Lerp(
+template<typename T> constexpr T Lerp(const T lo, const T hi,  T u);
+template<typename T> constexpr Vec2<T> Lerp(
     const Vec2<T> &lo, const Vec2<T> &hi, const T u);
-template<typename T> inline Vec3<T> Lerp(
+template<typename T> constexpr Vec3<T> Lerp(
     const Vec3<T> &lo, const Vec3<T> &hi, const T u);
-template<typename T> inline Vec4<T> Lerp(
+template<typename T> constexpr Vec4<T> Lerp(
     const Vec4<T> &lo, const Vec4<T> &hi, const T u);
 
-template<typename T> inline T Radians(const T u);
-template<typename T> inline Vec2<T> Radians(const Vec2<T> &u);
-template<typename T> inline Vec3<T> Radians(const Vec3<T> &u);
-template<typename T> inline Vec4<T> Radians(const Vec4<T> &u);
+template<typename T> constexpr T Radians(const T u);
+template<typename T> constexpr Vec2<T> Radians(const Vec2<T> &u);
+template<typename T> constexpr Vec3<T> Radians(const Vec3<T> &u);
+template<typename T> constexpr Vec4<T> Radians(const Vec4<T> &u);
 
-template<typename T> inline T Degrees(const T u);
-template<typename T> inline Vec2<T> Degrees(const Vec2<T> &u);
-template<typename T> inline Vec3<T> Degrees(const Vec3<T> &u);
-template<typename T> inline Vec4<T> Degrees(const Vec4<T> &u);
+template<typename T> constexpr T Degrees(const T u);
+template<typename T> constexpr Vec2<T> Degrees(const Vec2<T> &u);
+template<typename T> constexpr Vec3<T> Degrees(const Vec3<T> &u);
+template<typename T> constexpr Vec4<T> Degrees(const Vec4<T> &u);
 
 ///
 /// @brief Arithmetic functions.
@@ -89,34 +91,62 @@ template<typename T> inline void Swap(Vec2<T> &u, Vec2<T> &v);
 template<typename T> inline void Swap(Vec3<T> &u, Vec3<T> &v);
 template<typename T> inline void Swap(Vec4<T> &u, Vec4<T> &v);
 
-template<typename T> inline T Sign(const T u);
-template<typename T> inline Vec2<T> Sign(const Vec2<T> &u);
-template<typename T> inline Vec3<T> Sign(const Vec3<T> &u);
-template<typename T> inline Vec4<T> Sign(const Vec4<T> &u);
+template<typename T> constexpr T Sign(const T u);
+template<typename T> constexpr Vec2<T> Sign(const Vec2<T> &u);
+template<typename T> constexpr Vec3<T> Sign(const Vec3<T> &u);
+template<typename T> constexpr Vec4<T> Sign(const Vec4<T> &u);
 
-template<typename T> inline T Abs(const T u);
-template<typename T> inline Vec2<T> Abs(const Vec2<T> &u);
-template<typename T> inline Vec3<T> Abs(const Vec3<T> &u);
-template<typename T> inline Vec4<T> Abs(const Vec4<T> &u);
+template<typename T> constexpr T Abs(const T u);
+template<typename T> constexpr Vec2<T> Abs(const Vec2<T> &u);
+template<typename T> constexpr Vec3<T> Abs(const Vec3<T> &u);
+template<typename T> constexpr Vec4<T> Abs(const Vec4<T> &u);
 
-template<typename T> inline T Min(const T u, const T v);
-template<typename T> inline Vec2<T> Min(const Vec2<T> &u, const Vec2<T> &v);
-template<typename T> inline Vec3<T> Min(const Vec3<T> &u, const Vec3<T> &v);
-template<typename T> inline Vec4<T> Min(const Vec4<T> &u, const Vec4<T> &v);
+template<typename T> constexpr T Min(const T u, const T v);
+template<typename T> constexpr Vec2<T> Min(const Vec2<T> &u, const Vec2<T> &v);
+template<typename T> constexpr Vec3<T> Min(const Vec3<T> &u, const Vec3<T> &v);
+template<typename T> constexpr Vec4<T> Min(const Vec4<T> &u, const Vec4<T> &v);
 
-template<typename T> inline T Max(const T u, const T v);
-template<typename T> inline Vec2<T> Max(const Vec2<T> &u, const Vec2<T> &v);
-template<typename T> inline Vec3<T> Max(const Vec3<T> &u, const Vec3<T> &v);
-template<typename T> inline Vec4<T> Max(const Vec4<T> &u, const Vec4<T> &v);
+template<typename T> constexpr T Max(const T u, const T v);
+template<typename T> constexpr Vec2<T> Max(const Vec2<T> &u, const Vec2<T> &v);
+template<typename T> constexpr Vec3<T> Max(const Vec3<T> &u, const Vec3<T> &v);
+template<typename T> constexpr Vec4<T> Max(const Vec4<T> &u, const Vec4<T> &v);
 
-template<typename T> inline T Clamp(const T u, const T lo, const T hi);
-template<typename T> inline Vec2<T> Clamp(
+template<typename T> constexpr T Clamp(const T u, const T lo, const T hi);
+template<typename T> constexpr Vec2<T> Clamp(
     const Vec2<T> &u, const Vec2<T> &lo, const Vec2<T> &hi);
-template<typename T> inline Vec3<T> Clamp(
+template<typename T> constexpr Vec3<T> Clamp(
     const Vec3<T> &u, const Vec3<T> &lo, const Vec3<T> &hi);
-template<typename T> inline Vec4<T> Clamp(
+template<typename T> constexpr Vec4<T> Clamp(
     const Vec4<T> &u, const Vec4<T> &lo, const Vec4<T> &hi);
 
+///
+/// @brief Comparison functions.
+///
+template<typename T> constexpr Vec2<T> Equal(
+    const Vec2<T> &u, const Vec2<T> &v);
+template<typename T> constexpr Vec3<T> Equal(
+    const Vec3<T> &u, const Vec3<T> &v);
+template<typename T> constexpr Vec4<T> Equal(
+    const Vec4<T> &u, const Vec4<T> &v);
+
+template<typename T> constexpr Vec2<T> Less(const Vec2<T> &u, const Vec2<T> &v);
+template<typename T> constexpr Vec3<T> Less(const Vec3<T> &u, const Vec3<T> &v);
+template<typename T> constexpr Vec4<T> Less(const Vec4<T> &u, const Vec4<T> &v);
+
+template<typename T> constexpr Vec2<T> Greater(
+    const Vec2<T> &u, const Vec2<T> &v);
+template<typename T> constexpr Vec3<T> Greater(
+    const Vec3<T> &u, const Vec3<T> &v);
+template<typename T> constexpr Vec4<T> Greater(
+    const Vec4<T> &u, const Vec4<T> &v);
+
+template<typename T> constexpr Vec2<T> Select(
+    const Vec2<T> &mask, const Vec2<T> &u, const Vec2<T> &v);
+template<typename T> constexpr Vec3<T> Select(
+    const Vec3<T> &mask, const Vec3<T> &u, const Vec3<T> &v);
+template<typename T> constexpr Vec4<T> Select(
+    const Vec4<T> &mask, const Vec4<T> &u, const Vec4<T> &v);
+
 /// ---- Floating point functions ---------------------------------------------
 /// @brief Is u approx equal to v? (u ~ v), iif |u-v| <= eps * Min(|u|,|v|)
 /// If (u = 0) identically, then the relation above will be false even if
@@ -390,39 +420,39 @@ inline Vec4<T> SmoothStep(
 /// @brief Linear interpolation between lo and hi.
 ///
 template<typename T>
-inline T Lerp(const T lo, const T hi, const T u)
+constexpr T Lerp(const T lo, const T hi, const T u)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
     return lo * (1 - u) + hi * u;
 }
 
 template<typename T>
-inline Vec2<T> Lerp(const Vec2<T> &lo, const Vec2<T> &hi, const Vec2<T> &u)
+constexpr Vec2<T> Lerp(const Vec2<T> &lo, const Vec2<T> &hi, const Vec2<T> &u)
 {
     return {
-        Lerp(lo.x, hi.x, u.x),
-        Lerp(lo.y, hi.y, u.y)
+        Lerp(lo[0], hi[0], u[0]),
+        Lerp(lo[1], hi[1], u[1])
     };
 }
 
 template<typename T>
-inline Vec3<T> Lerp(const Vec3<T> &lo, const Vec3<T> &hi, const Vec3<T> &u)
+constexpr Vec3<T> Lerp(const Vec3<T> &lo, const Vec3<T> &hi, const Vec3<T> &u)
 {
     return {
-        Lerp(lo.x, hi.x, u.x),
-        Lerp(lo.y, hi.y, u.y),
-        Lerp(lo.z, hi.z, u.z)
+        Lerp(lo[0], hi[0], u[0]),
+        Lerp(lo[1], hi[1], u[1]),
+        Lerp(lo[2], hi[2], u[2])
     };
 }
 
 template<typename T>
-inline Vec4<T> Lerp(const Vec4<T> &lo, const Vec4<T> &hi, const Vec4<T> &u)
+constexpr Vec4<T> Lerp(const Vec4<T> &lo, const Vec4<T> &hi, const Vec4<T> &u)
 {
     return {
-        Lerp(lo.x, hi.x, u.x),
-        Lerp(lo.y, hi.y, u.y),
-        Lerp(lo.z, hi.z, u.z),
-        Lerp(lo.w, hi.w, u.w)
+        Lerp(lo[0], hi[0], u[0]),
+        Lerp(lo[1], hi[1], u[1]),
+        Lerp(lo[2], hi[2], u[2]),
+        Lerp(lo[3], hi[3], u[3])
     };
 }
 
@@ -430,56 +460,56 @@ inline Vec4<T> Lerp(const Vec4<T> &lo, const Vec4<T> &hi, const Vec4<T> &u)
 /// @brief Convert degrees to radians.
 ///
 template<typename T>
-inline T Radians(const T u)
+constexpr T Radians(const T u)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
     return u * M_PI / 180;
 }
 
 template<typename T>
-inline Vec2<T> Radians(const Vec2<T> &u)
+constexpr Vec2<T> Radians(const Vec2<T> &u)
 {
-    return {Radians(u.x), Radians(u.y)};
+    return {Radians(u[0]), Radians(u[1])};
 }
 
 template<typename T>
-inline Vec3<T> Radians(const Vec3<T> &u)
+constexpr Vec3<T> Radians(const Vec3<T> &u)
 {
-    return {Radians(u.x), Radians(u.y), Radians(u.z)};
+    return {Radians(u[0]), Radians(u[1]), Radians(u[2])};
 }
 
 template<typename T>
-inline Vec4<T> Radians(const Vec4<T> &u)
+constexpr Vec4<T> Radians(const Vec4<T> &u)
 {
-    return {Radians(u.x), Radians(u.y), Radians(u.z), Radians(u.w)};
+    return {Radians(u[0]), Radians(u[1]), Radians(u[2]), Radians(u[3])};
 }
 
 ///
 /// @brief Convert radians to degrees.
 ///
 template<typename T>
-inline T Degrees(const T u)
+constexpr T Degrees(const T u)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
     return u * static_cast<T>(180) / M_PI;
 }
 
 template<typename T>
-inline Vec2<T> Degrees(const Vec2<T> &u)
+constexpr Vec2<T> Degrees(const Vec2<T> &u)
 {
-    return {Degrees(u.x), Degrees(u.y)};
+    return {Degrees(u[0]), Degrees(u[1])};
 }
 
 template<typename T>
-inline Vec3<T> Degrees(const Vec3<T> &u)
+constexpr Vec3<T> Degrees(const Vec3<T> &u)
 {
-    return {Degrees(u.x), Degrees(u.y), Degrees(u.z)};
+    return {Degrees(u[0]), Degrees(u[1]), Degrees(u[2])};
 }
 
 template<typename T>
-inline Vec4<T> Degrees(const Vec4<T> &u)
+constexpr Vec4<T> Degrees(const Vec4<T> &u)
 {
-    return {Degrees(u.x), Degrees(u.y), Degrees(u.z), Degrees(u.w)};
+    return {Degrees(u[0]), Degrees(u[1]), Degrees(u[2]), Degrees(u[3])};
 }
 
 /// ---- Arithmetic functions -------------------------------------------------
@@ -501,137 +531,243 @@ inline void Swap(Vec4<T> &u, Vec4<T> &v) { std::swap(u, v); }
 /// @brief Return the signum function of u.
 ///
 template<typename T>
-inline T Sign(const T u)
+constexpr T Sign(const T u)
 {
     return (u < 0) ? -1 : (u > 0) ?  1 : 0;
 }
 
 template<typename T>
-inline Vec2<T> Sign(const Vec2<T> &u)
+constexpr Vec2<T> Sign(const Vec2<T> &u)
 {
-    return {Sign(u.x), Sign(u.y)};
+    return {Sign(u[0]), Sign(u[1])};
 }
 
 template<typename T>
-inline Vec3<T> Sign(const Vec3<T> &u)
+constexpr Vec3<T> Sign(const Vec3<T> &u)
 {
-    return {Sign(u.x), Sign(u.y), Sign(u.z)};
+    return {Sign(u[0]), Sign(u[1]), Sign(u[2])};
 }
 
 template<typename T>
-inline Vec4<T> Sign(const Vec4<T> &u)
+constexpr Vec4<T> Sign(const Vec4<T> &u)
 {
-    return {Sign(u.x), Sign(u.y), Sign(u.z), Sign(u.w)};
+    return {Sign(u[0]), Sign(u[1]), Sign(u[2]), Sign(u[3])};
 }
 
 ///
 /// @brief Return the abs function of u.
 ///
 template<typename T>
-inline T Abs(const T u)
+constexpr T Abs(const T u)
 {
-    return std::abs(u);
+    // Adding zero maps -0 to +0, the same as std::abs.
+    return u < 0 ? -u : u + static_cast<T>(0);
 }
 
 template<typename T>
-inline Vec2<T> Abs(const Vec2<T> &u)
+constexpr Vec2<T> Abs(const Vec2<T> &u)
 {
-    return {abs(u.x), Abs(u.y)};
+    return {Abs(u[0]), Abs(u[1])};
 }
 
 template<typename T>
-inline Vec3<T> Abs(const Vec3<T> &u)
+constexpr Vec3<T> Abs(const Vec3<T> &u)
 {
-    return {Abs(u.x), Abs(u.y), Abs(u.z)};
+    return {Abs(u[0]), Abs(u[1]), Abs(u[2])};
 }
 
 template<typename T>
-inline Vec4<T> Abs(const Vec4<T> &u)
+constexpr Vec4<T> Abs(const Vec4<T> &u)
 {
-    return {Abs(u.x), Abs(u.y), Abs(u.z), Abs(u.w)};
+    return {Abs(u[0]), Abs(u[1]), Abs(u[2]), Abs(u[3])};
 }
 
 ///
 /// @brief Return the min between u and v.
 ///
 template<typename T>
-inline T Min(const T u, const T v)
+constexpr T Min(const T u, const T v)
 {
-    return std::min(u, v);
+    return (v < u) ? v : u;
 }
 
 template<typename T>
-inline Vec2<T> Min(const Vec2<T> &u, const Vec2<T> &v)
+constexpr Vec2<T> Min(const Vec2<T> &u, const Vec2<T> &v)
 {
-    return {Min(u.x, v.x), Min(u.y, v.y)};
+    return {Min(u[0], v[0]), Min(u[1], v[1])};
 }
 
 template<typename T>
-inline Vec3<T> Min(const Vec3<T> &u, const Vec3<T> &v)
+constexpr Vec3<T> Min(const Vec3<T> &u, const Vec3<T> &v)
 {
-    return {Min(u.x, v.x), Min(u.y, v.y), Min(u.z, v.z)};
+    return {Min(u[0], v[0]), Min(u[1], v[1]), Min(u[2], v[2])};
 }
 
 template<typename T>
-inline Vec4<T> Min(const Vec4<T> &u, const Vec4<T> &v)
+constexpr Vec4<T> Min(const Vec4<T> &u, const Vec4<T> &v)
 {
-    return {Min(u.x, v.x), Min(u.y, v.y), Min(u.z, v.z), Min(u.w, v.w)};
+    return {Min(u[0], v[0]), Min(u[1], v[1]), Min(u[2], v[2]), Min(u[3], v[3])};
 }
 
 ///
 /// @brief Return the max between u and v.
 ///
 template<typename T>
-inline T Max(const T u, const T v)
+constexpr T Max(const T u, const T v)
 {
-    return std::max(u, v);
+    return (u < v) ? v : u;
 }
 
 template<typename T>
-inline Vec2<T> Max(const Vec2<T> &u, const Vec2<T> &v)
+constexpr Vec2<T> Max(const Vec2<T> &u, const Vec2<T> &v)
 {
-    return {Max(u.x, v.x), Max(u.y, v.y)};
+    return {Max(u[0], v[0]), Max(u[1], v[1])};
 }
 
 template<typename T>
-inline Vec3<T> Max(const Vec3<T> &u, const Vec3<T> &v)
+constexpr Vec3<T> Max(const Vec3<T> &u, const Vec3<T> &v)
 {
-    return {Max(u.x, v.x), Max(u.y, v.y), Max(u.z, v.z)};
+    return {Max(u[0], v[0]), Max(u[1], v[1]), Max(u[2], v[2])};
 }
 
 template<typename T>
-inline Vec4<T> Max(const Vec4<T> &u, const Vec4<T> &v)
+constexpr Vec4<T> Max(const Vec4<T> &u, const Vec4<T> &v)
 {
-    return {Max(u.x, v.x), Max(u.y, v.y), Max(u.z, v.z), Max(u.w, v.w)};
+    return {Max(u[0], v[0]), Max(u[1], v[1]), Max(u[2], v[2]), Max(u[3], v[3])};
 }
 
 ///
 /// @brief Clamp u between lo and hi.
 ///
 template<typename T>
-inline T Clamp(const T u, const T lo, const T hi)
+constexpr T Clamp(const T u, const T lo, const T hi)
 {
     return Min(Max(u, lo), hi);
 }
 
 template<typename T>
-inline Vec2<T> Clamp(const Vec2<T> &u, const Vec2<T> &lo, const Vec2<T> &hi)
+constexpr Vec2<T> Clamp(const Vec2<T> &u, const Vec2<T> &lo, const Vec2<T> &hi)
 {
     return Min(Max(u, lo), hi);
 }
 
 template<typename T>
-inline Vec3<T> Clamp(const Vec3<T> &u, const Vec3<T> &lo, const Vec3<T> &hi)
+constexpr Vec3<T> Clamp(const Vec3<T> &u, const Vec3<T> &lo, const Vec3<T> &hi)
 {
     return Min(Max(u, lo), hi);
 }
 
 template<typename T>
-inline Vec4<T> Clamp(const Vec4<T> &u, const Vec4<T> &lo, const Vec4<T> &hi)
+constexpr Vec4<T> Clamp(const Vec4<T> &u, const Vec4<T> &lo, const Vec4<T> &hi)
 {
     return Min(Max(u, lo), hi);
 }
 
+/// ---- Comparison functions -------------------------------------------------
+/// @brief Compare u with v element-wise. Each element of the result is one if
+/// the comparison holds for the corresponding elements, or zero otherwise.
+///
+template<typename T>
+constexpr Vec2<T> Equal(const Vec2<T> &u, const Vec2<T> &v)
+{
+    return {(T) (u[0] == v[0]), (T) (u[1] == v[1])};
+}
+
+template<typename T>
+constexpr Vec3<T> Equal(const Vec3<T> &u, const Vec3<T> &v)
+{
+    return {(T) (u[0] == v[0]), (T) (u[1] == v[1]), (T) (u[2] == v[2])};
+}
+
+template<typename T>
+constexpr Vec4<T> Equal(const Vec4<T> &u, const Vec4<T> &v)
+{
+    return {
+        (T) (u[0] == v[0]), (T) (u[1] == v[1]),
+        (T) (u[2] == v[2]), (T) (u[3] == v[3])};
+}
+
+///
+/// @brief Return one where u is less than v, or zero otherwise.
+///
+template<typename T>
+constexpr Vec2<T> Less(const Vec2<T> &u, const Vec2<T> &v)
+{
+    return {(T) (u[0] < v[0]), (T) (u[1] < v[1])};
+}
+
+template<typename T>
+constexpr Vec3<T> Less(const Vec3<T> &u, const Vec3<T> &v)
+{
+    return {(T) (u[0] < v[0]), (T) (u[1] < v[1]), (T) (u[2] < v[2])};
+}
+
+template<typename T>
+constexpr Vec4<T> Less(const Vec4<T> &u, const Vec4<T> &v)
+{
+    return {
+        (T) (u[0] < v[0]), (T) (u[1] < v[1]),
+        (T) (u[2] < v[2]), (T) (u[3] < v[3])};
+}
+
+///
+/// @brief Return one where u is greater than v, or zero otherwise.
+///
+template<typename T>
+constexpr Vec2<T> Greater(const Vec2<T> &u, const Vec2<T> &v)
+{
+    return {(T) (u[0] > v[0]), (T) (u[1] > v[1])};
+}
+
+template<typename T>
+constexpr Vec3<T> Greater(const Vec3<T> &u, const Vec3<T> &v)
+{
+    return {(T) (u[0] > v[0]), (T) (u[1] > v[1]), (T) (u[2] > v[2])};
+}
+
+template<typename T>
+constexpr Vec4<T> Greater(const Vec4<T> &u, const Vec4<T> &v)
+{
+    return {
+        (T) (u[0] > v[0]), (T) (u[1] > v[1]),
+        (T) (u[2] > v[2]), (T) (u[3] > v[3])};
+}
+
+///
+/// @brief Select the elements of u where the mask is nonzero and the elements
+/// of v elsewhere.
+///
+template<typename T>
+constexpr Vec2<T> Select(
+    const Vec2<T> &mask, const Vec2<T> &u, const Vec2<T> &v)
+{
+    return {
+        mask[0] ? u[0] : v[0],
+        mask[1] ? u[1] : v[1]};
+}
+
+template<typename T>
+constexpr Vec3<T> Select(
+    const Vec3<T> &mask, const Vec3<T> &u, const Vec3<T> &v)
+{
+    return {
+        mask[0] ? u[0] : v[0],
+        mask[1] ? u[1] : v[1],
+        mask[2] ? u[2] : v[2]};
+}
+
+template<typename T>
+constexpr Vec4<T> Select(
+    const Vec4<T> &mask, const Vec4<T> &u, const Vec4<T> &v)
+{
+    return {
+        mask[0] ? u[0] : v[0],
+        mask[1] ? u[1] : v[1],
+        mask[2] ? u[2] : v[2],
+        mask[3] ? u[3] : v[3]};
+}
+
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 /// ---- simd implementations ------------------------------------------------
@@ -0,0 +1,812 @@
+//
+// batch.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "minicore/base/parallel.h"
+#include "arithmetic.h"
+#include "batch.h"
+#include "dispatch.h"
+#include "quat.h"
+
+namespace Math {
+namespace Batch {
+
+/// ---- Batch blocks ---------------------------------------------------------
+///
+/// @brief The arrays are processed in blocks of items. Arrays smaller than the
+/// parallel threshold, or any array if the thread pool is not running, are
+/// processed in the calling thread. Each block runs the batch kernel of the
+/// highest instruction set level supported by the cpu.
+///
+static const size_t kBlockSize = 4096;
+static const size_t kParallelMinCount = 65536;
+
+///
+/// @brief Run a function over each block of an array, in parallel over the
+/// thread pool if the array is large enough. The function is called with the
+/// block index and the range of items [first, last) of the block.
+///
+template<typename Fn>
+static void RunBlocks(const size_t count, const Fn &fn)
+{
+    struct BlockData {
+        const Fn *fn;
+        size_t count;
+    } data = {&fn, count};
+
+    auto run = [](size_t block, void *arg) {
+        BlockData *data = static_cast<BlockData *>(arg);
+        size_t first = block * kBlockSize;
+        size_t last = std::min(first + kBlockSize, data->count);
+        (*data->fn)(block, first, last);
+    };
+
+    size_t num_blocks = (count + kBlockSize - 1) / kBlockSize;
+    Base::ParallelForIf(run, num_blocks, &data, count >= kParallelMinCount);
+}
+
+///
+/// @brief Return the batch kernels of the element type.
+///
+template<typename T>
+static const BatchKernels<T> &GetBatchKernels();
+
+template<>
+const BatchKernels<float> &GetBatchKernels<float>()
+{
+    return GetKernels().batchf;
+}
+
+template<>
+const BatchKernels<double> &GetBatchKernels<double>()
+{
+    return GetKernels().batchd;
+}
+
+///
+/// @brief Run a batch kernel over each block of the arrays, with the arrays
+/// offset to the first item of the block:
+///
+///  TransformBlocks    kernel(m, src, dst, count), the transform and rotate
+///                     kernels.
+///  MapBlocks          kernel(src, dst, count, accuracy), the normalize and
+///                     the elementary function kernels.
+///  ZipBlocks          kernel(a, b, dst, count), the dot, cross and distance
+///                     kernels.
+///
+template<typename M, typename V>
+static void TransformBlocks(
+    void (*kernel)(const M &, const V *, V *, const size_t),
+    const M &m,
+    const V *src,
+    V *dst,
+    const size_t count)
+{
+    RunBlocks(count, [&](size_t, size_t first, size_t last) {
+        kernel(m, src + first, dst + first, last - first);
+    });
+}
+
+template<typename V>
+static void MapBlocks(
+    void (*kernel)(const V *, V *, const size_t, const Accuracy),
+    const V *src,
+    V *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    RunBlocks(count, [&](size_t, size_t first, size_t last) {
+        kernel(src + first, dst + first, last - first, accuracy);
+    });
+}
+
+template<typename V, typename U>
+static void ZipBlocks(
+    void (*kernel)(const V *, const V *, U *, const size_t),
+    const V *a,
+    const V *b,
+    U *dst,
+    const size_t count)
+{
+    RunBlocks(count, [&](size_t, size_t first, size_t last) {
+        kernel(a + first, b + first, dst + first, last - first);
+    });
+}
+
+///
+/// @brief Compute the bounding box of each block and reduce the bounding
+/// boxes of all blocks.
+///
+template<typename T, typename V>
+static void AabbBlocks(
+    void (*kernel)(const V *, const size_t, Vec3<T> &, Vec3<T> &),
+    const V *points,
+    const size_t count,
+    Vec3<T> &lo,
+    Vec3<T> &hi)
+{
+    size_t num_blocks = (count + kBlockSize - 1) / kBlockSize;
+    std::vector<Vec3<T>> block_lo(num_blocks);
+    std::vector<Vec3<T>> block_hi(num_blocks);
+    RunBlocks(count, [&](size_t block, size_t first, size_t last) {
+        kernel(points + first, last - first, block_lo[block], block_hi[block]);
+    });
+
+    const T inf = std::numeric_limits<T>::infinity();
+    lo = {inf, inf, inf};
+    hi = {-inf, -inf, -inf};
+    for (size_t block = 0; block < num_blocks; ++block) {
+        lo = Math::Min(lo, block_lo[block]);
+        hi = Math::Max(hi, block_hi[block]);
+    }
+}
+
+/// ---- Batch interface ------------------------------------------------------
+///
+void Transform(
+    const Mat4<float> &m,
+    const Vec3<float> *src,
+    Vec3<float> *dst,
+    const size_t count)
+{
+    TransformBlocks(
+        GetBatchKernels<float>().transformVec3, m, src, dst, count);
+}
+
+void Transform(
+    const Mat4<double> &m,
+    const Vec3<double> *src,
+    Vec3<double> *dst,
+    const size_t count)
+{
+    TransformBlocks(
+        GetBatchKernels<double>().transformVec3, m, src, dst, count);
+}
+
+void Transform(const Mat4<float> &m, Vec3<float> *points, const size_t count)
+{
+    Transform(m, points, points, count);
+}
+
+void Transform(const Mat4<double> &m, Vec3<double> *points, const size_t count)
+{
+    Transform(m, points, points, count);
+}
+
+void Transform(
+    const Mat4<float> &m,
+    const PackedVec3<float> *src,
+    PackedVec3<float> *dst,
+    const size_t count)
+{
+    TransformBlocks(
+        GetBatchKernels<float>().transformPackedVec3, m, src, dst, count);
+}
+
+void Transform(
+    const Mat4<double> &m,
+    const PackedVec3<double> *src,
+    PackedVec3<double> *dst,
+    const size_t count)
+{
+    TransformBlocks(
+        GetBatchKernels<double>().transformPackedVec3, m, src, dst, count);
+}
+
+void Transform(
+    const Mat4<float> &m,
+    PackedVec3<float> *points,
+    const size_t count)
+{
+    Transform(m, points, points, count);
+}
+
+void Transform(
+    const Mat4<double> &m,
+    PackedVec3<double> *points,
+    const size_t count)
+{
+    Transform(m, points, points, count);
+}
+
+///
+/// @brief Rotate the vectors by the rotation matrix of the quaternion, which
+/// is computed once per call.
+///
+void Rotate(
+    const Quat<float> &q,
+    const Vec3<float> *src,
+    Vec3<float> *dst,
+    const size_t count)
+{
+    TransformBlocks(
+        GetBatchKernels<float>().rotateVec3, ToMat3(q), src, dst, count);
+}
+
+void Rotate(
+    const Quat<double> &q,
+    const Vec3<double> *src,
+    Vec3<double> *dst,
+    const size_t count)
+{
+    TransformBlocks(
+        GetBatchKernels<double>().rotateVec3, ToMat3(q), src, dst, count);
+}
+
+void Rotate(const Quat<float> &q, Vec3<float> *vectors, const size_t count)
+{
+    Rotate(q, vectors, vectors, count);
+}
+
+void Rotate(const Quat<double> &q, Vec3<double> *vectors, const size_t count)
+{
+    Rotate(q, vectors, vectors, count);
+}
+
+void Rotate(
+    const Quat<float> &q,
+    const PackedVec3<float> *src,
+    PackedVec3<float> *dst,
+    const size_t count)
+{
+    TransformBlocks(
+        GetBatchKernels<float>().rotatePackedVec3, ToMat3(q), src, dst, count);
+}
+
+void Rotate(
+    const Quat<double> &q,
+    const PackedVec3<double> *src,
+    PackedVec3<double> *dst,
+    const size_t count)
+{
+    TransformBlocks(
+        GetBatchKernels<double>().rotatePackedVec3, ToMat3(q), src, dst,
+        count);
+}
+
+void Rotate(
+    const Quat<float> &q,
+    PackedVec3<float> *vectors,
+    const size_t count)
+{
+    Rotate(q, vectors, vectors, count);
+}
+
+void Rotate(
+    const Quat<double> &q,
+    PackedVec3<double> *vectors,
+    const size_t count)
+{
+    Rotate(q, vectors, vectors, count);
+}
+
+void Normalize(
+    const Vec3<float> *src,
+    Vec3<float> *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    MapBlocks(
+        GetBatchKernels<float>().normalizeVec3, src, dst, count, accuracy);
+}
+
+void Normalize(
+    const Vec3<double> *src,
+    Vec3<double> *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    MapBlocks(
+        GetBatchKernels<double>().normalizeVec3, src, dst, count, accuracy);
+}
+
+void Normalize(
+    Vec3<float> *vectors,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    Normalize(vectors, vectors, count, accuracy);
+}
+
+void Normalize(
+    Vec3<double> *vectors,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    Normalize(vectors, vectors, count, accuracy);
+}
+
+void Normalize(
+    const PackedVec3<float> *src,
+    PackedVec3<float> *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    MapBlocks(
+        GetBatchKernels<float>().normalizePackedVec3, src, dst, count,
+        accuracy);
+}
+
+void Normalize(
+    const PackedVec3<double> *src,
+    PackedVec3<double> *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    MapBlocks(
+        GetBatchKernels<double>().normalizePackedVec3, src, dst, count,
+        accuracy);
+}
+
+void Normalize(
+    PackedVec3<float> *vectors,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    Normalize(vectors, vectors, count, accuracy);
+}
+
+void Normalize(
+    PackedVec3<double> *vectors,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    Normalize(vectors, vectors, count, accuracy);
+}
+
+void Dot(
+    const Vec3<float> *a,
+    const Vec3<float> *b,
+    float *dst,
+    const size_t count)
+{
+    ZipBlocks(GetBatchKernels<float>().dotVec3, a, b, dst, count);
+}
+
+void Dot(
+    const Vec3<double> *a,
+    const Vec3<double> *b,
+    double *dst,
+    const size_t count)
+{
+    ZipBlocks(GetBatchKernels<double>().dotVec3, a, b, dst, count);
+}
+
+void Cross(
+    const Vec3<float> *a,
+    const Vec3<float> *b,
+    Vec3<float> *dst,
+    const size_t count)
+{
+    ZipBlocks(GetBatchKernels<float>().crossVec3, a, b, dst, count);
+}
+
+void Cross(
+    const Vec3<double> *a,
+    const Vec3<double> *b,
+    Vec3<double> *dst,
+    const size_t count)
+{
+    ZipBlocks(GetBatchKernels<double>().crossVec3, a, b, dst, count);
+}
+
+void Distance(
+    const Vec3<float> *a,
+    const Vec3<float> *b,
+    float *dst,
+    const size_t count)
+{
+    ZipBlocks(GetBatchKernels<float>().distanceVec3, a, b, dst, count);
+}
+
+void Distance(
+    const Vec3<double> *a,
+    const Vec3<double> *b,
+    double *dst,
+    const size_t count)
+{
+    ZipBlocks(GetBatchKernels<double>().distanceVec3, a, b, dst, count);
+}
+
+void Aabb(
+    const Vec3<float> *points,
+    const size_t count,
+    Vec3<float> &lo,
+    Vec3<float> &hi)
+{
+    AabbBlocks(GetBatchKernels<float>().aabbVec3, points, count, lo, hi);
+}
+
+void Aabb(
+    const Vec3<double> *points,
+    const size_t count,
+    Vec3<double> &lo,
+    Vec3<double> &hi)
+{
+    AabbBlocks(GetBatchKernels<double>().aabbVec3, points, count, lo, hi);
+}
+
+void Aabb(
+    const PackedVec3<float> *points,
+    const size_t count,
+    Vec3<float> &lo,
+    Vec3<float> &hi)
+{
+    AabbBlocks(
+        GetBatchKernels<float>().aabbPackedVec3, points, count, lo, hi);
+}
+
+void Aabb(
+    const PackedVec3<double> *points,
+    const size_t count,
+    Vec3<double> &lo,
+    Vec3<double> &hi)
+{
+    AabbBlocks(
+        GetBatchKernels<double>().aabbPackedVec3, points, count, lo, hi);
+}
+
+///
+/// @brief Compute the cell hash key of each point, with the cell keys kernel
+/// of the highest instruction set level supported by the cpu on each block.
+///
+void CellKeys(
+    const CellGrid &grid,
+    const Vec3<float> *points,
+    uint32_t *keys,
+    const size_t count)
+{
+    const Kernels &kernels = GetKernels();
+    RunBlocks(count, [&](size_t, size_t first, size_t last) {
+        kernels.cellKeys(grid, points + first, keys + first, last - first);
+    });
+}
+
+void Rsqrt(
+    const float *src,
+    float *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    MapBlocks(GetBatchKernels<float>().rsqrt, src, dst, count, accuracy);
+}
+
+void Rsqrt(
+    const double *src,
+    double *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    MapBlocks(GetBatchKernels<double>().rsqrt, src, dst, count, accuracy);
+}
+
+void Exp(
+    const float *src,
+    float *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    MapBlocks(GetBatchKernels<float>().exp, src, dst, count, accuracy);
+}
+
+void Exp(
+    const double *src,
+    double *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    MapBlocks(GetBatchKernels<double>().exp, src, dst, count, accuracy);
+}
+
+void Log(
+    const float *src,
+    float *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    MapBlocks(GetBatchKernels<float>().log, src, dst, count, accuracy);
+}
+
+void Log(
+    const double *src,
+    double *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    MapBlocks(GetBatchKernels<double>().log, src, dst, count, accuracy);
+}
+
+template<typename T>
+static void SinCosBlocks(
+    const T *src,
+    T *sin,
+    T *cos,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    const auto kernel = GetBatchKernels<T>().sinCos;
+    RunBlocks(count, [&](size_t, size_t first, size_t last) {
+        kernel(src + first, sin + first, cos + first, last - first, accuracy);
+    });
+}
+
+void SinCos(
+    const float *src,
+    float *sin,
+    float *cos,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    SinCosBlocks(src, sin, cos, count, accuracy);
+}
+
+void SinCos(
+    const double *src,
+    double *sin,
+    double *cos,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    SinCosBlocks(src, sin, cos, count, accuracy);
+}
+
+template<typename T>
+static void Atan2Blocks(
+    const T *y,
+    const T *x,
+    T *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    const auto kernel = GetBatchKernels<T>().atan2;
+    RunBlocks(count, [&](size_t, size_t first, size_t last) {
+        kernel(y + first, x + first, dst + first, last - first, accuracy);
+    });
+}
+
+void Atan2(
+    const float *y,
+    const float *x,
+    float *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    Atan2Blocks(y, x, dst, count, accuracy);
+}
+
+void Atan2(
+    const double *y,
+    const double *x,
+    double *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    Atan2Blocks(y, x, dst, count, accuracy);
+}
+
+///
+/// @brief Compute the determinants and the inverses of each block of an array
+/// of matrices, or of a matrix array in structure of arrays layout.
+///
+template<typename T, typename M>
+static void DeterminantBlocks(
+    void (*kernel)(const M *, T *, const size_t),
+    const M *src,
+    T *dst,
+    const size_t count)
+{
+    RunBlocks(count, [&](size_t, size_t first, size_t last) {
+        kernel(src + first, dst + first, last - first);
+    });
+}
+
+template<typename T>
+static void DeterminantBlocks(
+    void (*kernel)(const T *, const size_t, T *, const size_t),
+    const T *src,
+    const size_t stride,
+    T *dst,
+    const size_t count)
+{
+    RunBlocks(count, [&](size_t, size_t first, size_t last) {
+        kernel(src + first, stride, dst + first, last - first);
+    });
+}
+
+template<typename M>
+static void InverseBlocks(
+    void (*kernel)(const M *, M *, uint8_t *, const size_t),
+    const M *src,
+    M *dst,
+    uint8_t *singular,
+    const size_t count)
+{
+    RunBlocks(count, [&](size_t, size_t first, size_t last) {
+        kernel(src + first, dst + first, singular ? singular + first : nullptr,
+            last - first);
+    });
+}
+
+template<typename T>
+static void InverseBlocks(
+    void (*kernel)(const T *, const size_t, T *, const size_t, uint8_t *,
+        const size_t),
+    const T *src,
+    const size_t src_stride,
+    T *dst,
+    const size_t dst_stride,
+    uint8_t *singular,
+    const size_t count)
+{
+    RunBlocks(count, [&](size_t, size_t first, size_t last) {
+        kernel(src + first, src_stride, dst + first, dst_stride,
+            singular ? singular + first : nullptr, last - first);
+    });
+}
+
+void Determinant(
+    const Mat3<float> *src,
+    float *dst,
+    const size_t count)
+{
+    DeterminantBlocks(
+        GetBatchKernels<float>().determinantMat3, src, dst, count);
+}
+
+void Determinant(
+    const Mat4<float> *src,
+    float *dst,
+    const size_t count)
+{
+    DeterminantBlocks(
+        GetBatchKernels<float>().determinantMat4, src, dst, count);
+}
+
+void Determinant(
+    const Mat3<double> *src,
+    double *dst,
+    const size_t count)
+{
+    DeterminantBlocks(
+        GetBatchKernels<double>().determinantMat3, src, dst, count);
+}
+
+void Determinant(
+    const Mat4<double> *src,
+    double *dst,
+    const size_t count)
+{
+    DeterminantBlocks(
+        GetBatchKernels<double>().determinantMat4, src, dst, count);
+}
+
+void Determinant(
+    const Mat3Array<float> &src,
+    float *dst,
+    const size_t count)
+{
+    DeterminantBlocks(GetBatchKernels<float>().determinantMat3Array,
+        (const float *) src.data, src.stride, dst, count);
+}
+
+void Determinant(
+    const Mat4Array<float> &src,
+    float *dst,
+    const size_t count)
+{
+    DeterminantBlocks(GetBatchKernels<float>().determinantMat4Array,
+        (const float *) src.data, src.stride, dst, count);
+}
+
+void Determinant(
+    const Mat3Array<double> &src,
+    double *dst,
+    const size_t count)
+{
+    DeterminantBlocks(GetBatchKernels<double>().determinantMat3Array,
+        (const double *) src.data, src.stride, dst, count);
+}
+
+void Determinant(
+    const Mat4Array<double> &src,
+    double *dst,
+    const size_t count)
+{
+    DeterminantBlocks(GetBatchKernels<double>().determinantMat4Array,
+        (const double *) src.data, src.stride, dst, count);
+}
+
+void Inverse(
+    const Mat3<float> *src,
+    Mat3<float> *dst,
+    uint8_t *singular,
+    const size_t count)
+{
+    InverseBlocks(
+        GetBatchKernels<float>().inverseMat3, src, dst, singular, count);
+}
+
+void Inverse(
+    const Mat4<float> *src,
+    Mat4<float> *dst,
+    uint8_t *singular,
+    const size_t count)
+{
+    InverseBlocks(
+        GetBatchKernels<float>().inverseMat4, src, dst, singular, count);
+}
+
+void Inverse(
+    const Mat3<double> *src,
+    Mat3<double> *dst,
+    uint8_t *singular,
+    const size_t count)
+{
+    InverseBlocks(
+        GetBatchKernels<double>().inverseMat3, src, dst, singular, count);
+}
+
+void Inverse(
+    const Mat4<double> *src,
+    Mat4<double> *dst,
+    uint8_t *singular,
+    const size_t count)
+{
+    InverseBlocks(
+        GetBatchKernels<double>().inverseMat4, src, dst, singular, count);
+}
+
+void Inverse(
+    const Mat3Array<float> &src,
+    const Mat3Array<float> &dst,
+    uint8_t *singular,
+    const size_t count)
+{
+    InverseBlocks(GetBatchKernels<float>().inverseMat3Array,
+        (const float *) src.data, src.stride, dst.data, dst.stride, singular,
+        count);
+}
+
+void Inverse(
+    const Mat4Array<float> &src,
+    const Mat4Array<float> &dst,
+    uint8_t *singular,
+    const size_t count)
+{
+    InverseBlocks(GetBatchKernels<float>().inverseMat4Array,
+        (const float *) src.data, src.stride, dst.data, dst.stride, singular,
+        count);
+}
+
+void Inverse(
+    const Mat3Array<double> &src,
+    const Mat3Array<double> &dst,
+    uint8_t *singular,
+    const size_t count)
+{
+    InverseBlocks(GetBatchKernels<double>().inverseMat3Array,
+        (const double *) src.data, src.stride, dst.data, dst.stride, singular,
+        count);
+}
+
+void Inverse(
+    const Mat4Array<double> &src,
+    const Mat4Array<double> &dst,
+    uint8_t *singular,
+    const size_t count)
+{
+    InverseBlocks(GetBatchKernels<double>().inverseMat4Array,
+        (const double *) src.data, src.stride, dst.data, dst.stride, singular,
+        count);
+}
+
+} // namespace Batch
+} // namespace Math
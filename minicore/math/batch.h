@@ -0,0 +1,378 @@
+//
+// batch.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_BATCH_H_
+#define MATH_BATCH_H_
+
+#include <cstdint>
+#include <cstddef>
+#include "cell.h"
+#include "fastmath.h"
+#include "matrix.h"
+#include "packed.h"
+#include "quat.h"
+#include "vector.h"
+
+namespace Math {
+namespace Batch {
+
+///
+/// @brief Batch functions apply a vector operation to every item of an array.
+/// Large arrays are split in blocks over the thread pool with
+/// Base::ParallelForIf, if the pool is running and the caller is not one of
+/// its threads, and each block is processed by the batch kernel of the
+/// highest instruction set level supported by the cpu, see dispatch.h:
+///
+///  Transform      dst[i] = Dot(m, {src[i], 1}) for each point, the
+///                 homogeneous coordinate of the result is discarded.
+///  Rotate         dst[i] = Rotate(q, src[i]) for each vector, the rotation
+///                 by the unit quaternion.
+///  Normalize      dst[i] = Normalize(src[i]).
+///  Dot            dst[i] = Dot(a[i], b[i]).
+///  Cross          dst[i] = Cross(a[i], b[i]).
+///  Distance       dst[i] = Distance(a[i], b[i]).
+///  Aabb           lo and hi corners of the axis aligned bounding box of the
+///                 points, or {+inf, -inf} if the array is empty.
+///  CellKeys       keys[i] = CellKey(grid, points[i]), the hash key of the
+///                 grid cell containing each point.
+///  Rsqrt          dst[i] = 1/sqrt(src[i]).
+///  Exp            dst[i] = exp(src[i]).
+///  Log            dst[i] = log(src[i]).
+///  SinCos         sin[i] = sin(src[i]) and cos[i] = cos(src[i]).
+///  Atan2          dst[i] = atan2(y[i], x[i]).
+///  Determinant    dst[i] = Determinant(src[i]) for each 3x3 or 4x4 matrix.
+///  Inverse        dst[i] = Inverse(src[i]) for each 3x3 or 4x4 matrix, and
+///                 singular[i] = 1 if the matrix is singular or 0 otherwise.
+///                 The inverse of a singular matrix is the zero matrix, as
+///                 in Inverse(m).
+///
+/// The output array may be the same as an input array. The in-place variants
+/// overwrite the input array with the result. Transform, Rotate, Normalize
+/// and Aabb also accept arrays of packed vectors, which are widened into
+/// packets as they are loaded. Normalize and the elementary functions take the
+/// accuracy tier of the packet fast math functions, precise by default.
+///
+/// Determinant and Inverse also accept arrays of matrices in structure of
+/// arrays layout, Mat3Array and Mat4Array, and load each packet of matrices
+/// with one contiguous load per element, each lane holding one matrix. The
+/// singular flags may be null.
+///
+template<typename T>
+struct Mat3Array {
+    T *data;        // element k of matrix i at data[k * stride + i]
+    size_t stride;  // number of matrices between elements, at least count
+};
+
+template<typename T>
+struct Mat4Array {
+    T *data;
+    size_t stride;
+};
+
+void Transform(
+    const Mat4<float> &m,
+    const Vec3<float> *src,
+    Vec3<float> *dst,
+    const size_t count);
+void Transform(
+    const Mat4<double> &m,
+    const Vec3<double> *src,
+    Vec3<double> *dst,
+    const size_t count);
+void Transform(const Mat4<float> &m, Vec3<float> *points, const size_t count);
+void Transform(const Mat4<double> &m, Vec3<double> *points, const size_t count);
+
+void Transform(
+    const Mat4<float> &m,
+    const PackedVec3<float> *src,
+    PackedVec3<float> *dst,
+    const size_t count);
+void Transform(
+    const Mat4<double> &m,
+    const PackedVec3<double> *src,
+    PackedVec3<double> *dst,
+    const size_t count);
+void Transform(
+    const Mat4<float> &m,
+    PackedVec3<float> *points,
+    const size_t count);
+void Transform(
+    const Mat4<double> &m,
+    PackedVec3<double> *points,
+    const size_t count);
+
+void Rotate(
+    const Quat<float> &q,
+    const Vec3<float> *src,
+    Vec3<float> *dst,
+    const size_t count);
+void Rotate(
+    const Quat<double> &q,
+    const Vec3<double> *src,
+    Vec3<double> *dst,
+    const size_t count);
+void Rotate(const Quat<float> &q, Vec3<float> *vectors, const size_t count);
+void Rotate(const Quat<double> &q, Vec3<double> *vectors, const size_t count);
+
+void Rotate(
+    const Quat<float> &q,
+    const PackedVec3<float> *src,
+    PackedVec3<float> *dst,
+    const size_t count);
+void Rotate(
+    const Quat<double> &q,
+    const PackedVec3<double> *src,
+    PackedVec3<double> *dst,
+    const size_t count);
+void Rotate(
+    const Quat<float> &q,
+    PackedVec3<float> *vectors,
+    const size_t count);
+void Rotate(
+    const Quat<double> &q,
+    PackedVec3<double> *vectors,
+    const size_t count);
+
+void Normalize(
+    const Vec3<float> *src,
+    Vec3<float> *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void Normalize(
+    const Vec3<double> *src,
+    Vec3<double> *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void Normalize(
+    Vec3<float> *vectors,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void Normalize(
+    Vec3<double> *vectors,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+
+void Normalize(
+    const PackedVec3<float> *src,
+    PackedVec3<float> *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void Normalize(
+    const PackedVec3<double> *src,
+    PackedVec3<double> *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void Normalize(
+    PackedVec3<float> *vectors,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void Normalize(
+    PackedVec3<double> *vectors,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+
+void Dot(
+    const Vec3<float> *a,
+    const Vec3<float> *b,
+    float *dst,
+    const size_t count);
+void Dot(
+    const Vec3<double> *a,
+    const Vec3<double> *b,
+    double *dst,
+    const size_t count);
+
+void Cross(
+    const Vec3<float> *a,
+    const Vec3<float> *b,
+    Vec3<float> *dst,
+    const size_t count);
+void Cross(
+    const Vec3<double> *a,
+    const Vec3<double> *b,
+    Vec3<double> *dst,
+    const size_t count);
+
+void Distance(
+    const Vec3<float> *a,
+    const Vec3<float> *b,
+    float *dst,
+    const size_t count);
+void Distance(
+    const Vec3<double> *a,
+    const Vec3<double> *b,
+    double *dst,
+    const size_t count);
+
+void Aabb(
+    const Vec3<float> *points,
+    const size_t count,
+    Vec3<float> &lo,
+    Vec3<float> &hi);
+void Aabb(
+    const Vec3<double> *points,
+    const size_t count,
+    Vec3<double> &lo,
+    Vec3<double> &hi);
+void Aabb(
+    const PackedVec3<float> *points,
+    const size_t count,
+    Vec3<float> &lo,
+    Vec3<float> &hi);
+void Aabb(
+    const PackedVec3<double> *points,
+    const size_t count,
+    Vec3<double> &lo,
+    Vec3<double> &hi);
+
+void CellKeys(
+    const CellGrid &grid,
+    const Vec3<float> *points,
+    uint32_t *keys,
+    const size_t count);
+
+void Rsqrt(
+    const float *src,
+    float *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void Rsqrt(
+    const double *src,
+    double *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+
+void Exp(
+    const float *src,
+    float *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void Exp(
+    const double *src,
+    double *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+
+void Log(
+    const float *src,
+    float *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void Log(
+    const double *src,
+    double *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+
+void SinCos(
+    const float *src,
+    float *sin,
+    float *cos,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void SinCos(
+    const double *src,
+    double *sin,
+    double *cos,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+
+void Atan2(
+    const float *y,
+    const float *x,
+    float *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+void Atan2(
+    const double *y,
+    const double *x,
+    double *dst,
+    const size_t count,
+    const Accuracy accuracy = kAccuracyPrecise);
+
+void Determinant(
+    const Mat3<float> *src,
+    float *dst,
+    const size_t count);
+void Determinant(
+    const Mat3<double> *src,
+    double *dst,
+    const size_t count);
+void Determinant(
+    const Mat4<float> *src,
+    float *dst,
+    const size_t count);
+void Determinant(
+    const Mat4<double> *src,
+    double *dst,
+    const size_t count);
+
+void Determinant(
+    const Mat3Array<float> &src,
+    float *dst,
+    const size_t count);
+void Determinant(
+    const Mat3Array<double> &src,
+    double *dst,
+    const size_t count);
+void Determinant(
+    const Mat4Array<float> &src,
+    float *dst,
+    const size_t count);
+void Determinant(
+    const Mat4Array<double> &src,
+    double *dst,
+    const size_t count);
+
+void Inverse(
+    const Mat3<float> *src,
+    Mat3<float> *dst,
+    uint8_t *singular,
+    const size_t count);
+void Inverse(
+    const Mat3<double> *src,
+    Mat3<double> *dst,
+    uint8_t *singular,
+    const size_t count);
+void Inverse(
+    const Mat4<float> *src,
+    Mat4<float> *dst,
+    uint8_t *singular,
+    const size_t count);
+void Inverse(
+    const Mat4<double> *src,
+    Mat4<double> *dst,
+    uint8_t *singular,
+    const size_t count);
+
+void Inverse(
+    const Mat3Array<float> &src,
+    const Mat3Array<float> &dst,
+    uint8_t *singular,
+    const size_t count);
+void Inverse(
+    const Mat3Array<double> &src,
+    const Mat3Array<double> &dst,
+    uint8_t *singular,
+    const size_t count);
+void Inverse(
+    const Mat4Array<float> &src,
+    const Mat4Array<float> &dst,
+    uint8_t *singular,
+    const size_t count);
+void Inverse(
+    const Mat4Array<double> &src,
+    const Mat4Array<double> &dst,
+    uint8_t *singular,
+    const size_t count);
+
+} // namespace Batch
+} // namespace Math
+
+#endif // MATH_BATCH_H_
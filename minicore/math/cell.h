@@ -0,0 +1,116 @@
+//
+// cell.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_CELL_H_
+#define MATH_CELL_H_
+
+#include <cstdint>
+#include <cstddef>
+#include "vector.h"
+
+namespace Math {
+
+///
+/// @brief CellGrid maintains a regular grid of cells over a box domain. Points
+/// are binned into cells by their cell index, and the cell index is hashed
+/// into a 32-bit key, for example to insert the points into a hashmap:
+///
+///  CellIndex      integer coordinates of the cell containing the point. The
+///                 points outside the domain are clamped to the boundary
+///                 cells.
+///  CellHash       hash key of a cell index, the spatial hash of Teschner
+///                 et al, the exclusive or of each coordinate multiplied by a
+///                 large prime.
+///  CellKey        hash key of the cell containing the point.
+///
+/// The number of cells along each axis must be positive and less than 2^24, so
+/// that every cell index is exactly representable as a float.
+/// @see Teschner et al, Optimized Spatial Hashing for Collision Detection of
+///      Deformable Objects, VMV 2003.
+///
+/// ---- Cell grid data types -------------------------------------------------
+struct CellGrid {
+    Vec3<float> lo;             // lower corner of the domain
+    Vec3<float> scale;          // number of cells per unit length
+    Vec3<uint32_t> dims;        // number of cells along each axis
+
+    // Cell grid factory function.
+    static CellGrid Create(
+        const Vec3<float> &lo,
+        const Vec3<float> &hi,
+        const Vec3<uint32_t> &dims);
+};
+
+/// Cell hash primes.
+static const uint32_t kCellHashPrimes[3] = {73856093, 19349663, 83492791};
+
+/// ---- Cell grid declarations -----------------------------------------------
+inline Vec3<uint32_t> CellIndex(const CellGrid &grid, const Vec3<float> &p);
+inline uint32_t CellHash(const Vec3<uint32_t> &cell);
+inline uint32_t CellKey(const CellGrid &grid, const Vec3<float> &p);
+
+/// ---- Cell grid implementation ---------------------------------------------
+///
+/// @brief Create a cell grid with the specified number of cells along each
+/// axis over the domain between lo and hi.
+///
+inline CellGrid CellGrid::Create(
+    const Vec3<float> &lo,
+    const Vec3<float> &hi,
+    const Vec3<uint32_t> &dims)
+{
+    CellGrid grid{};
+    grid.lo = lo;
+    grid.dims = dims;
+    for (size_t k = 0; k < 3; ++k) {
+        grid.scale.data[k] = static_cast<float>(dims.data[k]) /
+            (hi.data[k] - lo.data[k]);
+    }
+    return grid;
+}
+
+///
+/// @brief Return the index of the cell containing the point. The coordinates
+/// are clamped to the grid before they are truncated, in the same order as
+/// the vectorized kernels, which compute the same indices.
+///
+inline Vec3<uint32_t> CellIndex(const CellGrid &grid, const Vec3<float> &p)
+{
+    Vec3<uint32_t> cell{};
+    for (size_t k = 0; k < 3; ++k) {
+        float u = (p.data[k] - grid.lo.data[k]) * grid.scale.data[k];
+        float hi = static_cast<float>(grid.dims.data[k] - 1);
+        u = u > 0.0f ? u : 0.0f;
+        u = u < hi ? u : hi;
+        cell.data[k] = static_cast<uint32_t>(u);
+    }
+    return cell;
+}
+
+///
+/// @brief Return the hash key of the cell index.
+///
+inline uint32_t CellHash(const Vec3<uint32_t> &cell)
+{
+    return (kCellHashPrimes[0] * cell.x) ^
+           (kCellHashPrimes[1] * cell.y) ^
+           (kCellHashPrimes[2] * cell.z);
+}
+
+///
+/// @brief Return the hash key of the cell containing the point.
+///
+inline uint32_t CellKey(const CellGrid &grid, const Vec3<float> &p)
+{
+    return CellHash(CellIndex(grid, p));
+}
+
+} // namespace Math
+
+#endif // MATH_CELL_H_
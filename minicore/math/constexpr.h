@@ -0,0 +1,182 @@
+//
+// constexpr.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_CONSTEXPR_H_
+#define MATH_CONSTEXPR_H_
+
+#include <cstddef>
+#include "simd/isa.h"
+
+///
+/// @brief Constant evaluation of the vector and matrix functions. The generic
+/// functions are constexpr and are folded at compile time when their arguments
+/// are constant. The simd specializations are constexpr if the compiler tells
+/// a constant evaluation from a runtime one, and use the element-wise scalar
+/// functions in the constant evaluation and the intrinsics otherwise. With
+/// older compilers they are inline functions evaluated at runtime only.
+///
+/// The data of a vector or matrix is the active member of its union in a
+/// constant evaluation. Constexpr functions access the elements with data or
+/// operator[], and not with the named fields.
+///
+#if defined(__clang__)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define MATH_HAS_CONSTANT_EVALUATED 1
+#endif
+#elif defined(__GNUC__)
+#if __GNUC__ >= 9
+#define MATH_HAS_CONSTANT_EVALUATED 1
+#endif
+#elif defined(_MSC_VER)
+#if _MSC_VER >= 1925
+#define MATH_HAS_CONSTANT_EVALUATED 1
+#endif
+#endif
+
+#ifdef MATH_HAS_CONSTANT_EVALUATED
+#define MATH_SIMD_CONSTEXPR constexpr
+#define MATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define MATH_SIMD_CONSTEXPR inline
+#define MATH_IS_CONSTANT_EVALUATED() false
+#endif
+
+namespace Math {
+inline namespace MATH_SIMD_ISA {
+
+/// ---- Element-wise scalar functions ----------------------------------------
+/// @brief Element-wise operations over the data of a vector, matrix or
+/// quaternion of type U. These are the scalar implementation of the compound
+/// assignment operators.
+///
+namespace Detail {
+
+template<typename U>
+constexpr U &ScalarAdd(U &lhs, const U &rhs)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        lhs.data[i] += rhs.data[i];
+    }
+    return lhs;
+}
+
+template<typename U>
+constexpr U &ScalarSub(U &lhs, const U &rhs)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        lhs.data[i] -= rhs.data[i];
+    }
+    return lhs;
+}
+
+template<typename U>
+constexpr U &ScalarMul(U &lhs, const U &rhs)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        lhs.data[i] *= rhs.data[i];
+    }
+    return lhs;
+}
+
+template<typename U>
+constexpr U &ScalarDiv(U &lhs, const U &rhs)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        lhs.data[i] /= rhs.data[i];
+    }
+    return lhs;
+}
+
+///
+/// @brief Element-wise operations of the data of U with a scalar.
+///
+template<typename U, typename T>
+constexpr U &ScalarAdd(U &lhs, const T scalar)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        lhs.data[i] += scalar;
+    }
+    return lhs;
+}
+
+template<typename U, typename T>
+constexpr U &ScalarSub(U &lhs, const T scalar)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        lhs.data[i] -= scalar;
+    }
+    return lhs;
+}
+
+template<typename U, typename T>
+constexpr U &ScalarMul(U &lhs, const T scalar)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        lhs.data[i] *= scalar;
+    }
+    return lhs;
+}
+
+template<typename U, typename T>
+constexpr U &ScalarDiv(U &lhs, const T scalar)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        lhs.data[i] /= scalar;
+    }
+    return lhs;
+}
+
+///
+/// @brief Element-wise operations of a scalar with the data of U, where the
+/// scalar is the left operand.
+///
+template<typename U, typename T>
+constexpr U ScalarRsub(const T scalar, U rhs)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        rhs.data[i] = scalar - rhs.data[i];
+    }
+    return rhs;
+}
+
+template<typename U, typename T>
+constexpr U ScalarRdiv(const T scalar, U rhs)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        rhs.data[i] = scalar / rhs.data[i];
+    }
+    return rhs;
+}
+
+///
+/// @brief Element-wise shift of the data of U by count bits.
+///
+template<typename U>
+constexpr U &ScalarShl(U &lhs, const int count)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        lhs.data[i] <<= count;
+    }
+    return lhs;
+}
+
+template<typename U>
+constexpr U &ScalarShr(U &lhs, const int count)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        lhs.data[i] >>= count;
+    }
+    return lhs;
+}
+
+} // namespace Detail
+} // inline namespace MATH_SIMD_ISA
+} // namespace Math
+
+#endif // MATH_CONSTEXPR_H_
@@ -0,0 +1,526 @@
+//
+// dispatch.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <stdexcept>
+#include "minicore/base/cpu.h"
+#include "dispatch.h"
+#include "simd/kernels.h"
+#include "simd/kernels-batch.h"
+
+namespace Math {
+
+/// ---- Scalar kernels -------------------------------------------------------
+///
+/// @brief Transform an array of vectors by the matrix, dst[i] = m * src[i].
+///
+template<typename T>
+static void TransformVec4Scalar(
+    const Mat4<T> &m,
+    const Vec4<T> *src,
+    Vec4<T> *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const T x = src[i].x;
+        const T y = src[i].y;
+        const T z = src[i].z;
+        const T w = src[i].w;
+        for (size_t r = 0; r < 4; ++r) {
+            const T *row = &m.data[4*r];
+            dst[i].data[r] = row[0]*x + row[1]*y + row[2]*z + row[3]*w;
+        }
+    }
+}
+
+///
+/// @brief Transform an array of matrices by the matrix, dst[i] = m * src[i].
+///
+template<typename T>
+static void TransformMat4Scalar(
+    const Mat4<T> &m,
+    const Mat4<T> *src,
+    Mat4<T> *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        T b[16];
+        for (size_t j = 0; j < 16; ++j) {
+            b[j] = src[i].data[j];
+        }
+
+        for (size_t r = 0; r < 4; ++r) {
+            const T *row = &m.data[4*r];
+            for (size_t c = 0; c < 4; ++c) {
+                dst[i].data[4*r + c] = row[0] * b[c]
+                                     + row[1] * b[4 + c]
+                                     + row[2] * b[8 + c]
+                                     + row[3] * b[12 + c];
+            }
+        }
+    }
+}
+
+///
+/// @brief Transform an array of points by the matrix, dst[i] = m * {src[i], 1}.
+///
+template<typename T>
+static void TransformVec3Scalar(
+    const Mat4<T> &m,
+    const Vec3<T> *src,
+    Vec3<T> *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const T x = src[i].x;
+        const T y = src[i].y;
+        const T z = src[i].z;
+        for (size_t r = 0; r < 3; ++r) {
+            const T *row = &m.data[4*r];
+            dst[i].data[r] = row[0]*x + row[1]*y + row[2]*z + row[3];
+        }
+    }
+}
+
+///
+/// @brief Multiply two arrays of matrices, dst[i] = a[i] * b[i].
+///
+template<typename T>
+static void DotMat4Scalar(
+    const Mat4<T> *a,
+    const Mat4<T> *b,
+    Mat4<T> *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        T x[16], y[16];
+        for (size_t j = 0; j < 16; ++j) {
+            x[j] = a[i].data[j];
+            y[j] = b[i].data[j];
+        }
+
+        for (size_t r = 0; r < 4; ++r) {
+            const T *row = &x[4*r];
+            for (size_t c = 0; c < 4; ++c) {
+                dst[i].data[4*r + c] = row[0] * y[c]
+                                     + row[1] * y[4 + c]
+                                     + row[2] * y[8 + c]
+                                     + row[3] * y[12 + c];
+            }
+        }
+    }
+}
+
+///
+/// @brief Compute the 2x2 minors of the upper two rows and of the lower two
+/// rows of the matrix. The determinant and the adjugate of the matrix are
+/// given by the Laplace expansion of the matrix in terms of these minors.
+///
+template<typename T>
+static void Mat4Minors(const T *a, T s[6], T c[6])
+{
+    s[0] = a[0] * a[5] - a[4] * a[1];
+    s[1] = a[0] * a[6] - a[4] * a[2];
+    s[2] = a[0] * a[7] - a[4] * a[3];
+    s[3] = a[1] * a[6] - a[5] * a[2];
+    s[4] = a[1] * a[7] - a[5] * a[3];
+    s[5] = a[2] * a[7] - a[6] * a[3];
+
+    c[0] = a[8]  * a[13] - a[12] * a[9];
+    c[1] = a[8]  * a[14] - a[12] * a[10];
+    c[2] = a[8]  * a[15] - a[12] * a[11];
+    c[3] = a[9]  * a[14] - a[13] * a[10];
+    c[4] = a[9]  * a[15] - a[13] * a[11];
+    c[5] = a[10] * a[15] - a[14] * a[11];
+}
+
+///
+/// @brief Compute the determinant of each matrix in the array.
+///
+template<typename T>
+static void DeterminantMat4Scalar(
+    const Mat4<T> *src,
+    T *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        T s[6], c[6];
+        Mat4Minors(src[i].data, s, c);
+        dst[i] = s[0] * c[5] - s[1] * c[4] + s[2] * c[3]
+               + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+    }
+}
+
+///
+/// @brief Compute the inverse of each matrix in the array from its adjugate
+/// and determinant. Set the inverse to zero if the matrix is singular.
+///
+template<typename T>
+static void InverseMat4Scalar(
+    const Mat4<T> *src,
+    Mat4<T> *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        T a[16];
+        for (size_t j = 0; j < 16; ++j) {
+            a[j] = src[i].data[j];
+        }
+
+        T s[6], c[6];
+        Mat4Minors(a, s, c);
+        T det = s[0] * c[5] - s[1] * c[4] + s[2] * c[3]
+              + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+        T inv_det = (det != (T) 0) ? (T) 1 / det : (T) 0;
+
+        T *b = dst[i].data;
+        b[0]  = ( a[5]  * c[5] - a[6]  * c[4] + a[7]  * c[3]) * inv_det;
+        b[1]  = (-a[1]  * c[5] + a[2]  * c[4] - a[3]  * c[3]) * inv_det;
+        b[2]  = ( a[13] * s[5] - a[14] * s[4] + a[15] * s[3]) * inv_det;
+        b[3]  = (-a[9]  * s[5] + a[10] * s[4] - a[11] * s[3]) * inv_det;
+
+        b[4]  = (-a[4]  * c[5] + a[6]  * c[2] - a[7]  * c[1]) * inv_det;
+        b[5]  = ( a[0]  * c[5] - a[2]  * c[2] + a[3]  * c[1]) * inv_det;
+        b[6]  = (-a[12] * s[5] + a[14] * s[2] - a[15] * s[1]) * inv_det;
+        b[7]  = ( a[8]  * s[5] - a[10] * s[2] + a[11] * s[1]) * inv_det;
+
+        b[8]  = ( a[4]  * c[4] - a[5]  * c[2] + a[7]  * c[0]) * inv_det;
+        b[9]  = (-a[0]  * c[4] + a[1]  * c[2] - a[3]  * c[0]) * inv_det;
+        b[10] = ( a[12] * s[4] - a[13] * s[2] + a[15] * s[0]) * inv_det;
+        b[11] = (-a[8]  * s[4] + a[9]  * s[2] - a[11] * s[0]) * inv_det;
+
+        b[12] = (-a[4]  * c[3] + a[5]  * c[1] - a[6]  * c[0]) * inv_det;
+        b[13] = ( a[0]  * c[3] - a[1]  * c[1] + a[2]  * c[0]) * inv_det;
+        b[14] = (-a[12] * s[3] + a[13] * s[1] - a[14] * s[0]) * inv_det;
+        b[15] = ( a[8]  * s[3] - a[9]  * s[1] + a[10] * s[0]) * inv_det;
+    }
+}
+
+///
+/// @brief Convert an array of floats to half or bfloat16, and back.
+///
+static void ConvertToHalfScalar(
+    const float *src,
+    Half *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i].bits = FloatToHalfBits(src[i]);
+    }
+}
+
+static void ConvertFromHalfScalar(
+    const Half *src,
+    float *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = HalfBitsToFloat(src[i].bits);
+    }
+}
+
+static void ConvertToBFloat16Scalar(
+    const float *src,
+    BFloat16 *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i].bits = FloatToBFloat16Bits(src[i]);
+    }
+}
+
+static void ConvertFromBFloat16Scalar(
+    const BFloat16 *src,
+    float *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = BFloat16BitsToFloat(src[i].bits);
+    }
+}
+
+///
+/// @brief Compute the cell hash key of each point in the array.
+///
+static void CellKeysScalar(
+    const CellGrid &grid,
+    const Vec3<float> *points,
+    uint32_t *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = CellKey(grid, points[i]);
+    }
+}
+
+///
+/// @brief Fill an array with the random numbers of the lanes, advancing the
+/// engine of each lane over its elements of the array.
+///
+template<typename T, T (*Random)(RandomEngine &)>
+static void RandomFillScalar(
+    RandomLanes &lanes,
+    T *dst,
+    const size_t count)
+{
+    const size_t steps = (count + kRandomLanes - 1) / kRandomLanes;
+    for (size_t lane = 0; lane < kRandomLanes; ++lane) {
+        RandomEngine eng = GetRandomLane(lanes, lane);
+        for (size_t k = 0; k < steps; ++k) {
+            T r = Random(eng);
+            size_t i = k * kRandomLanes + lane;
+            if (i < count) {
+                dst[i] = r;
+            }
+        }
+        SetRandomLane(lanes, lane, eng);
+    }
+}
+
+///
+/// @brief Fill an array with the blocks of random bits of the stream.
+///
+static void RandomStreamScalar(
+    const RandomStream &stream,
+    const uint64_t block,
+    uint32_t *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        RandomBlock(stream, block + i, &dst[4*i]);
+    }
+}
+
+///
+/// @brief Multiply the packed panels of a and b and accumulate the product
+/// into the tile of c, keeping the tile in a local accumulator.
+///
+template<typename T, size_t Cols>
+static void GemmScalar(
+    const size_t depth,
+    const T *a,
+    const T *b,
+    T *c,
+    const size_t ldc)
+{
+    T acc[kGemmRows][Cols] = {};
+    for (size_t p = 0; p < depth; ++p) {
+        for (size_t i = 0; i < kGemmRows; ++i) {
+            const T ai = a[p * kGemmRows + i];
+            for (size_t j = 0; j < Cols; ++j) {
+                acc[i][j] += ai * b[p * Cols + j];
+            }
+        }
+    }
+
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        for (size_t j = 0; j < Cols; ++j) {
+            c[i * ldc + j] += acc[i][j];
+        }
+    }
+}
+
+static const Kernels kKernelsScalar = {
+    kIsaScalar,
+    TransformVec4Scalar<float>,
+    TransformVec4Scalar<double>,
+    TransformMat4Scalar<float>,
+    TransformMat4Scalar<double>,
+    TransformVec3Scalar<double>,
+    DotMat4Scalar<double>,
+    DeterminantMat4Scalar<double>,
+    InverseMat4Scalar<double>,
+    ConvertToHalfScalar,
+    ConvertFromHalfScalar,
+    ConvertToBFloat16Scalar,
+    ConvertFromBFloat16Scalar,
+    CellKeysScalar,
+    RandomFillScalar<uint32_t, Random32>,
+    RandomFillScalar<uint64_t, Random64>,
+    RandomStreamScalar,
+    GemmScalar<float, kGemmColsf>,
+    GemmScalar<double, kGemmColsd>,
+    CreateBatchKernels<float>(),
+    CreateBatchKernels<double>(),
+};
+
+/// ---- Kernel dispatch ------------------------------------------------------
+///
+/// @brief Return the kernels of the specified instruction set level if both
+/// the build and the cpu support it, or null otherwise.
+///
+static const Kernels *FindKernels(const uint32_t isa)
+{
+    const Base::CpuFeatures &cpu = Base::GetCpuFeatures();
+    switch (isa) {
+    case kIsaScalar:
+        return &kKernelsScalar;
+    case kIsaSse2:
+        return cpu.sse2 ? GetKernelsSse2() : nullptr;
+    case kIsaAvx:
+        return cpu.avx ? GetKernelsAvx() : nullptr;
+    case kIsaAvx2:
+        return (cpu.avx2 && cpu.fma && cpu.f16c) ? GetKernelsAvx2() : nullptr;
+    case kIsaAvx512:
+        return (cpu.avx512f && cpu.avx512dq && cpu.avx512vl && cpu.fma)
+            ? GetKernelsAvx512() : nullptr;
+    default:
+        return nullptr;
+    }
+}
+
+///
+/// @brief Fill the kernels not provided by an instruction set level with the
+/// kernels of the level below.
+///
+template<typename Func>
+static void InheritKernel(Func &kernel, const Func base)
+{
+    if (kernel == nullptr) {
+        kernel = base;
+    }
+}
+
+template<typename T>
+static void InheritBatchKernels(
+    BatchKernels<T> &kernels,
+    const BatchKernels<T> &base)
+{
+    InheritKernel(kernels.transformVec3, base.transformVec3);
+    InheritKernel(kernels.transformPackedVec3, base.transformPackedVec3);
+    InheritKernel(kernels.rotateVec3, base.rotateVec3);
+    InheritKernel(kernels.rotatePackedVec3, base.rotatePackedVec3);
+    InheritKernel(kernels.normalizeVec3, base.normalizeVec3);
+    InheritKernel(kernels.normalizePackedVec3, base.normalizePackedVec3);
+    InheritKernel(kernels.dotVec3, base.dotVec3);
+    InheritKernel(kernels.crossVec3, base.crossVec3);
+    InheritKernel(kernels.distanceVec3, base.distanceVec3);
+    InheritKernel(kernels.aabbVec3, base.aabbVec3);
+    InheritKernel(kernels.aabbPackedVec3, base.aabbPackedVec3);
+    InheritKernel(kernels.rsqrt, base.rsqrt);
+    InheritKernel(kernels.exp, base.exp);
+    InheritKernel(kernels.log, base.log);
+    InheritKernel(kernels.sinCos, base.sinCos);
+    InheritKernel(kernels.atan2, base.atan2);
+    InheritKernel(kernels.determinantMat3, base.determinantMat3);
+    InheritKernel(kernels.determinantMat4, base.determinantMat4);
+    InheritKernel(kernels.determinantMat3Array, base.determinantMat3Array);
+    InheritKernel(kernels.determinantMat4Array, base.determinantMat4Array);
+    InheritKernel(kernels.inverseMat3, base.inverseMat3);
+    InheritKernel(kernels.inverseMat4, base.inverseMat4);
+    InheritKernel(kernels.inverseMat3Array, base.inverseMat3Array);
+    InheritKernel(kernels.inverseMat4Array, base.inverseMat4Array);
+}
+
+static void InheritKernels(Kernels &kernels, const Kernels &base)
+{
+    InheritKernel(kernels.transformVec4f, base.transformVec4f);
+    InheritKernel(kernels.transformVec4d, base.transformVec4d);
+    InheritKernel(kernels.transformMat4f, base.transformMat4f);
+    InheritKernel(kernels.transformMat4d, base.transformMat4d);
+    InheritKernel(kernels.transformVec3d, base.transformVec3d);
+    InheritKernel(kernels.dotMat4d, base.dotMat4d);
+    InheritKernel(kernels.determinantMat4d, base.determinantMat4d);
+    InheritKernel(kernels.inverseMat4d, base.inverseMat4d);
+    InheritKernel(kernels.convertToHalf, base.convertToHalf);
+    InheritKernel(kernels.convertFromHalf, base.convertFromHalf);
+    InheritKernel(kernels.convertToBFloat16, base.convertToBFloat16);
+    InheritKernel(kernels.convertFromBFloat16, base.convertFromBFloat16);
+    InheritKernel(kernels.cellKeys, base.cellKeys);
+    InheritKernel(kernels.randomFill32, base.randomFill32);
+    InheritKernel(kernels.randomFill64, base.randomFill64);
+    InheritKernel(kernels.randomStream, base.randomStream);
+    InheritKernel(kernels.gemmf, base.gemmf);
+    InheritKernel(kernels.gemmd, base.gemmd);
+    InheritBatchKernels(kernels.batchf, base.batchf);
+    InheritBatchKernels(kernels.batchd, base.batchd);
+}
+
+///
+/// @brief Return the complete kernels of the specified instruction set level,
+/// or null if the build or the cpu does not support it. The kernel tables are
+/// resolved once, on the first call.
+///
+static const Kernels *ResolveKernels(const uint32_t isa)
+{
+    struct Table {
+        Kernels kernels[kNumIsa];
+        bool supported[kNumIsa];
+    };
+
+    static const Table table = []() {
+        Table t{};
+        const Kernels *base = nullptr;
+        for (uint32_t i = kIsaScalar; i < kNumIsa; ++i) {
+            const Kernels *kernels = FindKernels(i);
+            if (kernels == nullptr) {
+                continue;
+            }
+            t.kernels[i] = *kernels;
+            t.supported[i] = true;
+            if (base != nullptr) {
+                InheritKernels(t.kernels[i], *base);
+            }
+            base = &t.kernels[i];
+        }
+        return t;
+    }();
+
+    return (isa < kNumIsa && table.supported[isa]) ? &table.kernels[isa]
+                                                   : nullptr;
+}
+
+///
+/// @brief Return the name of the instruction set level.
+///
+const char *GetIsaName(const uint32_t isa)
+{
+    static const char *names[kNumIsa] = {
+        "scalar", "sse2", "avx", "avx2", "avx512"};
+    return isa < kNumIsa ? names[isa] : "unknown";
+}
+
+///
+/// @brief Return the highest instruction set level supported by the cpu. The
+/// cpu features are queried once, on the first call.
+///
+uint32_t GetMaxIsa()
+{
+    static const uint32_t max_isa = []() {
+        uint32_t isa = kNumIsa - 1;
+        while (isa > kIsaScalar && FindKernels(isa) == nullptr) {
+            --isa;
+        }
+        return isa;
+    }();
+    return max_isa;
+}
+
+///
+/// @brief Return the kernels of the highest supported instruction set level.
+///
+const Kernels &GetKernels()
+{
+    static const Kernels &kernels = *ResolveKernels(GetMaxIsa());
+    return kernels;
+}
+
+///
+/// @brief Return the kernels of the specified instruction set level. Throw an
+/// exception if the cpu does not support the instruction set.
+///
+const Kernels &GetKernels(const uint32_t isa)
+{
+    const Kernels *kernels = ResolveKernels(isa);
+    if (kernels == nullptr) {
+        throw std::runtime_error("unsupported instruction set");
+    }
+    return *kernels;
+}
+
+} // namespace Math
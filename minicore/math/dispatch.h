@@ -0,0 +1,343 @@
+//
+// dispatch.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_DISPATCH_H_
+#define MATH_DISPATCH_H_
+
+#include <cstdint>
+#include <cstddef>
+#include "cell.h"
+#include "fastmath.h"
+#include "half.h"
+#include "matrix.h"
+#include "packed.h"
+#include "random.h"
+#include "vector.h"
+
+namespace Math {
+
+///
+/// @brief Instruction set levels of the dispatched kernels, in increasing
+/// order. Each level is compiled in its own translation unit and selected at
+/// runtime if the cpu supports it:
+///
+///  kIsaScalar     portable scalar loops, used on non-x86 cpus.
+///  kIsaSse2       128-bit SSE2, the x86-64 baseline.
+///  kIsaAvx        256-bit AVX.
+///  kIsaAvx2       256-bit AVX2 with fused multiply-add (FMA3) and 16-bit
+///                 float conversions (F16C).
+///  kIsaAvx512     512-bit AVX-512 F/DQ/VL with fused multiply-add.
+///
+enum Isa : uint32_t {
+    kIsaScalar = 0,
+    kIsaSse2,
+    kIsaAvx,
+    kIsaAvx2,
+    kIsaAvx512,
+    kNumIsa
+};
+
+///
+/// @brief Kernels maintains the function pointers of the array kernels of a
+/// given instruction set level. All kernels accept the output array to be the
+/// same as an input array:
+///
+///  transformVec3      dst[i] = Dot(m, {src[i], 1}) for each point, the
+///                     homogeneous coordinate of the result is discarded.
+///  transformVec4      dst[i] = Dot(m, src[i]) for each vector in the array.
+///  transformMat4      dst[i] = Dot(m, src[i]) for each matrix in the array.
+///  dotMat4            dst[i] = Dot(a[i], b[i]) for each pair of matrices.
+///  determinantMat4    dst[i] = Determinant(src[i]) for each matrix.
+///  inverseMat4        dst[i] = Inverse(src[i]) for each matrix, or the zero
+///                     matrix if the matrix is singular.
+///  convertToHalf      dst[i] = Half(src[i]) for each float, and similarly
+///  convertFromHalf    for the conversions to and from BFloat16. The output
+///  convertToBFloat16  array may not overlap the input array.
+///  convertFromBFloat16
+///  cellKeys           dst[i] = CellKey(grid, points[i]) for each point.
+///  randomFill32       dst[i] = Random32 or Random64 of lane i % kRandomLanes
+///  randomFill64       for each number, advancing all lanes at once. The
+///                     numbers of a partial last step are discarded.
+///  randomStream       dst[4*i..4*i+3] = RandomBlock(stream, block + i) for
+///                     each block of the random stream.
+///  gemmf              c[i*ldc + j] += Sum_p a[p*kGemmRows + i] * b[p*cols + j]
+///  gemmd              for each element of a kGemmRows x cols tile of c, with
+///                     cols kGemmColsf or kGemmColsd. The panels a and b are
+///                     packed column by column and row by row, respectively,
+///                     and depth elements deep.
+///  batchf             the kernels of the Batch functions over arrays of float
+///  batchd             and double elements, see BatchKernels.
+///
+/// A level that does not provide a kernel inherits it from the level below.
+///
+static const size_t kGemmRows = 6;
+static const size_t kGemmColsf = 16;
+static const size_t kGemmColsd = 8;
+
+///
+/// @brief BatchKernels maintains the function pointers of the kernels of the
+/// Batch functions over arrays of elements of type T. Each kernel processes
+/// the arrays of one block in packets, and the Batch functions split the
+/// arrays in blocks:
+///
+///  transformVec3          dst[i] = Dot(m, {src[i], 1}) for each point.
+///  transformPackedVec3
+///  rotateVec3             dst[i] = Dot(m, src[i]) for each vector, with the
+///  rotatePackedVec3       rotation matrix of the quaternion.
+///  normalizeVec3          dst[i] = Normalize(src[i]) with the inverse square
+///  normalizePackedVec3    root of the accuracy tier.
+///  dotVec3                dst[i] = Dot(a[i], b[i]).
+///  crossVec3              dst[i] = Cross(a[i], b[i]).
+///  distanceVec3           dst[i] = Distance(a[i], b[i]).
+///  aabbVec3               lo and hi corners of the bounding box of the
+///  aabbPackedVec3         points, or {+inf, -inf} if the array is empty.
+///  rsqrt, exp, log        dst[i] = f(src[i]) with the fast math function of
+///  sinCos, atan2          the accuracy tier, or sin[i] and cos[i].
+///  determinantMat3        dst[i] = Determinant(src[i]) for each matrix, or
+///  determinantMat4        for each matrix of an array in structure of arrays
+///  determinantMat3Array   layout, element k of matrix i at src[k*stride + i].
+///  determinantMat4Array
+///  inverseMat3            dst[i] = Inverse(src[i]) for each matrix, or the
+///  inverseMat4            zero matrix with singular[i] = 1 if the matrix is
+///  inverseMat3Array       singular. The singular flags may be null.
+///  inverseMat4Array
+///
+template<typename T>
+struct BatchKernels {
+    void (*transformVec3)(
+        const Mat4<T> &m,
+        const Vec3<T> *src,
+        Vec3<T> *dst,
+        const size_t count);
+    void (*transformPackedVec3)(
+        const Mat4<T> &m,
+        const PackedVec3<T> *src,
+        PackedVec3<T> *dst,
+        const size_t count);
+    void (*rotateVec3)(
+        const Mat3<T> &m,
+        const Vec3<T> *src,
+        Vec3<T> *dst,
+        const size_t count);
+    void (*rotatePackedVec3)(
+        const Mat3<T> &m,
+        const PackedVec3<T> *src,
+        PackedVec3<T> *dst,
+        const size_t count);
+    void (*normalizeVec3)(
+        const Vec3<T> *src,
+        Vec3<T> *dst,
+        const size_t count,
+        const Accuracy accuracy);
+    void (*normalizePackedVec3)(
+        const PackedVec3<T> *src,
+        PackedVec3<T> *dst,
+        const size_t count,
+        const Accuracy accuracy);
+    void (*dotVec3)(
+        const Vec3<T> *a,
+        const Vec3<T> *b,
+        T *dst,
+        const size_t count);
+    void (*crossVec3)(
+        const Vec3<T> *a,
+        const Vec3<T> *b,
+        Vec3<T> *dst,
+        const size_t count);
+    void (*distanceVec3)(
+        const Vec3<T> *a,
+        const Vec3<T> *b,
+        T *dst,
+        const size_t count);
+    void (*aabbVec3)(
+        const Vec3<T> *points,
+        const size_t count,
+        Vec3<T> &lo,
+        Vec3<T> &hi);
+    void (*aabbPackedVec3)(
+        const PackedVec3<T> *points,
+        const size_t count,
+        Vec3<T> &lo,
+        Vec3<T> &hi);
+    void (*rsqrt)(
+        const T *src,
+        T *dst,
+        const size_t count,
+        const Accuracy accuracy);
+    void (*exp)(
+        const T *src,
+        T *dst,
+        const size_t count,
+        const Accuracy accuracy);
+    void (*log)(
+        const T *src,
+        T *dst,
+        const size_t count,
+        const Accuracy accuracy);
+    void (*sinCos)(
+        const T *src,
+        T *sin,
+        T *cos,
+        const size_t count,
+        const Accuracy accuracy);
+    void (*atan2)(
+        const T *y,
+        const T *x,
+        T *dst,
+        const size_t count,
+        const Accuracy accuracy);
+    void (*determinantMat3)(
+        const Mat3<T> *src,
+        T *dst,
+        const size_t count);
+    void (*determinantMat4)(
+        const Mat4<T> *src,
+        T *dst,
+        const size_t count);
+    void (*determinantMat3Array)(
+        const T *src,
+        const size_t stride,
+        T *dst,
+        const size_t count);
+    void (*determinantMat4Array)(
+        const T *src,
+        const size_t stride,
+        T *dst,
+        const size_t count);
+    void (*inverseMat3)(
+        const Mat3<T> *src,
+        Mat3<T> *dst,
+        uint8_t *singular,
+        const size_t count);
+    void (*inverseMat4)(
+        const Mat4<T> *src,
+        Mat4<T> *dst,
+        uint8_t *singular,
+        const size_t count);
+    void (*inverseMat3Array)(
+        const T *src,
+        const size_t src_stride,
+        T *dst,
+        const size_t dst_stride,
+        uint8_t *singular,
+        const size_t count);
+    void (*inverseMat4Array)(
+        const T *src,
+        const size_t src_stride,
+        T *dst,
+        const size_t dst_stride,
+        uint8_t *singular,
+        const size_t count);
+};
+
+struct Kernels {
+    uint32_t isa;
+    void (*transformVec4f)(
+        const Mat4<float> &m,
+        const Vec4<float> *src,
+        Vec4<float> *dst,
+        const size_t count);
+    void (*transformVec4d)(
+        const Mat4<double> &m,
+        const Vec4<double> *src,
+        Vec4<double> *dst,
+        const size_t count);
+    void (*transformMat4f)(
+        const Mat4<float> &m,
+        const Mat4<float> *src,
+        Mat4<float> *dst,
+        const size_t count);
+    void (*transformMat4d)(
+        const Mat4<double> &m,
+        const Mat4<double> *src,
+        Mat4<double> *dst,
+        const size_t count);
+    void (*transformVec3d)(
+        const Mat4<double> &m,
+        const Vec3<double> *src,
+        Vec3<double> *dst,
+        const size_t count);
+    void (*dotMat4d)(
+        const Mat4<double> *a,
+        const Mat4<double> *b,
+        Mat4<double> *dst,
+        const size_t count);
+    void (*determinantMat4d)(
+        const Mat4<double> *src,
+        double *dst,
+        const size_t count);
+    void (*inverseMat4d)(
+        const Mat4<double> *src,
+        Mat4<double> *dst,
+        const size_t count);
+    void (*convertToHalf)(
+        const float *src,
+        Half *dst,
+        const size_t count);
+    void (*convertFromHalf)(
+        const Half *src,
+        float *dst,
+        const size_t count);
+    void (*convertToBFloat16)(
+        const float *src,
+        BFloat16 *dst,
+        const size_t count);
+    void (*convertFromBFloat16)(
+        const BFloat16 *src,
+        float *dst,
+        const size_t count);
+    void (*cellKeys)(
+        const CellGrid &grid,
+        const Vec3<float> *points,
+        uint32_t *dst,
+        const size_t count);
+    void (*randomFill32)(
+        RandomLanes &lanes,
+        uint32_t *dst,
+        const size_t count);
+    void (*randomFill64)(
+        RandomLanes &lanes,
+        uint64_t *dst,
+        const size_t count);
+    void (*randomStream)(
+        const RandomStream &stream,
+        const uint64_t block,
+        uint32_t *dst,
+        const size_t count);
+    void (*gemmf)(
+        const size_t depth,
+        const float *a,
+        const float *b,
+        float *c,
+        const size_t ldc);
+    void (*gemmd)(
+        const size_t depth,
+        const double *a,
+        const double *b,
+        double *c,
+        const size_t ldc);
+    BatchKernels<float> batchf;
+    BatchKernels<double> batchd;
+};
+
+/// @brief Return the name of the instruction set level.
+const char *GetIsaName(const uint32_t isa);
+
+/// @brief Return the highest instruction set level supported by the cpu.
+uint32_t GetMaxIsa();
+
+/// @brief Return the kernels of the highest supported instruction set level.
+const Kernels &GetKernels();
+
+/// @brief Return the kernels of the specified instruction set level.
+const Kernels &GetKernels(const uint32_t isa);
+
+} // namespace Math
+
+#endif // MATH_DISPATCH_H_
@@ -0,0 +1,610 @@
+//
+// distribution.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "minicore/base/parallel.h"
+#include "batch.h"
+#include "dispatch.h"
+#include "distribution.h"
+
+namespace Math {
+
+/// ---- Sampler chunks -------------------------------------------------------
+///
+/// @brief The deviates are computed in chunks of items. Arrays smaller than
+/// the parallel threshold, or any array if the thread pool is not running,
+/// are sampled in the calling thread.
+///
+static const size_t kChunkSize = 1024;
+static const size_t kParallelMinCount = 65536;
+static const size_t kReaderBlocks = 64;
+
+///
+/// @brief Chunk k reads the blocks from k * 2^32, the chunk index in the high
+/// word of the block counter, so there are at most 2^32 chunks and the items
+/// are limited to [0, 2^42).
+///
+static const uint64_t kMaxItems = ((uint64_t) 1 << 32) * kChunkSize;
+
+///
+/// @brief Reader of the random numbers of a chunk, the words of the stream
+/// blocks from chunk * 2^32 in order. The first words are read in bulk by the
+/// fast path of the samplers, and the rest through a buffer by the rejected
+/// items.
+///
+namespace {
+struct ChunkReader {
+    const Kernels &kernels;
+    const RandomStream &stream;
+    uint64_t block;
+    size_t pos;
+    size_t size;
+    uint32_t words[4 * kReaderBlocks];
+
+    ChunkReader(
+        const Kernels &kernels,
+        const RandomStream &stream,
+        const uint64_t chunk)
+        : kernels(kernels)
+        , stream(stream)
+        , block(chunk << 32)
+        , pos(0)
+        , size(0) {}
+
+    /// @brief Read a multiple of 4 words, before any buffered read.
+    void Read(uint32_t *dst, const size_t count) {
+        kernels.randomStream(stream, block, dst, count / 4);
+        block += count / 4;
+    }
+
+    /// @brief Read an even number of 64-bit words, from pairs of words with
+    /// the low word first.
+    void Read(uint64_t *dst, const size_t count) {
+        uint32_t buffer[4 * kReaderBlocks];
+        for (size_t j = 0; j < count; j += 2 * kReaderBlocks) {
+            size_t n = std::min(2 * kReaderBlocks, count - j);
+            Read(buffer, 2 * n);
+            for (size_t k = 0; k < n; ++k) {
+                dst[j + k] = (uint64_t) buffer[2*k] |
+                    ((uint64_t) buffer[2*k + 1] << 32);
+            }
+        }
+    }
+
+    uint32_t Next32() {
+        if (pos == size) {
+            kernels.randomStream(stream, block, words, kReaderBlocks);
+            block += kReaderBlocks;
+            pos = 0;
+            size = 4 * kReaderBlocks;
+        }
+        return words[pos++];
+    }
+
+    uint64_t Next64() {
+        uint64_t lo = Next32();
+        uint64_t hi = Next32();
+        return lo | (hi << 32);
+    }
+
+    /// @brief Uniform number in [0, 1), exact to 53 bits.
+    double Uniform() {
+        return (double) (Next64() >> 11) * 1.1102230246251565E-16;
+    }
+};
+} // namespace
+
+///
+/// @brief Sample the chunks overlapping the items [first, first + count) of
+/// the stream. A chunk is always sampled from its first item, so that the
+/// rejected items draw the same numbers for any range. Chunks partially in
+/// the range are sampled through a buffer.
+///
+template<typename T, typename Fn>
+static void SampleChunks(
+    const RandomStream &stream,
+    const uint64_t first,
+    T *dst,
+    const size_t count,
+    const Fn &fn)
+{
+    if (count == 0) {
+        return;
+    }
+    if (first >= kMaxItems || count > kMaxItems - first) {
+        throw std::runtime_error("sampler items out of range");
+    }
+
+    struct ChunkData {
+        const RandomStream *stream;
+        const Fn *fn;
+        uint64_t first;
+        uint64_t last;
+        uint64_t chunk;
+        T *dst;
+    } data = {&stream, &fn, first, first + count, first / kChunkSize, dst};
+
+    auto run = [](size_t k, void *arg) {
+        ChunkData *data = static_cast<ChunkData *>(arg);
+        uint64_t chunk = data->chunk + k;
+        uint64_t begin = chunk * kChunkSize;
+        uint64_t end = begin + kChunkSize;
+        uint64_t lo = std::max(begin, data->first);
+        uint64_t hi = std::min(end, data->last);
+
+        ChunkReader reader(GetKernels(), *data->stream, chunk);
+        T *dst = data->dst + (lo - data->first);
+        if (lo == begin && hi == end) {
+            (*data->fn)(reader, dst);
+        } else {
+            T out[kChunkSize];
+            (*data->fn)(reader, out);
+            std::copy(&out[lo - begin], &out[hi - begin], dst);
+        }
+    };
+
+    size_t num_chunks = (data.last - 1) / kChunkSize - data.chunk + 1;
+    Base::ParallelForIf(run, num_chunks, &data, count >= kParallelMinCount);
+}
+
+/// ---- Ziggurat tables ------------------------------------------------------
+///
+/// @brief The Ziggurat covers the density f with N layers of equal area V.
+/// Layer i > 0 is the rectangle [0, x[i]] x [f(x[i]), f(x[i+1])], and layer 0
+/// is the base strip of width x[0] = V / f(R) covering the body up to x[1] = R
+/// and the tail beyond it. A point u * x[i] below x[i+1] is under the density,
+/// and only the others are tested against f.
+///
+namespace {
+template<size_t N>
+struct Ziggurat {
+    double x[N + 1];
+    double f[N + 1];
+    float xf[N + 1];
+};
+} // namespace
+
+template<size_t N, typename Density, typename Inverse>
+static void CreateZiggurat(
+    Ziggurat<N> &z,
+    const double r,
+    const double v,
+    const Density &f,
+    const Inverse &inv)
+{
+    z.x[0] = v / f(r);
+    z.x[1] = r;
+    for (size_t i = 2; i < N; ++i) {
+        z.x[i] = inv(v / z.x[i-1] + f(z.x[i-1]));
+    }
+    z.x[N] = 0.0;
+
+    for (size_t i = 0; i <= N; ++i) {
+        z.f[i] = f(z.x[i]);
+        z.xf[i] = (float) z.x[i];
+    }
+}
+
+///
+/// @brief Normal Ziggurat of 128 layers and exponential Ziggurat of 256
+/// layers, with the constants of Marsaglia and Tsang.
+///
+static const size_t kNormalLayers = 128;
+static const size_t kExponentialLayers = 256;
+static const double kNormalR = 3.442619855899;
+static const double kExponentialR = 7.69711747013104972;
+
+static const Ziggurat<kNormalLayers> &NormalZiggurat()
+{
+    static const Ziggurat<kNormalLayers> z = [] () {
+        Ziggurat<kNormalLayers> z;
+        CreateZiggurat(z, kNormalR, 9.91256303526217E-3,
+            [] (double x) { return std::exp(-0.5 * x * x); },
+            [] (double y) { return std::sqrt(-2.0 * std::log(y)); });
+        return z;
+    }();
+    return z;
+}
+
+static const Ziggurat<kExponentialLayers> &ExponentialZiggurat()
+{
+    static const Ziggurat<kExponentialLayers> z = [] () {
+        Ziggurat<kExponentialLayers> z;
+        CreateZiggurat(z, kExponentialR, 3.949659822581572E-3,
+            [] (double x) { return std::exp(-x); },
+            [] (double y) { return -std::log(y); });
+        return z;
+    }();
+    return z;
+}
+
+///
+/// @brief Resample an item rejected by the fast path of layer i with the
+/// signed uniform u. The tail of the normal density is sampled with
+/// Marsaglia's method, and the exponential tail is the exponential shifted
+/// by R.
+///
+static double NormalSlow(ChunkReader &reader, size_t i, double u)
+{
+    const Ziggurat<kNormalLayers> &z = NormalZiggurat();
+    for (;;) {
+        if (i == 0) {
+            double x, y;
+            do {
+                x = -std::log(1.0 - reader.Uniform()) / kNormalR;
+                y = -std::log(1.0 - reader.Uniform());
+            } while (y + y < x * x);
+            return (u < 0.0) ? -(kNormalR + x) : kNormalR + x;
+        }
+
+        double x = u * z.x[i];
+        double y = z.f[i] + reader.Uniform() * (z.f[i+1] - z.f[i]);
+        if (y < std::exp(-0.5 * x * x)) {
+            return x;
+        }
+
+        uint64_t w = reader.Next64();
+        i = w & (kNormalLayers - 1);
+        u = (double) ((int64_t) w >> 11) * 2.220446049250313E-16;
+        if (std::fabs(u * z.x[i]) < z.x[i+1]) {
+            return u * z.x[i];
+        }
+    }
+}
+
+static double ExponentialSlow(ChunkReader &reader, size_t i, double u)
+{
+    const Ziggurat<kExponentialLayers> &z = ExponentialZiggurat();
+    for (;;) {
+        if (i == 0) {
+            return kExponentialR - std::log(1.0 - reader.Uniform());
+        }
+
+        double x = u * z.x[i];
+        double y = z.f[i] + reader.Uniform() * (z.f[i+1] - z.f[i]);
+        if (y < std::exp(-x)) {
+            return x;
+        }
+
+        uint64_t w = reader.Next64();
+        i = w & (kExponentialLayers - 1);
+        u = (double) (w >> 11) * 1.1102230246251565E-16;
+        if (u * z.x[i] < z.x[i+1]) {
+            return u * z.x[i];
+        }
+    }
+}
+
+/// ---- Normal and exponential samplers --------------------------------------
+///
+/// @brief Each item takes one random number: the low bits select the layer
+/// and the high bits the uniform position in it. The first loop evaluates
+/// the fast path of every item, and the second resamples the items outside
+/// the inner rectangle of their layer.
+///
+void RandomNormal(
+    const RandomStream &stream,
+    const uint64_t first,
+    float *dst,
+    const size_t count,
+    const float mu,
+    const float sig)
+{
+    auto fn = [mu, sig] (ChunkReader &reader, float *out) {
+        const Ziggurat<kNormalLayers> &z = NormalZiggurat();
+        uint32_t words[kChunkSize];
+        reader.Read(words, kChunkSize);
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            size_t i = words[j] & (kNormalLayers - 1);
+            float u = (float) ((int32_t) words[j] >> 8) * 1.1920929E-7f;
+            out[j] = u * z.xf[i];
+        }
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            size_t i = words[j] & (kNormalLayers - 1);
+            if (std::fabs(out[j]) >= z.xf[i+1]) {
+                double u = (double) ((int32_t) words[j] >> 8) * 1.1920929E-7;
+                out[j] = (float) NormalSlow(reader, i, u);
+            }
+            out[j] = mu + sig * out[j];
+        }
+    };
+    SampleChunks(stream, first, dst, count, fn);
+}
+
+void RandomNormal(
+    const RandomStream &stream,
+    const uint64_t first,
+    double *dst,
+    const size_t count,
+    const double mu,
+    const double sig)
+{
+    auto fn = [mu, sig] (ChunkReader &reader, double *out) {
+        const Ziggurat<kNormalLayers> &z = NormalZiggurat();
+        uint64_t words[kChunkSize];
+        reader.Read(words, kChunkSize);
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            size_t i = words[j] & (kNormalLayers - 1);
+            double u = (double) ((int64_t) words[j] >> 11) *
+                2.220446049250313E-16;
+            out[j] = u * z.x[i];
+        }
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            size_t i = words[j] & (kNormalLayers - 1);
+            if (std::fabs(out[j]) >= z.x[i+1]) {
+                double u = (double) ((int64_t) words[j] >> 11) *
+                    2.220446049250313E-16;
+                out[j] = NormalSlow(reader, i, u);
+            }
+            out[j] = mu + sig * out[j];
+        }
+    };
+    SampleChunks(stream, first, dst, count, fn);
+}
+
+void RandomExponential(
+    const RandomStream &stream,
+    const uint64_t first,
+    float *dst,
+    const size_t count,
+    const float rate)
+{
+    auto fn = [rate] (ChunkReader &reader, float *out) {
+        const Ziggurat<kExponentialLayers> &z = ExponentialZiggurat();
+        const float scale = 1.0f / rate;
+        uint32_t words[kChunkSize];
+        reader.Read(words, kChunkSize);
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            size_t i = words[j] & (kExponentialLayers - 1);
+            float u = (float) (words[j] >> 8) * 5.9604644775390625E-8f;
+            out[j] = u * z.xf[i];
+        }
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            size_t i = words[j] & (kExponentialLayers - 1);
+            if (out[j] >= z.xf[i+1]) {
+                double u = (double) (words[j] >> 8) * 5.9604644775390625E-8;
+                out[j] = (float) ExponentialSlow(reader, i, u);
+            }
+            out[j] *= scale;
+        }
+    };
+    SampleChunks(stream, first, dst, count, fn);
+}
+
+void RandomExponential(
+    const RandomStream &stream,
+    const uint64_t first,
+    double *dst,
+    const size_t count,
+    const double rate)
+{
+    auto fn = [rate] (ChunkReader &reader, double *out) {
+        const Ziggurat<kExponentialLayers> &z = ExponentialZiggurat();
+        const double scale = 1.0 / rate;
+        uint64_t words[kChunkSize];
+        reader.Read(words, kChunkSize);
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            size_t i = words[j] & (kExponentialLayers - 1);
+            double u = (double) (words[j] >> 11) * 1.1102230246251565E-16;
+            out[j] = u * z.x[i];
+        }
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            size_t i = words[j] & (kExponentialLayers - 1);
+            if (out[j] >= z.x[i+1]) {
+                double u = (double) (words[j] >> 11) *
+                    1.1102230246251565E-16;
+                out[j] = ExponentialSlow(reader, i, u);
+            }
+            out[j] *= scale;
+        }
+    };
+    SampleChunks(stream, first, dst, count, fn);
+}
+
+/// ---- Bounded integer samplers ---------------------------------------------
+///
+/// @brief The first loop computes the high word of the product of each random
+/// number with the range, and the second redraws the items whose low word is
+/// below the range, the only ones that may be biased.
+///
+void RandomBounded(
+    const RandomStream &stream,
+    const uint64_t first,
+    uint32_t *dst,
+    const size_t count,
+    const uint32_t range)
+{
+    if (range == 0) {
+        RandomFill(stream, first, dst, count);
+        return;
+    }
+
+    auto fn = [range] (ChunkReader &reader, uint32_t *out) {
+        auto next = [&reader] () { return reader.Next32(); };
+        uint32_t words[kChunkSize];
+        reader.Read(words, kChunkSize);
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            out[j] = (uint32_t) (((uint64_t) words[j] * range) >> 32);
+        }
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            if (words[j] * range < range) {
+                out[j] = Detail::Bounded32(words[j], range, next);
+            }
+        }
+    };
+    SampleChunks(stream, first, dst, count, fn);
+}
+
+void RandomBounded(
+    const RandomStream &stream,
+    const uint64_t first,
+    uint64_t *dst,
+    const size_t count,
+    const uint64_t range)
+{
+    if (range == 0) {
+        RandomFill(stream, first, dst, count);
+        return;
+    }
+
+    auto fn = [range] (ChunkReader &reader, uint64_t *out) {
+        auto next = [&reader] () { return reader.Next64(); };
+        uint64_t words[kChunkSize];
+        reader.Read(words, kChunkSize);
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            uint64_t lo;
+            out[j] = Detail::MulHiLo64(words[j], range, lo);
+        }
+        for (size_t j = 0; j < kChunkSize; ++j) {
+            if (words[j] * range < range) {
+                out[j] = Detail::Bounded64(words[j], range, next);
+            }
+        }
+    };
+    SampleChunks(stream, first, dst, count, fn);
+}
+
+/// ---- Sphere and disk samplers ---------------------------------------------
+///
+/// @brief Points on the sphere take z uniform in [-1, 1) and the azimuth
+/// uniform in [0, 2pi), with r = sqrt(1 - z^2) by Archimedes' theorem.
+/// Points in the disk take the radius sqrt(u) for u uniform in [0, 1). The
+/// sines and cosines of the azimuths of a chunk are evaluated by the packet
+/// fast math functions.
+///
+template<typename T>
+static void UniformChunk(ChunkReader &reader, T *u, T *v);
+
+template<>
+void UniformChunk<float>(ChunkReader &reader, float *u, float *v)
+{
+    uint32_t words[2 * kChunkSize];
+    reader.Read(words, 2 * kChunkSize);
+    for (size_t j = 0; j < kChunkSize; ++j) {
+        u[j] = (float) (words[2*j] >> 8) * 5.9604644775390625E-8f;
+        v[j] = (float) (words[2*j + 1] >> 8) * 5.9604644775390625E-8f;
+    }
+}
+
+template<>
+void UniformChunk<double>(ChunkReader &reader, double *u, double *v)
+{
+    uint64_t words[2 * kChunkSize];
+    reader.Read(words, 2 * kChunkSize);
+    for (size_t j = 0; j < kChunkSize; ++j) {
+        u[j] = (double) (words[2*j] >> 11) * 1.1102230246251565E-16;
+        v[j] = (double) (words[2*j + 1] >> 11) * 1.1102230246251565E-16;
+    }
+}
+
+template<typename T>
+static void SphereChunk(ChunkReader &reader, Vec3<T> *out)
+{
+    const T two_pi = (T) 6.283185307179586476925286766559;
+    T z[kChunkSize], phi[kChunkSize], sin[kChunkSize], cos[kChunkSize];
+    UniformChunk<T>(reader, z, phi);
+    for (size_t j = 0; j < kChunkSize; ++j) {
+        z[j] = (T) 2 * z[j] - (T) 1;
+        phi[j] *= two_pi;
+    }
+    Batch::SinCos(phi, sin, cos, kChunkSize);
+    for (size_t j = 0; j < kChunkSize; ++j) {
+        T r = std::sqrt(std::max((T) 0, (T) 1 - z[j] * z[j]));
+        out[j] = Vec3<T>{r * cos[j], r * sin[j], z[j]};
+    }
+}
+
+template<typename T>
+static void DiskChunk(ChunkReader &reader, Vec2<T> *out)
+{
+    const T two_pi = (T) 6.283185307179586476925286766559;
+    T u[kChunkSize], phi[kChunkSize], sin[kChunkSize], cos[kChunkSize];
+    UniformChunk<T>(reader, u, phi);
+    for (size_t j = 0; j < kChunkSize; ++j) {
+        phi[j] *= two_pi;
+    }
+    Batch::SinCos(phi, sin, cos, kChunkSize);
+    for (size_t j = 0; j < kChunkSize; ++j) {
+        T r = std::sqrt(u[j]);
+        out[j] = Vec2<T>{r * cos[j], r * sin[j]};
+    }
+}
+
+void RandomSphere(
+    const RandomStream &stream,
+    const uint64_t first,
+    Vec3<float> *dst,
+    const size_t count)
+{
+    SampleChunks(stream, first, dst, count, SphereChunk<float>);
+}
+
+void RandomSphere(
+    const RandomStream &stream,
+    const uint64_t first,
+    Vec3<double> *dst,
+    const size_t count)
+{
+    SampleChunks(stream, first, dst, count, SphereChunk<double>);
+}
+
+void RandomDisk(
+    const RandomStream &stream,
+    const uint64_t first,
+    Vec2<float> *dst,
+    const size_t count)
+{
+    SampleChunks(stream, first, dst, count, DiskChunk<float>);
+}
+
+void RandomDisk(
+    const RandomStream &stream,
+    const uint64_t first,
+    Vec2<double> *dst,
+    const size_t count)
+{
+    SampleChunks(stream, first, dst, count, DiskChunk<double>);
+}
+
+/// ---- Random primes --------------------------------------------------------
+///
+/// @brief A prime costs several modular exponentiations, so the array is
+/// distributed over the thread pool in small blocks of items.
+///
+static const size_t kPrimeBlockSize = 16;
+
+void RandomPrime(
+    const RandomStream &stream,
+    const uint64_t first,
+    uint64_t *dst,
+    const size_t count)
+{
+    RandomFill(stream, first, dst, count);
+
+    struct PrimeData {
+        uint64_t *dst;
+        size_t count;
+    } data = {dst, count};
+
+    auto run = [](size_t k, void *arg) {
+        PrimeData *data = static_cast<PrimeData *>(arg);
+        size_t begin = k * kPrimeBlockSize;
+        size_t end = std::min(begin + kPrimeBlockSize, data->count);
+        for (size_t i = begin; i < end; ++i) {
+            data->dst[i] = PrevPrime(data->dst[i]);
+        }
+    };
+
+    size_t num_blocks = (count + kPrimeBlockSize - 1) / kPrimeBlockSize;
+    Base::ParallelForIf(run, num_blocks, &data, num_blocks > 1);
+}
+
+} // namespace Math
@@ -0,0 +1,131 @@
+//
+// distribution.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_DISTRIBUTION_H_
+#define MATH_DISTRIBUTION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "random.h"
+#include "vector.h"
+
+namespace Math {
+
+///
+/// @brief Bulk samplers fill an array with random deviates of a distribution,
+/// drawn from a counter-based random stream:
+///
+///  RandomNormal       normal deviates of mean mu and standard deviation sig,
+///                     with the Ziggurat method of 128 layers.
+///  RandomExponential  exponential deviates of the given rate, with the
+///                     Ziggurat method of 256 layers.
+///  RandomBounded      integers uniform in [0, range), with Lemire's nearly
+///                     divisionless method. A range of zero returns the full
+///                     range of the integer type.
+///  RandomSphere       points uniform on the unit sphere.
+///  RandomDisk         points uniform in the unit disk.
+///  RandomPrime        64-bit primes, the largest prime smaller than or equal
+///                     to the 64-bit number of the stream at each index.
+///
+/// Uniform floating point numbers in [0, 1), exact to 24 and 53 bits, are
+/// filled by RandomFill.
+///
+/// The deviates are computed in chunks of consecutive items, and chunk k draws
+/// its random numbers from the blocks of the stream starting at k * 2^32, so
+/// that the deviate at index i depends only on the stream and i. The chunks
+/// of 1024 items limit the items to [0, 2^42), and the samplers other than
+/// RandomPrime throw std::runtime_error past the last item. The samplers
+/// are reproducible for any thread count and any offset of the first item,
+/// and arrays larger than a threshold are sampled in parallel over the thread
+/// pool, if the pool is running. Each chunk first transforms one number per
+/// item in a branch free loop over the random numbers of the simd stream
+/// kernels, and then resamples the few items rejected by the fast path.
+/// Primes are not chunked, each is found from the stream number at its index,
+/// and are sampled in parallel from any array size, since each costs a few
+/// microseconds.
+///
+/// @see Marsaglia, Tsang, "The Ziggurat Method for Generating Random
+///      Variables", https://doi.org/10.18637/jss.v005.i08
+///      Doornik, "An Improved Ziggurat Method to Generate Normal Random
+///      Samples", 2005.
+///      Lemire, "Fast Random Integer Generation in an Interval",
+///      https://doi.org/10.1145/3230636
+///
+void RandomNormal(
+    const RandomStream &stream,
+    const uint64_t first,
+    float *dst,
+    const size_t count,
+    const float mu = 0.0f,
+    const float sig = 1.0f);
+void RandomNormal(
+    const RandomStream &stream,
+    const uint64_t first,
+    double *dst,
+    const size_t count,
+    const double mu = 0.0,
+    const double sig = 1.0);
+
+void RandomExponential(
+    const RandomStream &stream,
+    const uint64_t first,
+    float *dst,
+    const size_t count,
+    const float rate = 1.0f);
+void RandomExponential(
+    const RandomStream &stream,
+    const uint64_t first,
+    double *dst,
+    const size_t count,
+    const double rate = 1.0);
+
+void RandomBounded(
+    const RandomStream &stream,
+    const uint64_t first,
+    uint32_t *dst,
+    const size_t count,
+    const uint32_t range);
+void RandomBounded(
+    const RandomStream &stream,
+    const uint64_t first,
+    uint64_t *dst,
+    const size_t count,
+    const uint64_t range);
+
+void RandomSphere(
+    const RandomStream &stream,
+    const uint64_t first,
+    Vec3<float> *dst,
+    const size_t count);
+void RandomSphere(
+    const RandomStream &stream,
+    const uint64_t first,
+    Vec3<double> *dst,
+    const size_t count);
+
+void RandomDisk(
+    const RandomStream &stream,
+    const uint64_t first,
+    Vec2<float> *dst,
+    const size_t count);
+void RandomDisk(
+    const RandomStream &stream,
+    const uint64_t first,
+    Vec2<double> *dst,
+    const size_t count);
+
+void RandomPrime(
+    const RandomStream &stream,
+    const uint64_t first,
+    uint64_t *dst,
+    const size_t count);
+
+} // namespace Math
+
+#endif // MATH_DISTRIBUTION_H_
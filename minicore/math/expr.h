@@ -0,0 +1,599 @@
+//
+// expr.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_EXPR_H_
+#define MATH_EXPR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "minicore/base/parallel.h"
+#include "packet.h"
+#include "vector.h"
+
+namespace Math {
+namespace Expr {
+
+///
+/// @brief Expression templates over arrays of scalars and 3-dimensional
+/// vectors. An arithmetic expression of array spans does not compute anything
+/// when it is built. It is a tree of lightweight nodes, evaluated when it is
+/// assigned to a span, in a single pass over the arrays:
+///
+///  Span<Vec3f> x = MakeSpan(positions);
+///  Span<const Vec3f> v = MakeSpan(velocities);
+///  Span<const Vec3f> a = MakeSpan(accelerations);
+///  x += dt * v + (0.5f * dt * dt) * a;
+///
+/// streams x, v and a through memory once, instead of once per operator with
+/// a temporary array for each partial result. The items are loaded into
+/// packets of 4 doubles or 8 floats in structure of arrays layout, and the
+/// whole expression is evaluated on each packet before it is stored.
+///
+/// Span operands of an expression must have the same size. Scalars and
+/// vectors are broadcast to every item:
+///
+///  +, -           spans of the same item type, or a span and a vector.
+///  *, /           spans of the same item type, a vector span and a scalar
+///                 span, or a span and a scalar.
+///  Dot, Cross     vector spans, Dot is a scalar span.
+///  Min, Max, Abs  spans of the same item type.
+///  Sqrt           scalar spans.
+///
+/// Assigning to a span evaluates the expression into its items, so that the
+/// assignment of one span to another copies the items, not the view. The
+/// assigned span may also appear in the expression, as each item depends only
+/// on the items of the operands with the same index. Large arrays are split
+/// in blocks over the thread pool with Base::ParallelForIf, if the pool is
+/// running and the caller is not one of its threads.
+///
+static const size_t kBlockSize = 4096;
+static const size_t kParallelMinCount = 65536;
+static const size_t kAnySize = std::numeric_limits<size_t>::max();
+
+/// ---- Expression packet types ----------------------------------------------
+///
+/// @brief Packet width of the element type, 4 doubles or 8 floats.
+///
+template<typename T>
+struct Lanes {
+    static const size_t width = 32 / sizeof(T);
+};
+
+///
+/// @brief Scalar and packet type of an array item. Scalar arrays are loaded
+/// into scalar packets and vector arrays into Vec3 packets.
+///
+template<typename V>
+struct Item {
+    typedef V Scalar;
+    typedef Packet<V, Lanes<V>::width> Type;
+};
+
+template<typename T>
+struct Item<Vec3<T>> {
+    typedef T Scalar;
+    typedef Vec3Packet<T, Lanes<T>::width> Type;
+};
+
+/// ---- Expression nodes -----------------------------------------------------
+///
+/// @brief Base of every expression node E. A node has the scalar and packet
+/// types of its result, the size of its arrays, or kAnySize if it holds no
+/// array, and evaluates the packet of n items starting at item i.
+///
+template<typename E>
+struct Expression {
+    const E &self() const { return static_cast<const E &>(*this); }
+};
+
+///
+/// @brief Span of an array of count items, the leaf node of an expression and
+/// the destination of its evaluation. V is const for input arrays.
+///
+template<typename V>
+struct Span : Expression<Span<V>> {
+    typedef typename std::remove_const<V>::type Value;
+    typedef typename Item<Value>::Scalar Scalar;
+    typedef typename Item<Value>::Type PacketType;
+
+    V *data;
+    size_t count;
+
+    Span(V *data, const size_t count) : data(data), count(count) {}
+    Span(const Span &other) = default;
+
+    size_t Size() const { return count; }
+    PacketType Eval(const size_t i, const size_t n) const {
+        PacketType p;
+        Load(p, data + i, n);
+        return p;
+    }
+
+    Span &operator=(const Span &rhs);
+    template<typename E> Span &operator=(const Expression<E> &rhs);
+    template<typename E> Span &operator+=(const Expression<E> &rhs);
+    template<typename E> Span &operator-=(const Expression<E> &rhs);
+    template<typename E> Span &operator*=(const Expression<E> &rhs);
+    template<typename E> Span &operator/=(const Expression<E> &rhs);
+    Span &operator*=(const Scalar scalar);
+    Span &operator/=(const Scalar scalar);
+};
+
+///
+/// @brief Scalar or vector constant, broadcast into a packet once when the
+/// expression is built.
+///
+template<typename T, typename P>
+struct Constant : Expression<Constant<T,P>> {
+    typedef T Scalar;
+    typedef P PacketType;
+
+    PacketType value;
+
+    explicit Constant(const PacketType &value) : value(value) {}
+
+    size_t Size() const { return kAnySize; }
+    PacketType Eval(const size_t, const size_t) const { return value; }
+};
+
+///
+/// @brief Unary and binary operation nodes. Op::Apply computes the packet of
+/// the result from the packets of the operands.
+///
+template<typename Op, typename A>
+struct Unary : Expression<Unary<Op,A>> {
+    typedef typename A::Scalar Scalar;
+    typedef decltype(Op::Apply(
+        std::declval<typename A::PacketType>())) PacketType;
+
+    A arg;
+
+    explicit Unary(const A &arg) : arg(arg) {}
+
+    size_t Size() const { return arg.Size(); }
+    PacketType Eval(const size_t i, const size_t n) const {
+        return Op::Apply(arg.Eval(i, n));
+    }
+};
+
+template<typename Op, typename L, typename R>
+struct Binary : Expression<Binary<Op,L,R>> {
+    static_assert(
+        std::is_same<typename L::Scalar, typename R::Scalar>::value,
+        "operands have different scalar types");
+    typedef typename L::Scalar Scalar;
+    typedef decltype(Op::Apply(
+        std::declval<typename L::PacketType>(),
+        std::declval<typename R::PacketType>())) PacketType;
+
+    L lhs;
+    R rhs;
+    size_t size;
+
+    Binary(const L &lhs, const R &rhs);
+
+    size_t Size() const { return size; }
+    PacketType Eval(const size_t i, const size_t n) const {
+        return Op::Apply(lhs.Eval(i, n), rhs.Eval(i, n));
+    }
+};
+
+///
+/// @brief The size of a binary node is the size of its array operands, which
+/// must be the same.
+///
+template<typename Op, typename L, typename R>
+inline Binary<Op,L,R>::Binary(const L &lhs, const R &rhs)
+    : lhs(lhs)
+    , rhs(rhs)
+    , size(lhs.Size() == kAnySize ? rhs.Size() : lhs.Size())
+{
+    if (rhs.Size() != kAnySize && rhs.Size() != size) {
+        throw std::runtime_error("mismatched array sizes");
+    }
+}
+
+/// ---- Expression operations ------------------------------------------------
+///
+/// @brief Packet operations of the expression nodes.
+///
+struct Add {
+    template<typename A, typename B>
+    static auto Apply(const A &a, const B &b) -> decltype(a + b) {
+        return a + b;
+    }
+};
+
+struct Sub {
+    template<typename A, typename B>
+    static auto Apply(const A &a, const B &b) -> decltype(a - b) {
+        return a - b;
+    }
+};
+
+struct Mul {
+    template<typename A, typename B>
+    static auto Apply(const A &a, const B &b) -> decltype(a * b) {
+        return a * b;
+    }
+};
+
+struct Div {
+    template<typename A, typename B>
+    static auto Apply(const A &a, const B &b) -> decltype(a / b) {
+        return a / b;
+    }
+};
+
+struct Neg {
+    template<typename A>
+    static A Apply(const A &a) { return -a; }
+};
+
+struct DotOp {
+    template<typename A, typename B>
+    static auto Apply(const A &a, const B &b) -> decltype(Math::Dot(a, b)) {
+        return Math::Dot(a, b);
+    }
+};
+
+struct CrossOp {
+    template<typename A, typename B>
+    static auto Apply(const A &a, const B &b) -> decltype(Math::Cross(a, b)) {
+        return Math::Cross(a, b);
+    }
+};
+
+struct MinOp {
+    template<typename A, typename B>
+    static auto Apply(const A &a, const B &b) -> decltype(Math::Min(a, b)) {
+        return Math::Min(a, b);
+    }
+};
+
+struct MaxOp {
+    template<typename A, typename B>
+    static auto Apply(const A &a, const B &b) -> decltype(Math::Max(a, b)) {
+        return Math::Max(a, b);
+    }
+};
+
+struct AbsOp {
+    template<typename A>
+    static auto Apply(const A &a) -> decltype(Math::Abs(a)) {
+        return Math::Abs(a);
+    }
+};
+
+struct SqrtOp {
+    template<typename A>
+    static auto Apply(const A &a) -> decltype(Math::Sqrt(a)) {
+        return Math::Sqrt(a);
+    }
+};
+
+/// ---- Expression constants -------------------------------------------------
+///
+/// @brief Broadcast constants of the scalar type of the expression E.
+///
+template<typename E>
+using ScalarConstant = Constant<
+    typename E::Scalar,
+    typename Item<typename E::Scalar>::Type>;
+
+template<typename E>
+using VectorConstant = Constant<
+    typename E::Scalar,
+    typename Item<Vec3<typename E::Scalar>>::Type>;
+
+template<typename E>
+inline ScalarConstant<E> MakeConstant(const typename E::Scalar scalar)
+{
+    using T = typename E::Scalar;
+    return ScalarConstant<E>(Broadcast<T, Lanes<T>::width>(scalar));
+}
+
+template<typename E>
+inline VectorConstant<E> MakeConstant(const Vec3<typename E::Scalar> &v)
+{
+    using T = typename E::Scalar;
+    return VectorConstant<E>(Broadcast<T, Lanes<T>::width>(v));
+}
+
+/// ---- Expression operators -------------------------------------------------
+///
+/// @brief Arithmetic operators of two expressions.
+///
+template<typename L, typename R>
+inline Binary<Add,L,R> operator+(
+    const Expression<L> &lhs, const Expression<R> &rhs)
+{
+    return Binary<Add,L,R>(lhs.self(), rhs.self());
+}
+
+template<typename L, typename R>
+inline Binary<Sub,L,R> operator-(
+    const Expression<L> &lhs, const Expression<R> &rhs)
+{
+    return Binary<Sub,L,R>(lhs.self(), rhs.self());
+}
+
+template<typename L, typename R>
+inline Binary<Mul,L,R> operator*(
+    const Expression<L> &lhs, const Expression<R> &rhs)
+{
+    return Binary<Mul,L,R>(lhs.self(), rhs.self());
+}
+
+template<typename L, typename R>
+inline Binary<Div,L,R> operator/(
+    const Expression<L> &lhs, const Expression<R> &rhs)
+{
+    return Binary<Div,L,R>(lhs.self(), rhs.self());
+}
+
+template<typename E>
+inline Unary<Neg,E> operator-(const Expression<E> &arg)
+{
+    return Unary<Neg,E>(arg.self());
+}
+
+///
+/// @brief Arithmetic operators of an expression and a scalar. The scalar is
+/// converted to the scalar type of the expression.
+///
+template<typename E>
+inline Binary<Mul,E,ScalarConstant<E>> operator*(
+    const Expression<E> &lhs, const typename E::Scalar scalar)
+{
+    return {lhs.self(), MakeConstant<E>(scalar)};
+}
+
+template<typename E>
+inline Binary<Mul,ScalarConstant<E>,E> operator*(
+    const typename E::Scalar scalar, const Expression<E> &rhs)
+{
+    return {MakeConstant<E>(scalar), rhs.self()};
+}
+
+template<typename E>
+inline Binary<Div,E,ScalarConstant<E>> operator/(
+    const Expression<E> &lhs, const typename E::Scalar scalar)
+{
+    return {lhs.self(), MakeConstant<E>(scalar)};
+}
+
+///
+/// @brief Arithmetic operators of a vector expression and a vector.
+///
+template<typename E>
+inline Binary<Add,E,VectorConstant<E>> operator+(
+    const Expression<E> &lhs, const Vec3<typename E::Scalar> &v)
+{
+    return {lhs.self(), MakeConstant<E>(v)};
+}
+
+template<typename E>
+inline Binary<Add,VectorConstant<E>,E> operator+(
+    const Vec3<typename E::Scalar> &v, const Expression<E> &rhs)
+{
+    return {MakeConstant<E>(v), rhs.self()};
+}
+
+template<typename E>
+inline Binary<Sub,E,VectorConstant<E>> operator-(
+    const Expression<E> &lhs, const Vec3<typename E::Scalar> &v)
+{
+    return {lhs.self(), MakeConstant<E>(v)};
+}
+
+template<typename E>
+inline Binary<Sub,VectorConstant<E>,E> operator-(
+    const Vec3<typename E::Scalar> &v, const Expression<E> &rhs)
+{
+    return {MakeConstant<E>(v), rhs.self()};
+}
+
+template<typename E>
+inline Binary<Mul,E,VectorConstant<E>> operator*(
+    const Expression<E> &lhs, const Vec3<typename E::Scalar> &v)
+{
+    return {lhs.self(), MakeConstant<E>(v)};
+}
+
+template<typename E>
+inline Binary<Mul,VectorConstant<E>,E> operator*(
+    const Vec3<typename E::Scalar> &v, const Expression<E> &rhs)
+{
+    return {MakeConstant<E>(v), rhs.self()};
+}
+
+/// ---- Expression functions -------------------------------------------------
+///
+/// @brief Element-wise algebra and arithmetic functions of expressions.
+///
+template<typename L, typename R>
+inline Binary<DotOp,L,R> Dot(
+    const Expression<L> &lhs, const Expression<R> &rhs)
+{
+    return Binary<DotOp,L,R>(lhs.self(), rhs.self());
+}
+
+template<typename L, typename R>
+inline Binary<CrossOp,L,R> Cross(
+    const Expression<L> &lhs, const Expression<R> &rhs)
+{
+    return Binary<CrossOp,L,R>(lhs.self(), rhs.self());
+}
+
+template<typename L, typename R>
+inline Binary<MinOp,L,R> Min(
+    const Expression<L> &lhs, const Expression<R> &rhs)
+{
+    return Binary<MinOp,L,R>(lhs.self(), rhs.self());
+}
+
+template<typename L, typename R>
+inline Binary<MaxOp,L,R> Max(
+    const Expression<L> &lhs, const Expression<R> &rhs)
+{
+    return Binary<MaxOp,L,R>(lhs.self(), rhs.self());
+}
+
+template<typename E>
+inline Unary<AbsOp,E> Abs(const Expression<E> &arg)
+{
+    return Unary<AbsOp,E>(arg.self());
+}
+
+template<typename E>
+inline Unary<SqrtOp,E> Sqrt(const Expression<E> &arg)
+{
+    return Unary<SqrtOp,E>(arg.self());
+}
+
+/// ---- Expression evaluation ------------------------------------------------
+///
+/// @brief Evaluate the expression into the span, one packet at a time. Each
+/// block of items is evaluated in the calling thread, or over the thread pool
+/// if it is running and the array is large enough. The lanes past the end of
+/// the array in the last packet are evaluated on zeros and never stored.
+///
+template<typename V, typename E>
+inline void Evaluate(const Span<V> &dst, const Expression<E> &expr)
+{
+    static_assert(!std::is_const<V>::value, "span is read-only");
+    static_assert(
+        std::is_same<typename Span<V>::PacketType,
+            typename E::PacketType>::value,
+        "span and expression have different item types");
+
+    if (expr.self().Size() != kAnySize && expr.self().Size() != dst.count) {
+        throw std::runtime_error("mismatched array sizes");
+    }
+
+    struct BlockData {
+        const Span<V> *dst;
+        const E *expr;
+    } data = {&dst, &expr.self()};
+
+    auto run = [](size_t block, void *arg) {
+        using T = typename Span<V>::Scalar;
+        const size_t width = Lanes<T>::width;
+        BlockData *data = static_cast<BlockData *>(arg);
+        size_t first = block * kBlockSize;
+        size_t last = std::min(first + kBlockSize, data->dst->count);
+        for (size_t i = first; i < last; i += width) {
+            size_t n = std::min(width, last - i);
+            Store(data->expr->Eval(i, n), data->dst->data + i, n);
+        }
+    };
+
+    size_t count = dst.count;
+    size_t num_blocks = (count + kBlockSize - 1) / kBlockSize;
+    Base::ParallelForIf(run, num_blocks, &data, count >= kParallelMinCount);
+}
+
+/// ---- Span assignment operators --------------------------------------------
+///
+/// @brief Evaluate the expression into the span. The compound assignments
+/// evaluate the expression with the span as its left operand.
+///
+template<typename V>
+inline Span<V> &Span<V>::operator=(const Span &rhs)
+{
+    Evaluate(*this, rhs);
+    return *this;
+}
+
+template<typename V>
+template<typename E>
+inline Span<V> &Span<V>::operator=(const Expression<E> &rhs)
+{
+    Evaluate(*this, rhs);
+    return *this;
+}
+
+template<typename V>
+template<typename E>
+inline Span<V> &Span<V>::operator+=(const Expression<E> &rhs)
+{
+    Evaluate(*this, *this + rhs);
+    return *this;
+}
+
+template<typename V>
+template<typename E>
+inline Span<V> &Span<V>::operator-=(const Expression<E> &rhs)
+{
+    Evaluate(*this, *this - rhs);
+    return *this;
+}
+
+template<typename V>
+template<typename E>
+inline Span<V> &Span<V>::operator*=(const Expression<E> &rhs)
+{
+    Evaluate(*this, *this * rhs);
+    return *this;
+}
+
+template<typename V>
+template<typename E>
+inline Span<V> &Span<V>::operator/=(const Expression<E> &rhs)
+{
+    Evaluate(*this, *this / rhs);
+    return *this;
+}
+
+template<typename V>
+inline Span<V> &Span<V>::operator*=(const Scalar scalar)
+{
+    Evaluate(*this, *this * scalar);
+    return *this;
+}
+
+template<typename V>
+inline Span<V> &Span<V>::operator/=(const Scalar scalar)
+{
+    Evaluate(*this, *this / scalar);
+    return *this;
+}
+
+/// ---- Span factory functions -----------------------------------------------
+///
+/// @brief Return the span of an array or a vector of items.
+///
+template<typename V>
+inline Span<V> MakeSpan(V *data, const size_t count)
+{
+    return Span<V>(data, count);
+}
+
+template<typename V, typename Allocator>
+inline Span<V> MakeSpan(std::vector<V, Allocator> &v)
+{
+    return Span<V>(v.data(), v.size());
+}
+
+template<typename V, typename Allocator>
+inline Span<const V> MakeSpan(const std::vector<V, Allocator> &v)
+{
+    return Span<const V>(v.data(), v.size());
+}
+
+} // namespace Expr
+} // namespace Math
+
+#endif // MATH_EXPR_H_
@@ -0,0 +1,182 @@
+//
+// fastmath.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_FASTMATH_H_
+#define MATH_FASTMATH_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "packet.h"
+
+namespace Math {
+
+///
+/// @brief Vectorized approximations of the elementary functions of packet
+/// lanes, with two accuracy tiers:
+///
+///  kAccuracyPrecise   close to the correctly rounded result, within a few
+///                     ulp over the whole domain.
+///  kAccuracyFast      lower degree polynomials and fewer refinement steps,
+///                     with a bounded relative or absolute error.
+///
+/// Maximum errors of the Packet4d and Packet8f implementations, measured
+/// against the long double std functions, in ulp or as the relative or the
+/// absolute error. The relative errors of Exp hold for normal results:
+///
+///                 double                  float
+///                 precise     fast        precise     fast
+///  Rsqrt          2 ulp       2^-44 rel   2 ulp       2^-21 rel
+///  Exp            1 ulp       2^-29 rel   1 ulp       2^-18 rel
+///  Log            1 ulp       2^-29 abs   1 ulp       2^-14 abs
+///  Sin, Cos       2 ulp       2^-28 abs   2 ulp       2^-14 abs
+///  Atan2          2 ulp       2^-26 abs   3 ulp       2^-15 abs
+///
+/// Exp and Log return inf, 0, -inf and NaN outside their domain as the std
+/// functions do. The fast Rsqrt requires positive normal arguments, SinCos
+/// reduces its arguments accurately for |x| < 2^20, and for |x| < 2^13 in
+/// fast single precision, and Atan2 does not support infinite arguments. Packet
+/// types without a simd implementation evaluate the std functions, for both
+/// tiers.
+///
+/// The Packet4d and Packet8f specializations are compiled with the instruction
+/// set of the consumer, and require ENABLE_AVX. Without it, the packet
+/// functions evaluate the std functions. The Batch array functions use the
+/// dispatched kernels instead, see dispatch.h, and get the simd versions on
+/// any cpu with AVX.
+///
+enum Accuracy : uint32_t {
+    kAccuracyPrecise = 0,
+    kAccuracyFast
+};
+
+inline namespace MATH_SIMD_ISA {
+
+/// ---- Packet fast math functions -------------------------------------------
+/// @brief Inverse square root 1/sqrt(u) of the packet lanes.
+///
+template<typename T, size_t N>
+inline Packet<T,N> Rsqrt(
+    const Packet<T,N> &u, const Accuracy accuracy = kAccuracyPrecise);
+
+///
+/// @brief Exponential exp(u) of the packet lanes.
+///
+template<typename T, size_t N>
+inline Packet<T,N> Exp(
+    const Packet<T,N> &u, const Accuracy accuracy = kAccuracyPrecise);
+
+///
+/// @brief Natural logarithm log(u) of the packet lanes.
+///
+template<typename T, size_t N>
+inline Packet<T,N> Log(
+    const Packet<T,N> &u, const Accuracy accuracy = kAccuracyPrecise);
+
+///
+/// @brief Sine and cosine of the packet lanes, in a single evaluation.
+///
+template<typename T, size_t N>
+inline void SinCos(
+    const Packet<T,N> &u,
+    Packet<T,N> &sin,
+    Packet<T,N> &cos,
+    const Accuracy accuracy = kAccuracyPrecise);
+
+///
+/// @brief Arc tangent atan2(y, x) of the packet lanes, in [-pi, pi].
+///
+template<typename T, size_t N>
+inline Packet<T,N> Atan2(
+    const Packet<T,N> &y,
+    const Packet<T,N> &x,
+    const Accuracy accuracy = kAccuracyPrecise);
+
+///
+/// @brief Normalize the vector packet lanes with the inverse square root of
+/// the selected accuracy.
+///
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Normalize(
+    const Vec3Packet<T,N> &a, const Accuracy accuracy);
+
+/// ---- Packet fast math implementation --------------------------------------
+///
+template<typename T, size_t N>
+inline Packet<T,N> Rsqrt(const Packet<T,N> &u, const Accuracy)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (T) 1 / std::sqrt(u.data[i]);
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> Exp(const Packet<T,N> &u, const Accuracy)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = std::exp(u.data[i]);
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> Log(const Packet<T,N> &u, const Accuracy)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = std::log(u.data[i]);
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline void SinCos(
+    const Packet<T,N> &u,
+    Packet<T,N> &sin,
+    Packet<T,N> &cos,
+    const Accuracy)
+{
+    for (size_t i = 0; i < N; ++i) {
+        sin.data[i] = std::sin(u.data[i]);
+        cos.data[i] = std::cos(u.data[i]);
+    }
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> Atan2(
+    const Packet<T,N> &y,
+    const Packet<T,N> &x,
+    const Accuracy)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = std::atan2(y.data[i], x.data[i]);
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Normalize(
+    const Vec3Packet<T,N> &a, const Accuracy accuracy)
+{
+    return a * Rsqrt(Dot(a, a), accuracy);
+}
+
+} // inline namespace MATH_SIMD_ISA
+} // namespace Math
+
+/// ---- simd implementations ------------------------------------------------
+#ifdef __AVX__
+#include "simd/fastmath.h"
+#endif
+
+#endif // MATH_FASTMATH_H_
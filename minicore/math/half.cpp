@@ -0,0 +1,39 @@
+//
+// half.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "dispatch.h"
+#include "half.h"
+
+namespace Math {
+
+///
+/// @brief Convert an array of floats to half or bfloat16, and back, with the
+/// kernels of the highest instruction set level supported by the cpu.
+///
+void Convert(const float *src, Half *dst, const size_t count)
+{
+    GetKernels().convertToHalf(src, dst, count);
+}
+
+void Convert(const Half *src, float *dst, const size_t count)
+{
+    GetKernels().convertFromHalf(src, dst, count);
+}
+
+void Convert(const float *src, BFloat16 *dst, const size_t count)
+{
+    GetKernels().convertToBFloat16(src, dst, count);
+}
+
+void Convert(const BFloat16 *src, float *dst, const size_t count)
+{
+    GetKernels().convertFromBFloat16(src, dst, count);
+}
+
+} // namespace Math
@@ -0,0 +1,220 @@
+//
+// half.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_HALF_H_
+#define MATH_HALF_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include "packed.h"
+
+namespace Math {
+
+///
+/// @brief Half and BFloat16 are 16-bit floating point storage types:
+///
+///  Half       IEEE 754 binary16, 1 sign, 5 exponent and 10 mantissa bits.
+///             Range +-65504, about 3 decimal digits.
+///  BFloat16   upper half of a binary32 float, 1 sign, 8 exponent and 7
+///             mantissa bits. Same range as float, about 2 decimal digits.
+///
+/// They hold the bits only and have no arithmetic. Convert them to float to
+/// operate on them. The conversions from float round to nearest even, and
+/// quiet the signaling NaNs, the same as the F16C instructions. Use the array
+/// conversions for large arrays, which are dispatched to the F16C and AVX-512
+/// kernels if the cpu supports them.
+///
+/// ---- Half data types ------------------------------------------------------
+struct Half {
+    uint16_t bits;
+
+    Half() = default;
+    explicit Half(float value);
+    explicit operator float() const;
+};
+
+struct BFloat16 {
+    uint16_t bits;
+
+    BFloat16() = default;
+    explicit BFloat16(float value);
+    explicit operator float() const;
+};
+
+static_assert(sizeof(Half) == 2, "invalid Half size");
+static_assert(sizeof(BFloat16) == 2, "invalid BFloat16 size");
+
+/// ---- Packed half vector data types ----------------------------------------
+typedef PackedVec2<Half>        PackedVec2h;
+typedef PackedVec3<Half>        PackedVec3h;
+typedef PackedVec4<Half>        PackedVec4h;
+typedef PackedVec2<BFloat16>    PackedVec2bf;
+typedef PackedVec3<BFloat16>    PackedVec3bf;
+typedef PackedVec4<BFloat16>    PackedVec4bf;
+
+static_assert(sizeof(PackedVec3h) == 6, "invalid PackedVec3h size");
+static_assert(sizeof(PackedVec3bf) == 6, "invalid PackedVec3bf size");
+
+/// ---- Half declarations ----------------------------------------------------
+/// Scalar conversions between float and the 16-bit types.
+inline uint16_t FloatToHalfBits(const float value);
+inline float HalfBitsToFloat(const uint16_t bits);
+inline uint16_t FloatToBFloat16Bits(const float value);
+inline float BFloat16BitsToFloat(const uint16_t bits);
+
+/// Array conversions between float and the 16-bit types.
+void Convert(const float *src, Half *dst, const size_t count);
+void Convert(const Half *src, float *dst, const size_t count);
+void Convert(const float *src, BFloat16 *dst, const size_t count);
+void Convert(const BFloat16 *src, float *dst, const size_t count);
+
+/// Array conversions between packed float vectors and packed 16-bit vectors.
+template<typename T, typename U>
+inline void Convert(
+    const PackedVec2<T> *src, PackedVec2<U> *dst, const size_t count);
+template<typename T, typename U>
+inline void Convert(
+    const PackedVec3<T> *src, PackedVec3<U> *dst, const size_t count);
+template<typename T, typename U>
+inline void Convert(
+    const PackedVec4<T> *src, PackedVec4<U> *dst, const size_t count);
+
+/// ---- Half implementation --------------------------------------------------
+///
+/// @brief Convert a float to half bits, rounding to nearest even. Values that
+/// overflow the half range become infinity. Values below the smallest normal
+/// half are rounded in the float unit, by adding them to a float whose unit in
+/// the last place is the smallest denormal half.
+/// @see https://gist.github.com/rygorous/2156668
+///
+inline uint16_t FloatToHalfBits(const float value)
+{
+    uint32_t f;
+    std::memcpy(&f, &value, sizeof(f));
+    const uint32_t sign = f & 0x80000000u;
+    f ^= sign;
+
+    uint32_t h;
+    if (f >= 0x47800000u) {
+        // Overflow, infinity or NaN.
+        h = (f > 0x7f800000u) ? (0x7e00u | ((f >> 13) & 0x3ffu)) : 0x7c00u;
+    } else if (f < 0x38800000u) {
+        // Denormal half or zero.
+        const uint32_t magic_bits = 0x3f000000u;
+        float magic, v;
+        std::memcpy(&magic, &magic_bits, sizeof(magic));
+        std::memcpy(&v, &f, sizeof(v));
+        v += magic;
+        std::memcpy(&h, &v, sizeof(h));
+        h -= magic_bits;
+    } else {
+        // Normal half, rebias the exponent and round the mantissa.
+        const uint32_t odd = (f >> 13) & 1u;
+        f += 0xc8000fffu + odd;
+        h = f >> 13;
+    }
+    return static_cast<uint16_t>(h | (sign >> 16));
+}
+
+///
+/// @brief Convert half bits to a float. Every half is exactly representable as
+/// a float. Signaling NaNs are quieted.
+///
+inline float HalfBitsToFloat(const uint16_t bits)
+{
+    const uint32_t sign = static_cast<uint32_t>(bits & 0x8000u) << 16;
+    const uint32_t exponent = (bits >> 10) & 0x1fu;
+    const uint32_t mantissa = bits & 0x3ffu;
+
+    uint32_t f;
+    if (exponent == 0x1fu) {
+        // Infinity or NaN.
+        f = sign | 0x7f800000u | (mantissa ? (0x200u | mantissa) << 13 : 0u);
+    } else if (exponent == 0) {
+        // Denormal half or zero, mantissa * 2^-24.
+        float v = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+        std::memcpy(&f, &v, sizeof(f));
+        f |= sign;
+    } else {
+        f = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+
+    float value;
+    std::memcpy(&value, &f, sizeof(value));
+    return value;
+}
+
+///
+/// @brief Convert a float to bfloat16 bits, rounding to nearest even. NaNs are
+/// quieted and keep the upper bits of their payload.
+///
+inline uint16_t FloatToBFloat16Bits(const float value)
+{
+    uint32_t f;
+    std::memcpy(&f, &value, sizeof(f));
+    if ((f & 0x7fffffffu) > 0x7f800000u) {
+        return static_cast<uint16_t>((f >> 16) | 0x40u);
+    }
+    f += 0x7fffu + ((f >> 16) & 1u);
+    return static_cast<uint16_t>(f >> 16);
+}
+
+///
+/// @brief Convert bfloat16 bits to a float.
+///
+inline float BFloat16BitsToFloat(const uint16_t bits)
+{
+    uint32_t f = static_cast<uint32_t>(bits) << 16;
+    float value;
+    std::memcpy(&value, &f, sizeof(value));
+    return value;
+}
+
+///
+/// @brief Half and BFloat16 conversion operators.
+///
+inline Half::Half(float value) : bits(FloatToHalfBits(value)) {}
+inline Half::operator float() const { return HalfBitsToFloat(bits); }
+
+inline BFloat16::BFloat16(float value) : bits(FloatToBFloat16Bits(value)) {}
+inline BFloat16::operator float() const { return BFloat16BitsToFloat(bits); }
+
+/// -----------------------------------------------------------------------------
+/// @brief Convert an array of packed vectors between float and a 16-bit type.
+/// The packed vectors have no padding, so the array is converted as one array
+/// of scalars.
+///
+template<typename T, typename U>
+inline void Convert(
+    const PackedVec2<T> *src, PackedVec2<U> *dst, const size_t count)
+{
+    Convert(reinterpret_cast<const T *>(src),
+        reinterpret_cast<U *>(dst), 2 * count);
+}
+
+template<typename T, typename U>
+inline void Convert(
+    const PackedVec3<T> *src, PackedVec3<U> *dst, const size_t count)
+{
+    Convert(reinterpret_cast<const T *>(src),
+        reinterpret_cast<U *>(dst), 3 * count);
+}
+
+template<typename T, typename U>
+inline void Convert(
+    const PackedVec4<T> *src, PackedVec4<U> *dst, const size_t count)
+{
+    Convert(reinterpret_cast<const T *>(src),
+        reinterpret_cast<U *>(dst), 4 * count);
+}
+
+} // namespace Math
+
+#endif // MATH_HALF_H_
@@ -75,4 +75,8 @@ template struct Mat4<double>;
 template struct Ortho<float>;
 template struct Ortho<double>;
 
+/// Quat explicit instantiation
+template struct Quat<float>;
+template struct Quat<double>;
+
 } // namespace Math
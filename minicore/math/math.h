@@ -23,16 +23,55 @@
 ///  last 64-bit double padded to zero.
 ///  4x4 matrix is interpreted as four 256-bit (4x64) memory blocks.
 ///
+///  Single precision vectors and matrix rows are interpreted in the same way
+///  as one 128-bit (4x32) memory block, with the unused 32-bit floats padded
+///  to zero. The 2x2 matrix is interpreted as a single 128-bit memory block.
+///  Signed and unsigned 32-bit integer vectors are interpreted as one 128-bit
+///  (4x32) memory block, with the unused elements left unspecified.
+///
+///  Packets of 4 doubles or 8 floats are interpreted as one 256-bit memory
+///  block. Vector packets hold one packet per component, in structure of
+///  arrays layout.
+///
+///  Quaternions are interpreted in the same way as a 1x4 vector, with the
+///  scalar part in the last element.
+///
+///  Half and bfloat16 are 16-bit storage types. Arrays of them are converted
+///  to and from float arrays in bulk, 8 or 16 elements at a time.
+///
+/// @brief Instruction sets:
+///
+///  The array kernels in dispatch.h, used by the batch functions, are compiled
+///  for each instruction set level and the highest level supported by the cpu
+///  is selected at runtime. The rest of the library is compiled for the
+///  baseline instruction set. The inline functions are compiled with the
+///  instruction set of the consumer, ENABLE_AVX and ENABLE_FMA, and use the
+///  generic templates without them. The packet functions are declared in a
+///  namespace of each instruction set, see simd/isa.h.
+///
 /// @see https://stackoverflow.com/questions/4421706
 ///      https://stackoverflow.com/questions/36955576
 ///      https://gamedev.stackexchange.com/questions/33142
 ///      https://stackoverflow.com/questions/36211864
 ///      https://gcc.gnu.org/onlinedocs/gcc-6.5.0/gcc/Common-Type-Attributes.html
 ///
+#include "batch.h"
+#include "cell.h"
+#include "constexpr.h"
+#include "dispatch.h"
+#include "distribution.h"
+#include "expr.h"
+#include "fastmath.h"
+#include "half.h"
 #include "io.h"
 #include "matrix.h"
+#include "matrixn.h"
 #include "ortho.h"
+#include "packed.h"
+#include "packet.h"
+#include "quat.h"
 #include "random.h"
+#include "randomtest.h"
 #include "transform.h"
 #include "vector.h"
 
@@ -10,6 +10,8 @@
 #ifndef MATH_MATRIX_H_
 #define MATH_MATRIX_H_
 
+#include "constexpr.h"
+
 namespace Math {
 
 /// ---- Matrix data types ----------------------------------------------------
@@ -30,8 +32,8 @@ struct Mat2 {
                    yx, yy; };
     };
 
-    T &operator[](size_t i) { return data[i]; }
-    const T &operator[](size_t i) const { return data[i]; }
+    constexpr T &operator[](size_t i) { return data[i]; }
+    constexpr const T &operator[](size_t i) const { return data[i]; }
 };
 
 template<typename T>
@@ -52,8 +54,8 @@ struct Mat3 {
                    zx, zy, zz; };
     };
 
-    T &operator[](size_t i) { return data[i]; }
-    const T &operator[](size_t i) const { return data[i]; }
+    constexpr T &operator[](size_t i) { return data[i]; }
+    constexpr const T &operator[](size_t i) const { return data[i]; }
 };
 
 template<typename T>
@@ -76,8 +78,8 @@ struct Mat4 {
                    wx, wy, wz, ww; };
     };
 
-    T &operator[](size_t i) { return data[i]; }
-    const T &operator[](size_t i) const { return data[i]; }
+    constexpr T &operator[](size_t i) { return data[i]; }
+    constexpr const T &operator[](size_t i) const { return data[i]; }
 };
 
 typedef Mat2<int16_t>   Mat2i16;
@@ -116,391 +118,398 @@ typedef Mat4<double>    Mat4d;
 /// ---- Special matrices -----------------------------------------------------
 ///
 template<typename T>
-const Mat2<T> Mat2<T>::Zeros = {
+constexpr Mat2<T> Mat2<T>::Zeros = {
     (T) 0, (T) 0,
     (T) 0, (T) 0};
 template<typename T>
-const Mat2<T> Mat2<T>::Ones = {
+constexpr Mat2<T> Mat2<T>::Ones = {
     (T) 1, (T) 1,
     (T) 1, (T) 1};
 template<typename T>
-const Mat2<T> Mat2<T>::Eye = {
+constexpr Mat2<T> Mat2<T>::Eye = {
     (T) 1, (T) 0,
     (T) 0, (T) 1};
 
 template<typename T>
-const Mat3<T> Mat3<T>::Zeros = {
+constexpr Mat3<T> Mat3<T>::Zeros = {
     (T) 0, (T) 0, (T) 0,
     (T) 0, (T) 0, (T) 0,
     (T) 0, (T) 0, (T) 0};
 template<typename T>
-const Mat3<T> Mat3<T>::Ones = {
+constexpr Mat3<T> Mat3<T>::Ones = {
     (T) 1, (T) 1, (T) 1,
     (T) 1, (T) 1, (T) 1,
     (T) 1, (T) 1, (T) 1};
 template<typename T>
-const Mat3<T> Mat3<T>::Eye = {
+constexpr Mat3<T> Mat3<T>::Eye = {
     (T) 1, (T) 0, (T) 0,
     (T) 0, (T) 1, (T) 0,
     (T) 0, (T) 0, (T) 1};
 
 template<typename T>
-const Mat4<T> Mat4<T>::Zeros = {
+constexpr Mat4<T> Mat4<T>::Zeros = {
     (T) 0, (T) 0, (T) 0, (T) 0,
     (T) 0, (T) 0, (T) 0, (T) 0,
     (T) 0, (T) 0, (T) 0, (T) 0,
     (T) 0, (T) 0, (T) 0, (T) 0};
 
 template<typename T>
-const Mat4<T> Mat4<T>::Ones = {
+constexpr Mat4<T> Mat4<T>::Ones = {
     (T) 1, (T) 1, (T) 1, (T) 1,
     (T) 1, (T) 1, (T) 1, (T) 1,
     (T) 1, (T) 1, (T) 1, (T) 1,
     (T) 1, (T) 1, (T) 1, (T) 1};
 
 template<typename T>
-const Mat4<T> Mat4<T>::Eye = {
+constexpr Mat4<T> Mat4<T>::Eye = {
     (T) 1, (T) 0, (T) 0, (T) 0,
     (T) 0, (T) 1, (T) 0, (T) 0,
     (T) 0, (T) 0, (T) 1, (T) 0,
     (T) 0, (T) 0, (T) 0, (T) 1};
 
+inline namespace MATH_SIMD_ISA {
+
 /// ---- Mat2 declarations ----------------------------------------------------
 /// Compound assignment operators matrix operators.
 ///
 template<typename T>
-inline Mat2<T> &operator+=(Mat2<T> &lhs, const Mat2<T> &rhs);
+constexpr Mat2<T> &operator+=(Mat2<T> &lhs, const Mat2<T> &rhs);
 template<typename T>
-inline Mat2<T> &operator-=(Mat2<T> &lhs, const Mat2<T> &rhs);
+constexpr Mat2<T> &operator-=(Mat2<T> &lhs, const Mat2<T> &rhs);
 template<typename T>
-inline Mat2<T> &operator*=(Mat2<T> &lhs, const Mat2<T> &rhs);
+constexpr Mat2<T> &operator*=(Mat2<T> &lhs, const Mat2<T> &rhs);
 template<typename T>
-inline Mat2<T> &operator/=(Mat2<T> &lhs, const Mat2<T> &rhs);
+constexpr Mat2<T> &operator/=(Mat2<T> &lhs, const Mat2<T> &rhs);
 
 template<typename T>
-inline Mat2<T> &operator+=(Mat2<T> &lhs, const T scalar);
+constexpr Mat2<T> &operator+=(Mat2<T> &lhs, const T scalar);
 template<typename T>
-inline Mat2<T> &operator-=(Mat2<T> &lhs, const T scalar);
+constexpr Mat2<T> &operator-=(Mat2<T> &lhs, const T scalar);
 template<typename T>
-inline Mat2<T> &operator*=(Mat2<T> &lhs, const T scalar);
+constexpr Mat2<T> &operator*=(Mat2<T> &lhs, const T scalar);
 template<typename T>
-inline Mat2<T> &operator/=(Mat2<T> &lhs, const T scalar);
+constexpr Mat2<T> &operator/=(Mat2<T> &lhs, const T scalar);
 
 /// Arithmetic operators.
 template<typename T>
-inline Mat2<T> operator+(Mat2<T> lhs, const Mat2<T> &rhs);
+constexpr Mat2<T> operator+(Mat2<T> lhs, const Mat2<T> &rhs);
 template<typename T>
-inline Mat2<T> operator-(Mat2<T> lhs, const Mat2<T> &rhs);
+constexpr Mat2<T> operator-(Mat2<T> lhs, const Mat2<T> &rhs);
 template<typename T>
-inline Mat2<T> operator*(Mat2<T> lhs, const Mat2<T> &rhs);
+constexpr Mat2<T> operator*(Mat2<T> lhs, const Mat2<T> &rhs);
 template<typename T>
-inline Mat2<T> operator/(Mat2<T> lhs, const Mat2<T> &rhs);
+constexpr Mat2<T> operator/(Mat2<T> lhs, const Mat2<T> &rhs);
 
 template<typename T>
-inline Mat2<T> operator+(Mat2<T> lhs, const T scalar);
+constexpr Mat2<T> operator+(Mat2<T> lhs, const T scalar);
 template<typename T>
-inline Mat2<T> operator-(Mat2<T> lhs, const T scalar);
+constexpr Mat2<T> operator-(Mat2<T> lhs, const T scalar);
 template<typename T>
-inline Mat2<T> operator*(Mat2<T> lhs, const T scalar);
+constexpr Mat2<T> operator*(Mat2<T> lhs, const T scalar);
 template<typename T>
-inline Mat2<T> operator/(Mat2<T> lhs, const T scalar);
+constexpr Mat2<T> operator/(Mat2<T> lhs, const T scalar);
 
 template<typename T>
-inline Mat2<T> operator+(const T scalar, Mat2<T> rhs);
+constexpr Mat2<T> operator+(const T scalar, Mat2<T> rhs);
 template<typename T>
-inline Mat2<T> operator-(const T scalar, Mat2<T> rhs);
+constexpr Mat2<T> operator-(const T scalar, Mat2<T> rhs);
 template<typename T>
-inline Mat2<T> operator*(const T scalar, Mat2<T> rhs);
+constexpr Mat2<T> operator*(const T scalar, Mat2<T> rhs);
 template<typename T>
-inline Mat2<T> operator/(const T scalar, Mat2<T> rhs);
+constexpr Mat2<T> operator/(const T scalar, Mat2<T> rhs);
 
 /// Unary operators.
 template<typename T>
-inline Mat2<T> operator+(Mat2<T> lhs);
+constexpr Mat2<T> operator+(Mat2<T> lhs);
 template<typename T>
-inline Mat2<T> operator-(Mat2<T> lhs);
+constexpr Mat2<T> operator-(Mat2<T> lhs);
 
 /// Increment operators.
 template<typename T>
-inline Mat2<T> &operator++(Mat2<T> &lhs);
+constexpr Mat2<T> &operator++(Mat2<T> &lhs);
 template<typename T>
-inline Mat2<T> &operator--(Mat2<T> &lhs);
+constexpr Mat2<T> &operator--(Mat2<T> &lhs);
 template<typename T>
-inline Mat2<T> operator++(Mat2<T> &lhs, int);
+constexpr Mat2<T> operator++(Mat2<T> &lhs, int);
 template<typename T>
-inline Mat2<T> operator--(Mat2<T> &lhs, int);
+constexpr Mat2<T> operator--(Mat2<T> &lhs, int);
 
 /// ---- Mat3 declarations ----------------------------------------------------
 /// Compound assignment operators matrix operators.
 ///
 template<typename T>
-inline Mat3<T> &operator+=(Mat3<T> &lhs, const Mat3<T> &rhs);
+constexpr Mat3<T> &operator+=(Mat3<T> &lhs, const Mat3<T> &rhs);
 template<typename T>
-inline Mat3<T> &operator-=(Mat3<T> &lhs, const Mat3<T> &rhs);
+constexpr Mat3<T> &operator-=(Mat3<T> &lhs, const Mat3<T> &rhs);
 template<typename T>
-inline Mat3<T> &operator*=(Mat3<T> &lhs, const Mat3<T> &rhs);
+constexpr Mat3<T> &operator*=(Mat3<T> &lhs, const Mat3<T> &rhs);
 template<typename T>
-inline Mat3<T> &operator/=(Mat3<T> &lhs, const Mat3<T> &rhs);
+constexpr Mat3<T> &operator/=(Mat3<T> &lhs, const Mat3<T> &rhs);
 
 template<typename T>
-inline Mat3<T> &operator+=(Mat3<T> &lhs, const T scalar);
+constexpr Mat3<T> &operator+=(Mat3<T> &lhs, const T scalar);
 template<typename T>
-inline Mat3<T> &operator-=(Mat3<T> &lhs, const T scalar);
+constexpr Mat3<T> &operator-=(Mat3<T> &lhs, const T scalar);
 template<typename T>
-inline Mat3<T> &operator*=(Mat3<T> &lhs, const T scalar);
+constexpr Mat3<T> &operator*=(Mat3<T> &lhs, const T scalar);
 template<typename T>
-inline Mat3<T> &operator/=(Mat3<T> &lhs, const T scalar);
+constexpr Mat3<T> &operator/=(Mat3<T> &lhs, const T scalar);
 
 /// Arithmetic operators.
 template<typename T>
-inline Mat3<T> operator+(Mat3<T> lhs, const Mat3<T> &rhs);
+constexpr Mat3<T> operator+(Mat3<T> lhs, const Mat3<T> &rhs);
 template<typename T>
-inline Mat3<T> operator-(Mat3<T> lhs, const Mat3<T> &rhs);
+constexpr Mat3<T> operator-(Mat3<T> lhs, const Mat3<T> &rhs);
 template<typename T>
-inline Mat3<T> operator*(Mat3<T> lhs, const Mat3<T> &rhs);
+constexpr Mat3<T> operator*(Mat3<T> lhs, const Mat3<T> &rhs);
 template<typename T>
-inline Mat3<T> operator/(Mat3<T> lhs, const Mat3<T> &rhs);
+constexpr Mat3<T> operator/(Mat3<T> lhs, const Mat3<T> &rhs);
 
 template<typename T>
-inline Mat3<T> operator+(Mat3<T> lhs, const T scalar);
+constexpr Mat3<T> operator+(Mat3<T> lhs, const T scalar);
 template<typename T>
-inline Mat3<T> operator-(Mat3<T> lhs, const T scalar);
+constexpr Mat3<T> operator-(Mat3<T> lhs, const T scalar);
 template<typename T>
-inline Mat3<T> operator*(Mat3<T> lhs, const T scalar);
+constexpr Mat3<T> operator*(Mat3<T> lhs, const T scalar);
 template<typename T>
-inline Mat3<T> operator/(Mat3<T> lhs, const T scalar);
+constexpr Mat3<T> operator/(Mat3<T> lhs, const T scalar);
 
 template<typename T>
-inline Mat3<T> operator+(const T scalar, Mat3<T> rhs);
+constexpr Mat3<T> operator+(const T scalar, Mat3<T> rhs);
 template<typename T>
-inline Mat3<T> operator-(const T scalar, Mat3<T> rhs);
+constexpr Mat3<T> operator-(const T scalar, Mat3<T> rhs);
 template<typename T>
-inline Mat3<T> operator*(const T scalar, Mat3<T> rhs);
+constexpr Mat3<T> operator*(const T scalar, Mat3<T> rhs);
 template<typename T>
-inline Mat3<T> operator/(const T scalar, Mat3<T> rhs);
+constexpr Mat3<T> operator/(const T scalar, Mat3<T> rhs);
 
 /// Unary operators.
 template<typename T>
-inline Mat3<T> operator+(Mat3<T> lhs);
+constexpr Mat3<T> operator+(Mat3<T> lhs);
 template<typename T>
-inline Mat3<T> operator-(Mat3<T> lhs);
+constexpr Mat3<T> operator-(Mat3<T> lhs);
 
 /// Increment operators.
 template<typename T>
-inline Mat3<T> &operator++(Mat3<T> &lhs);
+constexpr Mat3<T> &operator++(Mat3<T> &lhs);
 template<typename T>
-inline Mat3<T> &operator--(Mat3<T> &lhs);
+constexpr Mat3<T> &operator--(Mat3<T> &lhs);
 template<typename T>
-inline Mat3<T> operator++(Mat3<T> &lhs, int);
+constexpr Mat3<T> operator++(Mat3<T> &lhs, int);
 template<typename T>
-inline Mat3<T> operator--(Mat3<T> &lhs, int);
+constexpr Mat3<T> operator--(Mat3<T> &lhs, int);
 
 /// ---- Mat4 declarations ----------------------------------------------------
 /// Compound assignment operators matrix operators.
 ///
 template<typename T>
-inline Mat4<T> &operator+=(Mat4<T> &lhs, const Mat4<T> &rhs);
+constexpr Mat4<T> &operator+=(Mat4<T> &lhs, const Mat4<T> &rhs);
 template<typename T>
-inline Mat4<T> &operator-=(Mat4<T> &lhs, const Mat4<T> &rhs);
+constexpr Mat4<T> &operator-=(Mat4<T> &lhs, const Mat4<T> &rhs);
 template<typename T>
-inline Mat4<T> &operator*=(Mat4<T> &lhs, const Mat4<T> &rhs);
+constexpr Mat4<T> &operator*=(Mat4<T> &lhs, const Mat4<T> &rhs);
 template<typename T>
-inline Mat4<T> &operator/=(Mat4<T> &lhs, const Mat4<T> &rhs);
+constexpr Mat4<T> &operator/=(Mat4<T> &lhs, const Mat4<T> &rhs);
 
 template<typename T>
-inline Mat4<T> &operator+=(Mat4<T> &lhs, const T scalar);
+constexpr Mat4<T> &operator+=(Mat4<T> &lhs, const T scalar);
 template<typename T>
-inline Mat4<T> &operator-=(Mat4<T> &lhs, const T scalar);
+constexpr Mat4<T> &operator-=(Mat4<T> &lhs, const T scalar);
 template<typename T>
-inline Mat4<T> &operator*=(Mat4<T> &lhs, const T scalar);
+constexpr Mat4<T> &operator*=(Mat4<T> &lhs, const T scalar);
 template<typename T>
-inline Mat4<T> &operator/=(Mat4<T> &lhs, const T scalar);
+constexpr Mat4<T> &operator/=(Mat4<T> &lhs, const T scalar);
 
 /// Arithmetic operators.
 template<typename T>
-inline Mat4<T> operator+(Mat4<T> lhs, const Mat4<T> &rhs);
+constexpr Mat4<T> operator+(Mat4<T> lhs, const Mat4<T> &rhs);
 template<typename T>
-inline Mat4<T> operator-(Mat4<T> lhs, const Mat4<T> &rhs);
+constexpr Mat4<T> operator-(Mat4<T> lhs, const Mat4<T> &rhs);
 template<typename T>
-inline Mat4<T> operator*(Mat4<T> lhs, const Mat4<T> &rhs);
+constexpr Mat4<T> operator*(Mat4<T> lhs, const Mat4<T> &rhs);
 template<typename T>
-inline Mat4<T> operator/(Mat4<T> lhs, const Mat4<T> &rhs);
+constexpr Mat4<T> operator/(Mat4<T> lhs, const Mat4<T> &rhs);
 
 template<typename T>
-inline Mat4<T> operator+(Mat4<T> lhs, const T scalar);
+constexpr Mat4<T> operator+(Mat4<T> lhs, const T scalar);
 template<typename T>
-inline Mat4<T> operator-(Mat4<T> lhs, const T scalar);
+constexpr Mat4<T> operator-(Mat4<T> lhs, const T scalar);
 template<typename T>
-inline Mat4<T> operator*(Mat4<T> lhs, const T scalar);
+constexpr Mat4<T> operator*(Mat4<T> lhs, const T scalar);
 template<typename T>
-inline Mat4<T> operator/(Mat4<T> lhs, const T scalar);
+constexpr Mat4<T> operator/(Mat4<T> lhs, const T scalar);
 
 template<typename T>
-inline Mat4<T> operator+(const T scalar, Mat4<T> rhs);
+constexpr Mat4<T> operator+(const T scalar, Mat4<T> rhs);
 template<typename T>
-inline Mat4<T> operator-(const T scalar, Mat4<T> rhs);
+constexpr Mat4<T> operator-(const T scalar, Mat4<T> rhs);
 template<typename T>
-inline Mat4<T> operator*(const T scalar, Mat4<T> rhs);
+constexpr Mat4<T> operator*(const T scalar, Mat4<T> rhs);
 template<typename T>
-inline Mat4<T> operator/(const T scalar, Mat4<T> rhs);
+constexpr Mat4<T> operator/(const T scalar, Mat4<T> rhs);
 
 /// Unary operators.
 template<typename T>
-inline Mat4<T> operator+(Mat4<T> lhs);
+constexpr Mat4<T> operator+(Mat4<T> lhs);
 template<typename T>
-inline Mat4<T> operator-(Mat4<T> lhs);
+constexpr Mat4<T> operator-(Mat4<T> lhs);
 
 /// Increment operators.
 template<typename T>
-inline Mat4<T> &operator++(Mat4<T> &lhs);
+constexpr Mat4<T> &operator++(Mat4<T> &lhs);
 template<typename T>
-inline Mat4<T> &operator--(Mat4<T> &lhs);
+constexpr Mat4<T> &operator--(Mat4<T> &lhs);
 template<typename T>
-inline Mat4<T> operator++(Mat4<T> &lhs, int);
+constexpr Mat4<T> operator++(Mat4<T> &lhs, int);
 template<typename T>
-inline Mat4<T> operator--(Mat4<T> &lhs, int);
+constexpr Mat4<T> operator--(Mat4<T> &lhs, int);
 
 /// ---- Mat2 implementation --------------------------------------------------
 /// Compound assignment operators vector operators.
 ///
 template<typename T>
-inline Mat2<T> &operator+=(Mat2<T> &lhs, const Mat2<T> &rhs)
+constexpr Mat2<T> &operator+=(Mat2<T> &lhs, const Mat2<T> &rhs)
 {
-    lhs.s0 += rhs.s0;
-    lhs.s1 += rhs.s1;
-    lhs.s2 += rhs.s2;
-    lhs.s3 += rhs.s3;
-    return lhs;
+    return Detail::ScalarAdd(lhs, rhs);
 }
 
 template<typename T>
-inline Mat2<T> &operator-=(Mat2<T> &lhs, const Mat2<T> &rhs)
+constexpr Mat2<T> &operator-=(Mat2<T> &lhs, const Mat2<T> &rhs)
 {
-    lhs.s0 -= rhs.s0;
-    lhs.s1 -= rhs.s1;
-    lhs.s2 -= rhs.s2;
-    lhs.s3 -= rhs.s3;
-    return lhs;
+    return Detail::ScalarSub(lhs, rhs);
 }
 
 template<typename T>
-inline Mat2<T> &operator*=(Mat2<T> &lhs, const Mat2<T> &rhs)
+constexpr Mat2<T> &operator*=(Mat2<T> &lhs, const Mat2<T> &rhs)
 {
-    lhs.s0 *= rhs.s0;
-    lhs.s1 *= rhs.s1;
-    lhs.s2 *= rhs.s2;
-    lhs.s3 *= rhs.s3;
-    return lhs;
+    return Detail::ScalarMul(lhs, rhs);
 }
 
 template<typename T>
-inline Mat2<T> &operator/=(Mat2<T> &lhs, const Mat2<T> &rhs)
+constexpr Mat2<T> &operator/=(Mat2<T> &lhs, const Mat2<T> &rhs)
 {
-    lhs.s0 /= rhs.s0;
-    lhs.s1 /= rhs.s1;
-    lhs.s2 /= rhs.s2;
-    lhs.s3 /= rhs.s3;
-    return lhs;
+    return Detail::ScalarDiv(lhs, rhs);
 }
 
 template<typename T>
-inline Mat2<T> &operator+=(Mat2<T> &lhs, const T scalar)
+constexpr Mat2<T> &operator+=(Mat2<T> &lhs, const T scalar)
 {
-    lhs.s0 += scalar;
-    lhs.s1 += scalar;
-    lhs.s2 += scalar;
-    lhs.s3 += scalar;
-    return lhs;
+    return Detail::ScalarAdd(lhs, scalar);
 }
 
 template<typename T>
-inline Mat2<T> &operator-=(Mat2<T> &lhs, const T scalar)
+constexpr Mat2<T> &operator-=(Mat2<T> &lhs, const T scalar)
 {
-    lhs.s0 -= scalar;
-    lhs.s1 -= scalar;
-    lhs.s2 -= scalar;
-    lhs.s3 -= scalar;
-    return lhs;
+    return Detail::ScalarSub(lhs, scalar);
 }
 
 template<typename T>
-inline Mat2<T> &operator*=(Mat2<T> &lhs, const T scalar)
+constexpr Mat2<T> &operator*=(Mat2<T> &lhs, const T scalar)
 {
-    lhs.s0 *= scalar;
-    lhs.s1 *= scalar;
-    lhs.s2 *= scalar;
-    lhs.s3 *= scalar;
-    return lhs;
+    return Detail::ScalarMul(lhs, scalar);
 }
 
 template<typename T>
-inline Mat2<T> &operator/=(Mat2<T> &lhs, const T scalar)
+constexpr Mat2<T> &operator/=(Mat2<T> &lhs, const T scalar)
 {
-    lhs.s0 /= scalar;
-    lhs.s1 /= scalar;
-    lhs.s2 /= scalar;
-    lhs.s3 /= scalar;
-    return lhs;
+    return Detail::ScalarDiv(lhs, scalar);
 }
 
 ///
 /// Arithmetic operators.
 ///
 template<typename T>
-inline Mat2<T> operator+(Mat2<T> lhs, const Mat2<T> &rhs) { return lhs += rhs; }
+constexpr Mat2<T> operator+(Mat2<T> lhs, const Mat2<T> &rhs)
+{
+    return lhs += rhs;
+}
+
 template<typename T>
-inline Mat2<T> operator-(Mat2<T> lhs, const Mat2<T> &rhs) { return lhs -= rhs; }
+constexpr Mat2<T> operator-(Mat2<T> lhs, const Mat2<T> &rhs)
+{
+    return lhs -= rhs;
+}
+
 template<typename T>
-inline Mat2<T> operator*(Mat2<T> lhs, const Mat2<T> &rhs) { return lhs *= rhs; }
+constexpr Mat2<T> operator*(Mat2<T> lhs, const Mat2<T> &rhs)
+{
+    return lhs *= rhs;
+}
+
 template<typename T>
-inline Mat2<T> operator/(Mat2<T> lhs, const Mat2<T> &rhs) { return lhs /= rhs; }
+constexpr Mat2<T> operator/(Mat2<T> lhs, const Mat2<T> &rhs)
+{
+    return lhs /= rhs;
+}
 
 template<typename T>
-inline Mat2<T> operator+(Mat2<T> lhs, const T scalar) { return lhs += scalar; }
+constexpr Mat2<T> operator+(Mat2<T> lhs, const T scalar)
+{
+    return lhs += scalar;
+}
+
 template<typename T>
-inline Mat2<T> operator-(Mat2<T> lhs, const T scalar) { return lhs -= scalar; }
+constexpr Mat2<T> operator-(Mat2<T> lhs, const T scalar)
+{
+    return lhs -= scalar;
+}
+
 template<typename T>
-inline Mat2<T> operator*(Mat2<T> lhs, const T scalar) { return lhs *= scalar; }
+constexpr Mat2<T> operator*(Mat2<T> lhs, const T scalar)
+{
+    return lhs *= scalar;
+}
+
 template<typename T>
-inline Mat2<T> operator/(Mat2<T> lhs, const T scalar) { return lhs /= scalar; }
+constexpr Mat2<T> operator/(Mat2<T> lhs, const T scalar)
+{
+    return lhs /= scalar;
+}
 
 template<typename T>
-inline Mat2<T> operator+(const T scalar, Mat2<T> rhs) { return rhs += scalar; }
+constexpr Mat2<T> operator+(const T scalar, Mat2<T> rhs)
+{
+    return rhs += scalar;
+}
+
 template<typename T>
-inline Mat2<T> operator-(const T scalar, Mat2<T> rhs) {
-    Mat2<T> lhs = -rhs;
-    return lhs += scalar;
+constexpr Mat2<T> operator-(const T scalar, Mat2<T> rhs)
+{
+    return Detail::ScalarRsub(scalar, rhs);
 }
+
 template<typename T>
-inline Mat2<T> operator*(const T scalar, Mat2<T> rhs) { return rhs *= scalar; }
+constexpr Mat2<T> operator*(const T scalar, Mat2<T> rhs)
+{
+    return rhs *= scalar;
+}
+
 template<typename T>
-inline Mat2<T> operator/(const T scalar, Mat2<T> rhs) {
-    return {
-        scalar / rhs.xx, scalar / rhs.xy,
-        scalar / rhs.yx, scalar / rhs.yy
-    };
+constexpr Mat2<T> operator/(const T scalar, Mat2<T> rhs)
+{
+    return Detail::ScalarRdiv(scalar, rhs);
 }
 
 ///
 /// Unary operators.
 ///
 template<typename T>
-inline Mat2<T> operator+(Mat2<T> lhs) { return lhs; }
+constexpr Mat2<T> operator+(Mat2<T> lhs) { return lhs; }
 
 template<typename T>
-inline Mat2<T> operator-(Mat2<T> lhs) { return lhs *= (T) -1; }
+constexpr Mat2<T> operator-(Mat2<T> lhs) { return lhs *= (T) -1; }
 
 ///
 /// Increment operators.
 ///
 template<typename T>
-inline Mat2<T> &operator++(Mat2<T> &lhs) { return lhs += (T) 1; }
+constexpr Mat2<T> &operator++(Mat2<T> &lhs) { return lhs += (T) 1; }
 
 template<typename T>
-inline Mat2<T> &operator--(Mat2<T> &lhs) { return lhs -= (T) 1; }
+constexpr Mat2<T> &operator--(Mat2<T> &lhs) { return lhs -= (T) 1; }
 
 template<typename T>
-inline Mat2<T> operator++(Mat2<T> &lhs, int)
+constexpr Mat2<T> operator++(Mat2<T> &lhs, int)
 {
     Mat2<T> result = lhs;
     ++lhs;
@@ -508,7 +517,7 @@ inline Mat2<T> operator++(Mat2<T> &lhs, int)
 }
 
 template<typename T>
-inline Mat2<T> operator--(Mat2<T> &lhs, int)
+constexpr Mat2<T> operator--(Mat2<T> &lhs, int)
 {
     Mat2<T> result = lhs;
     --lhs;
@@ -519,184 +528,148 @@ inline Mat2<T> operator--(Mat2<T> &lhs, int)
 /// Compound assignment operators vector operators.
 ///
 template<typename T>
-inline Mat3<T> &operator+=(Mat3<T> &lhs, const Mat3<T> &rhs)
+constexpr Mat3<T> &operator+=(Mat3<T> &lhs, const Mat3<T> &rhs)
 {
-    lhs.s0 += rhs.s0;
-    lhs.s1 += rhs.s1;
-    lhs.s2 += rhs.s2;
-    lhs.s3 += rhs.s3;
-    lhs.s4 += rhs.s4;
-    lhs.s5 += rhs.s5;
-    lhs.s6 += rhs.s6;
-    lhs.s7 += rhs.s7;
-    lhs.s8 += rhs.s8;
-    return lhs;
+    return Detail::ScalarAdd(lhs, rhs);
 }
 
 template<typename T>
-inline Mat3<T> &operator-=(Mat3<T> &lhs, const Mat3<T> &rhs)
+constexpr Mat3<T> &operator-=(Mat3<T> &lhs, const Mat3<T> &rhs)
 {
-    lhs.s0 -= rhs.s0;
-    lhs.s1 -= rhs.s1;
-    lhs.s2 -= rhs.s2;
-    lhs.s3 -= rhs.s3;
-    lhs.s4 -= rhs.s4;
-    lhs.s5 -= rhs.s5;
-    lhs.s6 -= rhs.s6;
-    lhs.s7 -= rhs.s7;
-    lhs.s8 -= rhs.s8;
-    return lhs;
+    return Detail::ScalarSub(lhs, rhs);
 }
 
 template<typename T>
-inline Mat3<T> &operator*=(Mat3<T> &lhs, const Mat3<T> &rhs)
+constexpr Mat3<T> &operator*=(Mat3<T> &lhs, const Mat3<T> &rhs)
 {
-    lhs.s0 *= rhs.s0;
-    lhs.s1 *= rhs.s1;
-    lhs.s2 *= rhs.s2;
-    lhs.s3 *= rhs.s3;
-    lhs.s4 *= rhs.s4;
-    lhs.s5 *= rhs.s5;
-    lhs.s6 *= rhs.s6;
-    lhs.s7 *= rhs.s7;
-    lhs.s8 *= rhs.s8;
-    return lhs;
+    return Detail::ScalarMul(lhs, rhs);
 }
 
 template<typename T>
-inline Mat3<T> &operator/=(Mat3<T> &lhs, const Mat3<T> &rhs)
+constexpr Mat3<T> &operator/=(Mat3<T> &lhs, const Mat3<T> &rhs)
 {
-    lhs.s0 /= rhs.s0;
-    lhs.s1 /= rhs.s1;
-    lhs.s2 /= rhs.s2;
-    lhs.s3 /= rhs.s3;
-    lhs.s4 /= rhs.s4;
-    lhs.s5 /= rhs.s5;
-    lhs.s6 /= rhs.s6;
-    lhs.s7 /= rhs.s7;
-    lhs.s8 /= rhs.s8;
-    return lhs;
+    return Detail::ScalarDiv(lhs, rhs);
 }
 
 template<typename T>
-inline Mat3<T> &operator+=(Mat3<T> &lhs, const T scalar)
+constexpr Mat3<T> &operator+=(Mat3<T> &lhs, const T scalar)
 {
-    lhs.s0 += scalar;
-    lhs.s1 += scalar;
-    lhs.s2 += scalar;
-    lhs.s3 += scalar;
-    lhs.s4 += scalar;
-    lhs.s5 += scalar;
-    lhs.s6 += scalar;
-    lhs.s7 += scalar;
-    lhs.s8 += scalar;
-    return lhs;
+    return Detail::ScalarAdd(lhs, scalar);
 }
 
 template<typename T>
-inline Mat3<T> &operator-=(Mat3<T> &lhs, const T scalar)
+constexpr Mat3<T> &operator-=(Mat3<T> &lhs, const T scalar)
 {
-    lhs.s0 -= scalar;
-    lhs.s1 -= scalar;
-    lhs.s2 -= scalar;
-    lhs.s3 -= scalar;
-    lhs.s4 -= scalar;
-    lhs.s5 -= scalar;
-    lhs.s6 -= scalar;
-    lhs.s7 -= scalar;
-    lhs.s8 -= scalar;
-    return lhs;
+    return Detail::ScalarSub(lhs, scalar);
 }
 
 template<typename T>
-inline Mat3<T> &operator*=(Mat3<T> &lhs, const T scalar)
+constexpr Mat3<T> &operator*=(Mat3<T> &lhs, const T scalar)
 {
-    lhs.s0 *= scalar;
-    lhs.s1 *= scalar;
-    lhs.s2 *= scalar;
-    lhs.s3 *= scalar;
-    lhs.s4 *= scalar;
-    lhs.s5 *= scalar;
-    lhs.s6 *= scalar;
-    lhs.s7 *= scalar;
-    lhs.s8 *= scalar;
-    return lhs;
+    return Detail::ScalarMul(lhs, scalar);
 }
 
 template<typename T>
-inline Mat3<T> &operator/=(Mat3<T> &lhs, const T scalar)
+constexpr Mat3<T> &operator/=(Mat3<T> &lhs, const T scalar)
 {
-    lhs.s0 /= scalar;
-    lhs.s1 /= scalar;
-    lhs.s2 /= scalar;
-    lhs.s3 /= scalar;
-    lhs.s4 /= scalar;
-    lhs.s5 /= scalar;
-    lhs.s6 /= scalar;
-    lhs.s7 /= scalar;
-    lhs.s8 /= scalar;
-    return lhs;
+    return Detail::ScalarDiv(lhs, scalar);
 }
 
 ///
 /// Arithmetic operators.
 ///
 template<typename T>
-inline Mat3<T> operator+(Mat3<T> lhs, const Mat3<T> &rhs) { return lhs += rhs; }
+constexpr Mat3<T> operator+(Mat3<T> lhs, const Mat3<T> &rhs)
+{
+    return lhs += rhs;
+}
+
 template<typename T>
-inline Mat3<T> operator-(Mat3<T> lhs, const Mat3<T> &rhs) { return lhs -= rhs; }
+constexpr Mat3<T> operator-(Mat3<T> lhs, const Mat3<T> &rhs)
+{
+    return lhs -= rhs;
+}
+
 template<typename T>
-inline Mat3<T> operator*(Mat3<T> lhs, const Mat3<T> &rhs) { return lhs *= rhs; }
+constexpr Mat3<T> operator*(Mat3<T> lhs, const Mat3<T> &rhs)
+{
+    return lhs *= rhs;
+}
+
 template<typename T>
-inline Mat3<T> operator/(Mat3<T> lhs, const Mat3<T> &rhs) { return lhs /= rhs; }
+constexpr Mat3<T> operator/(Mat3<T> lhs, const Mat3<T> &rhs)
+{
+    return lhs /= rhs;
+}
 
 template<typename T>
-inline Mat3<T> operator+(Mat3<T> lhs, const T scalar) { return lhs += scalar; }
+constexpr Mat3<T> operator+(Mat3<T> lhs, const T scalar)
+{
+    return lhs += scalar;
+}
+
 template<typename T>
-inline Mat3<T> operator-(Mat3<T> lhs, const T scalar) { return lhs -= scalar; }
+constexpr Mat3<T> operator-(Mat3<T> lhs, const T scalar)
+{
+    return lhs -= scalar;
+}
+
 template<typename T>
-inline Mat3<T> operator*(Mat3<T> lhs, const T scalar) { return lhs *= scalar; }
+constexpr Mat3<T> operator*(Mat3<T> lhs, const T scalar)
+{
+    return lhs *= scalar;
+}
+
 template<typename T>
-inline Mat3<T> operator/(Mat3<T> lhs, const T scalar) { return lhs /= scalar; }
+constexpr Mat3<T> operator/(Mat3<T> lhs, const T scalar)
+{
+    return lhs /= scalar;
+}
 
 template<typename T>
-inline Mat3<T> operator+(const T scalar, Mat3<T> rhs) { return rhs += scalar; }
+constexpr Mat3<T> operator+(const T scalar, Mat3<T> rhs)
+{
+    return rhs += scalar;
+}
+
 template<typename T>
-inline Mat3<T> operator-(const T scalar, Mat3<T> rhs) {
-    Mat3<T> lhs = -rhs;
-    return lhs += scalar;
+constexpr Mat3<T> operator-(const T scalar, Mat3<T> rhs)
+{
+    return Detail::ScalarRsub(scalar, rhs);
 }
+
 template<typename T>
-inline Mat3<T> operator*(const T scalar, Mat3<T> rhs) { return rhs *= scalar; }
+constexpr Mat3<T> operator*(const T scalar, Mat3<T> rhs)
+{
+    return rhs *= scalar;
+}
+
 template<typename T>
-inline Mat3<T> operator/(const T scalar, Mat3<T> rhs) {
-    return {
-        scalar / rhs.xx, scalar / rhs.xy, scalar / rhs.xz,
-        scalar / rhs.yx, scalar / rhs.yy, scalar / rhs.yz,
-        scalar / rhs.zx, scalar / rhs.zy, scalar / rhs.zz
-    };
+constexpr Mat3<T> operator/(const T scalar, Mat3<T> rhs)
+{
+    return Detail::ScalarRdiv(scalar, rhs);
 }
 
 ///
 /// Unary operators.
 ///
 template<typename T>
-inline Mat3<T> operator+(Mat3<T> lhs) { return lhs; }
+constexpr Mat3<T> operator+(Mat3<T> lhs) { return lhs; }
 
 template<typename T>
-inline Mat3<T> operator-(Mat3<T> lhs) { return lhs *= (T) -1; }
+constexpr Mat3<T> operator-(Mat3<T> lhs) { return lhs *= (T) -1; }
 
 ///
 /// Increment operators.
 ///
 template<typename T>
-inline Mat3<T> &operator++(Mat3<T> &lhs) { return lhs += (T) 1; }
+constexpr Mat3<T> &operator++(Mat3<T> &lhs) { return lhs += (T) 1; }
 
 template<typename T>
-inline Mat3<T> &operator--(Mat3<T> &lhs) { return lhs -= (T) 1; }
+constexpr Mat3<T> &operator--(Mat3<T> &lhs) { return lhs -= (T) 1; }
 
 template<typename T>
-inline Mat3<T> operator++(Mat3<T> &lhs, int)
+constexpr Mat3<T> operator++(Mat3<T> &lhs, int)
 {
     Mat3<T> result = lhs;
     ++lhs;
@@ -704,7 +677,7 @@ inline Mat3<T> operator++(Mat3<T> &lhs, int)
 }
 
 template<typename T>
-inline Mat3<T> operator--(Mat3<T> &lhs, int)
+constexpr Mat3<T> operator--(Mat3<T> &lhs, int)
 {
     Mat3<T> result = lhs;
     --lhs;
@@ -715,241 +688,148 @@ inline Mat3<T> operator--(Mat3<T> &lhs, int)
 /// Compound assignment operators vector operators.
 ///
 template<typename T>
-inline Mat4<T> &operator+=(Mat4<T> &lhs, const Mat4<T> &rhs)
-{
-    lhs.s0  += rhs.s0;
-    lhs.s1  += rhs.s1;
-    lhs.s2  += rhs.s2;
-    lhs.s3  += rhs.s3;
-    lhs.s4  += rhs.s4;
-    lhs.s5  += rhs.s5;
-    lhs.s6  += rhs.s6;
-    lhs.s7  += rhs.s7;
-    lhs.s8  += rhs.s8;
-    lhs.s9  += rhs.s9;
-    lhs.s10 += rhs.s10;
-    lhs.s11 += rhs.s11;
-    lhs.s12 += rhs.s12;
-    lhs.s13 += rhs.s13;
-    lhs.s14 += rhs.s14;
-    lhs.s15 += rhs.s15;
-    return lhs;
-}
-
-template<typename T>
-inline Mat4<T> &operator-=(Mat4<T> &lhs, const Mat4<T> &rhs)
-{
-    lhs.s0  -= rhs.s0;
-    lhs.s1  -= rhs.s1;
-    lhs.s2  -= rhs.s2;
-    lhs.s3  -= rhs.s3;
-    lhs.s4  -= rhs.s4;
-    lhs.s5  -= rhs.s5;
-    lhs.s6  -= rhs.s6;
-    lhs.s7  -= rhs.s7;
-    lhs.s8  -= rhs.s8;
-    lhs.s9  -= rhs.s9;
-    lhs.s10 -= rhs.s10;
-    lhs.s11 -= rhs.s11;
-    lhs.s12 -= rhs.s12;
-    lhs.s13 -= rhs.s13;
-    lhs.s14 -= rhs.s14;
-    lhs.s15 -= rhs.s15;
-    return lhs;
-}
-
-template<typename T>
-inline Mat4<T> &operator*=(Mat4<T> &lhs, const Mat4<T> &rhs)
-{
-    lhs.s0  *= rhs.s0;
-    lhs.s1  *= rhs.s1;
-    lhs.s2  *= rhs.s2;
-    lhs.s3  *= rhs.s3;
-    lhs.s4  *= rhs.s4;
-    lhs.s5  *= rhs.s5;
-    lhs.s6  *= rhs.s6;
-    lhs.s7  *= rhs.s7;
-    lhs.s8  *= rhs.s8;
-    lhs.s9  *= rhs.s9;
-    lhs.s10 *= rhs.s10;
-    lhs.s11 *= rhs.s11;
-    lhs.s12 *= rhs.s12;
-    lhs.s13 *= rhs.s13;
-    lhs.s14 *= rhs.s14;
-    lhs.s15 *= rhs.s15;
-    return lhs;
-}
-
-template<typename T>
-inline Mat4<T> &operator/=(Mat4<T> &lhs, const Mat4<T> &rhs)
-{
-    lhs.s0  /= rhs.s0;
-    lhs.s1  /= rhs.s1;
-    lhs.s2  /= rhs.s2;
-    lhs.s3  /= rhs.s3;
-    lhs.s4  /= rhs.s4;
-    lhs.s5  /= rhs.s5;
-    lhs.s6  /= rhs.s6;
-    lhs.s7  /= rhs.s7;
-    lhs.s8  /= rhs.s8;
-    lhs.s9  /= rhs.s9;
-    lhs.s10 /= rhs.s10;
-    lhs.s11 /= rhs.s11;
-    lhs.s12 /= rhs.s12;
-    lhs.s13 /= rhs.s13;
-    lhs.s14 /= rhs.s14;
-    lhs.s15 /= rhs.s15;
-    return lhs;
-}
-
-template<typename T>
-inline Mat4<T> &operator+=(Mat4<T> &lhs, const T scalar)
-{
-    lhs.s0  += scalar;
-    lhs.s1  += scalar;
-    lhs.s2  += scalar;
-    lhs.s3  += scalar;
-    lhs.s4  += scalar;
-    lhs.s5  += scalar;
-    lhs.s6  += scalar;
-    lhs.s7  += scalar;
-    lhs.s8  += scalar;
-    lhs.s9  += scalar;
-    lhs.s10 += scalar;
-    lhs.s11 += scalar;
-    lhs.s12 += scalar;
-    lhs.s13 += scalar;
-    lhs.s14 += scalar;
-    lhs.s15 += scalar;
-    return lhs;
-}
-
-template<typename T>
-inline Mat4<T> &operator-=(Mat4<T> &lhs, const T scalar)
-{
-    lhs.s0  -= scalar;
-    lhs.s1  -= scalar;
-    lhs.s2  -= scalar;
-    lhs.s3  -= scalar;
-    lhs.s4  -= scalar;
-    lhs.s5  -= scalar;
-    lhs.s6  -= scalar;
-    lhs.s7  -= scalar;
-    lhs.s8  -= scalar;
-    lhs.s9  -= scalar;
-    lhs.s10 -= scalar;
-    lhs.s11 -= scalar;
-    lhs.s12 -= scalar;
-    lhs.s13 -= scalar;
-    lhs.s14 -= scalar;
-    lhs.s15 -= scalar;
-    return lhs;
-}
-
-template<typename T>
-inline Mat4<T> &operator*=(Mat4<T> &lhs, const T scalar)
-{
-    lhs.s0  *= scalar;
-    lhs.s1  *= scalar;
-    lhs.s2  *= scalar;
-    lhs.s3  *= scalar;
-    lhs.s4  *= scalar;
-    lhs.s5  *= scalar;
-    lhs.s6  *= scalar;
-    lhs.s7  *= scalar;
-    lhs.s8  *= scalar;
-    lhs.s9  *= scalar;
-    lhs.s10 *= scalar;
-    lhs.s11 *= scalar;
-    lhs.s12 *= scalar;
-    lhs.s13 *= scalar;
-    lhs.s14 *= scalar;
-    lhs.s15 *= scalar;
-    return lhs;
-}
-
-template<typename T>
-inline Mat4<T> &operator/=(Mat4<T> &lhs, const T scalar)
-{
-    lhs.s0  /= scalar;
-    lhs.s1  /= scalar;
-    lhs.s2  /= scalar;
-    lhs.s3  /= scalar;
-    lhs.s4  /= scalar;
-    lhs.s5  /= scalar;
-    lhs.s6  /= scalar;
-    lhs.s7  /= scalar;
-    lhs.s8  /= scalar;
-    lhs.s9  /= scalar;
-    lhs.s10 /= scalar;
-    lhs.s11 /= scalar;
-    lhs.s12 /= scalar;
-    lhs.s13 /= scalar;
-    lhs.s14 /= scalar;
-    lhs.s15 /= scalar;
-    return lhs;
+constexpr Mat4<T> &operator+=(Mat4<T> &lhs, const Mat4<T> &rhs)
+{
+    return Detail::ScalarAdd(lhs, rhs);
+}
+
+template<typename T>
+constexpr Mat4<T> &operator-=(Mat4<T> &lhs, const Mat4<T> &rhs)
+{
+    return Detail::ScalarSub(lhs, rhs);
+}
+
+template<typename T>
+constexpr Mat4<T> &operator*=(Mat4<T> &lhs, const Mat4<T> &rhs)
+{
+    return Detail::ScalarMul(lhs, rhs);
+}
+
+template<typename T>
+constexpr Mat4<T> &operator/=(Mat4<T> &lhs, const Mat4<T> &rhs)
+{
+    return Detail::ScalarDiv(lhs, rhs);
+}
+
+template<typename T>
+constexpr Mat4<T> &operator+=(Mat4<T> &lhs, const T scalar)
+{
+    return Detail::ScalarAdd(lhs, scalar);
+}
+
+template<typename T>
+constexpr Mat4<T> &operator-=(Mat4<T> &lhs, const T scalar)
+{
+    return Detail::ScalarSub(lhs, scalar);
+}
+
+template<typename T>
+constexpr Mat4<T> &operator*=(Mat4<T> &lhs, const T scalar)
+{
+    return Detail::ScalarMul(lhs, scalar);
+}
+
+template<typename T>
+constexpr Mat4<T> &operator/=(Mat4<T> &lhs, const T scalar)
+{
+    return Detail::ScalarDiv(lhs, scalar);
 }
 
 ///
 /// Arithmetic operators.
 ///
 template<typename T>
-inline Mat4<T> operator+(Mat4<T> lhs, const Mat4<T> &rhs) { return lhs += rhs; }
+constexpr Mat4<T> operator+(Mat4<T> lhs, const Mat4<T> &rhs)
+{
+    return lhs += rhs;
+}
+
 template<typename T>
-inline Mat4<T> operator-(Mat4<T> lhs, const Mat4<T> &rhs) { return lhs -= rhs; }
+constexpr Mat4<T> operator-(Mat4<T> lhs, const Mat4<T> &rhs)
+{
+    return lhs -= rhs;
+}
+
 template<typename T>
-inline Mat4<T> operator*(Mat4<T> lhs, const Mat4<T> &rhs) { return lhs *= rhs; }
+constexpr Mat4<T> operator*(Mat4<T> lhs, const Mat4<T> &rhs)
+{
+    return lhs *= rhs;
+}
+
 template<typename T>
-inline Mat4<T> operator/(Mat4<T> lhs, const Mat4<T> &rhs) { return lhs /= rhs; }
+constexpr Mat4<T> operator/(Mat4<T> lhs, const Mat4<T> &rhs)
+{
+    return lhs /= rhs;
+}
 
 template<typename T>
-inline Mat4<T> operator+(Mat4<T> lhs, const T scalar) { return lhs += scalar; }
+constexpr Mat4<T> operator+(Mat4<T> lhs, const T scalar)
+{
+    return lhs += scalar;
+}
+
 template<typename T>
-inline Mat4<T> operator-(Mat4<T> lhs, const T scalar) { return lhs -= scalar; }
+constexpr Mat4<T> operator-(Mat4<T> lhs, const T scalar)
+{
+    return lhs -= scalar;
+}
+
 template<typename T>
-inline Mat4<T> operator*(Mat4<T> lhs, const T scalar) { return lhs *= scalar; }
+constexpr Mat4<T> operator*(Mat4<T> lhs, const T scalar)
+{
+    return lhs *= scalar;
+}
+
 template<typename T>
-inline Mat4<T> operator/(Mat4<T> lhs, const T scalar) { return lhs /= scalar; }
+constexpr Mat4<T> operator/(Mat4<T> lhs, const T scalar)
+{
+    return lhs /= scalar;
+}
 
 template<typename T>
-inline Mat4<T> operator+(const T scalar, Mat4<T> rhs) { return rhs += scalar; }
+constexpr Mat4<T> operator+(const T scalar, Mat4<T> rhs)
+{
+    return rhs += scalar;
+}
+
 template<typename T>
-inline Mat4<T> operator-(const T scalar, Mat4<T> rhs) {
-    Mat4<T> lhs = -rhs;
-    return lhs += scalar;
+constexpr Mat4<T> operator-(const T scalar, Mat4<T> rhs)
+{
+    return Detail::ScalarRsub(scalar, rhs);
 }
+
 template<typename T>
-inline Mat4<T> operator*(const T scalar, Mat4<T> rhs) { return rhs *= scalar; }
+constexpr Mat4<T> operator*(const T scalar, Mat4<T> rhs)
+{
+    return rhs *= scalar;
+}
+
 template<typename T>
-inline Mat4<T> operator/(const T scalar, Mat4<T> rhs) {
-    return {
-        scalar / rhs.xx, scalar / rhs.xy, scalar / rhs.xz, scalar / rhs.xw,
-        scalar / rhs.yx, scalar / rhs.yy, scalar / rhs.yz, scalar / rhs.yw,
-        scalar / rhs.zx, scalar / rhs.zy, scalar / rhs.zz, scalar / rhs.zw,
-        scalar / rhs.wx, scalar / rhs.wy, scalar / rhs.wz, scalar / rhs.ww
-    };
+constexpr Mat4<T> operator/(const T scalar, Mat4<T> rhs)
+{
+    return Detail::ScalarRdiv(scalar, rhs);
 }
 
 ///
 /// Unary operators.
 ///
 template<typename T>
-inline Mat4<T> operator+(Mat4<T> lhs) { return lhs; }
+constexpr Mat4<T> operator+(Mat4<T> lhs) { return lhs; }
 
 template<typename T>
-inline Mat4<T> operator-(Mat4<T> lhs) { return lhs *= (T) -1; }
+constexpr Mat4<T> operator-(Mat4<T> lhs) { return lhs *= (T) -1; }
 
 ///
 /// Increment operators.
 ///
 template<typename T>
-inline Mat4<T> &operator++(Mat4<T> &lhs) { return lhs += (T) 1; }
+constexpr Mat4<T> &operator++(Mat4<T> &lhs) { return lhs += (T) 1; }
 
 template<typename T>
-inline Mat4<T> &operator--(Mat4<T> &lhs) { return lhs -= (T) 1; }
+constexpr Mat4<T> &operator--(Mat4<T> &lhs) { return lhs -= (T) 1; }
 
 template<typename T>
-inline Mat4<T> operator++(Mat4<T> &lhs, int)
+constexpr Mat4<T> operator++(Mat4<T> &lhs, int)
 {
     Mat4<T> result = lhs;
     ++lhs;
@@ -957,13 +837,14 @@ inline Mat4<T> operator++(Mat4<T> &lhs, int)
 }
 
 template<typename T>
-inline Mat4<T> operator--(Mat4<T> &lhs, int)
+constexpr Mat4<T> operator--(Mat4<T> &lhs, int)
 {
     Mat4<T> result = lhs;
     --lhs;
     return result;
 }
 
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 /// ---- simd implementations ------------------------------------------------
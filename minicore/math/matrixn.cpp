@@ -0,0 +1,651 @@
+//
+// matrixn.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "minicore/base/parallel.h"
+#include "dispatch.h"
+#include "matrixn.h"
+#include "packet.h"
+
+namespace Math {
+
+/// ---- Matrix product blocks ------------------------------------------------
+///
+/// @brief The matrix product is computed over blocks of kGemmBlockCols columns
+/// of c and kGemmDepth rows of b, packed into panels of the kernel tile width,
+/// and blocks of kGemmBlockRows rows of a and c, packed into panels of the
+/// kernel tile height. A packed block of a stays in the second level cache and
+/// a panel of b in the first level cache while the kernel computes a column of
+/// tiles. The row blocks run over the thread pool if it is running and the
+/// product takes at least kGemmParallelMin multiply-adds.
+///
+static const size_t kGemmDepth = 256;
+static const size_t kGemmBlockRows = 96;
+static const size_t kGemmBlockCols = 2048;
+static const size_t kGemmParallelMin = 1 << 18;
+static const size_t kGemvBlockRows = 64;
+static const size_t kGemvParallelMin = 1 << 16;
+static const size_t kFactorBlock = 64;
+
+///
+/// @brief Kernel tile width and dispatched kernel of each element type.
+///
+template<typename T>
+struct GemmTile;
+
+template<>
+struct GemmTile<float> {
+    static const size_t cols = kGemmColsf;
+    static decltype(Kernels::gemmf) Kernel() { return GetKernels().gemmf; }
+};
+
+template<>
+struct GemmTile<double> {
+    static const size_t cols = kGemmColsd;
+    static decltype(Kernels::gemmd) Kernel() { return GetKernels().gemmd; }
+};
+
+///
+/// @brief Operand of a matrix product, with element (i, j) at data[i * rs +
+/// j * cs], so that a transposed matrix is the same view with the strides
+/// swapped.
+///
+template<typename T>
+struct View {
+    const T *data;
+    size_t rs;
+    size_t cs;
+
+    const T &operator()(size_t i, size_t j) const {
+        return data[i * rs + j * cs];
+    }
+};
+
+///
+/// @brief Round up a count to a multiple of the specified size.
+///
+static inline size_t RoundUp(const size_t count, const size_t size)
+{
+    return ((count + size - 1) / size) * size;
+}
+
+///
+/// @brief Run a function over each block, in parallel over the thread pool if
+/// requested, the thread pool is running and the caller is not a pool thread.
+///
+template<typename Fn>
+static void RunBlocks(
+    const size_t num_blocks,
+    const bool parallel,
+    const Fn &fn)
+{
+    auto run = [](size_t block, void *arg) {
+        (*static_cast<const Fn *>(arg))(block);
+    };
+
+    Base::ParallelForIf(run, num_blocks, (void *) &fn, parallel);
+}
+
+///
+/// @brief Pack the rows [i0, i0 + rows) and the columns [p0, p0 + depth) of a,
+/// scaled by alpha, into panels of kGemmRows rows stored column by column.
+/// The rows past the end of the last panel are zero.
+///
+template<typename T>
+static void PackA(
+    const View<T> &a,
+    const T alpha,
+    const size_t i0,
+    const size_t rows,
+    const size_t p0,
+    const size_t depth,
+    T *dst)
+{
+    for (size_t ir = 0; ir < rows; ir += kGemmRows) {
+        T *panel = dst + ir * depth;
+        for (size_t i = 0; i < kGemmRows; ++i) {
+            if (ir + i < rows) {
+                for (size_t p = 0; p < depth; ++p) {
+                    panel[p * kGemmRows + i] = alpha * a(i0 + ir + i, p0 + p);
+                }
+            } else {
+                for (size_t p = 0; p < depth; ++p) {
+                    panel[p * kGemmRows + i] = (T) 0;
+                }
+            }
+        }
+    }
+}
+
+///
+/// @brief Pack the rows [p0, p0 + depth) and the columns [j0, j0 + cols) of b
+/// into panels of the kernel tile width stored row by row. The columns past
+/// the end of the last panel are zero.
+///
+template<typename T>
+static void PackB(
+    const View<T> &b,
+    const size_t p0,
+    const size_t depth,
+    const size_t j0,
+    const size_t cols,
+    T *dst)
+{
+    const size_t nr = GemmTile<T>::cols;
+    for (size_t jr = 0; jr < cols; jr += nr) {
+        T *panel = dst + jr * depth;
+        const size_t n = std::min(nr, cols - jr);
+        for (size_t p = 0; p < depth; ++p) {
+            for (size_t j = 0; j < n; ++j) {
+                panel[p * nr + j] = b(p0 + p, j0 + jr + j);
+            }
+            for (size_t j = n; j < nr; ++j) {
+                panel[p * nr + j] = (T) 0;
+            }
+        }
+    }
+}
+
+///
+/// @brief Compute c = alpha * a * b + beta * c, with a of m x k elements, b of
+/// k x n elements and c of m x n elements, row-major with ldc elements between
+/// rows. The row blocks of c are split evenly over the threads if the product
+/// runs in parallel. Each row block packs its own block of a, and the partial
+/// tiles at the edges of c are computed into a local tile.
+///
+template<typename T>
+static void GemmBlocked(
+    const size_t m,
+    const size_t n,
+    const size_t k,
+    const T alpha,
+    const View<T> &a,
+    const View<T> &b,
+    const T beta,
+    T *c,
+    const size_t ldc)
+{
+    for (size_t i = 0; i < m; ++i) {
+        T *row = c + i * ldc;
+        if (beta == (T) 0) {
+            std::fill(row, row + n, (T) 0);
+        } else if (beta != (T) 1) {
+            for (size_t j = 0; j < n; ++j) {
+                row[j] *= beta;
+            }
+        }
+    }
+    if (m == 0 || n == 0 || k == 0 || alpha == (T) 0) {
+        return;
+    }
+
+    const size_t mr = kGemmRows;
+    const size_t nr = GemmTile<T>::cols;
+    const auto kernel = GemmTile<T>::Kernel();
+
+    const size_t num_threads = Base::ThreadPool::GetNumThreads();
+    const bool parallel = num_threads > 0 && m * n * k >= kGemmParallelMin;
+    size_t mc = kGemmBlockRows;
+    if (parallel) {
+        mc = std::min(mc, RoundUp((m + num_threads - 1) / num_threads, mr));
+    }
+    const size_t num_blocks = (m + mc - 1) / mc;
+    const size_t kc_max = std::min(k, kGemmDepth);
+    const size_t nc_max = std::min(RoundUp(n, nr), kGemmBlockCols);
+
+    std::vector<T, Base::Allocator<T>> packed_a(
+        num_blocks * RoundUp(mc, mr) * kc_max);
+    std::vector<T, Base::Allocator<T>> packed_b(nc_max * kc_max);
+
+    for (size_t jc = 0; jc < n; jc += kGemmBlockCols) {
+        const size_t nc = std::min(kGemmBlockCols, n - jc);
+        for (size_t pc = 0; pc < k; pc += kGemmDepth) {
+            const size_t kc = std::min(kGemmDepth, k - pc);
+            PackB(b, pc, kc, jc, nc, packed_b.data());
+
+            RunBlocks(num_blocks, parallel, [&](size_t block) {
+                const size_t i0 = block * mc;
+                const size_t mb = std::min(mc, m - i0);
+                T *pa = packed_a.data() + block * RoundUp(mc, mr) * kc_max;
+                PackA(a, alpha, i0, mb, pc, kc, pa);
+
+                alignas(64) T tile[kGemmRows * GemmTile<T>::cols];
+                for (size_t jr = 0; jr < nc; jr += nr) {
+                    const size_t nb = std::min(nr, nc - jr);
+                    const T *pb = packed_b.data() + jr * kc;
+                    for (size_t ir = 0; ir < mb; ir += mr) {
+                        const size_t ib = std::min(mr, mb - ir);
+                        T *dst = c + (i0 + ir) * ldc + jc + jr;
+                        if (ib == mr && nb == nr) {
+                            kernel(kc, pa + ir * kc, pb, dst, ldc);
+                            continue;
+                        }
+
+                        std::fill(tile, tile + mr * nr, (T) 0);
+                        kernel(kc, pa + ir * kc, pb, tile, nr);
+                        for (size_t i = 0; i < ib; ++i) {
+                            for (size_t j = 0; j < nb; ++j) {
+                                dst[i * ldc + j] += tile[i * nr + j];
+                            }
+                        }
+                    }
+                }
+            });
+        }
+    }
+}
+
+/// ---- Matrix product kernels -----------------------------------------------
+///
+/// @brief Multiply two matrices, c = alpha * a * b + beta * c.
+///
+template<typename T>
+static void GemmKernel(
+    const T alpha,
+    const MatrixN<T> &a,
+    const MatrixN<T> &b,
+    const T beta,
+    MatrixN<T> &c)
+{
+    if (a.cols != b.rows || c.rows != a.rows || c.cols != b.cols) {
+        throw std::runtime_error("invalid matrix dimensions");
+    }
+
+    View<T> va = {a.data.data(), a.stride, 1};
+    View<T> vb = {b.data.data(), b.stride, 1};
+    GemmBlocked(a.rows, b.cols, a.cols, alpha, va, vb, beta,
+        c.data.data(), c.stride);
+}
+
+///
+/// @brief Multiply a matrix by a vector, y = alpha * a * x + beta * y. Each row
+/// is multiplied by the vector with packet multiply-adds, and the blocks of
+/// rows run over the thread pool if the matrix is large enough.
+///
+template<typename T>
+static void GemvKernel(
+    const T alpha,
+    const MatrixN<T> &a,
+    const T *x,
+    const T beta,
+    T *y)
+{
+    const size_t width = 32 / sizeof(T);
+    using P = Packet<T, 32 / sizeof(T)>;
+
+    const size_t num_blocks = (a.rows + kGemvBlockRows - 1) / kGemvBlockRows;
+    const bool parallel = a.rows * a.cols >= kGemvParallelMin;
+    RunBlocks(num_blocks, parallel, [&](size_t block) {
+        const size_t first = block * kGemvBlockRows;
+        const size_t last = std::min(first + kGemvBlockRows, a.rows);
+        for (size_t i = first; i < last; ++i) {
+            const T *row = a.Row(i);
+            P acc = P::Zeros;
+            for (size_t j = 0; j < a.cols; j += width) {
+                const size_t n = std::min(width, a.cols - j);
+                P pa, px;
+                Load(pa, row + j, n);
+                Load(px, x + j, n);
+                acc = MulAdd(pa, px, acc);
+            }
+
+            T sum = (T) 0;
+            for (size_t k = 0; k < width; ++k) {
+                sum += acc[k];
+            }
+            y[i] = (beta == (T) 0) ? alpha * sum : alpha * sum + beta * y[i];
+        }
+    });
+}
+
+/// ---- Matrix factorization kernels ------------------------------------------
+///
+/// @brief Factor a square matrix, p * a = l * u, over panels of kFactorBlock
+/// columns. Each panel is factored with partial pivoting, swapping whole
+/// rows, then the block row of u right of the panel is solved, and the
+/// trailing submatrix is updated with the product of the panel and the block
+/// row. A zero pivot leaves its column unscaled and the matrix singular.
+///
+template<typename T>
+static bool LuFactorKernel(MatrixN<T> &a, std::vector<size_t> &pivots)
+{
+    if (a.rows != a.cols) {
+        throw std::runtime_error("invalid matrix dimensions");
+    }
+
+    const size_t n = a.rows;
+    bool regular = true;
+    pivots.resize(n);
+    for (size_t j0 = 0; j0 < n; j0 += kFactorBlock) {
+        const size_t j1 = std::min(j0 + kFactorBlock, n);
+
+        // Factor the panel of columns [j0, j1).
+        for (size_t j = j0; j < j1; ++j) {
+            size_t p = j;
+            T max = std::fabs(a(j, j));
+            for (size_t i = j + 1; i < n; ++i) {
+                if (std::fabs(a(i, j)) > max) {
+                    max = std::fabs(a(i, j));
+                    p = i;
+                }
+            }
+            pivots[j] = p;
+            if (p != j) {
+                std::swap_ranges(a.Row(j), a.Row(j) + n, a.Row(p));
+            }
+            if (a(j, j) == (T) 0) {
+                regular = false;
+                continue;
+            }
+
+            const T *pivot_row = a.Row(j);
+            const T scale = (T) 1 / pivot_row[j];
+            for (size_t i = j + 1; i < n; ++i) {
+                T *row = a.Row(i);
+                const T l = (row[j] *= scale);
+                for (size_t k = j + 1; k < j1; ++k) {
+                    row[k] -= l * pivot_row[k];
+                }
+            }
+        }
+        if (j1 == n) {
+            break;
+        }
+
+        // Solve l11 * u12 = a12 for the block row right of the panel.
+        for (size_t r = j0; r < j1; ++r) {
+            const T *src = a.Row(r);
+            for (size_t i = r + 1; i < j1; ++i) {
+                T *dst = a.Row(i);
+                const T l = dst[r];
+                for (size_t k = j1; k < n; ++k) {
+                    dst[k] -= l * src[k];
+                }
+            }
+        }
+
+        // Update the trailing submatrix, a22 = a22 - l21 * u12.
+        View<T> l21 = {&a(j1, j0), a.stride, 1};
+        View<T> u12 = {&a(j0, j1), a.stride, 1};
+        GemmBlocked(n - j1, n - j1, j1 - j0, (T) -1, l21, u12, (T) 1,
+            &a(j1, j1), a.stride);
+    }
+    return regular;
+}
+
+///
+/// @brief Solve a * x = b from the factors of a. Swap the rows of b, then
+/// solve l * y = b and u * x = y by substitution over whole rows of b.
+///
+template<typename T>
+static void LuSolveKernel(
+    const MatrixN<T> &lu,
+    const std::vector<size_t> &pivots,
+    MatrixN<T> &b)
+{
+    if (lu.rows != lu.cols || pivots.size() != lu.rows || b.rows != lu.rows) {
+        throw std::runtime_error("invalid matrix dimensions");
+    }
+
+    const size_t n = lu.rows;
+    const size_t m = b.cols;
+    for (size_t i = 0; i < n; ++i) {
+        if (pivots[i] != i) {
+            std::swap_ranges(b.Row(i), b.Row(i) + m, b.Row(pivots[i]));
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        T *dst = b.Row(i);
+        for (size_t k = 0; k < i; ++k) {
+            const T l = lu(i, k);
+            const T *src = b.Row(k);
+            for (size_t j = 0; j < m; ++j) {
+                dst[j] -= l * src[j];
+            }
+        }
+    }
+
+    for (size_t i = n; i-- > 0; ) {
+        T *dst = b.Row(i);
+        for (size_t k = i + 1; k < n; ++k) {
+            const T u = lu(i, k);
+            const T *src = b.Row(k);
+            for (size_t j = 0; j < m; ++j) {
+                dst[j] -= u * src[j];
+            }
+        }
+        const T scale = (T) 1 / lu(i, i);
+        for (size_t j = 0; j < m; ++j) {
+            dst[j] *= scale;
+        }
+    }
+}
+
+///
+/// @brief Factor a symmetric positive definite matrix, a = l * l^t, over
+/// panels of kFactorBlock columns. Each diagonal block is factored, then the
+/// block column below it is solved, and the trailing submatrix is updated with
+/// the product of the block column and its transpose. The update computes the
+/// whole trailing submatrix, so that it runs as a single product, and the
+/// upper triangle is set to zero at the end.
+///
+template<typename T>
+static bool CholeskyFactorKernel(MatrixN<T> &a)
+{
+    if (a.rows != a.cols) {
+        throw std::runtime_error("invalid matrix dimensions");
+    }
+
+    const size_t n = a.rows;
+    for (size_t j0 = 0; j0 < n; j0 += kFactorBlock) {
+        const size_t j1 = std::min(j0 + kFactorBlock, n);
+
+        // Factor the diagonal block, a11 = l11 * l11^t.
+        for (size_t j = j0; j < j1; ++j) {
+            T *row_j = a.Row(j);
+            T d = row_j[j];
+            for (size_t k = j0; k < j; ++k) {
+                d -= row_j[k] * row_j[k];
+            }
+            if (!(d > (T) 0)) {
+                return false;
+            }
+            row_j[j] = d = std::sqrt(d);
+
+            for (size_t i = j + 1; i < j1; ++i) {
+                T *row_i = a.Row(i);
+                T s = row_i[j];
+                for (size_t k = j0; k < j; ++k) {
+                    s -= row_i[k] * row_j[k];
+                }
+                row_i[j] = s / d;
+            }
+        }
+        if (j1 == n) {
+            break;
+        }
+
+        // Solve l21 * l11^t = a21 for the block column below the diagonal.
+        for (size_t i = j1; i < n; ++i) {
+            T *row_i = a.Row(i);
+            for (size_t j = j0; j < j1; ++j) {
+                const T *row_j = a.Row(j);
+                T s = row_i[j];
+                for (size_t k = j0; k < j; ++k) {
+                    s -= row_i[k] * row_j[k];
+                }
+                row_i[j] = s / row_j[j];
+            }
+        }
+
+        // Update the trailing submatrix, a22 = a22 - l21 * l21^t.
+        View<T> l21 = {&a(j1, j0), a.stride, 1};
+        View<T> l21t = {&a(j1, j0), 1, a.stride};
+        GemmBlocked(n - j1, n - j1, j1 - j0, (T) -1, l21, l21t, (T) 1,
+            &a(j1, j1), a.stride);
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        std::fill(a.Row(i) + i + 1, a.Row(i) + n, (T) 0);
+    }
+    return true;
+}
+
+///
+/// @brief Solve a * x = b from the factor of a. Solve l * y = b and l^t * x =
+/// y by substitution over whole rows of b.
+///
+template<typename T>
+static void CholeskySolveKernel(const MatrixN<T> &l, MatrixN<T> &b)
+{
+    if (l.rows != l.cols || b.rows != l.rows) {
+        throw std::runtime_error("invalid matrix dimensions");
+    }
+
+    const size_t n = l.rows;
+    const size_t m = b.cols;
+    for (size_t i = 0; i < n; ++i) {
+        T *dst = b.Row(i);
+        for (size_t k = 0; k < i; ++k) {
+            const T lik = l(i, k);
+            const T *src = b.Row(k);
+            for (size_t j = 0; j < m; ++j) {
+                dst[j] -= lik * src[j];
+            }
+        }
+        const T scale = (T) 1 / l(i, i);
+        for (size_t j = 0; j < m; ++j) {
+            dst[j] *= scale;
+        }
+    }
+
+    for (size_t i = n; i-- > 0; ) {
+        const T *src = b.Row(i);
+        T *row = b.Row(i);
+        const T scale = (T) 1 / l(i, i);
+        for (size_t j = 0; j < m; ++j) {
+            row[j] *= scale;
+        }
+        for (size_t k = 0; k < i; ++k) {
+            const T lik = l(i, k);
+            T *dst = b.Row(k);
+            for (size_t j = 0; j < m; ++j) {
+                dst[j] -= lik * src[j];
+            }
+        }
+    }
+}
+
+/// ---- Dense matrix interface -----------------------------------------------
+///
+void Gemm(
+    const float alpha,
+    const MatrixN<float> &a,
+    const MatrixN<float> &b,
+    const float beta,
+    MatrixN<float> &c)
+{
+    GemmKernel(alpha, a, b, beta, c);
+}
+
+void Gemm(
+    const double alpha,
+    const MatrixN<double> &a,
+    const MatrixN<double> &b,
+    const double beta,
+    MatrixN<double> &c)
+{
+    GemmKernel(alpha, a, b, beta, c);
+}
+
+void Gemv(
+    const float alpha,
+    const MatrixN<float> &a,
+    const float *x,
+    const float beta,
+    float *y)
+{
+    GemvKernel(alpha, a, x, beta, y);
+}
+
+void Gemv(
+    const double alpha,
+    const MatrixN<double> &a,
+    const double *x,
+    const double beta,
+    double *y)
+{
+    GemvKernel(alpha, a, x, beta, y);
+}
+
+MatrixN<float> Dot(const MatrixN<float> &a, const MatrixN<float> &b)
+{
+    MatrixN<float> c = MatrixN<float>::Create(a.rows, b.cols);
+    GemmKernel(1.0f, a, b, 0.0f, c);
+    return c;
+}
+
+MatrixN<double> Dot(const MatrixN<double> &a, const MatrixN<double> &b)
+{
+    MatrixN<double> c = MatrixN<double>::Create(a.rows, b.cols);
+    GemmKernel(1.0, a, b, 0.0, c);
+    return c;
+}
+
+bool LuFactor(MatrixN<float> &a, std::vector<size_t> &pivots)
+{
+    return LuFactorKernel(a, pivots);
+}
+
+bool LuFactor(MatrixN<double> &a, std::vector<size_t> &pivots)
+{
+    return LuFactorKernel(a, pivots);
+}
+
+void LuSolve(
+    const MatrixN<float> &lu,
+    const std::vector<size_t> &pivots,
+    MatrixN<float> &b)
+{
+    LuSolveKernel(lu, pivots, b);
+}
+
+void LuSolve(
+    const MatrixN<double> &lu,
+    const std::vector<size_t> &pivots,
+    MatrixN<double> &b)
+{
+    LuSolveKernel(lu, pivots, b);
+}
+
+bool CholeskyFactor(MatrixN<float> &a)
+{
+    return CholeskyFactorKernel(a);
+}
+
+bool CholeskyFactor(MatrixN<double> &a)
+{
+    return CholeskyFactorKernel(a);
+}
+
+void CholeskySolve(const MatrixN<float> &l, MatrixN<float> &b)
+{
+    CholeskySolveKernel(l, b);
+}
+
+void CholeskySolve(const MatrixN<double> &l, MatrixN<double> &b)
+{
+    CholeskySolveKernel(l, b);
+}
+
+} // namespace Math
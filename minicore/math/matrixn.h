@@ -0,0 +1,141 @@
+//
+// matrixn.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_MATRIXN_H_
+#define MATH_MATRIXN_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include "minicore/base/memory.h"
+
+namespace Math {
+
+///
+/// @brief MatrixN is a dense matrix of any size, with its elements stored in
+/// row-major order. Each row is padded to a multiple of 32 bytes, and starts
+/// stride elements after the previous one, at the alignment of the allocator.
+/// The padding elements are zero.
+///
+template<typename T>
+struct MatrixN {
+    size_t rows;
+    size_t cols;
+    size_t stride;
+    std::vector<T, Base::Allocator<T>> data;
+
+    T &operator()(size_t i, size_t j) { return data[i * stride + j]; }
+    const T &operator()(size_t i, size_t j) const {
+        return data[i * stride + j];
+    }
+
+    T *Row(size_t i) { return &data[i * stride]; }
+    const T *Row(size_t i) const { return &data[i * stride]; }
+
+    // Matrix factory function.
+    static MatrixN Create(const size_t rows, const size_t cols);
+};
+
+///
+/// @brief Create a matrix with the specified number of rows and columns, with
+/// all elements set to zero.
+///
+template<typename T>
+inline MatrixN<T> MatrixN<T>::Create(const size_t rows, const size_t cols)
+{
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    const size_t align = 32 / sizeof(T);
+
+    MatrixN<T> m;
+    m.rows = rows;
+    m.cols = cols;
+    m.stride = ((cols + align - 1) / align) * align;
+    m.data.assign(rows * m.stride, (T) 0);
+    return m;
+}
+
+///
+/// @brief Dense matrix functions. The matrix products run over the thread pool
+/// if it is running and the product is large enough:
+///
+///  Gemm           c = alpha * a * b + beta * c. The matrices are multiplied
+///                 in blocks that fit in the caches, each block of a and b
+///                 packed into contiguous panels, and each tile of c computed
+///                 by the dispatched kernel of the highest instruction set.
+///                 If beta is zero, c is not read.
+///  Gemv           y = alpha * a * x + beta * y. If beta is zero, y is not
+///                 read.
+///  Dot            return the product a * b.
+///  LuFactor       factor a square matrix in place, p * a = l * u, with
+///                 partial pivoting, l unit lower triangular and u upper
+///                 triangular. Row i was swapped with row pivots[i]. Return
+///                 false if the matrix is singular.
+///  LuSolve        solve a * x = b in place of b for each column of b, from
+///                 the factors of a.
+///  CholeskyFactor factor a symmetric positive definite matrix in place,
+///                 a = l * l^t, with l lower triangular, reading the lower
+///                 triangle of a and setting the upper triangle to zero.
+///                 Return false if the matrix is not positive definite.
+///  CholeskySolve  solve a * x = b in place of b for each column of b, from
+///                 the factor of a.
+///
+/// The factorizations are blocked, and update the trailing submatrix with
+/// Gemm. The output matrices must not overlap the input matrices. Throw an
+/// exception if the matrix dimensions do not match.
+///
+void Gemm(
+    const float alpha,
+    const MatrixN<float> &a,
+    const MatrixN<float> &b,
+    const float beta,
+    MatrixN<float> &c);
+void Gemm(
+    const double alpha,
+    const MatrixN<double> &a,
+    const MatrixN<double> &b,
+    const double beta,
+    MatrixN<double> &c);
+
+void Gemv(
+    const float alpha,
+    const MatrixN<float> &a,
+    const float *x,
+    const float beta,
+    float *y);
+void Gemv(
+    const double alpha,
+    const MatrixN<double> &a,
+    const double *x,
+    const double beta,
+    double *y);
+
+MatrixN<float> Dot(const MatrixN<float> &a, const MatrixN<float> &b);
+MatrixN<double> Dot(const MatrixN<double> &a, const MatrixN<double> &b);
+
+bool LuFactor(MatrixN<float> &a, std::vector<size_t> &pivots);
+bool LuFactor(MatrixN<double> &a, std::vector<size_t> &pivots);
+
+void LuSolve(
+    const MatrixN<float> &lu,
+    const std::vector<size_t> &pivots,
+    MatrixN<float> &b);
+void LuSolve(
+    const MatrixN<double> &lu,
+    const std::vector<size_t> &pivots,
+    MatrixN<double> &b);
+
+bool CholeskyFactor(MatrixN<float> &a);
+bool CholeskyFactor(MatrixN<double> &a);
+
+void CholeskySolve(const MatrixN<float> &l, MatrixN<float> &b);
+void CholeskySolve(const MatrixN<double> &l, MatrixN<double> &b);
+
+} // namespace Math
+
+#endif // MATH_MATRIXN_H_
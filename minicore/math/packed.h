@@ -0,0 +1,244 @@
+//
+// packed.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_PACKED_H_
+#define MATH_PACKED_H_
+
+#include <cstddef>
+#include "vector.h"
+#include "packet.h"
+
+namespace Math {
+
+///
+/// @brief Packed vector data types store the vector elements contiguously,
+/// without the 32-byte alignment and padding of the compute vector types, so
+/// that a PackedVec3f takes 12 bytes instead of 32. They are storage types for
+/// large arrays. Convert them to the compute types to operate on them, or
+/// load them directly into packets, which widens them into SIMD registers.
+///
+/// ---- Packed vector data types ---------------------------------------------
+template<typename T>
+struct PackedVec2 {
+    static const size_t length = 2;
+
+    union {
+        T data[length];
+        struct { T x, y; };
+    };
+
+    T &operator[](size_t i) { return data[i]; }
+    const T &operator[](size_t i) const { return data[i]; }
+};
+
+template<typename T>
+struct PackedVec3 {
+    static const size_t length = 3;
+
+    union {
+        T data[length];
+        struct { T x, y, z; };
+    };
+
+    T &operator[](size_t i) { return data[i]; }
+    const T &operator[](size_t i) const { return data[i]; }
+};
+
+template<typename T>
+struct PackedVec4 {
+    static const size_t length = 4;
+
+    union {
+        T data[length];
+        struct { T x, y, z, w; };
+    };
+
+    T &operator[](size_t i) { return data[i]; }
+    const T &operator[](size_t i) const { return data[i]; }
+};
+
+typedef PackedVec2<float>   PackedVec2f;
+typedef PackedVec2<double>  PackedVec2d;
+typedef PackedVec3<float>   PackedVec3f;
+typedef PackedVec3<double>  PackedVec3d;
+typedef PackedVec4<float>   PackedVec4f;
+typedef PackedVec4<double>  PackedVec4d;
+
+static_assert(sizeof(PackedVec3f) == 12, "invalid PackedVec3f size");
+static_assert(sizeof(PackedVec3d) == 24, "invalid PackedVec3d size");
+
+inline namespace MATH_SIMD_ISA {
+
+/// ---- Packed vector declarations -------------------------------------------
+/// Conversions between the packed and the compute vector types.
+///
+template<typename T> inline PackedVec2<T> Pack(const Vec2<T> &v);
+template<typename T> inline PackedVec3<T> Pack(const Vec3<T> &v);
+template<typename T> inline PackedVec4<T> Pack(const Vec4<T> &v);
+
+template<typename T> inline Vec2<T> Unpack(const PackedVec2<T> &v);
+template<typename T> inline Vec3<T> Unpack(const PackedVec3<T> &v);
+template<typename T> inline Vec4<T> Unpack(const PackedVec4<T> &v);
+
+/// Array conversions between the packed and the compute vector types.
+template<typename T>
+inline void Pack(const Vec2<T> *src, PackedVec2<T> *dst, const size_t count);
+template<typename T>
+inline void Pack(const Vec3<T> *src, PackedVec3<T> *dst, const size_t count);
+template<typename T>
+inline void Pack(const Vec4<T> *src, PackedVec4<T> *dst, const size_t count);
+
+template<typename T>
+inline void Unpack(const PackedVec2<T> *src, Vec2<T> *dst, const size_t count);
+template<typename T>
+inline void Unpack(const PackedVec3<T> *src, Vec3<T> *dst, const size_t count);
+template<typename T>
+inline void Unpack(const PackedVec4<T> *src, Vec4<T> *dst, const size_t count);
+
+/// Load and store packets from and to arrays of packed vectors.
+template<typename T, size_t N>
+inline void Load(
+    Vec3Packet<T,N> &dst, const PackedVec3<T> *src, const size_t count = N);
+template<typename T, size_t N>
+inline void Store(
+    const Vec3Packet<T,N> &src, PackedVec3<T> *dst, const size_t count = N);
+
+/// ---- Packed vector implementation -----------------------------------------
+///
+template<typename T>
+inline PackedVec2<T> Pack(const Vec2<T> &v)
+{
+    return {v.x, v.y};
+}
+
+template<typename T>
+inline PackedVec3<T> Pack(const Vec3<T> &v)
+{
+    return {v.x, v.y, v.z};
+}
+
+template<typename T>
+inline PackedVec4<T> Pack(const Vec4<T> &v)
+{
+    return {v.x, v.y, v.z, v.w};
+}
+
+template<typename T>
+inline Vec2<T> Unpack(const PackedVec2<T> &v)
+{
+    return {v.x, v.y};
+}
+
+template<typename T>
+inline Vec3<T> Unpack(const PackedVec3<T> &v)
+{
+    return {v.x, v.y, v.z};
+}
+
+template<typename T>
+inline Vec4<T> Unpack(const PackedVec4<T> &v)
+{
+    return {v.x, v.y, v.z, v.w};
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Convert an array of compute vectors into packed vectors, and back.
+///
+template<typename T>
+inline void Pack(const Vec2<T> *src, PackedVec2<T> *dst, const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = Pack(src[i]);
+    }
+}
+
+template<typename T>
+inline void Pack(const Vec3<T> *src, PackedVec3<T> *dst, const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = Pack(src[i]);
+    }
+}
+
+template<typename T>
+inline void Pack(const Vec4<T> *src, PackedVec4<T> *dst, const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = Pack(src[i]);
+    }
+}
+
+template<typename T>
+inline void Unpack(const PackedVec2<T> *src, Vec2<T> *dst, const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = Unpack(src[i]);
+    }
+}
+
+template<typename T>
+inline void Unpack(const PackedVec3<T> *src, Vec3<T> *dst, const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = Unpack(src[i]);
+    }
+}
+
+template<typename T>
+inline void Unpack(const PackedVec4<T> *src, Vec4<T> *dst, const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = Unpack(src[i]);
+    }
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Load the first count lanes of the packet from an array of packed
+/// vectors. The remaining lanes are set to zero.
+///
+template<typename T, size_t N>
+inline void Load(
+    Vec3Packet<T,N> &dst,
+    const PackedVec3<T> *src,
+    const size_t count)
+{
+    for (size_t i = 0; i < N; ++i) {
+        bool valid = (i < count);
+        dst.x.data[i] = valid ? src[i].x : (T) 0;
+        dst.y.data[i] = valid ? src[i].y : (T) 0;
+        dst.z.data[i] = valid ? src[i].z : (T) 0;
+    }
+}
+
+///
+/// @brief Store the first count lanes of the packet into an array of packed
+/// vectors.
+///
+template<typename T, size_t N>
+inline void Store(
+    const Vec3Packet<T,N> &src,
+    PackedVec3<T> *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < N && i < count; ++i) {
+        dst[i].x = src.x.data[i];
+        dst[i].y = src.y.data[i];
+        dst[i].z = src.z.data[i];
+    }
+}
+
+} // inline namespace MATH_SIMD_ISA
+} // namespace Math
+
+/// ---- simd implementations ------------------------------------------------
+#ifdef __AVX__
+#include "simd/packed.h"
+#endif
+
+#endif // MATH_PACKED_H_
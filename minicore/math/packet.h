@@ -0,0 +1,1129 @@
+//
+// packet.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_PACKET_H_
+#define MATH_PACKET_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include "vector.h"
+#include "simd/isa.h"
+
+namespace Math {
+inline namespace MATH_SIMD_ISA {
+
+///
+/// @brief Packet data types hold N elements in structure of arrays layout, one
+/// element in each lane, so that a packet operation processes all lanes with
+/// one instruction per component:
+///
+///  Packet<T,N>        N scalars.
+///  MaskPacket<T,N>    N lane masks of the size of T, all bits set if true.
+///  Vec3Packet<T,N>    N 3-dimensional vectors, one packet per component.
+///
+/// The packets of 256-bit width, Packet4d and Packet8f, have AVX
+/// specializations. The Vec3 packets are implemented in terms of the scalar
+/// packet operations and use them in each component.
+///
+/// ---- Packet data types ----------------------------------------------------
+template<typename T, size_t N>
+struct Packet {
+    static const Packet Zeros;
+    static const Packet Ones;
+    static const size_t width = N;
+
+    alignas(32) T data[N];
+
+    T &operator[](size_t i) { return data[i]; }
+    const T &operator[](size_t i) const { return data[i]; }
+};
+
+template<typename T, size_t N>
+struct MaskPacket {
+    typedef typename std::conditional<
+        sizeof(T) <= sizeof(uint32_t), uint32_t, uint64_t>::type Lane;
+    static const size_t width = N;
+
+    alignas(32) Lane data[N];
+
+    bool operator[](size_t i) const { return data[i] != 0; }
+};
+
+template<typename T, size_t N>
+struct Vec3Packet {
+    static const size_t width = N;
+
+    Packet<T,N> x;
+    Packet<T,N> y;
+    Packet<T,N> z;
+};
+
+typedef Packet<double,4>        Packet4d;
+typedef Packet<float,8>         Packet8f;
+typedef MaskPacket<double,4>    Mask4d;
+typedef MaskPacket<float,8>     Mask8f;
+typedef Vec3Packet<double,4>    Vec3x4d;
+typedef Vec3Packet<float,8>     Vec3x8f;
+
+/// ---- Special packets ------------------------------------------------------
+template<typename T, size_t N>
+const Packet<T,N> Packet<T,N>::Zeros = []() {
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (T) 0;
+    }
+    return result;
+}();
+
+template<typename T, size_t N>
+const Packet<T,N> Packet<T,N>::Ones = []() {
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (T) 1;
+    }
+    return result;
+}();
+
+/// ---- Packet declarations --------------------------------------------------
+/// Compound assignment operators.
+///
+template<typename T, size_t N>
+inline Packet<T,N> &operator+=(Packet<T,N> &lhs, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Packet<T,N> &operator-=(Packet<T,N> &lhs, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Packet<T,N> &operator*=(Packet<T,N> &lhs, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Packet<T,N> &operator/=(Packet<T,N> &lhs, const Packet<T,N> &rhs);
+
+template<typename T, size_t N>
+inline Packet<T,N> &operator+=(Packet<T,N> &lhs, const T scalar);
+template<typename T, size_t N>
+inline Packet<T,N> &operator-=(Packet<T,N> &lhs, const T scalar);
+template<typename T, size_t N>
+inline Packet<T,N> &operator*=(Packet<T,N> &lhs, const T scalar);
+template<typename T, size_t N>
+inline Packet<T,N> &operator/=(Packet<T,N> &lhs, const T scalar);
+
+/// Arithmetic operators.
+template<typename T, size_t N>
+inline Packet<T,N> operator+(Packet<T,N> lhs, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Packet<T,N> operator-(Packet<T,N> lhs, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Packet<T,N> operator*(Packet<T,N> lhs, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Packet<T,N> operator/(Packet<T,N> lhs, const Packet<T,N> &rhs);
+
+template<typename T, size_t N>
+inline Packet<T,N> operator+(Packet<T,N> lhs, const T scalar);
+template<typename T, size_t N>
+inline Packet<T,N> operator-(Packet<T,N> lhs, const T scalar);
+template<typename T, size_t N>
+inline Packet<T,N> operator*(Packet<T,N> lhs, const T scalar);
+template<typename T, size_t N>
+inline Packet<T,N> operator/(Packet<T,N> lhs, const T scalar);
+
+template<typename T, size_t N>
+inline Packet<T,N> operator+(const T scalar, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Packet<T,N> operator-(const T scalar, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Packet<T,N> operator*(const T scalar, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Packet<T,N> operator/(const T scalar, const Packet<T,N> &rhs);
+
+/// Unary operators.
+template<typename T, size_t N>
+inline Packet<T,N> operator+(Packet<T,N> lhs);
+template<typename T, size_t N>
+inline Packet<T,N> operator-(Packet<T,N> lhs);
+
+/// Packet functions.
+template<typename T, size_t N>
+inline Packet<T,N> Broadcast(const T scalar);
+template<typename T, size_t N>
+inline void Load(Packet<T,N> &dst, const T *src, const size_t count = N);
+template<typename T, size_t N>
+inline void Store(const Packet<T,N> &src, T *dst, const size_t count = N);
+
+template<typename T, size_t N>
+inline Packet<T,N> MulAdd(
+    const Packet<T,N> &a, const Packet<T,N> &b, const Packet<T,N> &c);
+template<typename T, size_t N>
+inline Packet<T,N> Sqrt(const Packet<T,N> &u);
+template<typename T, size_t N>
+inline Packet<T,N> Abs(const Packet<T,N> &u);
+template<typename T, size_t N>
+inline Packet<T,N> Floor(const Packet<T,N> &u);
+template<typename T, size_t N>
+inline Packet<T,N> Ceil(const Packet<T,N> &u);
+template<typename T, size_t N>
+inline Packet<T,N> Min(const Packet<T,N> &u, const Packet<T,N> &v);
+template<typename T, size_t N>
+inline Packet<T,N> Max(const Packet<T,N> &u, const Packet<T,N> &v);
+template<typename T, size_t N>
+inline Packet<T,N> Clamp(
+    const Packet<T,N> &u, const Packet<T,N> &lo, const Packet<T,N> &hi);
+template<typename T, size_t N>
+inline Packet<T,N> Lerp(
+    const Packet<T,N> &lo, const Packet<T,N> &hi, const Packet<T,N> &u);
+
+/// Compare and select functions.
+template<typename T, size_t N>
+inline MaskPacket<T,N> Equal(const Packet<T,N> &u, const Packet<T,N> &v);
+template<typename T, size_t N>
+inline MaskPacket<T,N> NotEqual(const Packet<T,N> &u, const Packet<T,N> &v);
+template<typename T, size_t N>
+inline MaskPacket<T,N> Less(const Packet<T,N> &u, const Packet<T,N> &v);
+template<typename T, size_t N>
+inline MaskPacket<T,N> LessEqual(const Packet<T,N> &u, const Packet<T,N> &v);
+template<typename T, size_t N>
+inline MaskPacket<T,N> Greater(const Packet<T,N> &u, const Packet<T,N> &v);
+template<typename T, size_t N>
+inline MaskPacket<T,N> GreaterEqual(
+    const Packet<T,N> &u, const Packet<T,N> &v);
+template<typename T, size_t N>
+inline Packet<T,N> Select(
+    const MaskPacket<T,N> &mask, const Packet<T,N> &u, const Packet<T,N> &v);
+
+/// ---- MaskPacket declarations ----------------------------------------------
+/// Logical operators and lane reductions.
+///
+template<typename T, size_t N>
+inline MaskPacket<T,N> operator&(
+    const MaskPacket<T,N> &lhs, const MaskPacket<T,N> &rhs);
+template<typename T, size_t N>
+inline MaskPacket<T,N> operator|(
+    const MaskPacket<T,N> &lhs, const MaskPacket<T,N> &rhs);
+template<typename T, size_t N>
+inline MaskPacket<T,N> operator^(
+    const MaskPacket<T,N> &lhs, const MaskPacket<T,N> &rhs);
+template<typename T, size_t N>
+inline MaskPacket<T,N> operator~(const MaskPacket<T,N> &lhs);
+
+template<typename T, size_t N>
+inline bool Any(const MaskPacket<T,N> &mask);
+template<typename T, size_t N>
+inline bool All(const MaskPacket<T,N> &mask);
+
+/// ---- Vec3Packet declarations ----------------------------------------------
+/// Compound assignment operators.
+///
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator+=(
+    Vec3Packet<T,N> &lhs, const Vec3Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator-=(
+    Vec3Packet<T,N> &lhs, const Vec3Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator*=(
+    Vec3Packet<T,N> &lhs, const Vec3Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator/=(
+    Vec3Packet<T,N> &lhs, const Vec3Packet<T,N> &rhs);
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator*=(
+    Vec3Packet<T,N> &lhs, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator/=(
+    Vec3Packet<T,N> &lhs, const Packet<T,N> &rhs);
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator+=(Vec3Packet<T,N> &lhs, const T scalar);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator-=(Vec3Packet<T,N> &lhs, const T scalar);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator*=(Vec3Packet<T,N> &lhs, const T scalar);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator/=(Vec3Packet<T,N> &lhs, const T scalar);
+
+/// Arithmetic operators.
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator+(
+    Vec3Packet<T,N> lhs, const Vec3Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator-(
+    Vec3Packet<T,N> lhs, const Vec3Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator*(
+    Vec3Packet<T,N> lhs, const Vec3Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator/(
+    Vec3Packet<T,N> lhs, const Vec3Packet<T,N> &rhs);
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator*(Vec3Packet<T,N> lhs, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator/(Vec3Packet<T,N> lhs, const Packet<T,N> &rhs);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator*(const Packet<T,N> &lhs, Vec3Packet<T,N> rhs);
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator+(Vec3Packet<T,N> lhs, const T scalar);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator-(Vec3Packet<T,N> lhs, const T scalar);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator*(Vec3Packet<T,N> lhs, const T scalar);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator/(Vec3Packet<T,N> lhs, const T scalar);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator*(const T scalar, Vec3Packet<T,N> rhs);
+
+/// Unary operators.
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator+(Vec3Packet<T,N> lhs);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator-(Vec3Packet<T,N> lhs);
+
+/// Load, store and broadcast functions.
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Broadcast(const Vec3<T> &v);
+template<typename T, size_t N>
+inline void Load(
+    Vec3Packet<T,N> &dst, const Vec3<T> *src, const size_t count = N);
+template<typename T, size_t N>
+inline void Store(
+    const Vec3Packet<T,N> &src, Vec3<T> *dst, const size_t count = N);
+template<typename T, size_t N>
+inline Vec3<T> Extract(const Vec3Packet<T,N> &src, const size_t lane);
+
+/// Algebra and arithmetic functions.
+template<typename T, size_t N>
+inline Packet<T,N> Dot(const Vec3Packet<T,N> &a, const Vec3Packet<T,N> &b);
+template<typename T, size_t N>
+inline Packet<T,N> Norm(const Vec3Packet<T,N> &a);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Normalize(const Vec3Packet<T,N> &a);
+template<typename T, size_t N>
+inline Packet<T,N> Distance(
+    const Vec3Packet<T,N> &a, const Vec3Packet<T,N> &b);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Cross(
+    const Vec3Packet<T,N> &a, const Vec3Packet<T,N> &b);
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Abs(const Vec3Packet<T,N> &u);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Floor(const Vec3Packet<T,N> &u);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Ceil(const Vec3Packet<T,N> &u);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Min(const Vec3Packet<T,N> &u, const Vec3Packet<T,N> &v);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Max(const Vec3Packet<T,N> &u, const Vec3Packet<T,N> &v);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Clamp(
+    const Vec3Packet<T,N> &u,
+    const Vec3Packet<T,N> &lo,
+    const Vec3Packet<T,N> &hi);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Lerp(
+    const Vec3Packet<T,N> &lo,
+    const Vec3Packet<T,N> &hi,
+    const Packet<T,N> &u);
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Select(
+    const MaskPacket<T,N> &mask,
+    const Vec3Packet<T,N> &u,
+    const Vec3Packet<T,N> &v);
+
+/// ---- Packet implementation ------------------------------------------------
+/// Compound assignment operators.
+///
+template<typename T, size_t N>
+inline Packet<T,N> &operator+=(Packet<T,N> &lhs, const Packet<T,N> &rhs)
+{
+    for (size_t i = 0; i < N; ++i) {
+        lhs.data[i] += rhs.data[i];
+    }
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> &operator-=(Packet<T,N> &lhs, const Packet<T,N> &rhs)
+{
+    for (size_t i = 0; i < N; ++i) {
+        lhs.data[i] -= rhs.data[i];
+    }
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> &operator*=(Packet<T,N> &lhs, const Packet<T,N> &rhs)
+{
+    for (size_t i = 0; i < N; ++i) {
+        lhs.data[i] *= rhs.data[i];
+    }
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> &operator/=(Packet<T,N> &lhs, const Packet<T,N> &rhs)
+{
+    for (size_t i = 0; i < N; ++i) {
+        lhs.data[i] /= rhs.data[i];
+    }
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> &operator+=(Packet<T,N> &lhs, const T scalar)
+{
+    return lhs += Broadcast<T,N>(scalar);
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> &operator-=(Packet<T,N> &lhs, const T scalar)
+{
+    return lhs -= Broadcast<T,N>(scalar);
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> &operator*=(Packet<T,N> &lhs, const T scalar)
+{
+    return lhs *= Broadcast<T,N>(scalar);
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> &operator/=(Packet<T,N> &lhs, const T scalar)
+{
+    return lhs /= Broadcast<T,N>(scalar);
+}
+
+///
+/// Arithmetic operators.
+///
+template<typename T, size_t N>
+inline Packet<T,N> operator+(Packet<T,N> lhs, const Packet<T,N> &rhs)
+{
+    return lhs += rhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator-(Packet<T,N> lhs, const Packet<T,N> &rhs)
+{
+    return lhs -= rhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator*(Packet<T,N> lhs, const Packet<T,N> &rhs)
+{
+    return lhs *= rhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator/(Packet<T,N> lhs, const Packet<T,N> &rhs)
+{
+    return lhs /= rhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator+(Packet<T,N> lhs, const T scalar)
+{
+    return lhs += scalar;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator-(Packet<T,N> lhs, const T scalar)
+{
+    return lhs -= scalar;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator*(Packet<T,N> lhs, const T scalar)
+{
+    return lhs *= scalar;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator/(Packet<T,N> lhs, const T scalar)
+{
+    return lhs /= scalar;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator+(const T scalar, const Packet<T,N> &rhs)
+{
+    Packet<T,N> lhs = Broadcast<T,N>(scalar);
+    return lhs += rhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator-(const T scalar, const Packet<T,N> &rhs)
+{
+    Packet<T,N> lhs = Broadcast<T,N>(scalar);
+    return lhs -= rhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator*(const T scalar, const Packet<T,N> &rhs)
+{
+    Packet<T,N> lhs = Broadcast<T,N>(scalar);
+    return lhs *= rhs;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> operator/(const T scalar, const Packet<T,N> &rhs)
+{
+    Packet<T,N> lhs = Broadcast<T,N>(scalar);
+    return lhs /= rhs;
+}
+
+///
+/// Unary operators.
+///
+template<typename T, size_t N>
+inline Packet<T,N> operator+(Packet<T,N> lhs) { return lhs; }
+
+template<typename T, size_t N>
+inline Packet<T,N> operator-(Packet<T,N> lhs) { return lhs *= (T) -1; }
+
+/// -----------------------------------------------------------------------------
+/// @brief Return a packet with the scalar in every lane.
+///
+template<typename T, size_t N>
+inline Packet<T,N> Broadcast(const T scalar)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = scalar;
+    }
+    return result;
+}
+
+///
+/// @brief Load the first count lanes of the packet from an array of scalars.
+/// The remaining lanes are set to zero.
+///
+template<typename T, size_t N>
+inline void Load(Packet<T,N> &dst, const T *src, const size_t count)
+{
+    for (size_t i = 0; i < N; ++i) {
+        dst.data[i] = (i < count) ? src[i] : (T) 0;
+    }
+}
+
+///
+/// @brief Store the first count lanes of the packet into an array of scalars.
+///
+template<typename T, size_t N>
+inline void Store(const Packet<T,N> &src, T *dst, const size_t count)
+{
+    for (size_t i = 0; i < N && i < count; ++i) {
+        dst[i] = src.data[i];
+    }
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Return a * b + c. The AVX specializations use a fused multiply-add
+/// if the instruction set is enabled.
+///
+template<typename T, size_t N>
+inline Packet<T,N> MulAdd(
+    const Packet<T,N> &a, const Packet<T,N> &b, const Packet<T,N> &c)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = a.data[i] * b.data[i] + c.data[i];
+    }
+    return result;
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Return the lane-wise square root, absolute value, floor and ceiling.
+///
+template<typename T, size_t N>
+inline Packet<T,N> Sqrt(const Packet<T,N> &u)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = std::sqrt(u.data[i]);
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> Abs(const Packet<T,N> &u)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = std::fabs(u.data[i]);
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> Floor(const Packet<T,N> &u)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = std::floor(u.data[i]);
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> Ceil(const Packet<T,N> &u)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = std::ceil(u.data[i]);
+    }
+    return result;
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Return the lane-wise minimum and maximum, with the semantics of
+/// std::min and std::max: the first argument is returned if the lanes are
+/// unordered.
+///
+template<typename T, size_t N>
+inline Packet<T,N> Min(const Packet<T,N> &u, const Packet<T,N> &v)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (v.data[i] < u.data[i]) ? v.data[i] : u.data[i];
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> Max(const Packet<T,N> &u, const Packet<T,N> &v)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (u.data[i] < v.data[i]) ? v.data[i] : u.data[i];
+    }
+    return result;
+}
+
+///
+/// @brief Clamp the packet lanes to the range [lo, hi].
+///
+template<typename T, size_t N>
+inline Packet<T,N> Clamp(
+    const Packet<T,N> &u, const Packet<T,N> &lo, const Packet<T,N> &hi)
+{
+    return Min(Max(u, lo), hi);
+}
+
+///
+/// @brief Linear interpolation lo * (1 - u) + hi * u of the packet lanes.
+///
+template<typename T, size_t N>
+inline Packet<T,N> Lerp(
+    const Packet<T,N> &lo, const Packet<T,N> &hi, const Packet<T,N> &u)
+{
+    return MulAdd(hi, u, lo * ((T) 1 - u));
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Compare the packet lanes and return the lane masks. All comparisons
+/// are false for unordered lanes, except NotEqual which is true.
+///
+template<typename T, size_t N>
+inline MaskPacket<T,N> Equal(const Packet<T,N> &u, const Packet<T,N> &v)
+{
+    MaskPacket<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (u.data[i] == v.data[i]) ? ~0 : 0;
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline MaskPacket<T,N> NotEqual(const Packet<T,N> &u, const Packet<T,N> &v)
+{
+    MaskPacket<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (u.data[i] != v.data[i]) ? ~0 : 0;
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline MaskPacket<T,N> Less(const Packet<T,N> &u, const Packet<T,N> &v)
+{
+    MaskPacket<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (u.data[i] < v.data[i]) ? ~0 : 0;
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline MaskPacket<T,N> LessEqual(const Packet<T,N> &u, const Packet<T,N> &v)
+{
+    MaskPacket<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (u.data[i] <= v.data[i]) ? ~0 : 0;
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline MaskPacket<T,N> Greater(const Packet<T,N> &u, const Packet<T,N> &v)
+{
+    MaskPacket<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (u.data[i] > v.data[i]) ? ~0 : 0;
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline MaskPacket<T,N> GreaterEqual(
+    const Packet<T,N> &u, const Packet<T,N> &v)
+{
+    MaskPacket<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = (u.data[i] >= v.data[i]) ? ~0 : 0;
+    }
+    return result;
+}
+
+///
+/// @brief Select the lanes of u where the mask is set and of v otherwise.
+///
+template<typename T, size_t N>
+inline Packet<T,N> Select(
+    const MaskPacket<T,N> &mask, const Packet<T,N> &u, const Packet<T,N> &v)
+{
+    Packet<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = mask.data[i] ? u.data[i] : v.data[i];
+    }
+    return result;
+}
+
+/// ---- MaskPacket implementation --------------------------------------------
+/// Logical operators.
+///
+template<typename T, size_t N>
+inline MaskPacket<T,N> operator&(
+    const MaskPacket<T,N> &lhs, const MaskPacket<T,N> &rhs)
+{
+    MaskPacket<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = lhs.data[i] & rhs.data[i];
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline MaskPacket<T,N> operator|(
+    const MaskPacket<T,N> &lhs, const MaskPacket<T,N> &rhs)
+{
+    MaskPacket<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = lhs.data[i] | rhs.data[i];
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline MaskPacket<T,N> operator^(
+    const MaskPacket<T,N> &lhs, const MaskPacket<T,N> &rhs)
+{
+    MaskPacket<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = lhs.data[i] ^ rhs.data[i];
+    }
+    return result;
+}
+
+template<typename T, size_t N>
+inline MaskPacket<T,N> operator~(const MaskPacket<T,N> &lhs)
+{
+    MaskPacket<T,N> result;
+    for (size_t i = 0; i < N; ++i) {
+        result.data[i] = ~lhs.data[i];
+    }
+    return result;
+}
+
+///
+/// @brief Return true if any lane, or all lanes, of the mask are set.
+///
+template<typename T, size_t N>
+inline bool Any(const MaskPacket<T,N> &mask)
+{
+    typename MaskPacket<T,N>::Lane bits = 0;
+    for (size_t i = 0; i < N; ++i) {
+        bits |= mask.data[i];
+    }
+    return bits != 0;
+}
+
+template<typename T, size_t N>
+inline bool All(const MaskPacket<T,N> &mask)
+{
+    typename MaskPacket<T,N>::Lane bits = ~0;
+    for (size_t i = 0; i < N; ++i) {
+        bits &= mask.data[i];
+    }
+    return bits != 0;
+}
+
+/// ---- Vec3Packet implementation --------------------------------------------
+/// Compound assignment operators.
+///
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator+=(
+    Vec3Packet<T,N> &lhs, const Vec3Packet<T,N> &rhs)
+{
+    lhs.x += rhs.x;
+    lhs.y += rhs.y;
+    lhs.z += rhs.z;
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator-=(
+    Vec3Packet<T,N> &lhs, const Vec3Packet<T,N> &rhs)
+{
+    lhs.x -= rhs.x;
+    lhs.y -= rhs.y;
+    lhs.z -= rhs.z;
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator*=(
+    Vec3Packet<T,N> &lhs, const Vec3Packet<T,N> &rhs)
+{
+    lhs.x *= rhs.x;
+    lhs.y *= rhs.y;
+    lhs.z *= rhs.z;
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator/=(
+    Vec3Packet<T,N> &lhs, const Vec3Packet<T,N> &rhs)
+{
+    lhs.x /= rhs.x;
+    lhs.y /= rhs.y;
+    lhs.z /= rhs.z;
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator*=(Vec3Packet<T,N> &lhs, const Packet<T,N> &rhs)
+{
+    lhs.x *= rhs;
+    lhs.y *= rhs;
+    lhs.z *= rhs;
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator/=(Vec3Packet<T,N> &lhs, const Packet<T,N> &rhs)
+{
+    lhs.x /= rhs;
+    lhs.y /= rhs;
+    lhs.z /= rhs;
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator+=(Vec3Packet<T,N> &lhs, const T scalar)
+{
+    lhs.x += scalar;
+    lhs.y += scalar;
+    lhs.z += scalar;
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator-=(Vec3Packet<T,N> &lhs, const T scalar)
+{
+    lhs.x -= scalar;
+    lhs.y -= scalar;
+    lhs.z -= scalar;
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator*=(Vec3Packet<T,N> &lhs, const T scalar)
+{
+    lhs.x *= scalar;
+    lhs.y *= scalar;
+    lhs.z *= scalar;
+    return lhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> &operator/=(Vec3Packet<T,N> &lhs, const T scalar)
+{
+    lhs.x /= scalar;
+    lhs.y /= scalar;
+    lhs.z /= scalar;
+    return lhs;
+}
+
+///
+/// Arithmetic operators.
+///
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator+(
+    Vec3Packet<T,N> lhs, const Vec3Packet<T,N> &rhs)
+{
+    return lhs += rhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator-(
+    Vec3Packet<T,N> lhs, const Vec3Packet<T,N> &rhs)
+{
+    return lhs -= rhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator*(
+    Vec3Packet<T,N> lhs, const Vec3Packet<T,N> &rhs)
+{
+    return lhs *= rhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator/(
+    Vec3Packet<T,N> lhs, const Vec3Packet<T,N> &rhs)
+{
+    return lhs /= rhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator*(Vec3Packet<T,N> lhs, const Packet<T,N> &rhs)
+{
+    return lhs *= rhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator/(Vec3Packet<T,N> lhs, const Packet<T,N> &rhs)
+{
+    return lhs /= rhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator*(const Packet<T,N> &lhs, Vec3Packet<T,N> rhs)
+{
+    return rhs *= lhs;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator+(Vec3Packet<T,N> lhs, const T scalar)
+{
+    return lhs += scalar;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator-(Vec3Packet<T,N> lhs, const T scalar)
+{
+    return lhs -= scalar;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator*(Vec3Packet<T,N> lhs, const T scalar)
+{
+    return lhs *= scalar;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator/(Vec3Packet<T,N> lhs, const T scalar)
+{
+    return lhs /= scalar;
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator*(const T scalar, Vec3Packet<T,N> rhs)
+{
+    return rhs *= scalar;
+}
+
+///
+/// Unary operators.
+///
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator+(Vec3Packet<T,N> lhs) { return lhs; }
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> operator-(Vec3Packet<T,N> lhs)
+{
+    return lhs *= (T) -1;
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Return a packet with the vector in every lane.
+///
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Broadcast(const Vec3<T> &v)
+{
+    return {Broadcast<T,N>(v.x), Broadcast<T,N>(v.y), Broadcast<T,N>(v.z)};
+}
+
+///
+/// @brief Load the first count lanes of the packet from an array of vectors,
+/// transposing them into structure of arrays layout. The remaining lanes are
+/// set to zero.
+///
+template<typename T, size_t N>
+inline void Load(Vec3Packet<T,N> &dst, const Vec3<T> *src, const size_t count)
+{
+    for (size_t i = 0; i < N; ++i) {
+        bool valid = (i < count);
+        dst.x.data[i] = valid ? src[i].x : (T) 0;
+        dst.y.data[i] = valid ? src[i].y : (T) 0;
+        dst.z.data[i] = valid ? src[i].z : (T) 0;
+    }
+}
+
+///
+/// @brief Store the first count lanes of the packet into an array of vectors,
+/// transposing them back into array of structures layout.
+///
+template<typename T, size_t N>
+inline void Store(const Vec3Packet<T,N> &src, Vec3<T> *dst, const size_t count)
+{
+    for (size_t i = 0; i < N && i < count; ++i) {
+        dst[i].x = src.x.data[i];
+        dst[i].y = src.y.data[i];
+        dst[i].z = src.z.data[i];
+    }
+}
+
+///
+/// @brief Return the vector in the specified lane of the packet.
+///
+template<typename T, size_t N>
+inline Vec3<T> Extract(const Vec3Packet<T,N> &src, const size_t lane)
+{
+    return {src.x.data[lane], src.y.data[lane], src.z.data[lane]};
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Return the dot product, norm and distance of the packet vectors.
+///
+template<typename T, size_t N>
+inline Packet<T,N> Dot(const Vec3Packet<T,N> &a, const Vec3Packet<T,N> &b)
+{
+    return MulAdd(a.z, b.z, MulAdd(a.y, b.y, a.x * b.x));
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> Norm(const Vec3Packet<T,N> &a)
+{
+    return Sqrt(Dot(a, a));
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Normalize(const Vec3Packet<T,N> &a)
+{
+    return a / Norm(a);
+}
+
+template<typename T, size_t N>
+inline Packet<T,N> Distance(const Vec3Packet<T,N> &a, const Vec3Packet<T,N> &b)
+{
+    return Norm(a - b);
+}
+
+///
+/// @brief Return the cross product of the packet vectors,
+/// c = {a1*b2 - a2*b1, a2*b0 - a0*b2, a0*b1 - a1*b0}.
+///
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Cross(const Vec3Packet<T,N> &a, const Vec3Packet<T,N> &b)
+{
+    return {
+        MulAdd(a.y, b.z, -(a.z * b.y)),
+        MulAdd(a.z, b.x, -(a.x * b.z)),
+        MulAdd(a.x, b.y, -(a.y * b.x))};
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Component-wise arithmetic functions of the packet vectors.
+///
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Abs(const Vec3Packet<T,N> &u)
+{
+    return {Abs(u.x), Abs(u.y), Abs(u.z)};
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Floor(const Vec3Packet<T,N> &u)
+{
+    return {Floor(u.x), Floor(u.y), Floor(u.z)};
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Ceil(const Vec3Packet<T,N> &u)
+{
+    return {Ceil(u.x), Ceil(u.y), Ceil(u.z)};
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Min(const Vec3Packet<T,N> &u, const Vec3Packet<T,N> &v)
+{
+    return {Min(u.x, v.x), Min(u.y, v.y), Min(u.z, v.z)};
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Max(const Vec3Packet<T,N> &u, const Vec3Packet<T,N> &v)
+{
+    return {Max(u.x, v.x), Max(u.y, v.y), Max(u.z, v.z)};
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Clamp(
+    const Vec3Packet<T,N> &u,
+    const Vec3Packet<T,N> &lo,
+    const Vec3Packet<T,N> &hi)
+{
+    return Min(Max(u, lo), hi);
+}
+
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Lerp(
+    const Vec3Packet<T,N> &lo,
+    const Vec3Packet<T,N> &hi,
+    const Packet<T,N> &u)
+{
+    return {Lerp(lo.x, hi.x, u), Lerp(lo.y, hi.y, u), Lerp(lo.z, hi.z, u)};
+}
+
+///
+/// @brief Select the vectors of u where the mask is set and of v otherwise.
+///
+template<typename T, size_t N>
+inline Vec3Packet<T,N> Select(
+    const MaskPacket<T,N> &mask,
+    const Vec3Packet<T,N> &u,
+    const Vec3Packet<T,N> &v)
+{
+    return {
+        Select(mask, u.x, v.x),
+        Select(mask, u.y, v.y),
+        Select(mask, u.z, v.z)};
+}
+
+} // inline namespace MATH_SIMD_ISA
+} // namespace Math
+
+/// ---- simd implementations ------------------------------------------------
+#ifdef __AVX__
+#include "simd/packet.h"
+#endif
+
+#endif // MATH_PACKET_H_
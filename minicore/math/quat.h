@@ -0,0 +1,429 @@
+//
+// quat.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_QUAT_H_
+#define MATH_QUAT_H_
+
+#include <cmath>
+#include <type_traits>
+#include "vector.h"
+#include "matrix.h"
+#include "algebra.h"
+#include "ortho.h"
+#include "simd/isa.h"
+
+namespace Math {
+
+///
+/// @brief Quat is a quaternion q = w + xi + yj + zk, with the vector part in
+/// the first three elements and the scalar part in the last. A unit quaternion
+/// represents the rotation of angle theta around the unit axis n,
+///
+///  q = {n*sin(theta/2), cos(theta/2)},
+///
+/// the same rotation as Rotate(n, theta). The product of two quaternions a*b
+/// is the rotation b followed by the rotation a, the same as Dot(ma, mb) of
+/// the corresponding matrices.
+///
+/// The quaternion is interpreted as one 256-bit (4x64) memory block, or one
+/// 128-bit (4x32) memory block in single precision, the same as a Vec4.
+///
+/// ---- Quaternion data types ------------------------------------------------
+template<typename T>
+struct Quat {
+    static_assert(std::is_floating_point<T>::value, "non floating point");
+    static const Quat Identity;
+    static const size_t length = 4;
+
+    union {
+        alignas(32) T data[length];
+        struct { T x, y, z, w; };
+    };
+
+    constexpr T &operator[](size_t i) { return data[i]; }
+    constexpr const T &operator[](size_t i) const { return data[i]; }
+
+    // Create a quaternion from a rotation of angle theta around the axis n.
+    static Quat<T> CreateFromAxisAngle(Vec3<T> n, const T theta);
+
+    // Create a quaternion from a rotation matrix or an orthonormal basis.
+    static Quat<T> CreateFromMat3(const Mat3<T> &m);
+    static Quat<T> CreateFromMat4(const Mat4<T> &m);
+    static Quat<T> CreateFromOrtho(const Ortho<T> &basis);
+};
+
+typedef Quat<float>  Quatf;
+typedef Quat<double> Quatd;
+
+/// ---- Quaternion constants -------------------------------------------------
+template<typename T>
+constexpr Quat<T> Quat<T>::Identity = {(T) 0, (T) 0, (T) 0, (T) 1};
+
+inline namespace MATH_SIMD_ISA {
+
+/// ---- Quaternion declarations ----------------------------------------------
+/// Compound assignment operators.
+template<typename T>
+constexpr Quat<T> &operator+=(Quat<T> &lhs, const Quat<T> &rhs);
+template<typename T>
+constexpr Quat<T> &operator-=(Quat<T> &lhs, const Quat<T> &rhs);
+template<typename T>
+constexpr Quat<T> &operator*=(Quat<T> &lhs, const Quat<T> &rhs);
+template<typename T>
+constexpr Quat<T> &operator*=(Quat<T> &lhs, const T scalar);
+
+/// Arithmetic operators.
+template<typename T>
+constexpr Quat<T> operator+(Quat<T> lhs, const Quat<T> &rhs);
+template<typename T>
+constexpr Quat<T> operator-(Quat<T> lhs, const Quat<T> &rhs);
+template<typename T>
+constexpr Quat<T> operator*(Quat<T> lhs, const Quat<T> &rhs);
+template<typename T> constexpr Quat<T> operator*(Quat<T> lhs, const T scalar);
+template<typename T> constexpr Quat<T> operator*(const T scalar, Quat<T> rhs);
+
+/// Unary operators.
+template<typename T> constexpr Quat<T> operator+(Quat<T> lhs);
+template<typename T> constexpr Quat<T> operator-(Quat<T> lhs);
+
+/// Quaternion algebra.
+template<typename T> constexpr T Dot(const Quat<T> &a, const Quat<T> &b);
+template<typename T> inline T Norm(const Quat<T> &a);
+template<typename T> inline Quat<T> Normalize(const Quat<T> &a);
+template<typename T> constexpr Quat<T> Conjugate(const Quat<T> &a);
+template<typename T> constexpr Quat<T> Inverse(const Quat<T> &a);
+
+/// Rotation of a vector by a unit quaternion.
+template<typename T>
+constexpr Vec3<T> Rotate(const Quat<T> &q, const Vec3<T> &v);
+
+/// Interpolation between two unit quaternions.
+template<typename T>
+inline Quat<T> Nlerp(const Quat<T> &a, const Quat<T> &b, const T t);
+template<typename T>
+inline Quat<T> Slerp(const Quat<T> &a, const Quat<T> &b, const T t);
+
+/// Conversion to rotation matrices and orthonormal bases.
+template<typename T> constexpr Mat3<T> ToMat3(const Quat<T> &q);
+template<typename T> constexpr Mat4<T> ToMat4(const Quat<T> &q);
+template<typename T> inline Ortho<T> ToOrtho(const Quat<T> &q);
+
+/// ---- Quaternion compound assignment operators -----------------------------
+///
+template<typename T>
+constexpr Quat<T> &operator+=(Quat<T> &lhs, const Quat<T> &rhs)
+{
+    return Detail::ScalarAdd(lhs, rhs);
+}
+
+template<typename T>
+constexpr Quat<T> &operator-=(Quat<T> &lhs, const Quat<T> &rhs)
+{
+    return Detail::ScalarSub(lhs, rhs);
+}
+
+///
+/// @brief Hamilton product of two quaternions,
+///  a*b = {aw*bv + bw*av + av x bv, aw*bw - av.bv}.
+///
+namespace Detail {
+template<typename T>
+constexpr Quat<T> &ScalarQuatMul(Quat<T> &lhs, const Quat<T> &rhs)
+{
+    const T ax = lhs[0], ay = lhs[1], az = lhs[2], aw = lhs[3];
+    const T bx = rhs[0], by = rhs[1], bz = rhs[2], bw = rhs[3];
+    lhs[0] = aw * bx + ax * bw + ay * bz - az * by;
+    lhs[1] = aw * by - ax * bz + ay * bw + az * bx;
+    lhs[2] = aw * bz + ax * by - ay * bx + az * bw;
+    lhs[3] = aw * bw - ax * bx - ay * by - az * bz;
+    return lhs;
+}
+} // namespace Detail
+
+template<typename T>
+constexpr Quat<T> &operator*=(Quat<T> &lhs, const Quat<T> &rhs)
+{
+    return Detail::ScalarQuatMul(lhs, rhs);
+}
+
+template<typename T>
+constexpr Quat<T> &operator*=(Quat<T> &lhs, const T scalar)
+{
+    return Detail::ScalarMul(lhs, scalar);
+}
+
+/// ---- Quaternion arithmetic operators --------------------------------------
+///
+template<typename T>
+constexpr Quat<T> operator+(Quat<T> lhs, const Quat<T> &rhs)
+{
+    return lhs += rhs;
+}
+
+template<typename T>
+constexpr Quat<T> operator-(Quat<T> lhs, const Quat<T> &rhs)
+{
+    return lhs -= rhs;
+}
+
+template<typename T>
+constexpr Quat<T> operator*(Quat<T> lhs, const Quat<T> &rhs)
+{
+    return lhs *= rhs;
+}
+
+template<typename T>
+constexpr Quat<T> operator*(Quat<T> lhs, const T scalar)
+{
+    return lhs *= scalar;
+}
+
+template<typename T>
+constexpr Quat<T> operator*(const T scalar, Quat<T> rhs)
+{
+    return rhs *= scalar;
+}
+
+template<typename T>
+constexpr Quat<T> operator+(Quat<T> lhs) { return lhs; }
+template<typename T>
+constexpr Quat<T> operator-(Quat<T> lhs) { return lhs *= (T) -1; }
+
+/// ---- Quaternion algebra ---------------------------------------------------
+///
+/// @brief Return the dot product and the norm of the quaternions.
+///
+namespace Detail {
+template<typename T>
+constexpr T ScalarDot(const Quat<T> &a, const Quat<T> &b)
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+}
+} // namespace Detail
+
+template<typename T>
+constexpr T Dot(const Quat<T> &a, const Quat<T> &b)
+{
+    return Detail::ScalarDot(a, b);
+}
+
+template<typename T>
+inline T Norm(const Quat<T> &a)
+{
+    return std::sqrt(Dot(a, a));
+}
+
+///
+/// @brief Return the unit quaternion with the direction of a.
+///
+template<typename T>
+inline Quat<T> Normalize(const Quat<T> &a)
+{
+    return a * ((T) 1 / Norm(a));
+}
+
+///
+/// @brief Return the conjugate and the inverse of the quaternion. The inverse
+/// of a unit quaternion is its conjugate, the inverse rotation.
+///
+template<typename T>
+constexpr Quat<T> Conjugate(const Quat<T> &a)
+{
+    return {-a[0], -a[1], -a[2], a[3]};
+}
+
+template<typename T>
+constexpr Quat<T> Inverse(const Quat<T> &a)
+{
+    return Conjugate(a) * ((T) 1 / Dot(a, a));
+}
+
+///
+/// @brief Rotate the vector by the unit quaternion, v' = q*v*q^-1, expanded as
+///  t  = 2 * (qv x v)
+///  v' = v + qw*t + qv x t
+/// which takes 18 multiplications instead of the 32 of the two products.
+///
+template<typename T>
+constexpr Vec3<T> Rotate(const Quat<T> &q, const Vec3<T> &v)
+{
+    const T tx = (T) 2 * (q[1] * v[2] - q[2] * v[1]);
+    const T ty = (T) 2 * (q[2] * v[0] - q[0] * v[2]);
+    const T tz = (T) 2 * (q[0] * v[1] - q[1] * v[0]);
+    return {v[0] + q[3] * tx + (q[1] * tz - q[2] * ty),
+            v[1] + q[3] * ty + (q[2] * tx - q[0] * tz),
+            v[2] + q[3] * tz + (q[0] * ty - q[1] * tx)};
+}
+
+/// ---- Quaternion interpolation ---------------------------------------------
+///
+/// @brief Normalized linear interpolation between two unit quaternions along
+/// the shortest path. The result is not interpolated at a constant angular
+/// velocity, but it is close to Slerp for nearby orientations and cheaper.
+///
+template<typename T>
+inline Quat<T> Nlerp(const Quat<T> &a, const Quat<T> &b, const T t)
+{
+    const T s = (Dot(a, b) < (T) 0) ? -t : t;
+    return Normalize(a * ((T) 1 - t) + b * s);
+}
+
+///
+/// @brief Spherical linear interpolation between two unit quaternions along
+/// the shortest path, at constant angular velocity. Fall back to Nlerp if
+/// the quaternions are nearly parallel and sin(theta) vanishes.
+///
+template<typename T>
+inline Quat<T> Slerp(const Quat<T> &a, const Quat<T> &b, const T t)
+{
+    T cos_theta = Dot(a, b);
+    T sign = (T) 1;
+    if (cos_theta < (T) 0) {
+        cos_theta = -cos_theta;
+        sign = (T) -1;
+    }
+
+    const T kThreshold = (T) 0.9995;
+    if (cos_theta > kThreshold) {
+        return Nlerp(a, b, t);
+    }
+
+    const T theta = std::acos(cos_theta);
+    const T inv_sin_theta = (T) 1 / std::sin(theta);
+    const T wa = std::sin(((T) 1 - t) * theta) * inv_sin_theta;
+    const T wb = std::sin(t * theta) * inv_sin_theta * sign;
+    return a * wa + b * wb;
+}
+
+} // inline namespace MATH_SIMD_ISA
+
+/// ---- Quaternion conversions -----------------------------------------------
+///
+/// @brief Create a quaternion from a rotation of angle theta around the n-axis,
+/// the same rotation as Rotate(n, theta).
+///
+template<typename T>
+inline Quat<T> Quat<T>::CreateFromAxisAngle(Vec3<T> n, const T theta)
+{
+    n = Normalize(n);
+    const T s = std::sin((T) 0.5 * theta);
+    const T c = std::cos((T) 0.5 * theta);
+    return {n.x * s, n.y * s, n.z * s, c};
+}
+
+///
+/// @brief Create a quaternion from the rotation matrix, using the largest of
+/// the diagonal terms to avoid the cancellation of small square roots.
+/// @see Shepperd, Quaternion from rotation matrix, J. Guidance and Control,
+///      1(3), 1978.
+///
+template<typename T>
+inline Quat<T> Quat<T>::CreateFromMat3(const Mat3<T> &m)
+{
+    Quat<T> q;
+    const T trace = m.xx + m.yy + m.zz;
+    if (trace > (T) 0) {
+        T s = (T) 2 * std::sqrt(trace + (T) 1);
+        q.x = (m.zy - m.yz) / s;
+        q.y = (m.xz - m.zx) / s;
+        q.z = (m.yx - m.xy) / s;
+        q.w = (T) 0.25 * s;
+    } else if (m.xx > m.yy && m.xx > m.zz) {
+        T s = (T) 2 * std::sqrt((T) 1 + m.xx - m.yy - m.zz);
+        q.x = (T) 0.25 * s;
+        q.y = (m.xy + m.yx) / s;
+        q.z = (m.xz + m.zx) / s;
+        q.w = (m.zy - m.yz) / s;
+    } else if (m.yy > m.zz) {
+        T s = (T) 2 * std::sqrt((T) 1 + m.yy - m.xx - m.zz);
+        q.x = (m.xy + m.yx) / s;
+        q.y = (T) 0.25 * s;
+        q.z = (m.yz + m.zy) / s;
+        q.w = (m.xz - m.zx) / s;
+    } else {
+        T s = (T) 2 * std::sqrt((T) 1 + m.zz - m.xx - m.yy);
+        q.x = (m.xz + m.zx) / s;
+        q.y = (m.yz + m.zy) / s;
+        q.z = (T) 0.25 * s;
+        q.w = (m.yx - m.xy) / s;
+    }
+    return q;
+}
+
+template<typename T>
+inline Quat<T> Quat<T>::CreateFromMat4(const Mat4<T> &m)
+{
+    return CreateFromMat3({m.xx, m.xy, m.xz,
+                           m.yx, m.yy, m.yz,
+                           m.zx, m.zy, m.zz});
+}
+
+///
+/// @brief Create a quaternion from the orthonormal basis, the rotation that
+/// maps the world axes onto the basis vectors, LocalToWorld. The basis must
+/// be right-handed.
+///
+template<typename T>
+inline Quat<T> Quat<T>::CreateFromOrtho(const Ortho<T> &basis)
+{
+    return CreateFromMat3({basis.u.x, basis.v.x, basis.w.x,
+                           basis.u.y, basis.v.y, basis.w.y,
+                           basis.u.z, basis.v.z, basis.w.z});
+}
+
+inline namespace MATH_SIMD_ISA {
+
+///
+/// @brief Return the rotation matrix of the unit quaternion.
+///
+template<typename T>
+constexpr Mat3<T> ToMat3(const Quat<T> &q)
+{
+    const T xx = q[0] * q[0], yy = q[1] * q[1], zz = q[2] * q[2];
+    const T xy = q[0] * q[1], xz = q[0] * q[2], yz = q[1] * q[2];
+    const T wx = q[3] * q[0], wy = q[3] * q[1], wz = q[3] * q[2];
+    return {(T) 1 - (T) 2 * (yy + zz), (T) 2 * (xy - wz), (T) 2 * (xz + wy),
+            (T) 2 * (xy + wz), (T) 1 - (T) 2 * (xx + zz), (T) 2 * (yz - wx),
+            (T) 2 * (xz - wy), (T) 2 * (yz + wx), (T) 1 - (T) 2 * (xx + yy)};
+}
+
+template<typename T>
+constexpr Mat4<T> ToMat4(const Quat<T> &q)
+{
+    const Mat3<T> m = ToMat3(q);
+    return {m[0],  m[1],  m[2],  (T) 0,
+            m[3],  m[4],  m[5],  (T) 0,
+            m[6],  m[7],  m[8],  (T) 0,
+            (T) 0, (T) 0, (T) 0, (T) 1};
+}
+
+///
+/// @brief Return the orthonormal basis of the unit quaternion, the columns of
+/// its rotation matrix.
+///
+template<typename T>
+inline Ortho<T> ToOrtho(const Quat<T> &q)
+{
+    const Mat3<T> m = ToMat3(q);
+    Ortho<T> basis;
+    basis.u = {m.xx, m.yx, m.zx};
+    basis.v = {m.xy, m.yy, m.zy};
+    basis.w = {m.xz, m.yz, m.zz};
+    return basis;
+}
+
+} // inline namespace MATH_SIMD_ISA
+} // namespace Math
+
+/// ---- simd implementations ------------------------------------------------
+#ifdef __AVX__
+#include "simd/quat.h"
+#endif
+
+#endif // MATH_QUAT_H_
@@ -0,0 +1,555 @@
+//
+// random.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <algorithm>
+#include "dispatch.h"
+#include "random.h"
+
+namespace Math {
+
+///
+/// @brief Create n random number generators from consecutive numbers of a
+/// SplitMix64 generator.
+///
+std::vector<RandomEngine> CreateRandomEngines(
+    const size_t n,
+    const uint64_t seed)
+{
+    std::vector<RandomEngine> engines(n);
+    uint64_t state = seed;
+    for (auto &eng : engines) {
+        eng = NextRandomEngine(state);
+    }
+    return engines;
+}
+
+std::vector<RandomEngine> CreateRandomEngines(const size_t n)
+{
+    RandomDevice device;
+    return CreateRandomEngines(n, device());
+}
+
+/// ---- Modular arithmetic ---------------------------------------------------
+///
+/// @brief Return (a + b) mod p, for a, b < p < 2^64, without overflow.
+///
+static uint64_t AddMod(const uint64_t a, const uint64_t b, const uint64_t p)
+{
+    return (a >= p - b) ? a - (p - b) : a + b;
+}
+
+///
+/// @brief Montgomery form of the integers modulo an odd n, x -> x * 2^64 mod n.
+/// The product of two numbers in Montgomery form is reduced by subtracting
+/// the multiple m * n with the same low word, m = lo * n^-1 mod 2^64, and
+/// keeping the high word.
+///
+namespace {
+struct Montgomery {
+    uint64_t n;         // odd modulus
+    uint64_t inv;       // n^-1 mod 2^64
+    uint64_t one;       // 2^64 mod n
+    uint64_t r2;        // 2^128 mod n
+
+    explicit Montgomery(const uint64_t n) : n(n) {
+        // Newton iteration, each step doubles the correct low bits of the
+        // inverse, and n * n = 1 mod 8 for odd n.
+        inv = n;
+        for (size_t k = 0; k < 5; ++k) {
+            inv *= 2 - n * inv;
+        }
+        one = (0 - n) % n;
+        r2 = one;
+        for (size_t k = 0; k < 64; ++k) {
+            r2 = AddMod(r2, r2, n);
+        }
+    }
+
+    uint64_t Mul(const uint64_t a, const uint64_t b) const {
+        uint64_t lo;
+        uint64_t hi = Detail::MulHiLo64(a, b, lo);
+        uint64_t mn_lo;
+        uint64_t mn_hi = Detail::MulHiLo64(lo * inv, n, mn_lo);
+        return (hi >= mn_hi) ? hi - mn_hi : hi - mn_hi + n;
+    }
+
+    uint64_t Pow(uint64_t a, uint64_t e) const {
+        uint64_t result = one;
+        while (e > 0) {
+            if (e & 1) {
+                result = Mul(result, a);
+            }
+            a = Mul(a, a);
+            e >>= 1;
+        }
+        return result;
+    }
+
+    uint64_t To(const uint64_t a) const { return Mul(a % n, r2); }
+};
+} // namespace
+
+/// ---- Random number generator jump-ahead -----------------------------------
+///
+/// @brief Transition of the random engine generators over a fixed number of
+/// steps: the affine map of the linear congruential generator, the columns
+/// of the xorshift bit matrix, and the powers of the multiply-with-carry
+/// multipliers in Montgomery form, so that the product of a state with a
+/// power is a single Montgomery multiplication.
+///
+namespace {
+struct RandomJump {
+    uint64_t mul;
+    uint64_t add;
+    uint64_t cols[64];
+    uint64_t pow1;
+    uint64_t pow2;
+};
+} // namespace
+
+static const uint64_t kRandomM1 = 1490024343005336237ULL;
+static const uint64_t kRandomM2 = 123456789ULL;
+static const uint64_t kRandomM3 = 4294584393ULL;
+static const uint64_t kRandomM4 = 4246477509ULL;
+
+///
+/// @brief Montgomery form modulo the multiply-with-carry modulus m * 2^32 - 1
+/// of each multiplier.
+///
+static const Montgomery &MwcModulus(const uint64_t m)
+{
+    static const Montgomery mont3((kRandomM3 << 32) - 1);
+    static const Montgomery mont4((kRandomM4 << 32) - 1);
+    return (m == kRandomM3) ? mont3 : mont4;
+}
+
+///
+/// @brief Return the product of the bit matrix with the vector, the xor of
+/// the columns selected by the bits of the vector.
+///
+static uint64_t BitMatVec(const uint64_t cols[64], uint64_t v)
+{
+    uint64_t result = 0;
+    for (size_t j = 0; v != 0; ++j, v >>= 1) {
+        if (v & 1) {
+            result ^= cols[j];
+        }
+    }
+    return result;
+}
+
+///
+/// @brief Create the transition of the generators over n steps.
+///
+static RandomJump CreateRandomJump(uint64_t n)
+{
+    RandomJump jump;
+
+    // Linear congruential generator, compose the affine maps of the set
+    // bits of n.
+    uint64_t mul = kRandomM1;
+    uint64_t add = kRandomM2;
+    jump.mul = 1;
+    jump.add = 0;
+
+    // Xorshift register generator, the columns of the one step matrix are
+    // the images of the unit vectors.
+    uint64_t cols[64];
+    for (size_t j = 0; j < 64; ++j) {
+        uint64_t y = (uint64_t) 1 << j;
+        y ^= y << 21;
+        y ^= y >> 17;
+        y ^= y << 30;
+        cols[j] = y;
+        jump.cols[j] = (uint64_t) 1 << j;
+    }
+
+    // Multiply-with-carry generators.
+    const Montgomery &mont3 = MwcModulus(kRandomM3);
+    const Montgomery &mont4 = MwcModulus(kRandomM4);
+    jump.pow1 = mont3.Pow(mont3.To(kRandomM3), n);
+    jump.pow2 = mont4.Pow(mont4.To(kRandomM4), n);
+
+    while (n > 0) {
+        if (n & 1) {
+            jump.mul *= mul;
+            jump.add = jump.add * mul + add;
+            for (size_t j = 0; j < 64; ++j) {
+                jump.cols[j] = BitMatVec(cols, jump.cols[j]);
+            }
+        }
+
+        add *= mul + 1;
+        mul *= mul;
+
+        uint64_t squared[64];
+        for (size_t j = 0; j < 64; ++j) {
+            squared[j] = BitMatVec(cols, cols[j]);
+        }
+        std::copy(&squared[0], &squared[64], &cols[0]);
+        n >>= 1;
+    }
+    return jump;
+}
+
+///
+/// @brief Apply the transition to the generators of the engine. The second
+/// multiply-with-carry generator is only advanced by the 64-bit steps.
+///
+static void ApplyRandomJump(
+    const RandomJump &jump,
+    RandomEngine &eng,
+    const bool step64)
+{
+    auto mwc = [] (uint32_t &z, uint32_t &c, uint64_t m, uint64_t pow) {
+        const Montgomery &mont = MwcModulus(m);
+        uint64_t v = ((uint64_t) c << 32) | z;
+        if (v < mont.n) {
+            v = mont.Mul(v, pow);
+        }
+        z = (uint32_t) v;
+        c = (uint32_t) (v >> 32);
+    };
+
+    eng.x = jump.mul * eng.x + jump.add;
+    eng.y = BitMatVec(jump.cols, eng.y);
+    mwc(eng.z1, eng.c1, kRandomM3, jump.pow1);
+    if (step64) {
+        mwc(eng.z2, eng.c2, kRandomM4, jump.pow2);
+    }
+}
+
+///
+/// @brief Advance the random engine by n steps of Random32 or Random64.
+///
+void Jump32(RandomEngine &eng, const uint64_t n)
+{
+    ApplyRandomJump(CreateRandomJump(n), eng, false);
+}
+
+void Jump64(RandomEngine &eng, const uint64_t n)
+{
+    ApplyRandomJump(CreateRandomJump(n), eng, true);
+}
+
+///
+/// @brief Split the sequence of the random engine into n streams. The
+/// transition over the stream length is created once and applied to each
+/// stream in turn.
+///
+std::vector<RandomEngine> Split(const RandomEngine &eng, const size_t n)
+{
+    std::vector<RandomEngine> engines;
+    if (n == 0) {
+        return engines;
+    }
+
+    const RandomJump jump = CreateRandomJump(UINT64_MAX / n);
+    engines.reserve(n);
+    engines.push_back(eng);
+    for (size_t k = 1; k < n; ++k) {
+        RandomEngine next = engines.back();
+        ApplyRandomJump(jump, next, true);
+        engines.push_back(next);
+    }
+    return engines;
+}
+
+/// ---- Prime numbers --------------------------------------------------------
+static const uint64_t kPrimeDivisors[12] = {
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+static const uint64_t kPrimeWitnesses[7] = {
+    2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+
+///
+/// @brief Miller-Rabin test of an odd n > 37 with the witness a. Write
+/// n - 1 = d * 2^s with d odd. A prime n has a^d = 1 or a^(d*2^r) = -1 for
+/// some r < s. A witness that is a multiple of n proves nothing and passes.
+///
+static bool MillerRabin(
+    const Montgomery &mont,
+    const uint64_t d,
+    const size_t s,
+    const uint64_t a)
+{
+    if (a % mont.n == 0) {
+        return true;
+    }
+    const uint64_t minus_one = mont.n - mont.one;
+    uint64_t x = mont.Pow(mont.To(a), d);
+    if (x == mont.one || x == minus_one) {
+        return true;
+    }
+    for (size_t r = 1; r < s; ++r) {
+        x = mont.Mul(x, x);
+        if (x == minus_one) {
+            return true;
+        }
+    }
+    return false;
+}
+
+///
+/// @brief Return true if n is a prime number.
+///
+bool IsPrime(const uint64_t n)
+{
+    if (n < 2) {
+        return false;
+    }
+    for (auto &p : kPrimeDivisors) {
+        if (n % p == 0) {
+            return n == p;
+        }
+    }
+    if (n < 41 * 41) {
+        return true;
+    }
+
+    uint64_t d = n - 1;
+    size_t s = 0;
+    while ((d & 1) == 0) {
+        d >>= 1;
+        ++s;
+    }
+
+    const Montgomery mont(n);
+    for (auto &a : kPrimeWitnesses) {
+        if (!MillerRabin(mont, d, s, a)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+///
+/// @brief Odd primes below 256 sieving the candidates of PrevPrime, in
+/// windows of kPrimeWindow numbers.
+///
+static const size_t kSievePrimesMax = 256;
+static const size_t kPrimeWindow = 256;
+
+static const std::vector<uint32_t> &SievePrimes()
+{
+    static const std::vector<uint32_t> primes = [] () {
+        std::vector<uint32_t> result;
+        for (uint32_t p = 3; p < kSievePrimesMax; p += 2) {
+            if (IsPrime(p)) {
+                result.push_back(p);
+            }
+        }
+        return result;
+    }();
+    return primes;
+}
+
+///
+/// @brief Return the largest prime number smaller than or equal to n. Item i
+/// of the window is the candidate hi - i, and is a multiple of p if
+/// i = hi mod p (mod p). The primes themselves are not marked.
+///
+uint64_t PrevPrime(const uint64_t n)
+{
+    const std::vector<uint32_t> &primes = SievePrimes();
+    bool composite[kPrimeWindow];
+
+    uint64_t hi = n;
+    while (hi >= 2) {
+        size_t width = (size_t) std::min((uint64_t) kPrimeWindow, hi - 1);
+        std::fill(&composite[0], &composite[width], false);
+        for (auto &p : primes) {
+            for (size_t i = hi % p; i < width; i += p) {
+                if (hi - i != p) {
+                    composite[i] = true;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < width; ++i) {
+            uint64_t c = hi - i;
+            if ((c & 1) == 0 && c != 2) {
+                continue;
+            }
+            if (!composite[i] && IsPrime(c)) {
+                return c;
+            }
+        }
+        hi -= width;
+    }
+    return 0;
+}
+
+///
+/// @brief Return a random 64-bit prime number.
+///
+uint64_t RandomPrime(RandomDevice &device)
+{
+    uint64_t number = device();
+    uint64_t prime = PrevPrime(number);
+    return (prime != 0) ? prime : number;
+}
+
+///
+/// @brief Floating point numbers are converted from blocks of integers, a
+/// multiple of the number of lanes, so that only the last step of the array
+/// may be partial.
+///
+static const size_t kRandomBlockSize = 1024;
+
+///
+/// @brief Fill an array with the 32-bit or 64-bit random numbers of the lanes,
+/// with the kernels of the highest instruction set level supported by the cpu.
+///
+void RandomFill(RandomLanes &lanes, uint32_t *dst, const size_t count)
+{
+    GetKernels().randomFill32(lanes, dst, count);
+}
+
+void RandomFill(RandomLanes &lanes, uint64_t *dst, const size_t count)
+{
+    GetKernels().randomFill64(lanes, dst, count);
+}
+
+///
+/// @brief Fill an array with uniform random numbers in [0, 1), from the upper
+/// 24 bits of the 32-bit numbers for floats and the upper 53 bits of the
+/// 64-bit numbers for doubles. Every number is exactly representable.
+///
+void RandomFill(RandomLanes &lanes, float *dst, const size_t count)
+{
+    const Kernels &kernels = GetKernels();
+    uint32_t block[kRandomBlockSize];
+    for (size_t i = 0; i < count; i += kRandomBlockSize) {
+        size_t n = std::min(kRandomBlockSize, count - i);
+        kernels.randomFill32(lanes, block, n);
+        for (size_t j = 0; j < n; ++j) {
+            dst[i + j] = (float) (block[j] >> 8) * 5.9604644775390625E-8f;
+        }
+    }
+}
+
+void RandomFill(RandomLanes &lanes, double *dst, const size_t count)
+{
+    const Kernels &kernels = GetKernels();
+    uint64_t block[kRandomBlockSize];
+    for (size_t i = 0; i < count; i += kRandomBlockSize) {
+        size_t n = std::min(kRandomBlockSize, count - i);
+        kernels.randomFill64(lanes, block, n);
+        for (size_t j = 0; j < n; ++j) {
+            dst[i + j] = (double) (block[j] >> 11) * 1.1102230246251565E-16;
+        }
+    }
+}
+
+///
+/// @brief Fill an array with the 32-bit words of the stream, starting at the
+/// index of the first word. The whole blocks are computed by the kernels in
+/// place, and the partial blocks at both ends through a buffer.
+///
+static void RandomStreamWords(
+    const Kernels &kernels,
+    const RandomStream &stream,
+    const uint64_t first,
+    uint32_t *dst,
+    const size_t count)
+{
+    uint32_t out[4];
+    uint64_t block = first / 4;
+    size_t i = 0;
+
+    if (first % 4 != 0 && count > 0) {
+        kernels.randomStream(stream, block++, out, 1);
+        size_t n = std::min((size_t) (4 - first % 4), count);
+        std::copy(&out[first % 4], &out[first % 4 + n], dst);
+        i += n;
+    }
+
+    size_t num_blocks = (count - i) / 4;
+    kernels.randomStream(stream, block, &dst[i], num_blocks);
+    block += num_blocks;
+    i += 4 * num_blocks;
+
+    if (i < count) {
+        kernels.randomStream(stream, block, out, 1);
+        std::copy(&out[0], &out[count - i], &dst[i]);
+    }
+}
+
+///
+/// @brief Fill an array with the 32-bit or 64-bit random numbers of the
+/// stream. The 64-bit numbers are assembled from pairs of words converted in
+/// blocks.
+///
+void RandomFill(
+    const RandomStream &stream,
+    const uint64_t first,
+    uint32_t *dst,
+    const size_t count)
+{
+    RandomStreamWords(GetKernels(), stream, first, dst, count);
+}
+
+void RandomFill(
+    const RandomStream &stream,
+    const uint64_t first,
+    uint64_t *dst,
+    const size_t count)
+{
+    const Kernels &kernels = GetKernels();
+    uint32_t block[kRandomBlockSize];
+    for (size_t i = 0; i < count; i += kRandomBlockSize / 2) {
+        size_t n = std::min(kRandomBlockSize / 2, count - i);
+        RandomStreamWords(kernels, stream, 2 * (first + i), block, 2 * n);
+        for (size_t j = 0; j < n; ++j) {
+            dst[i + j] = (uint64_t) block[2*j] |
+                ((uint64_t) block[2*j + 1] << 32);
+        }
+    }
+}
+
+///
+/// @brief Fill an array with uniform random numbers in [0, 1) of the stream.
+///
+void RandomFill(
+    const RandomStream &stream,
+    const uint64_t first,
+    float *dst,
+    const size_t count)
+{
+    const Kernels &kernels = GetKernels();
+    uint32_t block[kRandomBlockSize];
+    for (size_t i = 0; i < count; i += kRandomBlockSize) {
+        size_t n = std::min(kRandomBlockSize, count - i);
+        RandomStreamWords(kernels, stream, first + i, block, n);
+        for (size_t j = 0; j < n; ++j) {
+            dst[i + j] = (float) (block[j] >> 8) * 5.9604644775390625E-8f;
+        }
+    }
+}
+
+void RandomFill(
+    const RandomStream &stream,
+    const uint64_t first,
+    double *dst,
+    const size_t count)
+{
+    const Kernels &kernels = GetKernels();
+    uint32_t block[kRandomBlockSize];
+    for (size_t i = 0; i < count; i += kRandomBlockSize / 2) {
+        size_t n = std::min(kRandomBlockSize / 2, count - i);
+        RandomStreamWords(kernels, stream, 2 * (first + i), block, 2 * n);
+        for (size_t j = 0; j < n; ++j) {
+            uint64_t r = (uint64_t) block[2*j] |
+                ((uint64_t) block[2*j + 1] << 32);
+            dst[i + j] = (double) (r >> 11) * 1.1102230246251565E-16;
+        }
+    }
+}
+
+} // namespace Math
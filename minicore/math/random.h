@@ -10,7 +10,10 @@
 #ifndef MATH_RANDOM_H_
 #define MATH_RANDOM_H_
 
+#include <cstddef>
+#include <cstdint>
 #include <random>
+#include <vector>
 #include "algebra.h"
 #include "arithmetic.h"
 
@@ -29,46 +32,30 @@ struct RandomDevice {
 };
 
 ///
-/// @brief Return a random 64-bit prime number. Sample a random number from the
-/// device object and return the largest prime smaler than it.
-///
-/// Is n a prime number? Search for any divisor p < n. If none is found, then n
-/// is a prime. We only need to test i < (sqrt(n) + 1):
-///     If n = p * q, then
-///         p ≤ sqrt(n) or q ≤ sqrt(n), otherwise p*q > n.
-///     If p = q, then
-///         n = p * p and p = sqrt(n)
-///     If p != q, then
-///         p > sqrt(n) and q < sqrt(n)
-///     or
-///         p < sqrt(n) and q > sqrt(n)
-/// If there is no divisor p < sqrt(n), then n%p == 0, and n is a prime. Every
-/// even number larger than 2 is not prime.  If 2 does not divide n, then every
-/// other even number smaller than n will also not divide n.
-///
-inline uint64_t RandomPrime(RandomDevice &device)
-{
-    auto is_prime = [] (const uint64_t n) -> bool {
-        if (n%2 == 0) {         // Even numbers are not prime
-            return false;
-        }
-        uint64_t sqrt_n = (uint64_t) (std::sqrt((double) n) + 1.0);
-        for (uint64_t p = 3; p < sqrt_n; p += 2) {
-            if (n%p == 0) {     // If p is a divisor, n is not prime
-                return false;
-            }
-        }
-        return true;            // No divisors found, n is prime
-    };
+/// @brief Return true if n is a prime number. Numbers with a factor among the
+/// first 12 primes are rejected by division, and the others are tested by
+/// the Miller-Rabin test with the 7 witnesses of Jim Sinclair, which have no
+/// common strong pseudoprime below 2^64. The modular products use the
+/// Montgomery form, without 128-bit division.
+///
+/// @see https://miller-rabin.appspot.com
+///
+bool IsPrime(const uint64_t n);
 
-    uint64_t number = device();
-    for (uint64_t n = number; n >= 3; --n) {
-        if (is_prime(n)) {
-            return n;
-        }
-    }
-    return number;
-}
+///
+/// @brief Return the largest prime number smaller than or equal to n, or zero
+/// if n < 2. The candidates below n are sieved in windows by the odd primes
+/// smaller than 256, and only the few that survive are tested by IsPrime.
+///
+uint64_t PrevPrime(const uint64_t n);
+
+///
+/// @brief Return a random 64-bit prime number, the largest prime smaller than
+/// or equal to a random number sampled from the device object. Arrays of
+/// random primes are filled in parallel by the bulk sampler of a random
+/// stream, RandomPrime in distribution.h.
+///
+uint64_t RandomPrime(RandomDevice &device);
 
 /// -----------------------------------------------------------------------------
 /// @brief Random number generator state based on a 64-bit variant of George
@@ -95,45 +82,85 @@ struct RandomEngine {
 };
 
 ///
-/// @brief Create a random number generator using random initial seeds
+/// @brief Return the next number of the SplitMix64 generator and advance its
+/// state by the golden ratio increment. Consecutive states, however similar,
+/// return well mixed 64-bit numbers.
+///
+/// @see Steele, Lea, Flood, "Fast Splittable Pseudorandom Number Generators",
+///      https://doi.org/10.1145/2714064.2660195
+///
+inline uint64_t SplitMix64(uint64_t &state)
+{
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+///
+/// @brief Create the next random number generator of a SplitMix64 generator
+/// state, from its next 6 numbers:
 ///      0 < x  < 2^64,       linear congruential generator
 ///      0 < y  < 2^64,       xor-shift register generator
 ///      0 < z1 < 2^32,       multiply-with-carry generator 1
 ///      0 < c1 < 698769069U
 ///      0 < z2 < 2^32,       multiply-with-carry generator 2
 ///      0 < c2 < 698769069U
-/// Do not set y = 0 and avoid x = z1 = c1 = z2 = c2 = 0.
+/// The carries are mapped into their range by a multiply-high, and a zero
+/// number, which occurs with probability 2^-32 at most, is replaced by one.
 ///
-inline RandomEngine CreateRandomEngine()
+inline RandomEngine NextRandomEngine(uint64_t &state)
 {
-    // Generate a random odd number between 0 and n_max
-    RandomDevice device;
-    auto random_seed = [&](uint64_t n_max) -> uint64_t {
-        uint64_t n = device() % (n_max - 1);
-        if (n%2 == 0) { ++n; }  // even numbers are not prime
-        return n;
+    auto nonzero = [] (uint64_t n) -> uint64_t { return n != 0 ? n : 1; };
+    auto carry = [] (uint64_t n) -> uint32_t {
+        return 1U + (uint32_t) (((n >> 32) * (698769069ULL - 1)) >> 32);
     };
 
-    // Create a zeroth state.
-    RandomEngine eng = {};
-
-    // Seed the linear congruential generator state.
-    eng.x = random_seed(0xffffffffffffffff);
-
-    // Seed the xor-shift register generator state.
-    eng.y = random_seed(0xffffffffffffffff);
-
-    // Seed the first multiply-with-carry generator state.
-    eng.z1 = random_seed(0xffffffffffffffff);
-    eng.c1 = (uint32_t) random_seed(698769069ULL);
+    RandomEngine eng;
+    eng.x = nonzero(SplitMix64(state));
+    eng.y = nonzero(SplitMix64(state));
+    eng.z1 = (uint32_t) nonzero(SplitMix64(state) >> 32);
+    eng.c1 = carry(SplitMix64(state));
+    eng.z2 = (uint32_t) nonzero(SplitMix64(state) >> 32);
+    eng.c2 = carry(SplitMix64(state));
+    return eng;
+}
 
-    // Seed the second multiply-with-carry generator state.
-    eng.z2 = random_seed(0xffffffffffffffff);
-    eng.c2 = (uint32_t) random_seed(698769069ULL);
+///
+/// @brief Create a random number generator from a seed. The engine is a
+/// function of the seed only, for reproducible runs.
+///
+inline RandomEngine CreateRandomEngine(const uint64_t seed)
+{
+    uint64_t state = seed;
+    return NextRandomEngine(state);
+}
 
-    return eng;
+///
+/// @brief Create a random number generator from a random seed, drawn from the
+/// random device once.
+///
+inline RandomEngine CreateRandomEngine()
+{
+    RandomDevice device;
+    return CreateRandomEngine(device());
 }
 
+///
+/// @brief Create n random number generators from a seed, or from a single
+/// random seed drawn from the random device. The seed is expanded by one
+/// SplitMix64 generator into the states of all engines, and engine k is the
+/// same for any n > k. The engine of a seed is the first engine of the seed.
+///
+/// Use these to create the engines of many threads or tasks at once, rather
+/// than calling CreateRandomEngine in a loop, each call reading the random
+/// device.
+///
+std::vector<RandomEngine> CreateRandomEngines(
+    const size_t n,
+    const uint64_t seed);
+std::vector<RandomEngine> CreateRandomEngines(const size_t n);
+
 ///
 /// @brief 32-bit random number generator.
 ///
@@ -192,8 +219,412 @@ inline uint64_t Random64(RandomEngine &eng)
     return eng.x + eng.y + ((uint64_t) eng.z1) + ((uint64_t) eng.z2 << 32);
 }
 
+namespace Detail {
+
+///
+/// @brief Return the high 64 bits of the product of a and b, and the low 64
+/// bits in lo, with the 128-bit integer type of the compiler if available,
+/// otherwise from four 32-bit products.
+///
+inline uint64_t MulHiLo64(const uint64_t a, const uint64_t b, uint64_t &lo)
+{
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 p = (unsigned __int128) a * b;
+    lo = (uint64_t) p;
+    return (uint64_t) (p >> 64);
+#else
+    const uint64_t a_lo = a & 0xffffffff, a_hi = a >> 32;
+    const uint64_t b_lo = b & 0xffffffff, b_hi = b >> 32;
+    const uint64_t ll = a_lo * b_lo;
+    const uint64_t lh = a_lo * b_hi;
+    const uint64_t hl = a_hi * b_lo;
+    const uint64_t hh = a_hi * b_hi;
+    const uint64_t mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+    lo = (mid << 32) | (ll & 0xffffffff);
+    return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+///
+/// @brief Map the random number r to an integer uniform in [0, range), with
+/// Lemire's nearly divisionless method. The result is the high word of the
+/// product r * range. Products with a low word below 2^n mod range are
+/// rejected and redrawn from next(), so that the result is unbiased, and the
+/// modulo is only computed when the low word is below range.
+///
+template<typename Next>
+inline uint32_t Bounded32(uint32_t r, const uint32_t range, Next &next)
+{
+    uint64_t m = (uint64_t) r * range;
+    uint32_t l = (uint32_t) m;
+    if (l < range) {
+        const uint32_t t = (0U - range) % range;
+        while (l < t) {
+            m = (uint64_t) next() * range;
+            l = (uint32_t) m;
+        }
+    }
+    return (uint32_t) (m >> 32);
+}
+
+template<typename Next>
+inline uint64_t Bounded64(uint64_t r, const uint64_t range, Next &next)
+{
+    uint64_t l;
+    uint64_t h = MulHiLo64(r, range, l);
+    if (l < range) {
+        const uint64_t t = (0ULL - range) % range;
+        while (l < t) {
+            h = MulHiLo64(next(), range, l);
+        }
+    }
+    return h;
+}
+
+} // namespace Detail
+
+///
+/// @brief Return a 32-bit or 64-bit integer uniform in [0, range), or the
+/// full 32-bit or 64-bit random number if the range is zero.
+///
+inline uint32_t RandomBounded32(RandomEngine &eng, const uint32_t range)
+{
+    auto next = [&eng] () { return Random32(eng); };
+    return (range == 0) ? next() : Detail::Bounded32(next(), range, next);
+}
+
+inline uint64_t RandomBounded64(RandomEngine &eng, const uint64_t range)
+{
+    auto next = [&eng] () { return Random64(eng); };
+    return (range == 0) ? next() : Detail::Bounded64(next(), range, next);
+}
+
+/// ---- Random number generator jump-ahead -----------------------------------
+/// @brief Advance the random engine by n steps in O(log n) operations, to the
+/// state after n calls of Random32 or Random64. Each generator of the engine
+/// is advanced by composing its transition with itself:
+///
+///  Linear congruential generator
+///      x -> m1 * x + m2 is an affine map, composed by square and multiply.
+///
+///  Xorshift register generator
+///      y -> T * y is linear over GF(2), with T a 64x64 bit matrix raised to
+///      the power n by repeated squaring.
+///
+///  Multiply-with-carry generators
+///      v = c * 2^32 + z evolves as v -> m3 * v mod (m3 * 2^32 - 1), so that
+///      the state after n steps is m3^n * v modulo the same number.
+///
+/// The jump functions require c < m3 and c < m4, as set by CreateRandomEngine.
+/// Random32 does not advance the second multiply-with-carry generator, and
+/// neither does Jump32.
+///
+void Jump32(RandomEngine &eng, const uint64_t n);
+void Jump64(RandomEngine &eng, const uint64_t n);
+
+///
+/// @brief Split the sequence of the random engine into n streams, returning
+/// the engines at the start of each. Stream k starts k * floor((2^64-1) / n)
+/// steps after the engine, so that the streams do not overlap for as many
+/// steps, whichever of Random32 and Random64 draws them. Assigning stream k
+/// to thread or rank k gives reproducible results at any thread count.
+///
+std::vector<RandomEngine> Split(const RandomEngine &eng, const size_t n);
+
+/// ---- Random number generator lanes ----------------------------------------
+/// @brief Random number generator lanes hold the states of kRandomLanes
+/// independent random engines in structure of arrays layout, so that all
+/// lanes are advanced at once by the bulk fill functions:
+///
+///  RandomFill     fill an array with the 32-bit or 64-bit numbers of the
+///                 lanes, or with uniform floating point numbers in [0, 1).
+///
+/// Element i of the array is the number i / kRandomLanes of lane
+/// i % kRandomLanes, the same number Random32 or Random64 would return for
+/// an engine with the state of the lane. The numbers of a partial last step
+/// are discarded. The fill functions use the kernels of the highest
+/// instruction set level supported by the cpu, and every level returns the
+/// same numbers.
+///
+static const size_t kRandomLanes = 8;
+
+struct RandomLanes {
+    alignas(64) uint64_t x[kRandomLanes];   // linear congruential generators
+    alignas(64) uint64_t y[kRandomLanes];   // xor-shift generators
+    alignas(32) uint32_t z1[kRandomLanes];  // multiply-with-carry generators
+    alignas(32) uint32_t c1[kRandomLanes];
+    alignas(32) uint32_t z2[kRandomLanes];  // multiply-with-carry generators
+    alignas(32) uint32_t c2[kRandomLanes];
+};
+
+///
+/// @brief Return the random engine state of a lane.
+///
+inline RandomEngine GetRandomLane(const RandomLanes &lanes, const size_t lane)
+{
+    RandomEngine eng;
+    eng.x = lanes.x[lane];
+    eng.y = lanes.y[lane];
+    eng.z1 = lanes.z1[lane];
+    eng.c1 = lanes.c1[lane];
+    eng.z2 = lanes.z2[lane];
+    eng.c2 = lanes.c2[lane];
+    return eng;
+}
+
+///
+/// @brief Set the state of a lane to the random engine state.
+///
+inline void SetRandomLane(
+    RandomLanes &lanes,
+    const size_t lane,
+    const RandomEngine &eng)
+{
+    lanes.x[lane] = eng.x;
+    lanes.y[lane] = eng.y;
+    lanes.z1[lane] = eng.z1;
+    lanes.c1[lane] = eng.c1;
+    lanes.z2[lane] = eng.z2;
+    lanes.c2[lane] = eng.c2;
+}
+
+///
+/// @brief Create random number generator lanes, seeded as the engines
+/// created by CreateRandomEngines from a single random seed.
+///
+inline RandomLanes CreateRandomLanes()
+{
+    std::vector<RandomEngine> engines = CreateRandomEngines(kRandomLanes);
+    RandomLanes lanes;
+    for (size_t lane = 0; lane < kRandomLanes; ++lane) {
+        SetRandomLane(lanes, lane, engines[lane]);
+    }
+    return lanes;
+}
+
+///
+/// @brief Create random number generator lanes from the first kRandomLanes
+/// streams of the engine split. The lanes, and the numbers they fill, are a
+/// function of the engine state only.
+///
+inline RandomLanes CreateRandomLanes(const RandomEngine &eng)
+{
+    std::vector<RandomEngine> engines = Split(eng, kRandomLanes);
+    RandomLanes lanes;
+    for (size_t lane = 0; lane < kRandomLanes; ++lane) {
+        SetRandomLane(lanes, lane, engines[lane]);
+    }
+    return lanes;
+}
+
+///
+/// @brief Fill an array with the random numbers of the lanes.
+///
+void RandomFill(RandomLanes &lanes, uint32_t *dst, const size_t count);
+void RandomFill(RandomLanes &lanes, uint64_t *dst, const size_t count);
+void RandomFill(RandomLanes &lanes, float *dst, const size_t count);
+void RandomFill(RandomLanes &lanes, double *dst, const size_t count);
+
+/// ---- Counter-based random number generators -------------------------------
+/// @brief Counter-based random number generators map a 128-bit counter to a
+/// 128-bit block of random bits with a keyed bijection, so that any block of
+/// the sequence is computed independently of the others:
+///
+///  kRandomPhilox      Philox4x32-10, ten rounds of 32-bit multiplications,
+///                     with a 64-bit key.
+///  kRandomThreefry    Threefry4x32-20, twenty rounds of additions, rotations
+///                     and xors, with a 128-bit key.
+///
+/// A random stream is keyed by a 64-bit seed and a 64-bit stream id. Block b
+/// of the stream is the generator output for the counter {b, stream}, and
+/// the seed is the key, the upper key words of Threefry being zero. The 32-bit
+/// number i of the stream is word i % 4 of block i / 4, and the 64-bit number
+/// i is words 2*(i%2) and 2*(i%2)+1 of block i / 2, low word first.
+///
+/// Streams with different ids never overlap, and the numbers do not depend on
+/// how the sequence is partitioned between threads. The round functions only
+/// use 32-bit integer arithmetic, so that an OpenCL kernel evaluating them on
+/// the same counters returns the same numbers.
+///
+/// @see Salmon, Moraes, Dror, Shaw, "Parallel random numbers: as easy as
+///      1, 2, 3", SC11, https://doi.org/10.1145/2063384.2063405
+///
+enum RandomGenerator : uint32_t {
+    kRandomPhilox = 0,
+    kRandomThreefry
+};
+
+struct RandomStream {
+    uint32_t generator = kRandomPhilox;
+    uint32_t key[2] = {};               // seed
+    uint32_t stream[2] = {};            // stream id, upper counter words
+};
+
+///
+/// @brief Create a random stream of the generator, keyed by seed and stream.
+///
+inline RandomStream CreateRandomStream(
+    const uint64_t seed,
+    const uint64_t stream,
+    const uint32_t generator = kRandomPhilox)
+{
+    RandomStream s;
+    s.generator = generator;
+    s.key[0] = (uint32_t) seed;
+    s.key[1] = (uint32_t) (seed >> 32);
+    s.stream[0] = (uint32_t) stream;
+    s.stream[1] = (uint32_t) (stream >> 32);
+    return s;
+}
+
+///
+/// @brief Philox4x32-10 bijection of the counter under the key.
+///
+inline void Philox4x32(
+    const uint32_t counter[4],
+    const uint32_t key[2],
+    uint32_t out[4])
+{
+    static constexpr uint64_t m0 = 0xD2511F53ULL;
+    static constexpr uint64_t m1 = 0xCD9E8D57ULL;
+    static constexpr uint32_t w0 = 0x9E3779B9U;
+    static constexpr uint32_t w1 = 0xBB67AE85U;
+
+    uint32_t x0 = counter[0], x1 = counter[1], x2 = counter[2], x3 = counter[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    for (size_t round = 0; round < 10; ++round) {
+        uint64_t p0 = m0 * x0;
+        uint64_t p1 = m1 * x2;
+        x0 = (uint32_t) (p1 >> 32) ^ x1 ^ k0;
+        x1 = (uint32_t) p1;
+        x2 = (uint32_t) (p0 >> 32) ^ x3 ^ k1;
+        x3 = (uint32_t) p0;
+        k0 += w0;
+        k1 += w1;
+    }
+    out[0] = x0;
+    out[1] = x1;
+    out[2] = x2;
+    out[3] = x3;
+}
+
+///
+/// @brief Threefry4x32-20 bijection of the counter under the key, in five
+/// groups of four rounds with the rotation constants of Threefish, each
+/// followed by a key injection.
+///
+inline void Threefry4x32(
+    const uint32_t counter[4],
+    const uint32_t key[4],
+    uint32_t out[4])
+{
+    auto mix = [] (
+        uint32_t &a, uint32_t &b, uint32_t &c, uint32_t &d,
+        const uint32_t r0, const uint32_t r1) {
+        a += b; b = (b << r0) | (b >> (32 - r0)); b ^= a;
+        c += d; d = (d << r1) | (d >> (32 - r1)); d ^= c;
+    };
+
+    uint32_t ks[5] = {key[0], key[1], key[2], key[3], 0x1BD11BDAU};
+    ks[4] ^= key[0] ^ key[1] ^ key[2] ^ key[3];
+
+    uint32_t x[4];
+    for (size_t i = 0; i < 4; ++i) {
+        x[i] = counter[i] + ks[i];
+    }
+    for (uint32_t s = 1; s <= 5; ++s) {
+        if (s % 2 == 1) {
+            mix(x[0], x[1], x[2], x[3], 10, 26);
+            mix(x[0], x[3], x[2], x[1], 11, 21);
+            mix(x[0], x[1], x[2], x[3], 13, 27);
+            mix(x[0], x[3], x[2], x[1], 23,  5);
+        } else {
+            mix(x[0], x[1], x[2], x[3],  6, 20);
+            mix(x[0], x[3], x[2], x[1], 17, 11);
+            mix(x[0], x[1], x[2], x[3], 25, 10);
+            mix(x[0], x[3], x[2], x[1], 18, 20);
+        }
+        for (size_t i = 0; i < 4; ++i) {
+            x[i] += ks[(s + i) % 5];
+        }
+        x[3] += s;
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        out[i] = x[i];
+    }
+}
+
+///
+/// @brief Compute the block of random bits of the stream at the block index.
+///
+inline void RandomBlock(
+    const RandomStream &stream,
+    const uint64_t block,
+    uint32_t out[4])
+{
+    const uint32_t counter[4] = {
+        (uint32_t) block,
+        (uint32_t) (block >> 32),
+        stream.stream[0],
+        stream.stream[1]};
+    if (stream.generator == kRandomThreefry) {
+        const uint32_t key[4] = {stream.key[0], stream.key[1], 0, 0};
+        Threefry4x32(counter, key, out);
+    } else {
+        Philox4x32(counter, stream.key, out);
+    }
+}
+
+///
+/// @brief Return the 32-bit or the 64-bit random number of the stream at the
+/// index.
+///
+inline uint32_t Random32(const RandomStream &stream, const uint64_t index)
+{
+    uint32_t out[4];
+    RandomBlock(stream, index / 4, out);
+    return out[index % 4];
+}
+
+inline uint64_t Random64(const RandomStream &stream, const uint64_t index)
+{
+    uint32_t out[4];
+    RandomBlock(stream, index / 2, out);
+    const size_t k = 2 * (index % 2);
+    return (uint64_t) out[k] | ((uint64_t) out[k + 1] << 32);
+}
+
+///
+/// @brief Fill an array with the random numbers of the stream, starting at
+/// the index of the first number. Floating point numbers are uniform in
+/// [0, 1), converted from the 32-bit and 64-bit numbers of the same index as
+/// by the fill functions of the random engine lanes.
+///
+void RandomFill(
+    const RandomStream &stream,
+    const uint64_t first,
+    uint32_t *dst,
+    const size_t count);
+void RandomFill(
+    const RandomStream &stream,
+    const uint64_t first,
+    uint64_t *dst,
+    const size_t count);
+void RandomFill(
+    const RandomStream &stream,
+    const uint64_t first,
+    float *dst,
+    const size_t count);
+void RandomFill(
+    const RandomStream &stream,
+    const uint64_t first,
+    double *dst,
+    const size_t count);
+
 /// ---- Random number generator samplers -------------------------------------
 /// @brief Sample a random number from a uniform distribution in interval [a,b].
+/// Floating point numbers are sampled in [a,b), from the upper 24 or 53 bits
+/// of the random numbers. Integers are sampled in [a,b] without bias.
 ///
 template<typename T>
 struct RandomUniform {};
@@ -201,7 +632,7 @@ struct RandomUniform {};
 template<>
 struct RandomUniform<float> {
     float operator()(RandomEngine &eng, float lo = 0.0f, float hi = 1.0f) {
-        float r = (float) Random32(eng) / (float) UINT32_MAX;
+        float r = (float) (Random32(eng) >> 8) * 5.9604644775390625E-8f;
         return (lo + r * (hi - lo));
     }
 };
@@ -209,60 +640,50 @@ struct RandomUniform<float> {
 template<>
 struct RandomUniform<double> {
     double operator()(RandomEngine &eng, double lo = 0.0, double hi = 1.0) {
-        double r = (double) Random64(eng) / (float) UINT64_MAX;
+        double r = (double) (Random64(eng) >> 11) * 1.1102230246251565E-16;
         return (lo + r * (hi - lo));
     }
 };
 
 template<>
 struct RandomUniform<uint32_t> {
-    RandomUniform<float> urand;
     uint32_t operator()(
         RandomEngine &eng,
         uint32_t lo = 0,
         uint32_t hi = UINT32_MAX - 1) {
-        float r = (float) (hi - lo + 1) * urand(eng);
-        float n = (float) lo + std::floor(r);
-        return ((uint32_t) n);
+        return lo + RandomBounded32(eng, hi - lo + 1);
     }
 };
 
 template<>
 struct RandomUniform<uint64_t> {
-    RandomUniform<double> urand;
     uint64_t operator()(
         RandomEngine &eng,
         uint64_t lo = 0,
         uint64_t hi = UINT64_MAX - 1) {
-        double r = (double) (hi - lo + 1) * urand(eng);
-        double n = (double) lo + std::floor(r);
-        return ((uint64_t) n);
+        return lo + RandomBounded64(eng, hi - lo + 1);
     }
 };
 
 template<>
 struct RandomUniform<int32_t> {
-    RandomUniform<float> urand;
     int32_t operator()(
         RandomEngine &eng,
         int32_t lo = INT32_MIN,
         int32_t hi = INT32_MAX - 1) {
-        float r = (float) (hi - lo + 1) * urand(eng);
-        float n = (float) lo + std::floor(r);
-        return ((int32_t) n);
+        uint32_t range = (uint32_t) hi - (uint32_t) lo + 1;
+        return (int32_t) ((uint32_t) lo + RandomBounded32(eng, range));
     }
 };
 
 template<>
 struct RandomUniform<int64_t> {
-    RandomUniform<double> urand;
     int64_t operator()(
         RandomEngine &eng,
         int64_t lo = INT64_MIN,
         int64_t hi = INT64_MAX - 1) {
-        double r = (double) (hi - lo + 1) * urand(eng);
-        double n = (double) lo + std::floor(r);
-        return ((int64_t) n);
+        uint64_t range = (uint64_t) hi - (uint64_t) lo + 1;
+        return (int64_t) ((uint64_t) lo + RandomBounded64(eng, range));
     }
 };
 
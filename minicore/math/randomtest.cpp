@@ -0,0 +1,496 @@
+//
+// randomtest.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "minicore/base/parallel.h"
+#include "randomtest.h"
+
+namespace Math {
+
+/// ---- Random test probability functions ------------------------------------
+///
+/// @brief Return the regularized upper incomplete gamma function Q(a, x), the
+/// probability that a chi-square statistic of 2a degrees of freedom exceeds
+/// 2x. Computed from the series of P(a, x) for x < a + 1, and otherwise from
+/// the continued fraction of Q(a, x) with the modified Lentz method.
+///
+/// @see Press et al, "Numerical Recipes", Section 6.2.
+///
+static double GammaQ(const double a, const double x)
+{
+    const size_t kMaxIter = 1000;
+    const double kEps = 1.0e-15;
+    const double kTiny = 1.0e-300;
+
+    if (x <= 0.0) {
+        return 1.0;
+    }
+    const double log_prefix = a * std::log(x) - x - std::lgamma(a);
+
+    if (x < a + 1.0) {
+        double term = 1.0 / a;
+        double sum = term;
+        for (size_t n = 1; n < kMaxIter; ++n) {
+            term *= x / (a + n);
+            sum += term;
+            if (std::fabs(term) < std::fabs(sum) * kEps) {
+                break;
+            }
+        }
+        return std::max(0.0, 1.0 - sum * std::exp(log_prefix));
+    }
+
+    double b = x + 1.0 - a;
+    double c = 1.0 / kTiny;
+    double d = 1.0 / b;
+    double h = d;
+    for (size_t n = 1; n < kMaxIter; ++n) {
+        double an = -(double) n * ((double) n - a);
+        b += 2.0;
+        d = an * d + b;
+        d = (std::fabs(d) < kTiny) ? kTiny : d;
+        c = b + an / c;
+        c = (std::fabs(c) < kTiny) ? kTiny : c;
+        d = 1.0 / d;
+        double delta = d * c;
+        h *= delta;
+        if (std::fabs(delta - 1.0) < kEps) {
+            break;
+        }
+    }
+    return std::exp(log_prefix) * h;
+}
+
+///
+/// @brief Return the p-value of a chi-square statistic of the histogram with
+/// the expected probabilities, with n - 1 degrees of freedom.
+///
+static double ChiSquareP(
+    const uint64_t *hist,
+    const double *prob,
+    const size_t n,
+    double *chi_square = nullptr)
+{
+    double total = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        total += (double) hist[i];
+    }
+
+    double chi = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double expected = total * prob[i];
+        double diff = (double) hist[i] - expected;
+        chi += diff * diff / expected;
+    }
+    if (chi_square != nullptr) {
+        *chi_square = chi;
+    }
+    return GammaQ(0.5 * (double) (n - 1), 0.5 * chi);
+}
+
+///
+/// @brief Return the two-sided p-value of a standard normal statistic.
+///
+static double NormalP(const double z)
+{
+    return std::erfc(std::fabs(z) / std::sqrt(2.0));
+}
+
+/// ---- Random test blocks ---------------------------------------------------
+///
+/// @brief Sort the birthdays of a block, 24-bit keys uniform in [0, 2^24).
+/// The keys are distributed into 1024 buckets by their upper 10 bits, which
+/// leaves about half a key per bucket, and the few keys out of order within
+/// a bucket are moved by an insertion sort.
+///
+static void SortBirthdays(const uint32_t *keys, uint32_t *sorted)
+{
+    const size_t n = kRandomTestBlock;
+    uint32_t offset[1024 + 1] = {};
+    for (size_t i = 0; i < n; ++i) {
+        offset[(keys[i] >> 14) + 1]++;
+    }
+    for (size_t b = 1; b <= 1024; ++b) {
+        offset[b] += offset[b - 1];
+    }
+    for (size_t i = 0; i < n; ++i) {
+        sorted[offset[keys[i] >> 14]++] = keys[i];
+    }
+
+    for (size_t i = 1; i < n; ++i) {
+        uint32_t key = sorted[i];
+        size_t j = i;
+        while (j > 0 && sorted[j - 1] > key) {
+            sorted[j] = sorted[j - 1];
+            --j;
+        }
+        sorted[j] = key;
+    }
+}
+
+///
+/// @brief Return the number of duplicate spacings of the sorted birthdays,
+/// the number of spacings equal to a previous one. The spacings are inserted
+/// into an open addressing hash table four times their size, rather than
+/// sorted.
+///
+static size_t CountSpacings(const uint32_t *sorted)
+{
+    const size_t n = kRandomTestBlock;
+    const size_t size = 4 * kRandomTestBlock;
+    uint32_t table[size];
+    std::fill(&table[0], &table[size], 0);
+
+    size_t duplicates = 0;
+    uint32_t prev = 0;
+    for (size_t i = 0; i < n; ++i) {
+        // Spacings are stored plus one, zero is an empty slot.
+        uint32_t key = sorted[i] - prev + 1;
+        prev = sorted[i];
+
+        size_t h = (key * 2654435761U) >> 21;
+        while (table[h] != 0 && table[h] != key) {
+            h = (h + 1) & (size - 1);
+        }
+        duplicates += (table[h] == key) ? 1 : 0;
+        table[h] = key;
+    }
+    return duplicates;
+}
+
+///
+/// @brief Accumulate the statistics of a whole block of numbers.
+///
+static void RandomTestBlock(RandomTest &test, const uint32_t *w)
+{
+    const size_t n = kRandomTestBlock;
+    const double scale = 1.0 / 4294967296.0;
+    const uint64_t radius2 = (uint64_t) 1 << 62;
+    const uint32_t gap_max = (uint32_t) 1 << 29;
+
+    // Byte histogram.
+    for (size_t i = 0; i < n; ++i) {
+        test.bytes[w[i] & 255]++;
+        test.bytes[(w[i] >> 8) & 255]++;
+        test.bytes[(w[i] >> 16) & 255]++;
+        test.bytes[w[i] >> 24]++;
+    }
+
+    // Monte Carlo pi, pairs of 31-bit coordinates inside the circle.
+    uint64_t inside = 0;
+    for (size_t i = 0; i < n; i += 2) {
+        uint64_t x = w[i] >> 1;
+        uint64_t y = w[i + 1] >> 1;
+        inside += (x * x + y * y < radius2) ? 1 : 0;
+    }
+    test.inside += inside;
+
+    // Serial correlation sums, continued from the last number of the
+    // previous block.
+    double sum = 0.0, sum2 = 0.0, sum12 = 0.0;
+    double prev = (double) test.last * scale;
+    if (test.count == 0) {
+        test.first = w[0];
+        prev = 0.0;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        double u = (double) w[i] * scale;
+        sum += u;
+        sum2 += u * u;
+        sum12 += prev * u;
+        prev = u;
+    }
+    test.sum += sum;
+    test.sum2 += sum2;
+    test.sum12 += sum12;
+    test.last = w[n - 1];
+
+    // Birthday spacings, duplicate values among the spacings of the sorted
+    // upper 24 bits.
+    uint32_t days[kRandomTestBlock];
+    uint32_t sorted[kRandomTestBlock];
+    for (size_t i = 0; i < n; ++i) {
+        days[i] = w[i] >> 8;
+    }
+    SortBirthdays(days, sorted);
+    size_t duplicates = CountSpacings(sorted);
+    test.birthdays[std::min(duplicates, kRandomTestBirthdays - 1)]++;
+
+    // Gap lengths between the numbers below 2^29.
+    for (size_t i = 0; i < n; ++i) {
+        if (w[i] < gap_max) {
+            if (test.gap_hit) {
+                uint64_t gap = std::min(test.gap_suffix,
+                    (uint64_t) kRandomTestGaps);
+                test.gaps[gap]++;
+            } else {
+                test.gap_hit = true;
+                test.gap_prefix = test.gap_suffix;
+            }
+            test.gap_suffix = 0;
+        } else {
+            test.gap_suffix++;
+        }
+    }
+
+    test.count += n;
+}
+
+/// ---- Random test battery --------------------------------------------------
+///
+/// @brief Create an empty random test battery.
+///
+RandomTest CreateRandomTest()
+{
+    RandomTest test = {};
+    return test;
+}
+
+///
+/// @brief Accumulate the numbers of the next chunk of the sequence. The
+/// pending partial block is completed first, then the whole blocks are
+/// tested in place, and the tail is kept.
+///
+void RandomTestUpdate(
+    RandomTest &test,
+    const uint32_t *data,
+    const size_t count)
+{
+    size_t i = 0;
+    if (test.num_pending > 0) {
+        size_t n = std::min(kRandomTestBlock - test.num_pending, count);
+        std::copy(&data[0], &data[n], &test.pending[test.num_pending]);
+        test.num_pending += n;
+        i += n;
+        if (test.num_pending < kRandomTestBlock) {
+            return;
+        }
+        RandomTestBlock(test, test.pending);
+        test.num_pending = 0;
+    }
+
+    for (; i + kRandomTestBlock <= count; i += kRandomTestBlock) {
+        RandomTestBlock(test, &data[i]);
+    }
+
+    std::copy(&data[i], &data[count], &test.pending[0]);
+    test.num_pending = count - i;
+}
+
+///
+/// @brief Merge the statistics of the part of the sequence following the
+/// test. The serial correlation adds the product of the numbers across the
+/// boundary, and the gap across the boundary is the suffix of the test
+/// followed by the prefix of the next part.
+///
+void RandomTestMerge(RandomTest &test, const RandomTest &next)
+{
+    if (test.num_pending > 0) {
+        throw std::runtime_error("random test merge of a partial block");
+    }
+
+    if (next.count > 0) {
+        const double scale = 1.0 / 4294967296.0;
+        if (test.count == 0) {
+            test.first = next.first;
+        } else {
+            test.sum12 += ((double) test.last * scale) *
+                ((double) next.first * scale);
+        }
+        test.last = next.last;
+    }
+
+    test.count += next.count;
+    for (size_t i = 0; i < 256; ++i) {
+        test.bytes[i] += next.bytes[i];
+    }
+    test.inside += next.inside;
+    test.sum += next.sum;
+    test.sum2 += next.sum2;
+    test.sum12 += next.sum12;
+    for (size_t i = 0; i < kRandomTestBirthdays; ++i) {
+        test.birthdays[i] += next.birthdays[i];
+    }
+    for (size_t i = 0; i <= kRandomTestGaps; ++i) {
+        test.gaps[i] += next.gaps[i];
+    }
+
+    if (next.gap_hit) {
+        if (test.gap_hit) {
+            uint64_t gap = std::min(test.gap_suffix + next.gap_prefix,
+                (uint64_t) kRandomTestGaps);
+            test.gaps[gap]++;
+        } else {
+            test.gap_hit = true;
+            test.gap_prefix = test.gap_suffix + next.gap_prefix;
+        }
+        test.gap_suffix = next.gap_suffix;
+    } else {
+        test.gap_suffix += next.gap_suffix;
+    }
+
+    std::copy(&next.pending[0], &next.pending[next.num_pending],
+        &test.pending[0]);
+    test.num_pending = next.num_pending;
+}
+
+///
+/// @brief The sequence is split in parts of a fixed number of whole blocks,
+/// tested in parallel and merged in order, so that the results do not depend
+/// on the number of threads. Generated numbers are tested in chunks of a
+/// buffer of each part.
+///
+static const size_t kRandomTestPart = 1024 * kRandomTestBlock;
+static const size_t kRandomTestChunk = 64 * kRandomTestBlock;
+
+template<typename Fn>
+static RandomTest RandomTestParts(const uint64_t count, const Fn &fn)
+{
+    size_t num_parts = (size_t) ((count + kRandomTestPart - 1) /
+        kRandomTestPart);
+    std::vector<RandomTest> parts(num_parts);
+
+    struct PartData {
+        const Fn *fn;
+        uint64_t count;
+        RandomTest *parts;
+    } data = {&fn, count, parts.data()};
+
+    auto run = [](size_t k, void *arg) {
+        PartData *data = static_cast<PartData *>(arg);
+        uint64_t begin = (uint64_t) k * kRandomTestPart;
+        uint64_t end = std::min(begin + kRandomTestPart, data->count);
+        data->parts[k] = CreateRandomTest();
+        (*data->fn)(data->parts[k], begin, (size_t) (end - begin));
+    };
+
+    Base::ParallelForIf(run, num_parts, &data, num_parts > 1);
+
+    RandomTest test = CreateRandomTest();
+    for (auto &part : parts) {
+        RandomTestMerge(test, part);
+    }
+    return test;
+}
+
+///
+/// @brief Run the random test battery on an array, or on the numbers of a
+/// generator.
+///
+RandomTest RandomTestRun(const uint32_t *data, const size_t count)
+{
+    return RandomTestParts(count, [data] (
+        RandomTest &test, uint64_t first, size_t n) {
+        RandomTestUpdate(test, &data[first], n);
+    });
+}
+
+RandomTest RandomTestRun(
+    void (*fill)(uint64_t, uint32_t *, size_t, void *),
+    const uint64_t count,
+    void *arg)
+{
+    return RandomTestParts(count, [fill, arg] (
+        RandomTest &test, uint64_t first, size_t n) {
+        std::vector<uint32_t> chunk(kRandomTestChunk);
+        for (size_t i = 0; i < n; i += kRandomTestChunk) {
+            size_t m = std::min(kRandomTestChunk, n - i);
+            fill(first + i, chunk.data(), m, arg);
+            RandomTestUpdate(test, chunk.data(), m);
+        }
+    });
+}
+
+///
+/// @brief Return the statistics and p-values of the whole blocks of the test.
+///
+RandomTestResult RandomTestReport(const RandomTest &test)
+{
+    RandomTestResult result = {};
+    result.count = test.count;
+    if (test.count < 2) {
+        return result;
+    }
+
+    // Entropy, chi-square and mean of the bytes.
+    const double num_bytes = 4.0 * (double) test.count;
+    double prob[256];
+    double mean = 0.0;
+    for (size_t i = 0; i < 256; ++i) {
+        double p = (double) test.bytes[i] / num_bytes;
+        if (p > 0.0) {
+            result.entropy -= p * std::log2(p);
+        }
+        mean += (double) i * p;
+        prob[i] = 1.0 / 256.0;
+    }
+    result.chi_square_p = ChiSquareP(
+        test.bytes, prob, 256, &result.chi_square);
+    result.mean = mean;
+    result.mean_p = NormalP(
+        (mean - 127.5) / std::sqrt((256.0 * 256.0 - 1.0) / 12.0 / num_bytes));
+
+    // Monte Carlo pi.
+    const double num_pairs = (double) (test.count / 2);
+    const double p_inside = M_PI / 4.0;
+    result.pi = 4.0 * (double) test.inside / num_pairs;
+    result.pi_p = NormalP(((double) test.inside - num_pairs * p_inside) /
+        std::sqrt(num_pairs * p_inside * (1.0 - p_inside)));
+
+    // Serial correlation of the n - 1 consecutive pairs, about the mean of
+    // the sequence.
+    {
+        const double scale = 1.0 / 4294967296.0;
+        const double n = (double) test.count;
+        const double m = test.sum / n;
+        const double u_first = (double) test.first * scale;
+        const double u_last = (double) test.last * scale;
+        double var = test.sum2 / n - m * m;
+        double cov = (test.sum12 - m * (test.sum - u_last) -
+            m * (test.sum - u_first) + (n - 1.0) * m * m) / (n - 1.0);
+        result.serial = cov / var;
+        result.serial_p = NormalP(result.serial * std::sqrt(n - 1.0));
+    }
+
+    // Birthday spacings, Poisson of mean m^3 / (4 * 2^24) = 2.
+    {
+        const double lambda = 2.0;
+        double poisson[kRandomTestBirthdays];
+        double p = std::exp(-lambda);
+        double tail = 1.0;
+        for (size_t j = 0; j + 1 < kRandomTestBirthdays; ++j) {
+            poisson[j] = p;
+            tail -= p;
+            p *= lambda / (double) (j + 1);
+        }
+        poisson[kRandomTestBirthdays - 1] = tail;
+        result.birthday_p = ChiSquareP(
+            test.birthdays, poisson, kRandomTestBirthdays);
+    }
+
+    // Gap lengths, geometric of parameter 1/8.
+    {
+        const double p = 0.125;
+        double geometric[kRandomTestGaps + 1];
+        double q = 1.0;
+        for (size_t r = 0; r < kRandomTestGaps; ++r) {
+            geometric[r] = p * q;
+            q *= 1.0 - p;
+        }
+        geometric[kRandomTestGaps] = q;
+        result.gap_p = ChiSquareP(test.gaps, geometric, kRandomTestGaps + 1);
+    }
+
+    return result;
+}
+
+} // namespace Math
@@ -0,0 +1,126 @@
+//
+// randomtest.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_RANDOMTEST_H_
+#define MATH_RANDOMTEST_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Math {
+
+///
+/// @brief Random test battery accumulates the statistics of a sequence of
+/// 32-bit random numbers, read in chunks from memory:
+///
+///  Entropy            entropy of the bytes, in bits per byte.
+///  Chi-square         byte histogram against the uniform distribution.
+///  Mean               arithmetic mean of the bytes, 127.5 if random.
+///  Monte Carlo pi     fraction of pairs of numbers inside the unit circle.
+///  Serial correlation correlation of each number with the next.
+///  Birthday spacings  duplicate spacings of the upper 24 bits of blocks of
+///                     512 numbers, Poisson distributed of mean 2, counted
+///                     in bins 0 to 5 and 6 or more.
+///  Gap test           lengths of the gaps between numbers below 2^29, with
+///                     geometric distribution of parameter 1/8.
+///
+/// The numbers are tested in blocks of kRandomTestBlock, and the tail of a
+/// partial block is kept for the next update. The statistics of consecutive
+/// parts of a sequence are merged exactly, provided that the first part holds
+/// whole blocks, so that long sequences are tested in parallel, each thread
+/// accumulating a part.
+///
+/// @see Knuth, "The Art of Computer Programming", Vol 2, Section 3.3.
+///      Marsaglia, Tsang, "Some Difficult-to-pass Tests of Randomness",
+///      https://doi.org/10.18637/jss.v007.i03
+///      Walker, "ENT: A Pseudorandom Number Sequence Test Program",
+///      https://www.fourmilab.ch/random/
+///
+static const size_t kRandomTestBlock = 512;
+static const size_t kRandomTestBirthdays = 7;
+static const size_t kRandomTestGaps = 48;
+
+struct RandomTest {
+    uint64_t count;                             // numbers in whole blocks
+    uint64_t bytes[256];                        // byte histogram
+    uint64_t inside;                            // pairs inside the circle
+    double sum;                                 // serial correlation sums
+    double sum2;
+    double sum12;
+    uint32_t first;                             // first and last numbers
+    uint32_t last;
+    uint64_t birthdays[kRandomTestBirthdays];   // duplicate spacings
+    uint64_t gaps[kRandomTestGaps + 1];         // gap lengths
+    bool gap_hit;                               // gap test state
+    uint64_t gap_prefix;
+    uint64_t gap_suffix;
+    size_t num_pending;                         // partial block
+    uint32_t pending[kRandomTestBlock];
+};
+
+///
+/// @brief Random test battery results, each statistic with the p-value of its
+/// null hypothesis. Tiny p-values, or p-values close to one for the
+/// chi-square statistics, reject the generator.
+///
+struct RandomTestResult {
+    uint64_t count;
+    double entropy;
+    double chi_square;
+    double chi_square_p;
+    double mean;
+    double mean_p;
+    double pi;
+    double pi_p;
+    double serial;
+    double serial_p;
+    double birthday_p;
+    double gap_p;
+};
+
+///
+/// @brief Create an empty random test battery.
+///
+RandomTest CreateRandomTest();
+
+///
+/// @brief Accumulate the numbers of the next chunk of the sequence.
+///
+void RandomTestUpdate(
+    RandomTest &test,
+    const uint32_t *data,
+    const size_t count);
+
+///
+/// @brief Merge the statistics of the part of the sequence following the
+/// test into the test. Throws if the test holds a partial block.
+///
+void RandomTestMerge(RandomTest &test, const RandomTest &next);
+
+///
+/// @brief Run the random test battery on an array in parallel, over the
+/// thread pool if it is running, or on count numbers of a generator. The
+/// generator fills the numbers [first, first + count) of the sequence into
+/// dst, and is called concurrently on disjoint ranges. The results do not
+/// depend on the number of threads.
+///
+RandomTest RandomTestRun(const uint32_t *data, const size_t count);
+RandomTest RandomTestRun(
+    void (*fill)(uint64_t, uint32_t *, size_t, void *),
+    const uint64_t count,
+    void *arg);
+
+///
+/// @brief Return the statistics and p-values of the whole blocks of the test.
+///
+RandomTestResult RandomTestReport(const RandomTest &test);
+
+} // namespace Math
+
+#endif // MATH_RANDOMTEST_H_
@@ -13,21 +13,31 @@
 #include "common.h"
 
 namespace Math {
+inline namespace MATH_SIMD_ISA {
 
 /// -----------------------------------------------------------------------------
 /// @brief Return the 2-dimensional dot product.
 ///
 template<>
-inline double Dot(const Vec2<double> &v, const Vec2<double> &w)
+MATH_SIMD_CONSTEXPR double Dot(const Vec2<double> &v, const Vec2<double> &w)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(v, w);
+    }
+
     const __m128d a = simd_load(v);
     const __m128d b = simd_load(w);
     return _mm_cvtsd_f64(simd128_dot_(a, b));
 }
 
 template<>
-inline Vec2<double> Dot(const Mat2<double> &a, const Vec2<double> &v)
+MATH_SIMD_CONSTEXPR Vec2<double> Dot(
+    const Mat2<double> &a, const Vec2<double> &v)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, v);
+    }
+
     //
     // a0 = {a0, a1}
     // a1 = {a2, a3}
@@ -54,8 +64,13 @@ inline Vec2<double> Dot(const Mat2<double> &a, const Vec2<double> &v)
 }
 
 template<>
-inline Mat2<double> Dot(const Mat2<double> &a, const Mat2<double> &b)
+MATH_SIMD_CONSTEXPR Mat2<double> Dot(
+    const Mat2<double> &a, const Mat2<double> &b)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, b);
+    }
+
     //
     // b0 = {b0, b1}
     // b1 = {b2, b3}
@@ -63,7 +78,7 @@ inline Mat2<double> Dot(const Mat2<double> &a, const Mat2<double> &b)
     __m128d b0 = simd_load(b, 0);
     __m128d b1 = simd_load(b, 1);
 
-    __m128d mul[2];
+    __m128d mul[2] = {};
     for (size_t i = 0; i < 2; ++i) {
         //
         // a0 = {a_n, a_n},    n = 0, 2
@@ -72,16 +87,10 @@ inline Mat2<double> Dot(const Mat2<double> &a, const Mat2<double> &b)
         __m128d a0 = _mm_set1_pd(a[i * a.dim + 0]);
         __m128d a1 = _mm_set1_pd(a[i * a.dim + 1]);
         //
-        // c0 = {a_n * b0, a_n * b1}
-        // c1 = {a_m * b2, a_m * b3}
-        //
-        __m128d c0 = _mm_mul_pd(a0, b0);
-        __m128d c1 = _mm_mul_pd(a1, b1);
-        //
         // mul = {a_n * b0 + a_m * b2,
         //        a_n * b1 + a_m * b3}
         //
-        mul[i] = _mm_add_pd(c0, c1);
+        mul[i] = simd128_madd_(a1, b1, _mm_mul_pd(a0, b0));
     }
 
     Mat2<double> result{};
@@ -94,16 +103,25 @@ inline Mat2<double> Dot(const Mat2<double> &a, const Mat2<double> &b)
 /// @brief Return the 3-dimensional dot product.
 ///
 template<>
-inline double Dot(const Vec3<double> &v, const Vec3<double> &w)
+MATH_SIMD_CONSTEXPR double Dot(const Vec3<double> &v, const Vec3<double> &w)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(v, w);
+    }
+
     const __m256d a = simd_load(v);
     const __m256d b = simd_load(w);
     return _mm256_cvtsd_f64(simd256_dot_(a, b));
 }
 
 template<>
-inline Vec3<double> Dot(const Mat3<double> &a, const Vec3<double> &v)
+MATH_SIMD_CONSTEXPR Vec3<double> Dot(
+    const Mat3<double> &a, const Vec3<double> &v)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, v);
+    }
+
     //
     // a0 = {a0, a1, a2}
     // a1 = {a3, a4, a5}
@@ -140,8 +158,13 @@ inline Vec3<double> Dot(const Mat3<double> &a, const Vec3<double> &v)
 }
 
 template<>
-inline Mat3<double> Dot(const Mat3<double> &a, const Mat3<double> &b)
+MATH_SIMD_CONSTEXPR Mat3<double> Dot(
+    const Mat3<double> &a, const Mat3<double> &b)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, b);
+    }
+
     //
     // b0 = {b0, b1, b2}
     // b1 = {b3, b4, b5}
@@ -151,7 +174,7 @@ inline Mat3<double> Dot(const Mat3<double> &a, const Mat3<double> &b)
     __m256d b1 = simd_load(b, 1);
     __m256d b2 = simd_load(b, 2);
 
-    __m256d mul[3];
+    __m256d mul[3] = {};
     for (size_t i = 0; i < 3; ++i) {
         //
         // a0 = {a_n, a_n, a_n, a_n}   n = 0, 3, 6
@@ -162,22 +185,15 @@ inline Mat3<double> Dot(const Mat3<double> &a, const Mat3<double> &b)
         __m256d a1 = _mm256_set1_pd(a[i * a.dim + 1]);
         __m256d a2 = _mm256_set1_pd(a[i * a.dim + 2]);
         //
-        // c0 = {a_n * b0, a_n * b1, a_n * b2}
-        // c1 = {a_m * b3, a_m * b4, a_m * b5}
-        // c2 = {a_l * b6, a_l * b7, a_l * b8}
-        //
-        __m256d c0 = _mm256_mul_pd(a0, b0);
-        __m256d c1 = _mm256_mul_pd(a1, b1);
-        __m256d c2 = _mm256_mul_pd(a2, b2);
-        //
         // mul = {a_n * b0 + a_m * b3 + a_l * b6,
         //        a_n * b1 + a_m * b4 + a_l * b7,
         //        a_n * b2 + a_m * b5 + a_l * b8}
         //
-         mul[i] = _mm256_set1_pd(0.0);
-         mul[i] = _mm256_add_pd(mul[i], c0);
-         mul[i] = _mm256_add_pd(mul[i], c1);
-         mul[i] = _mm256_add_pd(mul[i], c2);
+        // Accumulate the products with fused multiply-add instructions.
+        //
+        mul[i] = _mm256_mul_pd(a0, b0);
+        mul[i] = simd256_madd_(a1, b1, mul[i]);
+        mul[i] = simd256_madd_(a2, b2, mul[i]);
     }
 
     Mat3<double> result{};
@@ -191,16 +207,25 @@ inline Mat3<double> Dot(const Mat3<double> &a, const Mat3<double> &b)
 /// @brief Return the 4-dimensional dot product.
 ///
 template<>
-inline double Dot(const Vec4<double> &v, const Vec4<double> &w)
+MATH_SIMD_CONSTEXPR double Dot(const Vec4<double> &v, const Vec4<double> &w)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(v, w);
+    }
+
     const __m256d a = simd_load(v);
     const __m256d b = simd_load(w);
     return _mm256_cvtsd_f64(simd256_dot_(a, b));
 }
 
 template<>
-inline Vec4<double> Dot(const Mat4<double> &a, const Vec4<double> &v)
+MATH_SIMD_CONSTEXPR Vec4<double> Dot(
+    const Mat4<double> &a, const Vec4<double> &v)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, v);
+    }
+
     //
     // a0 = {a0,  a1,  a2,  a3}
     // a1 = {a4,  a5,  a6,  a7}
@@ -213,25 +238,23 @@ inline Vec4<double> Dot(const Mat4<double> &a, const Vec4<double> &v)
     __m256d a3 = simd_load(a, 3);
     __m256d b  = simd_load(v);
     //
-    // c0 = {a0*b0  + a1*b1  + a2*b2  + a3*b3}
-    // c1 = {a4*b0  + a5*b1  + a6*b2  + a7*b3}
-    // c2 = {a8*b0  + a9*b1  + a10*b2 + a11*b3}
-    // c3 = {a12*b0 + a13*b1 + a14*b2 + a15*b3}
+    // c01 = {a0*b0 + a1*b1,   a4*b0 + a5*b1,   a2*b2 + a3*b3,   a6*b2 + a7*b3}
+    // c23 = {a8*b0 + a9*b1,   a12*b0 + a13*b1, a10*b2 + a11*b3, a14*b2 + a15*b3}
     //
-    // _mm256_unpackhi_pd(__m256d a, __m256d b)
-    // dst[63:0]    := a[127:64]
-    // dst[127:64]  := b[127:64]
-    // dst[191:128] := a[255:192]
-    // dst[255:192] := b[255:192]
+    // The horizontal sums of the row pairs are computed together instead of
+    // reducing each row dot product separately.
     //
-    __m256d c0  = simd256_dot_(a0, b);
-    __m256d c1  = simd256_dot_(a1, b);
-    __m256d c2  = simd256_dot_(a2, b);
-    __m256d c3  = simd256_dot_(a3, b);
-    __m256d mul = _mm256_permute2f128_pd(
-        _mm256_unpackhi_pd(c0, c1),
-        _mm256_unpackhi_pd(c2, c3),
-        0b00100000);
+    __m256d c01 = _mm256_hadd_pd(_mm256_mul_pd(a0, b), _mm256_mul_pd(a1, b));
+    __m256d c23 = _mm256_hadd_pd(_mm256_mul_pd(a2, b), _mm256_mul_pd(a3, b));
+    //
+    // mul = {a0*b0  + a1*b1  + a2*b2  + a3*b3,
+    //        a4*b0  + a5*b1  + a6*b2  + a7*b3,
+    //        a8*b0  + a9*b1  + a10*b2 + a11*b3,
+    //        a12*b0 + a13*b1 + a14*b2 + a15*b3}
+    //
+    __m256d mul = _mm256_add_pd(
+        _mm256_permute2f128_pd(c01, c23, 0b00100000),
+        _mm256_permute2f128_pd(c01, c23, 0b00110001));
 
     Vec4<double> result{};
     simd_store(result, mul);
@@ -239,8 +262,13 @@ inline Vec4<double> Dot(const Mat4<double> &a, const Vec4<double> &v)
 }
 
 template<>
-inline Mat4<double> Dot(const Mat4<double> &a, const Mat4<double> &b)
+MATH_SIMD_CONSTEXPR Mat4<double> Dot(
+    const Mat4<double> &a, const Mat4<double> &b)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, b);
+    }
+
     //
     // b0 = {b0,  b1,  b2,  b3}
     // b1 = {b4,  b5,  b6,  b7}
@@ -252,7 +280,7 @@ inline Mat4<double> Dot(const Mat4<double> &a, const Mat4<double> &b)
     __m256d b2 = simd_load(b, 2);
     __m256d b3 = simd_load(b, 3);
 
-    __m256d mul[4];
+    __m256d mul[4] = {};
     for (size_t i = 0; i < 4; ++i) {
         //
         // a0 = {a_n, a_n, a_n, a_n}   n = 0, 4, 8,  12
@@ -265,26 +293,17 @@ inline Mat4<double> Dot(const Mat4<double> &a, const Mat4<double> &b)
         __m256d a2 = _mm256_set1_pd(a[i * a.dim + 2]);
         __m256d a3 = _mm256_set1_pd(a[i * a.dim + 3]);
         //
-        // c0 = {a_n * b0,  a_n * b1,  a_n * b2,  a_n * b3}
-        // c1 = {a_m * b4,  a_m * b5,  a_m * b6,  a_m * b7}
-        // c2 = {a_l * b8,  a_l * b9,  a_l * b10, a_l * b11}
-        // c3 = {a_k * b12, a_k * b13, a_k * b14, a_k * b15}
-        //
-        __m256d c0 = _mm256_mul_pd(a0, b0);
-        __m256d c1 = _mm256_mul_pd(a1, b1);
-        __m256d c2 = _mm256_mul_pd(a2, b2);
-        __m256d c3 = _mm256_mul_pd(a3, b3);
-        //
         // mul = {a_n * b0 + a_m * b4 + a_l * b8  + a_k * b12,
-        //         a_n * b1 + a_m * b5 + a_l * b9  + a_k * b13,
-        //         a_n * b2 + a_m * b6 + a_l * b10 + a_k * b14,
-        //         a_n * b3 + a_m * b7 + a_l * b11 + a_k * b15}
+        //        a_n * b1 + a_m * b5 + a_l * b9  + a_k * b13,
+        //        a_n * b2 + a_m * b6 + a_l * b10 + a_k * b14,
+        //        a_n * b3 + a_m * b7 + a_l * b11 + a_k * b15}
+        //
+        // Accumulate the products with fused multiply-add instructions.
         //
-         mul[i] = _mm256_set1_pd(0.0);
-         mul[i] = _mm256_add_pd(mul[i], c0);
-         mul[i] = _mm256_add_pd(mul[i], c1);
-         mul[i] = _mm256_add_pd(mul[i], c2);
-         mul[i] = _mm256_add_pd(mul[i], c3);
+        mul[i] = _mm256_mul_pd(a0, b0);
+        mul[i] = simd256_madd_(a1, b1, mul[i]);
+        mul[i] = simd256_madd_(a2, b2, mul[i]);
+        mul[i] = simd256_madd_(a3, b3, mul[i]);
     }
 
     Mat4<double> result{};
@@ -396,8 +415,13 @@ inline double Distance(const Vec4<double> &a, const Vec4<double> &b)
 ///      a0 * b1 - a1 * b0}
 ///
 template<>
-inline Vec3<double> Cross(const Vec3<double> &a, const Vec3<double> &b)
+MATH_SIMD_CONSTEXPR Vec3<double> Cross(
+    const Vec3<double> &a, const Vec3<double> &b)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarCross(a, b);
+    }
+
     //
     // a0 = { 0, a2, a1, a0}
     // a1 = {a1, a0,  0, a2}
@@ -430,8 +454,7 @@ inline Vec3<double> Cross(const Vec3<double> &a, const Vec3<double> &b)
     // c = (a3 * b5) - (a5 * b3)
     //
     Vec3<double> result{};
-    simd_store(result,
-        _mm256_sub_pd(_mm256_mul_pd(a3, b5), _mm256_mul_pd(a5, b3)));
+    simd_store(result, simd256_msub_(a3, b5, _mm256_mul_pd(a5, b3)));
     return result;
 }
 
@@ -439,13 +462,17 @@ inline Vec3<double> Cross(const Vec3<double> &a, const Vec3<double> &b)
 /// @brief Return the transpose matrix
 ///
 template<>
-inline Mat2<double> Transpose(const Mat2<double> &a)
+MATH_SIMD_CONSTEXPR Mat2<double> Transpose(const Mat2<double> &a)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarTranspose(a);
+    }
+
     //
     // r0 = {a1, a0} -> {a2, a0}
     // r1 = {a3, a2} -> {a3, a1}
     //
-    __m128d row[2];
+    __m128d row[2] = {};
     row[0] = simd_load(a, 0);
     row[1] = simd_load(a, 1);
     simd128_transpose_(row);
@@ -457,15 +484,19 @@ inline Mat2<double> Transpose(const Mat2<double> &a)
 }
 
 template<>
-inline Mat3<double> Transpose(const Mat3<double> &a)
+MATH_SIMD_CONSTEXPR Mat3<double> Transpose(const Mat3<double> &a)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarTranspose(a);
+    }
+
     //
     // r0 = { 0,  a2,  a1,  a0} -> { 0,  a8,  a4,  a0}
     // r1 = { 0,  a6,  a5,  a4} -> { 0,  a9,  a5,  a1}
     // r2 = { 0, a10,  a9,  a8} -> { 0, a10,  a6,  a2}
     // r3 = { 0,   0,   0,   0} -> { 0,   0,   0,   0}
     //
-    __m256d row[4];
+    __m256d row[4] = {};
     row[0] = simd_load(a, 0);
     row[1] = simd_load(a, 1);
     row[2] = simd_load(a, 2);
@@ -480,15 +511,19 @@ inline Mat3<double> Transpose(const Mat3<double> &a)
 }
 
 template<>
-inline Mat4<double> Transpose(const Mat4<double> &a)
+MATH_SIMD_CONSTEXPR Mat4<double> Transpose(const Mat4<double> &a)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarTranspose(a);
+    }
+
     //
     // r0 = { a3,  a2,  a1,  a0} -> { a12,  a8,  a4,  a0}
     // r1 = { a7,  a6,  a5,  a4} -> { a13,  a9,  a5,  a1}
     // r2 = {a11, a10,  a9,  a8} -> { a14, a10,  a6,  a2}
     // r3 = {a15, a14, a13, a12} -> { a15, a11,  a7,  a3}
     //
-    __m256d row[4];
+    __m256d row[4] = {};
     row[0] = simd_load(a, 0);
     row[1] = simd_load(a, 1);
     row[2] = simd_load(a, 2);
@@ -508,8 +543,12 @@ inline Mat4<double> Transpose(const Mat4<double> &a)
 /// double-precision (64-bit) floating-point element.
 ///
 template<>
-inline double Determinant(const Mat2<double> &a)
+MATH_SIMD_CONSTEXPR double Determinant(const Mat2<double> &a)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDeterminant(a);
+    }
+
     //
     // Compute the determinant of a 2x2 matrix as a packed vector:
     // det(a) = det{a0, a1,
@@ -523,8 +562,12 @@ inline double Determinant(const Mat2<double> &a)
 }
 
 template<>
-inline double Determinant(const Mat3<double> &a)
+MATH_SIMD_CONSTEXPR double Determinant(const Mat3<double> &a)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDeterminant(a);
+    }
+
     //
     // Compute the determinant of a 3x3 matrix as a packed vector:
     // det(a) = det{a0, a1, a2,
@@ -552,16 +595,20 @@ inline double Determinant(const Mat3<double> &a)
     //          a2 * m2
     //
     __m256d det = _mm256_set1_pd(0.0);
-    det = _mm256_add_pd(det, _mm256_mul_pd(a0, m0));
-    det = _mm256_add_pd(det, _mm256_mul_pd(a1, m1));
-    det = _mm256_add_pd(det, _mm256_mul_pd(a2, m2));
+    det = simd256_madd_(a0, m0, det);
+    det = simd256_madd_(a1, m1, det);
+    det = simd256_madd_(a2, m2, det);
 
     return _mm256_cvtsd_f64(det);
 }
 
 template<>
-inline double Determinant(const Mat4<double> &a)
+MATH_SIMD_CONSTEXPR double Determinant(const Mat4<double> &a)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDeterminant(a);
+    }
+
     //
     // Compute the determinant of a 4x4 matrix as a packed vector:
     // det(a) = det{a0,  a1,  a2,  a3,
@@ -614,12 +661,12 @@ inline double Determinant(const Mat4<double> &a)
     //          m10 * m11
     //
     __m256d det = _mm256_set1_pd(0.0);
-    det = _mm256_add_pd(det, _mm256_mul_pd(m0,  m1));
-    det = _mm256_add_pd(det, _mm256_mul_pd(m2,  m3));
-    det = _mm256_add_pd(det, _mm256_mul_pd(m4,  m5));
-    det = _mm256_add_pd(det, _mm256_mul_pd(m6,  m7));
-    det = _mm256_add_pd(det, _mm256_mul_pd(m8,  m9));
-    det = _mm256_add_pd(det, _mm256_mul_pd(m10, m11));
+    det = simd256_madd_(m0, m1, det);
+    det = simd256_madd_(m2, m3, det);
+    det = simd256_madd_(m4, m5, det);
+    det = simd256_madd_(m6, m7, det);
+    det = simd256_madd_(m8, m9, det);
+    det = simd256_madd_(m10, m11, det);
 
     return _mm256_cvtsd_f64(det);
 }
@@ -628,8 +675,12 @@ inline double Determinant(const Mat4<double> &a)
 /// @brief Return the inverse of the matrix.
 ///
 template<>
-inline Mat2<double> Inverse(const Mat2<double> &a)
+MATH_SIMD_CONSTEXPR Mat2<double> Inverse(const Mat2<double> &a)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarInverse(a);
+    }
+
     //
     // Compute the inverse of matrix:
     //  a = {a0, a1,
@@ -665,8 +716,12 @@ inline Mat2<double> Inverse(const Mat2<double> &a)
 }
 
 template<>
-inline Mat3<double> Inverse(const Mat3<double> &a)
+MATH_SIMD_CONSTEXPR Mat3<double> Inverse(const Mat3<double> &a)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarInverse(a);
+    }
+
     //
     // Compute the inverse of matrix:
     //  a = {a0, a1, a2,
@@ -777,8 +832,12 @@ inline Mat3<double> Inverse(const Mat3<double> &a)
 }
 
 template<>
-inline Mat4<double> Inverse(const Mat4<double> &a)
+MATH_SIMD_CONSTEXPR Mat4<double> Inverse(const Mat4<double> &a)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarInverse(a);
+    }
+
     //
     // Compute the inverse of matrix:
     //  a = {a0,  a1,  a2,  a3,
@@ -872,24 +931,24 @@ inline Mat4<double> Inverse(const Mat4<double> &a)
     // adj3  = -a9  * m6 - a10 * m7  - a11 * m8
     //
     __m256d adj0 = _mm256_set1_pd(0.0);
-    adj0 = _mm256_add_pd(adj0, _mm256_mul_pd(a5, m0));
-    adj0 = _mm256_add_pd(adj0, _mm256_mul_pd(a6, m1));
-    adj0 = _mm256_add_pd(adj0, _mm256_mul_pd(a7, m2));
+    adj0 = simd256_madd_(a5, m0, adj0);
+    adj0 = simd256_madd_(a6, m1, adj0);
+    adj0 = simd256_madd_(a7, m2, adj0);
 
     __m256d adj1 = _mm256_set1_pd(0.0);
-    adj1 = _mm256_sub_pd(adj1, _mm256_mul_pd(a1, m0));
-    adj1 = _mm256_sub_pd(adj1, _mm256_mul_pd(a2, m1));
-    adj1 = _mm256_sub_pd(adj1, _mm256_mul_pd(a3, m2));
+    adj1 = simd256_nmadd_(a1, m0, adj1);
+    adj1 = simd256_nmadd_(a2, m1, adj1);
+    adj1 = simd256_nmadd_(a3, m2, adj1);
 
     __m256d adj2 = _mm256_set1_pd(0.0);
-    adj2 = _mm256_add_pd(adj2, _mm256_mul_pd(a13, m6));
-    adj2 = _mm256_add_pd(adj2, _mm256_mul_pd(a14, m7));
-    adj2 = _mm256_add_pd(adj2, _mm256_mul_pd(a15, m8));
+    adj2 = simd256_madd_(a13, m6, adj2);
+    adj2 = simd256_madd_(a14, m7, adj2);
+    adj2 = simd256_madd_(a15, m8, adj2);
 
     __m256d adj3 = _mm256_set1_pd(0.0);
-    adj3 = _mm256_sub_pd(adj3, _mm256_mul_pd(a9,  m6));
-    adj3 = _mm256_sub_pd(adj3, _mm256_mul_pd(a10, m7));
-    adj3 = _mm256_sub_pd(adj3, _mm256_mul_pd(a11, m8));
+    adj3 = simd256_nmadd_(a9, m6, adj3);
+    adj3 = simd256_nmadd_(a10, m7, adj3);
+    adj3 = simd256_nmadd_(a11, m8, adj3);
 
     //
     // adj4  = -a4  * m0 - a6  * m3  - a7  * m4
@@ -898,24 +957,24 @@ inline Mat4<double> Inverse(const Mat4<double> &a)
     // adj7  =  a8  * m6 + a10 * m9  + a11 * m10
     //
     __m256d adj4 = _mm256_set1_pd(0.0);
-    adj4 = _mm256_sub_pd(adj4, _mm256_mul_pd(a4, m0));
-    adj4 = _mm256_sub_pd(adj4, _mm256_mul_pd(a6, m3));
-    adj4 = _mm256_sub_pd(adj4, _mm256_mul_pd(a7, m4));
+    adj4 = simd256_nmadd_(a4, m0, adj4);
+    adj4 = simd256_nmadd_(a6, m3, adj4);
+    adj4 = simd256_nmadd_(a7, m4, adj4);
 
     __m256d adj5 = _mm256_set1_pd(0.0);
-    adj5 = _mm256_add_pd(adj5, _mm256_mul_pd(a0, m0));
-    adj5 = _mm256_add_pd(adj5, _mm256_mul_pd(a2, m3));
-    adj5 = _mm256_add_pd(adj5, _mm256_mul_pd(a3, m4));
+    adj5 = simd256_madd_(a0, m0, adj5);
+    adj5 = simd256_madd_(a2, m3, adj5);
+    adj5 = simd256_madd_(a3, m4, adj5);
 
     __m256d adj6 = _mm256_set1_pd(0.0);
-    adj6 = _mm256_sub_pd(adj6, _mm256_mul_pd(a12, m6));
-    adj6 = _mm256_sub_pd(adj6, _mm256_mul_pd(a14, m9));
-    adj6 = _mm256_sub_pd(adj6, _mm256_mul_pd(a15, m10));
+    adj6 = simd256_nmadd_(a12, m6, adj6);
+    adj6 = simd256_nmadd_(a14, m9, adj6);
+    adj6 = simd256_nmadd_(a15, m10, adj6);
 
     __m256d adj7 = _mm256_set1_pd(0.0);
-    adj7 = _mm256_add_pd(adj7, _mm256_mul_pd(a8,  m6));
-    adj7 = _mm256_add_pd(adj7, _mm256_mul_pd(a10, m9));
-    adj7 = _mm256_add_pd(adj7, _mm256_mul_pd(a11, m10));
+    adj7 = simd256_madd_(a8, m6, adj7);
+    adj7 = simd256_madd_(a10, m9, adj7);
+    adj7 = simd256_madd_(a11, m10, adj7);
 
     //
     // adj8  = -a4  * m1 + a5  * m3  + a7  * m5
@@ -924,24 +983,24 @@ inline Mat4<double> Inverse(const Mat4<double> &a)
     // adj11 =  a8  * m7 - a9  * m9  - a11 * m11
     //
     __m256d adj8 = _mm256_set1_pd(0.0);
-    adj8  = _mm256_sub_pd(adj8, _mm256_mul_pd(a4, m1));
-    adj8  = _mm256_add_pd(adj8, _mm256_mul_pd(a5, m3));
-    adj8  = _mm256_add_pd(adj8, _mm256_mul_pd(a7, m5));
+    adj8  = simd256_nmadd_(a4, m1, adj8);
+    adj8  = simd256_madd_(a5, m3, adj8);
+    adj8  = simd256_madd_(a7, m5, adj8);
 
     __m256d adj9 = _mm256_set1_pd(0.0);
-    adj9  = _mm256_add_pd(adj9, _mm256_mul_pd(a0, m1));
-    adj9  = _mm256_sub_pd(adj9, _mm256_mul_pd(a1, m3));
-    adj9  = _mm256_sub_pd(adj9, _mm256_mul_pd(a3, m5));
+    adj9  = simd256_madd_(a0, m1, adj9);
+    adj9  = simd256_nmadd_(a1, m3, adj9);
+    adj9  = simd256_nmadd_(a3, m5, adj9);
 
     __m256d adj10 = _mm256_set1_pd(0.0);
-    adj10 = _mm256_sub_pd(adj10, _mm256_mul_pd(a12, m7));
-    adj10 = _mm256_add_pd(adj10, _mm256_mul_pd(a13, m9));
-    adj10 = _mm256_add_pd(adj10, _mm256_mul_pd(a15, m11));
+    adj10 = simd256_nmadd_(a12, m7, adj10);
+    adj10 = simd256_madd_(a13, m9, adj10);
+    adj10 = simd256_madd_(a15, m11, adj10);
 
     __m256d adj11 = _mm256_set1_pd(0.0);
-    adj11 = _mm256_add_pd(adj11, _mm256_mul_pd(a8,  m7));
-    adj11 = _mm256_sub_pd(adj11, _mm256_mul_pd(a9,  m9));
-    adj11 = _mm256_sub_pd(adj11, _mm256_mul_pd(a11, m11));
+    adj11 = simd256_madd_(a8, m7, adj11);
+    adj11 = simd256_nmadd_(a9, m9, adj11);
+    adj11 = simd256_nmadd_(a11, m11, adj11);
 
     //
     // adj12 = -a4  * m2 + a5  * m4  - a6  * m5
@@ -950,24 +1009,24 @@ inline Mat4<double> Inverse(const Mat4<double> &a)
     // adj15 =  a8  * m8 - a9  * m10 + a10 * m11
     //
     __m256d adj12 = _mm256_set1_pd(0.0);
-    adj12 = _mm256_sub_pd(adj12, _mm256_mul_pd(a4, m2));
-    adj12 = _mm256_add_pd(adj12, _mm256_mul_pd(a5, m4));
-    adj12 = _mm256_sub_pd(adj12, _mm256_mul_pd(a6, m5));
+    adj12 = simd256_nmadd_(a4, m2, adj12);
+    adj12 = simd256_madd_(a5, m4, adj12);
+    adj12 = simd256_nmadd_(a6, m5, adj12);
 
     __m256d adj13 = _mm256_set1_pd(0.0);
-    adj13 = _mm256_add_pd(adj13, _mm256_mul_pd(a0, m2));
-    adj13 = _mm256_sub_pd(adj13, _mm256_mul_pd(a1, m4));
-    adj13 = _mm256_add_pd(adj13, _mm256_mul_pd(a2, m5));
+    adj13 = simd256_madd_(a0, m2, adj13);
+    adj13 = simd256_nmadd_(a1, m4, adj13);
+    adj13 = simd256_madd_(a2, m5, adj13);
 
     __m256d adj14 = _mm256_set1_pd(0.0);
-    adj14 = _mm256_sub_pd(adj14, _mm256_mul_pd(a12, m8));
-    adj14 = _mm256_add_pd(adj14, _mm256_mul_pd(a13, m10));
-    adj14 = _mm256_sub_pd(adj14, _mm256_mul_pd(a14, m11));
+    adj14 = simd256_nmadd_(a12, m8, adj14);
+    adj14 = simd256_madd_(a13, m10, adj14);
+    adj14 = simd256_nmadd_(a14, m11, adj14);
 
     __m256d adj15 = _mm256_set1_pd(0.0);
-    adj15 = _mm256_add_pd(adj15, _mm256_mul_pd(a8,  m8));
-    adj15 = _mm256_sub_pd(adj15, _mm256_mul_pd(a9,  m10));
-    adj15 = _mm256_add_pd(adj15, _mm256_mul_pd(a10, m11));
+    adj15 = simd256_madd_(a8, m8, adj15);
+    adj15 = simd256_nmadd_(a9, m10, adj15);
+    adj15 = simd256_madd_(a10, m11, adj15);
 
     //
     // _mm256_unpackhi_pd(__m256d a, __m256d b)
@@ -1051,6 +1110,512 @@ inline Mat4<double> Inverse(const Mat4<double> &a)
     return result;
 }
 
+/// ---- Single-precision specializations -------------------------------------
+/// @brief Return the 2-dimensional dot product.
+///
+template<>
+MATH_SIMD_CONSTEXPR float Dot(const Vec2<float> &v, const Vec2<float> &w)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(v, w);
+    }
+
+    const __m128 a = simd_load(v);
+    const __m128 b = simd_load(w);
+    return _mm_cvtss_f32(simd128_dot_(a, b));
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> Dot(const Mat2<float> &a, const Vec2<float> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, v);
+    }
+
+    //
+    // m = {a0*b0, a1*b1, a2*b0, a3*b1}
+    //
+    __m128 m = simd_load(a);
+    __m128 b = simd_load(v);
+    __m128 mul = _mm_mul_ps(m, simd128_swizzle_ps(b, 0, 1, 0, 1));
+    //
+    // c = {a0*b0 + a1*b1, a2*b0 + a3*b1, ...}
+    //
+    Vec2<float> result{};
+    simd_store(result, _mm_hadd_ps(mul, mul));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> Dot(const Mat2<float> &a, const Mat2<float> &b)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, b);
+    }
+
+    Mat2<float> result{};
+    simd_store(result, simd128_mat2mul_(simd_load(a), simd_load(b)));
+    return result;
+}
+
+///
+/// @brief Return the 3-dimensional dot product.
+///
+template<>
+MATH_SIMD_CONSTEXPR float Dot(const Vec3<float> &v, const Vec3<float> &w)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(v, w);
+    }
+
+    const __m128 a = simd_load(v);
+    const __m128 b = simd_load(w);
+    return _mm_cvtss_f32(simd128_dot_(a, b));
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> Dot(const Mat3<float> &a, const Vec3<float> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, v);
+    }
+
+    //
+    // c0 = {a0*b0, a1*b1, a2*b2, 0}
+    // c1 = {a3*b0, a4*b1, a5*b2, 0}
+    // c2 = {a6*b0, a7*b1, a8*b2, 0}
+    //
+    __m128 b  = simd_load(v);
+    __m128 c0 = _mm_mul_ps(simd_load(a, 0), b);
+    __m128 c1 = _mm_mul_ps(simd_load(a, 1), b);
+    __m128 c2 = _mm_mul_ps(simd_load(a, 2), b);
+    //
+    // _mm_hadd_ps(__m128 a, __m128 b)
+    //  dst = {a0 + a1, a2 + a3, b0 + b1, b2 + b3}
+    //
+    __m128 mul = _mm_hadd_ps(
+        _mm_hadd_ps(c0, c1),
+        _mm_hadd_ps(c2, _mm_setzero_ps()));
+
+    Vec3<float> result{};
+    simd_store(result, mul);
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> Dot(const Mat3<float> &a, const Mat3<float> &b)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, b);
+    }
+
+    __m128 b0 = simd_load(b, 0);
+    __m128 b1 = simd_load(b, 1);
+    __m128 b2 = simd_load(b, 2);
+
+    Mat3<float> result{};
+    for (size_t i = 0; i < 3; ++i) {
+        //
+        // mul = {a_n * b0 + a_m * b3 + a_l * b6,
+        //        a_n * b1 + a_m * b4 + a_l * b7,
+        //        a_n * b2 + a_m * b5 + a_l * b8, 0}
+        //
+        __m128 mul = _mm_mul_ps(_mm_set1_ps(a[i * a.dim + 0]), b0);
+        mul = simd128_madd_(_mm_set1_ps(a[i * a.dim + 1]), b1, mul);
+        mul = simd128_madd_(_mm_set1_ps(a[i * a.dim + 2]), b2, mul);
+        simd_store(result, i, mul);
+    }
+    return result;
+}
+
+///
+/// @brief Return the 4-dimensional dot product.
+///
+template<>
+MATH_SIMD_CONSTEXPR float Dot(const Vec4<float> &v, const Vec4<float> &w)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(v, w);
+    }
+
+    const __m128 a = simd_load(v);
+    const __m128 b = simd_load(w);
+    return _mm_cvtss_f32(simd128_dot_(a, b));
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> Dot(const Mat4<float> &a, const Vec4<float> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, v);
+    }
+
+    __m128 b  = simd_load(v);
+    __m128 c0 = _mm_mul_ps(simd_load(a, 0), b);
+    __m128 c1 = _mm_mul_ps(simd_load(a, 1), b);
+    __m128 c2 = _mm_mul_ps(simd_load(a, 2), b);
+    __m128 c3 = _mm_mul_ps(simd_load(a, 3), b);
+    __m128 mul = _mm_hadd_ps(_mm_hadd_ps(c0, c1), _mm_hadd_ps(c2, c3));
+
+    Vec4<float> result{};
+    simd_store(result, mul);
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> Dot(const Mat4<float> &a, const Mat4<float> &b)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, b);
+    }
+
+    __m128 b0 = simd_load(b, 0);
+    __m128 b1 = simd_load(b, 1);
+    __m128 b2 = simd_load(b, 2);
+    __m128 b3 = simd_load(b, 3);
+
+    Mat4<float> result{};
+    for (size_t i = 0; i < 4; ++i) {
+        //
+        // mul = a_n * b0 + a_m * b1 + a_l * b2 + a_k * b3
+        //
+        __m128 mul = _mm_mul_ps(_mm_set1_ps(a[i * a.dim + 0]), b0);
+        mul = simd128_madd_(_mm_set1_ps(a[i * a.dim + 1]), b1, mul);
+        mul = simd128_madd_(_mm_set1_ps(a[i * a.dim + 2]), b2, mul);
+        mul = simd128_madd_(_mm_set1_ps(a[i * a.dim + 3]), b3, mul);
+        simd_store(result, i, mul);
+    }
+    return result;
+}
+
+///
+/// @brief Return the norm of the specified vector.
+///
+template<>
+inline float Norm(const Vec2<float> &v)
+{
+    return _mm_cvtss_f32(simd128_norm_(simd_load(v)));
+}
+
+template<>
+inline float Norm(const Vec3<float> &v)
+{
+    return _mm_cvtss_f32(simd128_norm_(simd_load(v)));
+}
+
+template<>
+inline float Norm(const Vec4<float> &v)
+{
+    return _mm_cvtss_f32(simd128_norm_(simd_load(v)));
+}
+
+///
+/// @brief Return the normalized vector.
+///
+template<>
+inline Vec2<float> Normalize(const Vec2<float> &v)
+{
+    Vec2<float> result{};
+    simd_store(result, simd128_normalize_(simd_load(v)));
+    return result;
+}
+
+template<>
+inline Vec3<float> Normalize(const Vec3<float> &v)
+{
+    Vec3<float> result{};
+    simd_store(result, simd128_normalize_(simd_load(v)));
+    return result;
+}
+
+template<>
+inline Vec4<float> Normalize(const Vec4<float> &v)
+{
+    Vec4<float> result{};
+    simd_store(result, simd128_normalize_(simd_load(v)));
+    return result;
+}
+
+///
+/// @brief Return the distance between two vectors.
+///
+template<>
+inline float Distance(const Vec2<float> &a, const Vec2<float> &b)
+{
+    __m128 d = _mm_sub_ps(simd_load(a), simd_load(b));
+    return _mm_cvtss_f32(simd128_norm_(d));
+}
+
+template<>
+inline float Distance(const Vec3<float> &a, const Vec3<float> &b)
+{
+    __m128 d = _mm_sub_ps(simd_load(a), simd_load(b));
+    return _mm_cvtss_f32(simd128_norm_(d));
+}
+
+template<>
+inline float Distance(const Vec4<float> &a, const Vec4<float> &b)
+{
+    __m128 d = _mm_sub_ps(simd_load(a), simd_load(b));
+    return _mm_cvtss_f32(simd128_norm_(d));
+}
+
+///
+/// @brief Return the cross product of two vectors.
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> Cross(
+    const Vec3<float> &a, const Vec3<float> &b)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarCross(a, b);
+    }
+
+    Vec3<float> result{};
+    simd_store(result, simd128_cross_(simd_load(a), simd_load(b)));
+    return result;
+}
+
+///
+/// @brief Return the transpose matrix
+///
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> Transpose(const Mat2<float> &a)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarTranspose(a);
+    }
+
+    //
+    // {a0, a1, a2, a3} -> {a0, a2, a1, a3}
+    //
+    Mat2<float> result{};
+    simd_store(result, simd128_swizzle_ps(simd_load(a), 0, 2, 1, 3));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> Transpose(const Mat3<float> &a)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarTranspose(a);
+    }
+
+    __m128 row[4] = {};
+    row[0] = simd_load(a, 0);
+    row[1] = simd_load(a, 1);
+    row[2] = simd_load(a, 2);
+    row[3] = _mm_setzero_ps();
+    simd128_transpose_(row);
+
+    Mat3<float> result{};
+    simd_store(result, 0, row[0]);
+    simd_store(result, 1, row[1]);
+    simd_store(result, 2, row[2]);
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> Transpose(const Mat4<float> &a)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarTranspose(a);
+    }
+
+    __m128 row[4] = {};
+    row[0] = simd_load(a, 0);
+    row[1] = simd_load(a, 1);
+    row[2] = simd_load(a, 2);
+    row[3] = simd_load(a, 3);
+    simd128_transpose_(row);
+
+    Mat4<float> result{};
+    simd_store(result, 0, row[0]);
+    simd_store(result, 1, row[1]);
+    simd_store(result, 2, row[2]);
+    simd_store(result, 3, row[3]);
+    return result;
+}
+
+///
+/// @brief Compute the determinant of the specified matrix.
+///
+template<>
+MATH_SIMD_CONSTEXPR float Determinant(const Mat2<float> &a)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDeterminant(a);
+    }
+
+    return _mm_cvtss_f32(simd128_det_(simd_load(a)));
+}
+
+template<>
+MATH_SIMD_CONSTEXPR float Determinant(const Mat3<float> &a)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDeterminant(a);
+    }
+
+    //
+    // det(a) = r0 . (r1 x r2)
+    //
+    __m128 r0 = simd_load(a, 0);
+    __m128 r1 = simd_load(a, 1);
+    __m128 r2 = simd_load(a, 2);
+    return _mm_cvtss_f32(simd128_dot_(r0, simd128_cross_(r1, r2)));
+}
+
+template<>
+MATH_SIMD_CONSTEXPR float Determinant(const Mat4<float> &a)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDeterminant(a);
+    }
+
+    __m128 row[4] = {
+        simd_load(a, 0),
+        simd_load(a, 1),
+        simd_load(a, 2),
+        simd_load(a, 3)};
+    __m128 block[4] = {};
+    __m128 det[4] = {};
+    __m128 a_b = {};
+    __m128 d_c = {};
+    return _mm_cvtss_f32(simd128_det4_(row, block, det, a_b, d_c));
+}
+
+///
+/// @brief Return the inverse of the matrix. The inverse is set to zero if the
+/// determinant is null.
+///
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> Inverse(const Mat2<float> &a)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarInverse(a);
+    }
+
+    //
+    // inv(a) = adj(a) / det(a),  adj(a) = {a3, -a1, -a2, a0}
+    //
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 sign = _mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f);
+
+    __m128 m = simd_load(a);
+    __m128 det = simd128_det_(m);
+    __m128 adj = _mm_mul_ps(simd128_swizzle_ps(m, 3, 1, 2, 0), sign);
+    __m128 inv = _mm_and_ps(_mm_div_ps(adj, det), _mm_cmpneq_ps(det, zero));
+
+    Mat2<float> result{};
+    simd_store(result, inv);
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> Inverse(const Mat3<float> &a)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarInverse(a);
+    }
+
+    //
+    // The columns of the adjugate are the cross products of the rows,
+    //  adj(a) = {r1 x r2, r2 x r0, r0 x r1}^t
+    //  det(a) = r0 . (r1 x r2)
+    //
+    const __m128 zero = _mm_setzero_ps();
+
+    __m128 r0 = simd_load(a, 0);
+    __m128 r1 = simd_load(a, 1);
+    __m128 r2 = simd_load(a, 2);
+
+    __m128 row[4] = {};
+    row[0] = simd128_cross_(r1, r2);
+    row[1] = simd128_cross_(r2, r0);
+    row[2] = simd128_cross_(r0, r1);
+    row[3] = zero;
+
+    __m128 det = simd128_dot_(r0, row[0]);
+    __m128 mask = _mm_cmpneq_ps(det, zero);
+    simd128_transpose_(row);
+
+    Mat3<float> result{};
+    simd_store(result, 0, _mm_and_ps(_mm_div_ps(row[0], det), mask));
+    simd_store(result, 1, _mm_and_ps(_mm_div_ps(row[1], det), mask));
+    simd_store(result, 2, _mm_and_ps(_mm_div_ps(row[2], det), mask));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> Inverse(const Mat4<float> &a)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarInverse(a);
+    }
+
+    //
+    // Compute the inverse from the 2x2 block decomposition of the matrix,
+    //  a = {A, B,
+    //       C, D}
+    //
+    //  inv(a) = 1/det(a) * {X, Y,
+    //                       Z, W}
+    //
+    // where the adjugates of the blocks are given by
+    //  adj(X) = det(D)*A - B*adj(D)*C
+    //  adj(Y) = det(B)*C - D*adj(adj(A)*B)
+    //  adj(Z) = det(C)*B - A*adj(adj(D)*C)
+    //  adj(W) = det(A)*D - C*adj(A)*B
+    //
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 sign = _mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f);
+
+    __m128 row[4] = {
+        simd_load(a, 0),
+        simd_load(a, 1),
+        simd_load(a, 2),
+        simd_load(a, 3)};
+    __m128 block[4] = {};
+    __m128 det[4] = {};
+    __m128 a_b = {};
+    __m128 d_c = {};
+    __m128 det_m = simd128_det4_(row, block, det, a_b, d_c);
+
+    __m128 x = simd128_msub_(
+        det[3], block[0], simd128_mat2mul_(block[1], d_c));
+    __m128 w = simd128_msub_(
+        det[0], block[3], simd128_mat2mul_(block[2], a_b));
+    __m128 y = simd128_msub_(
+        det[1], block[2], simd128_mat2muladj_(block[3], a_b));
+    __m128 z = simd128_msub_(
+        det[2], block[1], simd128_mat2muladj_(block[0], d_c));
+    //
+    // Scale by the signed inverse determinant and set the inverse to zero if
+    // the determinant is null.
+    //
+    __m128 mask = _mm_cmpneq_ps(det_m, zero);
+    __m128 inv_det = _mm_and_ps(_mm_div_ps(sign, det_m), mask);
+    x = _mm_mul_ps(x, inv_det);
+    y = _mm_mul_ps(y, inv_det);
+    z = _mm_mul_ps(z, inv_det);
+    w = _mm_mul_ps(w, inv_det);
+    //
+    // Apply the adjugate of each block and store the rows,
+    //  row0 = {x3, x1, y3, y1}
+    //  row1 = {x2, x0, y2, y0}
+    //  row2 = {z3, z1, w3, w1}
+    //  row3 = {z2, z0, w2, w0}
+    //
+    Mat4<float> result{};
+    simd_store(result, 0, simd128_shuffle_ps(x, y, 3, 1, 3, 1));
+    simd_store(result, 1, simd128_shuffle_ps(x, y, 2, 0, 2, 0));
+    simd_store(result, 2, simd128_shuffle_ps(z, w, 3, 1, 3, 1));
+    simd_store(result, 3, simd128_shuffle_ps(z, w, 2, 0, 2, 0));
+    return result;
+}
+
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 #endif // MATH_SIMD_ALGEBRA_H_
@@ -13,6 +13,7 @@
 #include "common.h"
 
 namespace Math {
+inline namespace MATH_SIMD_ISA {
 
 /// -----------------------------------------------------------------------------
 /// @brief Find the nearest integer to the vector elements.
@@ -365,11 +366,15 @@ inline Vec4<double> SmoothStep(
 /// @brief Linear interpolation between lo and hi.
 ///
 template<>
-inline Vec2<double> Lerp(
+MATH_SIMD_CONSTEXPR Vec2<double> Lerp(
     const Vec2<double> &lo,
     const Vec2<double> &hi,
     const Vec2<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Lerp(lo[0], hi[0], u[0]), Lerp(lo[1], hi[1], u[1])};
+    }
+
     const __m128d one = _mm_set1_pd(1.0);
     __m128d a_lo = simd_load(lo);
     __m128d a_hi = simd_load(hi);
@@ -385,11 +390,18 @@ inline Vec2<double> Lerp(
 }
 
 template<>
-inline Vec3<double> Lerp(
+MATH_SIMD_CONSTEXPR Vec3<double> Lerp(
     const Vec3<double> &lo,
     const Vec3<double> &hi,
     const Vec3<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            Lerp(lo[0], hi[0], u[0]),
+            Lerp(lo[1], hi[1], u[1]),
+            Lerp(lo[2], hi[2], u[2])};
+    }
+
     const __m256d one = _mm256_set1_pd(1.0);
     __m256d a_lo = simd_load(lo);
     __m256d a_hi = simd_load(hi);
@@ -405,11 +417,19 @@ inline Vec3<double> Lerp(
 }
 
 template<>
-inline Vec4<double> Lerp(
+MATH_SIMD_CONSTEXPR Vec4<double> Lerp(
     const Vec4<double> &lo,
     const Vec4<double> &hi,
     const Vec4<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            Lerp(lo[0], hi[0], u[0]),
+            Lerp(lo[1], hi[1], u[1]),
+            Lerp(lo[2], hi[2], u[2]),
+            Lerp(lo[3], hi[3], u[3])};
+    }
+
     const __m256d one = _mm256_set1_pd(1.0);
     __m256d a_lo = simd_load(lo);
     __m256d a_hi = simd_load(hi);
@@ -428,8 +448,12 @@ inline Vec4<double> Lerp(
 /// @brief Convert degrees to radians.
 ///
 template<>
-inline Vec2<double> Radians(const Vec2<double> &u)
+MATH_SIMD_CONSTEXPR Vec2<double> Radians(const Vec2<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Radians(u[0]), Radians(u[1])};
+    }
+
     const __m128d deg_to_rad = _mm_set1_pd(M_PI / 180);
     __m128d a = simd_load(u);
     __m128d val = _mm_mul_pd(a, deg_to_rad);
@@ -440,8 +464,12 @@ inline Vec2<double> Radians(const Vec2<double> &u)
 }
 
 template<>
-inline Vec3<double> Radians(const Vec3<double> &u)
+MATH_SIMD_CONSTEXPR Vec3<double> Radians(const Vec3<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Radians(u[0]), Radians(u[1]), Radians(u[2])};
+    }
+
     const __m256d deg_to_rad = _mm256_set1_pd(M_PI / 180);
     __m256d a = simd_load(u);
     __m256d val = _mm256_mul_pd(a, deg_to_rad);
@@ -452,8 +480,12 @@ inline Vec3<double> Radians(const Vec3<double> &u)
 }
 
 template<>
-inline Vec4<double> Radians(const Vec4<double> &u)
+MATH_SIMD_CONSTEXPR Vec4<double> Radians(const Vec4<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Radians(u[0]), Radians(u[1]), Radians(u[2]), Radians(u[3])};
+    }
+
     const __m256d deg_to_rad = _mm256_set1_pd(M_PI / 180);
     __m256d a = simd_load(u);
     __m256d val = _mm256_mul_pd(a, deg_to_rad);
@@ -467,8 +499,12 @@ inline Vec4<double> Radians(const Vec4<double> &u)
 /// @brief Convert radians to degrees.
 ///
 template<>
-inline Vec2<double> Degrees(const Vec2<double> &u)
+MATH_SIMD_CONSTEXPR Vec2<double> Degrees(const Vec2<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Degrees(u[0]), Degrees(u[1])};
+    }
+
     const __m128d rad_to_deg = _mm_set1_pd(180 / M_PI);
     __m128d a = simd_load(u);
     __m128d val = _mm_mul_pd(a, rad_to_deg);
@@ -479,8 +515,12 @@ inline Vec2<double> Degrees(const Vec2<double> &u)
 }
 
 template<>
-inline Vec3<double> Degrees(const Vec3<double> &u)
+MATH_SIMD_CONSTEXPR Vec3<double> Degrees(const Vec3<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Degrees(u[0]), Degrees(u[1]), Degrees(u[2])};
+    }
+
     const __m256d rad_to_deg = _mm256_set1_pd(180 / M_PI);
     __m256d a = simd_load(u);
     __m256d val = _mm256_mul_pd(a, rad_to_deg);
@@ -491,8 +531,12 @@ inline Vec3<double> Degrees(const Vec3<double> &u)
 }
 
 template<>
-inline Vec4<double> Degrees(const Vec4<double> &u)
+MATH_SIMD_CONSTEXPR Vec4<double> Degrees(const Vec4<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Degrees(u[0]), Degrees(u[1]), Degrees(u[2]), Degrees(u[3])};
+    }
+
     const __m256d rad_to_deg = _mm256_set1_pd(180 / M_PI);
     __m256d a = simd_load(u);
     __m256d val = _mm256_mul_pd(a, rad_to_deg);
@@ -506,8 +550,12 @@ inline Vec4<double> Degrees(const Vec4<double> &u)
 /// @brief Return the signum function of u.
 ///
 template<>
-inline Vec2<double> Sign(const Vec2<double> &u)
+MATH_SIMD_CONSTEXPR Vec2<double> Sign(const Vec2<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Sign(u[0]), Sign(u[1])};
+    }
+
     const __m128d zero = _mm_set1_pd(0.0);
     const __m128d plus_one = _mm_set1_pd(1.0);
     const __m128d minus_one = _mm_set1_pd(-1.0);
@@ -523,8 +571,12 @@ inline Vec2<double> Sign(const Vec2<double> &u)
 }
 
 template<>
-inline Vec3<double> Sign(const Vec3<double> &u)
+MATH_SIMD_CONSTEXPR Vec3<double> Sign(const Vec3<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Sign(u[0]), Sign(u[1]), Sign(u[2])};
+    }
+
     const __m256d zero = _mm256_set1_pd(0.0);
     const __m256d plus_one = _mm256_set1_pd(1.0);
     const __m256d minus_one = _mm256_set1_pd(-1.0);
@@ -540,8 +592,12 @@ inline Vec3<double> Sign(const Vec3<double> &u)
 }
 
 template<>
-inline Vec4<double> Sign(const Vec4<double> &u)
+MATH_SIMD_CONSTEXPR Vec4<double> Sign(const Vec4<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Sign(u[0]), Sign(u[1]), Sign(u[2]), Sign(u[3])};
+    }
+
     const __m256d zero = _mm256_set1_pd(0.0);
     const __m256d plus_one = _mm256_set1_pd(1.0);
     const __m256d minus_one = _mm256_set1_pd(-1.0);
@@ -561,8 +617,12 @@ inline Vec4<double> Sign(const Vec4<double> &u)
 /// |a| = Max((0-a), a) = Max(-a,a)
 ///
 template<>
-inline Vec2<double> Abs(const Vec2<double> &u)
+MATH_SIMD_CONSTEXPR Vec2<double> Abs(const Vec2<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Abs(u[0]), Abs(u[1])};
+    }
+
     const __m128d zero = _mm_set1_pd(0.0);
 
     __m128d a = simd_load(u);
@@ -574,8 +634,12 @@ inline Vec2<double> Abs(const Vec2<double> &u)
 }
 
 template<>
-inline Vec3<double> Abs(const Vec3<double> &u)
+MATH_SIMD_CONSTEXPR Vec3<double> Abs(const Vec3<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Abs(u[0]), Abs(u[1]), Abs(u[2])};
+    }
+
     const __m256d zero = _mm256_set1_pd(0.0);
 
     __m256d a = simd_load(u);
@@ -587,8 +651,12 @@ inline Vec3<double> Abs(const Vec3<double> &u)
 }
 
 template<>
-inline Vec4<double> Abs(const Vec4<double> &u)
+MATH_SIMD_CONSTEXPR Vec4<double> Abs(const Vec4<double> &u)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Abs(u[0]), Abs(u[1]), Abs(u[2]), Abs(u[3])};
+    }
+
     const __m256d zero = _mm256_set1_pd(0.0);
 
     __m256d a = simd_load(u);
@@ -603,24 +671,43 @@ inline Vec4<double> Abs(const Vec4<double> &u)
 /// @brief Return the min between u and v.
 ///
 template<>
-inline Vec2<double> Min(const Vec2<double> &u, const Vec2<double> &v)
+MATH_SIMD_CONSTEXPR Vec2<double> Min(
+    const Vec2<double> &u, const Vec2<double> &v)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Min(u[0], v[0]), Min(u[1], v[1])};
+    }
+
     Vec2<double> result{};
     simd_store(result, _mm_min_pd(simd_load(u), simd_load(v)));
     return result;
 }
 
 template<>
-inline Vec3<double> Min(const Vec3<double> &u, const Vec3<double> &v)
+MATH_SIMD_CONSTEXPR Vec3<double> Min(
+    const Vec3<double> &u, const Vec3<double> &v)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Min(u[0], v[0]), Min(u[1], v[1]), Min(u[2], v[2])};
+    }
+
     Vec3<double> result{};
     simd_store(result, _mm256_min_pd(simd_load(u), simd_load(v)));
     return result;
 }
 
 template<>
-inline Vec4<double> Min(const Vec4<double> &u, const Vec4<double> &v)
+MATH_SIMD_CONSTEXPR Vec4<double> Min(
+    const Vec4<double> &u, const Vec4<double> &v)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            Min(u[0], v[0]),
+            Min(u[1], v[1]),
+            Min(u[2], v[2]),
+            Min(u[3], v[3])};
+    }
+
     Vec4<double> result{};
     simd_store(result, _mm256_min_pd(simd_load(u), simd_load(v)));
     return result;
@@ -630,24 +717,43 @@ inline Vec4<double> Min(const Vec4<double> &u, const Vec4<double> &v)
 /// @brief Return the max between u and v.
 ///
 template<>
-inline Vec2<double> Max(const Vec2<double> &u, const Vec2<double> &v)
+MATH_SIMD_CONSTEXPR Vec2<double> Max(
+    const Vec2<double> &u, const Vec2<double> &v)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Max(u[0], v[0]), Max(u[1], v[1])};
+    }
+
     Vec2<double> result{};
     simd_store(result, _mm_max_pd(simd_load(u), simd_load(v)));
     return result;
 }
 
 template<>
-inline Vec3<double> Max(const Vec3<double> &u, const Vec3<double> &v)
+MATH_SIMD_CONSTEXPR Vec3<double> Max(
+    const Vec3<double> &u, const Vec3<double> &v)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Max(u[0], v[0]), Max(u[1], v[1]), Max(u[2], v[2])};
+    }
+
     Vec3<double> result{};
     simd_store(result, _mm256_max_pd(simd_load(u), simd_load(v)));
     return result;
 }
 
 template<>
-inline Vec4<double> Max(const Vec4<double> &u, const Vec4<double> &v)
+MATH_SIMD_CONSTEXPR Vec4<double> Max(
+    const Vec4<double> &u, const Vec4<double> &v)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            Max(u[0], v[0]),
+            Max(u[1], v[1]),
+            Max(u[2], v[2]),
+            Max(u[3], v[3])};
+    }
+
     Vec4<double> result{};
     simd_store(result, _mm256_max_pd(simd_load(u), simd_load(v)));
     return result;
@@ -659,11 +765,15 @@ inline Vec4<double> Max(const Vec4<double> &u, const Vec4<double> &v)
 /// @brief Clamp u between lo and hi.
 ///
 template<>
-inline Vec2<double> Clamp(
+MATH_SIMD_CONSTEXPR Vec2<double> Clamp(
     const Vec2<double> &u,
     const Vec2<double> &lo,
     const Vec2<double> &hi)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Clamp(u[0], lo[0], hi[0]), Clamp(u[1], lo[1], hi[1])};
+    }
+
     __m128d a = simd_load(u);
     __m128d a_lo = simd_load(lo);
     __m128d a_hi = simd_load(hi);
@@ -673,11 +783,18 @@ inline Vec2<double> Clamp(
     return result;
 }
 template<>
-inline Vec3<double> Clamp(
+MATH_SIMD_CONSTEXPR Vec3<double> Clamp(
     const Vec3<double> &u,
     const Vec3<double> &lo,
     const Vec3<double> &hi)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            Clamp(u[0], lo[0], hi[0]),
+            Clamp(u[1], lo[1], hi[1]),
+            Clamp(u[2], lo[2], hi[2])};
+    }
+
     __m256d a = simd_load(u);
     __m256d a_lo = simd_load(lo);
     __m256d a_hi = simd_load(hi);
@@ -687,11 +804,19 @@ inline Vec3<double> Clamp(
     return result;
 }
 template<>
-inline Vec4<double> Clamp(
+MATH_SIMD_CONSTEXPR Vec4<double> Clamp(
     const Vec4<double> &u,
     const Vec4<double> &lo,
     const Vec4<double> &hi)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            Clamp(u[0], lo[0], hi[0]),
+            Clamp(u[1], lo[1], hi[1]),
+            Clamp(u[2], lo[2], hi[2]),
+            Clamp(u[3], lo[3], hi[3])};
+    }
+
     __m256d a = simd_load(u);
     __m256d a_lo = simd_load(lo);
     __m256d a_hi = simd_load(hi);
@@ -701,6 +826,661 @@ inline Vec4<double> Clamp(
     return result;
 }
 
+/// -----------------------------------------------------------------------------
+/// @brief Return the absolute value of the signed integer vector elements.
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> Abs(const Vec2<int32_t> &u)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Abs(u[0]), Abs(u[1])};
+    }
+
+    Vec2<int32_t> result{};
+    simd_store(result, _mm_abs_epi32(simd_load(u)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> Abs(const Vec3<int32_t> &u)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Abs(u[0]), Abs(u[1]), Abs(u[2])};
+    }
+
+    Vec3<int32_t> result{};
+    simd_store(result, _mm_abs_epi32(simd_load(u)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> Abs(const Vec4<int32_t> &u)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Abs(u[0]), Abs(u[1]), Abs(u[2]), Abs(u[3])};
+    }
+
+    Vec4<int32_t> result{};
+    simd_store(result, _mm_abs_epi32(simd_load(u)));
+    return result;
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Return the min between the integer vectors u and v.
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> Min(
+    const Vec2<int32_t> &u, const Vec2<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Min(u[0], v[0]), Min(u[1], v[1])};
+    }
+
+    Vec2<int32_t> result{};
+    simd_store(result, _mm_min_epi32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> Min(
+    const Vec2<uint32_t> &u, const Vec2<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Min(u[0], v[0]), Min(u[1], v[1])};
+    }
+
+    Vec2<uint32_t> result{};
+    simd_store(result, _mm_min_epu32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> Min(
+    const Vec3<int32_t> &u, const Vec3<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Min(u[0], v[0]), Min(u[1], v[1]), Min(u[2], v[2])};
+    }
+
+    Vec3<int32_t> result{};
+    simd_store(result, _mm_min_epi32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> Min(
+    const Vec3<uint32_t> &u, const Vec3<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Min(u[0], v[0]), Min(u[1], v[1]), Min(u[2], v[2])};
+    }
+
+    Vec3<uint32_t> result{};
+    simd_store(result, _mm_min_epu32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> Min(
+    const Vec4<int32_t> &u, const Vec4<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            Min(u[0], v[0]),
+            Min(u[1], v[1]),
+            Min(u[2], v[2]),
+            Min(u[3], v[3])};
+    }
+
+    Vec4<int32_t> result{};
+    simd_store(result, _mm_min_epi32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> Min(
+    const Vec4<uint32_t> &u, const Vec4<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            Min(u[0], v[0]),
+            Min(u[1], v[1]),
+            Min(u[2], v[2]),
+            Min(u[3], v[3])};
+    }
+
+    Vec4<uint32_t> result{};
+    simd_store(result, _mm_min_epu32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Return the max between the integer vectors u and v.
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> Max(
+    const Vec2<int32_t> &u, const Vec2<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Max(u[0], v[0]), Max(u[1], v[1])};
+    }
+
+    Vec2<int32_t> result{};
+    simd_store(result, _mm_max_epi32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> Max(
+    const Vec2<uint32_t> &u, const Vec2<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Max(u[0], v[0]), Max(u[1], v[1])};
+    }
+
+    Vec2<uint32_t> result{};
+    simd_store(result, _mm_max_epu32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> Max(
+    const Vec3<int32_t> &u, const Vec3<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Max(u[0], v[0]), Max(u[1], v[1]), Max(u[2], v[2])};
+    }
+
+    Vec3<int32_t> result{};
+    simd_store(result, _mm_max_epi32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> Max(
+    const Vec3<uint32_t> &u, const Vec3<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {Max(u[0], v[0]), Max(u[1], v[1]), Max(u[2], v[2])};
+    }
+
+    Vec3<uint32_t> result{};
+    simd_store(result, _mm_max_epu32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> Max(
+    const Vec4<int32_t> &u, const Vec4<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            Max(u[0], v[0]),
+            Max(u[1], v[1]),
+            Max(u[2], v[2]),
+            Max(u[3], v[3])};
+    }
+
+    Vec4<int32_t> result{};
+    simd_store(result, _mm_max_epi32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> Max(
+    const Vec4<uint32_t> &u, const Vec4<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            Max(u[0], v[0]),
+            Max(u[1], v[1]),
+            Max(u[2], v[2]),
+            Max(u[3], v[3])};
+    }
+
+    Vec4<uint32_t> result{};
+    simd_store(result, _mm_max_epu32(simd_load(u), simd_load(v)));
+    return result;
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Compare the integer vectors u and v element-wise. The comparison
+/// masks are shifted down to one or zero per element. Unsigned vectors are
+/// compared as signed vectors with the sign bits flipped.
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> Equal(
+    const Vec2<int32_t> &u, const Vec2<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {(int32_t) (u[0] == v[0]), (int32_t) (u[1] == v[1])};
+    }
+
+    __m128i mask = _mm_cmpeq_epi32(simd_load(u), simd_load(v));
+    Vec2<int32_t> result{};
+    simd_store(result, _mm_srli_epi32(mask, 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> Equal(
+    const Vec2<uint32_t> &u, const Vec2<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {(uint32_t) (u[0] == v[0]), (uint32_t) (u[1] == v[1])};
+    }
+
+    __m128i mask = _mm_cmpeq_epi32(simd_load(u), simd_load(v));
+    Vec2<uint32_t> result{};
+    simd_store(result, _mm_srli_epi32(mask, 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> Equal(
+    const Vec3<int32_t> &u, const Vec3<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (int32_t) (u[0] == v[0]),
+            (int32_t) (u[1] == v[1]),
+            (int32_t) (u[2] == v[2])};
+    }
+
+    __m128i mask = _mm_cmpeq_epi32(simd_load(u), simd_load(v));
+    Vec3<int32_t> result{};
+    simd_store(result, _mm_srli_epi32(mask, 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> Equal(
+    const Vec3<uint32_t> &u, const Vec3<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (uint32_t) (u[0] == v[0]),
+            (uint32_t) (u[1] == v[1]),
+            (uint32_t) (u[2] == v[2])};
+    }
+
+    __m128i mask = _mm_cmpeq_epi32(simd_load(u), simd_load(v));
+    Vec3<uint32_t> result{};
+    simd_store(result, _mm_srli_epi32(mask, 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> Equal(
+    const Vec4<int32_t> &u, const Vec4<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (int32_t) (u[0] == v[0]),
+            (int32_t) (u[1] == v[1]),
+            (int32_t) (u[2] == v[2]),
+            (int32_t) (u[3] == v[3])};
+    }
+
+    __m128i mask = _mm_cmpeq_epi32(simd_load(u), simd_load(v));
+    Vec4<int32_t> result{};
+    simd_store(result, _mm_srli_epi32(mask, 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> Equal(
+    const Vec4<uint32_t> &u, const Vec4<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (uint32_t) (u[0] == v[0]),
+            (uint32_t) (u[1] == v[1]),
+            (uint32_t) (u[2] == v[2]),
+            (uint32_t) (u[3] == v[3])};
+    }
+
+    __m128i mask = _mm_cmpeq_epi32(simd_load(u), simd_load(v));
+    Vec4<uint32_t> result{};
+    simd_store(result, _mm_srli_epi32(mask, 31));
+    return result;
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Return one where u is less than v, or zero otherwise.
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> Less(
+    const Vec2<int32_t> &u, const Vec2<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {(int32_t) (u[0] < v[0]), (int32_t) (u[1] < v[1])};
+    }
+
+    __m128i a = simd_load(u);
+    __m128i b = simd_load(v);
+    Vec2<int32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(b, a), 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> Less(
+    const Vec2<uint32_t> &u, const Vec2<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {(uint32_t) (u[0] < v[0]), (uint32_t) (u[1] < v[1])};
+    }
+
+    const __m128i sign = _mm_set1_epi32((int32_t) 0x80000000);
+    __m128i a = _mm_xor_si128(simd_load(u), sign);
+    __m128i b = _mm_xor_si128(simd_load(v), sign);
+    Vec2<uint32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(b, a), 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> Less(
+    const Vec3<int32_t> &u, const Vec3<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (int32_t) (u[0] < v[0]),
+            (int32_t) (u[1] < v[1]),
+            (int32_t) (u[2] < v[2])};
+    }
+
+    __m128i a = simd_load(u);
+    __m128i b = simd_load(v);
+    Vec3<int32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(b, a), 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> Less(
+    const Vec3<uint32_t> &u, const Vec3<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (uint32_t) (u[0] < v[0]),
+            (uint32_t) (u[1] < v[1]),
+            (uint32_t) (u[2] < v[2])};
+    }
+
+    const __m128i sign = _mm_set1_epi32((int32_t) 0x80000000);
+    __m128i a = _mm_xor_si128(simd_load(u), sign);
+    __m128i b = _mm_xor_si128(simd_load(v), sign);
+    Vec3<uint32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(b, a), 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> Less(
+    const Vec4<int32_t> &u, const Vec4<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (int32_t) (u[0] < v[0]),
+            (int32_t) (u[1] < v[1]),
+            (int32_t) (u[2] < v[2]),
+            (int32_t) (u[3] < v[3])};
+    }
+
+    __m128i a = simd_load(u);
+    __m128i b = simd_load(v);
+    Vec4<int32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(b, a), 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> Less(
+    const Vec4<uint32_t> &u, const Vec4<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (uint32_t) (u[0] < v[0]),
+            (uint32_t) (u[1] < v[1]),
+            (uint32_t) (u[2] < v[2]),
+            (uint32_t) (u[3] < v[3])};
+    }
+
+    const __m128i sign = _mm_set1_epi32((int32_t) 0x80000000);
+    __m128i a = _mm_xor_si128(simd_load(u), sign);
+    __m128i b = _mm_xor_si128(simd_load(v), sign);
+    Vec4<uint32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(b, a), 31));
+    return result;
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Return one where u is greater than v, or zero otherwise.
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> Greater(
+    const Vec2<int32_t> &u, const Vec2<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {(int32_t) (u[0] > v[0]), (int32_t) (u[1] > v[1])};
+    }
+
+    __m128i a = simd_load(u);
+    __m128i b = simd_load(v);
+    Vec2<int32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(a, b), 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> Greater(
+    const Vec2<uint32_t> &u, const Vec2<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {(uint32_t) (u[0] > v[0]), (uint32_t) (u[1] > v[1])};
+    }
+
+    const __m128i sign = _mm_set1_epi32((int32_t) 0x80000000);
+    __m128i a = _mm_xor_si128(simd_load(u), sign);
+    __m128i b = _mm_xor_si128(simd_load(v), sign);
+    Vec2<uint32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(a, b), 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> Greater(
+    const Vec3<int32_t> &u, const Vec3<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (int32_t) (u[0] > v[0]),
+            (int32_t) (u[1] > v[1]),
+            (int32_t) (u[2] > v[2])};
+    }
+
+    __m128i a = simd_load(u);
+    __m128i b = simd_load(v);
+    Vec3<int32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(a, b), 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> Greater(
+    const Vec3<uint32_t> &u, const Vec3<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (uint32_t) (u[0] > v[0]),
+            (uint32_t) (u[1] > v[1]),
+            (uint32_t) (u[2] > v[2])};
+    }
+
+    const __m128i sign = _mm_set1_epi32((int32_t) 0x80000000);
+    __m128i a = _mm_xor_si128(simd_load(u), sign);
+    __m128i b = _mm_xor_si128(simd_load(v), sign);
+    Vec3<uint32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(a, b), 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> Greater(
+    const Vec4<int32_t> &u, const Vec4<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (int32_t) (u[0] > v[0]),
+            (int32_t) (u[1] > v[1]),
+            (int32_t) (u[2] > v[2]),
+            (int32_t) (u[3] > v[3])};
+    }
+
+    __m128i a = simd_load(u);
+    __m128i b = simd_load(v);
+    Vec4<int32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(a, b), 31));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> Greater(
+    const Vec4<uint32_t> &u, const Vec4<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            (uint32_t) (u[0] > v[0]),
+            (uint32_t) (u[1] > v[1]),
+            (uint32_t) (u[2] > v[2]),
+            (uint32_t) (u[3] > v[3])};
+    }
+
+    const __m128i sign = _mm_set1_epi32((int32_t) 0x80000000);
+    __m128i a = _mm_xor_si128(simd_load(u), sign);
+    __m128i b = _mm_xor_si128(simd_load(v), sign);
+    Vec4<uint32_t> result{};
+    simd_store(result, _mm_srli_epi32(_mm_cmpgt_epi32(a, b), 31));
+    return result;
+}
+
+/// -----------------------------------------------------------------------------
+/// @brief Select the elements of u where the mask is nonzero and the elements
+/// of v elsewhere.
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> Select(
+    const Vec2<int32_t> &mask,
+    const Vec2<int32_t> &u,
+    const Vec2<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {mask[0] ? u[0] : v[0], mask[1] ? u[1] : v[1]};
+    }
+
+    __m128i zero = _mm_cmpeq_epi32(simd_load(mask), _mm_setzero_si128());
+    Vec2<int32_t> result{};
+    simd_store(result, _mm_blendv_epi8(simd_load(u), simd_load(v), zero));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> Select(
+    const Vec2<uint32_t> &mask,
+    const Vec2<uint32_t> &u,
+    const Vec2<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {mask[0] ? u[0] : v[0], mask[1] ? u[1] : v[1]};
+    }
+
+    __m128i zero = _mm_cmpeq_epi32(simd_load(mask), _mm_setzero_si128());
+    Vec2<uint32_t> result{};
+    simd_store(result, _mm_blendv_epi8(simd_load(u), simd_load(v), zero));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> Select(
+    const Vec3<int32_t> &mask,
+    const Vec3<int32_t> &u,
+    const Vec3<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            mask[0] ? u[0] : v[0],
+            mask[1] ? u[1] : v[1],
+            mask[2] ? u[2] : v[2]};
+    }
+
+    __m128i zero = _mm_cmpeq_epi32(simd_load(mask), _mm_setzero_si128());
+    Vec3<int32_t> result{};
+    simd_store(result, _mm_blendv_epi8(simd_load(u), simd_load(v), zero));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> Select(
+    const Vec3<uint32_t> &mask,
+    const Vec3<uint32_t> &u,
+    const Vec3<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            mask[0] ? u[0] : v[0],
+            mask[1] ? u[1] : v[1],
+            mask[2] ? u[2] : v[2]};
+    }
+
+    __m128i zero = _mm_cmpeq_epi32(simd_load(mask), _mm_setzero_si128());
+    Vec3<uint32_t> result{};
+    simd_store(result, _mm_blendv_epi8(simd_load(u), simd_load(v), zero));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> Select(
+    const Vec4<int32_t> &mask,
+    const Vec4<int32_t> &u,
+    const Vec4<int32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            mask[0] ? u[0] : v[0],
+            mask[1] ? u[1] : v[1],
+            mask[2] ? u[2] : v[2],
+            mask[3] ? u[3] : v[3]};
+    }
+
+    __m128i zero = _mm_cmpeq_epi32(simd_load(mask), _mm_setzero_si128());
+    Vec4<int32_t> result{};
+    simd_store(result, _mm_blendv_epi8(simd_load(u), simd_load(v), zero));
+    return result;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> Select(
+    const Vec4<uint32_t> &mask,
+    const Vec4<uint32_t> &u,
+    const Vec4<uint32_t> &v)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return {
+            mask[0] ? u[0] : v[0],
+            mask[1] ? u[1] : v[1],
+            mask[2] ? u[2] : v[2],
+            mask[3] ? u[3] : v[3]};
+    }
+
+    __m128i zero = _mm_cmpeq_epi32(simd_load(mask), _mm_setzero_si128());
+    Vec4<uint32_t> result{};
+    simd_store(result, _mm_blendv_epi8(simd_load(u), simd_load(v), zero));
+    return result;
+}
+
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 #endif // MATH_SIMD_ARITHMETIC_H_
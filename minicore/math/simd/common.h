@@ -18,8 +18,91 @@
 /// or 4 doubles (8-byte).
 ///
 #include <immintrin.h>
+#include "isa.h"
 
 namespace Math {
+inline namespace MATH_SIMD_ISA {
+
+/// ---- Fused multiply-add intrinsics ----------------------------------------
+/// @brief Multiply and add packed elements with a single rounding if the FMA3
+/// instruction set is enabled. Otherwise compute the product and the sum with
+/// separate instructions.
+///
+///  simd_madd_(a, b, c)  = a*b + c
+///  simd_msub_(a, b, c)  = a*b - c
+///  simd_nmadd_(a, b, c) = c - a*b
+///
+inline __m128 simd128_madd_(__m128 a, __m128 b, __m128 c)
+{
+#ifdef MATH_SIMD_FMA
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+inline __m128 simd128_msub_(__m128 a, __m128 b, __m128 c)
+{
+#ifdef MATH_SIMD_FMA
+    return _mm_fmsub_ps(a, b, c);
+#else
+    return _mm_sub_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+inline __m128 simd128_nmadd_(__m128 a, __m128 b, __m128 c)
+{
+#ifdef MATH_SIMD_FMA
+    return _mm_fnmadd_ps(a, b, c);
+#else
+    return _mm_sub_ps(c, _mm_mul_ps(a, b));
+#endif
+}
+
+inline __m128d simd128_madd_(__m128d a, __m128d b, __m128d c)
+{
+#ifdef MATH_SIMD_FMA
+    return _mm_fmadd_pd(a, b, c);
+#else
+    return _mm_add_pd(_mm_mul_pd(a, b), c);
+#endif
+}
+
+inline __m256d simd256_madd_(__m256d a, __m256d b, __m256d c)
+{
+#ifdef MATH_SIMD_FMA
+    return _mm256_fmadd_pd(a, b, c);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+}
+
+inline __m256d simd256_msub_(__m256d a, __m256d b, __m256d c)
+{
+#ifdef MATH_SIMD_FMA
+    return _mm256_fmsub_pd(a, b, c);
+#else
+    return _mm256_sub_pd(_mm256_mul_pd(a, b), c);
+#endif
+}
+
+inline __m256d simd256_nmadd_(__m256d a, __m256d b, __m256d c)
+{
+#ifdef MATH_SIMD_FMA
+    return _mm256_fnmadd_pd(a, b, c);
+#else
+    return _mm256_sub_pd(c, _mm256_mul_pd(a, b));
+#endif
+}
+
+inline __m256 simd256_madd_(__m256 a, __m256 b, __m256 c)
+{
+#ifdef MATH_SIMD_FMA
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
 
 /// ---- Vector insert and extract intrinsics ---------------------------------
 /// @fn _mm256_set_m128d(__m128d hi, __m128d lo)
@@ -853,6 +936,269 @@ inline __m256d simd256_det_(__m256d a)
     return _mm256_hsub_pd(r3, r3);
 }
 
+/// ---- Single-precision vector intrinsics -----------------------------------
+/// @brief Shuffle single-precision (32-bit) floating-point elements using the
+/// control in mask.
+///
+/// @fn _mm_shuffle_ps(__m128 a, __m128 b, unsigned int mask)
+///  dst[31:0]   := SELECT4(a[127:0], mask[1:0])
+///  dst[63:32]  := SELECT4(a[127:0], mask[3:2])
+///  dst[95:64]  := SELECT4(b[127:0], mask[5:4])
+///  dst[127:96] := SELECT4(b[127:0], mask[7:6])
+///
+/// The swizzle and shuffle masks list the selected element of each lane from
+/// the lowest to the highest, {dst0, dst1, dst2, dst3}.
+///
+#define simd128_swizzle_ps(a, x, y, z, w) \
+        _mm_shuffle_ps((a), (a), ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6)))
+
+#define simd128_shuffle_ps(a, b, x, y, z, w) \
+        _mm_shuffle_ps((a), (b), ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6)))
+
+///
+/// @brief Inverse square root of four single-precision (32-bit) elements.
+/// @fn __m128 _mm_rsqrt_ps(__m128 a)
+///  dst[31:0]   :=  APPROXIMATE(1.0 / SQRT(a[31:0]))
+///  dst[63:32]  :=  APPROXIMATE(1.0 / SQRT(a[63:32]))
+///  dst[95:64]  :=  APPROXIMATE(1.0 / SQRT(a[95:64]))
+///  dst[127:96] :=  APPROXIMATE(1.0 / SQRT(a[127:96]))
+///
+inline __m128 simd128_rsqrt_(__m128 x)
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one_half = _mm_set1_ps(1.5f);
+    //
+    // Compute approximate reciprocal square root with 12-bit precision.
+    //
+    __m128 y1 = _mm_rsqrt_ps(x);
+    //
+    // Newton-Raphson optimization of the inverse square root estimate,
+    //      y(k+1) = y(k)*(1.5 - 0.5*x*y(k)*y(k))
+    // A single iteration is enough for single-precision.
+    //
+    __m128 x2  = _mm_mul_ps(half, x);
+    __m128 xy1 = _mm_mul_ps(x2, _mm_mul_ps(y1, y1));
+    __m128 y2  = _mm_mul_ps(y1, _mm_sub_ps(one_half, xy1));
+
+    return y2;
+}
+
+///
+/// @brief Dot product of four single precision (32-bit) elements.
+/// @fn _mm_mul_ps(__m128 a, __m128 b)
+///  dst[i+31:i] := a[i+31:i] * b[i+31:i]
+///
+/// @fn _mm_add_ps(__m128 a, __m128 b)
+///  dst[i+31:i] := a[i+31:i] + b[i+31:i]
+///
+inline __m128 simd128_dot_(__m128 a, __m128 b)
+{
+    //
+    // {a0*b0, a1*b1, a2*b2, a3*b3}
+    //
+    __m128 ymul = _mm_mul_ps(a, b);
+    //
+    // {a0*b0 + a1*b1,
+    //  a0*b0 + a1*b1,
+    //  a2*b2 + a3*b3,
+    //  a2*b2 + a3*b3}
+    //
+    __m128 yadd = _mm_add_ps(ymul, simd128_swizzle_ps(ymul, 1, 0, 3, 2));
+    //
+    // {a0*b0 + a1*b1 + a2*b2 + a3*b3, ...}
+    //
+    __m128 ydot = _mm_add_ps(yadd, simd128_swizzle_ps(yadd, 2, 3, 0, 1));
+
+    return ydot;
+}
+
+///
+/// @brief Euclidean norm of four single-precision (32-bit) elements.
+///
+inline __m128 simd128_norm_(__m128 a)
+{
+    return _mm_sqrt_ps(simd128_dot_(a, a));
+}
+
+///
+/// @brief Normalize four single-precision (32-bit) elements.
+///
+inline __m128 simd128_normalize_(__m128 a)
+{
+    __m128 ydot = simd128_dot_(a, a);
+    __m128 ynorm = simd128_rsqrt_(ydot);
+    return _mm_mul_ps(a, ynorm);
+}
+
+///
+/// @brief Cross product of the lower three single-precision (32-bit) elements.
+/// The upper element of the result is zero.
+///
+///  c = {a1*b2 - a2*b1, a2*b0 - a0*b2, a0*b1 - a1*b0, 0}
+///    = {a0*b1 - a1*b0, a1*b2 - a2*b1, a2*b0 - a0*b2, 0}_yzx
+///
+inline __m128 simd128_cross_(__m128 a, __m128 b)
+{
+    //
+    // a_yzx = {a1, a2, a0, a3}
+    // b_yzx = {b1, b2, b0, b3}
+    //
+    __m128 a_yzx = simd128_swizzle_ps(a, 1, 2, 0, 3);
+    __m128 b_yzx = simd128_swizzle_ps(b, 1, 2, 0, 3);
+    //
+    // c = {a0*b1 - a1*b0, a1*b2 - a2*b1, a2*b0 - a0*b2, 0}
+    //
+    __m128 c = simd128_msub_(a, b_yzx, _mm_mul_ps(a_yzx, b));
+    return simd128_swizzle_ps(c, 1, 2, 0, 3);
+}
+
+///
+/// @brief Return the transpose of a 4x4 matrix represented as 4 vector-rows of
+/// dimension 4.
+///
+/// @fn _mm_unpacklo_ps(__m128 a, __m128 b)
+///  dst = {a0, b0, a1, b1}
+/// @fn _mm_unpackhi_ps(__m128 a, __m128 b)
+///  dst = {a2, b2, a3, b3}
+/// @fn _mm_movelh_ps(__m128 a, __m128 b)
+///  dst = {a0, a1, b0, b1}
+/// @fn _mm_movehl_ps(__m128 a, __m128 b)
+///  dst = {b2, b3, a2, a3}
+///
+/// @par Operation:
+/// row0 = { a0,  a1,  a2,  a3} -> {a0, a4, a8,  a12}
+/// row1 = { a4,  a5,  a6,  a7} -> {a1, a5, a9,  a13}
+/// row2 = { a8,  a9, a10, a11} -> {a2, a6, a10, a14}
+/// row3 = {a12, a13, a14, a15} -> {a3, a7, a11, a15}
+///
+inline void simd128_transpose_(__m128 (&row)[4])
+{
+    //
+    // t0 = {a0,  a4,  a1,  a5}
+    // t1 = {a8,  a12, a9,  a13}
+    // t2 = {a2,  a6,  a3,  a7}
+    // t3 = {a10, a14, a11, a15}
+    //
+    __m128 t0 = _mm_unpacklo_ps(row[0], row[1]);
+    __m128 t1 = _mm_unpacklo_ps(row[2], row[3]);
+    __m128 t2 = _mm_unpackhi_ps(row[0], row[1]);
+    __m128 t3 = _mm_unpackhi_ps(row[2], row[3]);
+
+    row[0] = _mm_movelh_ps(t0, t1);
+    row[1] = _mm_movehl_ps(t1, t0);
+    row[2] = _mm_movelh_ps(t2, t3);
+    row[3] = _mm_movehl_ps(t3, t2);
+}
+
+///
+/// @brief Multiply two 2x2 matrices, each packed in a single register as
+/// {a0, a1, a2, a3}.
+///
+///  c = {a0*b0 + a1*b2, a0*b1 + a1*b3, a2*b0 + a3*b2, a2*b1 + a3*b3}
+///
+inline __m128 simd128_mat2mul_(__m128 a, __m128 b)
+{
+    return simd128_madd_(
+        a, simd128_swizzle_ps(b, 0, 3, 0, 3),
+        _mm_mul_ps(simd128_swizzle_ps(a, 1, 0, 3, 2),
+                   simd128_swizzle_ps(b, 2, 1, 2, 1)));
+}
+
+///
+/// @brief Multiply the adjugate of a 2x2 matrix by a 2x2 matrix, adj(a)*b.
+///
+///  adj(a) = {a3, -a1, -a2, a0}
+///
+inline __m128 simd128_mat2adjmul_(__m128 a, __m128 b)
+{
+    return simd128_msub_(
+        simd128_swizzle_ps(a, 3, 3, 0, 0), b,
+        _mm_mul_ps(simd128_swizzle_ps(a, 1, 1, 2, 2),
+                   simd128_swizzle_ps(b, 2, 3, 0, 1)));
+}
+
+///
+/// @brief Multiply a 2x2 matrix by the adjugate of a 2x2 matrix, a*adj(b).
+///
+inline __m128 simd128_mat2muladj_(__m128 a, __m128 b)
+{
+    return simd128_msub_(
+        a, simd128_swizzle_ps(b, 3, 0, 3, 0),
+        _mm_mul_ps(simd128_swizzle_ps(a, 1, 0, 3, 2),
+                   simd128_swizzle_ps(b, 2, 1, 2, 1)));
+}
+
+///
+/// @brief Return the determinant of a 2x2 matrix packed as {a0, a1, a2, a3} in
+/// all elements of the result.
+///
+inline __m128 simd128_det_(__m128 a)
+{
+    //
+    // r0 = {a0*a3, a1*a2, a2*a1, a3*a0}
+    // det = {a0*a3 - a1*a2, ...}
+    //
+    __m128 r0 = _mm_mul_ps(a, simd128_swizzle_ps(a, 3, 2, 1, 0));
+    return _mm_sub_ps(
+        simd128_swizzle_ps(r0, 0, 0, 0, 0),
+        simd128_swizzle_ps(r0, 1, 1, 1, 1));
+}
+
+///
+/// @brief Return the determinant of a 4x4 matrix represented as 4 vector-rows
+/// of dimension 4, using its 2x2 block decomposition,
+///
+///  M = {A, B,
+///       C, D}
+///
+///  det(M) = det(A)*det(D) + det(B)*det(C) - tr(adj(A)*B*adj(D)*C)
+///
+/// The 2x2 blocks and their determinants are returned for reuse by the
+/// inverse. The determinant is set in all elements of the result.
+///
+inline __m128 simd128_det4_(
+    const __m128 (&row)[4],
+    __m128 (&block)[4],
+    __m128 (&det)[4],
+    __m128 &a_b,
+    __m128 &d_c)
+{
+    //
+    // A = {a0, a1, a4, a5}     B = {a2,  a3,  a6,  a7}
+    // C = {a8, a9, a12, a13}   D = {a10, a11, a14, a15}
+    //
+    block[0] = _mm_movelh_ps(row[0], row[1]);
+    block[1] = _mm_movehl_ps(row[1], row[0]);
+    block[2] = _mm_movelh_ps(row[2], row[3]);
+    block[3] = _mm_movehl_ps(row[3], row[2]);
+    //
+    // {det(A), det(B), det(C), det(D)}
+    //
+    __m128 dets = simd128_msub_(
+        simd128_shuffle_ps(row[0], row[2], 0, 2, 0, 2),
+        simd128_shuffle_ps(row[1], row[3], 1, 3, 1, 3),
+        _mm_mul_ps(simd128_shuffle_ps(row[0], row[2], 1, 3, 1, 3),
+                   simd128_shuffle_ps(row[1], row[3], 0, 2, 0, 2)));
+    det[0] = simd128_swizzle_ps(dets, 0, 0, 0, 0);
+    det[1] = simd128_swizzle_ps(dets, 1, 1, 1, 1);
+    det[2] = simd128_swizzle_ps(dets, 2, 2, 2, 2);
+    det[3] = simd128_swizzle_ps(dets, 3, 3, 3, 3);
+    //
+    // adj(A)*B and adj(D)*C
+    //
+    a_b = simd128_mat2adjmul_(block[0], block[1]);
+    d_c = simd128_mat2adjmul_(block[3], block[2]);
+    //
+    // tr(adj(A)*B*adj(D)*C)
+    //
+    __m128 tr = _mm_mul_ps(a_b, simd128_swizzle_ps(d_c, 0, 2, 1, 3));
+    tr = _mm_hadd_ps(tr, tr);
+    tr = _mm_hadd_ps(tr, tr);
+
+    return simd128_madd_(det[0], det[3], simd128_msub_(det[1], det[2], tr));
+}
+
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 #endif  // MATH_SIMD_COMMON_H_
@@ -0,0 +1,838 @@
+//
+// fastmath.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_SIMD_FASTMATH_H_
+#define MATH_SIMD_FASTMATH_H_
+
+#include <limits>
+#include "common.h"
+
+namespace Math {
+inline namespace MATH_SIMD_ISA {
+
+/// ---- Fast math constants --------------------------------------------------
+/// @brief Special values of the fast math functions. They are constant
+/// evaluated, so that no std::numeric_limits function is called at runtime.
+///
+static constexpr double kSimdInfd = std::numeric_limits<double>::infinity();
+static constexpr float kSimdInff = std::numeric_limits<float>::infinity();
+static constexpr double kSimdMinNormald = std::numeric_limits<double>::min();
+static constexpr float kSimdMinNormalf = std::numeric_limits<float>::min();
+static constexpr double kSimdNaNd = std::numeric_limits<double>::quiet_NaN();
+static constexpr float kSimdNaNf = std::numeric_limits<float>::quiet_NaN();
+
+/// ---- Fast math helper intrinsics ------------------------------------------
+/// @brief Evaluate the polynomial c[0] + c[1]*x + ... + c[n-1]*x^(n-1) with
+/// Horner's scheme.
+///
+template<size_t n>
+inline __m256d simd256_poly_(__m256d x, const double (&c)[n])
+{
+    __m256d p = _mm256_set1_pd(c[n - 1]);
+    for (size_t i = n - 1; i > 0; --i) {
+        p = simd256_madd_(p, x, _mm256_set1_pd(c[i - 1]));
+    }
+    return p;
+}
+
+template<size_t n>
+inline __m256 simd256_poly_(__m256 x, const float (&c)[n])
+{
+    __m256 p = _mm256_set1_ps(c[n - 1]);
+    for (size_t i = n - 1; i > 0; --i) {
+        p = simd256_madd_(p, x, _mm256_set1_ps(c[i - 1]));
+    }
+    return p;
+}
+
+///
+/// @brief Select the lanes of a where the mask is set and the lanes of b
+/// elsewhere. The masks are the results of comparisons, all bits set or
+/// clear in each lane.
+///
+inline __m256d simd256_select_(__m256d mask, __m256d a, __m256d b)
+{
+    return _mm256_or_pd(_mm256_and_pd(mask, a), _mm256_andnot_pd(mask, b));
+}
+
+inline __m256 simd256_select_(__m256 mask, __m256 a, __m256 b)
+{
+    return _mm256_or_ps(_mm256_and_ps(mask, a), _mm256_andnot_ps(mask, b));
+}
+
+///
+/// @brief Return 2^n of the integral elements of n, within the range of the
+/// normal numbers. The exponent bits are built in two 128-bit halves, as AVX
+/// has no 256-bit integer instructions.
+///
+inline __m256d simd256_pow2n_(__m256d n)
+{
+    __m128i k = _mm_add_epi32(_mm256_cvtpd_epi32(n), _mm_set1_epi32(1023));
+    __m128i lo = _mm_slli_epi64(_mm_cvtepi32_epi64(k), 52);
+    __m128i hi = _mm_slli_epi64(_mm_cvtepi32_epi64(_mm_srli_si128(k, 8)), 52);
+    return _mm256_castsi256_pd(
+        _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+}
+
+inline __m256 simd256_pow2n_(__m256 n)
+{
+    const __m128i bias = _mm_set1_epi32(127);
+    __m256i k = _mm256_cvtps_epi32(n);
+    __m128i lo = _mm_slli_epi32(
+        _mm_add_epi32(_mm256_castsi256_si128(k), bias), 23);
+    __m128i hi = _mm_slli_epi32(
+        _mm_add_epi32(_mm256_extractf128_si256(k, 1), bias), 23);
+    return _mm256_castsi256_ps(
+        _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+}
+
+///
+/// @brief Return the unbiased exponents of the normal elements of x.
+///
+inline __m256d simd256_exponent_(__m256d x)
+{
+    __m256i bits = _mm256_castpd_si256(x);
+    __m128i lo = _mm_srli_epi64(_mm256_castsi256_si128(bits), 52);
+    __m128i hi = _mm_srli_epi64(_mm256_extractf128_si256(bits, 1), 52);
+    // Pack the low 32 bits of each 64-bit exponent into 4 integers.
+    __m128i k = _mm_unpacklo_epi64(
+        _mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 1, 2, 0)),
+        _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 1, 2, 0)));
+    k = _mm_sub_epi32(k, _mm_set1_epi32(1023));
+    return _mm256_cvtepi32_pd(k);
+}
+
+inline __m256 simd256_exponent_(__m256 x)
+{
+    const __m128i bias = _mm_set1_epi32(127);
+    __m256i bits = _mm256_castps_si256(x);
+    __m128i lo = _mm_sub_epi32(
+        _mm_srli_epi32(_mm256_castsi256_si128(bits), 23), bias);
+    __m128i hi = _mm_sub_epi32(
+        _mm_srli_epi32(_mm256_extractf128_si256(bits, 1), 23), bias);
+    return _mm256_cvtepi32_ps(
+        _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+}
+
+///
+/// @brief Return x - 2*floor(x/2), the parity of the integral elements of x,
+/// which is 0 or 1 for both positive and negative elements.
+///
+inline __m256d simd256_parity_(__m256d x)
+{
+    __m256d half = _mm256_floor_pd(_mm256_mul_pd(x, _mm256_set1_pd(0.5)));
+    return _mm256_sub_pd(x, _mm256_add_pd(half, half));
+}
+
+inline __m256 simd256_parity_(__m256 x)
+{
+    __m256 half = _mm256_floor_ps(_mm256_mul_ps(x, _mm256_set1_ps(0.5f)));
+    return _mm256_sub_ps(x, _mm256_add_ps(half, half));
+}
+
+/// ---- Inverse square root intrinsics ---------------------------------------
+/// @brief Inverse square root. The precise version divides by the square root.
+/// The fast version refines the single precision estimate of _mm256_rsqrt_ps
+/// with Newton-Raphson iterations, y(k+1) = y(k)*(1.5 - 0.5*x*y(k)*y(k)), two
+/// in double precision and one in single precision. The fast version requires
+/// positive normal elements.
+///
+inline __m256d simd256_rsqrt_(__m256d x, const bool fast)
+{
+    if (!fast) {
+        return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(x));
+    }
+
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d one_half = _mm256_set1_pd(1.5);
+    __m256d x2 = _mm256_mul_pd(half, x);
+    __m256d y = _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(x)));
+    y = _mm256_mul_pd(y,
+        simd256_nmadd_(x2, _mm256_mul_pd(y, y), one_half));
+    y = _mm256_mul_pd(y,
+        simd256_nmadd_(x2, _mm256_mul_pd(y, y), one_half));
+    return y;
+}
+
+inline __m256 simd256_rsqrt_(__m256 x, const bool fast)
+{
+    if (!fast) {
+        return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(x));
+    }
+
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 one_half = _mm256_set1_ps(1.5f);
+    __m256 x2 = _mm256_mul_ps(half, x);
+    __m256 y = _mm256_rsqrt_ps(x);
+    __m256 xyy = _mm256_mul_ps(x2, _mm256_mul_ps(y, y));
+    return _mm256_mul_ps(y, _mm256_sub_ps(one_half, xyy));
+}
+
+/// ---- Exponential intrinsics -----------------------------------------------
+/// @brief Exponential function. The argument is reduced to x = n*ln2 + r, with
+/// |r| <= ln2/2 and ln2 split in a high and a low part, so that n*ln2_hi is
+/// exact, and exp(x) = 2^n * exp(r). The scale 2^n is applied in two factors
+/// that are normal numbers over the whole range, including the subnormal
+/// results. Results overflow to +inf and underflow to zero outside the range.
+///
+///  double precise:    Taylor polynomial of degree 13.
+///  double fast:       polynomial of degree 7, as the single precision one.
+///  float precise:     polynomial of degree 7 (Cephes expf).
+///  float fast:        polynomial of degree 4.
+///
+/// The precise polynomials are evaluated with Horner's scheme with FMA, and
+/// as 1 + r + r^2*p(r) without it, adding the leading terms last, so that
+/// they stay within 1 ulp.
+///
+inline __m256d simd256_exp_(__m256d x, const bool fast)
+{
+    static const double kPrecise[12] = {
+        1.0 / 2.0,
+        1.0 / 6.0,
+        1.0 / 24.0,
+        1.0 / 120.0,
+        1.0 / 720.0,
+        1.0 / 5040.0,
+        1.0 / 40320.0,
+        1.0 / 362880.0,
+        1.0 / 3628800.0,
+        1.0 / 39916800.0,
+        1.0 / 479001600.0,
+        1.0 / 6227020800.0};
+    static const double kFast[8] = {
+        1.0,
+        1.0,
+        5.0000001201E-1,
+        1.6666665459E-1,
+        4.1665795894E-2,
+        8.3334519073E-3,
+        1.3981999507E-3,
+        1.9875691500E-4};
+    const __m256d max_x = _mm256_set1_pd(709.782712893384);
+    const __m256d min_x = _mm256_set1_pd(-745.1332191019412);
+    const __m256d log2e = _mm256_set1_pd(1.4426950408889634);
+    const __m256d ln2_hi = _mm256_set1_pd(6.93145751953125E-1);
+    const __m256d ln2_lo = _mm256_set1_pd(1.42860682030941723212E-6);
+
+    __m256d nan = _mm256_cmp_pd(x, x, _CMP_UNORD_Q);
+    __m256d over = _mm256_cmp_pd(x, max_x, _CMP_GT_OQ);
+    __m256d under = _mm256_cmp_pd(x, min_x, _CMP_LT_OQ);
+    __m256d t = _mm256_min_pd(_mm256_max_pd(x, min_x), max_x);
+
+    __m256d n = _mm256_round_pd(_mm256_mul_pd(t, log2e),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = simd256_nmadd_(n, ln2_hi, t);
+    r = simd256_nmadd_(n, ln2_lo, r);
+
+    __m256d p;
+    if (fast) {
+        p = simd256_poly_(r, kFast);
+    } else {
+        p = simd256_poly_(r, kPrecise);
+#ifdef MATH_SIMD_FMA
+        p = simd256_madd_(p, r, _mm256_set1_pd(1.0));
+        p = simd256_madd_(p, r, _mm256_set1_pd(1.0));
+#else
+        p = simd256_madd_(p, _mm256_mul_pd(r, r), r);
+        p = _mm256_add_pd(p, _mm256_set1_pd(1.0));
+#endif
+    }
+
+    __m256d n1 = _mm256_floor_pd(_mm256_mul_pd(n, _mm256_set1_pd(0.5)));
+    __m256d n2 = _mm256_sub_pd(n, n1);
+    p = _mm256_mul_pd(p, simd256_pow2n_(n1));
+    p = _mm256_mul_pd(p, simd256_pow2n_(n2));
+
+    const __m256d inf = _mm256_set1_pd(kSimdInfd);
+    p = simd256_select_(over, inf, p);
+    p = simd256_select_(under, _mm256_setzero_pd(), p);
+    return simd256_select_(nan, x, p);
+}
+
+inline __m256 simd256_exp_(__m256 x, const bool fast)
+{
+    static const float kPrecise[6] = {
+        5.0000001201E-1f,
+        1.6666665459E-1f,
+        4.1665795894E-2f,
+        8.3334519073E-3f,
+        1.3981999507E-3f,
+        1.9875691500E-4f};
+    static const float kFast[5] = {
+        1.0f,
+        9.999622946507593E-1f,
+        4.999937213862534E-1f,
+        1.67921430165221E-1f,
+        4.1875644452357016E-2f};
+    const __m256 max_x = _mm256_set1_ps(88.72283f);
+    const __m256 min_x = _mm256_set1_ps(-103.97208f);
+    const __m256 log2e = _mm256_set1_ps(1.44269504088896341f);
+    const __m256 ln2_hi = _mm256_set1_ps(0.693359375f);
+    const __m256 ln2_lo = _mm256_set1_ps(-2.12194440E-4f);
+
+    __m256 nan = _mm256_cmp_ps(x, x, _CMP_UNORD_Q);
+    __m256 over = _mm256_cmp_ps(x, max_x, _CMP_GT_OQ);
+    __m256 under = _mm256_cmp_ps(x, min_x, _CMP_LT_OQ);
+    __m256 t = _mm256_min_ps(_mm256_max_ps(x, min_x), max_x);
+
+    __m256 n = _mm256_round_ps(_mm256_mul_ps(t, log2e),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_sub_ps(t, _mm256_mul_ps(n, ln2_hi));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(n, ln2_lo));
+
+    __m256 p;
+    if (fast) {
+        p = simd256_poly_(r, kFast);
+    } else {
+        p = simd256_poly_(r, kPrecise);
+#ifdef MATH_SIMD_FMA
+        p = simd256_madd_(p, r, _mm256_set1_ps(1.0f));
+        p = simd256_madd_(p, r, _mm256_set1_ps(1.0f));
+#else
+        p = simd256_madd_(p, _mm256_mul_ps(r, r), r);
+        p = _mm256_add_ps(p, _mm256_set1_ps(1.0f));
+#endif
+    }
+
+    __m256 n1 = _mm256_floor_ps(_mm256_mul_ps(n, _mm256_set1_ps(0.5f)));
+    __m256 n2 = _mm256_sub_ps(n, n1);
+    p = _mm256_mul_ps(p, simd256_pow2n_(n1));
+    p = _mm256_mul_ps(p, simd256_pow2n_(n2));
+
+    const __m256 inf = _mm256_set1_ps(kSimdInff);
+    p = simd256_select_(over, inf, p);
+    p = simd256_select_(under, _mm256_setzero_ps(), p);
+    return simd256_select_(nan, x, p);
+}
+
+/// ---- Logarithm intrinsics -------------------------------------------------
+/// @brief Natural logarithm. The argument is split into x = 2^e * m, with the
+/// mantissa m in [sqrt(1/2), sqrt(2)), and log(x) = e*ln2 + log(1 + f), with
+/// f = m - 1. Subnormal arguments are scaled into the normal range first.
+/// log(0) = -inf, log(+inf) = +inf and negative arguments return NaN.
+///
+///  double precise:    log(1 + f) = 2*atanh(f/(2 + f)) as a polynomial of
+///                     degree 14 (fdlibm log).
+///  double fast:       polynomial of degree 10 in f, as the single precision
+///                     one.
+///  float precise:     polynomial of degree 10 in f (Cephes logf).
+///  float fast:        polynomial of degree 5 in f.
+///
+inline __m256d simd256_log_(__m256d x, const bool fast)
+{
+    static const double kPrecise[7] = {
+        6.666666666666735130e-01,
+        3.999999999940941908e-01,
+        2.857142874366239149e-01,
+        2.222219843214978396e-01,
+        1.818357216161805012e-01,
+        1.531383769920937332e-01,
+        1.479819860511658591e-01};
+    static const double kFast[9] = {
+        3.3333331174E-1,
+        -2.4999993993E-1,
+        2.0000714765E-1,
+        -1.6668057665E-1,
+        1.4249322787E-1,
+        -1.2420140846E-1,
+        1.1676998740E-1,
+        -1.1514610310E-1,
+        7.0376836292E-2};
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d ln2_hi = _mm256_set1_pd(6.93147180369123816490e-01);
+    const __m256d ln2_lo = _mm256_set1_pd(1.90821492927058770002e-10);
+    const __m256d min_normal = _mm256_set1_pd(kSimdMinNormald);
+    const __m256d inf = _mm256_set1_pd(kSimdInfd);
+
+    // Scale the subnormal arguments by 2^54.
+    __m256d subnormal = _mm256_cmp_pd(x, min_normal, _CMP_LT_OQ);
+    __m256d t = simd256_select_(subnormal,
+        _mm256_mul_pd(x, _mm256_set1_pd(18014398509481984.0)), x);
+    __m256d e = _mm256_sub_pd(simd256_exponent_(t),
+        _mm256_and_pd(subnormal, _mm256_set1_pd(54.0)));
+
+    // Mantissa in [1, 2), halved if it is greater than sqrt(2).
+    const __m256d mantissa_mask = _mm256_castsi256_pd(
+        _mm256_set1_epi64x(0x000fffffffffffffLL));
+    __m256d m = _mm256_or_pd(_mm256_and_pd(t, mantissa_mask), one);
+    __m256d big = _mm256_cmp_pd(m, _mm256_set1_pd(1.4142135623730951),
+        _CMP_GT_OQ);
+    m = simd256_select_(big, _mm256_mul_pd(m, half), m);
+    e = _mm256_add_pd(e, _mm256_and_pd(big, one));
+    __m256d f = _mm256_sub_pd(m, one);
+
+    __m256d y;
+    if (fast) {
+        __m256d z = _mm256_mul_pd(f, f);
+        y = _mm256_mul_pd(_mm256_mul_pd(f, z), simd256_poly_(f, kFast));
+        y = simd256_nmadd_(half, z, y);
+        y = _mm256_add_pd(f, y);
+        y = simd256_madd_(e, _mm256_set1_pd(0.6931471805599453), y);
+    } else {
+        __m256d s = _mm256_div_pd(f, _mm256_add_pd(f, _mm256_set1_pd(2.0)));
+        __m256d z = _mm256_mul_pd(s, s);
+        __m256d r = _mm256_mul_pd(z, simd256_poly_(z, kPrecise));
+        __m256d hfsq = _mm256_mul_pd(half, _mm256_mul_pd(f, f));
+        // log(x) = e*ln2_hi - ((hfsq - (s*(hfsq + r) + e*ln2_lo)) - f)
+        __m256d a = simd256_madd_(s, _mm256_add_pd(hfsq, r),
+            _mm256_mul_pd(e, ln2_lo));
+        a = _mm256_sub_pd(_mm256_sub_pd(hfsq, a), f);
+        y = simd256_msub_(e, ln2_hi, a);
+    }
+
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d nan = _mm256_set1_pd(kSimdNaNd);
+    y = simd256_select_(_mm256_cmp_pd(x, inf, _CMP_EQ_OQ), inf, y);
+    y = simd256_select_(_mm256_cmp_pd(x, zero, _CMP_EQ_OQ),
+        _mm256_sub_pd(zero, inf), y);
+    y = simd256_select_(_mm256_cmp_pd(x, zero, _CMP_LT_OQ), nan, y);
+    return simd256_select_(_mm256_cmp_pd(x, x, _CMP_UNORD_Q), x, y);
+}
+
+inline __m256 simd256_log_(__m256 x, const bool fast)
+{
+    static const float kPrecise[9] = {
+        3.3333331174E-1f,
+        -2.4999993993E-1f,
+        2.0000714765E-1f,
+        -1.6668057665E-1f,
+        1.4249322787E-1f,
+        -1.2420140846E-1f,
+        1.1676998740E-1f,
+        -1.1514610310E-1f,
+        7.0376836292E-2f};
+    static const float kFast[4] = {
+        -4.9977621110117887E-1f,
+        3.352615257111849E-1f,
+        -2.6693454031357466E-1f,
+        1.784898835046368E-1f};
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 min_normal = _mm256_set1_ps(kSimdMinNormalf);
+    const __m256 inf = _mm256_set1_ps(kSimdInff);
+
+    // Scale the subnormal arguments by 2^25.
+    __m256 subnormal = _mm256_cmp_ps(x, min_normal, _CMP_LT_OQ);
+    __m256 t = simd256_select_(subnormal,
+        _mm256_mul_ps(x, _mm256_set1_ps(33554432.0f)), x);
+    __m256 e = _mm256_sub_ps(simd256_exponent_(t),
+        _mm256_and_ps(subnormal, _mm256_set1_ps(25.0f)));
+
+    // Mantissa in [1, 2), halved if it is greater than sqrt(2).
+    const __m256 mantissa_mask = _mm256_castsi256_ps(
+        _mm256_set1_epi32(0x007fffff));
+    __m256 m = _mm256_or_ps(_mm256_and_ps(t, mantissa_mask), one);
+    __m256 big = _mm256_cmp_ps(m, _mm256_set1_ps(1.41421356f), _CMP_GT_OQ);
+    m = simd256_select_(big, _mm256_mul_ps(m, half), m);
+    e = _mm256_add_ps(e, _mm256_and_ps(big, one));
+    __m256 f = _mm256_sub_ps(m, one);
+    __m256 z = _mm256_mul_ps(f, f);
+
+    __m256 y;
+    if (fast) {
+        y = simd256_madd_(z, simd256_poly_(f, kFast), f);
+        y = simd256_madd_(e, _mm256_set1_ps(0.693147180559945f), y);
+    } else {
+        y = _mm256_mul_ps(_mm256_mul_ps(f, z), simd256_poly_(f, kPrecise));
+        y = simd256_madd_(e, _mm256_set1_ps(-2.12194440E-4f), y);
+        y = _mm256_sub_ps(y, _mm256_mul_ps(half, z));
+        y = _mm256_add_ps(f, y);
+        y = simd256_madd_(e, _mm256_set1_ps(0.693359375f), y);
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 nan = _mm256_set1_ps(kSimdNaNf);
+    y = simd256_select_(_mm256_cmp_ps(x, inf, _CMP_EQ_OQ), inf, y);
+    y = simd256_select_(_mm256_cmp_ps(x, zero, _CMP_EQ_OQ),
+        _mm256_sub_ps(zero, inf), y);
+    y = simd256_select_(_mm256_cmp_ps(x, zero, _CMP_LT_OQ), nan, y);
+    return simd256_select_(_mm256_cmp_ps(x, x, _CMP_UNORD_Q), x, y);
+}
+
+/// ---- Sine and cosine intrinsics -------------------------------------------
+/// @brief Sine and cosine. The argument is reduced to x = j*pi/2 + r, with
+/// |r| <= pi/4 and pi/2 split in three parts (Cody-Waite), and the quadrant
+/// j mod 4 selects and negates sin(r) and cos(r). The precise single
+/// precision reduction is computed in double precision with pi/2 in two
+/// parts, so that it does not depend on FMA contraction near the zeros:
+///
+///  j mod 4    0       1       2       3
+///  sin(x)     sin(r)  cos(r)  -sin(r) -cos(r)
+///  cos(x)     cos(r)  -sin(r) -cos(r) sin(r)
+///
+/// The reduction is accurate for |x| < 2^20, and for |x| < 2^13 in fast
+/// single precision, and loses accuracy for larger arguments.
+///
+///  double precise:    polynomials of degree 13 and 14 (Cephes sin/cos).
+///  double fast:       polynomials of degree 7 and 8, as single precision.
+///  float precise:     polynomials of degree 7 and 8 (Cephes sinf/cosf).
+///  float fast:        polynomials of degree 5 and 4.
+///
+inline void simd256_sincos_(
+    __m256d x, __m256d &sin, __m256d &cos, const bool fast)
+{
+    static const double kSinPrecise[6] = {
+        -1.66666666666666307295E-1,
+        8.33333333332211858878E-3,
+        -1.98412698295895385996E-4,
+        2.75573136213857245213E-6,
+        -2.50507477628578072866E-8,
+        1.58962301576546568060E-10};
+    static const double kCosPrecise[6] = {
+        4.16666666666665929218E-2,
+        -1.38888888888730564116E-3,
+        2.48015872888517045348E-5,
+        -2.75573141792967388112E-7,
+        2.08757008419747316778E-9,
+        -1.13585365213876817300E-11};
+    static const double kSinFast[3] = {
+        -1.6666654611E-1,
+        8.3321608736E-3,
+        -1.9515295891E-4};
+    static const double kCosFast[3] = {
+        4.166664568298827E-2,
+        -1.388731625493765E-3,
+        2.443315711809948E-5};
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d sign = _mm256_set1_pd(-0.0);
+
+    __m256d j = _mm256_round_pd(
+        _mm256_mul_pd(x, _mm256_set1_pd(0.63661977236758134)),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = simd256_nmadd_(j, _mm256_set1_pd(1.57079625129699707031), x);
+    r = simd256_nmadd_(j, _mm256_set1_pd(7.54978941586159635335E-8), r);
+    r = simd256_nmadd_(j, _mm256_set1_pd(5.39030285815811905290E-15), r);
+    __m256d z = _mm256_mul_pd(r, r);
+
+    // sin(r) = r + r*z*P(z), cos(r) = 1 - z/2 + z*z*Q(z)
+    __m256d ps = fast ? simd256_poly_(z, kSinFast)
+                      : simd256_poly_(z, kSinPrecise);
+    __m256d pc = fast ? simd256_poly_(z, kCosFast)
+                      : simd256_poly_(z, kCosPrecise);
+    ps = simd256_madd_(_mm256_mul_pd(r, z), ps, r);
+    pc = simd256_madd_(_mm256_mul_pd(z, z), pc, simd256_nmadd_(half, z, one));
+
+    // Swap in the odd quadrants, negate sin in quadrants 2 and 3 and cos in
+    // quadrants 1 and 2.
+    __m256d swap = _mm256_cmp_pd(simd256_parity_(j), one, _CMP_EQ_OQ);
+    __m256d sin_neg = _mm256_cmp_pd(simd256_parity_(
+        _mm256_floor_pd(_mm256_mul_pd(j, half))), one, _CMP_EQ_OQ);
+    __m256d cos_neg = _mm256_cmp_pd(simd256_parity_(
+        _mm256_floor_pd(_mm256_mul_pd(_mm256_add_pd(j, one), half))), one,
+        _CMP_EQ_OQ);
+
+    sin = _mm256_xor_pd(simd256_select_(swap, pc, ps),
+        _mm256_and_pd(sin_neg, sign));
+    cos = _mm256_xor_pd(simd256_select_(swap, ps, pc),
+        _mm256_and_pd(cos_neg, sign));
+}
+
+inline void simd256_sincos_(
+    __m256 x, __m256 &sin, __m256 &cos, const bool fast)
+{
+    static const float kSinPrecise[3] = {
+        -1.6666654611E-1f,
+        8.3321608736E-3f,
+        -1.9515295891E-4f};
+    static const float kCosPrecise[3] = {
+        4.166664568298827E-2f,
+        -1.388731625493765E-3f,
+        2.443315711809948E-5f};
+    static const float kSinFast[2] = {
+        -1.6665731001278414E-1f,
+        8.21185550730892E-3f};
+    static const float kCosFast[2] = {
+        -4.9993466354631566E-1f,
+        4.081813932685637E-2f};
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+
+    __m256 j = _mm256_round_ps(
+        _mm256_mul_ps(x, _mm256_set1_ps(0.636619772f)),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r;
+    if (fast) {
+        r = _mm256_sub_ps(x, _mm256_mul_ps(j, _mm256_set1_ps(1.5703125f)));
+        r = _mm256_sub_ps(r, _mm256_mul_ps(j,
+            _mm256_set1_ps(4.837512969970703125E-4f)));
+        r = _mm256_sub_ps(r, _mm256_mul_ps(j,
+            _mm256_set1_ps(7.54978995489188216E-8f)));
+    } else {
+        // Reduce each half in double precision, j*pio2_hi is exact.
+        const __m256d pio2_hi = _mm256_set1_pd(1.57079632673412561417E+0);
+        const __m256d pio2_lo = _mm256_set1_pd(6.07710050650619224932E-11);
+        auto reduce = [&] (__m128 x4, __m128 j4) {
+            __m256d xd = _mm256_cvtps_pd(x4);
+            __m256d jd = _mm256_cvtps_pd(j4);
+            xd = _mm256_sub_pd(xd, _mm256_mul_pd(jd, pio2_hi));
+            xd = _mm256_sub_pd(xd, _mm256_mul_pd(jd, pio2_lo));
+            return _mm256_cvtpd_ps(xd);
+        };
+        r = _mm256_castps128_ps256(reduce(
+            _mm256_castps256_ps128(x), _mm256_castps256_ps128(j)));
+        r = _mm256_insertf128_ps(r, reduce(
+            _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(j, 1)), 1);
+    }
+    __m256 z = _mm256_mul_ps(r, r);
+
+    __m256 ps;
+    __m256 pc;
+    if (fast) {
+        // sin(r) = r + r*z*P(z), cos(r) = 1 + z*Q(z)
+        ps = simd256_madd_(_mm256_mul_ps(r, z), simd256_poly_(z, kSinFast), r);
+        pc = simd256_madd_(z, simd256_poly_(z, kCosFast), one);
+    } else {
+        // sin(r) = r + r*z*P(z), cos(r) = 1 - z/2 + z*z*Q(z)
+        ps = simd256_madd_(
+            _mm256_mul_ps(r, z), simd256_poly_(z, kSinPrecise), r);
+        pc = simd256_madd_(_mm256_mul_ps(z, z), simd256_poly_(z, kCosPrecise),
+            _mm256_sub_ps(one, _mm256_mul_ps(half, z)));
+    }
+
+    __m256 swap = _mm256_cmp_ps(simd256_parity_(j), one, _CMP_EQ_OQ);
+    __m256 sin_neg = _mm256_cmp_ps(simd256_parity_(
+        _mm256_floor_ps(_mm256_mul_ps(j, half))), one, _CMP_EQ_OQ);
+    __m256 cos_neg = _mm256_cmp_ps(simd256_parity_(
+        _mm256_floor_ps(_mm256_mul_ps(_mm256_add_ps(j, one), half))), one,
+        _CMP_EQ_OQ);
+
+    sin = _mm256_xor_ps(simd256_select_(swap, pc, ps),
+        _mm256_and_ps(sin_neg, sign));
+    cos = _mm256_xor_ps(simd256_select_(swap, ps, pc),
+        _mm256_and_ps(cos_neg, sign));
+}
+
+/// ---- Arc tangent intrinsics -----------------------------------------------
+/// @brief Arc tangent of y/x in [-pi, pi], with the quadrant of the signs of
+/// y and x. The ratio a = min(|x|,|y|)/max(|x|,|y|) in [0, 1] is reduced to
+/// (a - 1)/(a + 1) above a threshold, adding pi/4, with a single division of
+/// the blended numerator and denominator. The octant of |x| and |y| and the
+/// signs of x and y are applied last. atan2(0, 0) = 0 or pi with the sign of
+/// x, and infinite arguments are not supported.
+///
+///  double precise:    rational function of degree 9/10 above 0.66 (Cephes
+///                     atan).
+///  double fast:       polynomial of degree 9 above tan(pi/8), as single
+///                     precision.
+///  float precise:     polynomial of degree 9 above tan(pi/8) (Cephes atanf).
+///  float fast:        polynomial of degree 5 above tan(pi/8).
+///
+inline __m256d simd256_atan2_(__m256d y, __m256d x, const bool fast)
+{
+    static const double kP[5] = {
+        -6.485021904942025371773E1,
+        -1.228866684490136173410E2,
+        -7.500855792314704667340E1,
+        -1.615753718733365076637E1,
+        -8.750608600031904122785E-1};
+    static const double kQ[6] = {
+        1.945506571482613964425E2,
+        4.853903996359136964868E2,
+        4.328810604912902668951E2,
+        1.650270098316988542046E2,
+        2.485846490142306297962E1,
+        1.0};
+    static const double kFast[4] = {
+        -3.33329491539E-1,
+        1.99777106478E-1,
+        -1.38776856032E-1,
+        8.05374449538E-2};
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    const __m256d pi_2_hi = _mm256_set1_pd(1.5707963267948966);
+    const __m256d pi_2_lo = _mm256_set1_pd(6.123233995736766E-17);
+
+    __m256d ax = _mm256_andnot_pd(sign, x);
+    __m256d ay = _mm256_andnot_pd(sign, y);
+    __m256d num = _mm256_min_pd(ax, ay);
+    __m256d den = _mm256_max_pd(ax, ay);
+
+    // Reduce the ratio above the threshold, with an offset of pi/4.
+    __m256d threshold = _mm256_set1_pd(fast ? 0.41421356237309503 : 0.66);
+    __m256d reduce = _mm256_cmp_pd(num,
+        _mm256_mul_pd(threshold, den), _CMP_GT_OQ);
+    __m256d a = _mm256_div_pd(
+        simd256_select_(reduce, _mm256_sub_pd(num, den), num),
+        simd256_select_(reduce, _mm256_add_pd(num, den), den));
+    a = _mm256_andnot_pd(
+        _mm256_cmp_pd(den, _mm256_setzero_pd(), _CMP_EQ_OQ), a);
+    __m256d offset_hi = _mm256_and_pd(reduce,
+        _mm256_mul_pd(_mm256_set1_pd(0.5), pi_2_hi));
+    __m256d offset_lo = _mm256_and_pd(reduce,
+        _mm256_mul_pd(_mm256_set1_pd(0.5), pi_2_lo));
+
+    __m256d z = _mm256_mul_pd(a, a);
+    __m256d p = fast ? simd256_poly_(z, kFast)
+                     : _mm256_div_pd(simd256_poly_(z, kP),
+                                     simd256_poly_(z, kQ));
+    __m256d r = simd256_madd_(_mm256_mul_pd(a, z), p, a);
+    r = _mm256_add_pd(offset_hi, _mm256_add_pd(r, offset_lo));
+
+    // Octant of |x| and |y|, then the sign of x and the sign of y.
+    r = simd256_select_(_mm256_cmp_pd(ay, ax, _CMP_GT_OQ),
+        _mm256_add_pd(_mm256_sub_pd(pi_2_hi, r), pi_2_lo), r);
+    r = _mm256_blendv_pd(r,
+        _mm256_add_pd(
+            _mm256_sub_pd(_mm256_add_pd(pi_2_hi, pi_2_hi), r),
+            _mm256_add_pd(pi_2_lo, pi_2_lo)),
+        x);
+    return _mm256_or_pd(r, _mm256_and_pd(y, sign));
+}
+
+inline __m256 simd256_atan2_(__m256 y, __m256 x, const bool fast)
+{
+    static const float kPrecise[4] = {
+        -3.33329491539E-1f,
+        1.99777106478E-1f,
+        -1.38776856032E-1f,
+        8.05374449538E-2f};
+    static const float kFast[2] = {
+        -3.328701511090348E-1f,
+        1.7804508440928296E-1f};
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 pi_2 = _mm256_set1_ps(1.57079632679f);
+
+    __m256 ax = _mm256_andnot_ps(sign, x);
+    __m256 ay = _mm256_andnot_ps(sign, y);
+    __m256 num = _mm256_min_ps(ax, ay);
+    __m256 den = _mm256_max_ps(ax, ay);
+
+    // Reduce the ratio above tan(pi/8), with an offset of pi/4.
+    __m256 reduce = _mm256_cmp_ps(num,
+        _mm256_mul_ps(_mm256_set1_ps(0.414213562f), den), _CMP_GT_OQ);
+    __m256 a = _mm256_div_ps(
+        simd256_select_(reduce, _mm256_sub_ps(num, den), num),
+        simd256_select_(reduce, _mm256_add_ps(num, den), den));
+    a = _mm256_andnot_ps(
+        _mm256_cmp_ps(den, _mm256_setzero_ps(), _CMP_EQ_OQ), a);
+    __m256 offset = _mm256_and_ps(reduce, _mm256_set1_ps(0.785398163f));
+
+    __m256 z = _mm256_mul_ps(a, a);
+    __m256 p = fast ? simd256_poly_(z, kFast) : simd256_poly_(z, kPrecise);
+    __m256 r = _mm256_add_ps(offset,
+        simd256_madd_(_mm256_mul_ps(a, z), p, a));
+
+    // Octant of |x| and |y|, then the sign of x and the sign of y.
+    r = simd256_select_(_mm256_cmp_ps(ay, ax, _CMP_GT_OQ),
+        _mm256_sub_ps(pi_2, r), r);
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_add_ps(pi_2, pi_2), r), x);
+    return _mm256_or_ps(r, _mm256_and_ps(y, sign));
+}
+
+/// ---- Packet4d fast math functions -----------------------------------------
+///
+template<>
+inline Packet<double,4> Rsqrt(
+    const Packet<double,4> &u, const Accuracy accuracy)
+{
+    Packet<double,4> result;
+    simd_store(result,
+        simd256_rsqrt_(simd_load(u), accuracy == kAccuracyFast));
+    return result;
+}
+
+template<>
+inline Packet<double,4> Exp(const Packet<double,4> &u, const Accuracy accuracy)
+{
+    Packet<double,4> result;
+    simd_store(result, simd256_exp_(simd_load(u), accuracy == kAccuracyFast));
+    return result;
+}
+
+template<>
+inline Packet<double,4> Log(const Packet<double,4> &u, const Accuracy accuracy)
+{
+    Packet<double,4> result;
+    simd_store(result, simd256_log_(simd_load(u), accuracy == kAccuracyFast));
+    return result;
+}
+
+template<>
+inline void SinCos(
+    const Packet<double,4> &u,
+    Packet<double,4> &sin,
+    Packet<double,4> &cos,
+    const Accuracy accuracy)
+{
+    __m256d s, c;
+    simd256_sincos_(simd_load(u), s, c, accuracy == kAccuracyFast);
+    simd_store(sin, s);
+    simd_store(cos, c);
+}
+
+template<>
+inline Packet<double,4> Atan2(
+    const Packet<double,4> &y,
+    const Packet<double,4> &x,
+    const Accuracy accuracy)
+{
+    Packet<double,4> result;
+    simd_store(result, simd256_atan2_(
+        simd_load(y), simd_load(x), accuracy == kAccuracyFast));
+    return result;
+}
+
+/// ---- Packet8f fast math functions -----------------------------------------
+///
+template<>
+inline Packet<float,8> Rsqrt(const Packet<float,8> &u, const Accuracy accuracy)
+{
+    Packet<float,8> result;
+    simd_store(result,
+        simd256_rsqrt_(simd_load(u), accuracy == kAccuracyFast));
+    return result;
+}
+
+template<>
+inline Packet<float,8> Exp(const Packet<float,8> &u, const Accuracy accuracy)
+{
+    Packet<float,8> result;
+    simd_store(result, simd256_exp_(simd_load(u), accuracy == kAccuracyFast));
+    return result;
+}
+
+template<>
+inline Packet<float,8> Log(const Packet<float,8> &u, const Accuracy accuracy)
+{
+    Packet<float,8> result;
+    simd_store(result, simd256_log_(simd_load(u), accuracy == kAccuracyFast));
+    return result;
+}
+
+template<>
+inline void SinCos(
+    const Packet<float,8> &u,
+    Packet<float,8> &sin,
+    Packet<float,8> &cos,
+    const Accuracy accuracy)
+{
+    __m256 s, c;
+    simd256_sincos_(simd_load(u), s, c, accuracy == kAccuracyFast);
+    simd_store(sin, s);
+    simd_store(cos, c);
+}
+
+template<>
+inline Packet<float,8> Atan2(
+    const Packet<float,8> &y,
+    const Packet<float,8> &x,
+    const Accuracy accuracy)
+{
+    Packet<float,8> result;
+    simd_store(result, simd256_atan2_(
+        simd_load(y), simd_load(x), accuracy == kAccuracyFast));
+    return result;
+}
+
+} // inline namespace MATH_SIMD_ISA
+} // namespace Math
+
+#endif // MATH_SIMD_FASTMATH_H_
@@ -0,0 +1,48 @@
+//
+// isa.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_SIMD_ISA_H_
+#define MATH_SIMD_ISA_H_
+
+///
+/// @brief FMA3 instruction set. MSVC has no __FMA__ macro and enables FMA3
+/// with /arch:AVX2.
+///
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define MATH_SIMD_FMA
+#endif
+
+///
+/// @brief Instruction set namespace. The vector, matrix, quaternion, algebra,
+/// arithmetic, transform, packet, fast math and packed vector functions, and
+/// the simd helper intrinsics, are compiled with the instruction set of each
+/// translation unit. They are declared in an inline namespace named after it,
+/// so that the dispatched kernels, compiled with a higher instruction set than
+/// the rest of the library, instantiate their own copies. Otherwise the linker
+/// would keep one copy of each inline function for all translation units,
+/// possibly one with unsupported instructions. The data types and their
+/// members are in the Math namespace, and are the same in every translation
+/// unit. The dispatched kernels do not call the std algorithms, whose copies
+/// would be shared as well.
+///
+#if defined(__AVX512F__)
+#define MATH_SIMD_ISA IsaAvx512
+#elif defined(__AVX2__) && defined(MATH_SIMD_FMA)
+#define MATH_SIMD_ISA IsaAvx2Fma
+#elif defined(__AVX2__)
+#define MATH_SIMD_ISA IsaAvx2
+#elif defined(__AVX__) && defined(MATH_SIMD_FMA)
+#define MATH_SIMD_ISA IsaAvxFma
+#elif defined(__AVX__)
+#define MATH_SIMD_ISA IsaAvx
+#else
+#define MATH_SIMD_ISA IsaGeneric
+#endif
+
+#endif // MATH_SIMD_ISA_H_
@@ -0,0 +1,271 @@
+//
+// kernels-avx.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "kernels.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#include "kernels-batch.h"
+
+namespace Math {
+
+/// ---- Single precision kernels ---------------------------------------------
+///
+/// @brief Transform an array of vectors by the matrix. Process two vectors at
+/// once, one in each 128-bit lane, with the matrix columns duplicated in both
+/// lanes. The vector elements are broadcast within each lane.
+///
+static void TransformVec4f(
+    const Mat4<float> &m,
+    const Vec4<float> *src,
+    Vec4<float> *dst,
+    const size_t count)
+{
+    __m128 c0 = _mm_load_ps(&m.data[0]);
+    __m128 c1 = _mm_load_ps(&m.data[4]);
+    __m128 c2 = _mm_load_ps(&m.data[8]);
+    __m128 c3 = _mm_load_ps(&m.data[12]);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    __m256 cc0 = _mm256_insertf128_ps(_mm256_castps128_ps256(c0), c0, 1);
+    __m256 cc1 = _mm256_insertf128_ps(_mm256_castps128_ps256(c1), c1, 1);
+    __m256 cc2 = _mm256_insertf128_ps(_mm256_castps128_ps256(c2), c2, 1);
+    __m256 cc3 = _mm256_insertf128_ps(_mm256_castps128_ps256(c3), c3, 1);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m256 v = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(_mm_load_ps(src[i].data)),
+            _mm_load_ps(src[i+1].data), 1);
+        __m256 r = _mm256_mul_ps(cc0, _mm256_permute_ps(v, 0x00));
+        r = _mm256_add_ps(r, _mm256_mul_ps(cc1, _mm256_permute_ps(v, 0x55)));
+        r = _mm256_add_ps(r, _mm256_mul_ps(cc2, _mm256_permute_ps(v, 0xaa)));
+        r = _mm256_add_ps(r, _mm256_mul_ps(cc3, _mm256_permute_ps(v, 0xff)));
+        _mm_store_ps(dst[i].data, _mm256_castps256_ps128(r));
+        _mm_store_ps(dst[i+1].data, _mm256_extractf128_ps(r, 1));
+    }
+
+    for (; i < count; ++i) {
+        __m128 v = _mm_load_ps(src[i].data);
+        __m128 r = _mm_mul_ps(c0, _mm_permute_ps(v, 0x00));
+        r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_permute_ps(v, 0x55)));
+        r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_permute_ps(v, 0xaa)));
+        r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_permute_ps(v, 0xff)));
+        _mm_store_ps(dst[i].data, r);
+    }
+}
+
+///
+/// @brief Transform an array of matrices by the matrix. Compute two output
+/// rows at once, one in each 128-bit lane. The input rows are duplicated in
+/// both lanes and weighted by the elements of the two matrix rows.
+///
+static void TransformMat4f(
+    const Mat4<float> &m,
+    const Mat4<float> *src,
+    Mat4<float> *dst,
+    const size_t count)
+{
+    __m256 a01 = _mm256_load_ps(&m.data[0]);
+    __m256 a23 = _mm256_load_ps(&m.data[8]);
+    __m256 p01[4] = {
+        _mm256_permute_ps(a01, 0x00), _mm256_permute_ps(a01, 0x55),
+        _mm256_permute_ps(a01, 0xaa), _mm256_permute_ps(a01, 0xff)};
+    __m256 p23[4] = {
+        _mm256_permute_ps(a23, 0x00), _mm256_permute_ps(a23, 0x55),
+        _mm256_permute_ps(a23, 0xaa), _mm256_permute_ps(a23, 0xff)};
+
+    for (size_t i = 0; i < count; ++i) {
+        __m256 b0 = _mm256_broadcast_ps((const __m128 *) &src[i].data[0]);
+        __m256 b1 = _mm256_broadcast_ps((const __m128 *) &src[i].data[4]);
+        __m256 b2 = _mm256_broadcast_ps((const __m128 *) &src[i].data[8]);
+        __m256 b3 = _mm256_broadcast_ps((const __m128 *) &src[i].data[12]);
+
+        __m256 r01 = _mm256_mul_ps(p01[0], b0);
+        r01 = _mm256_add_ps(r01, _mm256_mul_ps(p01[1], b1));
+        r01 = _mm256_add_ps(r01, _mm256_mul_ps(p01[2], b2));
+        r01 = _mm256_add_ps(r01, _mm256_mul_ps(p01[3], b3));
+
+        __m256 r23 = _mm256_mul_ps(p23[0], b0);
+        r23 = _mm256_add_ps(r23, _mm256_mul_ps(p23[1], b1));
+        r23 = _mm256_add_ps(r23, _mm256_mul_ps(p23[2], b2));
+        r23 = _mm256_add_ps(r23, _mm256_mul_ps(p23[3], b3));
+
+        _mm256_store_ps(&dst[i].data[0], r01);
+        _mm256_store_ps(&dst[i].data[8], r23);
+    }
+}
+
+/// ---- Double precision kernels ---------------------------------------------
+///
+/// @brief Transform an array of vectors by the matrix. Each output vector is
+/// the sum of the matrix columns weighted by the input vector elements.
+///
+static void TransformVec4d(
+    const Mat4<double> &m,
+    const Vec4<double> *src,
+    Vec4<double> *dst,
+    const size_t count)
+{
+    __m256d c[4];
+    for (size_t k = 0; k < 4; ++k) {
+        c[k] = _mm256_set_pd(
+            m.data[12 + k], m.data[8 + k], m.data[4 + k], m.data[k]);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        __m256d x = _mm256_broadcast_sd(&src[i].data[0]);
+        __m256d y = _mm256_broadcast_sd(&src[i].data[1]);
+        __m256d z = _mm256_broadcast_sd(&src[i].data[2]);
+        __m256d w = _mm256_broadcast_sd(&src[i].data[3]);
+        __m256d r = _mm256_mul_pd(c[0], x);
+        r = _mm256_add_pd(r, _mm256_mul_pd(c[1], y));
+        r = _mm256_add_pd(r, _mm256_mul_pd(c[2], z));
+        r = _mm256_add_pd(r, _mm256_mul_pd(c[3], w));
+        _mm256_store_pd(dst[i].data, r);
+    }
+}
+
+///
+/// @brief Transform an array of matrices by the matrix. Each output row is the
+/// sum of the input rows weighted by the elements of the matrix row.
+///
+static void TransformMat4d(
+    const Mat4<double> &m,
+    const Mat4<double> *src,
+    Mat4<double> *dst,
+    const size_t count)
+{
+    __m256d a[16];
+    for (size_t k = 0; k < 16; ++k) {
+        a[k] = _mm256_set1_pd(m.data[k]);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        __m256d b0 = _mm256_load_pd(&src[i].data[0]);
+        __m256d b1 = _mm256_load_pd(&src[i].data[4]);
+        __m256d b2 = _mm256_load_pd(&src[i].data[8]);
+        __m256d b3 = _mm256_load_pd(&src[i].data[12]);
+        for (size_t r = 0; r < 4; ++r) {
+            __m256d row = _mm256_mul_pd(a[4*r], b0);
+            row = _mm256_add_pd(row, _mm256_mul_pd(a[4*r + 1], b1));
+            row = _mm256_add_pd(row, _mm256_mul_pd(a[4*r + 2], b2));
+            row = _mm256_add_pd(row, _mm256_mul_pd(a[4*r + 3], b3));
+            _mm256_store_pd(&dst[i].data[4*r], row);
+        }
+    }
+}
+
+/// ---- Matrix product kernels -----------------------------------------------
+///
+/// @brief Multiply the packed panels of a and b and accumulate the product
+/// into the tile of c. Each row of the tile is held in two registers, and each
+/// step broadcasts one element of a per row.
+///
+static void Gemmf(
+    const size_t depth,
+    const float *a,
+    const float *b,
+    float *c,
+    const size_t ldc)
+{
+    __m256 acc[kGemmRows][2];
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        acc[i][0] = _mm256_setzero_ps();
+        acc[i][1] = _mm256_setzero_ps();
+    }
+
+    for (size_t p = 0; p < depth; ++p) {
+        __m256 b0 = _mm256_loadu_ps(&b[p * kGemmColsf]);
+        __m256 b1 = _mm256_loadu_ps(&b[p * kGemmColsf + 8]);
+        for (size_t i = 0; i < kGemmRows; ++i) {
+            __m256 ai = _mm256_broadcast_ss(&a[p * kGemmRows + i]);
+            acc[i][0] = _mm256_add_ps(acc[i][0], _mm256_mul_ps(ai, b0));
+            acc[i][1] = _mm256_add_ps(acc[i][1], _mm256_mul_ps(ai, b1));
+        }
+    }
+
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        float *row = &c[i * ldc];
+        _mm256_storeu_ps(&row[0],
+            _mm256_add_ps(_mm256_loadu_ps(&row[0]), acc[i][0]));
+        _mm256_storeu_ps(&row[8],
+            _mm256_add_ps(_mm256_loadu_ps(&row[8]), acc[i][1]));
+    }
+}
+
+static void Gemmd(
+    const size_t depth,
+    const double *a,
+    const double *b,
+    double *c,
+    const size_t ldc)
+{
+    __m256d acc[kGemmRows][2];
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        acc[i][0] = _mm256_setzero_pd();
+        acc[i][1] = _mm256_setzero_pd();
+    }
+
+    for (size_t p = 0; p < depth; ++p) {
+        __m256d b0 = _mm256_loadu_pd(&b[p * kGemmColsd]);
+        __m256d b1 = _mm256_loadu_pd(&b[p * kGemmColsd + 4]);
+        for (size_t i = 0; i < kGemmRows; ++i) {
+            __m256d ai = _mm256_broadcast_sd(&a[p * kGemmRows + i]);
+            acc[i][0] = _mm256_add_pd(acc[i][0], _mm256_mul_pd(ai, b0));
+            acc[i][1] = _mm256_add_pd(acc[i][1], _mm256_mul_pd(ai, b1));
+        }
+    }
+
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        double *row = &c[i * ldc];
+        _mm256_storeu_pd(&row[0],
+            _mm256_add_pd(_mm256_loadu_pd(&row[0]), acc[i][0]));
+        _mm256_storeu_pd(&row[4],
+            _mm256_add_pd(_mm256_loadu_pd(&row[4]), acc[i][1]));
+    }
+}
+
+/// ---- AVX kernels ----------------------------------------------------------
+///
+static const Kernels kKernelsAvx = {
+    kIsaAvx,
+    TransformVec4f,
+    TransformVec4d,
+    TransformMat4f,
+    TransformMat4d,
+    nullptr,            // transformVec3d
+    nullptr,            // dotMat4d
+    nullptr,            // determinantMat4d
+    nullptr,            // inverseMat4d
+    nullptr,            // convertToHalf
+    nullptr,            // convertFromHalf
+    nullptr,            // convertToBFloat16
+    nullptr,            // convertFromBFloat16
+    nullptr,            // cellKeys
+    nullptr,            // randomFill32
+    nullptr,            // randomFill64
+    nullptr,            // randomStream
+    Gemmf,
+    Gemmd,
+    CreateBatchKernels<float>(),
+    CreateBatchKernels<double>(),
+};
+
+const Kernels *GetKernelsAvx() { return &kKernelsAvx; }
+
+} // namespace Math
+
+#else  // __AVX__
+
+namespace Math {
+const Kernels *GetKernelsAvx() { return nullptr; }
+} // namespace Math
+
+#endif // __AVX__
@@ -0,0 +1,832 @@
+//
+// kernels-avx2.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "kernels.h"
+
+#if defined(__AVX2__) && \
+    ((defined(__FMA__) && defined(__F16C__)) || defined(_MSC_VER))
+#include <cstring>
+#include <immintrin.h>
+#include "kernels-batch.h"
+
+namespace Math {
+
+/// ---- Single precision kernels ---------------------------------------------
+///
+/// @brief Transform an array of vectors by the matrix. Process two vectors at
+/// once, one in each 128-bit lane, with the matrix columns duplicated in both
+/// lanes. The vector elements are broadcast within each lane. The AVX2 kernels
+/// accumulate the products with fused multiply-add.
+///
+static void TransformVec4f(
+    const Mat4<float> &m,
+    const Vec4<float> *src,
+    Vec4<float> *dst,
+    const size_t count)
+{
+    __m128 c0 = _mm_load_ps(&m.data[0]);
+    __m128 c1 = _mm_load_ps(&m.data[4]);
+    __m128 c2 = _mm_load_ps(&m.data[8]);
+    __m128 c3 = _mm_load_ps(&m.data[12]);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    __m256 cc0 = _mm256_insertf128_ps(_mm256_castps128_ps256(c0), c0, 1);
+    __m256 cc1 = _mm256_insertf128_ps(_mm256_castps128_ps256(c1), c1, 1);
+    __m256 cc2 = _mm256_insertf128_ps(_mm256_castps128_ps256(c2), c2, 1);
+    __m256 cc3 = _mm256_insertf128_ps(_mm256_castps128_ps256(c3), c3, 1);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m256 v = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(_mm_load_ps(src[i].data)),
+            _mm_load_ps(src[i+1].data), 1);
+        __m256 r = _mm256_mul_ps(cc0, _mm256_permute_ps(v, 0x00));
+        r = _mm256_fmadd_ps(cc1, _mm256_permute_ps(v, 0x55), r);
+        r = _mm256_fmadd_ps(cc2, _mm256_permute_ps(v, 0xaa), r);
+        r = _mm256_fmadd_ps(cc3, _mm256_permute_ps(v, 0xff), r);
+        _mm_store_ps(dst[i].data, _mm256_castps256_ps128(r));
+        _mm_store_ps(dst[i+1].data, _mm256_extractf128_ps(r, 1));
+    }
+
+    for (; i < count; ++i) {
+        __m128 v = _mm_load_ps(src[i].data);
+        __m128 r = _mm_mul_ps(c0, _mm_permute_ps(v, 0x00));
+        r = _mm_fmadd_ps(c1, _mm_permute_ps(v, 0x55), r);
+        r = _mm_fmadd_ps(c2, _mm_permute_ps(v, 0xaa), r);
+        r = _mm_fmadd_ps(c3, _mm_permute_ps(v, 0xff), r);
+        _mm_store_ps(dst[i].data, r);
+    }
+}
+
+///
+/// @brief Transform an array of matrices by the matrix. Compute two output
+/// rows at once, one in each 128-bit lane. The input rows are duplicated in
+/// both lanes and weighted by the elements of the two matrix rows.
+///
+static void TransformMat4f(
+    const Mat4<float> &m,
+    const Mat4<float> *src,
+    Mat4<float> *dst,
+    const size_t count)
+{
+    __m256 a01 = _mm256_load_ps(&m.data[0]);
+    __m256 a23 = _mm256_load_ps(&m.data[8]);
+    __m256 p01[4] = {
+        _mm256_permute_ps(a01, 0x00), _mm256_permute_ps(a01, 0x55),
+        _mm256_permute_ps(a01, 0xaa), _mm256_permute_ps(a01, 0xff)};
+    __m256 p23[4] = {
+        _mm256_permute_ps(a23, 0x00), _mm256_permute_ps(a23, 0x55),
+        _mm256_permute_ps(a23, 0xaa), _mm256_permute_ps(a23, 0xff)};
+
+    for (size_t i = 0; i < count; ++i) {
+        __m256 b0 = _mm256_broadcast_ps((const __m128 *) &src[i].data[0]);
+        __m256 b1 = _mm256_broadcast_ps((const __m128 *) &src[i].data[4]);
+        __m256 b2 = _mm256_broadcast_ps((const __m128 *) &src[i].data[8]);
+        __m256 b3 = _mm256_broadcast_ps((const __m128 *) &src[i].data[12]);
+
+        __m256 r01 = _mm256_mul_ps(p01[0], b0);
+        r01 = _mm256_fmadd_ps(p01[1], b1, r01);
+        r01 = _mm256_fmadd_ps(p01[2], b2, r01);
+        r01 = _mm256_fmadd_ps(p01[3], b3, r01);
+
+        __m256 r23 = _mm256_mul_ps(p23[0], b0);
+        r23 = _mm256_fmadd_ps(p23[1], b1, r23);
+        r23 = _mm256_fmadd_ps(p23[2], b2, r23);
+        r23 = _mm256_fmadd_ps(p23[3], b3, r23);
+
+        _mm256_store_ps(&dst[i].data[0], r01);
+        _mm256_store_ps(&dst[i].data[8], r23);
+    }
+}
+
+/// ---- Double precision kernels ---------------------------------------------
+///
+/// @brief Transform an array of vectors by the matrix. Each output vector is
+/// the sum of the matrix columns weighted by the input vector elements.
+///
+static void TransformVec4d(
+    const Mat4<double> &m,
+    const Vec4<double> *src,
+    Vec4<double> *dst,
+    const size_t count)
+{
+    __m256d c[4];
+    for (size_t k = 0; k < 4; ++k) {
+        c[k] = _mm256_set_pd(
+            m.data[12 + k], m.data[8 + k], m.data[4 + k], m.data[k]);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        __m256d x = _mm256_broadcast_sd(&src[i].data[0]);
+        __m256d y = _mm256_broadcast_sd(&src[i].data[1]);
+        __m256d z = _mm256_broadcast_sd(&src[i].data[2]);
+        __m256d w = _mm256_broadcast_sd(&src[i].data[3]);
+        __m256d r = _mm256_mul_pd(c[0], x);
+        r = _mm256_fmadd_pd(c[1], y, r);
+        r = _mm256_fmadd_pd(c[2], z, r);
+        r = _mm256_fmadd_pd(c[3], w, r);
+        _mm256_store_pd(dst[i].data, r);
+    }
+}
+
+///
+/// @brief Transform an array of matrices by the matrix. Each output row is the
+/// sum of the input rows weighted by the elements of the matrix row.
+///
+static void TransformMat4d(
+    const Mat4<double> &m,
+    const Mat4<double> *src,
+    Mat4<double> *dst,
+    const size_t count)
+{
+    __m256d a[16];
+    for (size_t k = 0; k < 16; ++k) {
+        a[k] = _mm256_set1_pd(m.data[k]);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        __m256d b0 = _mm256_load_pd(&src[i].data[0]);
+        __m256d b1 = _mm256_load_pd(&src[i].data[4]);
+        __m256d b2 = _mm256_load_pd(&src[i].data[8]);
+        __m256d b3 = _mm256_load_pd(&src[i].data[12]);
+        for (size_t r = 0; r < 4; ++r) {
+            __m256d row = _mm256_mul_pd(a[4*r], b0);
+            row = _mm256_fmadd_pd(a[4*r + 1], b1, row);
+            row = _mm256_fmadd_pd(a[4*r + 2], b2, row);
+            row = _mm256_fmadd_pd(a[4*r + 3], b3, row);
+            _mm256_store_pd(&dst[i].data[4*r], row);
+        }
+    }
+}
+
+/// ---- Half precision kernels -----------------------------------------------
+///
+/// @brief Convert blocks of 8 floats to half with F16C, rounding to nearest
+/// even. The last partial block is converted through a zero padded buffer.
+///
+static inline void ConvertToHalfBlock(const float *src, Half *dst)
+{
+    __m256 v = _mm256_loadu_ps(src);
+    _mm_storeu_si128((__m128i *) dst,
+        _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+static void ConvertToHalf(const float *src, Half *dst, const size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        ConvertToHalfBlock(&src[i], &dst[i]);
+    }
+
+    if (i < count) {
+        float in[8] = {};
+        Half out[8];
+        std::memcpy(in, &src[i], (count - i) * sizeof(float));
+        ConvertToHalfBlock(in, out);
+        std::memcpy(&dst[i], out, (count - i) * sizeof(Half));
+    }
+}
+
+///
+/// @brief Convert blocks of 8 halfs to float with F16C.
+///
+static inline void ConvertFromHalfBlock(const Half *src, float *dst)
+{
+    __m128i v = _mm_loadu_si128((const __m128i *) src);
+    _mm256_storeu_ps(dst, _mm256_cvtph_ps(v));
+}
+
+static void ConvertFromHalf(const Half *src, float *dst, const size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        ConvertFromHalfBlock(&src[i], &dst[i]);
+    }
+
+    if (i < count) {
+        Half in[8] = {};
+        float out[8];
+        std::memcpy(in, &src[i], (count - i) * sizeof(Half));
+        ConvertFromHalfBlock(in, out);
+        std::memcpy(&dst[i], out, (count - i) * sizeof(float));
+    }
+}
+
+///
+/// @brief Convert blocks of 8 floats to bfloat16. Round the upper 16 bits to
+/// nearest even by adding 0x7fff plus the lowest kept bit, quiet the NaNs and
+/// pack the 32-bit lanes into 16-bit lanes.
+///
+static inline void ConvertToBFloat16Block(const float *src, BFloat16 *dst)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i round = _mm256_set1_epi32(0x7fff);
+    const __m256i quiet = _mm256_set1_epi32(0x40);
+
+    __m256 v = _mm256_loadu_ps(src);
+    __m256i x = _mm256_castps_si256(v);
+    __m256i hi = _mm256_srli_epi32(x, 16);
+    __m256i r = _mm256_add_epi32(x, round);
+    r = _mm256_add_epi32(r, _mm256_and_si256(hi, one));
+    r = _mm256_srli_epi32(r, 16);
+
+    __m256 nan = _mm256_cmp_ps(v, v, _CMP_UNORD_Q);
+    r = _mm256_blendv_epi8(
+        r, _mm256_or_si256(hi, quiet), _mm256_castps_si256(nan));
+
+    r = _mm256_packus_epi32(r, r);
+    r = _mm256_permute4x64_epi64(r, 0x08);
+    _mm_storeu_si128((__m128i *) dst, _mm256_castsi256_si128(r));
+}
+
+static void ConvertToBFloat16(
+    const float *src,
+    BFloat16 *dst,
+    const size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        ConvertToBFloat16Block(&src[i], &dst[i]);
+    }
+
+    if (i < count) {
+        float in[8] = {};
+        BFloat16 out[8];
+        std::memcpy(in, &src[i], (count - i) * sizeof(float));
+        ConvertToBFloat16Block(in, out);
+        std::memcpy(&dst[i], out, (count - i) * sizeof(BFloat16));
+    }
+}
+
+///
+/// @brief Convert blocks of 8 bfloat16 to float, by widening the 16-bit lanes
+/// and shifting them into the upper half of the 32-bit lanes.
+///
+static inline void ConvertFromBFloat16Block(const BFloat16 *src, float *dst)
+{
+    __m128i v = _mm_loadu_si128((const __m128i *) src);
+    __m256i x = _mm256_slli_epi32(_mm256_cvtepu16_epi32(v), 16);
+    _mm256_storeu_ps(dst, _mm256_castsi256_ps(x));
+}
+
+static void ConvertFromBFloat16(
+    const BFloat16 *src,
+    float *dst,
+    const size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        ConvertFromBFloat16Block(&src[i], &dst[i]);
+    }
+
+    if (i < count) {
+        BFloat16 in[8] = {};
+        float out[8];
+        std::memcpy(in, &src[i], (count - i) * sizeof(BFloat16));
+        ConvertFromBFloat16Block(in, out);
+        std::memcpy(&dst[i], out, (count - i) * sizeof(float));
+    }
+}
+
+/// ---- Cell grid kernels ----------------------------------------------------
+///
+/// @brief Compute the cell hash keys of blocks of 8 points. Load the points
+/// in pairs into each 128-bit lane and transpose them into x, y and z lanes.
+/// Clamp the scaled coordinates to the grid, truncate them to the cell index
+/// and hash the index with 32-bit integer products. The last partial block is
+/// computed through a zero padded buffer.
+///
+struct CellGridAvx2 {
+    __m256 lo[3];
+    __m256 scale[3];
+    __m256 hi[3];
+    __m256i primes[3];
+};
+
+static inline void CellKeysBlock(
+    const CellGridAvx2 &grid,
+    const Vec3<float> *points,
+    uint32_t *dst)
+{
+    __m256 r0 = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_load_ps(points[0].data)),
+        _mm_load_ps(points[4].data), 1);
+    __m256 r1 = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_load_ps(points[1].data)),
+        _mm_load_ps(points[5].data), 1);
+    __m256 r2 = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_load_ps(points[2].data)),
+        _mm_load_ps(points[6].data), 1);
+    __m256 r3 = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_load_ps(points[3].data)),
+        _mm_load_ps(points[7].data), 1);
+
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    __m256 p[3] = {
+        _mm256_shuffle_ps(t0, t2, 0x44),
+        _mm256_shuffle_ps(t0, t2, 0xee),
+        _mm256_shuffle_ps(t1, t3, 0x44)};
+
+    const __m256 zero = _mm256_setzero_ps();
+    __m256i key = _mm256_setzero_si256();
+    for (size_t k = 0; k < 3; ++k) {
+        __m256 u = _mm256_sub_ps(p[k], grid.lo[k]);
+        u = _mm256_mul_ps(u, grid.scale[k]);
+        u = _mm256_min_ps(_mm256_max_ps(u, zero), grid.hi[k]);
+        __m256i cell = _mm256_cvttps_epi32(u);
+        key = _mm256_xor_si256(key, _mm256_mullo_epi32(cell, grid.primes[k]));
+    }
+    _mm256_storeu_si256((__m256i *) dst, key);
+}
+
+static void CellKeys(
+    const CellGrid &grid,
+    const Vec3<float> *points,
+    uint32_t *dst,
+    const size_t count)
+{
+    CellGridAvx2 g;
+    for (size_t k = 0; k < 3; ++k) {
+        g.lo[k] = _mm256_set1_ps(grid.lo.data[k]);
+        g.scale[k] = _mm256_set1_ps(grid.scale.data[k]);
+        g.hi[k] = _mm256_set1_ps(static_cast<float>(grid.dims.data[k] - 1));
+        g.primes[k] = _mm256_set1_epi32(static_cast<int>(kCellHashPrimes[k]));
+    }
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        CellKeysBlock(g, &points[i], &dst[i]);
+    }
+
+    if (i < count) {
+        Vec3<float> in[8] = {};
+        uint32_t out[8];
+        for (size_t j = 0; j < count - i; ++j) {
+            in[j] = points[i + j];
+        }
+        CellKeysBlock(g, in, out);
+        std::memcpy(&dst[i], out, (count - i) * sizeof(uint32_t));
+    }
+}
+
+/// ---- Random number kernels ------------------------------------------------
+///
+/// @brief Random number generator lanes in registers, each generator in two
+/// registers of 4 64-bit lanes. The multiply-with-carry state of a lane is
+/// held as z | c << 32, so that the next state z * m + c is one 32-bit
+/// product and one add.
+///
+struct RandomLanesAvx2 {
+    __m256i x[2];
+    __m256i y[2];
+    __m256i w1[2];
+    __m256i w2[2];
+};
+
+///
+/// @brief Return the low 32 bits of the 64-bit lanes of a and b, in 8 32-bit
+/// lanes.
+///
+static inline __m256i RandomPackLo(__m256i a, __m256i b)
+{
+    const __m256i index = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    __m256i lo = _mm256_permutevar8x32_epi32(a, index);
+    __m256i hi = _mm256_permutevar8x32_epi32(b, index);
+    return _mm256_blend_epi32(lo, hi, 0xf0);
+}
+
+static inline void RandomLoad(const RandomLanes &lanes, RandomLanesAvx2 &r)
+{
+    for (size_t k = 0; k < 2; ++k) {
+        r.x[k] = _mm256_loadu_si256((const __m256i *) &lanes.x[4*k]);
+        r.y[k] = _mm256_loadu_si256((const __m256i *) &lanes.y[4*k]);
+
+        __m256i z1 = _mm256_cvtepu32_epi64(
+            _mm_loadu_si128((const __m128i *) &lanes.z1[4*k]));
+        __m256i c1 = _mm256_cvtepu32_epi64(
+            _mm_loadu_si128((const __m128i *) &lanes.c1[4*k]));
+        r.w1[k] = _mm256_or_si256(z1, _mm256_slli_epi64(c1, 32));
+
+        __m256i z2 = _mm256_cvtepu32_epi64(
+            _mm_loadu_si128((const __m128i *) &lanes.z2[4*k]));
+        __m256i c2 = _mm256_cvtepu32_epi64(
+            _mm_loadu_si128((const __m128i *) &lanes.c2[4*k]));
+        r.w2[k] = _mm256_or_si256(z2, _mm256_slli_epi64(c2, 32));
+    }
+}
+
+static inline void RandomStore(const RandomLanesAvx2 &r, RandomLanes &lanes)
+{
+    for (size_t k = 0; k < 2; ++k) {
+        _mm256_storeu_si256((__m256i *) &lanes.x[4*k], r.x[k]);
+        _mm256_storeu_si256((__m256i *) &lanes.y[4*k], r.y[k]);
+    }
+    _mm256_storeu_si256((__m256i *) lanes.z1, RandomPackLo(r.w1[0], r.w1[1]));
+    _mm256_storeu_si256((__m256i *) lanes.c1, RandomPackLo(
+        _mm256_srli_epi64(r.w1[0], 32), _mm256_srli_epi64(r.w1[1], 32)));
+    _mm256_storeu_si256((__m256i *) lanes.z2, RandomPackLo(r.w2[0], r.w2[1]));
+    _mm256_storeu_si256((__m256i *) lanes.c2, RandomPackLo(
+        _mm256_srli_epi64(r.w2[0], 32), _mm256_srli_epi64(r.w2[1], 32)));
+}
+
+///
+/// @brief Advance the generators of all lanes by one step. AVX2 has no 64-bit
+/// multiply, so the low 64 bits of the linear congruential product are built
+/// from 32-bit products, a_lo*b_lo + ((a_hi*b_lo + a_lo*b_hi) << 32). The
+/// second multiply-with-carry generator is only advanced by the 64-bit step.
+///
+static inline void RandomStep(RandomLanesAvx2 &r, const bool step64)
+{
+    const uint64_t m1 = 1490024343005336237ULL;
+    const __m256i m1_lo = _mm256_set1_epi64x(m1 & 0xffffffff);
+    const __m256i m1_hi = _mm256_set1_epi64x(m1 >> 32);
+    const __m256i m2 = _mm256_set1_epi64x(123456789ULL);
+    const __m256i m3 = _mm256_set1_epi64x(4294584393ULL);
+    const __m256i m4 = _mm256_set1_epi64x(4246477509ULL);
+
+    for (size_t k = 0; k < 2; ++k) {
+        __m256i x = r.x[k];
+        __m256i cross = _mm256_add_epi64(
+            _mm256_mul_epu32(_mm256_srli_epi64(x, 32), m1_lo),
+            _mm256_mul_epu32(x, m1_hi));
+        x = _mm256_add_epi64(
+            _mm256_mul_epu32(x, m1_lo), _mm256_slli_epi64(cross, 32));
+        r.x[k] = _mm256_add_epi64(x, m2);
+
+        __m256i y = r.y[k];
+        y = _mm256_xor_si256(y, _mm256_slli_epi64(y, 21));
+        y = _mm256_xor_si256(y, _mm256_srli_epi64(y, 17));
+        r.y[k] = _mm256_xor_si256(y, _mm256_slli_epi64(y, 30));
+
+        r.w1[k] = _mm256_add_epi64(
+            _mm256_mul_epu32(r.w1[k], m3), _mm256_srli_epi64(r.w1[k], 32));
+        if (step64) {
+            r.w2[k] = _mm256_add_epi64(
+                _mm256_mul_epu32(r.w2[k], m4), _mm256_srli_epi64(r.w2[k], 32));
+        }
+    }
+}
+
+///
+/// @brief Fill an array with the 32-bit numbers of the lanes, 8 numbers per
+/// step, (x >> 32) + y + z1 in the low 32 bits of each 64-bit lane. The last
+/// partial step is stored through a buffer.
+///
+static inline __m256i RandomNext32(RandomLanesAvx2 &r)
+{
+    RandomStep(r, false);
+    __m256i a = _mm256_add_epi64(
+        _mm256_add_epi64(_mm256_srli_epi64(r.x[0], 32), r.y[0]), r.w1[0]);
+    __m256i b = _mm256_add_epi64(
+        _mm256_add_epi64(_mm256_srli_epi64(r.x[1], 32), r.y[1]), r.w1[1]);
+    return RandomPackLo(a, b);
+}
+
+static void RandomFill32(RandomLanes &lanes, uint32_t *dst, const size_t count)
+{
+    RandomLanesAvx2 r;
+    RandomLoad(lanes, r);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256((__m256i *) &dst[i], RandomNext32(r));
+    }
+
+    if (i < count) {
+        uint32_t out[8];
+        _mm256_storeu_si256((__m256i *) out, RandomNext32(r));
+        std::memcpy(&dst[i], out, (count - i) * sizeof(uint32_t));
+    }
+    RandomStore(r, lanes);
+}
+
+///
+/// @brief Fill an array with the 64-bit numbers of the lanes, 8 numbers per
+/// step, x + y + z1 + (z2 << 32).
+///
+static inline void RandomNext64(RandomLanesAvx2 &r, __m256i out[2])
+{
+    const __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    RandomStep(r, true);
+    for (size_t k = 0; k < 2; ++k) {
+        __m256i z = _mm256_add_epi64(_mm256_and_si256(r.w1[k], mask),
+            _mm256_slli_epi64(r.w2[k], 32));
+        out[k] = _mm256_add_epi64(_mm256_add_epi64(r.x[k], r.y[k]), z);
+    }
+}
+
+static void RandomFill64(RandomLanes &lanes, uint64_t *dst, const size_t count)
+{
+    RandomLanesAvx2 r;
+    RandomLoad(lanes, r);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i out[2];
+        RandomNext64(r, out);
+        _mm256_storeu_si256((__m256i *) &dst[i], out[0]);
+        _mm256_storeu_si256((__m256i *) &dst[i + 4], out[1]);
+    }
+
+    if (i < count) {
+        __m256i out[2];
+        RandomNext64(r, out);
+        std::memcpy(&dst[i], out, (count - i) * sizeof(uint64_t));
+    }
+    RandomStore(r, lanes);
+}
+
+/// ---- Random stream kernels ------------------------------------------------
+///
+/// @brief Counter-based random streams evaluate 8 blocks per step, with the
+/// counters in structure of arrays layout, one register per counter word.
+/// The 64-bit block indices are split into their low and high words with
+/// a lane permutation.
+///
+static inline void StreamCounters(
+    const RandomStream &stream,
+    const uint64_t block,
+    __m256i x[4])
+{
+    const __m256i index = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    const __m256i base = _mm256_set1_epi64x((long long) block);
+    __m256i b0 = _mm256_permutevar8x32_epi32(
+        _mm256_add_epi64(base, _mm256_setr_epi64x(0, 1, 2, 3)), index);
+    __m256i b1 = _mm256_permutevar8x32_epi32(
+        _mm256_add_epi64(base, _mm256_setr_epi64x(4, 5, 6, 7)), index);
+    x[0] = _mm256_permute2x128_si256(b0, b1, 0x20);
+    x[1] = _mm256_permute2x128_si256(b0, b1, 0x31);
+    x[2] = _mm256_set1_epi32((int) stream.stream[0]);
+    x[3] = _mm256_set1_epi32((int) stream.stream[1]);
+}
+
+///
+/// @brief Store the blocks of the counter words in array of structures
+/// layout, with a 4x8 transpose.
+///
+static inline void StreamStore(const __m256i x[4], uint32_t *dst)
+{
+    __m256i t0 = _mm256_unpacklo_epi32(x[0], x[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(x[0], x[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(x[2], x[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(x[2], x[3]);
+    __m256i u0 = _mm256_unpacklo_epi64(t0, t2);     // blocks 0, 4
+    __m256i u1 = _mm256_unpackhi_epi64(t0, t2);     // blocks 1, 5
+    __m256i u2 = _mm256_unpacklo_epi64(t1, t3);     // blocks 2, 6
+    __m256i u3 = _mm256_unpackhi_epi64(t1, t3);     // blocks 3, 7
+    _mm256_storeu_si256((__m256i *) &dst[0],
+        _mm256_permute2x128_si256(u0, u1, 0x20));
+    _mm256_storeu_si256((__m256i *) &dst[8],
+        _mm256_permute2x128_si256(u2, u3, 0x20));
+    _mm256_storeu_si256((__m256i *) &dst[16],
+        _mm256_permute2x128_si256(u0, u1, 0x31));
+    _mm256_storeu_si256((__m256i *) &dst[24],
+        _mm256_permute2x128_si256(u2, u3, 0x31));
+}
+
+///
+/// @brief Philox4x32-10 rounds. The 32x32-bit products of the even and the
+/// odd lanes are computed separately and merged into their high and low
+/// words.
+///
+static inline void StreamMulHiLo(
+    const __m256i a,
+    const __m256i m,
+    __m256i &hi,
+    __m256i &lo)
+{
+    __m256i even = _mm256_mul_epu32(a, m);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+    lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa);
+    hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xaa);
+}
+
+static inline void StreamPhilox(const RandomStream &stream, __m256i x[4])
+{
+    const __m256i m0 = _mm256_set1_epi32((int) 0xD2511F53U);
+    const __m256i m1 = _mm256_set1_epi32((int) 0xCD9E8D57U);
+    uint32_t k0 = stream.key[0];
+    uint32_t k1 = stream.key[1];
+    for (size_t round = 0; round < 10; ++round) {
+        __m256i hi0, lo0, hi1, lo1;
+        StreamMulHiLo(x[0], m0, hi0, lo0);
+        StreamMulHiLo(x[2], m1, hi1, lo1);
+        x[0] = _mm256_xor_si256(_mm256_xor_si256(hi1, x[1]),
+            _mm256_set1_epi32((int) k0));
+        x[1] = lo1;
+        x[2] = _mm256_xor_si256(_mm256_xor_si256(hi0, x[3]),
+            _mm256_set1_epi32((int) k1));
+        x[3] = lo0;
+        k0 += 0x9E3779B9U;
+        k1 += 0xBB67AE85U;
+    }
+}
+
+///
+/// @brief Threefry4x32-20 rounds, in five groups of four rounds followed by
+/// a key injection. The rotation constants are template arguments, so that
+/// the shifts take immediate counts.
+///
+template<int R>
+static inline __m256i StreamRotl(const __m256i x)
+{
+    return _mm256_or_si256(
+        _mm256_slli_epi32(x, R), _mm256_srli_epi32(x, 32 - R));
+}
+
+template<int R0, int R1>
+static inline void StreamMix(__m256i &a, __m256i &b, __m256i &c, __m256i &d)
+{
+    a = _mm256_add_epi32(a, b);
+    b = _mm256_xor_si256(StreamRotl<R0>(b), a);
+    c = _mm256_add_epi32(c, d);
+    d = _mm256_xor_si256(StreamRotl<R1>(d), c);
+}
+
+static inline void StreamThreefry(const RandomStream &stream, __m256i x[4])
+{
+    const uint32_t key[5] = {
+        stream.key[0],
+        stream.key[1],
+        0,
+        0,
+        0x1BD11BDAU ^ stream.key[0] ^ stream.key[1]};
+
+    for (size_t i = 0; i < 4; ++i) {
+        x[i] = _mm256_add_epi32(x[i], _mm256_set1_epi32((int) key[i]));
+    }
+    for (uint32_t s = 1; s <= 5; ++s) {
+        if (s % 2 == 1) {
+            StreamMix<10, 26>(x[0], x[1], x[2], x[3]);
+            StreamMix<11, 21>(x[0], x[3], x[2], x[1]);
+            StreamMix<13, 27>(x[0], x[1], x[2], x[3]);
+            StreamMix<23,  5>(x[0], x[3], x[2], x[1]);
+        } else {
+            StreamMix< 6, 20>(x[0], x[1], x[2], x[3]);
+            StreamMix<17, 11>(x[0], x[3], x[2], x[1]);
+            StreamMix<25, 10>(x[0], x[1], x[2], x[3]);
+            StreamMix<18, 20>(x[0], x[3], x[2], x[1]);
+        }
+        for (size_t i = 0; i < 4; ++i) {
+            x[i] = _mm256_add_epi32(
+                x[i], _mm256_set1_epi32((int) key[(s + i) % 5]));
+        }
+        x[3] = _mm256_add_epi32(x[3], _mm256_set1_epi32((int) s));
+    }
+}
+
+///
+/// @brief Fill an array with the blocks of random bits of the stream. The
+/// last partial step is stored through a buffer.
+///
+static inline void StreamNext(
+    const RandomStream &stream,
+    const uint64_t block,
+    __m256i x[4])
+{
+    StreamCounters(stream, block, x);
+    if (stream.generator == kRandomThreefry) {
+        StreamThreefry(stream, x);
+    } else {
+        StreamPhilox(stream, x);
+    }
+}
+
+static void RandomStreamBlocks(
+    const RandomStream &stream,
+    const uint64_t block,
+    uint32_t *dst,
+    const size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i x[4];
+        StreamNext(stream, block + i, x);
+        StreamStore(x, &dst[4*i]);
+    }
+
+    if (i < count) {
+        __m256i x[4];
+        uint32_t out[32];
+        StreamNext(stream, block + i, x);
+        StreamStore(x, out);
+        std::memcpy(&dst[4*i], out, 4 * (count - i) * sizeof(uint32_t));
+    }
+}
+
+/// ---- Matrix product kernels -----------------------------------------------
+///
+/// @brief Multiply the packed panels of a and b and accumulate the product
+/// into the tile of c. Each row of the tile is held in two registers, and each
+/// step broadcasts one element of a per row with two fused multiply-adds.
+///
+static void Gemmf(
+    const size_t depth,
+    const float *a,
+    const float *b,
+    float *c,
+    const size_t ldc)
+{
+    __m256 acc[kGemmRows][2];
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        acc[i][0] = _mm256_setzero_ps();
+        acc[i][1] = _mm256_setzero_ps();
+    }
+
+    for (size_t p = 0; p < depth; ++p) {
+        __m256 b0 = _mm256_loadu_ps(&b[p * kGemmColsf]);
+        __m256 b1 = _mm256_loadu_ps(&b[p * kGemmColsf + 8]);
+        for (size_t i = 0; i < kGemmRows; ++i) {
+            __m256 ai = _mm256_broadcast_ss(&a[p * kGemmRows + i]);
+            acc[i][0] = _mm256_fmadd_ps(ai, b0, acc[i][0]);
+            acc[i][1] = _mm256_fmadd_ps(ai, b1, acc[i][1]);
+        }
+    }
+
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        float *row = &c[i * ldc];
+        _mm256_storeu_ps(&row[0],
+            _mm256_add_ps(_mm256_loadu_ps(&row[0]), acc[i][0]));
+        _mm256_storeu_ps(&row[8],
+            _mm256_add_ps(_mm256_loadu_ps(&row[8]), acc[i][1]));
+    }
+}
+
+static void Gemmd(
+    const size_t depth,
+    const double *a,
+    const double *b,
+    double *c,
+    const size_t ldc)
+{
+    __m256d acc[kGemmRows][2];
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        acc[i][0] = _mm256_setzero_pd();
+        acc[i][1] = _mm256_setzero_pd();
+    }
+
+    for (size_t p = 0; p < depth; ++p) {
+        __m256d b0 = _mm256_loadu_pd(&b[p * kGemmColsd]);
+        __m256d b1 = _mm256_loadu_pd(&b[p * kGemmColsd + 4]);
+        for (size_t i = 0; i < kGemmRows; ++i) {
+            __m256d ai = _mm256_broadcast_sd(&a[p * kGemmRows + i]);
+            acc[i][0] = _mm256_fmadd_pd(ai, b0, acc[i][0]);
+            acc[i][1] = _mm256_fmadd_pd(ai, b1, acc[i][1]);
+        }
+    }
+
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        double *row = &c[i * ldc];
+        _mm256_storeu_pd(&row[0],
+            _mm256_add_pd(_mm256_loadu_pd(&row[0]), acc[i][0]));
+        _mm256_storeu_pd(&row[4],
+            _mm256_add_pd(_mm256_loadu_pd(&row[4]), acc[i][1]));
+    }
+}
+
+/// ---- AVX2 kernels ---------------------------------------------------------
+///
+static const Kernels kKernelsAvx2 = {
+    kIsaAvx2,
+    TransformVec4f,
+    TransformVec4d,
+    TransformMat4f,
+    TransformMat4d,
+    nullptr,            // transformVec3d
+    nullptr,            // dotMat4d
+    nullptr,            // determinantMat4d
+    nullptr,            // inverseMat4d
+    ConvertToHalf,
+    ConvertFromHalf,
+    ConvertToBFloat16,
+    ConvertFromBFloat16,
+    CellKeys,
+    RandomFill32,
+    RandomFill64,
+    RandomStreamBlocks,
+    Gemmf,
+    Gemmd,
+    CreateBatchKernels<float>(),
+    CreateBatchKernels<double>(),
+};
+
+const Kernels *GetKernelsAvx2() { return &kKernelsAvx2; }
+
+} // namespace Math
+
+#else  // __AVX2__ && __FMA__ && __F16C__
+
+namespace Math {
+const Kernels *GetKernelsAvx2() { return nullptr; }
+} // namespace Math
+
+#endif // __AVX2__ && __FMA__ && __F16C__
@@ -0,0 +1,987 @@
+//
+// kernels-avx512.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "kernels.h"
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__) && defined(__AVX512VL__)
+#include <cstring>
+#include <immintrin.h>
+
+namespace Math {
+
+/// ---- Single precision kernels ---------------------------------------------
+///
+/// @brief Transform an array of vectors by the matrix. A Vec4f is padded to
+/// 32 bytes, so a 512-bit load holds two vectors in lanes 0 and 2. Compact
+/// four vectors into one register, transform them with the matrix columns
+/// duplicated in each 128-bit lane and scatter them back with masked stores.
+///
+static void TransformVec4f(
+    const Mat4<float> &m,
+    const Vec4<float> *src,
+    Vec4<float> *dst,
+    const size_t count)
+{
+    __m128 c0 = _mm_load_ps(&m.data[0]);
+    __m128 c1 = _mm_load_ps(&m.data[4]);
+    __m128 c2 = _mm_load_ps(&m.data[8]);
+    __m128 c3 = _mm_load_ps(&m.data[12]);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    __m512 cc0 = _mm512_broadcast_f32x4(c0);
+    __m512 cc1 = _mm512_broadcast_f32x4(c1);
+    __m512 cc2 = _mm512_broadcast_f32x4(c2);
+    __m512 cc3 = _mm512_broadcast_f32x4(c3);
+
+    const __m512i pack = _mm512_setr_epi32(
+        0, 1, 2, 3, 8, 9, 10, 11, 16, 17, 18, 19, 24, 25, 26, 27);
+    const __m512i unpack_lo = _mm512_setr_epi32(
+        0, 1, 2, 3, 0, 0, 0, 0, 4, 5, 6, 7, 0, 0, 0, 0);
+    const __m512i unpack_hi = _mm512_setr_epi32(
+        8, 9, 10, 11, 0, 0, 0, 0, 12, 13, 14, 15, 0, 0, 0, 0);
+    const __mmask16 store_mask = 0x0f0f;
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m512 v = _mm512_permutex2var_ps(
+            _mm512_loadu_ps(src[i].data), pack,
+            _mm512_loadu_ps(src[i+2].data));
+        __m512 r = _mm512_mul_ps(cc0, _mm512_permute_ps(v, 0x00));
+        r = _mm512_fmadd_ps(cc1, _mm512_permute_ps(v, 0x55), r);
+        r = _mm512_fmadd_ps(cc2, _mm512_permute_ps(v, 0xaa), r);
+        r = _mm512_fmadd_ps(cc3, _mm512_permute_ps(v, 0xff), r);
+        _mm512_mask_storeu_ps(
+            dst[i].data, store_mask, _mm512_permutexvar_ps(unpack_lo, r));
+        _mm512_mask_storeu_ps(
+            dst[i+2].data, store_mask, _mm512_permutexvar_ps(unpack_hi, r));
+    }
+
+    for (; i < count; ++i) {
+        __m128 v = _mm_load_ps(src[i].data);
+        __m128 r = _mm_mul_ps(c0, _mm_permute_ps(v, 0x00));
+        r = _mm_fmadd_ps(c1, _mm_permute_ps(v, 0x55), r);
+        r = _mm_fmadd_ps(c2, _mm_permute_ps(v, 0xaa), r);
+        r = _mm_fmadd_ps(c3, _mm_permute_ps(v, 0xff), r);
+        _mm_store_ps(dst[i].data, r);
+    }
+}
+
+///
+/// @brief Transform an array of matrices by the matrix. A Mat4f fits in one
+/// 512-bit register with one row in each 128-bit lane. Each input row is
+/// duplicated in all lanes and weighted by the elements of the matrix rows.
+///
+static void TransformMat4f(
+    const Mat4<float> &m,
+    const Mat4<float> *src,
+    Mat4<float> *dst,
+    const size_t count)
+{
+    __m512 a = _mm512_loadu_ps(m.data);
+    __m512 p0 = _mm512_permute_ps(a, 0x00);
+    __m512 p1 = _mm512_permute_ps(a, 0x55);
+    __m512 p2 = _mm512_permute_ps(a, 0xaa);
+    __m512 p3 = _mm512_permute_ps(a, 0xff);
+
+    for (size_t i = 0; i < count; ++i) {
+        __m512 b0 = _mm512_broadcast_f32x4(_mm_load_ps(&src[i].data[0]));
+        __m512 b1 = _mm512_broadcast_f32x4(_mm_load_ps(&src[i].data[4]));
+        __m512 b2 = _mm512_broadcast_f32x4(_mm_load_ps(&src[i].data[8]));
+        __m512 b3 = _mm512_broadcast_f32x4(_mm_load_ps(&src[i].data[12]));
+        __m512 r = _mm512_mul_ps(p0, b0);
+        r = _mm512_fmadd_ps(p1, b1, r);
+        r = _mm512_fmadd_ps(p2, b2, r);
+        r = _mm512_fmadd_ps(p3, b3, r);
+        _mm512_storeu_ps(dst[i].data, r);
+    }
+}
+
+/// ---- Double precision kernels ---------------------------------------------
+///
+/// @brief Transform an array of vectors by the matrix. Process two vectors at
+/// once, one in each 256-bit half, with the matrix columns duplicated in both
+/// halves. The vector elements are broadcast within each half.
+///
+static void TransformVec4d(
+    const Mat4<double> &m,
+    const Vec4<double> *src,
+    Vec4<double> *dst,
+    const size_t count)
+{
+    __m256d c[4];
+    for (size_t k = 0; k < 4; ++k) {
+        c[k] = _mm256_set_pd(
+            m.data[12 + k], m.data[8 + k], m.data[4 + k], m.data[k]);
+    }
+
+    __m512d cc0 = _mm512_broadcast_f64x4(c[0]);
+    __m512d cc1 = _mm512_broadcast_f64x4(c[1]);
+    __m512d cc2 = _mm512_broadcast_f64x4(c[2]);
+    __m512d cc3 = _mm512_broadcast_f64x4(c[3]);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m512d v = _mm512_loadu_pd(src[i].data);
+        __m512d r = _mm512_mul_pd(cc0, _mm512_permutex_pd(v, 0x00));
+        r = _mm512_fmadd_pd(cc1, _mm512_permutex_pd(v, 0x55), r);
+        r = _mm512_fmadd_pd(cc2, _mm512_permutex_pd(v, 0xaa), r);
+        r = _mm512_fmadd_pd(cc3, _mm512_permutex_pd(v, 0xff), r);
+        _mm512_storeu_pd(dst[i].data, r);
+    }
+
+    for (; i < count; ++i) {
+        __m256d r = _mm256_mul_pd(c[0], _mm256_broadcast_sd(&src[i].data[0]));
+        r = _mm256_fmadd_pd(c[1], _mm256_broadcast_sd(&src[i].data[1]), r);
+        r = _mm256_fmadd_pd(c[2], _mm256_broadcast_sd(&src[i].data[2]), r);
+        r = _mm256_fmadd_pd(c[3], _mm256_broadcast_sd(&src[i].data[3]), r);
+        _mm256_store_pd(dst[i].data, r);
+    }
+}
+
+///
+/// @brief Transform an array of matrices by the matrix. Compute two output
+/// rows at once, one in each 256-bit half. The input rows are duplicated in
+/// both halves and weighted by the elements of the two matrix rows.
+///
+static void TransformMat4d(
+    const Mat4<double> &m,
+    const Mat4<double> *src,
+    Mat4<double> *dst,
+    const size_t count)
+{
+    __m512d a01 = _mm512_loadu_pd(&m.data[0]);
+    __m512d a23 = _mm512_loadu_pd(&m.data[8]);
+    __m512d p01[4] = {
+        _mm512_permutex_pd(a01, 0x00), _mm512_permutex_pd(a01, 0x55),
+        _mm512_permutex_pd(a01, 0xaa), _mm512_permutex_pd(a01, 0xff)};
+    __m512d p23[4] = {
+        _mm512_permutex_pd(a23, 0x00), _mm512_permutex_pd(a23, 0x55),
+        _mm512_permutex_pd(a23, 0xaa), _mm512_permutex_pd(a23, 0xff)};
+
+    for (size_t i = 0; i < count; ++i) {
+        __m512d b0 = _mm512_broadcast_f64x4(_mm256_load_pd(&src[i].data[0]));
+        __m512d b1 = _mm512_broadcast_f64x4(_mm256_load_pd(&src[i].data[4]));
+        __m512d b2 = _mm512_broadcast_f64x4(_mm256_load_pd(&src[i].data[8]));
+        __m512d b3 = _mm512_broadcast_f64x4(_mm256_load_pd(&src[i].data[12]));
+
+        __m512d r01 = _mm512_mul_pd(p01[0], b0);
+        r01 = _mm512_fmadd_pd(p01[1], b1, r01);
+        r01 = _mm512_fmadd_pd(p01[2], b2, r01);
+        r01 = _mm512_fmadd_pd(p01[3], b3, r01);
+
+        __m512d r23 = _mm512_mul_pd(p23[0], b0);
+        r23 = _mm512_fmadd_pd(p23[1], b1, r23);
+        r23 = _mm512_fmadd_pd(p23[2], b2, r23);
+        r23 = _mm512_fmadd_pd(p23[3], b3, r23);
+
+        _mm512_storeu_pd(&dst[i].data[0], r01);
+        _mm512_storeu_pd(&dst[i].data[8], r23);
+    }
+}
+
+///
+/// @brief Transform an array of points by the matrix. A Vec3d is padded to
+/// 32 bytes, so a 512-bit load holds two points. Load them with a mask that
+/// sets the padding element to the homogeneous coordinate and store them with
+/// the same mask, leaving the padding of the output untouched.
+///
+static void TransformVec3d(
+    const Mat4<double> &m,
+    const Vec3<double> *src,
+    Vec3<double> *dst,
+    const size_t count)
+{
+    __m256d c[4];
+    for (size_t k = 0; k < 4; ++k) {
+        c[k] = _mm256_set_pd(0.0, m.data[8 + k], m.data[4 + k], m.data[k]);
+    }
+
+    __m512d cc0 = _mm512_broadcast_f64x4(c[0]);
+    __m512d cc1 = _mm512_broadcast_f64x4(c[1]);
+    __m512d cc2 = _mm512_broadcast_f64x4(c[2]);
+    __m512d cc3 = _mm512_broadcast_f64x4(c[3]);
+
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __mmask8 mask = 0x77;
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m512d v = _mm512_mask_loadu_pd(one, mask, src[i].data);
+        __m512d r = _mm512_mul_pd(cc0, _mm512_permutex_pd(v, 0x00));
+        r = _mm512_fmadd_pd(cc1, _mm512_permutex_pd(v, 0x55), r);
+        r = _mm512_fmadd_pd(cc2, _mm512_permutex_pd(v, 0xaa), r);
+        r = _mm512_fmadd_pd(cc3, _mm512_permutex_pd(v, 0xff), r);
+        _mm512_mask_storeu_pd(dst[i].data, mask, r);
+    }
+
+    if (i < count) {
+        __m256d v = _mm256_mask_loadu_pd(
+            _mm256_set1_pd(1.0), 0x07, src[i].data);
+        __m256d r = _mm256_mul_pd(c[0], _mm256_permute4x64_pd(v, 0x00));
+        r = _mm256_fmadd_pd(c[1], _mm256_permute4x64_pd(v, 0x55), r);
+        r = _mm256_fmadd_pd(c[2], _mm256_permute4x64_pd(v, 0xaa), r);
+        r = _mm256_fmadd_pd(c[3], _mm256_permute4x64_pd(v, 0xff), r);
+        _mm256_mask_storeu_pd(dst[i].data, 0x07, r);
+    }
+}
+
+///
+/// @brief Multiply two arrays of matrices. Compute two output rows at once,
+/// one in each 256-bit half, as in the matrix transform kernel with a left
+/// matrix for each pair.
+///
+static void DotMat4d(
+    const Mat4<double> *a,
+    const Mat4<double> *b,
+    Mat4<double> *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        __m512d a01 = _mm512_loadu_pd(&a[i].data[0]);
+        __m512d a23 = _mm512_loadu_pd(&a[i].data[8]);
+
+        __m512d b0 = _mm512_broadcast_f64x4(_mm256_load_pd(&b[i].data[0]));
+        __m512d b1 = _mm512_broadcast_f64x4(_mm256_load_pd(&b[i].data[4]));
+        __m512d b2 = _mm512_broadcast_f64x4(_mm256_load_pd(&b[i].data[8]));
+        __m512d b3 = _mm512_broadcast_f64x4(_mm256_load_pd(&b[i].data[12]));
+
+        __m512d r01 = _mm512_mul_pd(_mm512_permutex_pd(a01, 0x00), b0);
+        r01 = _mm512_fmadd_pd(_mm512_permutex_pd(a01, 0x55), b1, r01);
+        r01 = _mm512_fmadd_pd(_mm512_permutex_pd(a01, 0xaa), b2, r01);
+        r01 = _mm512_fmadd_pd(_mm512_permutex_pd(a01, 0xff), b3, r01);
+
+        __m512d r23 = _mm512_mul_pd(_mm512_permutex_pd(a23, 0x00), b0);
+        r23 = _mm512_fmadd_pd(_mm512_permutex_pd(a23, 0x55), b1, r23);
+        r23 = _mm512_fmadd_pd(_mm512_permutex_pd(a23, 0xaa), b2, r23);
+        r23 = _mm512_fmadd_pd(_mm512_permutex_pd(a23, 0xff), b3, r23);
+
+        _mm512_storeu_pd(&dst[i].data[0], r01);
+        _mm512_storeu_pd(&dst[i].data[8], r23);
+    }
+}
+
+///
+/// @brief Transpose an 8x8 block of doubles held in eight registers.
+///
+static inline void Transpose8x8(__m512d r[8])
+{
+    __m512d t[8];
+    for (size_t k = 0; k < 4; ++k) {
+        t[2*k]     = _mm512_unpacklo_pd(r[2*k], r[2*k+1]);
+        t[2*k + 1] = _mm512_unpackhi_pd(r[2*k], r[2*k+1]);
+    }
+
+    __m512d u[8];
+    for (size_t k = 0; k < 2; ++k) {
+        u[4*k]     = _mm512_shuffle_f64x2(t[4*k],   t[4*k+2], 0x88);
+        u[4*k + 1] = _mm512_shuffle_f64x2(t[4*k+1], t[4*k+3], 0x88);
+        u[4*k + 2] = _mm512_shuffle_f64x2(t[4*k],   t[4*k+2], 0xdd);
+        u[4*k + 3] = _mm512_shuffle_f64x2(t[4*k+1], t[4*k+3], 0xdd);
+    }
+
+    for (size_t k = 0; k < 4; ++k) {
+        r[k]     = _mm512_shuffle_f64x2(u[k], u[k+4], 0x88);
+        r[k + 4] = _mm512_shuffle_f64x2(u[k], u[k+4], 0xdd);
+    }
+}
+
+///
+/// @brief Load eight matrices in structure of arrays layout, a[j] holds the
+/// j-th element of each matrix. Store them back in array of structures layout.
+///
+static inline void LoadMat4x8(const Mat4<double> *src, __m512d a[16])
+{
+    for (size_t k = 0; k < 8; ++k) {
+        a[k]     = _mm512_loadu_pd(&src[k].data[0]);
+        a[k + 8] = _mm512_loadu_pd(&src[k].data[8]);
+    }
+    Transpose8x8(&a[0]);
+    Transpose8x8(&a[8]);
+}
+
+static inline void StoreMat4x8(Mat4<double> *dst, __m512d a[16])
+{
+    Transpose8x8(&a[0]);
+    Transpose8x8(&a[8]);
+    for (size_t k = 0; k < 8; ++k) {
+        _mm512_storeu_pd(&dst[k].data[0], a[k]);
+        _mm512_storeu_pd(&dst[k].data[8], a[k + 8]);
+    }
+}
+
+///
+/// @brief Compute the 2x2 minors of the upper two rows and of the lower two
+/// rows of eight matrices in structure of arrays layout. The determinant and
+/// the adjugate are given by the Laplace expansion in terms of these minors.
+///
+static inline void Mat4x8Minors(const __m512d a[16], __m512d s[6], __m512d c[6])
+{
+    s[0] = _mm512_fmsub_pd(a[0], a[5], _mm512_mul_pd(a[4], a[1]));
+    s[1] = _mm512_fmsub_pd(a[0], a[6], _mm512_mul_pd(a[4], a[2]));
+    s[2] = _mm512_fmsub_pd(a[0], a[7], _mm512_mul_pd(a[4], a[3]));
+    s[3] = _mm512_fmsub_pd(a[1], a[6], _mm512_mul_pd(a[5], a[2]));
+    s[4] = _mm512_fmsub_pd(a[1], a[7], _mm512_mul_pd(a[5], a[3]));
+    s[5] = _mm512_fmsub_pd(a[2], a[7], _mm512_mul_pd(a[6], a[3]));
+
+    c[0] = _mm512_fmsub_pd(a[8],  a[13], _mm512_mul_pd(a[12], a[9]));
+    c[1] = _mm512_fmsub_pd(a[8],  a[14], _mm512_mul_pd(a[12], a[10]));
+    c[2] = _mm512_fmsub_pd(a[8],  a[15], _mm512_mul_pd(a[12], a[11]));
+    c[3] = _mm512_fmsub_pd(a[9],  a[14], _mm512_mul_pd(a[13], a[10]));
+    c[4] = _mm512_fmsub_pd(a[9],  a[15], _mm512_mul_pd(a[13], a[11]));
+    c[5] = _mm512_fmsub_pd(a[10], a[15], _mm512_mul_pd(a[14], a[11]));
+}
+
+static inline __m512d Mat4x8Determinant(const __m512d s[6], const __m512d c[6])
+{
+    __m512d det = _mm512_mul_pd(s[0], c[5]);
+    det = _mm512_fnmadd_pd(s[1], c[4], det);
+    det = _mm512_fmadd_pd(s[2], c[3], det);
+    det = _mm512_fmadd_pd(s[3], c[2], det);
+    det = _mm512_fnmadd_pd(s[4], c[1], det);
+    det = _mm512_fmadd_pd(s[5], c[0], det);
+    return det;
+}
+
+///
+/// @brief Return the alternating sums x*u - y*v + z*w and -x*u + y*v - z*w of
+/// the cofactor expansion.
+///
+static inline __m512d Mat4x8CofactorPos(
+    __m512d x, __m512d u, __m512d y, __m512d v, __m512d z, __m512d w)
+{
+    return _mm512_fmadd_pd(z, w, _mm512_fmsub_pd(x, u, _mm512_mul_pd(y, v)));
+}
+
+static inline __m512d Mat4x8CofactorNeg(
+    __m512d x, __m512d u, __m512d y, __m512d v, __m512d z, __m512d w)
+{
+    return _mm512_fnmadd_pd(x, u, _mm512_fmsub_pd(y, v, _mm512_mul_pd(z, w)));
+}
+
+///
+/// @brief Compute the determinant of each matrix in the array. Process eight
+/// matrices at once in structure of arrays layout, one matrix in each lane.
+/// The remaining matrices are copied to a zero padded block.
+///
+static void DeterminantMat4d(
+    const Mat4<double> *src,
+    double *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; i += 8) {
+        const size_t n = (count - i < 8) ? count - i : 8;
+
+        __m512d a[16];
+        if (n == 8) {
+            LoadMat4x8(&src[i], a);
+        } else {
+            Mat4<double> block[8] = {};
+            for (size_t k = 0; k < n; ++k) {
+                block[k] = src[i + k];
+            }
+            LoadMat4x8(block, a);
+        }
+
+        __m512d s[6], c[6];
+        Mat4x8Minors(a, s, c);
+        __m512d det = Mat4x8Determinant(s, c);
+        _mm512_mask_storeu_pd(&dst[i], (__mmask8) ((1u << n) - 1), det);
+    }
+}
+
+///
+/// @brief Compute the inverse of each matrix in the array from its adjugate
+/// and determinant. Process eight matrices at once in structure of arrays
+/// layout. The reciprocal of the determinant is masked with the nonzero
+/// determinants, so a singular matrix has a zero inverse without branching.
+///
+static void InverseMat4d(
+    const Mat4<double> *src,
+    Mat4<double> *dst,
+    const size_t count)
+{
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d one = _mm512_set1_pd(1.0);
+
+    for (size_t i = 0; i < count; i += 8) {
+        const size_t n = (count - i < 8) ? count - i : 8;
+
+        Mat4<double> block[8] = {};
+        __m512d a[16];
+        if (n == 8) {
+            LoadMat4x8(&src[i], a);
+        } else {
+            for (size_t k = 0; k < n; ++k) {
+                block[k] = src[i + k];
+            }
+            LoadMat4x8(block, a);
+        }
+
+        __m512d s[6], c[6];
+        Mat4x8Minors(a, s, c);
+        __m512d det = Mat4x8Determinant(s, c);
+        __mmask8 nonzero = _mm512_cmp_pd_mask(det, zero, _CMP_NEQ_OQ);
+        __m512d inv_det = _mm512_maskz_div_pd(nonzero, one, det);
+
+        __m512d b[16];
+        b[0]  = Mat4x8CofactorPos(a[5],  c[5], a[6],  c[4], a[7],  c[3]);
+        b[1]  = Mat4x8CofactorNeg(a[1],  c[5], a[2],  c[4], a[3],  c[3]);
+        b[2]  = Mat4x8CofactorPos(a[13], s[5], a[14], s[4], a[15], s[3]);
+        b[3]  = Mat4x8CofactorNeg(a[9],  s[5], a[10], s[4], a[11], s[3]);
+
+        b[4]  = Mat4x8CofactorNeg(a[4],  c[5], a[6],  c[2], a[7],  c[1]);
+        b[5]  = Mat4x8CofactorPos(a[0],  c[5], a[2],  c[2], a[3],  c[1]);
+        b[6]  = Mat4x8CofactorNeg(a[12], s[5], a[14], s[2], a[15], s[1]);
+        b[7]  = Mat4x8CofactorPos(a[8],  s[5], a[10], s[2], a[11], s[1]);
+
+        b[8]  = Mat4x8CofactorPos(a[4],  c[4], a[5],  c[2], a[7],  c[0]);
+        b[9]  = Mat4x8CofactorNeg(a[0],  c[4], a[1],  c[2], a[3],  c[0]);
+        b[10] = Mat4x8CofactorPos(a[12], s[4], a[13], s[2], a[15], s[0]);
+        b[11] = Mat4x8CofactorNeg(a[8],  s[4], a[9],  s[2], a[11], s[0]);
+
+        b[12] = Mat4x8CofactorNeg(a[4],  c[3], a[5],  c[1], a[6],  c[0]);
+        b[13] = Mat4x8CofactorPos(a[0],  c[3], a[1],  c[1], a[2],  c[0]);
+        b[14] = Mat4x8CofactorNeg(a[12], s[3], a[13], s[1], a[14], s[0]);
+        b[15] = Mat4x8CofactorPos(a[8],  s[3], a[9],  s[1], a[10], s[0]);
+
+        for (size_t j = 0; j < 16; ++j) {
+            b[j] = _mm512_mul_pd(b[j], inv_det);
+        }
+
+        if (n == 8) {
+            StoreMat4x8(&dst[i], b);
+        } else {
+            StoreMat4x8(block, b);
+            for (size_t k = 0; k < n; ++k) {
+                dst[i + k] = block[k];
+            }
+        }
+    }
+}
+
+/// ---- Half precision kernels -----------------------------------------------
+///
+/// @brief Convert blocks of 16 floats to half, rounding to nearest even. The
+/// last partial block is converted through a zero padded buffer.
+///
+static inline void ConvertToHalfBlock(const float *src, Half *dst)
+{
+    __m512 v = _mm512_loadu_ps(src);
+    _mm256_storeu_si256((__m256i *) dst,
+        _mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+static void ConvertToHalf(const float *src, Half *dst, const size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        ConvertToHalfBlock(&src[i], &dst[i]);
+    }
+
+    if (i < count) {
+        float in[16] = {};
+        Half out[16];
+        std::memcpy(in, &src[i], (count - i) * sizeof(float));
+        ConvertToHalfBlock(in, out);
+        std::memcpy(&dst[i], out, (count - i) * sizeof(Half));
+    }
+}
+
+///
+/// @brief Convert blocks of 16 halfs to float.
+///
+static inline void ConvertFromHalfBlock(const Half *src, float *dst)
+{
+    __m256i v = _mm256_loadu_si256((const __m256i *) src);
+    _mm512_storeu_ps(dst, _mm512_cvtph_ps(v));
+}
+
+static void ConvertFromHalf(const Half *src, float *dst, const size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        ConvertFromHalfBlock(&src[i], &dst[i]);
+    }
+
+    if (i < count) {
+        Half in[16] = {};
+        float out[16];
+        std::memcpy(in, &src[i], (count - i) * sizeof(Half));
+        ConvertFromHalfBlock(in, out);
+        std::memcpy(&dst[i], out, (count - i) * sizeof(float));
+    }
+}
+
+///
+/// @brief Convert blocks of 16 floats to bfloat16. Round the upper 16 bits to
+/// nearest even, quiet the NaNs under a compare mask and narrow the 32-bit
+/// lanes to 16-bit lanes.
+///
+static inline void ConvertToBFloat16Block(const float *src, BFloat16 *dst)
+{
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i round = _mm512_set1_epi32(0x7fff);
+    const __m512i quiet = _mm512_set1_epi32(0x40);
+
+    __m512 v = _mm512_loadu_ps(src);
+    __m512i x = _mm512_castps_si512(v);
+    __m512i hi = _mm512_srli_epi32(x, 16);
+    __m512i r = _mm512_add_epi32(x, round);
+    r = _mm512_add_epi32(r, _mm512_and_si512(hi, one));
+    r = _mm512_srli_epi32(r, 16);
+
+    __mmask16 nan = _mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q);
+    r = _mm512_mask_mov_epi32(r, nan, _mm512_or_si512(hi, quiet));
+    _mm256_storeu_si256((__m256i *) dst, _mm512_cvtepi32_epi16(r));
+}
+
+static void ConvertToBFloat16(
+    const float *src,
+    BFloat16 *dst,
+    const size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        ConvertToBFloat16Block(&src[i], &dst[i]);
+    }
+
+    if (i < count) {
+        float in[16] = {};
+        BFloat16 out[16];
+        std::memcpy(in, &src[i], (count - i) * sizeof(float));
+        ConvertToBFloat16Block(in, out);
+        std::memcpy(&dst[i], out, (count - i) * sizeof(BFloat16));
+    }
+}
+
+///
+/// @brief Convert blocks of 16 bfloat16 to float, by widening the 16-bit lanes
+/// and shifting them into the upper half of the 32-bit lanes.
+///
+static inline void ConvertFromBFloat16Block(const BFloat16 *src, float *dst)
+{
+    __m256i v = _mm256_loadu_si256((const __m256i *) src);
+    __m512i x = _mm512_slli_epi32(_mm512_cvtepu16_epi32(v), 16);
+    _mm512_storeu_ps(dst, _mm512_castsi512_ps(x));
+}
+
+static void ConvertFromBFloat16(
+    const BFloat16 *src,
+    float *dst,
+    const size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        ConvertFromBFloat16Block(&src[i], &dst[i]);
+    }
+
+    if (i < count) {
+        BFloat16 in[16] = {};
+        float out[16];
+        std::memcpy(in, &src[i], (count - i) * sizeof(BFloat16));
+        ConvertFromBFloat16Block(in, out);
+        std::memcpy(&dst[i], out, (count - i) * sizeof(float));
+    }
+}
+
+/// ---- Random number kernels ------------------------------------------------
+///
+/// @brief Random number generator lanes in registers, one register of 8
+/// 64-bit lanes per generator. The multiply-with-carry state of a lane is
+/// held as z | c << 32, so that the next state z * m + c is one 32-bit
+/// product and one add. The linear congruential product uses the AVX-512DQ
+/// 64-bit multiply.
+///
+struct RandomLanesAvx512 {
+    __m512i x;
+    __m512i y;
+    __m512i w1;
+    __m512i w2;
+};
+
+static inline void RandomLoad(const RandomLanes &lanes, RandomLanesAvx512 &r)
+{
+    r.x = _mm512_loadu_si512(lanes.x);
+    r.y = _mm512_loadu_si512(lanes.y);
+    r.w1 = _mm512_or_si512(
+        _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i *) lanes.z1)),
+        _mm512_slli_epi64(_mm512_cvtepu32_epi64(
+            _mm256_loadu_si256((const __m256i *) lanes.c1)), 32));
+    r.w2 = _mm512_or_si512(
+        _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i *) lanes.z2)),
+        _mm512_slli_epi64(_mm512_cvtepu32_epi64(
+            _mm256_loadu_si256((const __m256i *) lanes.c2)), 32));
+}
+
+static inline void RandomStore(const RandomLanesAvx512 &r, RandomLanes &lanes)
+{
+    _mm512_storeu_si512(lanes.x, r.x);
+    _mm512_storeu_si512(lanes.y, r.y);
+    _mm256_storeu_si256((__m256i *) lanes.z1, _mm512_cvtepi64_epi32(r.w1));
+    _mm256_storeu_si256((__m256i *) lanes.c1,
+        _mm512_cvtepi64_epi32(_mm512_srli_epi64(r.w1, 32)));
+    _mm256_storeu_si256((__m256i *) lanes.z2, _mm512_cvtepi64_epi32(r.w2));
+    _mm256_storeu_si256((__m256i *) lanes.c2,
+        _mm512_cvtepi64_epi32(_mm512_srli_epi64(r.w2, 32)));
+}
+
+///
+/// @brief Advance the generators of all lanes by one step. The second
+/// multiply-with-carry generator is only advanced by the 64-bit step.
+///
+static inline void RandomStep(RandomLanesAvx512 &r, const bool step64)
+{
+    const __m512i m1 = _mm512_set1_epi64(1490024343005336237ULL);
+    const __m512i m2 = _mm512_set1_epi64(123456789ULL);
+    const __m512i m3 = _mm512_set1_epi64(4294584393ULL);
+    const __m512i m4 = _mm512_set1_epi64(4246477509ULL);
+
+    r.x = _mm512_add_epi64(_mm512_mullo_epi64(r.x, m1), m2);
+
+    r.y = _mm512_xor_si512(r.y, _mm512_slli_epi64(r.y, 21));
+    r.y = _mm512_xor_si512(r.y, _mm512_srli_epi64(r.y, 17));
+    r.y = _mm512_xor_si512(r.y, _mm512_slli_epi64(r.y, 30));
+
+    r.w1 = _mm512_add_epi64(
+        _mm512_mul_epu32(r.w1, m3), _mm512_srli_epi64(r.w1, 32));
+    if (step64) {
+        r.w2 = _mm512_add_epi64(
+            _mm512_mul_epu32(r.w2, m4), _mm512_srli_epi64(r.w2, 32));
+    }
+}
+
+///
+/// @brief Fill an array with the 32-bit numbers of the lanes, 8 numbers per
+/// step, (x >> 32) + y + z1 in the low 32 bits of each 64-bit lane. The last
+/// partial step is stored through a buffer.
+///
+static inline __m256i RandomNext32(RandomLanesAvx512 &r)
+{
+    RandomStep(r, false);
+    __m512i v = _mm512_add_epi64(
+        _mm512_add_epi64(_mm512_srli_epi64(r.x, 32), r.y), r.w1);
+    return _mm512_cvtepi64_epi32(v);
+}
+
+static void RandomFill32(RandomLanes &lanes, uint32_t *dst, const size_t count)
+{
+    RandomLanesAvx512 r;
+    RandomLoad(lanes, r);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256((__m256i *) &dst[i], RandomNext32(r));
+    }
+
+    if (i < count) {
+        uint32_t out[8];
+        _mm256_storeu_si256((__m256i *) out, RandomNext32(r));
+        std::memcpy(&dst[i], out, (count - i) * sizeof(uint32_t));
+    }
+    RandomStore(r, lanes);
+}
+
+///
+/// @brief Fill an array with the 64-bit numbers of the lanes, 8 numbers per
+/// step, x + y + z1 + (z2 << 32).
+///
+static inline __m512i RandomNext64(RandomLanesAvx512 &r)
+{
+    const __m512i mask = _mm512_set1_epi64(0xffffffff);
+    RandomStep(r, true);
+    __m512i z = _mm512_add_epi64(
+        _mm512_and_si512(r.w1, mask), _mm512_slli_epi64(r.w2, 32));
+    return _mm512_add_epi64(_mm512_add_epi64(r.x, r.y), z);
+}
+
+static void RandomFill64(RandomLanes &lanes, uint64_t *dst, const size_t count)
+{
+    RandomLanesAvx512 r;
+    RandomLoad(lanes, r);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_si512(&dst[i], RandomNext64(r));
+    }
+
+    if (i < count) {
+        uint64_t out[8];
+        _mm512_storeu_si512(out, RandomNext64(r));
+        std::memcpy(&dst[i], out, (count - i) * sizeof(uint64_t));
+    }
+    RandomStore(r, lanes);
+}
+
+/// ---- Random stream kernels ------------------------------------------------
+///
+/// @brief Counter-based random streams evaluate 16 blocks per step, with the
+/// counters in structure of arrays layout, one register per counter word.
+///
+static inline void StreamCounters(
+    const RandomStream &stream,
+    const uint64_t block,
+    __m512i x[4])
+{
+    const __m512i base = _mm512_set1_epi64((long long) block);
+    __m512i b0 = _mm512_add_epi64(
+        base, _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7));
+    __m512i b1 = _mm512_add_epi64(
+        base, _mm512_setr_epi64(8, 9, 10, 11, 12, 13, 14, 15));
+    x[0] = _mm512_inserti64x4(_mm512_castsi256_si512(
+        _mm512_cvtepi64_epi32(b0)), _mm512_cvtepi64_epi32(b1), 1);
+    x[1] = _mm512_inserti64x4(_mm512_castsi256_si512(
+        _mm512_cvtepi64_epi32(_mm512_srli_epi64(b0, 32))),
+        _mm512_cvtepi64_epi32(_mm512_srli_epi64(b1, 32)), 1);
+    x[2] = _mm512_set1_epi32((int) stream.stream[0]);
+    x[3] = _mm512_set1_epi32((int) stream.stream[1]);
+}
+
+///
+/// @brief Store the blocks of the counter words in array of structures
+/// layout. The unpacks transpose the blocks within each 128-bit lane, and
+/// the lane shuffles put the 128-bit blocks in order.
+///
+static inline void StreamStore(const __m512i x[4], uint32_t *dst)
+{
+    __m512i t0 = _mm512_unpacklo_epi32(x[0], x[1]);
+    __m512i t1 = _mm512_unpackhi_epi32(x[0], x[1]);
+    __m512i t2 = _mm512_unpacklo_epi32(x[2], x[3]);
+    __m512i t3 = _mm512_unpackhi_epi32(x[2], x[3]);
+    __m512i u0 = _mm512_unpacklo_epi64(t0, t2);     // blocks 0, 4, 8, 12
+    __m512i u1 = _mm512_unpackhi_epi64(t0, t2);     // blocks 1, 5, 9, 13
+    __m512i u2 = _mm512_unpacklo_epi64(t1, t3);     // blocks 2, 6, 10, 14
+    __m512i u3 = _mm512_unpackhi_epi64(t1, t3);     // blocks 3, 7, 11, 15
+    __m512i v0 = _mm512_shuffle_i32x4(u0, u1, 0x44);
+    __m512i v1 = _mm512_shuffle_i32x4(u2, u3, 0x44);
+    __m512i v2 = _mm512_shuffle_i32x4(u0, u1, 0xee);
+    __m512i v3 = _mm512_shuffle_i32x4(u2, u3, 0xee);
+    _mm512_storeu_si512(&dst[0], _mm512_shuffle_i32x4(v0, v1, 0x88));
+    _mm512_storeu_si512(&dst[16], _mm512_shuffle_i32x4(v0, v1, 0xdd));
+    _mm512_storeu_si512(&dst[32], _mm512_shuffle_i32x4(v2, v3, 0x88));
+    _mm512_storeu_si512(&dst[48], _mm512_shuffle_i32x4(v2, v3, 0xdd));
+}
+
+///
+/// @brief Philox4x32-10 rounds. The 32x32-bit products of the even and the
+/// odd lanes are computed separately and merged into their high and low
+/// words.
+///
+static inline void StreamMulHiLo(
+    const __m512i a,
+    const __m512i m,
+    __m512i &hi,
+    __m512i &lo)
+{
+    __m512i even = _mm512_mul_epu32(a, m);
+    __m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), m);
+    lo = _mm512_mask_blend_epi32(0xaaaa, even, _mm512_slli_epi64(odd, 32));
+    hi = _mm512_mask_blend_epi32(0xaaaa, _mm512_srli_epi64(even, 32), odd);
+}
+
+static inline void StreamPhilox(const RandomStream &stream, __m512i x[4])
+{
+    const __m512i m0 = _mm512_set1_epi32((int) 0xD2511F53U);
+    const __m512i m1 = _mm512_set1_epi32((int) 0xCD9E8D57U);
+    uint32_t k0 = stream.key[0];
+    uint32_t k1 = stream.key[1];
+    for (size_t round = 0; round < 10; ++round) {
+        __m512i hi0, lo0, hi1, lo1;
+        StreamMulHiLo(x[0], m0, hi0, lo0);
+        StreamMulHiLo(x[2], m1, hi1, lo1);
+        x[0] = _mm512_xor_si512(_mm512_xor_si512(hi1, x[1]),
+            _mm512_set1_epi32((int) k0));
+        x[1] = lo1;
+        x[2] = _mm512_xor_si512(_mm512_xor_si512(hi0, x[3]),
+            _mm512_set1_epi32((int) k1));
+        x[3] = lo0;
+        k0 += 0x9E3779B9U;
+        k1 += 0xBB67AE85U;
+    }
+}
+
+///
+/// @brief Threefry4x32-20 rounds, in five groups of four rounds followed by
+/// a key injection, with the AVX-512 rotate instructions.
+///
+template<int R0, int R1>
+static inline void StreamMix(__m512i &a, __m512i &b, __m512i &c, __m512i &d)
+{
+    a = _mm512_add_epi32(a, b);
+    b = _mm512_xor_si512(_mm512_rol_epi32(b, R0), a);
+    c = _mm512_add_epi32(c, d);
+    d = _mm512_xor_si512(_mm512_rol_epi32(d, R1), c);
+}
+
+static inline void StreamThreefry(const RandomStream &stream, __m512i x[4])
+{
+    const uint32_t key[5] = {
+        stream.key[0],
+        stream.key[1],
+        0,
+        0,
+        0x1BD11BDAU ^ stream.key[0] ^ stream.key[1]};
+
+    for (size_t i = 0; i < 4; ++i) {
+        x[i] = _mm512_add_epi32(x[i], _mm512_set1_epi32((int) key[i]));
+    }
+    for (uint32_t s = 1; s <= 5; ++s) {
+        if (s % 2 == 1) {
+            StreamMix<10, 26>(x[0], x[1], x[2], x[3]);
+            StreamMix<11, 21>(x[0], x[3], x[2], x[1]);
+            StreamMix<13, 27>(x[0], x[1], x[2], x[3]);
+            StreamMix<23,  5>(x[0], x[3], x[2], x[1]);
+        } else {
+            StreamMix< 6, 20>(x[0], x[1], x[2], x[3]);
+            StreamMix<17, 11>(x[0], x[3], x[2], x[1]);
+            StreamMix<25, 10>(x[0], x[1], x[2], x[3]);
+            StreamMix<18, 20>(x[0], x[3], x[2], x[1]);
+        }
+        for (size_t i = 0; i < 4; ++i) {
+            x[i] = _mm512_add_epi32(
+                x[i], _mm512_set1_epi32((int) key[(s + i) % 5]));
+        }
+        x[3] = _mm512_add_epi32(x[3], _mm512_set1_epi32((int) s));
+    }
+}
+
+///
+/// @brief Fill an array with the blocks of random bits of the stream. The
+/// last partial step is stored through a buffer.
+///
+static inline void StreamNext(
+    const RandomStream &stream,
+    const uint64_t block,
+    __m512i x[4])
+{
+    StreamCounters(stream, block, x);
+    if (stream.generator == kRandomThreefry) {
+        StreamThreefry(stream, x);
+    } else {
+        StreamPhilox(stream, x);
+    }
+}
+
+static void RandomStreamBlocks(
+    const RandomStream &stream,
+    const uint64_t block,
+    uint32_t *dst,
+    const size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512i x[4];
+        StreamNext(stream, block + i, x);
+        StreamStore(x, &dst[4*i]);
+    }
+
+    if (i < count) {
+        __m512i x[4];
+        uint32_t out[64];
+        StreamNext(stream, block + i, x);
+        StreamStore(x, out);
+        std::memcpy(&dst[4*i], out, 4 * (count - i) * sizeof(uint32_t));
+    }
+}
+
+/// ---- Matrix product kernels -----------------------------------------------
+///
+/// @brief Multiply the packed panels of a and b and accumulate the product
+/// into the tile of c. Each row of the tile is held in one 512-bit register,
+/// and each step broadcasts one element of a per row with one fused
+/// multiply-add.
+///
+static void Gemmf(
+    const size_t depth,
+    const float *a,
+    const float *b,
+    float *c,
+    const size_t ldc)
+{
+    __m512 acc[kGemmRows];
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        acc[i] = _mm512_setzero_ps();
+    }
+
+    for (size_t p = 0; p < depth; ++p) {
+        __m512 b0 = _mm512_loadu_ps(&b[p * kGemmColsf]);
+        for (size_t i = 0; i < kGemmRows; ++i) {
+            __m512 ai = _mm512_set1_ps(a[p * kGemmRows + i]);
+            acc[i] = _mm512_fmadd_ps(ai, b0, acc[i]);
+        }
+    }
+
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        float *row = &c[i * ldc];
+        _mm512_storeu_ps(row, _mm512_add_ps(_mm512_loadu_ps(row), acc[i]));
+    }
+}
+
+static void Gemmd(
+    const size_t depth,
+    const double *a,
+    const double *b,
+    double *c,
+    const size_t ldc)
+{
+    __m512d acc[kGemmRows];
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        acc[i] = _mm512_setzero_pd();
+    }
+
+    for (size_t p = 0; p < depth; ++p) {
+        __m512d b0 = _mm512_loadu_pd(&b[p * kGemmColsd]);
+        for (size_t i = 0; i < kGemmRows; ++i) {
+            __m512d ai = _mm512_set1_pd(a[p * kGemmRows + i]);
+            acc[i] = _mm512_fmadd_pd(ai, b0, acc[i]);
+        }
+    }
+
+    for (size_t i = 0; i < kGemmRows; ++i) {
+        double *row = &c[i * ldc];
+        _mm512_storeu_pd(row, _mm512_add_pd(_mm512_loadu_pd(row), acc[i]));
+    }
+}
+
+/// ---- AVX-512 kernels ------------------------------------------------------
+///
+static const Kernels kKernelsAvx512 = {
+    kIsaAvx512,
+    TransformVec4f,
+    TransformVec4d,
+    TransformMat4f,
+    TransformMat4d,
+    TransformVec3d,
+    DotMat4d,
+    DeterminantMat4d,
+    InverseMat4d,
+    ConvertToHalf,
+    ConvertFromHalf,
+    ConvertToBFloat16,
+    ConvertFromBFloat16,
+    nullptr,            // cellKeys
+    RandomFill32,
+    RandomFill64,
+    RandomStreamBlocks,
+    Gemmf,
+    Gemmd,
+    {},                 // batchf
+    {},                 // batchd
+};
+
+const Kernels *GetKernelsAvx512() { return &kKernelsAvx512; }
+
+} // namespace Math
+
+#else  // __AVX512F__ && __AVX512DQ__ && __AVX512VL__
+
+namespace Math {
+const Kernels *GetKernelsAvx512() { return nullptr; }
+} // namespace Math
+
+#endif // __AVX512F__ && __AVX512DQ__ && __AVX512VL__
@@ -0,0 +1,689 @@
+//
+// kernels-batch.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_SIMD_KERNELS_BATCH_H_
+#define MATH_SIMD_KERNELS_BATCH_H_
+
+#include <algorithm>
+#include <limits>
+#include "../fastmath.h"
+#include "../packed.h"
+#include "../packet.h"
+#include "kernels.h"
+
+namespace Math {
+
+///
+/// @brief Batch kernels process the arrays in packets of 4 doubles or 8 floats,
+/// in structure of arrays layout. Each instruction set level that provides
+/// them includes this file, and compiles the kernels with the packet functions
+/// of its own instruction set, avx registers in the avx and avx2 levels and
+/// the generic packet arrays in the scalar level. The library is compiled for
+/// the baseline instruction set regardless of ENABLE_AVX.
+/// The kernels have internal linkage, and the packet functions they call are
+/// in the inline namespace of the instruction set, see simd/isa.h. They only
+/// use the vector and matrix data layout, as the other kernels do.
+///
+/// Each kernel prefetches its input a number of items ahead of the current
+/// packet.
+///
+static const size_t kBatchPrefetchItems = 16;
+
+///
+/// @brief Packet width of the element type, 4 doubles or 8 floats.
+///
+template<typename T>
+struct BatchLanes {
+    static const size_t width = 32 / sizeof(T);
+};
+
+template<typename T>
+using BatchPacket = Packet<T, BatchLanes<T>::width>;
+
+template<typename T>
+using BatchVec3Packet = Vec3Packet<T, BatchLanes<T>::width>;
+
+///
+/// @brief Return the minimum and maximum of two scalars, with the semantics of
+/// std::min and std::max. The kernels do not call the std functions, whose
+/// out-of-line copies would be shared with the other translation units.
+///
+template<typename T>
+static inline T BatchMin(const T a, const T b) { return (b < a) ? b : a; }
+
+template<typename T>
+static inline T BatchMax(const T a, const T b) { return (a < b) ? b : a; }
+
+///
+/// @brief Prefetch the cache lines of the items ahead of the current packet.
+///
+template<typename T, template<typename> class V>
+static inline void BatchPrefetch(
+    const V<T> *src,
+    const size_t i,
+    const size_t count)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    const size_t ahead = i + kBatchPrefetchItems;
+    if (ahead < count) {
+        const char *begin = reinterpret_cast<const char *>(src + ahead);
+        const char *end = reinterpret_cast<const char *>(
+            src + BatchMin(ahead + BatchLanes<T>::width, count));
+        for (const char *line = begin; line < end; line += 64) {
+            __builtin_prefetch(line, 0, 3);
+        }
+    }
+#endif
+}
+
+/// ---- Vector batch kernels -------------------------------------------------
+///
+/// @brief Transform the points by the affine part of the matrix, broadcasting
+/// the matrix elements into packets once per call.
+///
+template<typename T, template<typename> class V>
+static void BatchTransform(
+    const Mat4<T> &m,
+    const V<T> *src,
+    V<T> *dst,
+    const size_t count)
+{
+    const size_t width = BatchLanes<T>::width;
+    BatchPacket<T> a[12];
+    for (size_t k = 0; k < 12; ++k) {
+        a[k] = Broadcast<T, width>(m.data[k]);
+    }
+
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+        BatchPrefetch(src, i, count);
+
+        BatchVec3Packet<T> p;
+        Load(p, src + i, n);
+        BatchVec3Packet<T> r;
+        r.x = MulAdd(a[0], p.x, MulAdd(a[1], p.y, MulAdd(a[2], p.z, a[3])));
+        r.y = MulAdd(a[4], p.x, MulAdd(a[5], p.y, MulAdd(a[6], p.z, a[7])));
+        r.z = MulAdd(a[8], p.x, MulAdd(a[9], p.y, MulAdd(a[10], p.z, a[11])));
+        Store(r, dst + i, n);
+    }
+}
+
+///
+/// @brief Rotate the vectors by the rotation matrix of a unit quaternion,
+/// 9 multiply-adds per vector instead of the two cross products of
+/// Rotate(q, v).
+///
+template<typename T, template<typename> class V>
+static void BatchRotate(
+    const Mat3<T> &m,
+    const V<T> *src,
+    V<T> *dst,
+    const size_t count)
+{
+    const size_t width = BatchLanes<T>::width;
+    BatchPacket<T> a[9];
+    for (size_t k = 0; k < 9; ++k) {
+        a[k] = Broadcast<T, width>(m.data[k]);
+    }
+
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+        BatchPrefetch(src, i, count);
+
+        BatchVec3Packet<T> p;
+        Load(p, src + i, n);
+        BatchVec3Packet<T> r;
+        r.x = MulAdd(a[0], p.x, MulAdd(a[1], p.y, a[2] * p.z));
+        r.y = MulAdd(a[3], p.x, MulAdd(a[4], p.y, a[5] * p.z));
+        r.z = MulAdd(a[6], p.x, MulAdd(a[7], p.y, a[8] * p.z));
+        Store(r, dst + i, n);
+    }
+}
+
+template<typename T, template<typename> class V>
+static void BatchNormalize(
+    const V<T> *src,
+    V<T> *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+        BatchPrefetch(src, i, count);
+
+        BatchVec3Packet<T> p;
+        Load(p, src + i, n);
+        if (accuracy == kAccuracyFast) {
+            Store(Normalize(p, accuracy), dst + i, n);
+        } else {
+            Store(Normalize(p), dst + i, n);
+        }
+    }
+}
+
+template<typename T>
+static void BatchDot(
+    const Vec3<T> *a,
+    const Vec3<T> *b,
+    T *dst,
+    const size_t count)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+        BatchPrefetch(a, i, count);
+        BatchPrefetch(b, i, count);
+
+        BatchVec3Packet<T> pa, pb;
+        Load(pa, a + i, n);
+        Load(pb, b + i, n);
+        Store(Dot(pa, pb), dst + i, n);
+    }
+}
+
+template<typename T>
+static void BatchCross(
+    const Vec3<T> *a,
+    const Vec3<T> *b,
+    Vec3<T> *dst,
+    const size_t count)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+        BatchPrefetch(a, i, count);
+        BatchPrefetch(b, i, count);
+
+        BatchVec3Packet<T> pa, pb;
+        Load(pa, a + i, n);
+        Load(pb, b + i, n);
+        Store(Cross(pa, pb), dst + i, n);
+    }
+}
+
+template<typename T>
+static void BatchDistance(
+    const Vec3<T> *a,
+    const Vec3<T> *b,
+    T *dst,
+    const size_t count)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+        BatchPrefetch(a, i, count);
+        BatchPrefetch(b, i, count);
+
+        BatchVec3Packet<T> pa, pb;
+        Load(pa, a + i, n);
+        Load(pb, b + i, n);
+        Store(Distance(pa, pb), dst + i, n);
+    }
+}
+
+///
+/// @brief Compute the bounding box with packet min and max over the full
+/// packets, and reduce the lanes and the remaining items element by element.
+///
+template<typename T, template<typename> class V>
+static void BatchAabb(
+    const V<T> *points,
+    const size_t count,
+    Vec3<T> &lo,
+    Vec3<T> &hi)
+{
+    const size_t width = BatchLanes<T>::width;
+    constexpr T inf = std::numeric_limits<T>::infinity();
+
+    BatchVec3Packet<T> plo = Broadcast<T, width>(Vec3<T>{inf, inf, inf});
+    BatchVec3Packet<T> phi = Broadcast<T, width>(Vec3<T>{-inf, -inf, -inf});
+    size_t i = 0;
+    for (; i + width <= count; i += width) {
+        BatchPrefetch(points, i, count);
+
+        BatchVec3Packet<T> p;
+        Load(p, points + i);
+        plo = Min(plo, p);
+        phi = Max(phi, p);
+    }
+
+    T blo[3] = {inf, inf, inf};
+    T bhi[3] = {-inf, -inf, -inf};
+    for (size_t k = 0; k < width; ++k) {
+        blo[0] = BatchMin(blo[0], plo.x[k]);
+        blo[1] = BatchMin(blo[1], plo.y[k]);
+        blo[2] = BatchMin(blo[2], plo.z[k]);
+        bhi[0] = BatchMax(bhi[0], phi.x[k]);
+        bhi[1] = BatchMax(bhi[1], phi.y[k]);
+        bhi[2] = BatchMax(bhi[2], phi.z[k]);
+    }
+    for (; i < count; ++i) {
+        blo[0] = BatchMin(blo[0], points[i].x);
+        blo[1] = BatchMin(blo[1], points[i].y);
+        blo[2] = BatchMin(blo[2], points[i].z);
+        bhi[0] = BatchMax(bhi[0], points[i].x);
+        bhi[1] = BatchMax(bhi[1], points[i].y);
+        bhi[2] = BatchMax(bhi[2], points[i].z);
+    }
+    lo = Vec3<T>{blo[0], blo[1], blo[2]};
+    hi = Vec3<T>{bhi[0], bhi[1], bhi[2]};
+}
+
+/// ---- Fast math batch kernels ----------------------------------------------
+///
+/// @brief Apply a packet function to the elements of a scalar array. The
+/// function is a functor of the packet of elements.
+///
+template<typename T, typename Fn>
+static inline void BatchUnary(
+    const T *src,
+    T *dst,
+    const size_t count,
+    Fn fn)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+
+        BatchPacket<T> p;
+        Load(p, src + i, n);
+        Store(fn(p), dst + i, n);
+    }
+}
+
+template<typename T>
+static void BatchRsqrt(
+    const T *src,
+    T *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    BatchUnary(src, dst, count, [accuracy](const BatchPacket<T> &p) {
+        return Rsqrt(p, accuracy);
+    });
+}
+
+template<typename T>
+static void BatchExp(
+    const T *src,
+    T *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    BatchUnary(src, dst, count, [accuracy](const BatchPacket<T> &p) {
+        return Exp(p, accuracy);
+    });
+}
+
+template<typename T>
+static void BatchLog(
+    const T *src,
+    T *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    BatchUnary(src, dst, count, [accuracy](const BatchPacket<T> &p) {
+        return Log(p, accuracy);
+    });
+}
+
+template<typename T>
+static void BatchSinCos(
+    const T *src,
+    T *sin,
+    T *cos,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+
+        BatchPacket<T> p, s, c;
+        Load(p, src + i, n);
+        SinCos(p, s, c, accuracy);
+        Store(s, sin + i, n);
+        Store(c, cos + i, n);
+    }
+}
+
+template<typename T>
+static void BatchAtan2(
+    const T *y,
+    const T *x,
+    T *dst,
+    const size_t count,
+    const Accuracy accuracy)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+
+        BatchPacket<T> py, px;
+        Load(py, y + i, n);
+        Load(px, x + i, n);
+        Store(Atan2(py, px, accuracy), dst + i, n);
+    }
+}
+
+/// ---- Matrix batch kernels -------------------------------------------------
+///
+/// @brief Load and store a packet of matrices, one packet per element and one
+/// matrix per lane. Arrays of matrices are gathered and scattered lane by
+/// lane, and matrix arrays in structure of arrays layout take one packet load
+/// and store per element. The remaining lanes of a partial packet are zero.
+///
+template<typename T, size_t K, template<typename> class Mat>
+static inline void BatchLoadMatrix(
+    BatchPacket<T> (&a)[K],
+    const Mat<T> *src,
+    const size_t n)
+{
+    static_assert(Mat<T>::length == K, "invalid matrix length");
+    const size_t width = BatchLanes<T>::width;
+    if (n == width) {
+        for (size_t j = 0; j < width; ++j) {
+            for (size_t k = 0; k < K; ++k) {
+                a[k][j] = src[j].data[k];
+            }
+        }
+        return;
+    }
+    for (size_t k = 0; k < K; ++k) {
+        for (size_t j = 0; j < width; ++j) {
+            a[k][j] = (j < n) ? src[j].data[k] : (T) 0;
+        }
+    }
+}
+
+template<typename T, size_t K, template<typename> class Mat>
+static inline void BatchStoreMatrix(
+    const BatchPacket<T> (&a)[K],
+    Mat<T> *dst,
+    const size_t n)
+{
+    static_assert(Mat<T>::length == K, "invalid matrix length");
+    for (size_t j = 0; j < n; ++j) {
+        for (size_t k = 0; k < K; ++k) {
+            dst[j].data[k] = a[k][j];
+        }
+    }
+}
+
+template<typename T, size_t K>
+static inline void BatchLoadMatrix(
+    BatchPacket<T> (&a)[K],
+    const T *src,
+    const size_t stride,
+    const size_t n)
+{
+    for (size_t k = 0; k < K; ++k) {
+        Load(a[k], src + k * stride, n);
+    }
+}
+
+template<typename T, size_t K>
+static inline void BatchStoreMatrix(
+    const BatchPacket<T> (&a)[K],
+    T *dst,
+    const size_t stride,
+    const size_t n)
+{
+    for (size_t k = 0; k < K; ++k) {
+        Store(a[k], dst + k * stride, n);
+    }
+}
+
+///
+/// @brief Return the determinants of a packet of 3x3 matrices, and compute
+/// the adjugates, with the cofactor expansion of Inverse(Mat3).
+///
+template<typename T>
+static inline BatchPacket<T> BatchAdjugate(
+    const BatchPacket<T> (&a)[9],
+    BatchPacket<T> (&adj)[9])
+{
+    adj[0] = a[4] * a[8] - a[5] * a[7];
+    adj[1] = a[2] * a[7] - a[1] * a[8];
+    adj[2] = a[1] * a[5] - a[2] * a[4];
+
+    adj[3] = a[5] * a[6] - a[3] * a[8];
+    adj[4] = a[0] * a[8] - a[2] * a[6];
+    adj[5] = a[2] * a[3] - a[0] * a[5];
+
+    adj[6] = a[3] * a[7] - a[4] * a[6];
+    adj[7] = a[1] * a[6] - a[0] * a[7];
+    adj[8] = a[0] * a[4] - a[1] * a[3];
+
+    return a[0] * adj[0] + a[1] * adj[3] + a[2] * adj[6];
+}
+
+template<typename T>
+static inline BatchPacket<T> BatchDeterminant(const BatchPacket<T> (&a)[9])
+{
+    BatchPacket<T> minor0 = a[4] * a[8] - a[5] * a[7];
+    BatchPacket<T> minor1 = a[5] * a[6] - a[3] * a[8];
+    BatchPacket<T> minor2 = a[3] * a[7] - a[4] * a[6];
+    return a[0] * minor0 + a[1] * minor1 + a[2] * minor2;
+}
+
+///
+/// @brief Return the determinants of a packet of 4x4 matrices, and compute
+/// the adjugates, from the 2x2 minors of the upper two rows, s0-s5, and of the
+/// lower two rows, c0-c5. The twelve minors are shared by all cofactors, which
+/// takes about half the products of the cofactor expansion of Inverse(Mat4).
+///
+template<typename T>
+static inline BatchPacket<T> BatchAdjugate(
+    const BatchPacket<T> (&a)[16],
+    BatchPacket<T> (&adj)[16])
+{
+    BatchPacket<T> s0 = a[0] * a[5] - a[1] * a[4];
+    BatchPacket<T> s1 = a[0] * a[6] - a[2] * a[4];
+    BatchPacket<T> s2 = a[0] * a[7] - a[3] * a[4];
+    BatchPacket<T> s3 = a[1] * a[6] - a[2] * a[5];
+    BatchPacket<T> s4 = a[1] * a[7] - a[3] * a[5];
+    BatchPacket<T> s5 = a[2] * a[7] - a[3] * a[6];
+
+    BatchPacket<T> c0 = a[8] * a[13] - a[9] * a[12];
+    BatchPacket<T> c1 = a[8] * a[14] - a[10] * a[12];
+    BatchPacket<T> c2 = a[8] * a[15] - a[11] * a[12];
+    BatchPacket<T> c3 = a[9] * a[14] - a[10] * a[13];
+    BatchPacket<T> c4 = a[9] * a[15] - a[11] * a[13];
+    BatchPacket<T> c5 = a[10] * a[15] - a[11] * a[14];
+
+    adj[0]  =  a[5] * c5 - a[6] * c4 + a[7] * c3;
+    adj[1]  = -a[1] * c5 + a[2] * c4 - a[3] * c3;
+    adj[2]  =  a[13] * s5 - a[14] * s4 + a[15] * s3;
+    adj[3]  = -a[9] * s5 + a[10] * s4 - a[11] * s3;
+
+    adj[4]  = -a[4] * c5 + a[6] * c2 - a[7] * c1;
+    adj[5]  =  a[0] * c5 - a[2] * c2 + a[3] * c1;
+    adj[6]  = -a[12] * s5 + a[14] * s2 - a[15] * s1;
+    adj[7]  =  a[8] * s5 - a[10] * s2 + a[11] * s1;
+
+    adj[8]  =  a[4] * c4 - a[5] * c2 + a[7] * c0;
+    adj[9]  = -a[0] * c4 + a[1] * c2 - a[3] * c0;
+    adj[10] =  a[12] * s4 - a[13] * s2 + a[15] * s0;
+    adj[11] = -a[8] * s4 + a[9] * s2 - a[11] * s0;
+
+    adj[12] = -a[4] * c3 + a[5] * c1 - a[6] * c0;
+    adj[13] =  a[0] * c3 - a[1] * c1 + a[2] * c0;
+    adj[14] = -a[12] * s3 + a[13] * s1 - a[14] * s0;
+    adj[15] =  a[8] * s3 - a[9] * s1 + a[10] * s0;
+
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+template<typename T>
+static inline BatchPacket<T> BatchDeterminant(const BatchPacket<T> (&a)[16])
+{
+    BatchPacket<T> c0 = a[8] * a[13] - a[9] * a[12];
+    BatchPacket<T> c1 = a[8] * a[14] - a[10] * a[12];
+    BatchPacket<T> c2 = a[8] * a[15] - a[11] * a[12];
+    BatchPacket<T> c3 = a[9] * a[14] - a[10] * a[13];
+    BatchPacket<T> c4 = a[9] * a[15] - a[11] * a[13];
+    BatchPacket<T> c5 = a[10] * a[15] - a[11] * a[14];
+
+    return (a[0] * a[5] - a[1] * a[4]) * c5 -
+           (a[0] * a[6] - a[2] * a[4]) * c4 +
+           (a[0] * a[7] - a[3] * a[4]) * c3 +
+           (a[1] * a[6] - a[2] * a[5]) * c2 -
+           (a[1] * a[7] - a[3] * a[5]) * c1 +
+           (a[2] * a[7] - a[3] * a[6]) * c0;
+}
+
+///
+/// @brief Compute the inverses of a packet of matrices without branches. The
+/// lanes of singular matrices, of zero or undefined determinant, divide by one
+/// and are scaled by zero, and their flags are set.
+///
+template<typename T, size_t K>
+static inline void BatchInverse(
+    const BatchPacket<T> (&a)[K],
+    BatchPacket<T> (&inv)[K],
+    uint8_t *singular,
+    const size_t n)
+{
+    const BatchPacket<T> zero = BatchPacket<T>::Zeros;
+    const BatchPacket<T> one = BatchPacket<T>::Ones;
+
+    BatchPacket<T> det = BatchAdjugate(a, inv);
+    auto regular = Less(det, zero) | Greater(det, zero);
+    BatchPacket<T> scale = Select(regular, one / Select(regular, det, one),
+        zero);
+    for (size_t k = 0; k < K; ++k) {
+        inv[k] *= scale;
+    }
+    if (singular != nullptr) {
+        for (size_t j = 0; j < n; ++j) {
+            singular[j] = regular[j] ? 0 : 1;
+        }
+    }
+}
+
+///
+/// @brief Compute the determinants and the inverses of an array of matrices,
+/// or of a matrix array in structure of arrays layout.
+///
+template<typename T, template<typename> class Mat>
+static void BatchDeterminantMat(
+    const Mat<T> *src,
+    T *dst,
+    const size_t count)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+        BatchPrefetch(src, i, count);
+
+        BatchPacket<T> a[Mat<T>::length];
+        BatchLoadMatrix(a, src + i, n);
+        Store(BatchDeterminant(a), dst + i, n);
+    }
+}
+
+template<typename T, size_t K>
+static void BatchDeterminantArray(
+    const T *src,
+    const size_t stride,
+    T *dst,
+    const size_t count)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+
+        BatchPacket<T> a[K];
+        BatchLoadMatrix(a, src + i, stride, n);
+        Store(BatchDeterminant(a), dst + i, n);
+    }
+}
+
+template<typename T, template<typename> class Mat>
+static void BatchInverseMat(
+    const Mat<T> *src,
+    Mat<T> *dst,
+    uint8_t *singular,
+    const size_t count)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+        BatchPrefetch(src, i, count);
+
+        BatchPacket<T> a[Mat<T>::length];
+        BatchPacket<T> inv[Mat<T>::length];
+        BatchLoadMatrix(a, src + i, n);
+        BatchInverse(a, inv, singular ? singular + i : nullptr, n);
+        BatchStoreMatrix(inv, dst + i, n);
+    }
+}
+
+template<typename T, size_t K>
+static void BatchInverseArray(
+    const T *src,
+    const size_t src_stride,
+    T *dst,
+    const size_t dst_stride,
+    uint8_t *singular,
+    const size_t count)
+{
+    const size_t width = BatchLanes<T>::width;
+    for (size_t i = 0; i < count; i += width) {
+        size_t n = BatchMin(width, count - i);
+
+        BatchPacket<T> a[K];
+        BatchPacket<T> inv[K];
+        BatchLoadMatrix(a, src + i, src_stride, n);
+        BatchInverse(a, inv, singular ? singular + i : nullptr, n);
+        BatchStoreMatrix(inv, dst + i, dst_stride, n);
+    }
+}
+
+/// ---- Batch kernel table ---------------------------------------------------
+///
+/// @brief Return the batch kernels of the element type, compiled with the
+/// instruction set of the including translation unit.
+///
+template<typename T>
+static constexpr BatchKernels<T> CreateBatchKernels()
+{
+    return BatchKernels<T>{
+        BatchTransform<T, Vec3>,
+        BatchTransform<T, PackedVec3>,
+        BatchRotate<T, Vec3>,
+        BatchRotate<T, PackedVec3>,
+        BatchNormalize<T, Vec3>,
+        BatchNormalize<T, PackedVec3>,
+        BatchDot<T>,
+        BatchCross<T>,
+        BatchDistance<T>,
+        BatchAabb<T, Vec3>,
+        BatchAabb<T, PackedVec3>,
+        BatchRsqrt<T>,
+        BatchExp<T>,
+        BatchLog<T>,
+        BatchSinCos<T>,
+        BatchAtan2<T>,
+        BatchDeterminantMat<T, Mat3>,
+        BatchDeterminantMat<T, Mat4>,
+        BatchDeterminantArray<T, 9>,
+        BatchDeterminantArray<T, 16>,
+        BatchInverseMat<T, Mat3>,
+        BatchInverseMat<T, Mat4>,
+        BatchInverseArray<T, 9>,
+        BatchInverseArray<T, 16>,
+    };
+}
+
+} // namespace Math
+
+#endif // MATH_SIMD_KERNELS_BATCH_H_
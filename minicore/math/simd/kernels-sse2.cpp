@@ -0,0 +1,182 @@
+//
+// kernels-sse2.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "kernels.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (_M_IX86_FP >= 2)
+#include <emmintrin.h>
+
+namespace Math {
+
+/// ---- Single precision kernels ---------------------------------------------
+///
+/// @brief Transform an array of vectors by the matrix. Each output vector is
+/// the sum of the matrix columns weighted by the input vector elements.
+///
+static void TransformVec4f(
+    const Mat4<float> &m,
+    const Vec4<float> *src,
+    Vec4<float> *dst,
+    const size_t count)
+{
+    __m128 c0 = _mm_load_ps(&m.data[0]);
+    __m128 c1 = _mm_load_ps(&m.data[4]);
+    __m128 c2 = _mm_load_ps(&m.data[8]);
+    __m128 c3 = _mm_load_ps(&m.data[12]);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    for (size_t i = 0; i < count; ++i) {
+        __m128 v = _mm_load_ps(src[i].data);
+        __m128 r = _mm_mul_ps(c0, _mm_shuffle_ps(v, v, 0x00));
+        r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_shuffle_ps(v, v, 0x55)));
+        r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_shuffle_ps(v, v, 0xaa)));
+        r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_shuffle_ps(v, v, 0xff)));
+        _mm_store_ps(dst[i].data, r);
+    }
+}
+
+///
+/// @brief Transform an array of matrices by the matrix. Each output row is the
+/// sum of the input rows weighted by the elements of the matrix row.
+///
+static void TransformMat4f(
+    const Mat4<float> &m,
+    const Mat4<float> *src,
+    Mat4<float> *dst,
+    const size_t count)
+{
+    __m128 a[4][4];
+    for (size_t r = 0; r < 4; ++r) {
+        for (size_t c = 0; c < 4; ++c) {
+            a[r][c] = _mm_set1_ps(m.data[4*r + c]);
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        __m128 b0 = _mm_load_ps(&src[i].data[0]);
+        __m128 b1 = _mm_load_ps(&src[i].data[4]);
+        __m128 b2 = _mm_load_ps(&src[i].data[8]);
+        __m128 b3 = _mm_load_ps(&src[i].data[12]);
+        for (size_t r = 0; r < 4; ++r) {
+            __m128 row = _mm_mul_ps(a[r][0], b0);
+            row = _mm_add_ps(row, _mm_mul_ps(a[r][1], b1));
+            row = _mm_add_ps(row, _mm_mul_ps(a[r][2], b2));
+            row = _mm_add_ps(row, _mm_mul_ps(a[r][3], b3));
+            _mm_store_ps(&dst[i].data[4*r], row);
+        }
+    }
+}
+
+/// ---- Double precision kernels ---------------------------------------------
+///
+/// @brief Transform an array of vectors by the matrix. Each column is split
+/// into a low and a high 128-bit half.
+///
+static void TransformVec4d(
+    const Mat4<double> &m,
+    const Vec4<double> *src,
+    Vec4<double> *dst,
+    const size_t count)
+{
+    __m128d lo[4], hi[4];
+    for (size_t c = 0; c < 4; ++c) {
+        lo[c] = _mm_set_pd(m.data[4 + c], m.data[c]);
+        hi[c] = _mm_set_pd(m.data[12 + c], m.data[8 + c]);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        __m128d x = _mm_load1_pd(&src[i].data[0]);
+        __m128d y = _mm_load1_pd(&src[i].data[1]);
+        __m128d z = _mm_load1_pd(&src[i].data[2]);
+        __m128d w = _mm_load1_pd(&src[i].data[3]);
+
+        __m128d r_lo = _mm_mul_pd(lo[0], x);
+        r_lo = _mm_add_pd(r_lo, _mm_mul_pd(lo[1], y));
+        r_lo = _mm_add_pd(r_lo, _mm_mul_pd(lo[2], z));
+        r_lo = _mm_add_pd(r_lo, _mm_mul_pd(lo[3], w));
+
+        __m128d r_hi = _mm_mul_pd(hi[0], x);
+        r_hi = _mm_add_pd(r_hi, _mm_mul_pd(hi[1], y));
+        r_hi = _mm_add_pd(r_hi, _mm_mul_pd(hi[2], z));
+        r_hi = _mm_add_pd(r_hi, _mm_mul_pd(hi[3], w));
+
+        _mm_store_pd(&dst[i].data[0], r_lo);
+        _mm_store_pd(&dst[i].data[2], r_hi);
+    }
+}
+
+///
+/// @brief Transform an array of matrices by the matrix. Each input row is
+/// split into a low and a high 128-bit half.
+///
+static void TransformMat4d(
+    const Mat4<double> &m,
+    const Mat4<double> *src,
+    Mat4<double> *dst,
+    const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        __m128d lo[4], hi[4];
+        for (size_t c = 0; c < 4; ++c) {
+            lo[c] = _mm_load_pd(&src[i].data[4*c]);
+            hi[c] = _mm_load_pd(&src[i].data[4*c + 2]);
+        }
+
+        for (size_t r = 0; r < 4; ++r) {
+            __m128d a = _mm_set1_pd(m.data[4*r]);
+            __m128d r_lo = _mm_mul_pd(a, lo[0]);
+            __m128d r_hi = _mm_mul_pd(a, hi[0]);
+            for (size_t c = 1; c < 4; ++c) {
+                a = _mm_set1_pd(m.data[4*r + c]);
+                r_lo = _mm_add_pd(r_lo, _mm_mul_pd(a, lo[c]));
+                r_hi = _mm_add_pd(r_hi, _mm_mul_pd(a, hi[c]));
+            }
+            _mm_store_pd(&dst[i].data[4*r], r_lo);
+            _mm_store_pd(&dst[i].data[4*r + 2], r_hi);
+        }
+    }
+}
+
+/// ---- SSE2 kernels ---------------------------------------------------------
+///
+static const Kernels kKernelsSse2 = {
+    kIsaSse2,
+    TransformVec4f,
+    TransformVec4d,
+    TransformMat4f,
+    TransformMat4d,
+    nullptr,            // transformVec3d
+    nullptr,            // dotMat4d
+    nullptr,            // determinantMat4d
+    nullptr,            // inverseMat4d
+    nullptr,            // convertToHalf
+    nullptr,            // convertFromHalf
+    nullptr,            // convertToBFloat16
+    nullptr,            // convertFromBFloat16
+    nullptr,            // cellKeys
+    nullptr,            // randomFill32
+    nullptr,            // randomFill64
+    nullptr,            // randomStream
+    nullptr,            // gemmf
+    nullptr,            // gemmd
+    {},                 // batchf
+    {},                 // batchd
+};
+
+const Kernels *GetKernelsSse2() { return &kKernelsSse2; }
+
+} // namespace Math
+
+#else  // __SSE2__
+
+namespace Math {
+const Kernels *GetKernelsSse2() { return nullptr; }
+} // namespace Math
+
+#endif // __SSE2__
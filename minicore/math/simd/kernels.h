@@ -0,0 +1,34 @@
+//
+// kernels.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_SIMD_KERNELS_H_
+#define MATH_SIMD_KERNELS_H_
+
+#include "../dispatch.h"
+
+namespace Math {
+
+///
+/// @brief Array kernels of each instruction set level. Each set is compiled
+/// in its own translation unit with the corresponding instruction set enabled.
+/// Return null if the instruction set was not enabled at compile time.
+///
+/// The kernel translation units use the vector and matrix data layout only and
+/// never call the inline vector and matrix functions. These would otherwise
+/// be emitted with the kernel instruction set and could be picked by the
+/// linker for every other translation unit.
+///
+const Kernels *GetKernelsSse2();
+const Kernels *GetKernelsAvx();
+const Kernels *GetKernelsAvx2();
+const Kernels *GetKernelsAvx512();
+
+} // namespace Math
+
+#endif // MATH_SIMD_KERNELS_H_
@@ -13,6 +13,7 @@
 #include "common.h"
 
 namespace Math {
+inline namespace MATH_SIMD_ISA {
 
 /// ---- simd load/store functions --------------------------------------------
 /// @brief Load 128-bits (2 packed double-precision 64-bit) from the specified
@@ -121,8 +122,13 @@ inline void simd_store(Mat4<double> &mat, const size_t row, const __m256d a)
 /// ---- Mat2 simd assignment operators ---------------------------------------
 ///
 template<>
-inline Mat2<double> &operator+=(Mat2<double> &lhs, const Mat2<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat2<double> &operator+=(
+    Mat2<double> &lhs, const Mat2<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
     const __m128d a0 = simd_load(lhs, 0);
     const __m128d a1 = simd_load(lhs, 1);
 
@@ -135,8 +141,13 @@ inline Mat2<double> &operator+=(Mat2<double> &lhs, const Mat2<double> &rhs)
 }
 
 template<>
-inline Mat2<double> &operator-=(Mat2<double> &lhs, const Mat2<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat2<double> &operator-=(
+    Mat2<double> &lhs, const Mat2<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
     const __m128d a0 = simd_load(lhs, 0);
     const __m128d a1 = simd_load(lhs, 1);
 
@@ -149,8 +160,13 @@ inline Mat2<double> &operator-=(Mat2<double> &lhs, const Mat2<double> &rhs)
 }
 
 template<>
-inline Mat2<double> &operator*=(Mat2<double> &lhs, const Mat2<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat2<double> &operator*=(
+    Mat2<double> &lhs, const Mat2<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
     const __m128d a0 = simd_load(lhs, 0);
     const __m128d a1 = simd_load(lhs, 1);
 
@@ -163,8 +179,13 @@ inline Mat2<double> &operator*=(Mat2<double> &lhs, const Mat2<double> &rhs)
 }
 
 template<>
-inline Mat2<double> &operator/=(Mat2<double> &lhs, const Mat2<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat2<double> &operator/=(
+    Mat2<double> &lhs, const Mat2<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
     const __m128d a0 = simd_load(lhs, 0);
     const __m128d a1 = simd_load(lhs, 1);
 
@@ -177,8 +198,13 @@ inline Mat2<double> &operator/=(Mat2<double> &lhs, const Mat2<double> &rhs)
 }
 
 template<>
-inline Mat2<double> &operator+=(Mat2<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat2<double> &operator+=(
+    Mat2<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
     const __m128d a0 = simd_load(lhs, 0);
     const __m128d a1 = simd_load(lhs, 1);
     const __m128d b = _mm_set1_pd(scalar);
@@ -189,8 +215,13 @@ inline Mat2<double> &operator+=(Mat2<double> &lhs, const double scalar)
 }
 
 template<>
-inline Mat2<double> &operator-=(Mat2<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat2<double> &operator-=(
+    Mat2<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
     const __m128d a0 = simd_load(lhs, 0);
     const __m128d a1 = simd_load(lhs, 1);
     const __m128d b = _mm_set1_pd(scalar);
@@ -201,8 +232,13 @@ inline Mat2<double> &operator-=(Mat2<double> &lhs, const double scalar)
 }
 
 template<>
-inline Mat2<double> &operator*=(Mat2<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat2<double> &operator*=(
+    Mat2<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
     const __m128d a0 = simd_load(lhs, 0);
     const __m128d a1 = simd_load(lhs, 1);
     const __m128d b = _mm_set1_pd(scalar);
@@ -213,8 +249,13 @@ inline Mat2<double> &operator*=(Mat2<double> &lhs, const double scalar)
 }
 
 template<>
-inline Mat2<double> &operator/=(Mat2<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat2<double> &operator/=(
+    Mat2<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
     const __m128d a0 = simd_load(lhs, 0);
     const __m128d a1 = simd_load(lhs, 1);
     const __m128d b = _mm_set1_pd(scalar);
@@ -227,8 +268,13 @@ inline Mat2<double> &operator/=(Mat2<double> &lhs, const double scalar)
 /// ---- Mat2 simd arithmetic operators ---------------------------------------
 ///
 template<>
-inline Mat2<double> operator+(const double scalar, Mat2<double> rhs)
+MATH_SIMD_CONSTEXPR Mat2<double> operator+(
+    const double scalar, Mat2<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
     const __m128d a = _mm_set1_pd(scalar);
     const __m128d b0 = simd_load(rhs, 0);
     const __m128d b1 = simd_load(rhs, 1);
@@ -239,8 +285,13 @@ inline Mat2<double> operator+(const double scalar, Mat2<double> rhs)
 }
 
 template<>
-inline Mat2<double> operator-(const double scalar, Mat2<double> rhs)
+MATH_SIMD_CONSTEXPR Mat2<double> operator-(
+    const double scalar, Mat2<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
     const __m128d a = _mm_set1_pd(scalar);
     const __m128d b0 = simd_load(rhs, 0);
     const __m128d b1 = simd_load(rhs, 1);
@@ -251,8 +302,13 @@ inline Mat2<double> operator-(const double scalar, Mat2<double> rhs)
 }
 
 template<>
-inline Mat2<double> operator*(const double scalar, Mat2<double> rhs)
+MATH_SIMD_CONSTEXPR Mat2<double> operator*(
+    const double scalar, Mat2<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
     const __m128d a = _mm_set1_pd(scalar);
     const __m128d b0 = simd_load(rhs, 0);
     const __m128d b1 = simd_load(rhs, 1);
@@ -263,8 +319,13 @@ inline Mat2<double> operator*(const double scalar, Mat2<double> rhs)
 }
 
 template<>
-inline Mat2<double> operator/(const double scalar, Mat2<double> rhs)
+MATH_SIMD_CONSTEXPR Mat2<double> operator/(
+    const double scalar, Mat2<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
     const __m128d a = _mm_set1_pd(scalar);
     const __m128d b0 = simd_load(rhs, 0);
     const __m128d b1 = simd_load(rhs, 1);
@@ -277,8 +338,13 @@ inline Mat2<double> operator/(const double scalar, Mat2<double> rhs)
 /// ---- Mat3 simd assignment operators ---------------------------------------
 ///
 template<>
-inline Mat3<double> &operator+=(Mat3<double> &lhs, const Mat3<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat3<double> &operator+=(
+    Mat3<double> &lhs, const Mat3<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -294,8 +360,13 @@ inline Mat3<double> &operator+=(Mat3<double> &lhs, const Mat3<double> &rhs)
 }
 
 template<>
-inline Mat3<double> &operator-=(Mat3<double> &lhs, const Mat3<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat3<double> &operator-=(
+    Mat3<double> &lhs, const Mat3<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -311,8 +382,13 @@ inline Mat3<double> &operator-=(Mat3<double> &lhs, const Mat3<double> &rhs)
 }
 
 template<>
-inline Mat3<double> &operator*=(Mat3<double> &lhs, const Mat3<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat3<double> &operator*=(
+    Mat3<double> &lhs, const Mat3<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -328,8 +404,13 @@ inline Mat3<double> &operator*=(Mat3<double> &lhs, const Mat3<double> &rhs)
 }
 
 template<>
-inline Mat3<double> &operator/=(Mat3<double> &lhs, const Mat3<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat3<double> &operator/=(
+    Mat3<double> &lhs, const Mat3<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -345,8 +426,13 @@ inline Mat3<double> &operator/=(Mat3<double> &lhs, const Mat3<double> &rhs)
 }
 
 template<>
-inline Mat3<double> &operator+=(Mat3<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat3<double> &operator+=(
+    Mat3<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -359,8 +445,13 @@ inline Mat3<double> &operator+=(Mat3<double> &lhs, const double scalar)
 }
 
 template<>
-inline Mat3<double> &operator-=(Mat3<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat3<double> &operator-=(
+    Mat3<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -373,8 +464,13 @@ inline Mat3<double> &operator-=(Mat3<double> &lhs, const double scalar)
 }
 
 template<>
-inline Mat3<double> &operator*=(Mat3<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat3<double> &operator*=(
+    Mat3<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -387,8 +483,13 @@ inline Mat3<double> &operator*=(Mat3<double> &lhs, const double scalar)
 }
 
 template<>
-inline Mat3<double> &operator/=(Mat3<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat3<double> &operator/=(
+    Mat3<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -403,8 +504,13 @@ inline Mat3<double> &operator/=(Mat3<double> &lhs, const double scalar)
 /// ---- Mat3 simd arithmetic operators ---------------------------------------
 ///
 template<>
-inline Mat3<double> operator+(const double scalar, Mat3<double> rhs)
+MATH_SIMD_CONSTEXPR Mat3<double> operator+(
+    const double scalar, Mat3<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b0 = simd_load(rhs, 0);
     const __m256d b1 = simd_load(rhs, 1);
@@ -417,8 +523,13 @@ inline Mat3<double> operator+(const double scalar, Mat3<double> rhs)
 }
 
 template<>
-inline Mat3<double> operator-(const double scalar, Mat3<double> rhs)
+MATH_SIMD_CONSTEXPR Mat3<double> operator-(
+    const double scalar, Mat3<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b0 = simd_load(rhs, 0);
     const __m256d b1 = simd_load(rhs, 1);
@@ -431,8 +542,13 @@ inline Mat3<double> operator-(const double scalar, Mat3<double> rhs)
 }
 
 template<>
-inline Mat3<double> operator*(const double scalar, Mat3<double> rhs)
+MATH_SIMD_CONSTEXPR Mat3<double> operator*(
+    const double scalar, Mat3<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b0 = simd_load(rhs, 0);
     const __m256d b1 = simd_load(rhs, 1);
@@ -445,8 +561,13 @@ inline Mat3<double> operator*(const double scalar, Mat3<double> rhs)
 }
 
 template<>
-inline Mat3<double> operator/(const double scalar, Mat3<double> rhs)
+MATH_SIMD_CONSTEXPR Mat3<double> operator/(
+    const double scalar, Mat3<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b0 = simd_load(rhs, 0);
     const __m256d b1 = simd_load(rhs, 1);
@@ -461,8 +582,13 @@ inline Mat3<double> operator/(const double scalar, Mat3<double> rhs)
 /// ---- Mat4 simd assignment operators ---------------------------------------
 ///
 template<>
-inline Mat4<double> &operator+=(Mat4<double> &lhs, const Mat4<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat4<double> &operator+=(
+    Mat4<double> &lhs, const Mat4<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -481,8 +607,13 @@ inline Mat4<double> &operator+=(Mat4<double> &lhs, const Mat4<double> &rhs)
 }
 
 template<>
-inline Mat4<double> &operator-=(Mat4<double> &lhs, const Mat4<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat4<double> &operator-=(
+    Mat4<double> &lhs, const Mat4<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -501,8 +632,13 @@ inline Mat4<double> &operator-=(Mat4<double> &lhs, const Mat4<double> &rhs)
 }
 
 template<>
-inline Mat4<double> &operator*=(Mat4<double> &lhs, const Mat4<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat4<double> &operator*=(
+    Mat4<double> &lhs, const Mat4<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -521,8 +657,13 @@ inline Mat4<double> &operator*=(Mat4<double> &lhs, const Mat4<double> &rhs)
 }
 
 template<>
-inline Mat4<double> &operator/=(Mat4<double> &lhs, const Mat4<double> &rhs)
+MATH_SIMD_CONSTEXPR Mat4<double> &operator/=(
+    Mat4<double> &lhs, const Mat4<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -541,8 +682,13 @@ inline Mat4<double> &operator/=(Mat4<double> &lhs, const Mat4<double> &rhs)
 }
 
 template<>
-inline Mat4<double> &operator+=(Mat4<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat4<double> &operator+=(
+    Mat4<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -557,8 +703,13 @@ inline Mat4<double> &operator+=(Mat4<double> &lhs, const double scalar)
 }
 
 template<>
-inline Mat4<double> &operator-=(Mat4<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat4<double> &operator-=(
+    Mat4<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -573,8 +724,13 @@ inline Mat4<double> &operator-=(Mat4<double> &lhs, const double scalar)
 }
 
 template<>
-inline Mat4<double> &operator*=(Mat4<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat4<double> &operator*=(
+    Mat4<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -589,8 +745,13 @@ inline Mat4<double> &operator*=(Mat4<double> &lhs, const double scalar)
 }
 
 template<>
-inline Mat4<double> &operator/=(Mat4<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Mat4<double> &operator/=(
+    Mat4<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
     const __m256d a0 = simd_load(lhs, 0);
     const __m256d a1 = simd_load(lhs, 1);
     const __m256d a2 = simd_load(lhs, 2);
@@ -607,8 +768,13 @@ inline Mat4<double> &operator/=(Mat4<double> &lhs, const double scalar)
 /// ---- Mat4 simd arithmetic operators ---------------------------------------
 ///
 template<>
-inline Mat4<double> operator+(const double scalar, Mat4<double> rhs)
+MATH_SIMD_CONSTEXPR Mat4<double> operator+(
+    const double scalar, Mat4<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b0 = simd_load(rhs, 0);
     const __m256d b1 = simd_load(rhs, 1);
@@ -623,8 +789,13 @@ inline Mat4<double> operator+(const double scalar, Mat4<double> rhs)
 }
 
 template<>
-inline Mat4<double> operator-(const double scalar, Mat4<double> rhs)
+MATH_SIMD_CONSTEXPR Mat4<double> operator-(
+    const double scalar, Mat4<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b0 = simd_load(rhs, 0);
     const __m256d b1 = simd_load(rhs, 1);
@@ -639,8 +810,13 @@ inline Mat4<double> operator-(const double scalar, Mat4<double> rhs)
 }
 
 template<>
-inline Mat4<double> operator*(const double scalar, Mat4<double> rhs)
+MATH_SIMD_CONSTEXPR Mat4<double> operator*(
+    const double scalar, Mat4<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b0 = simd_load(rhs, 0);
     const __m256d b1 = simd_load(rhs, 1);
@@ -655,8 +831,13 @@ inline Mat4<double> operator*(const double scalar, Mat4<double> rhs)
 }
 
 template<>
-inline Mat4<double> operator/(const double scalar, Mat4<double> rhs)
+MATH_SIMD_CONSTEXPR Mat4<double> operator/(
+    const double scalar, Mat4<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b0 = simd_load(rhs, 0);
     const __m256d b1 = simd_load(rhs, 1);
@@ -670,6 +851,748 @@ inline Mat4<double> operator/(const double scalar, Mat4<double> rhs)
     return rhs;
 }
 
+/// ---- simd single-precision load/store functions ---------------------------
+/// @brief Load 128-bits (4 packed single-precision 32-bit) from the 2d-matrix.
+/// The 2x2 matrix fits in a single register.
+///
+inline __m128 simd_load(const Mat2<float> &mat)
+{
+    return _mm_load_ps(mat.data);
+}
+
+///
+/// @brief Store 128-bits (4 packed single-precision 32-bit) into the 2d-matrix.
+///
+inline void simd_store(Mat2<float> &mat, const __m128 a)
+{
+    _mm_store_ps(mat.data, a);
+}
+
+///
+/// @brief Load 96-bits (3 packed single-precision 32-bit) from the specified
+/// row in the 3d-matrix.
+/// @fn _mm_maskload_ps(float const * v, __m128i mask)
+///      dst[31:0]   := (mask[31]  == 1) ? v[31:0]   : 0
+///      dst[63:32]  := (mask[63]  == 1) ? v[63:32]  : 0
+///      dst[95:64]  := (mask[95]  == 1) ? v[95:64]  : 0
+///      dst[127:96] := (mask[127] == 1) ? v[127:96] : 0
+///
+inline __m128 simd_load(const Mat3<float> &mat, const size_t row)
+{
+    const __m128i mask = _mm_set_epi32(0x0, -1, -1, -1);
+    return _mm_maskload_ps(mat.data + row * mat.dim, mask);
+}
+
+///
+/// @brief Store 96-bits (3 packed single-precision 32-bit) into the specified
+/// row in the 3d-matrix.
+/// @fn _mm_maskstore_ps(float * v, __m128i mask, __m128 a)
+///      v[31:0]   := (mask[31]  == 1) ? a[31:0]
+///      v[63:32]  := (mask[63]  == 1) ? a[63:32]
+///      v[95:64]  := (mask[95]  == 1) ? a[95:64]
+///      v[127:96] := (mask[127] == 1) ? a[127:96]
+///
+inline void simd_store(Mat3<float> &mat, const size_t row, const __m128 a)
+{
+    const __m128i mask = _mm_set_epi32(0x0, -1, -1, -1);
+    _mm_maskstore_ps(mat.data + row * mat.dim, mask, a);
+}
+
+///
+/// @brief Load 128-bits (4 packed single-precision 32-bit) from the specified
+/// row in the 4d-matrix.
+///
+inline __m128 simd_load(const Mat4<float> &mat, const size_t row)
+{
+    return _mm_load_ps(mat.data + row * mat.dim);
+}
+
+///
+/// @brief Store 128-bits (4 packed single-precision 32-bit) into the specified
+/// row in the 4d-matrix.
+///
+inline void simd_store(Mat4<float> &mat, const size_t row, const __m128 a)
+{
+    _mm_store_ps(mat.data + row * mat.dim, a);
+}
+
+/// ---- Mat2f simd assignment operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> &operator+=(
+    Mat2<float> &lhs, const Mat2<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_add_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> &operator-=(
+    Mat2<float> &lhs, const Mat2<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_sub_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> &operator*=(
+    Mat2<float> &lhs, const Mat2<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_mul_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> &operator/=(
+    Mat2<float> &lhs, const Mat2<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_div_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> &operator+=(
+    Mat2<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_add_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> &operator-=(
+    Mat2<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_sub_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> &operator*=(
+    Mat2<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_mul_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> &operator/=(
+    Mat2<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_div_ps(a, b));
+    return lhs;
+}
+
+/// ---- Mat2f simd arithmetic operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> operator+(const float scalar, Mat2<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_add_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> operator-(const float scalar, Mat2<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_sub_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> operator*(const float scalar, Mat2<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_mul_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat2<float> operator/(const float scalar, Mat2<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_div_ps(a, b));
+    return rhs;
+}
+
+/// ---- Mat3f simd assignment operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> &operator+=(
+    Mat3<float> &lhs, const Mat3<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+
+    simd_store(lhs, 0, _mm_add_ps(a0, b0));
+    simd_store(lhs, 1, _mm_add_ps(a1, b1));
+    simd_store(lhs, 2, _mm_add_ps(a2, b2));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> &operator-=(
+    Mat3<float> &lhs, const Mat3<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+
+    simd_store(lhs, 0, _mm_sub_ps(a0, b0));
+    simd_store(lhs, 1, _mm_sub_ps(a1, b1));
+    simd_store(lhs, 2, _mm_sub_ps(a2, b2));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> &operator*=(
+    Mat3<float> &lhs, const Mat3<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+
+    simd_store(lhs, 0, _mm_mul_ps(a0, b0));
+    simd_store(lhs, 1, _mm_mul_ps(a1, b1));
+    simd_store(lhs, 2, _mm_mul_ps(a2, b2));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> &operator/=(
+    Mat3<float> &lhs, const Mat3<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+
+    simd_store(lhs, 0, _mm_div_ps(a0, b0));
+    simd_store(lhs, 1, _mm_div_ps(a1, b1));
+    simd_store(lhs, 2, _mm_div_ps(a2, b2));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> &operator+=(
+    Mat3<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 b = _mm_set1_ps(scalar);
+
+    simd_store(lhs, 0, _mm_add_ps(a0, b));
+    simd_store(lhs, 1, _mm_add_ps(a1, b));
+    simd_store(lhs, 2, _mm_add_ps(a2, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> &operator-=(
+    Mat3<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 b = _mm_set1_ps(scalar);
+
+    simd_store(lhs, 0, _mm_sub_ps(a0, b));
+    simd_store(lhs, 1, _mm_sub_ps(a1, b));
+    simd_store(lhs, 2, _mm_sub_ps(a2, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> &operator*=(
+    Mat3<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 b = _mm_set1_ps(scalar);
+
+    simd_store(lhs, 0, _mm_mul_ps(a0, b));
+    simd_store(lhs, 1, _mm_mul_ps(a1, b));
+    simd_store(lhs, 2, _mm_mul_ps(a2, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> &operator/=(
+    Mat3<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 b = _mm_set1_ps(scalar);
+
+    simd_store(lhs, 0, _mm_div_ps(a0, b));
+    simd_store(lhs, 1, _mm_div_ps(a1, b));
+    simd_store(lhs, 2, _mm_div_ps(a2, b));
+    return lhs;
+}
+
+/// ---- Mat3f simd arithmetic operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> operator+(const float scalar, Mat3<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+
+    simd_store(rhs, 0, _mm_add_ps(a, b0));
+    simd_store(rhs, 1, _mm_add_ps(a, b1));
+    simd_store(rhs, 2, _mm_add_ps(a, b2));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> operator-(const float scalar, Mat3<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+
+    simd_store(rhs, 0, _mm_sub_ps(a, b0));
+    simd_store(rhs, 1, _mm_sub_ps(a, b1));
+    simd_store(rhs, 2, _mm_sub_ps(a, b2));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> operator*(const float scalar, Mat3<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+
+    simd_store(rhs, 0, _mm_mul_ps(a, b0));
+    simd_store(rhs, 1, _mm_mul_ps(a, b1));
+    simd_store(rhs, 2, _mm_mul_ps(a, b2));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat3<float> operator/(const float scalar, Mat3<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+
+    simd_store(rhs, 0, _mm_div_ps(a, b0));
+    simd_store(rhs, 1, _mm_div_ps(a, b1));
+    simd_store(rhs, 2, _mm_div_ps(a, b2));
+    return rhs;
+}
+
+/// ---- Mat4f simd assignment operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> &operator+=(
+    Mat4<float> &lhs, const Mat4<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 a3 = simd_load(lhs, 3);
+
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+    const __m128 b3 = simd_load(rhs, 3);
+
+    simd_store(lhs, 0, _mm_add_ps(a0, b0));
+    simd_store(lhs, 1, _mm_add_ps(a1, b1));
+    simd_store(lhs, 2, _mm_add_ps(a2, b2));
+    simd_store(lhs, 3, _mm_add_ps(a3, b3));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> &operator-=(
+    Mat4<float> &lhs, const Mat4<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 a3 = simd_load(lhs, 3);
+
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+    const __m128 b3 = simd_load(rhs, 3);
+
+    simd_store(lhs, 0, _mm_sub_ps(a0, b0));
+    simd_store(lhs, 1, _mm_sub_ps(a1, b1));
+    simd_store(lhs, 2, _mm_sub_ps(a2, b2));
+    simd_store(lhs, 3, _mm_sub_ps(a3, b3));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> &operator*=(
+    Mat4<float> &lhs, const Mat4<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 a3 = simd_load(lhs, 3);
+
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+    const __m128 b3 = simd_load(rhs, 3);
+
+    simd_store(lhs, 0, _mm_mul_ps(a0, b0));
+    simd_store(lhs, 1, _mm_mul_ps(a1, b1));
+    simd_store(lhs, 2, _mm_mul_ps(a2, b2));
+    simd_store(lhs, 3, _mm_mul_ps(a3, b3));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> &operator/=(
+    Mat4<float> &lhs, const Mat4<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 a3 = simd_load(lhs, 3);
+
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+    const __m128 b3 = simd_load(rhs, 3);
+
+    simd_store(lhs, 0, _mm_div_ps(a0, b0));
+    simd_store(lhs, 1, _mm_div_ps(a1, b1));
+    simd_store(lhs, 2, _mm_div_ps(a2, b2));
+    simd_store(lhs, 3, _mm_div_ps(a3, b3));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> &operator+=(
+    Mat4<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 a3 = simd_load(lhs, 3);
+    const __m128 b = _mm_set1_ps(scalar);
+
+    simd_store(lhs, 0, _mm_add_ps(a0, b));
+    simd_store(lhs, 1, _mm_add_ps(a1, b));
+    simd_store(lhs, 2, _mm_add_ps(a2, b));
+    simd_store(lhs, 3, _mm_add_ps(a3, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> &operator-=(
+    Mat4<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 a3 = simd_load(lhs, 3);
+    const __m128 b = _mm_set1_ps(scalar);
+
+    simd_store(lhs, 0, _mm_sub_ps(a0, b));
+    simd_store(lhs, 1, _mm_sub_ps(a1, b));
+    simd_store(lhs, 2, _mm_sub_ps(a2, b));
+    simd_store(lhs, 3, _mm_sub_ps(a3, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> &operator*=(
+    Mat4<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 a3 = simd_load(lhs, 3);
+    const __m128 b = _mm_set1_ps(scalar);
+
+    simd_store(lhs, 0, _mm_mul_ps(a0, b));
+    simd_store(lhs, 1, _mm_mul_ps(a1, b));
+    simd_store(lhs, 2, _mm_mul_ps(a2, b));
+    simd_store(lhs, 3, _mm_mul_ps(a3, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> &operator/=(
+    Mat4<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
+    const __m128 a0 = simd_load(lhs, 0);
+    const __m128 a1 = simd_load(lhs, 1);
+    const __m128 a2 = simd_load(lhs, 2);
+    const __m128 a3 = simd_load(lhs, 3);
+    const __m128 b = _mm_set1_ps(scalar);
+
+    simd_store(lhs, 0, _mm_div_ps(a0, b));
+    simd_store(lhs, 1, _mm_div_ps(a1, b));
+    simd_store(lhs, 2, _mm_div_ps(a2, b));
+    simd_store(lhs, 3, _mm_div_ps(a3, b));
+    return lhs;
+}
+
+/// ---- Mat4f simd arithmetic operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> operator+(const float scalar, Mat4<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+    const __m128 b3 = simd_load(rhs, 3);
+
+    simd_store(rhs, 0, _mm_add_ps(a, b0));
+    simd_store(rhs, 1, _mm_add_ps(a, b1));
+    simd_store(rhs, 2, _mm_add_ps(a, b2));
+    simd_store(rhs, 3, _mm_add_ps(a, b3));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> operator-(const float scalar, Mat4<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+    const __m128 b3 = simd_load(rhs, 3);
+
+    simd_store(rhs, 0, _mm_sub_ps(a, b0));
+    simd_store(rhs, 1, _mm_sub_ps(a, b1));
+    simd_store(rhs, 2, _mm_sub_ps(a, b2));
+    simd_store(rhs, 3, _mm_sub_ps(a, b3));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> operator*(const float scalar, Mat4<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+    const __m128 b3 = simd_load(rhs, 3);
+
+    simd_store(rhs, 0, _mm_mul_ps(a, b0));
+    simd_store(rhs, 1, _mm_mul_ps(a, b1));
+    simd_store(rhs, 2, _mm_mul_ps(a, b2));
+    simd_store(rhs, 3, _mm_mul_ps(a, b3));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Mat4<float> operator/(const float scalar, Mat4<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b0 = simd_load(rhs, 0);
+    const __m128 b1 = simd_load(rhs, 1);
+    const __m128 b2 = simd_load(rhs, 2);
+    const __m128 b3 = simd_load(rhs, 3);
+
+    simd_store(rhs, 0, _mm_div_ps(a, b0));
+    simd_store(rhs, 1, _mm_div_ps(a, b1));
+    simd_store(rhs, 2, _mm_div_ps(a, b2));
+    simd_store(rhs, 3, _mm_div_ps(a, b3));
+    return rhs;
+}
+
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 #endif // MATH_SIMD_MATRIX_H_
@@ -0,0 +1,192 @@
+//
+// packed.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_SIMD_PACKED_H_
+#define MATH_SIMD_PACKED_H_
+
+#include "common.h"
+
+namespace Math {
+inline namespace MATH_SIMD_ISA {
+
+/// ---- PackedVec3d simd load and store --------------------------------------
+/// @brief Load 4 PackedVec3d, 96 bytes, into a packet. Load the 128-bit pairs
+/// of the first two and the last two vectors into the low and high lanes, and
+/// shuffle the elements within each lane:
+///
+///  a = {x0, y0 | x2, y2}       x = {x0, x1 | x2, x3}
+///  b = {z0, x1 | z2, x3}   ->  y = {y0, y1 | y2, y3}
+///  c = {y1, z1 | y3, z3}       z = {z0, z1 | z2, z3}
+///
+/// @fn _mm256_shuffle_pd(a, b, mask)
+///  dst[63:0]    := (mask[0] == 0) ? a[63:0]    : a[127:64]
+///  dst[127:64]  := (mask[1] == 0) ? b[63:0]    : b[127:64]
+///  dst[191:128] := (mask[2] == 0) ? a[191:128] : a[255:192]
+///  dst[255:192] := (mask[3] == 0) ? b[191:128] : b[255:192]
+///
+/// Partial packets use the generic loop.
+///
+template<>
+inline void Load(
+    Vec3Packet<double,4> &dst,
+    const PackedVec3<double> *src,
+    const size_t count)
+{
+    if (count < 4) {
+        for (size_t i = 0; i < 4; ++i) {
+            bool valid = (i < count);
+            dst.x.data[i] = valid ? src[i].x : 0.0;
+            dst.y.data[i] = valid ? src[i].y : 0.0;
+            dst.z.data[i] = valid ? src[i].z : 0.0;
+        }
+        return;
+    }
+
+    const double *p = src[0].data;
+    __m256d a = _mm256_insertf128_pd(
+        _mm256_castpd128_pd256(_mm_loadu_pd(p + 0)), _mm_loadu_pd(p + 6), 1);
+    __m256d b = _mm256_insertf128_pd(
+        _mm256_castpd128_pd256(_mm_loadu_pd(p + 2)), _mm_loadu_pd(p + 8), 1);
+    __m256d c = _mm256_insertf128_pd(
+        _mm256_castpd128_pd256(_mm_loadu_pd(p + 4)), _mm_loadu_pd(p + 10), 1);
+
+    simd_store(dst.x, _mm256_shuffle_pd(a, b, 0b1010));
+    simd_store(dst.y, _mm256_shuffle_pd(a, c, 0b0101));
+    simd_store(dst.z, _mm256_shuffle_pd(b, c, 0b1010));
+}
+
+///
+/// @brief Store a packet into 4 PackedVec3d, the inverse shuffle of the load.
+///
+template<>
+inline void Store(
+    const Vec3Packet<double,4> &src,
+    PackedVec3<double> *dst,
+    const size_t count)
+{
+    if (count < 4) {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i].x = src.x.data[i];
+            dst[i].y = src.y.data[i];
+            dst[i].z = src.z.data[i];
+        }
+        return;
+    }
+
+    __m256d x = simd_load(src.x);
+    __m256d y = simd_load(src.y);
+    __m256d z = simd_load(src.z);
+    __m256d a = _mm256_shuffle_pd(x, y, 0b0000);
+    __m256d b = _mm256_shuffle_pd(z, x, 0b1010);
+    __m256d c = _mm256_shuffle_pd(y, z, 0b1111);
+
+    double *p = dst[0].data;
+    _mm_storeu_pd(p + 0,  _mm256_castpd256_pd128(a));
+    _mm_storeu_pd(p + 2,  _mm256_castpd256_pd128(b));
+    _mm_storeu_pd(p + 4,  _mm256_castpd256_pd128(c));
+    _mm_storeu_pd(p + 6,  _mm256_extractf128_pd(a, 1));
+    _mm_storeu_pd(p + 8,  _mm256_extractf128_pd(b, 1));
+    _mm_storeu_pd(p + 10, _mm256_extractf128_pd(c, 1));
+}
+
+/// ---- PackedVec3f simd load and store --------------------------------------
+/// @brief Load 8 PackedVec3f, 96 bytes, into a packet. Load the first four
+/// vectors into the low lanes and the last four into the high lanes of three
+/// registers, and deinterleave the elements within each lane:
+///
+///  m03 = {x0, y0, z0, x1 | x4, y4, z4, x5}       x = {x0, x1, x2, x3 | ...}
+///  m14 = {y1, z1, x2, y2 | y5, z5, x6, y6}   ->  y = {y0, y1, y2, y3 | ...}
+///  m25 = {z2, x3, y3, z3 | z6, x7, y7, z7}       z = {z0, z1, z2, z3 | ...}
+///
+/// @see https://software.intel.com/content/www/us/en/develop/articles/
+///      3d-vector-normalization-using-256-bit-intel-advanced-vector-
+///      extensions-intel-avx.html
+///
+template<>
+inline void Load(
+    Vec3Packet<float,8> &dst,
+    const PackedVec3<float> *src,
+    const size_t count)
+{
+    if (count < 8) {
+        for (size_t i = 0; i < 8; ++i) {
+            bool valid = (i < count);
+            dst.x.data[i] = valid ? src[i].x : 0.0f;
+            dst.y.data[i] = valid ? src[i].y : 0.0f;
+            dst.z.data[i] = valid ? src[i].z : 0.0f;
+        }
+        return;
+    }
+
+    const float *p = src[0].data;
+    __m256 m03 = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_loadu_ps(p + 0)), _mm_loadu_ps(p + 12), 1);
+    __m256 m14 = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+    __m256 m25 = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+    //
+    // xy = {x2, y2, x3, y3 | x6, y6, x7, y7}
+    // yz = {y0, z0, y1, z1 | y4, z4, y5, z5}
+    //
+    __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+    __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+
+    simd_store(dst.x, _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0)));
+    simd_store(dst.y, _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)));
+    simd_store(dst.z, _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1)));
+}
+
+///
+/// @brief Store a packet into 8 PackedVec3f, the inverse shuffle of the load.
+///
+template<>
+inline void Store(
+    const Vec3Packet<float,8> &src,
+    PackedVec3<float> *dst,
+    const size_t count)
+{
+    if (count < 8) {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i].x = src.x.data[i];
+            dst[i].y = src.y.data[i];
+            dst[i].z = src.z.data[i];
+        }
+        return;
+    }
+
+    __m256 x = simd_load(src.x);
+    __m256 y = simd_load(src.y);
+    __m256 z = simd_load(src.z);
+    //
+    // rxy = {x0, x2, y0, y2 | x4, x6, y4, y6}
+    // ryz = {y1, y3, z1, z3 | y5, y7, z5, z7}
+    // rzx = {z0, z2, x1, x3 | z4, z6, x5, x7}
+    //
+    __m256 rxy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 ryz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 rzx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+    __m256 m03 = _mm256_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 m14 = _mm256_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+    __m256 m25 = _mm256_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+    float *p = dst[0].data;
+    _mm_storeu_ps(p + 0,  _mm256_castps256_ps128(m03));
+    _mm_storeu_ps(p + 4,  _mm256_castps256_ps128(m14));
+    _mm_storeu_ps(p + 8,  _mm256_castps256_ps128(m25));
+    _mm_storeu_ps(p + 12, _mm256_extractf128_ps(m03, 1));
+    _mm_storeu_ps(p + 16, _mm256_extractf128_ps(m14, 1));
+    _mm_storeu_ps(p + 20, _mm256_extractf128_ps(m25, 1));
+}
+
+} // inline namespace MATH_SIMD_ISA
+} // namespace Math
+
+#endif // MATH_SIMD_PACKED_H_
@@ -0,0 +1,746 @@
+//
+// packet.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_SIMD_PACKET_H_
+#define MATH_SIMD_PACKET_H_
+
+#include "common.h"
+
+namespace Math {
+inline namespace MATH_SIMD_ISA {
+
+/// ---- Vec3 simd load and store ---------------------------------------------
+/// @brief Load the elements of a Vec3 with the padding element set to zero,
+/// and store them leaving the padding element unchanged, as simd_load and
+/// simd_store of the vectors. Those are compiled outside the instruction set
+/// namespace, and the packet functions never call them.
+///
+inline __m256d simd256_load3_(const Vec3<double> &v)
+{
+    const __m256i mask = _mm256_set_epi64x(0x0, -1, -1, -1);
+    return _mm256_maskload_pd(v.data, mask);
+}
+
+inline void simd256_store3_(Vec3<double> &v, const __m256d a)
+{
+    const __m256i mask = _mm256_set_epi64x(0x0, -1, -1, -1);
+    _mm256_maskstore_pd(v.data, mask, a);
+}
+
+inline __m128 simd128_load3_(const Vec3<float> &v)
+{
+    const __m128i mask = _mm_set_epi32(0x0, -1, -1, -1);
+    return _mm_maskload_ps(v.data, mask);
+}
+
+inline void simd128_store3_(Vec3<float> &v, const __m128 a)
+{
+    const __m128i mask = _mm_set_epi32(0x0, -1, -1, -1);
+    _mm_maskstore_ps(v.data, mask, a);
+}
+
+/// ---- Packet4d simd load and store -----------------------------------------
+/// @brief Load 256-bits (4 packed double-precision 64-bit) from a packet or a
+/// mask packet, and store them back.
+///
+inline __m256d simd_load(const Packet<double,4> &p)
+{
+    return _mm256_load_pd(p.data);
+}
+
+inline void simd_store(Packet<double,4> &p, const __m256d a)
+{
+    _mm256_store_pd(p.data, a);
+}
+
+inline __m256d simd_load(const MaskPacket<double,4> &m)
+{
+    return _mm256_castsi256_pd(
+        _mm256_load_si256(reinterpret_cast<const __m256i *>(m.data)));
+}
+
+inline void simd_store(MaskPacket<double,4> &m, const __m256d a)
+{
+    _mm256_store_si256(
+        reinterpret_cast<__m256i *>(m.data), _mm256_castpd_si256(a));
+}
+
+/// ---- Packet4d simd assignment operators -----------------------------------
+///
+template<>
+inline Packet<double,4> &operator+=(
+    Packet<double,4> &lhs, const Packet<double,4> &rhs)
+{
+    simd_store(lhs, _mm256_add_pd(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+inline Packet<double,4> &operator-=(
+    Packet<double,4> &lhs, const Packet<double,4> &rhs)
+{
+    simd_store(lhs, _mm256_sub_pd(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+inline Packet<double,4> &operator*=(
+    Packet<double,4> &lhs, const Packet<double,4> &rhs)
+{
+    simd_store(lhs, _mm256_mul_pd(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+inline Packet<double,4> &operator/=(
+    Packet<double,4> &lhs, const Packet<double,4> &rhs)
+{
+    simd_store(lhs, _mm256_div_pd(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+/// ---- Packet4d simd functions ----------------------------------------------
+///
+template<>
+inline Packet<double,4> Broadcast<double,4>(const double scalar)
+{
+    Packet<double,4> result;
+    simd_store(result, _mm256_set1_pd(scalar));
+    return result;
+}
+
+template<>
+inline void Load(Packet<double,4> &dst, const double *src, const size_t count)
+{
+    if (count >= 4) {
+        simd_store(dst, _mm256_loadu_pd(src));
+        return;
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        dst.data[i] = (i < count) ? src[i] : 0.0;
+    }
+}
+
+template<>
+inline void Store(const Packet<double,4> &src, double *dst, const size_t count)
+{
+    if (count >= 4) {
+        _mm256_storeu_pd(dst, simd_load(src));
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = src.data[i];
+    }
+}
+
+template<>
+inline Packet<double,4> MulAdd(
+    const Packet<double,4> &a,
+    const Packet<double,4> &b,
+    const Packet<double,4> &c)
+{
+    Packet<double,4> result;
+    simd_store(result,
+        simd256_madd_(simd_load(a), simd_load(b), simd_load(c)));
+    return result;
+}
+
+template<>
+inline Packet<double,4> Sqrt(const Packet<double,4> &u)
+{
+    Packet<double,4> result;
+    simd_store(result, _mm256_sqrt_pd(simd_load(u)));
+    return result;
+}
+
+///
+/// @brief Clear the sign bit of the packet elements.
+///
+template<>
+inline Packet<double,4> Abs(const Packet<double,4> &u)
+{
+    Packet<double,4> result;
+    simd_store(result, _mm256_andnot_pd(_mm256_set1_pd(-0.0), simd_load(u)));
+    return result;
+}
+
+template<>
+inline Packet<double,4> Floor(const Packet<double,4> &u)
+{
+    Packet<double,4> result;
+    simd_store(result, _mm256_floor_pd(simd_load(u)));
+    return result;
+}
+
+template<>
+inline Packet<double,4> Ceil(const Packet<double,4> &u)
+{
+    Packet<double,4> result;
+    simd_store(result, _mm256_ceil_pd(simd_load(u)));
+    return result;
+}
+
+///
+/// @brief Lane-wise minimum and maximum.
+/// @fn _mm256_min_pd(a, b) returns (a < b) ? a : b, and the operands are
+/// swapped so that the result matches std::min(u, v) = (v < u) ? v : u.
+///
+template<>
+inline Packet<double,4> Min(
+    const Packet<double,4> &u, const Packet<double,4> &v)
+{
+    Packet<double,4> result;
+    simd_store(result, _mm256_min_pd(simd_load(v), simd_load(u)));
+    return result;
+}
+
+template<>
+inline Packet<double,4> Max(
+    const Packet<double,4> &u, const Packet<double,4> &v)
+{
+    Packet<double,4> result;
+    simd_store(result, _mm256_max_pd(simd_load(v), simd_load(u)));
+    return result;
+}
+
+/// ---- Packet4d simd compare and select -------------------------------------
+/// @fn _mm256_cmp_pd(a, b, predicate) sets all bits of the lanes where the
+/// predicate holds. The ordered (OQ) predicates are false for NaN lanes, the
+/// unordered NEQ_UQ predicate is true.
+///
+template<>
+inline MaskPacket<double,4> Equal(
+    const Packet<double,4> &u, const Packet<double,4> &v)
+{
+    MaskPacket<double,4> result;
+    simd_store(result, _mm256_cmp_pd(simd_load(u), simd_load(v), _CMP_EQ_OQ));
+    return result;
+}
+
+template<>
+inline MaskPacket<double,4> NotEqual(
+    const Packet<double,4> &u, const Packet<double,4> &v)
+{
+    MaskPacket<double,4> result;
+    simd_store(result,
+        _mm256_cmp_pd(simd_load(u), simd_load(v), _CMP_NEQ_UQ));
+    return result;
+}
+
+template<>
+inline MaskPacket<double,4> Less(
+    const Packet<double,4> &u, const Packet<double,4> &v)
+{
+    MaskPacket<double,4> result;
+    simd_store(result, _mm256_cmp_pd(simd_load(u), simd_load(v), _CMP_LT_OQ));
+    return result;
+}
+
+template<>
+inline MaskPacket<double,4> LessEqual(
+    const Packet<double,4> &u, const Packet<double,4> &v)
+{
+    MaskPacket<double,4> result;
+    simd_store(result, _mm256_cmp_pd(simd_load(u), simd_load(v), _CMP_LE_OQ));
+    return result;
+}
+
+template<>
+inline MaskPacket<double,4> Greater(
+    const Packet<double,4> &u, const Packet<double,4> &v)
+{
+    MaskPacket<double,4> result;
+    simd_store(result, _mm256_cmp_pd(simd_load(u), simd_load(v), _CMP_GT_OQ));
+    return result;
+}
+
+template<>
+inline MaskPacket<double,4> GreaterEqual(
+    const Packet<double,4> &u, const Packet<double,4> &v)
+{
+    MaskPacket<double,4> result;
+    simd_store(result, _mm256_cmp_pd(simd_load(u), simd_load(v), _CMP_GE_OQ));
+    return result;
+}
+
+///
+/// @fn _mm256_blendv_pd(a, b, mask) selects the lanes of b where the sign bit
+/// of the mask is set and the lanes of a otherwise.
+///
+template<>
+inline Packet<double,4> Select(
+    const MaskPacket<double,4> &mask,
+    const Packet<double,4> &u,
+    const Packet<double,4> &v)
+{
+    Packet<double,4> result;
+    simd_store(result,
+        _mm256_blendv_pd(simd_load(v), simd_load(u), simd_load(mask)));
+    return result;
+}
+
+/// ---- Mask4d simd logical operators ----------------------------------------
+///
+template<>
+inline MaskPacket<double,4> operator&(
+    const MaskPacket<double,4> &lhs, const MaskPacket<double,4> &rhs)
+{
+    MaskPacket<double,4> result;
+    simd_store(result, _mm256_and_pd(simd_load(lhs), simd_load(rhs)));
+    return result;
+}
+
+template<>
+inline MaskPacket<double,4> operator|(
+    const MaskPacket<double,4> &lhs, const MaskPacket<double,4> &rhs)
+{
+    MaskPacket<double,4> result;
+    simd_store(result, _mm256_or_pd(simd_load(lhs), simd_load(rhs)));
+    return result;
+}
+
+template<>
+inline MaskPacket<double,4> operator^(
+    const MaskPacket<double,4> &lhs, const MaskPacket<double,4> &rhs)
+{
+    MaskPacket<double,4> result;
+    simd_store(result, _mm256_xor_pd(simd_load(lhs), simd_load(rhs)));
+    return result;
+}
+
+template<>
+inline MaskPacket<double,4> operator~(const MaskPacket<double,4> &lhs)
+{
+    const __m256d ones = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    MaskPacket<double,4> result;
+    simd_store(result, _mm256_xor_pd(simd_load(lhs), ones));
+    return result;
+}
+
+template<>
+inline bool Any(const MaskPacket<double,4> &mask)
+{
+    return _mm256_movemask_pd(simd_load(mask)) != 0;
+}
+
+template<>
+inline bool All(const MaskPacket<double,4> &mask)
+{
+    return _mm256_movemask_pd(simd_load(mask)) == 0xf;
+}
+
+/// ---- Vec3x4d simd load and store ------------------------------------------
+/// @brief Load an array of 4 Vec3d and transpose them into a packet:
+///
+///  src[0] = {x0, y0, z0, 0}       x = {x0, x1, x2, x3}
+///  src[1] = {x1, y1, z1, 0}   ->  y = {y0, y1, y2, y3}
+///  src[2] = {x2, y2, z2, 0}       z = {z0, z1, z2, z3}
+///  src[3] = {x3, y3, z3, 0}
+///
+/// The lanes beyond count are set to zero.
+///
+template<>
+inline void Load(
+    Vec3Packet<double,4> &dst,
+    const Vec3<double> *src,
+    const size_t count)
+{
+    __m256d row[4];
+    for (size_t i = 0; i < 4; ++i) {
+        row[i] = (i < count) ? simd256_load3_(src[i]) : _mm256_setzero_pd();
+    }
+    simd256_transpose_(row);
+    simd_store(dst.x, row[0]);
+    simd_store(dst.y, row[1]);
+    simd_store(dst.z, row[2]);
+}
+
+///
+/// @brief Transpose a packet back into an array of Vec3d and store the first
+/// count vectors.
+///
+template<>
+inline void Store(
+    const Vec3Packet<double,4> &src,
+    Vec3<double> *dst,
+    const size_t count)
+{
+    __m256d row[4] = {
+        simd_load(src.x),
+        simd_load(src.y),
+        simd_load(src.z),
+        _mm256_setzero_pd()};
+    simd256_transpose_(row);
+    for (size_t i = 0; i < 4 && i < count; ++i) {
+        simd256_store3_(dst[i], row[i]);
+    }
+}
+
+/// ---- Packet8f simd load and store -----------------------------------------
+/// @brief Load 256-bits (8 packed single-precision 32-bit) from a packet or a
+/// mask packet, and store them back.
+///
+inline __m256 simd_load(const Packet<float,8> &p)
+{
+    return _mm256_load_ps(p.data);
+}
+
+inline void simd_store(Packet<float,8> &p, const __m256 a)
+{
+    _mm256_store_ps(p.data, a);
+}
+
+inline __m256 simd_load(const MaskPacket<float,8> &m)
+{
+    return _mm256_castsi256_ps(
+        _mm256_load_si256(reinterpret_cast<const __m256i *>(m.data)));
+}
+
+inline void simd_store(MaskPacket<float,8> &m, const __m256 a)
+{
+    _mm256_store_si256(
+        reinterpret_cast<__m256i *>(m.data), _mm256_castps_si256(a));
+}
+
+/// ---- Packet8f simd assignment operators -----------------------------------
+///
+template<>
+inline Packet<float,8> &operator+=(
+    Packet<float,8> &lhs, const Packet<float,8> &rhs)
+{
+    simd_store(lhs, _mm256_add_ps(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+inline Packet<float,8> &operator-=(
+    Packet<float,8> &lhs, const Packet<float,8> &rhs)
+{
+    simd_store(lhs, _mm256_sub_ps(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+inline Packet<float,8> &operator*=(
+    Packet<float,8> &lhs, const Packet<float,8> &rhs)
+{
+    simd_store(lhs, _mm256_mul_ps(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+inline Packet<float,8> &operator/=(
+    Packet<float,8> &lhs, const Packet<float,8> &rhs)
+{
+    simd_store(lhs, _mm256_div_ps(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+/// ---- Packet8f simd functions ----------------------------------------------
+///
+template<>
+inline Packet<float,8> Broadcast<float,8>(const float scalar)
+{
+    Packet<float,8> result;
+    simd_store(result, _mm256_set1_ps(scalar));
+    return result;
+}
+
+template<>
+inline void Load(Packet<float,8> &dst, const float *src, const size_t count)
+{
+    if (count >= 8) {
+        simd_store(dst, _mm256_loadu_ps(src));
+        return;
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        dst.data[i] = (i < count) ? src[i] : 0.0f;
+    }
+}
+
+template<>
+inline void Store(const Packet<float,8> &src, float *dst, const size_t count)
+{
+    if (count >= 8) {
+        _mm256_storeu_ps(dst, simd_load(src));
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = src.data[i];
+    }
+}
+
+template<>
+inline Packet<float,8> MulAdd(
+    const Packet<float,8> &a,
+    const Packet<float,8> &b,
+    const Packet<float,8> &c)
+{
+    Packet<float,8> result;
+    simd_store(result,
+        simd256_madd_(simd_load(a), simd_load(b), simd_load(c)));
+    return result;
+}
+
+template<>
+inline Packet<float,8> Sqrt(const Packet<float,8> &u)
+{
+    Packet<float,8> result;
+    simd_store(result, _mm256_sqrt_ps(simd_load(u)));
+    return result;
+}
+
+template<>
+inline Packet<float,8> Abs(const Packet<float,8> &u)
+{
+    Packet<float,8> result;
+    simd_store(result, _mm256_andnot_ps(_mm256_set1_ps(-0.0f), simd_load(u)));
+    return result;
+}
+
+template<>
+inline Packet<float,8> Floor(const Packet<float,8> &u)
+{
+    Packet<float,8> result;
+    simd_store(result, _mm256_floor_ps(simd_load(u)));
+    return result;
+}
+
+template<>
+inline Packet<float,8> Ceil(const Packet<float,8> &u)
+{
+    Packet<float,8> result;
+    simd_store(result, _mm256_ceil_ps(simd_load(u)));
+    return result;
+}
+
+template<>
+inline Packet<float,8> Min(const Packet<float,8> &u, const Packet<float,8> &v)
+{
+    Packet<float,8> result;
+    simd_store(result, _mm256_min_ps(simd_load(v), simd_load(u)));
+    return result;
+}
+
+template<>
+inline Packet<float,8> Max(const Packet<float,8> &u, const Packet<float,8> &v)
+{
+    Packet<float,8> result;
+    simd_store(result, _mm256_max_ps(simd_load(v), simd_load(u)));
+    return result;
+}
+
+/// ---- Packet8f simd compare and select -------------------------------------
+///
+template<>
+inline MaskPacket<float,8> Equal(
+    const Packet<float,8> &u, const Packet<float,8> &v)
+{
+    MaskPacket<float,8> result;
+    simd_store(result, _mm256_cmp_ps(simd_load(u), simd_load(v), _CMP_EQ_OQ));
+    return result;
+}
+
+template<>
+inline MaskPacket<float,8> NotEqual(
+    const Packet<float,8> &u, const Packet<float,8> &v)
+{
+    MaskPacket<float,8> result;
+    simd_store(result,
+        _mm256_cmp_ps(simd_load(u), simd_load(v), _CMP_NEQ_UQ));
+    return result;
+}
+
+template<>
+inline MaskPacket<float,8> Less(
+    const Packet<float,8> &u, const Packet<float,8> &v)
+{
+    MaskPacket<float,8> result;
+    simd_store(result, _mm256_cmp_ps(simd_load(u), simd_load(v), _CMP_LT_OQ));
+    return result;
+}
+
+template<>
+inline MaskPacket<float,8> LessEqual(
+    const Packet<float,8> &u, const Packet<float,8> &v)
+{
+    MaskPacket<float,8> result;
+    simd_store(result, _mm256_cmp_ps(simd_load(u), simd_load(v), _CMP_LE_OQ));
+    return result;
+}
+
+template<>
+inline MaskPacket<float,8> Greater(
+    const Packet<float,8> &u, const Packet<float,8> &v)
+{
+    MaskPacket<float,8> result;
+    simd_store(result, _mm256_cmp_ps(simd_load(u), simd_load(v), _CMP_GT_OQ));
+    return result;
+}
+
+template<>
+inline MaskPacket<float,8> GreaterEqual(
+    const Packet<float,8> &u, const Packet<float,8> &v)
+{
+    MaskPacket<float,8> result;
+    simd_store(result, _mm256_cmp_ps(simd_load(u), simd_load(v), _CMP_GE_OQ));
+    return result;
+}
+
+template<>
+inline Packet<float,8> Select(
+    const MaskPacket<float,8> &mask,
+    const Packet<float,8> &u,
+    const Packet<float,8> &v)
+{
+    Packet<float,8> result;
+    simd_store(result,
+        _mm256_blendv_ps(simd_load(v), simd_load(u), simd_load(mask)));
+    return result;
+}
+
+/// ---- Mask8f simd logical operators ----------------------------------------
+///
+template<>
+inline MaskPacket<float,8> operator&(
+    const MaskPacket<float,8> &lhs, const MaskPacket<float,8> &rhs)
+{
+    MaskPacket<float,8> result;
+    simd_store(result, _mm256_and_ps(simd_load(lhs), simd_load(rhs)));
+    return result;
+}
+
+template<>
+inline MaskPacket<float,8> operator|(
+    const MaskPacket<float,8> &lhs, const MaskPacket<float,8> &rhs)
+{
+    MaskPacket<float,8> result;
+    simd_store(result, _mm256_or_ps(simd_load(lhs), simd_load(rhs)));
+    return result;
+}
+
+template<>
+inline MaskPacket<float,8> operator^(
+    const MaskPacket<float,8> &lhs, const MaskPacket<float,8> &rhs)
+{
+    MaskPacket<float,8> result;
+    simd_store(result, _mm256_xor_ps(simd_load(lhs), simd_load(rhs)));
+    return result;
+}
+
+template<>
+inline MaskPacket<float,8> operator~(const MaskPacket<float,8> &lhs)
+{
+    const __m256 ones = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    MaskPacket<float,8> result;
+    simd_store(result, _mm256_xor_ps(simd_load(lhs), ones));
+    return result;
+}
+
+template<>
+inline bool Any(const MaskPacket<float,8> &mask)
+{
+    return _mm256_movemask_ps(simd_load(mask)) != 0;
+}
+
+template<>
+inline bool All(const MaskPacket<float,8> &mask)
+{
+    return _mm256_movemask_ps(simd_load(mask)) == 0xff;
+}
+
+/// ---- Vec3x8f simd load and store ------------------------------------------
+/// @brief Load an array of 8 Vec3f and transpose them into a packet. Pair the
+/// vectors k and k+4 in the low and high lanes of a 256-bit register and
+/// transpose the 4x4 blocks of each 128-bit lane:
+///
+///  a0 = {x0, y0, z0, 0 | x4, y4, z4, 0}       x = {x0, x1, x2, x3 | x4, ...}
+///  a1 = {x1, y1, z1, 0 | x5, y5, z5, 0}   ->  y = {y0, y1, y2, y3 | y4, ...}
+///  a2 = {x2, y2, z2, 0 | x6, y6, z6, 0}       z = {z0, z1, z2, z3 | z4, ...}
+///  a3 = {x3, y3, z3, 0 | x7, y7, z7, 0}
+///
+/// The lanes beyond count are set to zero.
+///
+template<>
+inline void Load(
+    Vec3Packet<float,8> &dst,
+    const Vec3<float> *src,
+    const size_t count)
+{
+    __m128 row[8];
+    for (size_t i = 0; i < 8; ++i) {
+        row[i] = (i < count) ? simd128_load3_(src[i]) : _mm_setzero_ps();
+    }
+
+    __m256 a[4];
+    for (size_t k = 0; k < 4; ++k) {
+        a[k] = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(row[k]), row[k + 4], 1);
+    }
+    //
+    // t0 = {x0, x1, y0, y1 | x4, x5, y4, y5}
+    // t1 = {x2, x3, y2, y3 | x6, x7, y6, y7}
+    // t2 = {z0, z1,  0,  0 | z4, z5,  0,  0}
+    // t3 = {z2, z3,  0,  0 | z6, z7,  0,  0}
+    //
+    __m256 t0 = _mm256_unpacklo_ps(a[0], a[1]);
+    __m256 t1 = _mm256_unpacklo_ps(a[2], a[3]);
+    __m256 t2 = _mm256_unpackhi_ps(a[0], a[1]);
+    __m256 t3 = _mm256_unpackhi_ps(a[2], a[3]);
+
+    simd_store(dst.x, _mm256_shuffle_ps(t0, t1, 0b01000100));
+    simd_store(dst.y, _mm256_shuffle_ps(t0, t1, 0b11101110));
+    simd_store(dst.z, _mm256_shuffle_ps(t2, t3, 0b01000100));
+}
+
+///
+/// @brief Transpose a packet back into an array of Vec3f and store the first
+/// count vectors.
+///
+template<>
+inline void Store(
+    const Vec3Packet<float,8> &src,
+    Vec3<float> *dst,
+    const size_t count)
+{
+    __m256 x = simd_load(src.x);
+    __m256 y = simd_load(src.y);
+    __m256 z = simd_load(src.z);
+    __m256 w = _mm256_setzero_ps();
+    //
+    // t0 = {x0, y0, x1, y1 | x4, y4, x5, y5}
+    // t1 = {z0,  0, z1,  0 | z4,  0, z5,  0}
+    // t2 = {x2, y2, x3, y3 | x6, y6, x7, y7}
+    // t3 = {z2,  0, z3,  0 | z6,  0, z7,  0}
+    //
+    __m256 t0 = _mm256_unpacklo_ps(x, y);
+    __m256 t1 = _mm256_unpacklo_ps(z, w);
+    __m256 t2 = _mm256_unpackhi_ps(x, y);
+    __m256 t3 = _mm256_unpackhi_ps(z, w);
+
+    __m256 a[4] = {
+        _mm256_shuffle_ps(t0, t1, 0b01000100),
+        _mm256_shuffle_ps(t0, t1, 0b11101110),
+        _mm256_shuffle_ps(t2, t3, 0b01000100),
+        _mm256_shuffle_ps(t2, t3, 0b11101110)};
+
+    for (size_t k = 0; k < 4; ++k) {
+        if (k < count) {
+            simd128_store3_(dst[k], _mm256_castps256_ps128(a[k]));
+        }
+        if (k + 4 < count) {
+            simd128_store3_(dst[k + 4], _mm256_extractf128_ps(a[k], 1));
+        }
+    }
+}
+
+} // inline namespace MATH_SIMD_ISA
+} // namespace Math
+
+#endif // MATH_SIMD_PACKET_H_
@@ -0,0 +1,292 @@
+//
+// quat.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef MATH_SIMD_QUAT_H_
+#define MATH_SIMD_QUAT_H_
+
+#include "common.h"
+
+namespace Math {
+inline namespace MATH_SIMD_ISA {
+
+/// ---- simd load/store functions --------------------------------------------
+/// @brief Load 256-bits (4 packed double-precision 64-bit) from a Quat array.
+///
+inline __m256d simd_load(const Quat<double> &q)
+{
+    return _mm256_load_pd(q.data);
+}
+
+///
+/// @brief Store 256-bits (4 packed double-precision 64-bit) into a Quat array.
+///
+inline void simd_store(Quat<double> &q, const __m256d a)
+{
+    _mm256_store_pd(q.data, a);
+}
+
+///
+/// @brief Load 128-bits (4 packed single-precision 32-bit) from a Quat array.
+///
+inline __m128 simd_load(const Quat<float> &q)
+{
+    return _mm_load_ps(q.data);
+}
+
+///
+/// @brief Store 128-bits (4 packed single-precision 32-bit) into a Quat array.
+///
+inline void simd_store(Quat<float> &q, const __m128 a)
+{
+    _mm_store_ps(q.data, a);
+}
+
+/// ---- Quaternion product intrinsics ----------------------------------------
+/// @brief Hamilton product of two quaternions a*b. Each term of the product is
+/// a permutation of b with alternating signs, scaled by one element of a:
+///
+///  a*b = aw * {bx,  by,  bz,  bw}
+///      + ax * {bw, -bz,  by, -bx}
+///      + ay * {bz,  bw, -bx, -by}
+///      + az * {-by, bx,  bw, -bz}
+///
+/// The double precision permutations swap the 128-bit halves and the elements
+/// within each half, with no cross-lane permute instruction in AVX.
+///
+inline __m256d simd256_quatmul_(const Quat<double> &a, __m256d b)
+{
+    const __m256d sign1 = _mm256_set_pd(-0.0,  0.0, -0.0,  0.0);
+    const __m256d sign2 = _mm256_set_pd(-0.0, -0.0,  0.0,  0.0);
+    const __m256d sign3 = _mm256_set_pd(-0.0,  0.0,  0.0, -0.0);
+    //
+    // b2 = {bz, bw, bx, by}
+    // b1 = {bw, bz, by, bx}
+    // b3 = {by, bx, bw, bz}
+    //
+    __m256d b2 = _mm256_permute2f128_pd(b, b, 0b0001);
+    __m256d b1 = _mm256_permute_pd(b2, 0b0101);
+    __m256d b3 = _mm256_permute_pd(b, 0b0101);
+
+    __m256d r = _mm256_mul_pd(_mm256_broadcast_sd(&a.w), b);
+    r = simd256_madd_(
+        _mm256_broadcast_sd(&a.x), _mm256_xor_pd(b1, sign1), r);
+    r = simd256_madd_(
+        _mm256_broadcast_sd(&a.y), _mm256_xor_pd(b2, sign2), r);
+    r = simd256_madd_(
+        _mm256_broadcast_sd(&a.z), _mm256_xor_pd(b3, sign3), r);
+    return r;
+}
+
+inline __m128 simd128_quatmul_(__m128 a, __m128 b)
+{
+    const __m128 sign1 = _mm_set_ps(-0.0f,  0.0f, -0.0f,  0.0f);
+    const __m128 sign2 = _mm_set_ps(-0.0f, -0.0f,  0.0f,  0.0f);
+    const __m128 sign3 = _mm_set_ps(-0.0f,  0.0f,  0.0f, -0.0f);
+
+    __m128 b1 = _mm_xor_ps(simd128_swizzle_ps(b, 3, 2, 1, 0), sign1);
+    __m128 b2 = _mm_xor_ps(simd128_swizzle_ps(b, 2, 3, 0, 1), sign2);
+    __m128 b3 = _mm_xor_ps(simd128_swizzle_ps(b, 1, 0, 3, 2), sign3);
+
+    __m128 r = _mm_mul_ps(simd128_swizzle_ps(a, 3, 3, 3, 3), b);
+    r = simd128_madd_(simd128_swizzle_ps(a, 0, 0, 0, 0), b1, r);
+    r = simd128_madd_(simd128_swizzle_ps(a, 1, 1, 1, 1), b2, r);
+    r = simd128_madd_(simd128_swizzle_ps(a, 2, 2, 2, 2), b3, r);
+    return r;
+}
+
+/// ---- Quatd simd operators -------------------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Quat<double> &operator+=(
+    Quat<double> &lhs, const Quat<double> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    simd_store(lhs, _mm256_add_pd(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Quat<double> &operator-=(
+    Quat<double> &lhs, const Quat<double> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    simd_store(lhs, _mm256_sub_pd(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Quat<double> &operator*=(
+    Quat<double> &lhs, const Quat<double> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarQuatMul(lhs, rhs);
+    }
+
+    simd_store(lhs, simd256_quatmul_(lhs, simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Quat<double> &operator*=(
+    Quat<double> &lhs, const double scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m256d s = _mm256_set1_pd(scalar);
+    simd_store(lhs, _mm256_mul_pd(simd_load(lhs), s));
+    return lhs;
+}
+
+///
+/// @brief Return the dot product and the unit quaternion.
+///
+template<>
+MATH_SIMD_CONSTEXPR double Dot(const Quat<double> &a, const Quat<double> &b)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, b);
+    }
+
+    return _mm256_cvtsd_f64(simd256_dot_(simd_load(a), simd_load(b)));
+}
+
+template<>
+inline Quat<double> Normalize(const Quat<double> &a)
+{
+    Quat<double> result{};
+    simd_store(result, simd256_normalize_(simd_load(a)));
+    return result;
+}
+
+///
+/// @brief Normalized linear interpolation along the shortest path, with the
+/// sign of the second weight taken from the sign of the dot product.
+///
+template<>
+inline Quat<double> Nlerp(
+    const Quat<double> &a, const Quat<double> &b, const double t)
+{
+    const __m256d qa = simd_load(a);
+    const __m256d qb = simd_load(b);
+    const __m256d dot = simd256_dot_(qa, qb);
+    const __m256d sign = _mm256_and_pd(dot, _mm256_set1_pd(-0.0));
+
+    __m256d wa = _mm256_set1_pd(1.0 - t);
+    __m256d wb = _mm256_xor_pd(_mm256_set1_pd(t), sign);
+    __m256d r = simd256_madd_(qb, wb, _mm256_mul_pd(qa, wa));
+
+    Quat<double> result{};
+    simd_store(result, simd256_normalize_(r));
+    return result;
+}
+
+/// ---- Quatf simd operators -------------------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Quat<float> &operator+=(
+    Quat<float> &lhs, const Quat<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    simd_store(lhs, _mm_add_ps(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Quat<float> &operator-=(
+    Quat<float> &lhs, const Quat<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    simd_store(lhs, _mm_sub_ps(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Quat<float> &operator*=(
+    Quat<float> &lhs, const Quat<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarQuatMul(lhs, rhs);
+    }
+
+    simd_store(lhs, simd128_quatmul_(simd_load(lhs), simd_load(rhs)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Quat<float> &operator*=(
+    Quat<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    simd_store(lhs, _mm_mul_ps(simd_load(lhs), _mm_set1_ps(scalar)));
+    return lhs;
+}
+
+///
+/// @brief Return the dot product and the unit quaternion.
+///
+template<>
+MATH_SIMD_CONSTEXPR float Dot(const Quat<float> &a, const Quat<float> &b)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDot(a, b);
+    }
+
+    return _mm_cvtss_f32(simd128_dot_(simd_load(a), simd_load(b)));
+}
+
+template<>
+inline Quat<float> Normalize(const Quat<float> &a)
+{
+    Quat<float> result{};
+    simd_store(result, simd128_normalize_(simd_load(a)));
+    return result;
+}
+
+///
+/// @brief Normalized linear interpolation along the shortest path.
+///
+template<>
+inline Quat<float> Nlerp(
+    const Quat<float> &a, const Quat<float> &b, const float t)
+{
+    const __m128 qa = simd_load(a);
+    const __m128 qb = simd_load(b);
+    const __m128 dot = simd128_dot_(qa, qb);
+    const __m128 sign = _mm_and_ps(dot, _mm_set1_ps(-0.0f));
+
+    __m128 wa = _mm_set1_ps(1.0f - t);
+    __m128 wb = _mm_xor_ps(_mm_set1_ps(t), sign);
+    __m128 r = simd128_madd_(qb, wb, _mm_mul_ps(qa, wa));
+
+    Quat<float> result{};
+    simd_store(result, simd128_normalize_(r));
+    return result;
+}
+
+} // inline namespace MATH_SIMD_ISA
+} // namespace Math
+
+#endif // MATH_SIMD_QUAT_H_
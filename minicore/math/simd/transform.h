@@ -13,6 +13,7 @@
 #include "common.h"
 
 namespace Math {
+inline namespace MATH_SIMD_ISA {
 
 /// -----------------------------------------------------------------------------
 /// @brief Rotate the matrix around n-axis by using Rodrigues formula.
@@ -37,35 +38,21 @@ inline Mat4<double> Rotate(Vec3<double> n, const double theta)
     __m256d nn0 = _mm256_set1_pd(n.x);
     __m256d nn1 = _mm256_set1_pd(n.y);
     __m256d nn2 = _mm256_set1_pd(n.z);
-    __m256d nn3 = one3;
 
     nn0 = _mm256_mul_pd(alpha, _mm256_mul_pd(nn0, nn));
     nn1 = _mm256_mul_pd(alpha, _mm256_mul_pd(nn1, nn));
     nn2 = _mm256_mul_pd(alpha, _mm256_mul_pd(nn2, nn));
-    nn3 = _mm256_mul_pd(alpha, nn3);
-
-    // Compute identity matrix
-    __m256d id0 = _mm256_mul_pd(beta, one0);
-    __m256d id1 = _mm256_mul_pd(beta, one1);
-    __m256d id2 = _mm256_mul_pd(beta, one2);
-    __m256d id3 = _mm256_mul_pd(beta, one3);
 
     // Compute cross product matrix
     __m256d rc0 = _mm256_set_pd(0.0,  n.y, -n.z,  0.0);
     __m256d rc1 = _mm256_set_pd(0.0, -n.x,  0.0,  n.z);
     __m256d rc2 = _mm256_set_pd(0.0,  0.0,  n.x, -n.y);
-    __m256d rc3 = _mm256_set_pd(1.0,  0.0,  0.0,  1.0);
-
-    rc0 = _mm256_mul_pd(gamma, rc0);
-    rc1 = _mm256_mul_pd(gamma, rc1);
-    rc2 = _mm256_mul_pd(gamma, rc2);
-    rc3 = _mm256_mul_pd(gamma, rc3);
 
-    // Compute rotation matrix
-    __m256d rot0 = _mm256_add_pd(nn0, _mm256_add_pd(id0, rc0));
-    __m256d rot1 = _mm256_add_pd(nn1, _mm256_add_pd(id1, rc1));
-    __m256d rot2 = _mm256_add_pd(nn2, _mm256_add_pd(id2, rc2));
-    __m256d rot3 = _mm256_add_pd(nn3, _mm256_add_pd(id3, rc3));
+    // Compute rotation matrix, the last row is the homogeneous unit row.
+    __m256d rot0 = simd256_madd_(beta, one0, simd256_madd_(gamma, rc0, nn0));
+    __m256d rot1 = simd256_madd_(beta, one1, simd256_madd_(gamma, rc1, nn1));
+    __m256d rot2 = simd256_madd_(beta, one2, simd256_madd_(gamma, rc2, nn2));
+    __m256d rot3 = one3;
 
     Mat4<double> result{};
     simd_store(result, 0, rot0);
@@ -75,6 +62,46 @@ inline Mat4<double> Rotate(Vec3<double> n, const double theta)
     return result;
 }
 
+template<>
+inline Mat4<float> Rotate(Vec3<float> n, const float theta)
+{
+    // Identity matrix
+    const __m128 one0 = _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f);
+    const __m128 one1 = _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f);
+    const __m128 one2 = _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f);
+    const __m128 one3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+    // Compute trigonometric coefficients
+    __m128 alpha = _mm_set1_ps(1.0f - std::cos(theta));
+    __m128 beta  = _mm_set1_ps(std::cos(theta));
+    __m128 gamma = _mm_set1_ps(std::sin(theta));
+
+    // Compute diadic product matrix
+    n = Normalize(n);
+    __m128 nn  = simd_load(n);
+    __m128 nn0 = _mm_mul_ps(alpha, _mm_mul_ps(_mm_set1_ps(n.x), nn));
+    __m128 nn1 = _mm_mul_ps(alpha, _mm_mul_ps(_mm_set1_ps(n.y), nn));
+    __m128 nn2 = _mm_mul_ps(alpha, _mm_mul_ps(_mm_set1_ps(n.z), nn));
+
+    // Compute cross product matrix
+    __m128 rc0 = _mm_setr_ps( 0.0f, -n.z,   n.y, 0.0f);
+    __m128 rc1 = _mm_setr_ps(  n.z, 0.0f, -n.x, 0.0f);
+    __m128 rc2 = _mm_setr_ps( -n.y,  n.x, 0.0f, 0.0f);
+
+    // Compute rotation matrix, the last row is the homogeneous unit row.
+    __m128 rot0 = simd128_madd_(beta, one0, simd128_madd_(gamma, rc0, nn0));
+    __m128 rot1 = simd128_madd_(beta, one1, simd128_madd_(gamma, rc1, nn1));
+    __m128 rot2 = simd128_madd_(beta, one2, simd128_madd_(gamma, rc2, nn2));
+
+    Mat4<float> result{};
+    simd_store(result, 0, rot0);
+    simd_store(result, 1, rot1);
+    simd_store(result, 2, rot2);
+    simd_store(result, 3, one3);
+    return result;
+}
+
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 #endif // MATH_SIMD_TRANSFORM_H_
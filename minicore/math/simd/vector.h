@@ -13,6 +13,7 @@
 #include "common.h"
 
 namespace Math {
+inline namespace MATH_SIMD_ISA {
 
 /// ---- simd load/store functions --------------------------------------------
 /// @brief Load 128-bits (2 packed double-precision 64-bit) from a Vec2 array.
@@ -105,8 +106,13 @@ inline void simd_store(Vec4<double> &v, const __m256d a)
 /// ---- Vec2 simd assignment operators ---------------------------------------
 ///
 template<>
-inline Vec2<double> &operator+=(Vec2<double> &lhs, const Vec2<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec2<double> &operator+=(
+    Vec2<double> &lhs, const Vec2<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
     const __m128d a = simd_load(lhs);
     const __m128d b = simd_load(rhs);
     simd_store(lhs, _mm_add_pd(a, b));
@@ -114,8 +120,13 @@ inline Vec2<double> &operator+=(Vec2<double> &lhs, const Vec2<double> &rhs)
 }
 
 template<>
-inline Vec2<double> &operator-=(Vec2<double> &lhs, const Vec2<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec2<double> &operator-=(
+    Vec2<double> &lhs, const Vec2<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
     const __m128d a = simd_load(lhs);
     const __m128d b = simd_load(rhs);
     simd_store(lhs, _mm_sub_pd(a, b));
@@ -123,8 +134,13 @@ inline Vec2<double> &operator-=(Vec2<double> &lhs, const Vec2<double> &rhs)
 }
 
 template<>
-inline Vec2<double> &operator*=(Vec2<double> &lhs, const Vec2<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec2<double> &operator*=(
+    Vec2<double> &lhs, const Vec2<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
     const __m128d a = simd_load(lhs);
     const __m128d b = simd_load(rhs);
     simd_store(lhs, _mm_mul_pd(a, b));
@@ -132,8 +148,13 @@ inline Vec2<double> &operator*=(Vec2<double> &lhs, const Vec2<double> &rhs)
 }
 
 template<>
-inline Vec2<double> &operator/=(Vec2<double> &lhs, const Vec2<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec2<double> &operator/=(
+    Vec2<double> &lhs, const Vec2<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
     const __m128d a = simd_load(lhs);
     const __m128d b = simd_load(rhs);
     simd_store(lhs, _mm_div_pd(a, b));
@@ -141,8 +162,13 @@ inline Vec2<double> &operator/=(Vec2<double> &lhs, const Vec2<double> &rhs)
 }
 
 template<>
-inline Vec2<double> &operator+=(Vec2<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec2<double> &operator+=(
+    Vec2<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
     const __m128d a = simd_load(lhs);
     const __m128d b = _mm_set1_pd(scalar);
     simd_store(lhs, _mm_add_pd(a, b));
@@ -150,8 +176,13 @@ inline Vec2<double> &operator+=(Vec2<double> &lhs, const double scalar)
 }
 
 template<>
-inline Vec2<double> &operator-=(Vec2<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec2<double> &operator-=(
+    Vec2<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
     const __m128d a = simd_load(lhs);
     const __m128d b = _mm_set1_pd(scalar);
     simd_store(lhs, _mm_sub_pd(a, b));
@@ -159,8 +190,13 @@ inline Vec2<double> &operator-=(Vec2<double> &lhs, const double scalar)
 }
 
 template<>
-inline Vec2<double> &operator*=(Vec2<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec2<double> &operator*=(
+    Vec2<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
     const __m128d a = simd_load(lhs);
     const __m128d b = _mm_set1_pd(scalar);
     simd_store(lhs, _mm_mul_pd(a, b));
@@ -168,8 +204,13 @@ inline Vec2<double> &operator*=(Vec2<double> &lhs, const double scalar)
 }
 
 template<>
-inline Vec2<double> &operator/=(Vec2<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec2<double> &operator/=(
+    Vec2<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
     const __m128d a = simd_load(lhs);
     const __m128d b = _mm_set1_pd(scalar);
     simd_store(lhs, _mm_div_pd(a, b));
@@ -179,8 +220,13 @@ inline Vec2<double> &operator/=(Vec2<double> &lhs, const double scalar)
 /// ---- Vec2 simd arithmetic operators ---------------------------------------
 ///
 template<>
-inline Vec2<double> operator+(const double scalar, Vec2<double> rhs)
+MATH_SIMD_CONSTEXPR Vec2<double> operator+(
+    const double scalar, Vec2<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
     const __m128d a = _mm_set1_pd(scalar);
     const __m128d b = simd_load(rhs);
     simd_store(rhs, _mm_add_pd(a, b));
@@ -188,8 +234,13 @@ inline Vec2<double> operator+(const double scalar, Vec2<double> rhs)
 }
 
 template<>
-inline Vec2<double> operator-(const double scalar, Vec2<double> rhs)
+MATH_SIMD_CONSTEXPR Vec2<double> operator-(
+    const double scalar, Vec2<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
     const __m128d a = _mm_set1_pd(scalar);
     const __m128d b = simd_load(rhs);
     simd_store(rhs, _mm_sub_pd(a, b));
@@ -197,8 +248,13 @@ inline Vec2<double> operator-(const double scalar, Vec2<double> rhs)
 }
 
 template<>
-inline Vec2<double> operator*(const double scalar, Vec2<double> rhs)
+MATH_SIMD_CONSTEXPR Vec2<double> operator*(
+    const double scalar, Vec2<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
     const __m128d a = _mm_set1_pd(scalar);
     const __m128d b = simd_load(rhs);
     simd_store(rhs, _mm_mul_pd(a, b));
@@ -206,8 +262,13 @@ inline Vec2<double> operator*(const double scalar, Vec2<double> rhs)
 }
 
 template<>
-inline Vec2<double> operator/(const double scalar, Vec2<double> rhs)
+MATH_SIMD_CONSTEXPR Vec2<double> operator/(
+    const double scalar, Vec2<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
     const __m128d a = _mm_set1_pd(scalar);
     const __m128d b = simd_load(rhs);
     simd_store(rhs, _mm_div_pd(a, b));
@@ -217,8 +278,13 @@ inline Vec2<double> operator/(const double scalar, Vec2<double> rhs)
 /// ---- Vec3 simd assignment operators ---------------------------------------
 ///
 template<>
-inline Vec3<double> &operator+=(Vec3<double> &lhs, const Vec3<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec3<double> &operator+=(
+    Vec3<double> &lhs, const Vec3<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = simd_load(rhs);
     simd_store(lhs, _mm256_add_pd(a, b));
@@ -226,8 +292,13 @@ inline Vec3<double> &operator+=(Vec3<double> &lhs, const Vec3<double> &rhs)
 }
 
 template<>
-inline Vec3<double> &operator-=(Vec3<double> &lhs, const Vec3<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec3<double> &operator-=(
+    Vec3<double> &lhs, const Vec3<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = simd_load(rhs);
     simd_store(lhs, _mm256_sub_pd(a, b));
@@ -235,8 +306,13 @@ inline Vec3<double> &operator-=(Vec3<double> &lhs, const Vec3<double> &rhs)
 }
 
 template<>
-inline Vec3<double> &operator*=(Vec3<double> &lhs, const Vec3<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec3<double> &operator*=(
+    Vec3<double> &lhs, const Vec3<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = simd_load(rhs);
     simd_store(lhs, _mm256_mul_pd(a, b));
@@ -244,8 +320,13 @@ inline Vec3<double> &operator*=(Vec3<double> &lhs, const Vec3<double> &rhs)
 }
 
 template<>
-inline Vec3<double> &operator/=(Vec3<double> &lhs, const Vec3<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec3<double> &operator/=(
+    Vec3<double> &lhs, const Vec3<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = simd_load(rhs);
     simd_store(lhs, _mm256_div_pd(a, b));
@@ -253,8 +334,13 @@ inline Vec3<double> &operator/=(Vec3<double> &lhs, const Vec3<double> &rhs)
 }
 
 template<>
-inline Vec3<double> &operator+=(Vec3<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec3<double> &operator+=(
+    Vec3<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = _mm256_set1_pd(scalar);
     simd_store(lhs, _mm256_add_pd(a, b));
@@ -262,8 +348,13 @@ inline Vec3<double> &operator+=(Vec3<double> &lhs, const double scalar)
 }
 
 template<>
-inline Vec3<double> &operator-=(Vec3<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec3<double> &operator-=(
+    Vec3<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = _mm256_set1_pd(scalar);
     simd_store(lhs, _mm256_sub_pd(a, b));
@@ -271,8 +362,13 @@ inline Vec3<double> &operator-=(Vec3<double> &lhs, const double scalar)
 }
 
 template<>
-inline Vec3<double> &operator*=(Vec3<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec3<double> &operator*=(
+    Vec3<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = _mm256_set1_pd(scalar);
     simd_store(lhs, _mm256_mul_pd(a, b));
@@ -280,8 +376,13 @@ inline Vec3<double> &operator*=(Vec3<double> &lhs, const double scalar)
 }
 
 template<>
-inline Vec3<double> &operator/=(Vec3<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec3<double> &operator/=(
+    Vec3<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = _mm256_set1_pd(scalar);
     simd_store(lhs, _mm256_div_pd(a, b));
@@ -291,8 +392,13 @@ inline Vec3<double> &operator/=(Vec3<double> &lhs, const double scalar)
 /// ---- Vec3 simd arithmetic operators ---------------------------------------
 ///
 template<>
-inline Vec3<double> operator+(const double scalar, Vec3<double> rhs)
+MATH_SIMD_CONSTEXPR Vec3<double> operator+(
+    const double scalar, Vec3<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b = simd_load(rhs);
     simd_store(rhs, _mm256_add_pd(a, b));
@@ -300,8 +406,13 @@ inline Vec3<double> operator+(const double scalar, Vec3<double> rhs)
 }
 
 template<>
-inline Vec3<double> operator-(const double scalar, Vec3<double> rhs)
+MATH_SIMD_CONSTEXPR Vec3<double> operator-(
+    const double scalar, Vec3<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b = simd_load(rhs);
     simd_store(rhs, _mm256_sub_pd(a, b));
@@ -309,8 +420,13 @@ inline Vec3<double> operator-(const double scalar, Vec3<double> rhs)
 }
 
 template<>
-inline Vec3<double> operator*(const double scalar, Vec3<double> rhs)
+MATH_SIMD_CONSTEXPR Vec3<double> operator*(
+    const double scalar, Vec3<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b = simd_load(rhs);
     simd_store(rhs, _mm256_mul_pd(a, b));
@@ -318,8 +434,13 @@ inline Vec3<double> operator*(const double scalar, Vec3<double> rhs)
 }
 
 template<>
-inline Vec3<double> operator/(const double scalar, Vec3<double> rhs)
+MATH_SIMD_CONSTEXPR Vec3<double> operator/(
+    const double scalar, Vec3<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b = simd_load(rhs);
     simd_store(rhs, _mm256_div_pd(a, b));
@@ -329,8 +450,13 @@ inline Vec3<double> operator/(const double scalar, Vec3<double> rhs)
 /// ---- Vec4 simd assignment operators ---------------------------------------
 ///
 template<>
-inline Vec4<double> &operator+=(Vec4<double> &lhs, const Vec4<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec4<double> &operator+=(
+    Vec4<double> &lhs, const Vec4<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = simd_load(rhs);
     simd_store(lhs, _mm256_add_pd(a, b));
@@ -338,8 +464,13 @@ inline Vec4<double> &operator+=(Vec4<double> &lhs, const Vec4<double> &rhs)
 }
 
 template<>
-inline Vec4<double> &operator-=(Vec4<double> &lhs, const Vec4<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec4<double> &operator-=(
+    Vec4<double> &lhs, const Vec4<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = simd_load(rhs);
     simd_store(lhs, _mm256_sub_pd(a, b));
@@ -347,8 +478,13 @@ inline Vec4<double> &operator-=(Vec4<double> &lhs, const Vec4<double> &rhs)
 }
 
 template<>
-inline Vec4<double> &operator*=(Vec4<double> &lhs, const Vec4<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec4<double> &operator*=(
+    Vec4<double> &lhs, const Vec4<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = simd_load(rhs);
     simd_store(lhs, _mm256_mul_pd(a, b));
@@ -356,8 +492,13 @@ inline Vec4<double> &operator*=(Vec4<double> &lhs, const Vec4<double> &rhs)
 }
 
 template<>
-inline Vec4<double> &operator/=(Vec4<double> &lhs, const Vec4<double> &rhs)
+MATH_SIMD_CONSTEXPR Vec4<double> &operator/=(
+    Vec4<double> &lhs, const Vec4<double> &rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = simd_load(rhs);
     simd_store(lhs, _mm256_div_pd(a, b));
@@ -365,8 +506,13 @@ inline Vec4<double> &operator/=(Vec4<double> &lhs, const Vec4<double> &rhs)
 }
 
 template<>
-inline Vec4<double> &operator+=(Vec4<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec4<double> &operator+=(
+    Vec4<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = _mm256_set1_pd(scalar);
     simd_store(lhs, _mm256_add_pd(a, b));
@@ -374,8 +520,13 @@ inline Vec4<double> &operator+=(Vec4<double> &lhs, const double scalar)
 }
 
 template<>
-inline Vec4<double> &operator-=(Vec4<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec4<double> &operator-=(
+    Vec4<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = _mm256_set1_pd(scalar);
     simd_store(lhs, _mm256_sub_pd(a, b));
@@ -383,8 +534,13 @@ inline Vec4<double> &operator-=(Vec4<double> &lhs, const double scalar)
 }
 
 template<>
-inline Vec4<double> &operator*=(Vec4<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec4<double> &operator*=(
+    Vec4<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = _mm256_set1_pd(scalar);
     simd_store(lhs, _mm256_mul_pd(a, b));
@@ -392,8 +548,13 @@ inline Vec4<double> &operator*=(Vec4<double> &lhs, const double scalar)
 }
 
 template<>
-inline Vec4<double> &operator/=(Vec4<double> &lhs, const double scalar)
+MATH_SIMD_CONSTEXPR Vec4<double> &operator/=(
+    Vec4<double> &lhs, const double scalar)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
     const __m256d a = simd_load(lhs);
     const __m256d b = _mm256_set1_pd(scalar);
     simd_store(lhs, _mm256_div_pd(a, b));
@@ -403,8 +564,13 @@ inline Vec4<double> &operator/=(Vec4<double> &lhs, const double scalar)
 /// ---- Vec4 simd arithmetic operators ---------------------------------------
 ///
 template<>
-inline Vec4<double> operator+(const double scalar, Vec4<double> rhs)
+MATH_SIMD_CONSTEXPR Vec4<double> operator+(
+    const double scalar, Vec4<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b = simd_load(rhs);
     simd_store(rhs, _mm256_add_pd(a, b));
@@ -412,8 +578,13 @@ inline Vec4<double> operator+(const double scalar, Vec4<double> rhs)
 }
 
 template<>
-inline Vec4<double> operator-(const double scalar, Vec4<double> rhs)
+MATH_SIMD_CONSTEXPR Vec4<double> operator-(
+    const double scalar, Vec4<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b = simd_load(rhs);
     simd_store(rhs, _mm256_sub_pd(a, b));
@@ -421,8 +592,13 @@ inline Vec4<double> operator-(const double scalar, Vec4<double> rhs)
 }
 
 template<>
-inline Vec4<double> operator*(const double scalar, Vec4<double> rhs)
+MATH_SIMD_CONSTEXPR Vec4<double> operator*(
+    const double scalar, Vec4<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b = simd_load(rhs);
     simd_store(rhs, _mm256_mul_pd(a, b));
@@ -430,14 +606,1340 @@ inline Vec4<double> operator*(const double scalar, Vec4<double> rhs)
 }
 
 template<>
-inline Vec4<double> operator/(const double scalar, Vec4<double> rhs)
+MATH_SIMD_CONSTEXPR Vec4<double> operator/(
+    const double scalar, Vec4<double> rhs)
 {
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
     const __m256d a = _mm256_set1_pd(scalar);
     const __m256d b = simd_load(rhs);
     simd_store(rhs, _mm256_div_pd(a, b));
     return rhs;
 }
 
+/// ---- simd single-precision load/store functions ---------------------------
+/// @brief Load 64-bits (2 packed single-precision 32-bit) from a Vec2 array.
+/// The upper elements are set to zero.
+/// @fn _mm_loadl_epi64(__m128i const* mem_addr)
+///  dst[63:0]   := MEM[mem_addr+63:mem_addr]
+///  dst[127:64] := 0
+///
+inline __m128 simd_load(const Vec2<float> &v)
+{
+    return _mm_castsi128_ps(_mm_loadl_epi64((const __m128i *) v.data));
+}
+
+///
+/// @brief Store 64-bits (2 packed single-precision 32-bit) into a Vec2 array.
+/// @fn _mm_storel_epi64(__m128i* mem_addr, __m128i a)
+///  MEM[mem_addr+63:mem_addr] := a[63:0]
+///
+inline void simd_store(Vec2<float> &v, const __m128 a)
+{
+    _mm_storel_epi64((__m128i *) v.data, _mm_castps_si128(a));
+}
+
+///
+/// @brief Load 96-bits (3 packed single-precision 32-bit) from a Vec3 array.
+/// @fn _mm_maskload_ps(float const * v, __m128i mask)
+///      dst[31:0]   := (mask[31]  == 1) ? v[31:0]   : 0
+///      dst[63:32]  := (mask[63]  == 1) ? v[63:32]  : 0
+///      dst[95:64]  := (mask[95]  == 1) ? v[95:64]  : 0
+///      dst[127:96] := (mask[127] == 1) ? v[127:96] : 0
+///
+inline __m128 simd_load(const Vec3<float> &v)
+{
+    const __m128i mask = _mm_set_epi32(0x0, -1, -1, -1);
+    return _mm_maskload_ps(v.data, mask);
+}
+
+///
+/// @brief Store 96-bits (3 packed single-precision 32-bit) into a Vec3 array.
+/// @fn _mm_maskstore_ps(float * v, __m128i mask, __m128 a)
+///      v[31:0]   := (mask[31]  == 1) ? a[31:0]
+///      v[63:32]  := (mask[63]  == 1) ? a[63:32]
+///      v[95:64]  := (mask[95]  == 1) ? a[95:64]
+///      v[127:96] := (mask[127] == 1) ? a[127:96]
+///
+inline void simd_store(Vec3<float> &v, const __m128 a)
+{
+    const __m128i mask = _mm_set_epi32(0x0, -1, -1, -1);
+    _mm_maskstore_ps(v.data, mask, a);
+}
+
+///
+/// @brief Load 128-bits (4 packed single-precision 32-bit) from a Vec4 array.
+///
+inline __m128 simd_load(const Vec4<float> &v)
+{
+    return _mm_load_ps(v.data);
+}
+
+///
+/// @brief Store 128-bits (4 packed single-precision 32-bit) into a Vec4 array.
+///
+inline void simd_store(Vec4<float> &v, const __m128 a)
+{
+    _mm_store_ps(v.data, a);
+}
+
+/// ---- Vec2f simd assignment operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> &operator+=(
+    Vec2<float> &lhs, const Vec2<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_add_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> &operator-=(
+    Vec2<float> &lhs, const Vec2<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_sub_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> &operator*=(
+    Vec2<float> &lhs, const Vec2<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_mul_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> &operator/=(
+    Vec2<float> &lhs, const Vec2<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_div_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> &operator+=(
+    Vec2<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_add_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> &operator-=(
+    Vec2<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_sub_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> &operator*=(
+    Vec2<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_mul_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> &operator/=(
+    Vec2<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_div_ps(a, b));
+    return lhs;
+}
+
+/// ---- Vec2f simd arithmetic operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> operator+(const float scalar, Vec2<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_add_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> operator-(const float scalar, Vec2<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_sub_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> operator*(const float scalar, Vec2<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_mul_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<float> operator/(const float scalar, Vec2<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_div_ps(a, b));
+    return rhs;
+}
+
+/// ---- Vec3f simd assignment operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> &operator+=(
+    Vec3<float> &lhs, const Vec3<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_add_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> &operator-=(
+    Vec3<float> &lhs, const Vec3<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_sub_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> &operator*=(
+    Vec3<float> &lhs, const Vec3<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_mul_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> &operator/=(
+    Vec3<float> &lhs, const Vec3<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_div_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> &operator+=(
+    Vec3<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_add_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> &operator-=(
+    Vec3<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_sub_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> &operator*=(
+    Vec3<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_mul_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> &operator/=(
+    Vec3<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_div_ps(a, b));
+    return lhs;
+}
+
+/// ---- Vec3f simd arithmetic operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> operator+(const float scalar, Vec3<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_add_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> operator-(const float scalar, Vec3<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_sub_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> operator*(const float scalar, Vec3<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_mul_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<float> operator/(const float scalar, Vec3<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_div_ps(a, b));
+    return rhs;
+}
+
+/// ---- Vec4f simd assignment operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> &operator+=(
+    Vec4<float> &lhs, const Vec4<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_add_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> &operator-=(
+    Vec4<float> &lhs, const Vec4<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_sub_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> &operator*=(
+    Vec4<float> &lhs, const Vec4<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_mul_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> &operator/=(
+    Vec4<float> &lhs, const Vec4<float> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, rhs);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = simd_load(rhs);
+    simd_store(lhs, _mm_div_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> &operator+=(
+    Vec4<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_add_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> &operator-=(
+    Vec4<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_sub_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> &operator*=(
+    Vec4<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_mul_ps(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> &operator/=(
+    Vec4<float> &lhs, const float scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarDiv(lhs, scalar);
+    }
+
+    const __m128 a = simd_load(lhs);
+    const __m128 b = _mm_set1_ps(scalar);
+    simd_store(lhs, _mm_div_ps(a, b));
+    return lhs;
+}
+
+/// ---- Vec4f simd arithmetic operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> operator+(const float scalar, Vec4<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_add_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> operator-(const float scalar, Vec4<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRsub(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_sub_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> operator*(const float scalar, Vec4<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(rhs, scalar);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_mul_ps(a, b));
+    return rhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<float> operator/(const float scalar, Vec4<float> rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarRdiv(scalar, rhs);
+    }
+
+    const __m128 a = _mm_set1_ps(scalar);
+    const __m128 b = simd_load(rhs);
+    simd_store(rhs, _mm_div_ps(a, b));
+    return rhs;
+}
+
+/// ---- simd integer load/store functions ------------------------------------
+/// @brief Load 64-bits (2 packed 32-bit integers) from a Vec2 array. The upper
+/// elements are set to zero.
+///
+inline __m128i simd_load(const Vec2<int32_t> &v)
+{
+    return _mm_loadl_epi64((const __m128i *) v.data);
+}
+
+inline __m128i simd_load(const Vec2<uint32_t> &v)
+{
+    return _mm_loadl_epi64((const __m128i *) v.data);
+}
+
+///
+/// @brief Store 64-bits (2 packed 32-bit integers) into a Vec2 array.
+///
+inline void simd_store(Vec2<int32_t> &v, const __m128i a)
+{
+    _mm_storel_epi64((__m128i *) v.data, a);
+}
+
+inline void simd_store(Vec2<uint32_t> &v, const __m128i a)
+{
+    _mm_storel_epi64((__m128i *) v.data, a);
+}
+
+///
+/// @brief Load 128-bits (4 packed 32-bit integers) from a Vec3 array. The
+/// vector is 32-byte aligned and padded, so the last element is loaded from
+/// the padding and its value is unspecified.
+///
+inline __m128i simd_load(const Vec3<int32_t> &v)
+{
+    return _mm_load_si128((const __m128i *) v.data);
+}
+
+inline __m128i simd_load(const Vec3<uint32_t> &v)
+{
+    return _mm_load_si128((const __m128i *) v.data);
+}
+
+///
+/// @brief Store 128-bits (4 packed 32-bit integers) into a Vec3 array. The
+/// last element is stored into the padding.
+///
+inline void simd_store(Vec3<int32_t> &v, const __m128i a)
+{
+    _mm_store_si128((__m128i *) v.data, a);
+}
+
+inline void simd_store(Vec3<uint32_t> &v, const __m128i a)
+{
+    _mm_store_si128((__m128i *) v.data, a);
+}
+
+///
+/// @brief Load 128-bits (4 packed 32-bit integers) from a Vec4 array.
+///
+inline __m128i simd_load(const Vec4<int32_t> &v)
+{
+    return _mm_load_si128((const __m128i *) v.data);
+}
+
+inline __m128i simd_load(const Vec4<uint32_t> &v)
+{
+    return _mm_load_si128((const __m128i *) v.data);
+}
+
+///
+/// @brief Store 128-bits (4 packed 32-bit integers) into a Vec4 array.
+///
+inline void simd_store(Vec4<int32_t> &v, const __m128i a)
+{
+    _mm_store_si128((__m128i *) v.data, a);
+}
+
+inline void simd_store(Vec4<uint32_t> &v, const __m128i a)
+{
+    _mm_store_si128((__m128i *) v.data, a);
+}
+
+/// ---- Vec2i simd assignment operators --------------------------------------
+/// Integer products keep the low 32 bits, the same for signed and unsigned
+/// vectors. Right shifts are arithmetic for signed and logical for unsigned.
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> &operator+=(
+    Vec2<int32_t> &lhs, const Vec2<int32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> &operator-=(
+    Vec2<int32_t> &lhs, const Vec2<int32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> &operator*=(
+    Vec2<int32_t> &lhs, const Vec2<int32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> &operator+=(
+    Vec2<int32_t> &lhs, const int32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> &operator-=(
+    Vec2<int32_t> &lhs, const int32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> &operator*=(
+    Vec2<int32_t> &lhs, const int32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> &operator<<=(
+    Vec2<int32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShl(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_sll_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<int32_t> &operator>>=(
+    Vec2<int32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShr(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_sra_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> &operator+=(
+    Vec2<uint32_t> &lhs, const Vec2<uint32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> &operator-=(
+    Vec2<uint32_t> &lhs, const Vec2<uint32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> &operator*=(
+    Vec2<uint32_t> &lhs, const Vec2<uint32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> &operator+=(
+    Vec2<uint32_t> &lhs, const uint32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> &operator-=(
+    Vec2<uint32_t> &lhs, const uint32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> &operator*=(
+    Vec2<uint32_t> &lhs, const uint32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> &operator<<=(
+    Vec2<uint32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShl(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_sll_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec2<uint32_t> &operator>>=(
+    Vec2<uint32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShr(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_srl_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+/// ---- Vec3i simd assignment operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> &operator+=(
+    Vec3<int32_t> &lhs, const Vec3<int32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> &operator-=(
+    Vec3<int32_t> &lhs, const Vec3<int32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> &operator*=(
+    Vec3<int32_t> &lhs, const Vec3<int32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> &operator+=(
+    Vec3<int32_t> &lhs, const int32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> &operator-=(
+    Vec3<int32_t> &lhs, const int32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> &operator*=(
+    Vec3<int32_t> &lhs, const int32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> &operator<<=(
+    Vec3<int32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShl(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_sll_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<int32_t> &operator>>=(
+    Vec3<int32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShr(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_sra_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> &operator+=(
+    Vec3<uint32_t> &lhs, const Vec3<uint32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> &operator-=(
+    Vec3<uint32_t> &lhs, const Vec3<uint32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> &operator*=(
+    Vec3<uint32_t> &lhs, const Vec3<uint32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> &operator+=(
+    Vec3<uint32_t> &lhs, const uint32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> &operator-=(
+    Vec3<uint32_t> &lhs, const uint32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> &operator*=(
+    Vec3<uint32_t> &lhs, const uint32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> &operator<<=(
+    Vec3<uint32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShl(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_sll_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec3<uint32_t> &operator>>=(
+    Vec3<uint32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShr(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_srl_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+/// ---- Vec4i simd assignment operators --------------------------------------
+///
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> &operator+=(
+    Vec4<int32_t> &lhs, const Vec4<int32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> &operator-=(
+    Vec4<int32_t> &lhs, const Vec4<int32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> &operator*=(
+    Vec4<int32_t> &lhs, const Vec4<int32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> &operator+=(
+    Vec4<int32_t> &lhs, const int32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> &operator-=(
+    Vec4<int32_t> &lhs, const int32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> &operator*=(
+    Vec4<int32_t> &lhs, const int32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> &operator<<=(
+    Vec4<int32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShl(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_sll_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<int32_t> &operator>>=(
+    Vec4<int32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShr(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_sra_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> &operator+=(
+    Vec4<uint32_t> &lhs, const Vec4<uint32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> &operator-=(
+    Vec4<uint32_t> &lhs, const Vec4<uint32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> &operator*=(
+    Vec4<uint32_t> &lhs, const Vec4<uint32_t> &rhs)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, rhs);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = simd_load(rhs);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> &operator+=(
+    Vec4<uint32_t> &lhs, const uint32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarAdd(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_add_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> &operator-=(
+    Vec4<uint32_t> &lhs, const uint32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarSub(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_sub_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> &operator*=(
+    Vec4<uint32_t> &lhs, const uint32_t scalar)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarMul(lhs, scalar);
+    }
+
+    const __m128i a = simd_load(lhs);
+    const __m128i b = _mm_set1_epi32((int32_t) scalar);
+    simd_store(lhs, _mm_mullo_epi32(a, b));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> &operator<<=(
+    Vec4<uint32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShl(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_sll_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+template<>
+MATH_SIMD_CONSTEXPR Vec4<uint32_t> &operator>>=(
+    Vec4<uint32_t> &lhs, const int count)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) {
+        return Detail::ScalarShr(lhs, count);
+    }
+
+    const __m128i a = simd_load(lhs);
+    simd_store(lhs, _mm_srl_epi32(a, _mm_cvtsi32_si128(count)));
+    return lhs;
+}
+
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 #endif // MATH_SIMD_VECTOR_H_
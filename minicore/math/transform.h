@@ -14,24 +14,26 @@
 #include <type_traits>
 #include "vector.h"
 #include "matrix.h"
+#include "simd/isa.h"
 
 namespace Math {
+inline namespace MATH_SIMD_ISA {
 
 /// -----------------------------------------------------------------------------
 /// @brief Translate the matrix by d.
 ///
 template<typename T>
-inline Mat4<T> Translate(const Vec3<T> d)
+constexpr Mat4<T> Translate(const Vec3<T> d)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {(T) 1, (T) 0, (T) 0, d.x,
-            (T) 0, (T) 1, (T) 0, d.y,
-            (T) 0, (T) 0, (T) 1, d.z,
+    return {(T) 1, (T) 0, (T) 0, d[0],
+            (T) 0, (T) 1, (T) 0, d[1],
+            (T) 0, (T) 0, (T) 1, d[2],
             (T) 0, (T) 0, (T) 0, (T) 1};
 }
 
 template<typename T>
-inline Mat4<T> Translate(const Mat4<T> m, const Vec3<T> d)
+constexpr Mat4<T> Translate(const Mat4<T> m, const Vec3<T> d)
 {
     return Dot(Translate(d), m);
 }
@@ -40,17 +42,17 @@ inline Mat4<T> Translate(const Mat4<T> m, const Vec3<T> d)
 /// @brief Scale the matrix by s.
 ///
 template<typename T>
-inline Mat4<T> Scale(const Vec3<T> s)
+constexpr Mat4<T> Scale(const Vec3<T> s)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    return {  s.x, (T) 0, (T) 0, (T) 0,
-            (T) 0,   s.y, (T) 0, (T) 0,
-            (T) 0, (T) 0,   s.z, (T) 0,
+    return { s[0], (T) 0, (T) 0, (T) 0,
+            (T) 0,  s[1], (T) 0, (T) 0,
+            (T) 0, (T) 0,  s[2], (T) 0,
             (T) 0, (T) 0, (T ) 0, (T) 1};
 }
 
 template<typename T>
-inline Mat4<T> Scale(const Mat4<T> m, const Vec3<T> s)
+constexpr Mat4<T> Scale(const Mat4<T> m, const Vec3<T> s)
 {
     return Dot(Scale(s), m);
 }
@@ -205,7 +207,7 @@ inline Mat4<T> Perspective(
 /// @brief Compute the orthographic projection matrix.
 ///
 template<typename T>
-inline Mat4<T> Orthographic(
+constexpr Mat4<T> Orthographic(
     const T left,
     const T right,
     const T bottom,
@@ -214,31 +216,29 @@ inline Mat4<T> Orthographic(
     const T zfar)
 {
     static_assert(std::is_floating_point<T>::value, "non floating point");
-    Mat4<T> result{};
-    result.xx =  (T) 2 / (right - left);
-    result.xy =  (T) 0;
-    result.xz =  (T) 0;
-    result.xw =  -(right + left) / (right - left);
-
-    result.yx =  (T) 0;
-    result.yy =  (T) 2 / (top - bottom);
-    result.yz =  (T) 0;
-    result.yw =  -(top + bottom) / (top - bottom);
-
-    result.zx =  (T) 0;
-    result.zy =  (T) 0;
-    result.zz = -(T) 2 / (zfar - znear);
-    result.zw = -(zfar + znear) / (zfar - znear);
-
-    result.wx =  (T) 0;
-    result.wy =  (T) 0;
-    result.wz =  (T) 0;
-    result.ww =  (T) 1;
-    return result;
+    return {(T) 2 / (right - left),
+            (T) 0,
+            (T) 0,
+            -(right + left) / (right - left),
+
+            (T) 0,
+            (T) 2 / (top - bottom),
+            (T) 0,
+            -(top + bottom) / (top - bottom),
+
+            (T) 0,
+            (T) 0,
+            -(T) 2 / (zfar - znear),
+            -(zfar + znear) / (zfar - znear),
+
+            (T) 0,
+            (T) 0,
+            (T) 0,
+            (T) 1};
 }
 
 template<typename T>
-inline Mat4<T> Orthographic(
+constexpr Mat4<T> Orthographic(
     const Mat4<T> m,
     const T left,
     const T right,
@@ -250,6 +250,7 @@ inline Mat4<T> Orthographic(
     return Dot(Orthographic(left, right, bottom, top, znear, zfar), m);
 }
 
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 /// ---- simd implementations ------------------------------------------------
@@ -10,6 +10,8 @@
 #ifndef MATH_VECTOR_H_
 #define MATH_VECTOR_H_
 
+#include "constexpr.h"
+
 namespace Math {
 
 /// ---- Vector data types ----------------------------------------------------
@@ -25,8 +27,8 @@ struct Vec2 {
         struct { T x, y; };
     };
 
-    T &operator[](size_t i) { return data[i]; }
-    const T &operator[](size_t i) const { return data[i]; }
+    constexpr T &operator[](size_t i) { return data[i]; }
+    constexpr const T &operator[](size_t i) const { return data[i]; }
 };
 
 template<typename T>
@@ -41,8 +43,8 @@ struct Vec3 {
         struct { T x, y, z; };
     };
 
-    T &operator[](size_t i) { return data[i]; }
-    const T &operator[](size_t i) const { return data[i]; }
+    constexpr T &operator[](size_t i) { return data[i]; }
+    constexpr const T &operator[](size_t i) const { return data[i]; }
 };
 
 template<typename T>
@@ -57,8 +59,8 @@ struct Vec4 {
         struct { T x, y, z, w; };
     };
 
-    T &operator[](size_t i) { return data[i]; }
-    const T &operator[](size_t i) const { return data[i]; }
+    constexpr T &operator[](size_t i) { return data[i]; }
+    constexpr const T &operator[](size_t i) const { return data[i]; }
 };
 
 typedef Vec2<int16_t>   Vec2i16;
@@ -96,260 +98,393 @@ typedef Vec4<double>    Vec4d;
 
 /// ---- Special vectors ------------------------------------------------------
 template<typename T>
-const Vec2<T> Vec2<T>::Zeros = {(T) 0, (T) 0};
+constexpr Vec2<T> Vec2<T>::Zeros = {(T) 0, (T) 0};
 template<typename T>
-const Vec2<T> Vec2<T>::Ones = {(T) 1, (T) 1};
+constexpr Vec2<T> Vec2<T>::Ones = {(T) 1, (T) 1};
 
 template<typename T>
-const Vec3<T> Vec3<T>::Zeros = {(T) 0, (T) 0, (T) 0};
+constexpr Vec3<T> Vec3<T>::Zeros = {(T) 0, (T) 0, (T) 0};
 template<typename T>
-const Vec3<T> Vec3<T>::Ones = {(T) 1, (T) 1, (T) 1};
+constexpr Vec3<T> Vec3<T>::Ones = {(T) 1, (T) 1, (T) 1};
 
 template<typename T>
-const Vec4<T> Vec4<T>::Zeros = {(T) 0, (T) 0, (T) 0, (T) 0};
+constexpr Vec4<T> Vec4<T>::Zeros = {(T) 0, (T) 0, (T) 0, (T) 0};
 template<typename T>
-const Vec4<T> Vec4<T>::Ones = {(T) 1, (T) 1, (T) 1, (T) 1};
+constexpr Vec4<T> Vec4<T>::Ones = {(T) 1, (T) 1, (T) 1, (T) 1};
+
+inline namespace MATH_SIMD_ISA {
 
 /// ---- Vec2 declarations ----------------------------------------------------
 /// Compound assignment operators vector operators.
 ///
 template<typename T>
-inline Vec2<T> &operator+=(Vec2<T> &lhs, const Vec2<T> &rhs);
-template<typename T> inline Vec2<T> &operator-=(Vec2<T> &lhs, const Vec2<T> &rhs);
-template<typename T> inline Vec2<T> &operator*=(Vec2<T> &lhs, const Vec2<T> &rhs);
-template<typename T> inline Vec2<T> &operator/=(Vec2<T> &lhs, const Vec2<T> &rhs);
+constexpr Vec2<T> &operator+=(Vec2<T> &lhs, const Vec2<T> &rhs);
+template<typename T>
+constexpr Vec2<T> &operator-=(Vec2<T> &lhs, const Vec2<T> &rhs);
+template<typename T>
+constexpr Vec2<T> &operator*=(Vec2<T> &lhs, const Vec2<T> &rhs);
+template<typename T>
+constexpr Vec2<T> &operator/=(Vec2<T> &lhs, const Vec2<T> &rhs);
 
-template<typename T> inline Vec2<T> &operator+=(Vec2<T> &lhs, const T scalar);
-template<typename T> inline Vec2<T> &operator-=(Vec2<T> &lhs, const T scalar);
-template<typename T> inline Vec2<T> &operator*=(Vec2<T> &lhs, const T scalar);
-template<typename T> inline Vec2<T> &operator/=(Vec2<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec2<T> &operator+=(Vec2<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec2<T> &operator-=(Vec2<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec2<T> &operator*=(Vec2<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec2<T> &operator/=(Vec2<T> &lhs, const T scalar);
 
 /// Arithmetic operators.
-template<typename T> inline Vec2<T> operator+(Vec2<T> lhs, const Vec2<T> &rhs);
-template<typename T> inline Vec2<T> operator-(Vec2<T> lhs, const Vec2<T> &rhs);
-template<typename T> inline Vec2<T> operator*(Vec2<T> lhs, const Vec2<T> &rhs);
-template<typename T> inline Vec2<T> operator/(Vec2<T> lhs, const Vec2<T> &rhs);
+template<typename T>
+constexpr Vec2<T> operator+(Vec2<T> lhs, const Vec2<T> &rhs);
+template<typename T>
+constexpr Vec2<T> operator-(Vec2<T> lhs, const Vec2<T> &rhs);
+template<typename T>
+constexpr Vec2<T> operator*(Vec2<T> lhs, const Vec2<T> &rhs);
+template<typename T>
+constexpr Vec2<T> operator/(Vec2<T> lhs, const Vec2<T> &rhs);
 
-template<typename T> inline Vec2<T> operator+(Vec2<T> lhs, const T scalar);
-template<typename T> inline Vec2<T> operator-(Vec2<T> lhs, const T scalar);
-template<typename T> inline Vec2<T> operator*(Vec2<T> lhs, const T scalar);
-template<typename T> inline Vec2<T> operator/(Vec2<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec2<T> operator+(Vec2<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec2<T> operator-(Vec2<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec2<T> operator*(Vec2<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec2<T> operator/(Vec2<T> lhs, const T scalar);
 
-template<typename T> inline Vec2<T> operator+(const T scalar, Vec2<T> rhs);
-template<typename T> inline Vec2<T> operator-(const T scalar, Vec2<T> rhs);
-template<typename T> inline Vec2<T> operator*(const T scalar, Vec2<T> rhs);
-template<typename T> inline Vec2<T> operator/(const T scalar, Vec2<T> rhs);
+template<typename T>
+constexpr Vec2<T> operator+(const T scalar, Vec2<T> rhs);
+template<typename T>
+constexpr Vec2<T> operator-(const T scalar, Vec2<T> rhs);
+template<typename T>
+constexpr Vec2<T> operator*(const T scalar, Vec2<T> rhs);
+template<typename T>
+constexpr Vec2<T> operator/(const T scalar, Vec2<T> rhs);
 
 /// Unary operators.
-template<typename T> inline Vec2<T> operator+(Vec2<T> lhs);
-template<typename T> inline Vec2<T> operator-(Vec2<T> lhs);
+template<typename T>
+constexpr Vec2<T> operator+(Vec2<T> lhs);
+template<typename T>
+constexpr Vec2<T> operator-(Vec2<T> lhs);
 
 /// Increment operators.
-template<typename T> inline Vec2<T> &operator++(Vec2<T> &lhs);
-template<typename T> inline Vec2<T> &operator--(Vec2<T> &lhs);
-template<typename T> inline Vec2<T> operator++(Vec2<T> &lhs, int);
-template<typename T> inline Vec2<T> operator--(Vec2<T> &lhs, int);
+template<typename T>
+constexpr Vec2<T> &operator++(Vec2<T> &lhs);
+template<typename T>
+constexpr Vec2<T> &operator--(Vec2<T> &lhs);
+template<typename T>
+constexpr Vec2<T> operator++(Vec2<T> &lhs, int);
+template<typename T>
+constexpr Vec2<T> operator--(Vec2<T> &lhs, int);
+
+/// Shift operators of integer vectors.
+template<typename T>
+constexpr Vec2<T> &operator<<=(Vec2<T> &lhs, const int count);
+template<typename T>
+constexpr Vec2<T> &operator>>=(Vec2<T> &lhs, const int count);
+template<typename T>
+constexpr Vec2<T> operator<<(Vec2<T> lhs, const int count);
+template<typename T>
+constexpr Vec2<T> operator>>(Vec2<T> lhs, const int count);
 
 /// ---- Vec3 declarations ----------------------------------------------------
 /// Compound assignment operators vector operators.
 ///
-template<typename T> inline Vec3<T> &operator+=(Vec3<T> &lhs, const Vec3<T> &rhs);
-template<typename T> inline Vec3<T> &operator-=(Vec3<T> &lhs, const Vec3<T> &rhs);
-template<typename T> inline Vec3<T> &operator*=(Vec3<T> &lhs, const Vec3<T> &rhs);
-template<typename T> inline Vec3<T> &operator/=(Vec3<T> &lhs, const Vec3<T> &rhs);
+template<typename T>
+constexpr Vec3<T> &operator+=(Vec3<T> &lhs, const Vec3<T> &rhs);
+template<typename T>
+constexpr Vec3<T> &operator-=(Vec3<T> &lhs, const Vec3<T> &rhs);
+template<typename T>
+constexpr Vec3<T> &operator*=(Vec3<T> &lhs, const Vec3<T> &rhs);
+template<typename T>
+constexpr Vec3<T> &operator/=(Vec3<T> &lhs, const Vec3<T> &rhs);
 
-template<typename T> inline Vec3<T> &operator+=(Vec3<T> &lhs, const T scalar);
-template<typename T> inline Vec3<T> &operator-=(Vec3<T> &lhs, const T scalar);
-template<typename T> inline Vec3<T> &operator*=(Vec3<T> &lhs, const T scalar);
-template<typename T> inline Vec3<T> &operator/=(Vec3<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec3<T> &operator+=(Vec3<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec3<T> &operator-=(Vec3<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec3<T> &operator*=(Vec3<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec3<T> &operator/=(Vec3<T> &lhs, const T scalar);
 
 /// Arithmetic operators.
-template<typename T> inline Vec3<T> operator+(Vec3<T> lhs, const Vec3<T> &rhs);
-template<typename T> inline Vec3<T> operator-(Vec3<T> lhs, const Vec3<T> &rhs);
-template<typename T> inline Vec3<T> operator*(Vec3<T> lhs, const Vec3<T> &rhs);
-template<typename T> inline Vec3<T> operator/(Vec3<T> lhs, const Vec3<T> &rhs);
+template<typename T>
+constexpr Vec3<T> operator+(Vec3<T> lhs, const Vec3<T> &rhs);
+template<typename T>
+constexpr Vec3<T> operator-(Vec3<T> lhs, const Vec3<T> &rhs);
+template<typename T>
+constexpr Vec3<T> operator*(Vec3<T> lhs, const Vec3<T> &rhs);
+template<typename T>
+constexpr Vec3<T> operator/(Vec3<T> lhs, const Vec3<T> &rhs);
 
-template<typename T> inline Vec3<T> operator+(Vec3<T> lhs, const T scalar);
-template<typename T> inline Vec3<T> operator-(Vec3<T> lhs, const T scalar);
-template<typename T> inline Vec3<T> operator*(Vec3<T> lhs, const T scalar);
-template<typename T> inline Vec3<T> operator/(Vec3<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec3<T> operator+(Vec3<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec3<T> operator-(Vec3<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec3<T> operator*(Vec3<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec3<T> operator/(Vec3<T> lhs, const T scalar);
 
-template<typename T> inline Vec3<T> operator+(const T scalar, Vec3<T> rhs);
-template<typename T> inline Vec3<T> operator-(const T scalar, Vec3<T> rhs);
-template<typename T> inline Vec3<T> operator*(const T scalar, Vec3<T> rhs);
-template<typename T> inline Vec3<T> operator/(const T scalar, Vec3<T> rhs);
+template<typename T>
+constexpr Vec3<T> operator+(const T scalar, Vec3<T> rhs);
+template<typename T>
+constexpr Vec3<T> operator-(const T scalar, Vec3<T> rhs);
+template<typename T>
+constexpr Vec3<T> operator*(const T scalar, Vec3<T> rhs);
+template<typename T>
+constexpr Vec3<T> operator/(const T scalar, Vec3<T> rhs);
 
 /// Unary operators.
-template<typename T> inline Vec3<T> operator+(Vec3<T> lhs);
-template<typename T> inline Vec3<T> operator-(Vec3<T> lhs);
+template<typename T>
+constexpr Vec3<T> operator+(Vec3<T> lhs);
+template<typename T>
+constexpr Vec3<T> operator-(Vec3<T> lhs);
 
 /// Increment operators.
-template<typename T> inline Vec3<T> &operator++(Vec3<T> &lhs);
-template<typename T> inline Vec3<T> &operator--(Vec3<T> &lhs);
-template<typename T> inline Vec3<T> operator++(Vec3<T> &lhs, int);
-template<typename T> inline Vec3<T> operator--(Vec3<T> &lhs, int);
+template<typename T>
+constexpr Vec3<T> &operator++(Vec3<T> &lhs);
+template<typename T>
+constexpr Vec3<T> &operator--(Vec3<T> &lhs);
+template<typename T>
+constexpr Vec3<T> operator++(Vec3<T> &lhs, int);
+template<typename T>
+constexpr Vec3<T> operator--(Vec3<T> &lhs, int);
+
+/// Shift operators of integer vectors.
+template<typename T>
+constexpr Vec3<T> &operator<<=(Vec3<T> &lhs, const int count);
+template<typename T>
+constexpr Vec3<T> &operator>>=(Vec3<T> &lhs, const int count);
+template<typename T>
+constexpr Vec3<T> operator<<(Vec3<T> lhs, const int count);
+template<typename T>
+constexpr Vec3<T> operator>>(Vec3<T> lhs, const int count);
 
 /// ---- Vec4 declarations ----------------------------------------------------
 /// Compound assignment operators vector operators.
 ///
-template<typename T> inline Vec4<T> &operator+=(Vec4<T> &lhs, const Vec4<T> &rhs);
-template<typename T> inline Vec4<T> &operator-=(Vec4<T> &lhs, const Vec4<T> &rhs);
-template<typename T> inline Vec4<T> &operator*=(Vec4<T> &lhs, const Vec4<T> &rhs);
-template<typename T> inline Vec4<T> &operator/=(Vec4<T> &lhs, const Vec4<T> &rhs);
+template<typename T>
+constexpr Vec4<T> &operator+=(Vec4<T> &lhs, const Vec4<T> &rhs);
+template<typename T>
+constexpr Vec4<T> &operator-=(Vec4<T> &lhs, const Vec4<T> &rhs);
+template<typename T>
+constexpr Vec4<T> &operator*=(Vec4<T> &lhs, const Vec4<T> &rhs);
+template<typename T>
+constexpr Vec4<T> &operator/=(Vec4<T> &lhs, const Vec4<T> &rhs);
 
-template<typename T> inline Vec4<T> &operator+=(Vec4<T> &lhs, const T scalar);
-template<typename T> inline Vec4<T> &operator-=(Vec4<T> &lhs, const T scalar);
-template<typename T> inline Vec4<T> &operator*=(Vec4<T> &lhs, const T scalar);
-template<typename T> inline Vec4<T> &operator/=(Vec4<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec4<T> &operator+=(Vec4<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec4<T> &operator-=(Vec4<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec4<T> &operator*=(Vec4<T> &lhs, const T scalar);
+template<typename T>
+constexpr Vec4<T> &operator/=(Vec4<T> &lhs, const T scalar);
 
 /// Arithmetic operators.
-template<typename T> inline Vec4<T> operator+(Vec4<T> lhs, const Vec4<T> &rhs);
-template<typename T> inline Vec4<T> operator-(Vec4<T> lhs, const Vec4<T> &rhs);
-template<typename T> inline Vec4<T> operator*(Vec4<T> lhs, const Vec4<T> &rhs);
-template<typename T> inline Vec4<T> operator/(Vec4<T> lhs, const Vec4<T> &rhs);
+template<typename T>
+constexpr Vec4<T> operator+(Vec4<T> lhs, const Vec4<T> &rhs);
+template<typename T>
+constexpr Vec4<T> operator-(Vec4<T> lhs, const Vec4<T> &rhs);
+template<typename T>
+constexpr Vec4<T> operator*(Vec4<T> lhs, const Vec4<T> &rhs);
+template<typename T>
+constexpr Vec4<T> operator/(Vec4<T> lhs, const Vec4<T> &rhs);
 
-template<typename T> inline Vec4<T> operator+(Vec4<T> lhs, const T scalar);
-template<typename T> inline Vec4<T> operator-(Vec4<T> lhs, const T scalar);
-template<typename T> inline Vec4<T> operator*(Vec4<T> lhs, const T scalar);
-template<typename T> inline Vec4<T> operator/(Vec4<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec4<T> operator+(Vec4<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec4<T> operator-(Vec4<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec4<T> operator*(Vec4<T> lhs, const T scalar);
+template<typename T>
+constexpr Vec4<T> operator/(Vec4<T> lhs, const T scalar);
 
-template<typename T> inline Vec4<T> operator+(const T scalar, Vec4<T> rhs);
-template<typename T> inline Vec4<T> operator-(const T scalar, Vec4<T> rhs);
-template<typename T> inline Vec4<T> operator*(const T scalar, Vec4<T> rhs);
-template<typename T> inline Vec4<T> operator/(const T scalar, Vec4<T> rhs);
+template<typename T>
+constexpr Vec4<T> operator+(const T scalar, Vec4<T> rhs);
+template<typename T>
+constexpr Vec4<T> operator-(const T scalar, Vec4<T> rhs);
+template<typename T>
+constexpr Vec4<T> operator*(const T scalar, Vec4<T> rhs);
+template<typename T>
+constexpr Vec4<T> operator/(const T scalar, Vec4<T> rhs);
 
 /// Unary operators.
-template<typename T> inline Vec4<T> operator+(Vec4<T> lhs);
-template<typename T> inline Vec4<T> operator-(Vec4<T> lhs);
+template<typename T>
+constexpr Vec4<T> operator+(Vec4<T> lhs);
+template<typename T>
+constexpr Vec4<T> operator-(Vec4<T> lhs);
 
 /// Increment operators.
-template<typename T> inline Vec4<T> &operator++(Vec4<T> &lhs);
-template<typename T> inline Vec4<T> &operator--(Vec4<T> &lhs);
-template<typename T> inline Vec4<T> operator++(Vec4<T> &lhs, int);
-template<typename T> inline Vec4<T> operator--(Vec4<T> &lhs, int);
+template<typename T>
+constexpr Vec4<T> &operator++(Vec4<T> &lhs);
+template<typename T>
+constexpr Vec4<T> &operator--(Vec4<T> &lhs);
+template<typename T>
+constexpr Vec4<T> operator++(Vec4<T> &lhs, int);
+template<typename T>
+constexpr Vec4<T> operator--(Vec4<T> &lhs, int);
+
+/// Shift operators of integer vectors.
+template<typename T>
+constexpr Vec4<T> &operator<<=(Vec4<T> &lhs, const int count);
+template<typename T>
+constexpr Vec4<T> &operator>>=(Vec4<T> &lhs, const int count);
+template<typename T>
+constexpr Vec4<T> operator<<(Vec4<T> lhs, const int count);
+template<typename T>
+constexpr Vec4<T> operator>>(Vec4<T> lhs, const int count);
 
 /// ---- Vec2 implementation --------------------------------------------------
 /// Compound assignment operators vector operators.
 ///
 template<typename T>
-inline Vec2<T> &operator+=(Vec2<T> &lhs, const Vec2<T> &rhs)
+constexpr Vec2<T> &operator+=(Vec2<T> &lhs, const Vec2<T> &rhs)
 {
-    lhs.x += rhs.x;
-    lhs.y += rhs.y;
-    return lhs;
+    return Detail::ScalarAdd(lhs, rhs);
 }
 
 template<typename T>
-inline Vec2<T> &operator-=(Vec2<T> &lhs, const Vec2<T> &rhs)
+constexpr Vec2<T> &operator-=(Vec2<T> &lhs, const Vec2<T> &rhs)
 {
-    lhs.x -= rhs.x;
-    lhs.y -= rhs.y;
-    return lhs;
+    return Detail::ScalarSub(lhs, rhs);
 }
 
 template<typename T>
-inline Vec2<T> &operator*=(Vec2<T> &lhs, const Vec2<T> &rhs)
+constexpr Vec2<T> &operator*=(Vec2<T> &lhs, const Vec2<T> &rhs)
 {
-    lhs.x *= rhs.x;
-    lhs.y *= rhs.y;
-    return lhs;
+    return Detail::ScalarMul(lhs, rhs);
 }
 
 template<typename T>
-inline Vec2<T> &operator/=(Vec2<T> &lhs, const Vec2<T> &rhs)
+constexpr Vec2<T> &operator/=(Vec2<T> &lhs, const Vec2<T> &rhs)
 {
-    lhs.x /= rhs.x;
-    lhs.y /= rhs.y;
-    return lhs;
+    return Detail::ScalarDiv(lhs, rhs);
 }
 
 template<typename T>
-inline Vec2<T> &operator+=(Vec2<T> &lhs, const T scalar)
+constexpr Vec2<T> &operator+=(Vec2<T> &lhs, const T scalar)
 {
-    lhs.x += scalar;
-    lhs.y += scalar;
-    return lhs;
+    return Detail::ScalarAdd(lhs, scalar);
 }
 
 template<typename T>
-inline Vec2<T> &operator-=(Vec2<T> &lhs, const T scalar)
+constexpr Vec2<T> &operator-=(Vec2<T> &lhs, const T scalar)
 {
-    lhs.x -= scalar;
-    lhs.y -= scalar;
-    return lhs;
+    return Detail::ScalarSub(lhs, scalar);
 }
 
 template<typename T>
-inline Vec2<T> &operator*=(Vec2<T> &lhs, const T scalar)
+constexpr Vec2<T> &operator*=(Vec2<T> &lhs, const T scalar)
 {
-    lhs.x *= scalar;
-    lhs.y *= scalar;
-    return lhs;
+    return Detail::ScalarMul(lhs, scalar);
 }
 
 template<typename T>
-inline Vec2<T> &operator/=(Vec2<T> &lhs, const T scalar)
+constexpr Vec2<T> &operator/=(Vec2<T> &lhs, const T scalar)
 {
-    lhs.x /= scalar;
-    lhs.y /= scalar;
-    return lhs;
+    return Detail::ScalarDiv(lhs, scalar);
 }
 
 ///
 /// Arithmetic operators.
 ///
 template<typename T>
-inline Vec2<T> operator+(Vec2<T> lhs, const Vec2<T> &rhs) { return lhs += rhs; }
+constexpr Vec2<T> operator+(Vec2<T> lhs, const Vec2<T> &rhs)
+{
+    return lhs += rhs;
+}
+
 template<typename T>
-inline Vec2<T> operator-(Vec2<T> lhs, const Vec2<T> &rhs) { return lhs -= rhs; }
+constexpr Vec2<T> operator-(Vec2<T> lhs, const Vec2<T> &rhs)
+{
+    return lhs -= rhs;
+}
+
 template<typename T>
-inline Vec2<T> operator*(Vec2<T> lhs, const Vec2<T> &rhs) { return lhs *= rhs; }
+constexpr Vec2<T> operator*(Vec2<T> lhs, const Vec2<T> &rhs)
+{
+    return lhs *= rhs;
+}
+
 template<typename T>
-inline Vec2<T> operator/(Vec2<T> lhs, const Vec2<T> &rhs) { return lhs /= rhs; }
+constexpr Vec2<T> operator/(Vec2<T> lhs, const Vec2<T> &rhs)
+{
+    return lhs /= rhs;
+}
 
 template<typename T>
-inline Vec2<T> operator+(Vec2<T> lhs, const T scalar) { return lhs += scalar; }
+constexpr Vec2<T> operator+(Vec2<T> lhs, const T scalar)
+{
+    return lhs += scalar;
+}
+
 template<typename T>
-inline Vec2<T> operator-(Vec2<T> lhs, const T scalar) { return lhs -= scalar; }
+constexpr Vec2<T> operator-(Vec2<T> lhs, const T scalar)
+{
+    return lhs -= scalar;
+}
+
 template<typename T>
-inline Vec2<T> operator*(Vec2<T> lhs, const T scalar) { return lhs *= scalar; }
+constexpr Vec2<T> operator*(Vec2<T> lhs, const T scalar)
+{
+    return lhs *= scalar;
+}
+
 template<typename T>
-inline Vec2<T> operator/(Vec2<T> lhs, const T scalar) { return lhs /= scalar; }
+constexpr Vec2<T> operator/(Vec2<T> lhs, const T scalar)
+{
+    return lhs /= scalar;
+}
 
 template<typename T>
-inline Vec2<T> operator+(const T scalar, Vec2<T> rhs) { return rhs += scalar; }
+constexpr Vec2<T> operator+(const T scalar, Vec2<T> rhs)
+{
+    return rhs += scalar;
+}
+
 template<typename T>
-inline Vec2<T> operator-(const T scalar, Vec2<T> rhs) {
-    Vec2<T> lhs = -rhs;
-    return lhs += scalar;
+constexpr Vec2<T> operator-(const T scalar, Vec2<T> rhs)
+{
+    return Detail::ScalarRsub(scalar, rhs);
 }
+
 template<typename T>
-inline Vec2<T> operator*(const T scalar, Vec2<T> rhs) { return rhs *= scalar; }
+constexpr Vec2<T> operator*(const T scalar, Vec2<T> rhs)
+{
+    return rhs *= scalar;
+}
+
 template<typename T>
-inline Vec2<T> operator/(const T scalar, Vec2<T> rhs) {
-    return {scalar / rhs.x, scalar / rhs.y};
+constexpr Vec2<T> operator/(const T scalar, Vec2<T> rhs)
+{
+    return Detail::ScalarRdiv(scalar, rhs);
 }
 
 ///
 /// Unary operators.
 ///
 template<typename T>
-inline Vec2<T> operator+(Vec2<T> lhs) { return lhs; }
+constexpr Vec2<T> operator+(Vec2<T> lhs) { return lhs; }
 
 template<typename T>
-inline Vec2<T> operator-(Vec2<T> lhs) { return lhs *= (T) -1; }
+constexpr Vec2<T> operator-(Vec2<T> lhs) { return lhs *= (T) -1; }
 
 ///
 /// Increment operators.
 ///
 template<typename T>
-inline Vec2<T> &operator++(Vec2<T> &lhs) { return lhs += (T) 1; }
+constexpr Vec2<T> &operator++(Vec2<T> &lhs) { return lhs += (T) 1; }
 
 template<typename T>
-inline Vec2<T> &operator--(Vec2<T> &lhs) { return lhs -= (T) 1; }
+constexpr Vec2<T> &operator--(Vec2<T> &lhs) { return lhs -= (T) 1; }
 
 template<typename T>
-inline Vec2<T> operator++(Vec2<T> &lhs, int)
+constexpr Vec2<T> operator++(Vec2<T> &lhs, int)
 {
     Vec2<T> result = lhs;
     ++lhs;
@@ -358,144 +493,187 @@ inline Vec2<T> operator++(Vec2<T> &lhs, int)
 }
 
 template<typename T>
-inline Vec2<T> operator--(Vec2<T> &lhs, int)
+constexpr Vec2<T> operator--(Vec2<T> &lhs, int)
 {
     Vec2<T> result = lhs;
     --lhs;
     return result;
 }
 
+///
+/// Shift operators. Shift each element by count bits, logical for unsigned
+/// and arithmetic for signed vectors.
+///
+template<typename T>
+constexpr Vec2<T> &operator<<=(Vec2<T> &lhs, const int count)
+{
+    return Detail::ScalarShl(lhs, count);
+}
+
+template<typename T>
+constexpr Vec2<T> &operator>>=(Vec2<T> &lhs, const int count)
+{
+    return Detail::ScalarShr(lhs, count);
+}
+
+template<typename T>
+constexpr Vec2<T> operator<<(Vec2<T> lhs, const int count)
+{
+    return lhs <<= count;
+}
+
+template<typename T>
+constexpr Vec2<T> operator>>(Vec2<T> lhs, const int count)
+{
+    return lhs >>= count;
+}
+
 /// ---- Vec3 implementation --------------------------------------------------
 /// Compound assignment operators vector operators.
 ///
 template<typename T>
-inline Vec3<T> &operator+=(Vec3<T> &lhs, const Vec3<T> &rhs)
+constexpr Vec3<T> &operator+=(Vec3<T> &lhs, const Vec3<T> &rhs)
 {
-    lhs.x += rhs.x;
-    lhs.y += rhs.y;
-    lhs.z += rhs.z;
-    return lhs;
+    return Detail::ScalarAdd(lhs, rhs);
 }
 
 template<typename T>
-inline Vec3<T> &operator-=(Vec3<T> &lhs, const Vec3<T> &rhs)
+constexpr Vec3<T> &operator-=(Vec3<T> &lhs, const Vec3<T> &rhs)
 {
-    lhs.x -= rhs.x;
-    lhs.y -= rhs.y;
-    lhs.z -= rhs.z;
-    return lhs;
-
+    return Detail::ScalarSub(lhs, rhs);
 }
 
 template<typename T>
-inline Vec3<T> &operator*=(Vec3<T> &lhs, const Vec3<T> &rhs)
+constexpr Vec3<T> &operator*=(Vec3<T> &lhs, const Vec3<T> &rhs)
 {
-    lhs.x *= rhs.x;
-    lhs.y *= rhs.y;
-    lhs.z *= rhs.z;
-    return lhs;
+    return Detail::ScalarMul(lhs, rhs);
 }
 
 template<typename T>
-inline Vec3<T> &operator/=(Vec3<T> &lhs, const Vec3<T> &rhs)
+constexpr Vec3<T> &operator/=(Vec3<T> &lhs, const Vec3<T> &rhs)
 {
-    lhs.x /= rhs.x;
-    lhs.y /= rhs.y;
-    lhs.z /= rhs.z;
-    return lhs;
+    return Detail::ScalarDiv(lhs, rhs);
 }
 
 template<typename T>
-inline Vec3<T> &operator+=(Vec3<T> &lhs, const T scalar)
+constexpr Vec3<T> &operator+=(Vec3<T> &lhs, const T scalar)
 {
-    lhs.x += scalar;
-    lhs.y += scalar;
-    lhs.z += scalar;
-    return lhs;
+    return Detail::ScalarAdd(lhs, scalar);
 }
 
 template<typename T>
-inline Vec3<T> &operator-=(Vec3<T> &lhs, const T scalar)
+constexpr Vec3<T> &operator-=(Vec3<T> &lhs, const T scalar)
 {
-    lhs.x -= scalar;
-    lhs.y -= scalar;
-    lhs.z -= scalar;
-    return lhs;
+    return Detail::ScalarSub(lhs, scalar);
 }
 
 template<typename T>
-inline Vec3<T> &operator*=(Vec3<T> &lhs, const T scalar)
+constexpr Vec3<T> &operator*=(Vec3<T> &lhs, const T scalar)
 {
-    lhs.x *= scalar;
-    lhs.y *= scalar;
-    lhs.z *= scalar;
-    return lhs;
+    return Detail::ScalarMul(lhs, scalar);
 }
 
 template<typename T>
-inline Vec3<T> &operator/=(Vec3<T> &lhs, const T scalar)
+constexpr Vec3<T> &operator/=(Vec3<T> &lhs, const T scalar)
 {
-    lhs.x /= scalar;
-    lhs.y /= scalar;
-    lhs.z /= scalar;
-    return lhs;
+    return Detail::ScalarDiv(lhs, scalar);
 }
 
 ///
 /// Arithmetic operators.
 ///
 template<typename T>
-inline Vec3<T> operator+(Vec3<T> lhs, const Vec3<T> &rhs) { return lhs += rhs; }
+constexpr Vec3<T> operator+(Vec3<T> lhs, const Vec3<T> &rhs)
+{
+    return lhs += rhs;
+}
+
 template<typename T>
-inline Vec3<T> operator-(Vec3<T> lhs, const Vec3<T> &rhs) { return lhs -= rhs; }
+constexpr Vec3<T> operator-(Vec3<T> lhs, const Vec3<T> &rhs)
+{
+    return lhs -= rhs;
+}
+
 template<typename T>
-inline Vec3<T> operator*(Vec3<T> lhs, const Vec3<T> &rhs) { return lhs *= rhs; }
+constexpr Vec3<T> operator*(Vec3<T> lhs, const Vec3<T> &rhs)
+{
+    return lhs *= rhs;
+}
+
 template<typename T>
-inline Vec3<T> operator/(Vec3<T> lhs, const Vec3<T> &rhs) { return lhs /= rhs; }
+constexpr Vec3<T> operator/(Vec3<T> lhs, const Vec3<T> &rhs)
+{
+    return lhs /= rhs;
+}
 
 template<typename T>
-inline Vec3<T> operator+(Vec3<T> lhs, const T scalar) { return lhs += scalar; }
+constexpr Vec3<T> operator+(Vec3<T> lhs, const T scalar)
+{
+    return lhs += scalar;
+}
+
 template<typename T>
-inline Vec3<T> operator-(Vec3<T> lhs, const T scalar) { return lhs -= scalar; }
+constexpr Vec3<T> operator-(Vec3<T> lhs, const T scalar)
+{
+    return lhs -= scalar;
+}
+
 template<typename T>
-inline Vec3<T> operator*(Vec3<T> lhs, const T scalar) { return lhs *= scalar; }
+constexpr Vec3<T> operator*(Vec3<T> lhs, const T scalar)
+{
+    return lhs *= scalar;
+}
+
 template<typename T>
-inline Vec3<T> operator/(Vec3<T> lhs, const T scalar) { return lhs /= scalar; }
+constexpr Vec3<T> operator/(Vec3<T> lhs, const T scalar)
+{
+    return lhs /= scalar;
+}
 
 template<typename T>
-inline Vec3<T> operator+(const T scalar, Vec3<T> rhs) { return rhs += scalar; }
+constexpr Vec3<T> operator+(const T scalar, Vec3<T> rhs)
+{
+    return rhs += scalar;
+}
+
 template<typename T>
-inline Vec3<T> operator-(const T scalar, Vec3<T> rhs) {
-    Vec3<T> lhs = -rhs;
-    return lhs += scalar;
+constexpr Vec3<T> operator-(const T scalar, Vec3<T> rhs)
+{
+    return Detail::ScalarRsub(scalar, rhs);
 }
+
 template<typename T>
-inline Vec3<T> operator*(const T scalar, Vec3<T> rhs) { return rhs *= scalar; }
+constexpr Vec3<T> operator*(const T scalar, Vec3<T> rhs)
+{
+    return rhs *= scalar;
+}
+
 template<typename T>
-inline Vec3<T> operator/(const T scalar, Vec3<T> rhs) {
-    return {scalar / rhs.x, scalar / rhs.y, scalar / rhs.z};
+constexpr Vec3<T> operator/(const T scalar, Vec3<T> rhs)
+{
+    return Detail::ScalarRdiv(scalar, rhs);
 }
 
 ///
 /// Unary operators.
 ///
 template<typename T>
-inline Vec3<T> operator+(Vec3<T> lhs) { return lhs; }
+constexpr Vec3<T> operator+(Vec3<T> lhs) { return lhs; }
 
 template<typename T>
-inline Vec3<T> operator-(Vec3<T> lhs) { return lhs *= (T) -1; }
+constexpr Vec3<T> operator-(Vec3<T> lhs) { return lhs *= (T) -1; }
 
 ///
 /// Increment operators.
 ///
 template<typename T>
-inline Vec3<T> &operator++(Vec3<T> &lhs) { return lhs += (T) 1; }
+constexpr Vec3<T> &operator++(Vec3<T> &lhs) { return lhs += (T) 1; }
 
 template<typename T>
-inline Vec3<T> &operator--(Vec3<T> &lhs) { return lhs -= (T) 1; }
+constexpr Vec3<T> &operator--(Vec3<T> &lhs) { return lhs -= (T) 1; }
 
 template<typename T>
-inline Vec3<T> operator++(Vec3<T> &lhs, int)
+constexpr Vec3<T> operator++(Vec3<T> &lhs, int)
 {
     Vec3<T> result = lhs;
     ++lhs;
@@ -504,151 +682,187 @@ inline Vec3<T> operator++(Vec3<T> &lhs, int)
 }
 
 template<typename T>
-inline Vec3<T> operator--(Vec3<T> &lhs, int)
+constexpr Vec3<T> operator--(Vec3<T> &lhs, int)
 {
     Vec3<T> result = lhs;
     --lhs;
     return result;
 }
 
+///
+/// Shift operators. Shift each element by count bits, logical for unsigned
+/// and arithmetic for signed vectors.
+///
+template<typename T>
+constexpr Vec3<T> &operator<<=(Vec3<T> &lhs, const int count)
+{
+    return Detail::ScalarShl(lhs, count);
+}
+
+template<typename T>
+constexpr Vec3<T> &operator>>=(Vec3<T> &lhs, const int count)
+{
+    return Detail::ScalarShr(lhs, count);
+}
+
+template<typename T>
+constexpr Vec3<T> operator<<(Vec3<T> lhs, const int count)
+{
+    return lhs <<= count;
+}
+
+template<typename T>
+constexpr Vec3<T> operator>>(Vec3<T> lhs, const int count)
+{
+    return lhs >>= count;
+}
+
 /// ---- Vec4 implementation --------------------------------------------------
 /// Compound assignment operators vector operators.
 ///
 template<typename T>
-inline Vec4<T> &operator+=(Vec4<T> &lhs, const Vec4<T> &rhs)
+constexpr Vec4<T> &operator+=(Vec4<T> &lhs, const Vec4<T> &rhs)
 {
-    lhs.x += rhs.x;
-    lhs.y += rhs.y;
-    lhs.z += rhs.z;
-    lhs.w += rhs.w;
-    return lhs;
+    return Detail::ScalarAdd(lhs, rhs);
 }
 
 template<typename T>
-inline Vec4<T> &operator-=(Vec4<T> &lhs, const Vec4<T> &rhs)
+constexpr Vec4<T> &operator-=(Vec4<T> &lhs, const Vec4<T> &rhs)
 {
-    lhs.x -= rhs.x;
-    lhs.y -= rhs.y;
-    lhs.z -= rhs.z;
-    lhs.w -= rhs.w;
-    return lhs;
+    return Detail::ScalarSub(lhs, rhs);
 }
 
 template<typename T>
-inline Vec4<T> &operator*=(Vec4<T> &lhs, const Vec4<T> &rhs)
+constexpr Vec4<T> &operator*=(Vec4<T> &lhs, const Vec4<T> &rhs)
 {
-    lhs.x *= rhs.x;
-    lhs.y *= rhs.y;
-    lhs.z *= rhs.z;
-    lhs.w *= rhs.w;
-    return lhs;
+    return Detail::ScalarMul(lhs, rhs);
 }
 
 template<typename T>
-inline Vec4<T> &operator/=(Vec4<T> &lhs, const Vec4<T> &rhs)
+constexpr Vec4<T> &operator/=(Vec4<T> &lhs, const Vec4<T> &rhs)
 {
-    lhs.x /= rhs.x;
-    lhs.y /= rhs.y;
-    lhs.z /= rhs.z;
-    lhs.w /= rhs.w;
-    return lhs;
+    return Detail::ScalarDiv(lhs, rhs);
 }
 
 template<typename T>
-inline Vec4<T> &operator+=(Vec4<T> &lhs, const T scalar)
+constexpr Vec4<T> &operator+=(Vec4<T> &lhs, const T scalar)
 {
-    lhs.x += scalar;
-    lhs.y += scalar;
-    lhs.z += scalar;
-    lhs.w += scalar;
-    return lhs;
+    return Detail::ScalarAdd(lhs, scalar);
 }
 
 template<typename T>
-inline Vec4<T> &operator-=(Vec4<T> &lhs, const T scalar)
+constexpr Vec4<T> &operator-=(Vec4<T> &lhs, const T scalar)
 {
-    lhs.x -= scalar;
-    lhs.y -= scalar;
-    lhs.z -= scalar;
-    lhs.w -= scalar;
-    return lhs;
+    return Detail::ScalarSub(lhs, scalar);
 }
 
 template<typename T>
-inline Vec4<T> &operator*=(Vec4<T> &lhs, const T scalar)
+constexpr Vec4<T> &operator*=(Vec4<T> &lhs, const T scalar)
 {
-    lhs.x *= scalar;
-    lhs.y *= scalar;
-    lhs.z *= scalar;
-    lhs.w *= scalar;
-    return lhs;
+    return Detail::ScalarMul(lhs, scalar);
 }
 
 template<typename T>
-inline Vec4<T> &operator/=(Vec4<T> &lhs, const T scalar)
+constexpr Vec4<T> &operator/=(Vec4<T> &lhs, const T scalar)
 {
-    lhs.x /= scalar;
-    lhs.y /= scalar;
-    lhs.z /= scalar;
-    lhs.w /= scalar;
-    return lhs;
+    return Detail::ScalarDiv(lhs, scalar);
 }
 
 ///
 /// Arithmetic operators.
 ///
 template<typename T>
-inline Vec4<T> operator+(Vec4<T> lhs, const Vec4<T> &rhs) { return lhs += rhs; }
+constexpr Vec4<T> operator+(Vec4<T> lhs, const Vec4<T> &rhs)
+{
+    return lhs += rhs;
+}
+
 template<typename T>
-inline Vec4<T> operator-(Vec4<T> lhs, const Vec4<T> &rhs) { return lhs -= rhs; }
+constexpr Vec4<T> operator-(Vec4<T> lhs, const Vec4<T> &rhs)
+{
+    return lhs -= rhs;
+}
+
 template<typename T>
-inline Vec4<T> operator*(Vec4<T> lhs, const Vec4<T> &rhs) { return lhs *= rhs; }
+constexpr Vec4<T> operator*(Vec4<T> lhs, const Vec4<T> &rhs)
+{
+    return lhs *= rhs;
+}
+
 template<typename T>
-inline Vec4<T> operator/(Vec4<T> lhs, const Vec4<T> &rhs) { return lhs /= rhs; }
+constexpr Vec4<T> operator/(Vec4<T> lhs, const Vec4<T> &rhs)
+{
+    return lhs /= rhs;
+}
 
 template<typename T>
-inline Vec4<T> operator+(Vec4<T> lhs, const T scalar) { return lhs += scalar; }
+constexpr Vec4<T> operator+(Vec4<T> lhs, const T scalar)
+{
+    return lhs += scalar;
+}
+
 template<typename T>
-inline Vec4<T> operator-(Vec4<T> lhs, const T scalar) { return lhs -= scalar; }
+constexpr Vec4<T> operator-(Vec4<T> lhs, const T scalar)
+{
+    return lhs -= scalar;
+}
+
 template<typename T>
-inline Vec4<T> operator*(Vec4<T> lhs, const T scalar) { return lhs *= scalar; }
+constexpr Vec4<T> operator*(Vec4<T> lhs, const T scalar)
+{
+    return lhs *= scalar;
+}
+
 template<typename T>
-inline Vec4<T> operator/(Vec4<T> lhs, const T scalar) { return lhs /= scalar; }
+constexpr Vec4<T> operator/(Vec4<T> lhs, const T scalar)
+{
+    return lhs /= scalar;
+}
 
 template<typename T>
-inline Vec4<T> operator+(const T scalar, Vec4<T> rhs) { return rhs += scalar; }
+constexpr Vec4<T> operator+(const T scalar, Vec4<T> rhs)
+{
+    return rhs += scalar;
+}
+
 template<typename T>
-inline Vec4<T> operator-(const T scalar, Vec4<T> rhs) {
-    Vec4<T> lhs = -rhs;
-    return lhs += scalar;
+constexpr Vec4<T> operator-(const T scalar, Vec4<T> rhs)
+{
+    return Detail::ScalarRsub(scalar, rhs);
 }
+
 template<typename T>
-inline Vec4<T> operator*(const T scalar, Vec4<T> rhs) { return rhs *= scalar; }
+constexpr Vec4<T> operator*(const T scalar, Vec4<T> rhs)
+{
+    return rhs *= scalar;
+}
+
 template<typename T>
-inline Vec4<T> operator/(const T scalar, Vec4<T> rhs) {
-    return {scalar / rhs.x, scalar / rhs.y, scalar / rhs.z, scalar / rhs.w};
+constexpr Vec4<T> operator/(const T scalar, Vec4<T> rhs)
+{
+    return Detail::ScalarRdiv(scalar, rhs);
 }
 
 ///
 /// Unary operators.
 ///
 template<typename T>
-inline Vec4<T> operator+(Vec4<T> lhs) { return lhs; }
+constexpr Vec4<T> operator+(Vec4<T> lhs) { return lhs; }
 
 template<typename T>
-inline Vec4<T> operator-(Vec4<T> lhs) { return lhs *= (T) -1; }
+constexpr Vec4<T> operator-(Vec4<T> lhs) { return lhs *= (T) -1; }
 
 ///
 /// Increment operators.
 ///
 template<typename T>
-inline Vec4<T> &operator++(Vec4<T> &lhs) { return lhs += (T) 1; }
+constexpr Vec4<T> &operator++(Vec4<T> &lhs) { return lhs += (T) 1; }
 
 template<typename T>
-inline Vec4<T> &operator--(Vec4<T> &lhs) { return lhs -= (T) 1; }
+constexpr Vec4<T> &operator--(Vec4<T> &lhs) { return lhs -= (T) 1; }
 
 template<typename T>
-inline Vec4<T> operator++(Vec4<T> &lhs, int)
+constexpr Vec4<T> operator++(Vec4<T> &lhs, int)
 {
     Vec4<T> result = lhs;
     ++lhs;
@@ -656,13 +870,42 @@ inline Vec4<T> operator++(Vec4<T> &lhs, int)
 }
 
 template<typename T>
-inline Vec4<T> operator--(Vec4<T> &lhs, int)
+constexpr Vec4<T> operator--(Vec4<T> &lhs, int)
 {
     Vec4<T> result = lhs;
     --lhs;
     return result;
 }
 
+///
+/// Shift operators. Shift each element by count bits, logical for unsigned
+/// and arithmetic for signed vectors.
+///
+template<typename T>
+constexpr Vec4<T> &operator<<=(Vec4<T> &lhs, const int count)
+{
+    return Detail::ScalarShl(lhs, count);
+}
+
+template<typename T>
+constexpr Vec4<T> &operator>>=(Vec4<T> &lhs, const int count)
+{
+    return Detail::ScalarShr(lhs, count);
+}
+
+template<typename T>
+constexpr Vec4<T> operator<<(Vec4<T> lhs, const int count)
+{
+    return lhs <<= count;
+}
+
+template<typename T>
+constexpr Vec4<T> operator>>(Vec4<T> lhs, const int count)
+{
+    return lhs >>= count;
+}
+
+} // inline namespace MATH_SIMD_ISA
 } // namespace Math
 
 /// ---- simd implementations ------------------------------------------------
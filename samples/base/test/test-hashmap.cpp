@@ -0,0 +1,139 @@
+//
+// test-hashmap.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "test-hashmap.h"
+
+static constexpr uint32_t kNumThreads = 8;
+static constexpr uint32_t kNumItems = 1 << 20;
+static constexpr uint32_t kNumKeys = 1 << 16;
+
+/// -----------------------------------------------------------------------------
+void test_base_hashmap(void)
+{
+    // Generate random keys with duplicates and their reference counts.
+    std::mt19937 rng(kNumItems);
+    std::uniform_int_distribution<uint32_t> dist(0, kNumKeys - 1);
+    std::vector<uint32_t> keys(kNumItems);
+    std::unordered_map<uint32_t, uint32_t> counts;
+    for (auto &key : keys) {
+        key = dist(rng) * 2654435761U;
+        counts[key]++;
+    }
+
+    // Test single-threaded insert and multi-value iteration.
+    {
+        Base::Hashmap hashmap = Base::Hashmap::Create(64);
+        REQUIRE(hashmap.capacity() == 128);
+        for (uint32_t i = 0; i < 32; ++i) {
+            REQUIRE(hashmap.insert(i % 4, i));
+        }
+        REQUIRE(hashmap.size() == 32);
+
+        // The empty key is reserved and is never inserted.
+        const uint32_t empty = Base::Hashmap::kEmpty;
+        REQUIRE(!hashmap.insert(empty, empty));
+        REQUIRE(!hashmap.insert(empty, 0));
+        std::vector<uint32_t> empty_keys = {5, empty, 6};
+        REQUIRE_THROWS_AS(
+            hashmap.insert(empty_keys.data(), nullptr, empty_keys.size()),
+            std::runtime_error);
+        REQUIRE(hashmap.size() == 32);
+        REQUIRE(hashmap.begin(5) == hashmap.end());
+
+        for (uint32_t key = 0; key < 4; ++key) {
+            uint32_t sum = 0;
+            uint32_t num = 0;
+            for (uint32_t slot = hashmap.begin(key);
+                 slot != hashmap.end();
+                 slot = hashmap.next(key, slot)) {
+                REQUIRE(hashmap.get(slot) % 4 == key);
+                sum += hashmap.get(slot);
+                num++;
+            }
+            REQUIRE(num == 8);
+            REQUIRE(sum == 8 * key + 4 * 28);
+        }
+        REQUIRE(hashmap.begin(4) == hashmap.end());
+
+        // Batched lookup of present and missing keys, with tail keys.
+        std::vector<uint32_t> batch_keys;
+        for (uint32_t i = 0; i < 19; ++i) {
+            batch_keys.push_back(i % 6);
+        }
+        std::vector<uint32_t> batch_slots(batch_keys.size());
+        hashmap.begin(batch_keys.data(), batch_slots.data(), batch_keys.size());
+        for (size_t i = 0; i < batch_keys.size(); ++i) {
+            REQUIRE(batch_slots[i] == hashmap.begin(batch_keys[i]));
+        }
+
+        hashmap.clear();
+        REQUIRE(hashmap.size() == 0);
+        REQUIRE(hashmap.begin(0) == hashmap.end());
+    }
+
+    // Test parallel bulk insert, lookup and resize.
+    Base::ThreadPool::Initialize(kNumThreads);
+    {
+        Base::Hashmap hashmap = Base::Hashmap::Create(Base::Hashmap::kMinSize);
+        hashmap.insert(keys.data(), nullptr, keys.size());
+        REQUIRE(hashmap.size() == kNumItems);
+        std::cout << "hashmap capacity " << hashmap.capacity()
+            << " size " << hashmap.size() << "\n";
+
+        auto check = [&](const Base::Hashmap &hashmap) {
+            for (auto &it : counts) {
+                uint32_t num = 0;
+                for (uint32_t slot = hashmap.begin(it.first);
+                     slot != hashmap.end();
+                     slot = hashmap.next(it.first, slot)) {
+                    REQUIRE(keys[hashmap.get(slot)] == it.first);
+                    num++;
+                }
+                REQUIRE(num == it.second);
+            }
+        };
+        check(hashmap);
+
+        // Compare batched lookups with single key lookups, including missing
+        // keys and keys whose probe sequence wraps around the table end.
+        std::vector<uint32_t> lookup(keys.begin(), keys.begin() + 4096);
+        for (uint32_t i = 0; i < 1024; ++i) {
+            lookup.push_back(i * 2654435761U + 1);
+            lookup.push_back(hashmap.capacity() - 1 - (i & 7));
+        }
+        std::vector<uint32_t> slots(lookup.size());
+        hashmap.begin(lookup.data(), slots.data(), lookup.size());
+        for (size_t i = 0; i < lookup.size(); ++i) {
+            REQUIRE(slots[i] == hashmap.begin(lookup[i]));
+        }
+
+        std::vector<uint32_t> values(kNumItems);
+        hashmap.find(keys.data(), values.data(), keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            REQUIRE(values[i] != Base::Hashmap::kEmpty);
+            REQUIRE(keys[values[i]] == keys[i]);
+        }
+
+        hashmap.resize(4 * hashmap.capacity());
+        REQUIRE(hashmap.size() == kNumItems);
+        check(hashmap);
+    }
+    Base::ThreadPool::Terminate();
+}
+
+/// -----------------------------------------------------------------------------
+TEST_CASE("BaseHashmap") {
+    test_base_hashmap();
+}
@@ -0,0 +1,17 @@
+//
+// test-hashmap.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_BASE_HASHMAP_H_
+#define TEST_BASE_HASHMAP_H_
+
+#include "minicore/base/base.h"
+
+void test_base_hashmap(void);
+
+#endif // TEST_BASE_HASHMAP_H_
@@ -48,7 +48,47 @@ void test_base_parallel(void)
     exit(EXIT_SUCCESS);
 }
 
+///
+/// @brief Run a parallel loop from each item of a parallel loop. The inner loops
+/// run in the pool threads and must cover every item without waiting on the
+/// pool.
+///
+void test_base_parallel_nested(void)
+{
+    static constexpr size_t kNumOuter = 64;
+    static constexpr size_t kNumInner = 1000;
+    std::array<size_t, kNumOuter> sums = {};
+
+    Base::ThreadPool::Initialize(4);
+    REQUIRE(!Base::ThreadPool::IsPoolThread());
+    Base::ParallelForIf(
+        [](size_t outer, void *data) {
+            size_t *sum = static_cast<size_t *>(data) + outer;
+            Base::ParallelForIf(
+                [](size_t inner, void *data) {
+                    *static_cast<size_t *>(data) += inner;
+                },
+                kNumInner,
+                sum,
+                true
+            );
+        },
+        kNumOuter,
+        sums.data(),
+        true
+    );
+    Base::ThreadPool::Terminate();
+
+    for (auto &sum : sums) {
+        REQUIRE(sum == kNumInner * (kNumInner - 1) / 2);
+    }
+}
+
 /// -----------------------------------------------------------------------------
+TEST_CASE("BaseParallelNested") {
+    test_base_parallel_nested();
+}
+
 TEST_CASE("BaseParallel") {
     test_base_parallel();
 }
@@ -13,5 +13,6 @@
 #include "minicore/base/base.h"
 
 void test_base_parallel(void);
+void test_base_parallel_nested(void);
 
 #endif // TEST_BASE_PARALLEL_H_
@@ -27,10 +27,6 @@ static const cl_float3 kDomainHi = { 1.0f,  1.0f,  1.0f};
 static const cl_uint kNumCells = 16;
 
 static const cl_uint kEmpty = 0xffffffff;   // Empty slot flag
-static const cl_uint kMinBits = 3;          // Min capacity 8 items
-static const cl_uint kMaxBits = 31;         // Max capacity 2147483648 items
-static const cl_uint kMinSize = 1 << kMinBits;
-static const cl_uint kMaxSize = 1 << kMaxBits;
 
 /// @brief Common data types.
 struct Point {
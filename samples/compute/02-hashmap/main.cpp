@@ -11,6 +11,7 @@
 #include <iomanip>
 #include <exception>
 #include <random>
+#include <chrono>
 
 #include "common.h"
 #include "modelgpu.h"
@@ -67,18 +68,33 @@ void ValidateKeys()
 }
 
 ///
-/// @brief Run the simulation.
+/// @brief Run the simulation. Time the gpu model, the cpu model using the
+/// concurrent hashmap and the std::unordered_multimap baseline.
 ///
 void Run()
 {
+    using Clock = std::chrono::high_resolution_clock;
+    using Msec = std::chrono::duration<double, std::ratio<1,1000>>;
+
     gModelGpu.Initialize();
     gModelCpu.Initialize();
 
     for (size_t i = 0; i < kNumIters; ++i) {
         std::cout << "Iteration " << i << "\n";
         CreatePoints();
+
+        auto tic = Clock::now();
         gModelGpu.Run(gPoints);
+        auto toc = Clock::now();
+        std::cout << "ModelGpu " << Msec(toc - tic).count() << " msec\n";
+
+        tic = Clock::now();
         gModelCpu.Run(gPoints);
+        toc = Clock::now();
+        std::cout << "ModelCpu " << Msec(toc - tic).count() << " msec\n";
+
+        gModelCpu.RunUnorderedMap();
+        gModelCpu.RunNeighbours(gPoints);
         ValidateKeys();
     }
 
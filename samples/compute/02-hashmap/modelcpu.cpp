@@ -11,18 +11,57 @@
 #include <vector>
 #include <utility>
 #include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
 
 #include "common.h"
-#include "hashmap.h"
 #include "modelcpu.h"
 
+///
+/// @brief Compute the hash value of a cell index.
+///
+static uint32_t Hash(const cl_uint3 &v)
+{
+    const uint32_t c1 = static_cast<uint32_t>(73856093);
+    const uint32_t c2 = static_cast<uint32_t>(19349663);
+    const uint32_t c3 = static_cast<uint32_t>(83492791);
+
+    uint32_t h1 = c1 * v.s[0];
+    uint32_t h2 = c2 * v.s[1];
+    uint32_t h3 = c3 * v.s[2];
+    return (h1 ^ h2 ^ h3);
+    // return (7*h1 + 503*h2 + 24847*h3);
+}
+
+///
+/// @brief Compute the cell index of a given point.
+///
+static cl_uint3 CellId(const cl_float3 &p)
+{
+    cl_float3 u = (p - kDomainLo);
+    u /= (kDomainHi - kDomainLo);
+    u *= (cl_float) kNumCells;
+
+    const uint32_t v1 = static_cast<uint32_t>(u.s[0]);
+    const uint32_t v2 = static_cast<uint32_t>(u.s[1]);
+    const uint32_t v3 = static_cast<uint32_t>(u.s[2]);
+    return (cl_uint3) {v1, v2, v3};
+}
+
 ///
 /// @brief Initialize the cpu model.
 ///
 void ModelCpu::Initialize()
 {
+    // Initialize the thread pool used by the hashmap bulk operations.
+    Base::ThreadPool::Initialize(std::thread::hardware_concurrency());
+
     // Initialize model data.
-    mHashmap = Hashmap::Create(kLoadFactor * kNumPoints);
+    mHashmap = Base::Hashmap::Create(kLoadFactor * kNumPoints);
+    mCellKeys.resize(kNumPoints, 0);
+    mValues.resize(kNumPoints, 0);
     mKeys.resize(kNumPoints, {0, 0});
 }
 
@@ -30,52 +69,153 @@ void ModelCpu::Initialize()
 /// @brief Cleanup the cpu model.
 ///
 void ModelCpu::Cleanup()
-{}
+{
+    Base::ThreadPool::Terminate();
+}
 
 ///
 /// @brief Run the cpu model.
 ///
 void ModelCpu::Run(std::vector<Point> &points)
 {
-    // Compute the hash value of a cell index.
-    auto hash = [&](const cl_uint3 &v) -> uint32_t {
-        const uint32_t c1 = static_cast<uint32_t>(73856093);
-        const uint32_t c2 = static_cast<uint32_t>(19349663);
-        const uint32_t c3 = static_cast<uint32_t>(83492791);
-
-        uint32_t h1 = c1 * v.s[0];
-        uint32_t h2 = c2 * v.s[1];
-        uint32_t h3 = c3 * v.s[2];
-        return (h1 ^ h2 ^ h3);
-        // return (7*h1 + 503*h2 + 24847*h3);
-    };
-
-    // Compute the cell index of a given point.
-    auto CellId = [&](const cl_float3 &p) -> cl_uint3 {
-        cl_float3 u = (p - kDomainLo);
-        u /= (kDomainHi - kDomainLo);
-        u *= (cl_float) kNumCells;
-
-        const uint32_t v1 = static_cast<uint32_t>(u.s[0]);
-        const uint32_t v2 = static_cast<uint32_t>(u.s[1]);
-        const uint32_t v3 = static_cast<uint32_t>(u.s[2]);
-        return (cl_uint3) {v1, v2, v3};
-    };
-
-    // Create the hashmap from the array of particles.
-    mHashmap.clear();
+    using Clock = std::chrono::high_resolution_clock;
+    using Msec = std::chrono::duration<double, std::ratio<1,1000>>;
+
+    // Compute the cell keys of the array of particles.
     for (size_t i = 0; i < kNumPoints; i++) {
-         mHashmap.insert(hash(CellId(points[i].pos)), (uint32_t) i);
+        mCellKeys[i] = Hash(CellId(points[i].pos));
     }
 
+    // Create the hashmap from the array of particles in parallel.
+    auto tic = Clock::now();
+    mHashmap.clear();
+    mHashmap.insert(mCellKeys.data(), nullptr, kNumPoints);
+    auto toc = Clock::now();
+    std::cout << "Hashmap insert " << Msec(toc - tic).count() << " msec\n";
+
+    // Find the first value of each particle cell key in parallel.
+    tic = Clock::now();
+    mHashmap.find(mCellKeys.data(), mValues.data(), kNumPoints);
+    toc = Clock::now();
+    std::cout << "Hashmap find " << Msec(toc - tic).count() << " msec\n";
+
     // Query the hashmap for all valid key-value pairs.
     {
         std::fill(mKeys.begin(), mKeys.end(), std::make_pair(0, 0));
-        for (auto &slot : mHashmap.data()) {
-            if (slot.key != mHashmap.end()) {
-                mKeys[slot.value] = std::make_pair(
-                    slot.key, slot.key % kCapacity);
+        for (uint32_t slot = 0; slot < mHashmap.capacity(); ++slot) {
+            Base::Hashmap::KeyValue kv = mHashmap.at(slot);
+            if (kv.key != mHashmap.end()) {
+                mKeys[kv.value] = std::make_pair(kv.key, kv.key % kCapacity);
+            }
+        }
+    }
+}
+
+///
+/// @brief Run the same insert and find operations on a std::unordered_multimap
+/// as a baseline for the cpu model.
+///
+void ModelCpu::RunUnorderedMap()
+{
+    using Clock = std::chrono::high_resolution_clock;
+    using Msec = std::chrono::duration<double, std::ratio<1,1000>>;
+
+    std::unordered_multimap<uint32_t, uint32_t> hashmap;
+    hashmap.reserve(kNumPoints);
+
+    auto tic = Clock::now();
+    for (size_t i = 0; i < kNumPoints; i++) {
+        hashmap.emplace(mCellKeys[i], (uint32_t) i);
+    }
+    auto toc = Clock::now();
+    std::cout << "std::unordered_multimap insert "
+        << Msec(toc - tic).count() << " msec\n";
+
+    tic = Clock::now();
+    for (size_t i = 0; i < kNumPoints; i++) {
+        auto it = hashmap.find(mCellKeys[i]);
+        mValues[i] = (it != hashmap.end()) ? it->second : kEmpty;
+    }
+    toc = Clock::now();
+    std::cout << "std::unordered_multimap find "
+        << Msec(toc - tic).count() << " msec\n";
+}
+
+///
+/// @brief Benchmark the neighbour cell queries of each particle at several
+/// load factors. Each particle looks up the first slot of its 27 neighbour
+/// cells, one key at a time and as a single batched lookup.
+///
+void ModelCpu::RunNeighbours(std::vector<Point> &points)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    using Msec = std::chrono::duration<double, std::ratio<1,1000>>;
+    static const uint32_t kNumNeighbours = 27;
+    static const uint32_t kNumSlots = 2 * kNumPoints;
+
+    // Compute the neighbour cell keys of each cell with periodic boundaries.
+    const uint32_t num_cells = kNumCells * kNumCells * kNumCells;
+    std::vector<uint32_t> neighbours(kNumNeighbours * num_cells);
+    for (uint32_t cell = 0; cell < num_cells; ++cell) {
+        uint32_t x = cell % kNumCells;
+        uint32_t y = (cell / kNumCells) % kNumCells;
+        uint32_t z = cell / (kNumCells * kNumCells);
+        uint32_t *keys = &neighbours[kNumNeighbours * cell];
+        for (uint32_t k = 0; k < kNumNeighbours; ++k) {
+            cl_uint3 v = {
+                (x + kNumCells + k % 3 - 1) % kNumCells,
+                (y + kNumCells + (k / 3) % 3 - 1) % kNumCells,
+                (z + kNumCells + k / 9 - 1) % kNumCells};
+            keys[k] = Hash(v);
+        }
+    }
+
+    std::vector<uint32_t> cells(kNumPoints);
+    for (size_t i = 0; i < kNumPoints; i++) {
+        cl_uint3 v = CellId(points[i].pos);
+        cells[i] = v.s[0] + kNumCells * (v.s[1] + kNumCells * v.s[2]);
+    }
+
+    // Time the neighbour queries with a fixed capacity and increasing number
+    // of items in the hashmap.
+    const double load_factors[] = {0.25, 0.5, 0.75, 0.875};
+    for (auto &load_factor : load_factors) {
+        uint32_t num_items = (uint32_t) (load_factor * kNumSlots);
+        Base::Hashmap hashmap = Base::Hashmap::Create(kNumSlots - 1);
+        for (uint32_t i = 0; i < num_items; ++i) {
+            hashmap.insert(mCellKeys[i % kNumPoints], i);
+        }
+
+        uint64_t sum_single = 0;
+        auto tic = Clock::now();
+        for (size_t i = 0; i < kNumPoints; i++) {
+            const uint32_t *keys = &neighbours[kNumNeighbours * cells[i]];
+            for (uint32_t k = 0; k < kNumNeighbours; ++k) {
+                sum_single += hashmap.begin(keys[k]);
+            }
+        }
+        auto toc = Clock::now();
+        double msec_single = Msec(toc - tic).count();
+
+        uint64_t sum_batch = 0;
+        uint32_t slots[kNumNeighbours];
+        tic = Clock::now();
+        for (size_t i = 0; i < kNumPoints; i++) {
+            const uint32_t *keys = &neighbours[kNumNeighbours * cells[i]];
+            hashmap.begin(keys, slots, kNumNeighbours);
+            for (uint32_t k = 0; k < kNumNeighbours; ++k) {
+                sum_batch += slots[k];
             }
         }
+        toc = Clock::now();
+        double msec_batch = Msec(toc - tic).count();
+
+        if (sum_single != sum_batch) {
+            throw std::runtime_error("mismatch hashmap neighbour queries");
+        }
+        std::cout << "Hashmap neighbours load factor "
+            << (double) num_items / hashmap.capacity()
+            << " single " << msec_single << " msec"
+            << " batch " << msec_batch << " msec\n";
     }
 }
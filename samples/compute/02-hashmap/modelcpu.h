@@ -13,11 +13,13 @@
 #include <vector>
 #include <utility>
 
+#include "minicore/base/base.h"
 #include "common.h"
-#include "hashmap.h"
 
 struct ModelCpu {
-    Hashmap mHashmap;
+    Base::Hashmap mHashmap;
+    std::vector<uint32_t> mCellKeys;
+    std::vector<uint32_t> mValues;
     std::vector<std::pair<uint32_t, uint32_t>> mKeys;
     const std::pair<uint32_t, uint32_t> &key(size_t i) const {
         return mKeys[i];
@@ -26,6 +28,8 @@ struct ModelCpu {
     void Initialize();
     void Cleanup();
     void Run(std::vector<Point> &points);
+    void RunUnorderedMap();
+    void RunNeighbours(std::vector<Point> &points);
 };
 
 #endif // MODELCPU_H_
@@ -0,0 +1,194 @@
+//
+// bench-algebra.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Matrix algebra throughput benchmark. Each operation is applied to an
+/// array of random matrices and repeated over a number of passes. The array is
+/// small enough to stay in cache, so the throughput measures the instruction
+/// sequence of the inline functions and the array kernels rather than memory
+/// bandwidth.
+///
+static const size_t kNumItems = 1024;
+static const size_t kNumPasses = 2048;
+
+template<typename T>
+struct Operands {
+    Array<Math::Mat4<T>> a;
+    Array<Math::Mat4<T>> b;
+    Array<Math::Mat4<T>> mat;
+    Array<Math::Vec4<T>> vec;
+    Array<Math::Vec4<T>> out;
+    Array<Math::Vec3<T>> axis;
+    Array<T> angle;
+    Array<T> det;
+};
+
+///
+/// @brief Create the random operands. Shift the diagonal of the matrices to
+/// keep them well conditioned.
+///
+template<typename T>
+static Operands<T> CreateOperands()
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+
+    Operands<T> ops;
+    ops.a.resize(kNumItems);
+    ops.b.resize(kNumItems);
+    ops.mat.resize(kNumItems);
+    ops.vec.resize(kNumItems);
+    ops.out.resize(kNumItems);
+    ops.axis.resize(kNumItems);
+    ops.angle.resize(kNumItems);
+    ops.det.resize(kNumItems);
+    for (size_t i = 0; i < kNumItems; ++i) {
+        for (size_t j = 0; j < 16; ++j) {
+            ops.a[i].data[j] = dist(rng);
+            ops.b[i].data[j] = dist(rng);
+        }
+        for (size_t j = 0; j < 4; ++j) {
+            ops.a[i].data[5 * j] += (T) 4;
+            ops.vec[i][j] = dist(rng);
+        }
+        ops.axis[i] = {(T) 1, dist(rng), dist(rng)};
+        ops.angle[i] = (T) M_PI * dist(rng);
+    }
+    return ops;
+}
+
+///
+/// @brief Operations under test.
+///
+template<typename T>
+static void RunDotMat(Operands<T> &ops)
+{
+    for (size_t i = 0; i < kNumItems; ++i) {
+        ops.mat[i] = Math::Dot(ops.a[i], ops.b[i]);
+    }
+}
+
+template<typename T>
+static void RunDotVec(Operands<T> &ops)
+{
+    for (size_t i = 0; i < kNumItems; ++i) {
+        ops.out[i] = Math::Dot(ops.a[i], ops.vec[i]);
+    }
+}
+
+template<typename T>
+static void RunDeterminant(Operands<T> &ops)
+{
+    for (size_t i = 0; i < kNumItems; ++i) {
+        ops.det[i] = Math::Determinant(ops.a[i]);
+    }
+}
+
+template<typename T>
+static void RunInverse(Operands<T> &ops)
+{
+    for (size_t i = 0; i < kNumItems; ++i) {
+        ops.mat[i] = Math::Inverse(ops.a[i]);
+    }
+}
+
+template<typename T>
+static void RunRotate(Operands<T> &ops)
+{
+    for (size_t i = 0; i < kNumItems; ++i) {
+        ops.mat[i] = Math::Rotate(ops.axis[i], ops.angle[i]);
+    }
+}
+
+///
+/// @brief Operations under test using the dispatched array kernels of the
+/// current instruction set level.
+///
+static const Math::Kernels *gKernels = nullptr;
+
+static void RunKernelsDotMat(Operands<double> &ops)
+{
+    gKernels->dotMat4d(ops.a.data(), ops.b.data(), ops.mat.data(), kNumItems);
+}
+
+static void RunKernelsDeterminant(Operands<double> &ops)
+{
+    gKernels->determinantMat4d(ops.a.data(), ops.det.data(), kNumItems);
+}
+
+static void RunKernelsInverse(Operands<double> &ops)
+{
+    gKernels->inverseMat4d(ops.a.data(), ops.mat.data(), kNumItems);
+}
+
+///
+/// @brief Run an operation over all passes and report the elapsed time and the
+/// operation throughput.
+///
+template<typename T>
+static void Run(const char *name, void (*run)(Operands<T> &))
+{
+    Operands<T> ops = CreateOperands<T>();
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        run(ops);
+    }
+    double msec = timer.elapsed();
+
+    // Consume the results so the loops are not optimized away.
+    DoNotOptimize(ops.mat[0].data[0] + ops.out[0][0] + ops.det[0]);
+
+    double num_ops = (double) (kNumPasses * kNumItems);
+    std::cout << "algebra " << name << " " << msec << " msec, "
+              << 1.0E-3 * num_ops / msec << " Mop/sec\n";
+}
+
+///
+/// @brief Matrix algebra benchmark client.
+///
+void BenchAlgebra()
+{
+    std::cout << "algebra inline isa"
+#if defined(__AVX__)
+              << " avx"
+#endif
+#if defined(MATH_SIMD_FMA)
+              << " fma"
+#endif
+              << "\n";
+
+    Run<float>("Mat4f Dot(Mat4, Mat4)", RunDotMat<float>);
+    Run<float>("Mat4f Dot(Mat4, Vec4)", RunDotVec<float>);
+    Run<float>("Mat4f Determinant", RunDeterminant<float>);
+    Run<float>("Mat4f Inverse", RunInverse<float>);
+    Run<float>("Mat4f Rotate", RunRotate<float>);
+
+    Run<double>("Mat4d Dot(Mat4, Mat4)", RunDotMat<double>);
+    Run<double>("Mat4d Dot(Mat4, Vec4)", RunDotVec<double>);
+    Run<double>("Mat4d Determinant", RunDeterminant<double>);
+    Run<double>("Mat4d Inverse", RunInverse<double>);
+    Run<double>("Mat4d Rotate", RunRotate<double>);
+
+    for (uint32_t isa = Math::kIsaScalar; isa <= Math::GetMaxIsa(); ++isa) {
+        gKernels = &Math::GetKernels(isa);
+        std::string name =
+            std::string("Mat4d kernels ") + Math::GetIsaName(isa);
+        Run<double>((name + " Dot(Mat4, Mat4)").c_str(), RunKernelsDotMat);
+        Run<double>((name + " Determinant").c_str(), RunKernelsDeterminant);
+        Run<double>((name + " Inverse").c_str(), RunKernelsInverse);
+    }
+}
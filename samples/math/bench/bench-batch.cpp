@@ -0,0 +1,260 @@
+//
+// bench-batch.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Batch functions throughput benchmark. Transform and normalize an
+/// array of points much larger than the cache, with a scalar loop of inline
+/// functions and with the batch functions, in the calling thread and over the
+/// thread pool. The packed arrays move 12 or 24 bytes per point instead of 32.
+/// Compute the cell keys of the points with the scalar and the dispatched
+/// cell keys kernel. Invert an array of matrices with the matrix function of
+/// each item and with the batch function, over the array of matrices and over
+/// the same matrices in structure of arrays layout.
+///
+static const size_t kNumPoints = 1 << 22;
+static const size_t kNumPasses = 16;
+static const size_t kNumMatrices = 1 << 18;
+
+template<typename T>
+struct Points {
+    Math::Mat4<T> m;
+    Array<Math::Vec3<T>> src;
+    Array<Math::Vec3<T>> dst;
+    Array<Math::PackedVec3<T>> packed_src;
+    Array<Math::PackedVec3<T>> packed_dst;
+    std::vector<uint32_t> keys;
+};
+
+static const Math::CellGrid kGrid = Math::CellGrid::Create(
+    Math::Vec3<float>{-1.0f, -1.0f, -1.0f},
+    Math::Vec3<float>{1.0f, 1.0f, 1.0f},
+    Math::Vec3<uint32_t>{128, 128, 128});
+
+template<typename T>
+static Points<T> CreatePoints()
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+
+    Points<T> points;
+    points.m = Math::Rotate(
+        Math::Vec3<T>{(T) 1, (T) 2, (T) 3}, (T) 0.5);
+    points.m = Math::Translate(points.m, Math::Vec3<T>{(T) 1, (T) 2, (T) 3});
+    points.src.resize(kNumPoints);
+    points.dst.resize(kNumPoints);
+    for (auto &p : points.src) {
+        p = {dist(rng), dist(rng), dist(rng)};
+    }
+    points.packed_src.resize(kNumPoints);
+    points.packed_dst.resize(kNumPoints);
+    Math::Pack(points.src.data(), points.packed_src.data(), kNumPoints);
+    points.keys.resize(kNumPoints);
+    return points;
+}
+
+///
+/// @brief Operations under test.
+///
+template<typename T>
+static void RunInline(Points<T> &points)
+{
+    for (size_t i = 0; i < kNumPoints; ++i) {
+        const Math::Vec3<T> &p = points.src[i];
+        Math::Vec4<T> r = Math::Dot(points.m, Math::Vec4<T>{p.x, p.y, p.z, 1});
+        points.dst[i] = {r.x, r.y, r.z};
+    }
+}
+
+template<typename T>
+static void RunBatch(Points<T> &points)
+{
+    Math::Batch::Transform(
+        points.m, points.src.data(), points.dst.data(), kNumPoints);
+}
+
+template<typename T>
+static void RunBatchPacked(Points<T> &points)
+{
+    Math::Batch::Transform(points.m, points.packed_src.data(),
+        points.packed_dst.data(), kNumPoints);
+}
+
+template<typename T>
+static void RunInlineNormalize(Points<T> &points)
+{
+    for (size_t i = 0; i < kNumPoints; ++i) {
+        points.dst[i] = Math::Normalize(points.src[i]);
+    }
+}
+
+template<typename T>
+static void RunBatchNormalize(Points<T> &points)
+{
+    Math::Batch::Normalize(points.src.data(), points.dst.data(), kNumPoints);
+}
+
+static void RunInlineCellKeys(Points<float> &points)
+{
+    for (size_t i = 0; i < kNumPoints; ++i) {
+        points.keys[i] = Math::CellKey(kGrid, points.src[i]);
+    }
+}
+
+static void RunBatchCellKeys(Points<float> &points)
+{
+    Math::Batch::CellKeys(
+        kGrid, points.src.data(), points.keys.data(), kNumPoints);
+}
+
+template<typename T, template<typename> class M>
+struct Matrices {
+    Array<M<T>> src;
+    Array<M<T>> dst;
+    std::vector<T> soa_src;
+    std::vector<T> soa_dst;
+    std::vector<uint8_t> singular;
+};
+
+template<typename T, template<typename> class M>
+static Matrices<T, M> CreateMatrices()
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+
+    const size_t length = M<T>::length;
+    Matrices<T, M> matrices;
+    matrices.src.resize(kNumMatrices);
+    matrices.dst.resize(kNumMatrices);
+    matrices.soa_src.resize(length * kNumMatrices);
+    matrices.soa_dst.resize(length * kNumMatrices);
+    matrices.singular.resize(kNumMatrices);
+    for (size_t i = 0; i < kNumMatrices; ++i) {
+        for (size_t k = 0; k < length; ++k) {
+            matrices.src[i].data[k] = dist(rng);
+            matrices.soa_src[k * kNumMatrices + i] = matrices.src[i].data[k];
+        }
+    }
+    return matrices;
+}
+
+template<typename T, template<typename> class M>
+static void RunInlineInverse(Matrices<T, M> &matrices)
+{
+    for (size_t i = 0; i < kNumMatrices; ++i) {
+        matrices.dst[i] = Math::Inverse(matrices.src[i]);
+    }
+}
+
+template<typename T, template<typename> class M>
+static void RunBatchInverse(Matrices<T, M> &matrices)
+{
+    Math::Batch::Inverse(matrices.src.data(), matrices.dst.data(),
+        matrices.singular.data(), kNumMatrices);
+}
+
+template<typename T, template<typename> class M, template<typename> class A>
+static void RunBatchInverseSoa(Matrices<T, M> &matrices)
+{
+    A<T> src = {matrices.soa_src.data(), kNumMatrices};
+    A<T> dst = {matrices.soa_dst.data(), kNumMatrices};
+    Math::Batch::Inverse(src, dst, matrices.singular.data(), kNumMatrices);
+}
+
+///
+/// @brief Run an operation over all passes and report the elapsed time and the
+/// point throughput.
+///
+template<typename T>
+static void Run(const char *name, void (*run)(Points<T> &))
+{
+    Points<T> points = CreatePoints<T>();
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        run(points);
+    }
+    double msec = timer.elapsed();
+
+    double num_points = (double) (kNumPasses * kNumPoints);
+    std::cout << "batch " << name << " " << msec << " msec, "
+              << 1.0E-3 * num_points / msec << " Mpoint/sec\n";
+}
+
+template<typename T, template<typename> class M>
+static void Run(const char *name, void (*run)(Matrices<T, M> &))
+{
+    Matrices<T, M> matrices = CreateMatrices<T, M>();
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        run(matrices);
+    }
+    double msec = timer.elapsed();
+
+    double num_matrices = (double) (kNumPasses * kNumMatrices);
+    std::cout << "batch " << name << " " << msec << " msec, "
+              << 1.0E-3 * num_matrices / msec << " Mmatrix/sec\n";
+}
+
+///
+/// @brief Batch functions benchmark client.
+///
+void BenchBatch()
+{
+    Run<float>("Vec3f Transform inline", RunInline<float>);
+    Run<float>("Vec3f Transform batch", RunBatch<float>);
+    Run<float>("PackedVec3f Transform batch", RunBatchPacked<float>);
+    Run<float>("Vec3f Normalize inline", RunInlineNormalize<float>);
+    Run<float>("Vec3f Normalize batch", RunBatchNormalize<float>);
+    Run<float>("Vec3f CellKeys inline", RunInlineCellKeys);
+    Run<float>("Vec3f CellKeys batch", RunBatchCellKeys);
+    Run<double>("Vec3d Transform inline", RunInline<double>);
+    Run<double>("Vec3d Transform batch", RunBatch<double>);
+    Run<double>("PackedVec3d Transform batch", RunBatchPacked<double>);
+    Run<double>("Vec3d Normalize inline", RunInlineNormalize<double>);
+    Run<double>("Vec3d Normalize batch", RunBatchNormalize<double>);
+
+    using Math::Mat3;
+    using Math::Mat4;
+    using Math::Batch::Mat3Array;
+    using Math::Batch::Mat4Array;
+    Run<float, Mat3>("Mat3f Inverse inline", RunInlineInverse<float, Mat3>);
+    Run<float, Mat3>("Mat3f Inverse batch", RunBatchInverse<float, Mat3>);
+    Run<float, Mat3>("Mat3f Inverse batch soa",
+        RunBatchInverseSoa<float, Mat3, Mat3Array>);
+    Run<double, Mat3>("Mat3d Inverse inline", RunInlineInverse<double, Mat3>);
+    Run<double, Mat3>("Mat3d Inverse batch", RunBatchInverse<double, Mat3>);
+    Run<double, Mat3>("Mat3d Inverse batch soa",
+        RunBatchInverseSoa<double, Mat3, Mat3Array>);
+    Run<float, Mat4>("Mat4f Inverse inline", RunInlineInverse<float, Mat4>);
+    Run<float, Mat4>("Mat4f Inverse batch", RunBatchInverse<float, Mat4>);
+    Run<float, Mat4>("Mat4f Inverse batch soa",
+        RunBatchInverseSoa<float, Mat4, Mat4Array>);
+    Run<double, Mat4>("Mat4d Inverse inline", RunInlineInverse<double, Mat4>);
+    Run<double, Mat4>("Mat4d Inverse batch", RunBatchInverse<double, Mat4>);
+    Run<double, Mat4>("Mat4d Inverse batch soa",
+        RunBatchInverseSoa<double, Mat4, Mat4Array>);
+
+    uint32_t num_threads = std::max(1U, std::thread::hardware_concurrency());
+    Base::ThreadPool::Initialize(num_threads);
+    std::cout << "batch threads " << num_threads << "\n";
+    Run<float>("Vec3f Transform batch parallel", RunBatch<float>);
+    Run<double>("Vec3d Transform batch parallel", RunBatch<double>);
+    Run<float>("Vec3f CellKeys batch parallel", RunBatchCellKeys);
+    Run<double, Mat4>("Mat4d Inverse batch soa parallel",
+        RunBatchInverseSoa<double, Mat4, Mat4Array>);
+    Base::ThreadPool::Terminate();
+}
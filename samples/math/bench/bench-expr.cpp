@@ -0,0 +1,151 @@
+//
+// bench-expr.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <iostream>
+#include <random>
+#include <thread>
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Expression templates benchmark. Integrate the positions and the
+/// velocities of an array of particles much larger than the cache,
+///  x += dt * v + 0.5 * dt * dt * a
+///  v += dt * a
+/// with one loop per operator and a temporary array, as the separate passes
+/// of array functions would, with an inline loop of vector operators, and
+/// with the fused expressions, in the calling thread and over the thread pool.
+/// Report the bytes streamed per particle by each of them and the effective
+/// bandwidth.
+///
+static const size_t kNumParticles = 1 << 22;
+static const size_t kNumPasses = 16;
+
+template<typename T>
+struct Particles {
+    Array<Math::Vec3<T>> x;
+    Array<Math::Vec3<T>> v;
+    Array<Math::Vec3<T>> a;
+    Array<Math::Vec3<T>> tmp;
+};
+
+template<typename T>
+static Particles<T> CreateParticles()
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+
+    Particles<T> particles;
+    particles.x.resize(kNumParticles);
+    particles.v.resize(kNumParticles);
+    particles.a.resize(kNumParticles);
+    particles.tmp.resize(kNumParticles);
+    for (size_t i = 0; i < kNumParticles; ++i) {
+        particles.x[i] = {dist(rng), dist(rng), dist(rng)};
+        particles.v[i] = {dist(rng), dist(rng), dist(rng)};
+        particles.a[i] = {dist(rng), dist(rng), dist(rng)};
+    }
+    return particles;
+}
+
+///
+/// @brief Operations under test.
+///
+static const double kTimeStep = 0.01;
+
+template<typename T>
+static void RunLoops(Particles<T> &p)
+{
+    const T dt = (T) kTimeStep;
+    const T dt2 = (T) 0.5 * dt * dt;
+    for (size_t i = 0; i < kNumParticles; ++i) {
+        p.tmp[i] = dt * p.v[i];
+    }
+    for (size_t i = 0; i < kNumParticles; ++i) {
+        p.tmp[i] += dt2 * p.a[i];
+    }
+    for (size_t i = 0; i < kNumParticles; ++i) {
+        p.x[i] += p.tmp[i];
+    }
+    for (size_t i = 0; i < kNumParticles; ++i) {
+        p.v[i] += dt * p.a[i];
+    }
+}
+
+template<typename T>
+static void RunInline(Particles<T> &p)
+{
+    const T dt = (T) kTimeStep;
+    const T dt2 = (T) 0.5 * dt * dt;
+    for (size_t i = 0; i < kNumParticles; ++i) {
+        p.x[i] += dt * p.v[i] + dt2 * p.a[i];
+        p.v[i] += dt * p.a[i];
+    }
+}
+
+template<typename T>
+static void RunExpr(Particles<T> &p)
+{
+    const T dt = (T) kTimeStep;
+    auto x = Math::Expr::MakeSpan(p.x);
+    auto v = Math::Expr::MakeSpan(p.v);
+    auto a = Math::Expr::MakeSpan(p.a);
+    x += dt * v + ((T) 0.5 * dt * dt) * a;
+    v += dt * a;
+}
+
+///
+/// @brief Run an operation over all passes and report the elapsed time, the
+/// particle throughput and the bandwidth of the bytes streamed per particle.
+/// Each array read and each array written is one stream.
+///
+template<typename T>
+static void Run(
+    const char *name,
+    void (*run)(Particles<T> &),
+    const size_t num_streams)
+{
+    Particles<T> particles = CreateParticles<T>();
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        run(particles);
+    }
+    double msec = timer.elapsed();
+
+    double num_items = (double) (kNumPasses * kNumParticles);
+    double bytes = (double) (num_streams * sizeof(Math::Vec3<T>));
+    std::cout << "expr " << name << " " << msec << " msec, "
+              << 1.0E-3 * num_items / msec << " Mparticle/sec, "
+              << bytes << " bytes/particle, "
+              << 1.0E-6 * bytes * num_items / msec << " GB/sec\n";
+}
+
+///
+/// @brief Expression templates benchmark client. The separate loops stream
+/// 11 arrays per particle, the fused expressions 7, x and v read and written
+/// and a read twice. The inline loop streams 5, but evaluates each vector
+/// with scalar instructions.
+///
+void BenchExpr()
+{
+    Run<float>("Vec3f loops", RunLoops<float>, 11);
+    Run<float>("Vec3f inline", RunInline<float>, 5);
+    Run<float>("Vec3f expr", RunExpr<float>, 7);
+    Run<double>("Vec3d loops", RunLoops<double>, 11);
+    Run<double>("Vec3d inline", RunInline<double>, 5);
+    Run<double>("Vec3d expr", RunExpr<double>, 7);
+
+    uint32_t num_threads = std::max(1U, std::thread::hardware_concurrency());
+    Base::ThreadPool::Initialize(num_threads);
+    std::cout << "expr threads " << num_threads << "\n";
+    Run<float>("Vec3f expr parallel", RunExpr<float>, 7);
+    Run<double>("Vec3d expr parallel", RunExpr<double>, 7);
+    Base::ThreadPool::Terminate();
+}
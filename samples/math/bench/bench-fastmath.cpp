@@ -0,0 +1,158 @@
+//
+// bench-fastmath.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Fast math benchmark. Evaluate the elementary functions of an array
+/// with a loop of the std functions, and with the batch functions of the
+/// precise and the fast accuracy tiers, in the calling thread. The array fits
+/// in the cache, so that the evaluation is bound by the arithmetic.
+///
+static const size_t kNumItems = 1 << 16;
+static const size_t kNumPasses = 256;
+
+template<typename T>
+struct Arrays {
+    Array<T> src;
+    Array<T> arg;
+    Array<T> dst;
+    Array<T> aux;
+};
+
+template<typename T>
+static Arrays<T> CreateArrays()
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<T> dist(0.01, 10.0);
+
+    Arrays<T> arrays;
+    arrays.src.resize(kNumItems);
+    arrays.arg.resize(kNumItems);
+    arrays.dst.resize(kNumItems);
+    arrays.aux.resize(kNumItems);
+    for (size_t i = 0; i < kNumItems; ++i) {
+        arrays.src[i] = dist(rng);
+        arrays.arg[i] = dist(rng) - (T) 5;
+    }
+    return arrays;
+}
+
+///
+/// @brief Operations under test.
+///
+template<typename T>
+static void RunStd(Arrays<T> &a, const char *function)
+{
+    const std::string name(function);
+    if (name == "Rsqrt") {
+        for (size_t i = 0; i < kNumItems; ++i) {
+            a.dst[i] = (T) 1 / std::sqrt(a.src[i]);
+        }
+    } else if (name == "Exp") {
+        for (size_t i = 0; i < kNumItems; ++i) {
+            a.dst[i] = std::exp(a.src[i]);
+        }
+    } else if (name == "Log") {
+        for (size_t i = 0; i < kNumItems; ++i) {
+            a.dst[i] = std::log(a.src[i]);
+        }
+    } else if (name == "SinCos") {
+        for (size_t i = 0; i < kNumItems; ++i) {
+            a.dst[i] = std::sin(a.src[i]);
+            a.aux[i] = std::cos(a.src[i]);
+        }
+    } else if (name == "Atan2") {
+        for (size_t i = 0; i < kNumItems; ++i) {
+            a.dst[i] = std::atan2(a.arg[i], a.src[i]);
+        }
+    }
+}
+
+template<typename T>
+static void RunBatch(
+    Arrays<T> &a,
+    const char *function,
+    const Math::Accuracy accuracy)
+{
+    const std::string name(function);
+    if (name == "Rsqrt") {
+        Math::Batch::Rsqrt(a.src.data(), a.dst.data(), kNumItems, accuracy);
+    } else if (name == "Exp") {
+        Math::Batch::Exp(a.src.data(), a.dst.data(), kNumItems, accuracy);
+    } else if (name == "Log") {
+        Math::Batch::Log(a.src.data(), a.dst.data(), kNumItems, accuracy);
+    } else if (name == "SinCos") {
+        Math::Batch::SinCos(
+            a.src.data(), a.dst.data(), a.aux.data(), kNumItems, accuracy);
+    } else if (name == "Atan2") {
+        Math::Batch::Atan2(
+            a.arg.data(), a.src.data(), a.dst.data(), kNumItems, accuracy);
+    }
+}
+
+///
+/// @brief Run a function over all passes with the std loop and both batch
+/// tiers, and report the elapsed time and the throughput of each of them.
+///
+template<typename T>
+static void Run(const char *type, const char *function)
+{
+    Arrays<T> arrays = CreateArrays<T>();
+    double num_items = (double) (kNumPasses * kNumItems);
+
+    auto report = [&](const char *variant, double msec) {
+        std::cout << "fastmath " << type << " " << function << " "
+                  << variant << " " << msec << " msec, "
+                  << 1.0E-3 * num_items / msec << " Mitem/sec\n";
+    };
+
+    {
+        Timer timer;
+        for (size_t pass = 0; pass < kNumPasses; ++pass) {
+            RunStd(arrays, function);
+        }
+        report("std", timer.elapsed());
+    }
+
+    {
+        Timer timer;
+        for (size_t pass = 0; pass < kNumPasses; ++pass) {
+            RunBatch(arrays, function, Math::kAccuracyPrecise);
+        }
+        report("precise", timer.elapsed());
+    }
+
+    {
+        Timer timer;
+        for (size_t pass = 0; pass < kNumPasses; ++pass) {
+            RunBatch(arrays, function, Math::kAccuracyFast);
+        }
+        report("fast", timer.elapsed());
+    }
+}
+
+///
+/// @brief Fast math benchmark client.
+///
+void BenchFastmath()
+{
+    const char *functions[] = {"Rsqrt", "Exp", "Log", "SinCos", "Atan2"};
+    for (auto function : functions) {
+        Run<float>("float", function);
+    }
+    for (auto function : functions) {
+        Run<double>("double", function);
+    }
+}
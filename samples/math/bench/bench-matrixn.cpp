@@ -0,0 +1,188 @@
+//
+// bench-matrixn.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Dense matrix throughput benchmark. Multiply square matrices with a
+/// naive loop over the rows of c and with the blocked product, multiply a
+/// matrix by a vector, and factor a matrix with the LU and the Cholesky
+/// factorizations, in the calling thread and over the thread pool. Report the
+/// floating point operations of each function per second.
+///
+static const size_t kMatrixSize = 1024;
+static const size_t kNumPasses = 4;
+static const size_t kNumGemvPasses = 64;
+
+template<typename T>
+struct Matrices {
+    Math::MatrixN<T> a;
+    Math::MatrixN<T> b;
+    Math::MatrixN<T> c;
+    Math::MatrixN<T> spd;
+    Math::MatrixN<T> work;
+    std::vector<T> x;
+    std::vector<T> y;
+    std::vector<size_t> pivots;
+};
+
+template<typename T>
+static Matrices<T> CreateMatrices()
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+
+    const size_t n = kMatrixSize;
+    Matrices<T> matrices;
+    matrices.a = Math::MatrixN<T>::Create(n, n);
+    matrices.b = Math::MatrixN<T>::Create(n, n);
+    matrices.c = Math::MatrixN<T>::Create(n, n);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            matrices.a(i, j) = dist(rng);
+            matrices.b(i, j) = dist(rng);
+        }
+        matrices.a(i, i) += (T) 4;
+    }
+
+    // Symmetric positive definite matrix, b * b^t + n * i.
+    Math::MatrixN<T> bt = Math::MatrixN<T>::Create(n, n);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            bt(i, j) = matrices.b(j, i);
+        }
+    }
+    matrices.spd = Math::Dot(matrices.b, bt);
+    for (size_t i = 0; i < n; ++i) {
+        matrices.spd(i, i) += (T) n;
+    }
+
+    matrices.x.resize(n);
+    matrices.y.resize(n);
+    for (auto &it : matrices.x) {
+        it = dist(rng);
+    }
+    return matrices;
+}
+
+///
+/// @brief Operations under test.
+///
+template<typename T>
+static void RunInlineGemm(Matrices<T> &matrices)
+{
+    const size_t n = kMatrixSize;
+    for (size_t i = 0; i < n; ++i) {
+        T *c = matrices.c.Row(i);
+        std::fill(c, c + n, (T) 0);
+        for (size_t k = 0; k < n; ++k) {
+            const T a = matrices.a(i, k);
+            const T *b = matrices.b.Row(k);
+            for (size_t j = 0; j < n; ++j) {
+                c[j] += a * b[j];
+            }
+        }
+    }
+}
+
+template<typename T>
+static void RunGemm(Matrices<T> &matrices)
+{
+    Math::Gemm((T) 1, matrices.a, matrices.b, (T) 0, matrices.c);
+}
+
+template<typename T>
+static void RunGemv(Matrices<T> &matrices)
+{
+    for (size_t pass = 0; pass < kNumGemvPasses; ++pass) {
+        Math::Gemv((T) 1, matrices.a, matrices.x.data(), (T) 0,
+            matrices.y.data());
+    }
+}
+
+template<typename T>
+static void RunLuFactor(Matrices<T> &matrices)
+{
+    matrices.work = matrices.a;
+    Math::LuFactor(matrices.work, matrices.pivots);
+}
+
+template<typename T>
+static void RunCholeskyFactor(Matrices<T> &matrices)
+{
+    matrices.work = matrices.spd;
+    Math::CholeskyFactor(matrices.work);
+}
+
+///
+/// @brief Run an operation over all passes and report the elapsed time and the
+/// floating point throughput, given the number of operations of each pass.
+///
+template<typename T>
+static void Run(
+    const char *name,
+    void (*run)(Matrices<T> &),
+    const double flops)
+{
+    Matrices<T> matrices = CreateMatrices<T>();
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        run(matrices);
+    }
+    double msec = timer.elapsed();
+
+    std::cout << "matrixn " << name << " " << msec << " msec, "
+              << 1.0E-6 * flops * kNumPasses / msec << " GFLOP/s\n";
+}
+
+///
+/// @brief Dense matrix benchmark client.
+///
+void BenchMatrixN()
+{
+    const double n = (double) kMatrixSize;
+    const double gemm = 2.0 * n * n * n;
+    const double gemv = 2.0 * n * n * kNumGemvPasses;
+    const double lu = 2.0 * n * n * n / 3.0;
+    const double cholesky = n * n * n / 3.0;
+
+    std::cout << "matrixn size " << kMatrixSize << ", isa "
+              << Math::GetIsaName(Math::GetMaxIsa()) << "\n";
+    Run<float>("Gemmf inline", RunInlineGemm<float>, gemm);
+    Run<float>("Gemmf", RunGemm<float>, gemm);
+    Run<float>("Gemvf", RunGemv<float>, gemv);
+    Run<float>("LuFactorf", RunLuFactor<float>, lu);
+    Run<float>("CholeskyFactorf", RunCholeskyFactor<float>, cholesky);
+    Run<double>("Gemmd inline", RunInlineGemm<double>, gemm);
+    Run<double>("Gemmd", RunGemm<double>, gemm);
+    Run<double>("Gemvd", RunGemv<double>, gemv);
+    Run<double>("LuFactord", RunLuFactor<double>, lu);
+    Run<double>("CholeskyFactord", RunCholeskyFactor<double>, cholesky);
+
+    uint32_t num_threads = std::max(1U, std::thread::hardware_concurrency());
+    Base::ThreadPool::Initialize(num_threads);
+    std::cout << "matrixn threads " << num_threads << "\n";
+    Run<float>("Gemmf parallel", RunGemm<float>, gemm);
+    Run<float>("Gemvf parallel", RunGemv<float>, gemv);
+    Run<float>("LuFactorf parallel", RunLuFactor<float>, lu);
+    Run<float>("CholeskyFactorf parallel", RunCholeskyFactor<float>, cholesky);
+    Run<double>("Gemmd parallel", RunGemm<double>, gemm);
+    Run<double>("Gemvd parallel", RunGemv<double>, gemv);
+    Run<double>("LuFactord parallel", RunLuFactor<double>, lu);
+    Run<double>("CholeskyFactord parallel", RunCholeskyFactor<double>,
+        cholesky);
+    Base::ThreadPool::Terminate();
+}
@@ -0,0 +1,184 @@
+//
+// bench-quat.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Quaternion benchmark. Compose an array of orientations with an
+/// incremental rotation, as quaternion products and as Rotate/Dot matrix
+/// products, interpolate the orientations towards a target, and rotate an
+/// array of vectors with the quaternion and with the rotation matrix, inline
+/// and with the batch functions.
+///
+static const size_t kNumOrientations = 1 << 16;
+static const size_t kNumVectors = 1 << 20;
+static const size_t kNumPasses = 16;
+
+template<typename T>
+struct Orientations {
+    Math::Quat<T> dq;
+    Math::Mat4<T> dm;
+    Array<Math::Quat<T>> quats;
+    Array<Math::Quat<T>> targets;
+    Array<Math::Mat4<T>> mats;
+    Array<Math::Vec3<T>> src;
+    Array<Math::Vec3<T>> dst;
+};
+
+template<typename T>
+static Orientations<T> CreateOrientations()
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+
+    Orientations<T> o;
+    Math::Vec3<T> axis{(T) 1, (T) 2, (T) 3};
+    o.dq = Math::Quat<T>::CreateFromAxisAngle(axis, (T) 0.01);
+    o.dm = Math::Rotate(axis, (T) 0.01);
+
+    o.quats.resize(kNumOrientations);
+    o.targets.resize(kNumOrientations);
+    o.mats.resize(kNumOrientations);
+    for (size_t i = 0; i < kNumOrientations; ++i) {
+        Math::Vec3<T> n{dist(rng), dist(rng), dist(rng)};
+        T theta = (T) M_PI * dist(rng);
+        o.quats[i] = Math::Quat<T>::CreateFromAxisAngle(n, theta);
+        o.mats[i] = Math::Rotate(n, theta);
+        o.targets[i] = Math::Quat<T>::CreateFromAxisAngle(
+            Math::Vec3<T>{dist(rng), dist(rng), dist(rng)},
+            (T) M_PI * dist(rng));
+    }
+
+    o.src.resize(kNumVectors);
+    o.dst.resize(kNumVectors);
+    for (auto &v : o.src) {
+        v = {dist(rng), dist(rng), dist(rng)};
+    }
+    return o;
+}
+
+///
+/// @brief Operations under test over the orientations.
+///
+template<typename T>
+static void RunComposeQuat(Orientations<T> &o)
+{
+    for (auto &q : o.quats) {
+        q = o.dq * q;
+    }
+}
+
+template<typename T>
+static void RunComposeMat(Orientations<T> &o)
+{
+    for (auto &m : o.mats) {
+        m = Math::Dot(o.dm, m);
+    }
+}
+
+template<typename T>
+static void RunSlerp(Orientations<T> &o)
+{
+    for (size_t i = 0; i < kNumOrientations; ++i) {
+        o.quats[i] = Math::Slerp(o.quats[i], o.targets[i], (T) 0.25);
+    }
+}
+
+template<typename T>
+static void RunNlerp(Orientations<T> &o)
+{
+    for (size_t i = 0; i < kNumOrientations; ++i) {
+        o.quats[i] = Math::Nlerp(o.quats[i], o.targets[i], (T) 0.25);
+    }
+}
+
+///
+/// @brief Operations under test over the vectors.
+///
+template<typename T>
+static void RunRotateQuat(Orientations<T> &o)
+{
+    for (size_t i = 0; i < kNumVectors; ++i) {
+        o.dst[i] = Math::Rotate(o.dq, o.src[i]);
+    }
+}
+
+template<typename T>
+static void RunRotateMat(Orientations<T> &o)
+{
+    for (size_t i = 0; i < kNumVectors; ++i) {
+        const Math::Vec3<T> &v = o.src[i];
+        Math::Vec4<T> r = Math::Dot(o.dm, Math::Vec4<T>{v.x, v.y, v.z, 0});
+        o.dst[i] = {r.x, r.y, r.z};
+    }
+}
+
+template<typename T>
+static void RunBatchRotate(Orientations<T> &o)
+{
+    Math::Batch::Rotate(o.dq, o.src.data(), o.dst.data(), kNumVectors);
+}
+
+template<typename T>
+static void RunBatchTransform(Orientations<T> &o)
+{
+    Math::Batch::Transform(o.dm, o.src.data(), o.dst.data(), kNumVectors);
+}
+
+///
+/// @brief Run an operation over all passes and report the elapsed time and the
+/// item throughput.
+///
+template<typename T>
+static void Run(
+    const char *name,
+    void (*run)(Orientations<T> &),
+    const size_t num_items)
+{
+    Orientations<T> o = CreateOrientations<T>();
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        run(o);
+    }
+    double msec = timer.elapsed();
+
+    double num_ops = (double) (kNumPasses * num_items);
+    std::cout << "quat " << name << " " << msec << " msec, "
+              << 1.0E-3 * num_ops / msec << " Mop/sec\n";
+}
+
+///
+/// @brief Quaternion benchmark client.
+///
+void BenchQuat()
+{
+    const size_t n = kNumOrientations;
+    const size_t m = kNumVectors;
+    Run<float>("Quatf compose", RunComposeQuat<float>, n);
+    Run<float>("Mat4f compose Dot", RunComposeMat<float>, n);
+    Run<float>("Quatf Slerp", RunSlerp<float>, n);
+    Run<float>("Quatf Nlerp", RunNlerp<float>, n);
+    Run<float>("Vec3f Rotate Quatf inline", RunRotateQuat<float>, m);
+    Run<float>("Vec3f Rotate Mat4f inline", RunRotateMat<float>, m);
+    Run<float>("Vec3f Rotate Quatf batch", RunBatchRotate<float>, m);
+    Run<float>("Vec3f Rotate Mat4f batch", RunBatchTransform<float>, m);
+    Run<double>("Quatd compose", RunComposeQuat<double>, n);
+    Run<double>("Mat4d compose Dot", RunComposeMat<double>, n);
+    Run<double>("Quatd Slerp", RunSlerp<double>, n);
+    Run<double>("Quatd Nlerp", RunNlerp<double>, n);
+    Run<double>("Vec3d Rotate Quatd inline", RunRotateQuat<double>, m);
+    Run<double>("Vec3d Rotate Mat4d inline", RunRotateMat<double>, m);
+    Run<double>("Vec3d Rotate Quatd batch", RunBatchRotate<double>, m);
+    Run<double>("Vec3d Rotate Mat4d batch", RunBatchTransform<double>, m);
+}
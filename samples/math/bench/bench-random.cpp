@@ -0,0 +1,267 @@
+//
+// bench-random.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Random number benchmark. Create random engines and primes in bulk,
+/// and fill an array with 32-bit and 64-bit random numbers with a loop of the
+/// scalar engine, and with the random engine lanes and the counter-based
+/// random streams of each instruction set level supported by the cpu, and
+/// with the bulk distribution samplers, and test them with the random test
+/// battery. Report the throughput in bytes of random numbers per second.
+///
+static const size_t kNumItems = 1 << 20;
+static const size_t kNumPasses = 64;
+
+///
+/// @brief Report the elapsed time and the throughput of a benchmark.
+///
+template<typename T>
+static void Report(const std::string &name, const double msec)
+{
+    double num_items = (double) (kNumPasses * kNumItems);
+    std::cout << "random " << name << " " << msec << " msec, "
+              << 1.0E-3 * num_items / msec << " Mnumber/sec, "
+              << 1.0E-6 * num_items * sizeof(T) / msec << " GB/sec\n";
+}
+
+///
+/// @brief Fill the array with the scalar engine.
+///
+template<typename T, T (*Random)(Math::RandomEngine &)>
+static void RunScalar(const std::string &name)
+{
+    Array<T> dst(kNumItems);
+    Math::RandomEngine eng = Math::CreateRandomEngine();
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        for (size_t i = 0; i < kNumItems; ++i) {
+            dst[i] = Random(eng);
+        }
+    }
+    Report<T>(name, timer.elapsed());
+}
+
+///
+/// @brief Fill the array with the random engine lanes kernel.
+///
+template<typename T>
+static void RunLanes(
+    const std::string &name,
+    void (*fill)(Math::RandomLanes &, T *, const size_t))
+{
+    Array<T> dst(kNumItems);
+    Math::RandomLanes lanes = Math::CreateRandomLanes();
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        fill(lanes, dst.data(), kNumItems);
+    }
+    Report<T>(name, timer.elapsed());
+}
+
+///
+/// @brief Fill the array with uniform floating point numbers.
+///
+template<typename T>
+static void RunUniform(const std::string &name)
+{
+    Array<T> dst(kNumItems);
+    Math::RandomLanes lanes = Math::CreateRandomLanes();
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        Math::RandomFill(lanes, dst.data(), kNumItems);
+    }
+    Report<T>(name, timer.elapsed());
+}
+
+///
+/// @brief Fill the array with the blocks of a counter-based random stream.
+///
+static void RunStream(
+    const std::string &name,
+    const uint32_t generator,
+    const Math::Kernels &kernels)
+{
+    Array<uint32_t> dst(kNumItems);
+    Math::RandomStream stream = Math::CreateRandomStream(1, 0, generator);
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        uint64_t block = pass * kNumItems / 4;
+        kernels.randomStream(stream, block, dst.data(), kNumItems / 4);
+    }
+    Report<uint32_t>(name, timer.elapsed());
+}
+
+///
+/// @brief Fill the array with normal deviates, with a loop of the polar
+/// Box-Muller sampler and with the Ziggurat bulk sampler.
+///
+template<typename T>
+static void RunGauss(const std::string &name)
+{
+    Array<T> dst(kNumItems);
+    Math::RandomEngine eng = Math::CreateRandomEngine();
+    Math::RandomGauss<T> gauss;
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        for (size_t i = 0; i < kNumItems; ++i) {
+            dst[i] = gauss(eng);
+        }
+    }
+    Report<T>(name, timer.elapsed());
+}
+
+template<typename T>
+static void RunNormal(const std::string &name)
+{
+    Array<T> dst(kNumItems);
+    Math::RandomStream stream = Math::CreateRandomStream(1, 0);
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        Math::RandomNormal(stream, pass * kNumItems, dst.data(), kNumItems);
+    }
+    Report<T>(name, timer.elapsed());
+}
+
+///
+/// @brief Fill the array with the other bulk samplers.
+///
+template<typename T, typename Fill>
+static void RunSampler(const std::string &name, const Fill &fill)
+{
+    Array<T> dst(kNumItems);
+    Math::RandomStream stream = Math::CreateRandomStream(1, 0);
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        fill(stream, pass * kNumItems, dst.data(), kNumItems);
+    }
+    Report<T>(name, timer.elapsed());
+}
+
+///
+/// @brief Create the engines of many tasks, one at a time, each drawing its
+/// seed from the random device, and at once from a single seed.
+///
+static void RunCreate()
+{
+    const size_t num_engines = 4096;
+    std::vector<Math::RandomEngine> engines(num_engines);
+
+    auto report = [&] (const std::string &name, const double msec) {
+        std::cout << "random " << name << " " << msec << " msec, "
+                  << 1.0E-3 * num_engines / msec << " Mengine/sec\n";
+    };
+
+    Timer timer;
+    for (auto &eng : engines) {
+        eng = Math::CreateRandomEngine();
+    }
+    report("CreateRandomEngine loop", timer.elapsed());
+
+    timer.reset();
+    engines = Math::CreateRandomEngines(num_engines);
+    report("CreateRandomEngines", timer.elapsed());
+}
+
+///
+/// @brief Find random 64-bit primes one at a time, and in bulk from a stream.
+///
+static void RunPrime()
+{
+    const size_t num_primes = 4096;
+    std::vector<uint64_t> primes(num_primes);
+
+    auto report = [&] (const std::string &name, const double msec) {
+        std::cout << "random " << name << " " << msec << " msec, "
+                  << num_primes / msec << " kprime/sec\n";
+    };
+
+    Math::RandomDevice device;
+    Timer timer;
+    for (auto &p : primes) {
+        p = Math::RandomPrime(device);
+    }
+    report("RandomPrime scalar", timer.elapsed());
+
+    timer.reset();
+    Math::RandomPrime(Math::CreateRandomStream(1, 0), 0, primes.data(),
+        num_primes);
+    report("RandomPrime stream", timer.elapsed());
+}
+
+///
+/// @brief Run the random test battery on an array of random numbers.
+///
+static void RunRandomTest()
+{
+    Array<uint32_t> data(kNumItems);
+    Math::RandomFill(Math::CreateRandomStream(1, 0), 0, data.data(),
+        kNumItems);
+
+    Timer timer;
+    for (size_t pass = 0; pass < kNumPasses; ++pass) {
+        Math::RandomTestRun(data.data(), kNumItems);
+    }
+    Report<uint32_t>("RandomTest", timer.elapsed());
+}
+
+///
+/// @brief Random number benchmark client.
+///
+void BenchRandom()
+{
+    RunCreate();
+    RunPrime();
+    RunScalar<uint32_t, Math::Random32>("Random32 scalar");
+    RunScalar<uint64_t, Math::Random64>("Random64 scalar");
+
+    for (uint32_t isa = Math::kIsaScalar; isa <= Math::GetMaxIsa(); ++isa) {
+        const Math::Kernels &kernels = Math::GetKernels(isa);
+        std::string name(Math::GetIsaName(isa));
+        RunLanes<uint32_t>("RandomFill32 " + name, kernels.randomFill32);
+        RunLanes<uint64_t>("RandomFill64 " + name, kernels.randomFill64);
+        RunStream("Philox " + name, Math::kRandomPhilox, kernels);
+        RunStream("Threefry " + name, Math::kRandomThreefry, kernels);
+    }
+
+    RunUniform<float>("RandomFill float");
+    RunUniform<double>("RandomFill double");
+
+    RunGauss<float>("RandomGauss float");
+    RunGauss<double>("RandomGauss double");
+    RunNormal<float>("RandomNormal float");
+    RunNormal<double>("RandomNormal double");
+    RunSampler<float>("RandomExponential float", [] (
+        const Math::RandomStream &s, uint64_t first, float *dst, size_t n) {
+        Math::RandomExponential(s, first, dst, n);
+    });
+    RunSampler<uint32_t>("RandomBounded uint32", [] (
+        const Math::RandomStream &s, uint64_t first, uint32_t *dst, size_t n) {
+        Math::RandomBounded(s, first, dst, n, 1000000007U);
+    });
+    RunSampler<Math::Vec3<float>>("RandomSphere float", [] (
+        const Math::RandomStream &s, uint64_t first,
+        Math::Vec3<float> *dst, size_t n) {
+        Math::RandomSphere(s, first, dst, n);
+    });
+
+    RunRandomTest();
+}
@@ -0,0 +1,223 @@
+//
+// bench-transform.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Camera and instance transform benchmark. Each frame computes the
+/// view-projection matrix, the model-view-projection matrix of each instance
+/// and transforms the instance mesh vertices into clip space.
+///
+static const size_t kNumInstances = 4096;
+static const size_t kNumVertices = 256;
+static const size_t kNumFrames = 16;
+
+template<typename T>
+struct Scene {
+    Array<Math::Mat4<T>> models;
+    Array<Math::Mat4<T>> mvp;
+    Array<Math::Vec4<T>> vertices;
+    Array<Math::Vec4<T>> clip;
+};
+
+///
+/// @brief Create the instance model matrices and the mesh vertices.
+///
+template<typename T>
+static Scene<T> CreateScene()
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+
+    Scene<T> scene;
+    scene.models.resize(kNumInstances);
+    for (auto &model : scene.models) {
+        Math::Vec3<T> axis = {dist(rng), dist(rng), (T) 1};
+        Math::Vec3<T> dir = {dist(rng), dist(rng), dist(rng)};
+        model = Math::Scale(Math::Vec3<T>{(T) 0.5, (T) 0.5, (T) 0.5});
+        model = Math::Rotate(model, axis, (T) M_PI * dist(rng));
+        model = Math::Translate(model, (T) 100 * dir);
+    }
+    scene.mvp.resize(kNumInstances);
+
+    scene.vertices.resize(kNumVertices);
+    for (auto &vertex : scene.vertices) {
+        vertex = {dist(rng), dist(rng), dist(rng), (T) 1};
+    }
+
+    scene.clip.resize(kNumInstances * kNumVertices);
+    return scene;
+}
+
+///
+/// @brief Compute the camera view-projection matrix of a given frame.
+///
+template<typename T>
+static Math::Mat4<T> Camera(const size_t frame)
+{
+    T angle = (T) frame / (T) kNumFrames;
+    Math::Vec3<T> eye = {
+        (T) 200 * std::cos(angle), (T) 50, (T) 200 * std::sin(angle)};
+    Math::Vec3<T> ctr = {(T) 0, (T) 0, (T) 0};
+    Math::Vec3<T> up = {(T) 0, (T) 1, (T) 0};
+    Math::Mat4<T> view = Math::LookAt(eye, ctr, up);
+    return Math::Perspective(view, (T) 0.5 * (T) M_PI, (T) 1.5, (T) 1, (T) 1000);
+}
+
+///
+/// @brief Transform the scene using plain scalar loops.
+///
+template<typename T>
+static void RunScalar(Scene<T> &scene, const Math::Mat4<T> &viewproj)
+{
+    for (size_t k = 0; k < kNumInstances; ++k) {
+        const T *a = viewproj.data;
+        const T *b = scene.models[k].data;
+        T mvp[16];
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                T sum = (T) 0;
+                for (size_t l = 0; l < 4; ++l) {
+                    sum += a[4*i + l] * b[4*l + j];
+                }
+                mvp[4*i + j] = sum;
+            }
+        }
+
+        Math::Vec4<T> *clip = &scene.clip[k * kNumVertices];
+        for (size_t v = 0; v < kNumVertices; ++v) {
+            const T *x = scene.vertices[v].data;
+            for (size_t i = 0; i < 4; ++i) {
+                T sum = (T) 0;
+                for (size_t l = 0; l < 4; ++l) {
+                    sum += mvp[4*i + l] * x[l];
+                }
+                clip[v][i] = sum;
+            }
+        }
+    }
+}
+
+///
+/// @brief Transform the scene using the inline vector and matrix functions.
+///
+template<typename T>
+static void RunMath(Scene<T> &scene, const Math::Mat4<T> &viewproj)
+{
+    for (size_t k = 0; k < kNumInstances; ++k) {
+        Math::Mat4<T> mvp = Math::Dot(viewproj, scene.models[k]);
+        Math::Vec4<T> *clip = &scene.clip[k * kNumVertices];
+        for (size_t v = 0; v < kNumVertices; ++v) {
+            clip[v] = Math::Dot(mvp, scene.vertices[v]);
+        }
+    }
+}
+
+///
+/// @brief Transform the scene using the dispatched array kernels of the current
+/// instruction set level. Transform all the instance matrices at once and then
+/// the mesh vertices of each instance.
+///
+static const Math::Kernels *gKernels = nullptr;
+
+static void RunKernels(Scene<float> &scene, const Math::Mat4<float> &viewproj)
+{
+    gKernels->transformMat4f(
+        viewproj, scene.models.data(), scene.mvp.data(), kNumInstances);
+    for (size_t k = 0; k < kNumInstances; ++k) {
+        gKernels->transformVec4f(scene.mvp[k], scene.vertices.data(),
+            &scene.clip[k * kNumVertices], kNumVertices);
+    }
+}
+
+static void RunKernels(Scene<double> &scene, const Math::Mat4<double> &viewproj)
+{
+    gKernels->transformMat4d(
+        viewproj, scene.models.data(), scene.mvp.data(), kNumInstances);
+    for (size_t k = 0; k < kNumInstances; ++k) {
+        gKernels->transformVec4d(scene.mvp[k], scene.vertices.data(),
+            &scene.clip[k * kNumVertices], kNumVertices);
+    }
+}
+
+///
+/// @brief Run the benchmark over all frames and report the elapsed time and the
+/// vertex throughput. Return the clip space vertices of the last frame.
+///
+template<typename T>
+static Array<Math::Vec4<T>> Run(
+    const char *name,
+    void (*run)(Scene<T> &, const Math::Mat4<T> &))
+{
+    Scene<T> scene = CreateScene<T>();
+
+    Timer timer;
+    for (size_t frame = 0; frame < kNumFrames; ++frame) {
+        run(scene, Camera<T>(frame));
+    }
+    double msec = timer.elapsed();
+
+    double num_vertices = (double) (kNumFrames * kNumInstances * kNumVertices);
+    std::cout << "transform " << name << " " << msec << " msec, "
+              << 1.0E-3 * num_vertices / msec << " Mvertex/sec\n";
+    return scene.clip;
+}
+
+///
+/// @brief Return the max relative difference between two sets of vertices.
+///
+template<typename T>
+static double MaxError(
+    const Array<Math::Vec4<T>> &a,
+    const Array<Math::Vec4<T>> &b)
+{
+    double maxerr = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            double scale = std::max(1.0, (double) std::fabs(b[i][j]));
+            maxerr = std::max(maxerr, std::fabs(a[i][j] - b[i][j]) / scale);
+        }
+    }
+    return maxerr;
+}
+
+///
+/// @brief Camera and instance transform benchmark client.
+///
+void BenchTransform()
+{
+    auto scalar_f = Run<float>("Mat4f scalar", RunScalar<float>);
+    auto inline_f = Run<float>("Mat4f inline", RunMath<float>);
+    std::cout << "transform Mat4f max error " << MaxError(inline_f, scalar_f)
+              << "\n";
+
+    auto scalar_d = Run<double>("Mat4d scalar", RunScalar<double>);
+    auto inline_d = Run<double>("Mat4d inline", RunMath<double>);
+    std::cout << "transform Mat4d max error " << MaxError(inline_d, scalar_d)
+              << "\n";
+
+    for (uint32_t isa = Math::kIsaScalar; isa <= Math::GetMaxIsa(); ++isa) {
+        gKernels = &Math::GetKernels(isa);
+        std::string name = std::string("kernels ") + Math::GetIsaName(isa);
+
+        auto kernel_f = Run<float>(("Mat4f " + name).c_str(), RunKernels);
+        std::cout << "transform Mat4f " << name << " max error "
+                  << MaxError(kernel_f, scalar_f) << "\n";
+
+        auto kernel_d = Run<double>(("Mat4d " + name).c_str(), RunKernels);
+        std::cout << "transform Mat4d " << name << " max error "
+                  << MaxError(kernel_d, scalar_d) << "\n";
+    }
+}
@@ -0,0 +1,65 @@
+//
+// common.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef BENCH_MATH_COMMON_H_
+#define BENCH_MATH_COMMON_H_
+
+#include <chrono>
+#include <vector>
+#include "minicore/base/base.h"
+
+///
+/// @brief Wall clock timer measuring elapsed time in milliseconds.
+///
+struct Timer {
+    using Clock = std::chrono::high_resolution_clock;
+    using Msec = std::chrono::duration<double, std::ratio<1,1000>>;
+
+    Clock::time_point mStart = Clock::now();
+
+    void reset() { mStart = Clock::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<Msec>(Clock::now() - mStart).count();
+    }
+};
+
+///
+/// @brief Consume a value so that the computation of the value is not
+/// optimized away, without storing it.
+///
+template<typename T>
+inline void DoNotOptimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    volatile T sink = value;
+    (void) sink;
+#endif
+}
+
+///
+/// @brief Aligned array of vectors and matrices.
+///
+template<typename T>
+using Array = std::vector<T, Base::Allocator<T>>;
+
+///
+/// @brief Benchmark clients.
+///
+void BenchTransform();
+void BenchAlgebra();
+void BenchBatch();
+void BenchExpr();
+void BenchFastmath();
+void BenchQuat();
+void BenchRandom();
+void BenchMatrixN();
+
+#endif // BENCH_MATH_COMMON_H_
@@ -0,0 +1,52 @@
+//
+// main.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <exception>
+#include "common.h"
+
+///
+/// @brief Run all benchmarks, or the benchmarks given in the command line.
+///
+int main(int argc, char const *argv[])
+{
+    struct Bench {
+        const char *name;
+        void (*run)();
+    };
+    const Bench benchmarks[] = {
+        {"transform", BenchTransform},
+        {"algebra", BenchAlgebra},
+        {"batch", BenchBatch},
+        {"expr", BenchExpr},
+        {"fastmath", BenchFastmath},
+        {"quat", BenchQuat},
+        {"random", BenchRandom},
+        {"matrixn", BenchMatrixN},
+    };
+
+    try {
+        for (auto &bench : benchmarks) {
+            bool enabled = (argc == 1);
+            for (int i = 1; i < argc; ++i) {
+                enabled |= (std::strcmp(argv[i], bench.name) == 0);
+            }
+            if (enabled) {
+                std::cout << "---- " << bench.name << "\n";
+                bench.run();
+            }
+        }
+    } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -24,6 +24,7 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include <math.h>
@@ -32,6 +33,8 @@
 #include <io.h>
 #else
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
 #include "iso8859.h"
@@ -46,8 +49,41 @@
 #define PI       3.14159265358979323846
 #endif
 
+#define BLOCKSIZE (3 << 24)           /* Bytes read per block, a multiple of
+                                         the chunks of the random tests. */
+
 extern double pochisq(const double ax, const int df);
 
+/*  MAPFILE  --  Map a regular file into memory, or return NULL if the file
+                 cannot be mapped and must be read.  */
+
+static unsigned char *mapfile(FILE *fp, size_t *size)
+{
+#ifdef _WIN32
+        (void) fp;
+        (void) size;
+        return NULL;
+#else
+        struct stat st;
+        void *map;
+
+        if (fstat(fileno(fp), &st) != 0 || !S_ISREG(st.st_mode) ||
+            st.st_size <= 0) {
+           return NULL;
+        }
+        map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE,
+                   fileno(fp), 0);
+        if (map == MAP_FAILED) {
+           return NULL;
+        }
+#ifdef MADV_SEQUENTIAL
+        madvise(map, (size_t) st.st_size, MADV_SEQUENTIAL);
+#endif
+        *size = (size_t) st.st_size;
+        return map;
+#endif
+}
+
 /*  HELP  --  Print information on how to call  */
 
 static void help(void)
@@ -96,7 +132,7 @@ static int getopt(int argc, char *argv[], char *opts)
 
 int main(int argc, char *argv[])
 {
-        int i, oc, opt;
+        int i, opt;
         long ccount[256];             /* Bins to count occurrences of values */
         long totalc = 0;              /* Total character count */
         char *samp;
@@ -174,30 +210,43 @@ int main(int argc, char *argv[])
 
         rt_init(binary);
 
-        /* Scan input file and count character occurrences */
+        /* Scan input file and count character occurrences.  A regular
+           file is mapped and analysed in place, and any other input, or
+           input to be folded, is read and analysed in blocks. */
 
-        while ((oc = fgetc(fp)) != EOF) {
-           unsigned char ocb;
+        {
+           size_t size = 0;
+           unsigned char *map = fold ? NULL : mapfile(fp, &size);
 
-           if (fold && isISOalpha(oc) && isISOupper(oc)) {
-              oc = toISOlower(oc);
-           }
-           ocb = (unsigned char) oc;
-           totalc += binary ? 8 : 1;
-           if (binary) {
-            int b;
-            unsigned char ob = ocb;
-
-            for (b = 0; b < 8; b++) {
-                ccount[ob & 1]++;
-                ob >>= 1;
-            }
+           if (map != NULL) {
+              rt_add(map, size);
+#ifndef _WIN32
+              munmap(map, size);
+#endif
            } else {
-               ccount[ocb]++;         /* Update counter for this bin */
+              unsigned char *block = malloc(BLOCKSIZE);
+              size_t n, j;
+
+              if (block == NULL) {
+                 printf("Cannot allocate input buffer\n");
+                 return 2;
+              }
+              do {
+                 n = fread(block, 1, BLOCKSIZE, fp);
+                 if (fold) {
+                    for (j = 0; j < n; j++) {
+                       if (isISOalpha(block[j]) && isISOupper(block[j])) {
+                          block[j] = toISOlower(block[j]);
+                       }
+                    }
+                 }
+                 rt_add(block, n);
+              } while (n == BLOCKSIZE);
+              free(block);
            }
-           rt_add(&ocb, 1);
         }
         fclose(fp);
+        rt_counts(ccount, &totalc);
 
         /* Complete calculation and return sequence metrics */
 
@@ -5,9 +5,22 @@
                   by John Walker  --  September 1996
                        https://www.fourmilab.ch/
 
+         Blocks of the stream are analysed in parallel chunks.  All
+         sums are kept as integers, which the original accumulates
+         exactly in doubles for any stream shorter than 2^53 / 255^2
+         bytes, so that the results are identical.
+
 */
 
 #include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "randtest.h"
 
 #define FALSE 0
 #define TRUE  1
@@ -32,12 +45,28 @@ static double rt_log2(double x)
                                          bits than the mantissa of your
                                          "double" floating point type. */
 
+#define RT_CHUNK (3 << 21)            /* Bytes per parallel chunk, a multiple
+                                         of MONTEN and of the 8 bytes of a
+                                         bit stream word. */
+
+#define RT_PAIRS 65536                /* Byte products summed in 32 bits,
+                                         65536 * 255 * 255 < 2^32. */
+
 static int mp, sccfirst;
 static unsigned int monte[MONTEN];
-static long inmont, mcount;
-static double cexp, incirc, montex, montey, montepi,
-              scc, sccun, sccu0, scclast, scct1, scct2, scct3,
-              ent, chisq, datasum;
+static uint64_t inmont, mcount, incircle;
+static unsigned int sccu0, scclast;
+static uint64_t scct1;
+static double cexp, montepi, scc, ent, chisq, datasum;
+
+/*  Sums of a chunk of the stream.  */
+
+typedef struct {
+    uint64_t count[256];           /* Bins, or the number of one bits */
+    uint64_t pairs;                /* Products of consecutive values */
+    uint64_t inmont;               /* Monte Carlo hits and tries */
+    uint64_t mcount;
+} rt_sums;
 
 /*  RT_INIT  --  Initialise random test counters.  */
 
@@ -56,12 +85,13 @@ void rt_init(int binmode)
     mp = 0;                    /* Reset Monte Carlo accumulator pointer */
     mcount = 0;                /* Clear Monte Carlo tries */
     inmont = 0;                /* Clear Monte Carlo inside count */
-    incirc = 65535.0 * 65535.0;/* In-circle distance for Monte Carlo */
 
-    sccfirst = TRUE;           /* Mark first time for serial correlation */
-    scct1 = scct2 = scct3 = 0.0; /* Clear serial correlation terms */
+    /* In-circle distance for Monte Carlo, (256^3 - 1)^2 < 2^48 */
+    incircle = ((1ULL << (8 * MONTEN / 2)) - 1) *
+               ((1ULL << (8 * MONTEN / 2)) - 1);
 
-    incirc = pow(pow(256.0, (double) (MONTEN / 2)) - 1, 2.0);
+    sccfirst = TRUE;           /* Mark first time for serial correlation */
+    scct1 = 0;                 /* Clear serial correlation terms */
 
     for (i = 0; i < 256; i++) {
         ccount[i] = 0;
@@ -69,62 +99,256 @@ void rt_init(int binmode)
     totalc = 0;
 }
 
-/*  RT_ADD  --  Add one or more bytes to accumulation.  */
+/*  RT_LOAD64  --  Load 8 bytes as a big-endian word, so that the bits of
+                   the stream run from the most significant bit down.  */
+
+static uint64_t rt_load64(const unsigned char *bp)
+{
+    uint64_t w;
+
+    memcpy(&w, bp, sizeof(w));
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    w = __builtin_bswap64(w);
+#elif defined(_MSC_VER)
+    w = _byteswap_uint64(w);
+#else
+    w = ((uint64_t) bp[0] << 56) | ((uint64_t) bp[1] << 48) |
+        ((uint64_t) bp[2] << 40) | ((uint64_t) bp[3] << 32) |
+        ((uint64_t) bp[4] << 24) | ((uint64_t) bp[5] << 16) |
+        ((uint64_t) bp[6] << 8) | (uint64_t) bp[7];
+#endif
+    return w;
+}
+
+/*  RT_POPCOUNT  --  Count the one bits of a word.  */
+
+static unsigned int rt_popcount(uint64_t w)
+{
+#if defined(__GNUC__)
+    return (unsigned int) __builtin_popcountll(w);
+#else
+    w = w - ((w >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (unsigned int) ((w * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/*  RT_CHUNK_BYTES  --  Bins and serial products of the values of a chunk of
+                        bytes.  Four sub-histograms break the dependency of
+                        repeated bytes, and the products are summed in 32 bits
+                        in blocks.  If link is set, the byte following the
+                        chunk is valid and its product with the last byte is
+                        added.  */
+
+static void rt_chunk_bytes(const unsigned char *bp, size_t n, int link,
+                           rt_sums *s)
+{
+    uint32_t hist[4][256];
+    size_t i, j, npairs;
+
+    memset(hist, 0, sizeof(hist));
+    for (i = 0; i + 4 <= n; i += 4) {
+        hist[0][bp[i]]++;
+        hist[1][bp[i + 1]]++;
+        hist[2][bp[i + 2]]++;
+        hist[3][bp[i + 3]]++;
+    }
+    for (; i < n; i++) {
+        hist[0][bp[i]]++;
+    }
+    for (j = 0; j < 256; j++) {
+        s->count[j] += (uint64_t) hist[0][j] + hist[1][j] +
+                       hist[2][j] + hist[3][j];
+    }
+
+    npairs = link ? n : n - 1;
+    for (i = 0; i < npairs; i += RT_PAIRS) {
+        size_t end = (i + RT_PAIRS < npairs) ? i + RT_PAIRS : npairs;
+        uint32_t sum = 0;
+        for (j = i; j < end; j++) {
+            sum += (uint32_t) bp[j] * bp[j + 1];
+        }
+        s->pairs += sum;
+    }
+}
+
+/*  RT_CHUNK_BITS  --  One bits and serial products of the bits of a chunk,
+                       most significant bit first.  Consecutive one bits of
+                       a word w are the bits of w & (w >> 1), and the last
+                       bit of a word is followed by the first of the next.  */
 
-void rt_add(void *buf, int bufl)
+static void rt_chunk_bits(const unsigned char *bp, size_t n, int link,
+                          rt_sums *s)
 {
-    unsigned char *bp = buf;
-    int oc, c, bean;
-
-    while (bean = 0, (bufl-- > 0)) {
-       oc = *bp++;
-
-       do {
-          if (binary) {
-             c = !!(oc & 0x80);
-          } else {
-             c = oc;
-          }
-          ccount[c]++;            /* Update counter for this bin */
-          totalc++;
-
-          /* Update inside / outside circle counts for Monte Carlo
-             computation of PI */
-
-          if (bean == 0) {
-              monte[mp++] = oc;       /* Save character for Monte Carlo */
-              if (mp >= MONTEN) {     /* Calculate every MONTEN character */
-                 int mj;
-
-                 mp = 0;
-                 mcount++;
-                 montex = montey = 0;
-                 for (mj = 0; mj < MONTEN / 2; mj++) {
-                    montex = (montex * 256.0) + monte[mj];
-                    montey = (montey * 256.0) + monte[(MONTEN / 2) + mj];
-                 }
-                 if ((montex * montex + montey *  montey) <= incirc) {
-                    inmont++;
-                 }
-              }
-          }
-
-          /* Update calculation of serial correlation coefficient */
-
-          sccun = c;
-          if (sccfirst) {
-             sccfirst = FALSE;
-             scclast = 0;
-             sccu0 = sccun;
-          } else {
-             scct1 = scct1 + scclast * sccun;
-          }
-          scct2 = scct2 + sccun;
-          scct3 = scct3 + (sccun * sccun);
-          scclast = sccun;
-          oc <<= 1;
-       } while (binary && (++bean < 8));
+    uint64_t ones = 0, pairs = 0, w, prev = 0;
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        w = rt_load64(bp + i);
+        ones += rt_popcount(w);
+        pairs += rt_popcount(w & (w >> 1)) + (prev & (w >> 63));
+        prev = w & 1;
+    }
+    for (; i < n; i++) {
+        w = bp[i];
+        ones += rt_popcount(w);
+        pairs += rt_popcount(w & (w >> 1)) + (prev & (w >> 7));
+        prev = w & 1;
     }
+    if (link) {
+        pairs += prev & (bp[n] >> 7);
+    }
+
+    s->count[1] += ones;
+    s->count[0] += 8 * (uint64_t) n - ones;
+    s->pairs += pairs;
+}
+
+/*  RT_CHUNK_MONTE  --  Monte Carlo hits of the complete groups of MONTEN
+                        bytes of a chunk.  */
+
+static void rt_chunk_monte(const unsigned char *bp, size_t n, rt_sums *s)
+{
+    uint64_t inside = 0;
+    size_t i, groups = n / MONTEN;
+
+    for (i = 0; i < groups; i++) {
+        const unsigned char *g = bp + i * MONTEN;
+        uint64_t x = ((uint64_t) g[0] << 16) | ((uint64_t) g[1] << 8) | g[2];
+        uint64_t y = ((uint64_t) g[3] << 16) | ((uint64_t) g[4] << 8) | g[5];
+        inside += (x * x + y * y <= incircle);
+    }
+    s->inmont += inside;
+    s->mcount += groups;
+}
+
+/*  RT_MONTE_ADD  --  Add one byte to the pending Monte Carlo group.  */
+
+static void rt_monte_add(unsigned int oc)
+{
+    monte[mp++] = oc;
+    if (mp >= MONTEN) {
+        uint64_t x = ((uint64_t) monte[0] << 16) |
+                     ((uint64_t) monte[1] << 8) | monte[2];
+        uint64_t y = ((uint64_t) monte[3] << 16) |
+                     ((uint64_t) monte[4] << 8) | monte[5];
+        mp = 0;
+        mcount++;
+        inmont += (x * x + y * y <= incircle);
+    }
+}
+
+/*  RT_ADD  --  Add one or more bytes to accumulation.  The bytes completing
+                a pending Monte Carlo group are added first, and the rest of
+                the buffer is split in chunks analysed in parallel, each
+                thread summing its chunks.  The bytes of a partial group at
+                the end are kept for the next call.  */
+
+void rt_add(void *buf, size_t bufl)
+{
+    const unsigned char *bp = buf;
+    size_t head, tail, nchunks;
+    long k;
+    rt_sums sums;
+    int i;
+
+    if (bufl == 0) {
+        return;
+    }
+
+    /* Update calculation of serial correlation coefficient across the
+       previous buffer. */
+
+    if (sccfirst) {
+        sccfirst = FALSE;
+        sccu0 = binary ? (bp[0] >> 7) : bp[0];
+    } else {
+        scct1 += scclast * (binary ? (bp[0] >> 7) : bp[0]);
+    }
+    scclast = binary ? (bp[bufl - 1] & 1) : bp[bufl - 1];
+
+    /* Complete the pending Monte Carlo group. */
+
+    head = 0;
+    while (mp > 0 && head < bufl) {
+        rt_monte_add(bp[head++]);
+    }
+    tail = (bufl - head) % MONTEN;
+    for (i = 0; i < (int) tail; i++) {
+        monte[i] = bp[bufl - tail + i];
+    }
+
+    memset(&sums, 0, sizeof(sums));
+    if (head > 0) {
+        if (binary) {
+            rt_chunk_bits(bp, head, head < bufl, &sums);
+        } else {
+            rt_chunk_bytes(bp, head, head < bufl, &sums);
+        }
+    }
+
+    nchunks = (bufl - head + RT_CHUNK - 1) / RT_CHUNK;
+
+#ifdef _OPENMP
+#pragma omp parallel if (nchunks > 1)
+#endif
+    {
+        rt_sums local;
+
+        memset(&local, 0, sizeof(local));
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for (k = 0; k < (long) nchunks; k++) {
+            size_t first = head + (size_t) k * RT_CHUNK;
+            size_t n = (bufl - first < RT_CHUNK) ? bufl - first : RT_CHUNK;
+            int link = first + n < bufl;
+
+            if (binary) {
+                rt_chunk_bits(bp + first, n, link, &local);
+            } else {
+                rt_chunk_bytes(bp + first, n, link, &local);
+            }
+            rt_chunk_monte(bp + first, n - (first + n == bufl ? tail : 0),
+                           &local);
+        }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            int j;
+
+            for (j = 0; j < 256; j++) {
+                sums.count[j] += local.count[j];
+            }
+            sums.pairs += local.pairs;
+            sums.inmont += local.inmont;
+            sums.mcount += local.mcount;
+        }
+    }
+    if (mp == 0) {
+        mp = (int) tail;
+    }
+
+    for (i = 0; i < (binary ? 2 : 256); i++) {
+        ccount[i] += (long) sums.count[i];
+    }
+    totalc += (long) (binary ? 8 * bufl : bufl);
+    scct1 += sums.pairs;
+    inmont += sums.inmont;
+    mcount += sums.mcount;
+}
+
+/*  RT_COUNTS  --  Return the bins and the total count.  */
+
+void rt_counts(long *r_ccount, long *r_totalc)
+{
+    memcpy(r_ccount, ccount, sizeof(ccount));
+    *r_totalc = totalc;
 }
 
 /*  RT_END  --  Complete calculation and return results.  */
@@ -132,17 +356,25 @@ void rt_add(void *buf, int bufl)
 void rt_end(double *r_ent, double *r_chisq, double *r_mean,
             double *r_montepicalc, double *r_scc)
 {
+    double t1, t2, t3;
     int i;
 
-    /* Complete calculation of serial correlation coefficient */
+    /* Complete calculation of serial correlation coefficient.  The sums
+       of the values and of their squares are the moments of the bins. */
 
-    scct1 = scct1 + scclast * sccu0;
-    scct2 = scct2 * scct2;
-    scc = totalc * scct3 - scct2;
+    t1 = (double) (scct1 + (uint64_t) scclast * sccu0);
+    t2 = 0.0;
+    t3 = 0.0;
+    for (i = 0; i < (binary ? 2 : 256); i++) {
+        t2 += (double) ((uint64_t) i * ccount[i]);
+        t3 += (double) ((uint64_t) i * i * ccount[i]);
+    }
+    t2 = t2 * t2;
+    scc = totalc * t3 - t2;
     if (scc == 0.0) {
        scc = -100000;
     } else {
-       scc = (totalc * scct1 - scct2) / scc;
+       scc = (totalc * t1 - t2) / scc;
     }
 
     /* Scan bins and calculate probability for each bin and
@@ -153,7 +385,7 @@ void rt_end(double *r_ent, double *r_chisq, double *r_mean,
 
     cexp = totalc / (binary ? 2.0 : 256.0);  /* Expected count per bin */
     for (i = 0; i < (binary ? 2 : 256); i++) {
-       double a = ccount[i] - cexp;;
+       double a = ccount[i] - cexp;
 
        prob[i] = ((double) ccount[i]) / totalc;
        chisq += (a * a) / cexp;
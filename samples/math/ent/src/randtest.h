@@ -1,7 +1,10 @@
 
 /*  Random test function prototypes  */
 
+#include <stddef.h>
+
 extern void rt_init(int binmode);
-extern void rt_add(void *buf, int bufl);
+extern void rt_add(void *buf, size_t bufl);
+extern void rt_counts(long *r_ccount, long *r_totalc);
 extern void rt_end(double *r_ent, double *r_chisq, double *r_mean,
                    double *r_montepicalc, double *r_scc);
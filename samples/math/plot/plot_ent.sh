@@ -7,7 +7,8 @@
 # the terms of the MIT License. See accompanying LICENSE.md or
 # https://opensource.org/licenses/MIT.
 
-# Number of output runs
+# Number of output runs, written to /tmp by the hidden RandomEnt test case,
+#   testmath "[.ent]"
 NUMRUNS=2048
 NTHREADS=64
 
@@ -37,6 +37,11 @@ pushd test
 run ./testmath
 popd
 
+# Write the random engine runs to /tmp and plot their ent statistics
+pushd test
+run ./testmath "[.ent]"
+popd
+
 pushd plot
 run ./plot_ent.sh
 gnuplot plot_ent.gnuplot
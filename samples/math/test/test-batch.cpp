@@ -0,0 +1,54 @@
+//
+// test-batch.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-batch.h"
+
+///
+/// @brief Batch test client. Verify the batch functions over arrays with
+/// partial packets and blocks, in the calling thread and over the thread pool.
+///
+TEST_CASE("Batch") {
+    const size_t counts[] = {0, 1, 7, 33, 4099, 70001};
+
+    SECTION("Serial") {
+        for (auto count : counts) {
+            test_batch_run<float>(count);
+            test_batch_run<double>(count);
+            test_batch_cell_run(count);
+            test_batch_matrix_run<float, Math::Mat3, Math::Batch::Mat3Array>(
+                count);
+            test_batch_matrix_run<double, Math::Mat3, Math::Batch::Mat3Array>(
+                count);
+            test_batch_matrix_run<float, Math::Mat4, Math::Batch::Mat4Array>(
+                count);
+            test_batch_matrix_run<double, Math::Mat4, Math::Batch::Mat4Array>(
+                count);
+        }
+    }
+
+    SECTION("Parallel") {
+        Base::ThreadPool::Initialize(4);
+        for (auto count : counts) {
+            test_batch_run<float>(count);
+            test_batch_run<double>(count);
+            test_batch_cell_run(count);
+            test_batch_matrix_run<float, Math::Mat3, Math::Batch::Mat3Array>(
+                count);
+            test_batch_matrix_run<double, Math::Mat3, Math::Batch::Mat3Array>(
+                count);
+            test_batch_matrix_run<float, Math::Mat4, Math::Batch::Mat4Array>(
+                count);
+            test_batch_matrix_run<double, Math::Mat4, Math::Batch::Mat4Array>(
+                count);
+        }
+        Base::ThreadPool::Terminate();
+        REQUIRE(Base::ThreadPool::GetNumThreads() == 0);
+    }
+}
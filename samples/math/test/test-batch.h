@@ -0,0 +1,234 @@
+//
+// test-batch.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_BATCH_H_
+#define TEST_MATH_BATCH_H_
+
+#include <algorithm>
+#include <vector>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+#include "test-simd.h"
+
+///
+/// @brief Batch functions test client. Apply the batch functions to arrays of
+/// random vectors, out-of-place and in-place, and compare them with the long
+/// double reference of each item.
+///
+template<typename T>
+void test_batch_run(const size_t count)
+{
+    using Vec3 = Math::Vec3<T>;
+    using Mat4 = Math::Mat4<T>;
+    using RefVec3 = Math::Vec3<long double>;
+    using RefVec4 = Math::Vec4<long double>;
+    using RefMat4 = Math::Mat4<long double>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_real_distribution<T> dist_pos(1.0, 2.0);
+
+    std::vector<Vec3, Base::Allocator<Vec3>> a(count), b(count), c(count);
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = {dist(rng), dist(rng), dist(rng)};
+        b[i] = {dist(rng), dist(rng), dist(rng)};
+        c[i] = {dist_pos(rng), dist(rng), dist(rng)};
+    }
+    Mat4 m;
+    for (size_t j = 0; j < 16; ++j) {
+        m.data[j] = dist(rng);
+    }
+    RefMat4 ref_m = test_simd_cast<RefMat4>(m);
+
+    std::vector<Vec3, Base::Allocator<Vec3>> out(count);
+    std::vector<T> out_s(count);
+
+    // Test transform
+    Math::Batch::Transform(m, a.data(), out.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        RefVec3 ref_a = test_simd_cast<RefVec3>(a[i]);
+        RefVec4 ref = Math::Dot(ref_m, RefVec4{ref_a.x, ref_a.y, ref_a.z, 1});
+        test_simd_check<T>(out[i], RefVec3{ref.x, ref.y, ref.z});
+    }
+    std::vector<Vec3, Base::Allocator<Vec3>> points(a);
+    Math::Batch::Transform(m, points.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(points[i], test_simd_cast<RefVec3>(out[i]));
+    }
+
+    // Test normalize
+    Math::Batch::Normalize(c.data(), out.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(
+            out[i], Math::Normalize(test_simd_cast<RefVec3>(c[i])));
+    }
+    std::vector<Vec3, Base::Allocator<Vec3>> vectors(c);
+    Math::Batch::Normalize(vectors.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(vectors[i], test_simd_cast<RefVec3>(out[i]));
+    }
+
+    // Test dot, cross and distance
+    Math::Batch::Dot(a.data(), b.data(), out_s.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(out_s[i], Math::Dot(
+            test_simd_cast<RefVec3>(a[i]), test_simd_cast<RefVec3>(b[i])));
+    }
+
+    Math::Batch::Cross(a.data(), b.data(), out.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(out[i], Math::Cross(
+            test_simd_cast<RefVec3>(a[i]), test_simd_cast<RefVec3>(b[i])));
+    }
+
+    Math::Batch::Distance(a.data(), b.data(), out_s.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(out_s[i], Math::Distance(
+            test_simd_cast<RefVec3>(a[i]), test_simd_cast<RefVec3>(b[i])));
+    }
+
+    // Test bounding box
+    Vec3 lo, hi;
+    Math::Batch::Aabb(c.data(), count, lo, hi);
+    if (count == 0) {
+        REQUIRE((lo.x > hi.x && lo.y > hi.y && lo.z > hi.z));
+    } else {
+        Vec3 ref_lo = c[0];
+        Vec3 ref_hi = c[0];
+        for (size_t i = 1; i < count; ++i) {
+            ref_lo = Math::Min(ref_lo, c[i]);
+            ref_hi = Math::Max(ref_hi, c[i]);
+        }
+        REQUIRE((lo.x == ref_lo.x && lo.y == ref_lo.y && lo.z == ref_lo.z));
+        REQUIRE((hi.x == ref_hi.x && hi.y == ref_hi.y && hi.z == ref_hi.z));
+    }
+}
+
+///
+/// @brief Batch cell keys test client. Compute the cell keys of an array of
+/// random points and compare them with the scalar cell keys. The points on the
+/// domain boundary and outside the domain are clamped to the boundary cells.
+///
+inline void test_batch_cell_run(const size_t count)
+{
+    using Vec3 = Math::Vec3<float>;
+    using Vec3u = Math::Vec3<uint32_t>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<float> dist(-0.5f, 2.5f);
+
+    Math::CellGrid grid = Math::CellGrid::Create(
+        Vec3{0.0f, 0.0f, 0.0f}, Vec3{2.0f, 2.0f, 2.0f}, Vec3u{64, 32, 16});
+
+    Vec3u lo = Math::CellIndex(grid, Vec3{-1.0f, 0.0f, 0.01f});
+    Vec3u hi = Math::CellIndex(grid, Vec3{2.0f, 3.0f, 1.99f});
+    REQUIRE((lo.x == 0 && lo.y == 0 && lo.z == 0));
+    REQUIRE((hi.x == 63 && hi.y == 31 && hi.z == 15));
+
+    std::vector<Vec3, Base::Allocator<Vec3>> points(count);
+    for (auto &p : points) {
+        p = {dist(rng), dist(rng), dist(rng)};
+    }
+
+    std::vector<uint32_t> keys(count);
+    Math::Batch::CellKeys(grid, points.data(), keys.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        REQUIRE(keys[i] == Math::CellKey(grid, points[i]));
+    }
+}
+
+///
+/// @brief Batch matrix functions test client. Compute the determinants and the
+/// inverses of an array of random matrices, every fifth singular with a zero
+/// last row, and compare them with the long double reference and, if regular,
+/// with the matrix functions of each item. The same matrices in structure of
+/// arrays layout give the same results, in-place or out-of-place.
+///
+template<typename T, template<typename> class M, template<typename> class A>
+void test_batch_matrix_run(const size_t count)
+{
+    using Mat = M<T>;
+    using RefMat = M<long double>;
+    const size_t dim = Mat::dim;
+    const size_t length = Mat::length;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+
+    std::vector<Mat, Base::Allocator<Mat>> a(count);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < length; ++j) {
+            a[i].data[j] = dist(rng);
+        }
+        for (size_t j = 0; j < dim; ++j) {
+            a[i].data[j * dim + j] += static_cast<T>(dim);
+        }
+        if (i % 5 == 4) {
+            for (size_t j = 0; j < dim; ++j) {
+                a[i].data[(dim - 1) * dim + j] = (T) 0;
+            }
+        }
+    }
+
+    // Test the arrays of matrices.
+    std::vector<T> det(count);
+    std::vector<Mat, Base::Allocator<Mat>> inv(count);
+    std::vector<uint8_t> singular(count);
+    Math::Batch::Determinant(a.data(), det.data(), count);
+    Math::Batch::Inverse(a.data(), inv.data(), singular.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        RefMat ref_a = test_simd_cast<RefMat>(a[i]);
+        test_simd_check<T>(det[i], (long double) Math::Determinant(a[i]));
+        test_simd_check<T>(det[i], Math::Determinant(ref_a));
+        test_simd_check<T>(inv[i], Math::Inverse(ref_a));
+        if (i % 5 == 4) {
+            REQUIRE(singular[i] == 1);
+        } else {
+            REQUIRE(singular[i] == 0);
+            test_simd_check<T>(
+                inv[i], test_simd_cast<RefMat>(Math::Inverse(a[i])));
+        }
+    }
+
+    std::vector<Mat, Base::Allocator<Mat>> b(a);
+    Math::Batch::Inverse(b.data(), b.data(), nullptr, count);
+    for (size_t i = 0; i < count; ++i) {
+        REQUIRE(std::equal(&b[i].data[0], &b[i].data[length],
+            &inv[i].data[0]));
+    }
+
+    // Test the matrix arrays in structure of arrays layout.
+    const size_t stride = count + 3;
+    std::vector<T> soa(length * stride);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t k = 0; k < length; ++k) {
+            soa[k * stride + i] = a[i].data[k];
+        }
+    }
+    A<T> src = {soa.data(), stride};
+
+    std::vector<T> soa_det(count);
+    Math::Batch::Determinant(src, soa_det.data(), count);
+    REQUIRE(soa_det == det);
+
+    std::fill(singular.begin(), singular.end(), 2);
+    Math::Batch::Inverse(src, src, singular.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t k = 0; k < length; ++k) {
+            REQUIRE(soa[k * stride + i] == inv[i].data[k]);
+        }
+        REQUIRE(singular[i] == (i % 5 == 4 ? 1 : 0));
+    }
+}
+
+#endif // TEST_MATH_BATCH_H_
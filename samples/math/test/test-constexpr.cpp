@@ -0,0 +1,30 @@
+//
+// test-constexpr.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-constexpr.h"
+
+///
+/// @brief Constexpr test client. The generic templates are always constant
+/// evaluated. The simd specializations only if the compiler can tell a
+/// constant evaluation from a runtime one.
+///
+TEST_CASE("Constexpr") {
+    test_constexpr_static<long double>();
+    test_constexpr_integer<int64_t>();
+#ifdef MATH_HAS_CONSTANT_EVALUATED
+    test_constexpr_static<float>();
+    test_constexpr_static<double>();
+    test_constexpr_integer<int32_t>();
+    test_constexpr_integer<uint32_t>();
+#endif
+
+    test_constexpr_run<float>();
+    test_constexpr_run<double>();
+}
@@ -0,0 +1,165 @@
+//
+// test-constexpr.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_CONSTEXPR_H_
+#define TEST_MATH_CONSTEXPR_H_
+
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+#include "test-simd.h"
+
+///
+/// @brief Return true if the elements of u and v are equal.
+///
+template<typename U>
+constexpr bool test_constexpr_equal(const U &u, const U &v)
+{
+    for (size_t i = 0; i < U::length; ++i) {
+        if (!(u[i] == v[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+///
+/// @brief Constant evaluation of the vector and matrix constants, operators
+/// and functions of type T. Every expression is folded by the compiler and
+/// checked by a static assertion.
+///
+template<typename T>
+void test_constexpr_static()
+{
+    using Vec2 = Math::Vec2<T>;
+    using Vec3 = Math::Vec3<T>;
+    using Vec4 = Math::Vec4<T>;
+    using Mat2 = Math::Mat2<T>;
+    using Mat3 = Math::Mat3<T>;
+    using Mat4 = Math::Mat4<T>;
+    using Quat = Math::Quat<T>;
+
+    constexpr Vec3 a{1, 2, 3};
+    constexpr Vec3 b{4, 5, 6};
+    static_assert(test_constexpr_equal(a + b, Vec3{5, 7, 9}), "");
+    static_assert(test_constexpr_equal(b - a, Vec3{3, 3, 3}), "");
+    static_assert(test_constexpr_equal(a * b, Vec3{4, 10, 18}), "");
+    static_assert(test_constexpr_equal(b / b, Vec3::Ones), "");
+    static_assert(test_constexpr_equal((T) 2 * a, Vec3{2, 4, 6}), "");
+    static_assert(test_constexpr_equal((T) 1 - a, Vec3{0, -1, -2}), "");
+    static_assert(test_constexpr_equal(-a + a, Vec3::Zeros), "");
+    static_assert(Math::Dot(a, b) == (T) 32, "");
+    static_assert(test_constexpr_equal(
+        Math::Cross(a, b), Vec3{-3, 6, -3}), "");
+
+    constexpr Vec4 c{(T) 1, (T) -2, (T) 3, (T) -4};
+    static_assert(test_constexpr_equal(Math::Abs(c), Vec4{1, 2, 3, 4}), "");
+    static_assert(test_constexpr_equal(
+        Math::Min(c, Vec4::Zeros), Vec4{0, -2, 0, -4}), "");
+    static_assert(test_constexpr_equal(
+        Math::Max(c, Vec4::Zeros), Vec4{1, 0, 3, 0}), "");
+    static_assert(test_constexpr_equal(
+        Math::Clamp(c, -Vec4::Ones, Vec4::Ones), Vec4{1, -1, 1, -1}), "");
+    static_assert(Math::Dot(c, c) == (T) 30, "");
+
+    constexpr Mat2 m2{1, 2, 3, 4};
+    static_assert(Math::Determinant(m2) == (T) -2, "");
+    static_assert(test_constexpr_equal(
+        Math::Dot(m2, Math::Inverse(m2)), Mat2::Eye), "");
+    static_assert(test_constexpr_equal(
+        Math::Dot(m2, Vec2{1, 1}), Vec2{3, 7}), "");
+
+    constexpr Mat3 m3{2, 0, 0, 0, 4, 0, 0, 0, 8};
+    static_assert(Math::Determinant(m3) == (T) 64, "");
+    static_assert(test_constexpr_equal(
+        Math::Dot(m3, Math::Inverse(m3)), Mat3::Eye), "");
+    static_assert(test_constexpr_equal(Math::Transpose(m3), m3), "");
+
+    constexpr Mat4 m4 = Math::Translate(Vec3{1, 2, 3});
+    static_assert(Math::Determinant(m4) == (T) 1, "");
+    static_assert(test_constexpr_equal(
+        Math::Dot(m4, Math::Inverse(m4)), Mat4::Eye), "");
+    static_assert(test_constexpr_equal(
+        Math::Dot(m4, Vec4{0, 0, 0, 1}), Vec4{1, 2, 3, 1}), "");
+    static_assert(test_constexpr_equal(
+        Math::Dot(Math::Scale(Vec3{2, 2, 2}), Vec4::Ones),
+        Vec4{2, 2, 2, 1}), "");
+    static_assert(test_constexpr_equal(
+        Mat4::Eye * (T) 2 + Mat4::Ones, Math::Transpose(
+            Mat4::Ones + (T) 2 * Mat4::Eye)), "");
+
+    constexpr Quat q{0, 0, 1, 0};
+    static_assert(test_constexpr_equal(q * q, Quat{0, 0, 0, -1}), "");
+    static_assert(test_constexpr_equal(
+        q * Math::Inverse(q), Quat::Identity), "");
+    static_assert(test_constexpr_equal(
+        Math::Rotate(q, Vec3{1, 2, 3}), Vec3{-1, -2, 3}), "");
+    static_assert(test_constexpr_equal(
+        Math::ToMat3(Quat::Identity), Mat3::Eye), "");
+}
+
+///
+/// @brief Constant evaluation of the integer vector operators.
+///
+template<typename T>
+void test_constexpr_integer()
+{
+    using Vec4 = Math::Vec4<T>;
+
+    constexpr Vec4 a{1, 2, 3, 4};
+    static_assert(test_constexpr_equal(a << 2, Vec4{4, 8, 12, 16}), "");
+    static_assert(test_constexpr_equal(a * a >> 1, Vec4{0, 2, 4, 8}), "");
+    static_assert(test_constexpr_equal(a - a, Vec4::Zeros), "");
+    static_assert(test_constexpr_equal(
+        Math::Select(Math::Greater(a, Vec4{2, 2, 2, 2}), a, Vec4::Zeros),
+        Vec4{0, 0, 3, 4}), "");
+}
+
+///
+/// @brief Constexpr test client. Compare the constant evaluation of the
+/// operators and functions with their runtime evaluation on equal arguments,
+/// which uses the simd specializations where they exist.
+///
+template<typename T>
+void test_constexpr_run()
+{
+    using Vec3 = Math::Vec3<T>;
+    using Vec4 = Math::Vec4<T>;
+    using Mat4 = Math::Mat4<T>;
+    using Quat = Math::Quat<T>;
+
+    constexpr Vec3 a{1, 2, 3};
+    constexpr Vec3 b{4, 5, 6};
+    constexpr Vec3 cross = Math::Cross(a, b);
+    constexpr Mat4 m = Math::Translate(a) * (T) 2;
+    constexpr Mat4 inv = Math::Inverse(m);
+    constexpr T det = Math::Determinant(m);
+    constexpr Quat q = Quat{0, 1, 0, 1} * Quat{1, 0, 0, 1};
+    constexpr Vec4 abs = Math::Abs(Vec4{1, -1, 1, -1});
+
+    // Read the arguments through a volatile, so that the compiler does not
+    // fold the runtime evaluation.
+    volatile T one = (T) 1;
+    const Vec3 u = a * one;
+    const Vec3 v = b * one;
+    REQUIRE(test_constexpr_equal(Math::Cross(u, v), cross));
+
+    const Mat4 n = Math::Translate(u) * (T) 2;
+    REQUIRE(Math::Determinant(n) == det);
+    test_simd_check<T>(
+        Math::Inverse(n), test_simd_cast<Math::Mat4<long double>>(inv));
+
+    const Quat p = Quat{0, one, 0, one} * Quat{one, 0, 0, one};
+    REQUIRE(test_constexpr_equal(p, q));
+
+    const Vec4 w{one, -one, one, -one};
+    REQUIRE(test_constexpr_equal(Math::Abs(w), abs));
+}
+
+#endif // TEST_MATH_CONSTEXPR_H_
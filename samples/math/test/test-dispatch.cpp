@@ -0,0 +1,64 @@
+//
+// test-dispatch.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-dispatch.h"
+
+///
+/// @brief Dispatch test client. Verify the kernels of every instruction set
+/// level supported by the cpu.
+///
+TEST_CASE("Dispatch") {
+    const size_t n_iters = 1024;
+
+    REQUIRE(Math::GetMaxIsa() < Math::kNumIsa);
+    REQUIRE(Math::GetKernels().isa == Math::GetMaxIsa());
+    REQUIRE_THROWS(Math::GetKernels(Math::kNumIsa));
+
+    for (uint32_t isa = Math::kIsaScalar; isa <= Math::GetMaxIsa(); ++isa) {
+        const Math::Kernels &kernels = Math::GetKernels(isa);
+        INFO("isa " << Math::GetIsaName(isa));
+        REQUIRE(kernels.isa == isa);
+
+        test_dispatch_run<float>(
+            kernels.transformVec4f, kernels.transformMat4f, n_iters);
+        test_dispatch_run<double>(
+            kernels.transformVec4d, kernels.transformMat4d, n_iters);
+        test_dispatch_mat4d_run(kernels, n_iters);
+        test_dispatch_cell_run(kernels, n_iters);
+        test_dispatch_random_run(kernels, n_iters);
+        test_dispatch_stream_run(kernels, n_iters);
+        test_dispatch_gemm_run<float, Math::kGemmColsf>(
+            kernels.gemmf, n_iters);
+        test_dispatch_gemm_run<double, Math::kGemmColsd>(
+            kernels.gemmd, n_iters);
+        test_dispatch_batch_run<float>(kernels.batchf, n_iters);
+        test_dispatch_batch_run<double>(kernels.batchd, n_iters);
+        test_dispatch_batch_matrix_run<float, Math::Mat3>(
+            kernels.batchf.determinantMat3,
+            kernels.batchf.determinantMat3Array,
+            kernels.batchf.inverseMat3,
+            kernels.batchf.inverseMat3Array, n_iters);
+        test_dispatch_batch_matrix_run<float, Math::Mat4>(
+            kernels.batchf.determinantMat4,
+            kernels.batchf.determinantMat4Array,
+            kernels.batchf.inverseMat4,
+            kernels.batchf.inverseMat4Array, n_iters);
+        test_dispatch_batch_matrix_run<double, Math::Mat3>(
+            kernels.batchd.determinantMat3,
+            kernels.batchd.determinantMat3Array,
+            kernels.batchd.inverseMat3,
+            kernels.batchd.inverseMat3Array, n_iters);
+        test_dispatch_batch_matrix_run<double, Math::Mat4>(
+            kernels.batchd.determinantMat4,
+            kernels.batchd.determinantMat4Array,
+            kernels.batchd.inverseMat4,
+            kernels.batchd.inverseMat4Array, n_iters);
+    }
+}
@@ -0,0 +1,645 @@
+//
+// test-dispatch.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_DISPATCH_H_
+#define TEST_MATH_DISPATCH_H_
+
+#include <vector>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+#include "test-fastmath.h"
+#include "test-simd.h"
+
+///
+/// @brief Dispatched kernels test client. Transform arrays of vectors and
+/// matrices, out-of-place and in-place, with the kernels of the specified
+/// instruction set level and compare them with the long double reference.
+///
+template<typename T>
+void test_dispatch_run(
+    void (*transform_vec4)(const Math::Mat4<T> &, const Math::Vec4<T> *,
+        Math::Vec4<T> *, const size_t),
+    void (*transform_mat4)(const Math::Mat4<T> &, const Math::Mat4<T> *,
+        Math::Mat4<T> *, const size_t),
+    const size_t n_iters)
+{
+    using Vec4 = Math::Vec4<T>;
+    using Mat4 = Math::Mat4<T>;
+    using RefVec4 = Math::Vec4<long double>;
+    using RefMat4 = Math::Mat4<long double>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_int_distribution<size_t> dist_count(0, 67);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        const size_t count = dist_count(rng);
+
+        Mat4 m;
+        for (auto &it : m.data) {
+            it = dist(rng);
+        }
+        RefMat4 ref_m = test_simd_cast<RefMat4>(m);
+
+        std::vector<Vec4, Base::Allocator<Vec4>> src_v(count), dst_v(count);
+        std::vector<Mat4, Base::Allocator<Mat4>> src_m(count), dst_m(count);
+        for (size_t i = 0; i < count; ++i) {
+            for (auto &it : src_v[i].data) {
+                it = dist(rng);
+            }
+            for (auto &it : src_m[i].data) {
+                it = dist(rng);
+            }
+        }
+
+        // Out-of-place and in-place transform of the vectors.
+        transform_vec4(m, src_v.data(), dst_v.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefVec4 ref = Math::Dot(ref_m, test_simd_cast<RefVec4>(src_v[i]));
+            test_simd_check<T>(dst_v[i], ref);
+        }
+
+        transform_vec4(m, dst_v.data(), dst_v.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefVec4 ref = Math::Dot(ref_m, test_simd_cast<RefVec4>(src_v[i]));
+            test_simd_check<T>(dst_v[i], Math::Dot(ref_m, ref));
+        }
+
+        // Out-of-place and in-place transform of the matrices.
+        transform_mat4(m, src_m.data(), dst_m.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefMat4 ref = Math::Dot(ref_m, test_simd_cast<RefMat4>(src_m[i]));
+            test_simd_check<T>(dst_m[i], ref);
+        }
+
+        transform_mat4(m, dst_m.data(), dst_m.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefMat4 ref = Math::Dot(ref_m, test_simd_cast<RefMat4>(src_m[i]));
+            test_simd_check<T>(dst_m[i], Math::Dot(ref_m, ref));
+        }
+    }
+}
+
+///
+/// @brief Dispatched double precision matrix kernels test client. Compute the
+/// products, determinants and inverses of arrays of matrices and transform an
+/// array of points, out-of-place and in-place, and compare them with the long
+/// double reference. One matrix of each array has a zero row, so that its
+/// determinant is exactly zero, and must have a zero inverse.
+///
+inline void test_dispatch_mat4d_run(
+    const Math::Kernels &kernels,
+    const size_t n_iters)
+{
+    using Vec3 = Math::Vec3<double>;
+    using Mat4 = Math::Mat4<double>;
+    using RefVec3 = Math::Vec3<long double>;
+    using RefVec4 = Math::Vec4<long double>;
+    using RefMat4 = Math::Mat4<long double>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::uniform_int_distribution<size_t> dist_count(0, 67);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        const size_t count = dist_count(rng);
+
+        Mat4 m;
+        for (auto &it : m.data) {
+            it = dist(rng);
+        }
+        RefMat4 ref_m = test_simd_cast<RefMat4>(m);
+
+        std::vector<Vec3, Base::Allocator<Vec3>> src_v(count), dst_v(count);
+        std::vector<Mat4, Base::Allocator<Mat4>> src_a(count), src_b(count);
+        std::vector<Mat4, Base::Allocator<Mat4>> dst_m(count);
+        std::vector<double> dst_d(count);
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                src_v[i][j] = dist(rng);
+            }
+            for (size_t j = 0; j < 16; ++j) {
+                src_a[i].data[j] = dist(rng);
+                src_b[i].data[j] = dist(rng);
+            }
+            for (size_t j = 0; j < 4; ++j) {
+                src_a[i].data[5 * j] += 4.0;
+            }
+        }
+
+        size_t singular = count;
+        if (count > 0) {
+            singular = dist_count(rng) % count;
+            for (size_t j = 0; j < 4; ++j) {
+                src_a[singular].data[4 + j] = 0.0;
+            }
+        }
+
+        // Out-of-place and in-place transform of the points.
+        kernels.transformVec3d(m, src_v.data(), dst_v.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefVec3 p = test_simd_cast<RefVec3>(src_v[i]);
+            RefVec4 ref = Math::Dot(ref_m, RefVec4{p.x, p.y, p.z, 1.0L});
+            test_simd_check<double>(dst_v[i], RefVec3{ref.x, ref.y, ref.z});
+        }
+
+        kernels.transformVec3d(m, dst_v.data(), dst_v.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefVec3 p = test_simd_cast<RefVec3>(src_v[i]);
+            RefVec4 ref = Math::Dot(ref_m, RefVec4{p.x, p.y, p.z, 1.0L});
+            ref = Math::Dot(ref_m, RefVec4{ref.x, ref.y, ref.z, 1.0L});
+            test_simd_check<double>(dst_v[i], RefVec3{ref.x, ref.y, ref.z});
+        }
+
+        // Out-of-place and in-place products of the matrices.
+        kernels.dotMat4d(src_a.data(), src_b.data(), dst_m.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefMat4 ref = Math::Dot(
+                test_simd_cast<RefMat4>(src_a[i]),
+                test_simd_cast<RefMat4>(src_b[i]));
+            test_simd_check<double>(dst_m[i], ref);
+        }
+
+        kernels.dotMat4d(src_a.data(), dst_m.data(), dst_m.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefMat4 ref_a = test_simd_cast<RefMat4>(src_a[i]);
+            RefMat4 ref = Math::Dot(
+                ref_a, Math::Dot(ref_a, test_simd_cast<RefMat4>(src_b[i])));
+            test_simd_check<double>(dst_m[i], ref);
+        }
+
+        // Determinants of the matrices.
+        kernels.determinantMat4d(src_a.data(), dst_d.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefMat4 ref_a = test_simd_cast<RefMat4>(src_a[i]);
+            test_simd_check<double>(dst_d[i], Math::Determinant(ref_a));
+        }
+
+        // Out-of-place and in-place inverses of the matrices.
+        kernels.inverseMat4d(src_a.data(), dst_m.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefMat4 ref_a = test_simd_cast<RefMat4>(src_a[i]);
+            RefMat4 ref = (i == singular) ? RefMat4::Zeros
+                                          : Math::Inverse(ref_a);
+            test_simd_check<double>(dst_m[i], ref);
+        }
+
+        dst_m = src_a;
+        kernels.inverseMat4d(dst_m.data(), dst_m.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefMat4 ref_a = test_simd_cast<RefMat4>(src_a[i]);
+            RefMat4 ref = (i == singular) ? RefMat4::Zeros
+                                          : Math::Inverse(ref_a);
+            test_simd_check<double>(dst_m[i], ref);
+        }
+    }
+}
+
+///
+/// @brief Dispatched cell keys test client. Compute the cell keys of arrays of
+/// random points, inside and outside the grid domain, and compare them with
+/// the scalar cell keys.
+///
+inline void test_dispatch_cell_run(
+    const Math::Kernels &kernels,
+    const size_t n_iters)
+{
+    using Vec3 = Math::Vec3<float>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<float> dist(-1.5f, 1.5f);
+    std::uniform_int_distribution<uint32_t> dist_dims(1, 256);
+    std::uniform_int_distribution<size_t> dist_count(0, 67);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        const size_t count = dist_count(rng);
+
+        Math::Vec3<uint32_t> dims = {
+            dist_dims(rng), dist_dims(rng), dist_dims(rng)};
+        Math::CellGrid grid = Math::CellGrid::Create(
+            Vec3{-1.0f, -1.0f, -1.0f}, Vec3{1.0f, 1.0f, 1.0f}, dims);
+
+        std::vector<Vec3, Base::Allocator<Vec3>> points(count);
+        for (auto &p : points) {
+            p = {dist(rng), dist(rng), dist(rng)};
+        }
+
+        std::vector<uint32_t> keys(count);
+        kernels.cellKeys(grid, points.data(), keys.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(keys[i] == Math::CellKey(grid, points[i]));
+        }
+    }
+}
+
+///
+/// @brief Dispatched random fill test client. Fill arrays with the 32-bit and
+/// the 64-bit numbers of random engine lanes with random states, and compare
+/// them and the final lane states with the scalar engines of each lane.
+///
+inline void test_dispatch_random_run(
+    const Math::Kernels &kernels,
+    const size_t n_iters)
+{
+    const size_t lanes = Math::kRandomLanes;
+
+    std::random_device seed;
+    std::mt19937_64 rng(seed());
+    std::uniform_int_distribution<uint64_t> dist(1, UINT64_MAX);
+    std::uniform_int_distribution<uint32_t> dist_carry(1, 698769068U);
+    std::uniform_int_distribution<size_t> dist_count(0, 67);
+
+    auto check_lanes = [&](
+        const Math::RandomLanes &r,
+        const std::vector<Math::RandomEngine> &engines) {
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            Math::RandomEngine eng = Math::GetRandomLane(r, lane);
+            REQUIRE(eng.x == engines[lane].x);
+            REQUIRE(eng.y == engines[lane].y);
+            REQUIRE(eng.z1 == engines[lane].z1);
+            REQUIRE(eng.c1 == engines[lane].c1);
+            REQUIRE(eng.z2 == engines[lane].z2);
+            REQUIRE(eng.c2 == engines[lane].c2);
+        }
+    };
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        const size_t count = dist_count(rng);
+        const size_t steps = (count + lanes - 1) / lanes;
+
+        Math::RandomLanes r;
+        std::vector<Math::RandomEngine> engines(lanes);
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            engines[lane].x = dist(rng);
+            engines[lane].y = dist(rng);
+            engines[lane].z1 = (uint32_t) dist(rng);
+            engines[lane].c1 = dist_carry(rng);
+            engines[lane].z2 = (uint32_t) dist(rng);
+            engines[lane].c2 = dist_carry(rng);
+            Math::SetRandomLane(r, lane, engines[lane]);
+        }
+
+        // Fill the 32-bit numbers, the partial last step is discarded.
+        std::vector<uint32_t> dst32(count);
+        kernels.randomFill32(r, dst32.data(), count);
+        for (size_t k = 0; k < steps; ++k) {
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                uint32_t ref = Math::Random32(engines[lane]);
+                if (k * lanes + lane < count) {
+                    REQUIRE(dst32[k * lanes + lane] == ref);
+                }
+            }
+        }
+        check_lanes(r, engines);
+
+        // Fill the 64-bit numbers from the advanced lanes.
+        std::vector<uint64_t> dst64(count);
+        kernels.randomFill64(r, dst64.data(), count);
+        for (size_t k = 0; k < steps; ++k) {
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                uint64_t ref = Math::Random64(engines[lane]);
+                if (k * lanes + lane < count) {
+                    REQUIRE(dst64[k * lanes + lane] == ref);
+                }
+            }
+        }
+        check_lanes(r, engines);
+    }
+}
+
+///
+/// @brief Compare the random stream kernel with the scalar blocks of the
+/// stream, for both generators. Half of the streams start just below a
+/// 2^32 block boundary, so that the carry into the upper counter word is
+/// covered.
+///
+inline void test_dispatch_stream_run(
+    const Math::Kernels &kernels,
+    const size_t n_iters)
+{
+    std::random_device seed;
+    std::mt19937_64 rng(seed());
+    std::uniform_int_distribution<uint64_t> dist;
+    std::uniform_int_distribution<size_t> dist_count(0, 67);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        const size_t count = dist_count(rng);
+        const uint32_t generator = (iter % 2 == 0)
+            ? Math::kRandomPhilox : Math::kRandomThreefry;
+        Math::RandomStream stream = Math::CreateRandomStream(
+            dist(rng), dist(rng), generator);
+
+        uint64_t block = dist(rng);
+        if (iter % 4 < 2) {
+            block = (block & 0xffffffff00000000ULL) | (0xffffffffULL - 16);
+        }
+
+        std::vector<uint32_t> dst(4 * count);
+        kernels.randomStream(stream, block, dst.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t ref[4];
+            Math::RandomBlock(stream, block + i, ref);
+            for (size_t k = 0; k < 4; ++k) {
+                REQUIRE(dst[4*i + k] == ref[k]);
+            }
+        }
+    }
+}
+
+///
+/// @brief Dispatched matrix product kernel test client. Multiply random packed
+/// panels of a and b into a tile of c with a row stride larger than the tile,
+/// and compare the tile with the long double reference. The elements of c past
+/// the end of each row must be left unchanged.
+///
+template<typename T, size_t Cols>
+void test_dispatch_gemm_run(
+    void (*gemm)(const size_t, const T *, const T *, T *, const size_t),
+    const size_t n_iters)
+{
+    const size_t rows = Math::kGemmRows;
+    const size_t ldc = Cols + 3;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_int_distribution<size_t> dist_depth(0, 67);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        const size_t depth = dist_depth(rng);
+
+        std::vector<T, Base::Allocator<T>> a(depth * rows), b(depth * Cols);
+        std::vector<T> c(rows * ldc);
+        for (auto &it : a) {
+            it = dist(rng);
+        }
+        for (auto &it : b) {
+            it = dist(rng);
+        }
+        for (auto &it : c) {
+            it = dist(rng);
+        }
+
+        std::vector<T> out(c);
+        gemm(depth, a.data(), b.data(), out.data(), ldc);
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < ldc; ++j) {
+                long double ref = c[i * ldc + j];
+                if (j >= Cols) {
+                    REQUIRE(out[i * ldc + j] == c[i * ldc + j]);
+                    continue;
+                }
+                for (size_t p = 0; p < depth; ++p) {
+                    ref += (long double) a[p * rows + i] * b[p * Cols + j];
+                }
+                test_simd_check<T>(out[i * ldc + j], ref);
+            }
+        }
+    }
+}
+
+///
+/// @brief Dispatched batch kernels test client. Transform, rotate, normalize
+/// and bound arrays of random vectors and packed vectors, and evaluate the
+/// elementary functions of random arrays for both accuracy tiers, with the
+/// batch kernels of the specified instruction set level. Compare them with
+/// the long double reference.
+///
+template<typename T>
+void test_dispatch_batch_run(
+    const Math::BatchKernels<T> &kernels,
+    const size_t n_iters)
+{
+    using Vec3 = Math::Vec3<T>;
+    using Mat3 = Math::Mat3<T>;
+    using Mat4 = Math::Mat4<T>;
+    using PackedVec3 = Math::PackedVec3<T>;
+    using RefVec3 = Math::Vec3<long double>;
+    using RefVec4 = Math::Vec4<long double>;
+    using RefMat3 = Math::Mat3<long double>;
+    using RefMat4 = Math::Mat4<long double>;
+    using Array = std::vector<T, Base::Allocator<T>>;
+    const Math::Accuracy tiers[] = {
+        Math::kAccuracyPrecise, Math::kAccuracyFast};
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_real_distribution<T> dist_rsqrt(-60.0, 60.0);
+    std::uniform_real_distribution<T> dist_exp(-87.0, 88.0);
+    std::uniform_real_distribution<T> dist_log(-148.0, 127.0);
+    std::uniform_real_distribution<T> dist_sin(-100.0, 100.0);
+    std::uniform_real_distribution<T> dist_atan(-10.0, 10.0);
+    std::uniform_int_distribution<size_t> dist_count(0, 67);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        const size_t count = dist_count(rng);
+
+        Mat3 r;
+        Mat4 m;
+        for (auto &it : r.data) {
+            it = dist(rng);
+        }
+        for (auto &it : m.data) {
+            it = dist(rng);
+        }
+        RefMat3 ref_r = test_simd_cast<RefMat3>(r);
+        RefMat4 ref_m = test_simd_cast<RefMat4>(m);
+
+        std::vector<Vec3, Base::Allocator<Vec3>> a(count), b(count);
+        std::vector<Vec3, Base::Allocator<Vec3>> out(count);
+        std::vector<PackedVec3> pa(count), pout(count);
+        for (size_t i = 0; i < count; ++i) {
+            a[i] = {dist(rng), dist(rng), dist(rng)};
+            b[i] = {dist(rng), dist(rng), dist(rng)};
+            pa[i] = {a[i].x, a[i].y, a[i].z};
+        }
+
+        // Transform and rotate the vectors and the packed vectors.
+        kernels.transformVec3(m, a.data(), out.data(), count);
+        kernels.transformPackedVec3(m, pa.data(), pout.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefVec4 ref = Math::Dot(ref_m,
+                RefVec4{a[i].x, a[i].y, a[i].z, 1.0L});
+            test_simd_check<T>(out[i], RefVec3{ref.x, ref.y, ref.z});
+            test_simd_check<T>(pout[i], RefVec3{ref.x, ref.y, ref.z});
+        }
+
+        kernels.rotateVec3(r, a.data(), out.data(), count);
+        kernels.rotatePackedVec3(r, pa.data(), pout.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefVec3 ref = Math::Dot(ref_r, test_simd_cast<RefVec3>(a[i]));
+            test_simd_check<T>(out[i], ref);
+            test_simd_check<T>(pout[i], ref);
+        }
+
+        for (auto accuracy : tiers) {
+            kernels.normalizeVec3(a.data(), out.data(), count, accuracy);
+            kernels.normalizePackedVec3(
+                pa.data(), pout.data(), count, accuracy);
+            for (size_t i = 0; i < count; ++i) {
+                RefVec3 ref = Math::Normalize(test_simd_cast<RefVec3>(a[i]));
+                test_simd_check<T>(out[i], ref);
+                test_simd_check<T>(pout[i], ref);
+            }
+        }
+
+        // Dot, cross and distance of the pairs of vectors.
+        Array dot(count), dist_ab(count);
+        kernels.dotVec3(a.data(), b.data(), dot.data(), count);
+        kernels.crossVec3(a.data(), b.data(), out.data(), count);
+        kernels.distanceVec3(a.data(), b.data(), dist_ab.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefVec3 ref_a = test_simd_cast<RefVec3>(a[i]);
+            RefVec3 ref_b = test_simd_cast<RefVec3>(b[i]);
+            test_simd_check<T>(dot[i], Math::Dot(ref_a, ref_b));
+            test_simd_check<T>(out[i], Math::Cross(ref_a, ref_b));
+            test_simd_check<T>(dist_ab[i], Math::Distance(ref_a, ref_b));
+        }
+
+        // Bounding box of the vectors and the packed vectors.
+        const T inf = std::numeric_limits<T>::infinity();
+        Vec3 ref_lo = {inf, inf, inf};
+        Vec3 ref_hi = {-inf, -inf, -inf};
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t k = 0; k < 3; ++k) {
+                ref_lo[k] = std::min(ref_lo[k], a[i][k]);
+                ref_hi[k] = std::max(ref_hi[k], a[i][k]);
+            }
+        }
+
+        Vec3 lo, hi, plo, phi;
+        kernels.aabbVec3(a.data(), count, lo, hi);
+        kernels.aabbPackedVec3(pa.data(), count, plo, phi);
+        for (size_t k = 0; k < 3; ++k) {
+            REQUIRE(lo[k] == ref_lo[k]);
+            REQUIRE(hi[k] == ref_hi[k]);
+            REQUIRE(plo[k] == ref_lo[k]);
+            REQUIRE(phi[k] == ref_hi[k]);
+        }
+
+        // Elementary functions of the arrays.
+        Array x(count), y(count), z(count);
+        std::vector<long double> ref_rsqrt(count), ref_exp(count);
+        std::vector<long double> ref_log(count), ref_atan(count);
+        std::vector<long double> ref_sin(count), ref_cos(count);
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = std::exp2(dist_rsqrt(rng));
+            ref_rsqrt[i] = 1.0L / std::sqrt((long double) x[i]);
+            y[i] = dist_exp(rng);
+            ref_exp[i] = std::exp((long double) y[i]);
+            z[i] = std::exp2(dist_log(rng));
+            ref_log[i] = std::log((long double) z[i]);
+        }
+
+        for (auto accuracy : tiers) {
+            Array res(count);
+            kernels.rsqrt(x.data(), res.data(), count, accuracy);
+            test_fastmath_check(res, ref_rsqrt, accuracy, kTestFastmathRsqrt);
+            kernels.exp(y.data(), res.data(), count, accuracy);
+            test_fastmath_check(res, ref_exp, accuracy, kTestFastmathExp);
+            kernels.log(z.data(), res.data(), count, accuracy);
+            test_fastmath_check(res, ref_log, accuracy, kTestFastmathLog);
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = dist_sin(rng);
+            ref_sin[i] = std::sin((long double) x[i]);
+            ref_cos[i] = std::cos((long double) x[i]);
+            y[i] = dist_atan(rng);
+            z[i] = dist_atan(rng);
+            ref_atan[i] = std::atan2((long double) y[i], (long double) z[i]);
+        }
+
+        for (auto accuracy : tiers) {
+            Array res(count), sin(count), cos(count);
+            kernels.sinCos(x.data(), sin.data(), cos.data(), count, accuracy);
+            test_fastmath_check(sin, ref_sin, accuracy, kTestFastmathSinCos);
+            test_fastmath_check(cos, ref_cos, accuracy, kTestFastmathSinCos);
+            kernels.atan2(y.data(), z.data(), res.data(), count, accuracy);
+            test_fastmath_check(res, ref_atan, accuracy, kTestFastmathAtan2);
+        }
+    }
+}
+
+///
+/// @brief Dispatched batch matrix kernels test client. Compute the
+/// determinants and the inverses of arrays of random matrices, every fifth
+/// singular with a zero last row, in array of structures and structure of
+/// arrays layouts, and compare them with the long double reference.
+///
+template<typename T, template<typename> class M>
+void test_dispatch_batch_matrix_run(
+    void (*determinant)(const M<T> *, T *, const size_t),
+    void (*determinant_array)(const T *, const size_t, T *, const size_t),
+    void (*inverse)(const M<T> *, M<T> *, uint8_t *, const size_t),
+    void (*inverse_array)(const T *, const size_t, T *, const size_t,
+        uint8_t *, const size_t),
+    const size_t n_iters)
+{
+    using Mat = M<T>;
+    using RefMat = M<long double>;
+    const size_t dim = Mat::dim;
+    const size_t length = Mat::length;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_int_distribution<size_t> dist_count(0, 67);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        const size_t count = dist_count(rng);
+        const size_t stride = count + 3;
+
+        std::vector<Mat, Base::Allocator<Mat>> a(count), inv(count);
+        std::vector<T> soa(length * stride), soa_inv(length * stride);
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t j = 0; j < length; ++j) {
+                a[i].data[j] = dist(rng);
+            }
+            for (size_t j = 0; j < dim; ++j) {
+                a[i].data[j * dim + j] += static_cast<T>(dim);
+            }
+            if (i % 5 == 4) {
+                for (size_t j = 0; j < dim; ++j) {
+                    a[i].data[(dim - 1) * dim + j] = (T) 0;
+                }
+            }
+            for (size_t k = 0; k < length; ++k) {
+                soa[k * stride + i] = a[i].data[k];
+            }
+        }
+
+        std::vector<T> det(count), soa_det(count);
+        std::vector<uint8_t> singular(count), soa_singular(count);
+        determinant(a.data(), det.data(), count);
+        determinant_array(soa.data(), stride, soa_det.data(), count);
+        inverse(a.data(), inv.data(), singular.data(), count);
+        inverse_array(soa.data(), stride, soa_inv.data(), stride,
+            soa_singular.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            RefMat ref_a = test_simd_cast<RefMat>(a[i]);
+            RefMat ref_inv = Math::Inverse(ref_a);
+            test_simd_check<T>(det[i], Math::Determinant(ref_a));
+            test_simd_check<T>(inv[i], ref_inv);
+            REQUIRE(soa_det[i] == det[i]);
+            REQUIRE(singular[i] == (i % 5 == 4 ? 1 : 0));
+            REQUIRE(soa_singular[i] == singular[i]);
+            for (size_t k = 0; k < length; ++k) {
+                REQUIRE(soa_inv[k * stride + i] == inv[i].data[k]);
+            }
+        }
+    }
+}
+
+#endif // TEST_MATH_DISPATCH_H_
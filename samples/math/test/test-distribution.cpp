@@ -0,0 +1,36 @@
+//
+// test-distribution.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-distribution.h"
+
+///
+/// @brief Distribution test client. Verify the bulk samplers in the calling
+/// thread and over the thread pool.
+///
+TEST_CASE("Distribution") {
+    const size_t count = 1 << 18;
+
+    SECTION("Serial") {
+        test_distribution_run<float>(count);
+        test_distribution_run<double>(count);
+        test_distribution_bounded_run(count);
+        test_distribution_prime_run(count / 64);
+    }
+
+    SECTION("Parallel") {
+        Base::ThreadPool::Initialize(4);
+        test_distribution_run<float>(count);
+        test_distribution_run<double>(count);
+        test_distribution_bounded_run(count);
+        test_distribution_prime_run(count / 64);
+        Base::ThreadPool::Terminate();
+        REQUIRE(Base::ThreadPool::GetNumThreads() == 0);
+    }
+}
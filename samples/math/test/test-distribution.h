@@ -0,0 +1,303 @@
+//
+// test-distribution.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_DISTRIBUTION_H_
+#define TEST_MATH_DISTRIBUTION_H_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Return the Kolmogorov-Smirnov statistic of the samples against the
+/// cumulative distribution function cdf.
+///
+template<typename T, typename Cdf>
+double test_distribution_ks(std::vector<T> samples, const Cdf &cdf)
+{
+    std::sort(samples.begin(), samples.end());
+    const double n = (double) samples.size();
+    double d = 0.0;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        double f = cdf((double) samples[i]);
+        d = std::max(d, std::max(f - i / n, (i + 1) / n - f));
+    }
+    return d;
+}
+
+///
+/// @brief Verify that a sampler fills the same items for any offset and
+/// length of the array. The whole array is sampled in one call, in parallel
+/// if the thread pool is running, and compared with pieces sampled in the
+/// calling thread.
+///
+template<typename T, typename Fill>
+void test_distribution_offsets(const size_t count, const Fill &fill)
+{
+    std::vector<T> all(count);
+    fill(0, all.data(), count);
+
+    const size_t pieces[] = {1, 1000, 1024, 3000};
+    size_t first = 0;
+    for (size_t k = 0; first < count; ++k) {
+        size_t n = std::min(pieces[k % 4], count - first);
+        std::vector<T> part(n);
+        fill(first, part.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            REQUIRE(part[i] == all[first + i]);
+        }
+        first += n;
+    }
+}
+
+///
+/// @brief Distribution test client. Check the moments and the distribution
+/// functions of the samplers of type T against their exact values.
+///
+template<typename T>
+void test_distribution_run(const size_t count)
+{
+    using Vec2 = Math::Vec2<T>;
+    using Vec3 = Math::Vec3<T>;
+
+    const double ks_max = 1.63 / std::sqrt((double) count);
+    const double tol = 8.0 / std::sqrt((double) count);
+
+    // Normal deviates.
+    {
+        Math::RandomStream stream = Math::CreateRandomStream(1, 2);
+        std::vector<T> x(count);
+        Math::RandomNormal(stream, 0, x.data(), count);
+
+        double mean = 0.0, var = 0.0;
+        for (auto &v : x) {
+            mean += v;
+            var += v * v;
+        }
+        mean /= count;
+        var = var / count - mean * mean;
+        REQUIRE(std::fabs(mean) < tol);
+        REQUIRE(std::fabs(var - 1.0) < 2.0 * tol);
+        REQUIRE(test_distribution_ks(x, [] (double v) {
+            return 0.5 * std::erfc(-v / std::sqrt(2.0));
+        }) < ks_max);
+
+        std::vector<T> y(count);
+        Math::RandomNormal(stream, 0, y.data(), count, (T) 3, (T) 2);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(std::fabs(y[i] - ((T) 3 + (T) 2 * x[i])) <=
+                std::numeric_limits<T>::epsilon() * 8 * (1 + std::fabs(y[i])));
+        }
+
+        test_distribution_offsets<T>(count, [&] (
+            uint64_t first, T *dst, size_t n) {
+            Math::RandomNormal(stream, first, dst, n);
+        });
+    }
+
+    // Exponential deviates.
+    {
+        Math::RandomStream stream = Math::CreateRandomStream(
+            3, 4, Math::kRandomThreefry);
+        std::vector<T> x(count);
+        Math::RandomExponential(stream, 0, x.data(), count);
+
+        double mean = 0.0;
+        for (auto &v : x) {
+            REQUIRE(v >= (T) 0);
+            mean += v;
+        }
+        mean /= count;
+        REQUIRE(std::fabs(mean - 1.0) < tol);
+        REQUIRE(test_distribution_ks(x, [] (double v) {
+            return 1.0 - std::exp(-v);
+        }) < ks_max);
+
+        test_distribution_offsets<T>(count, [&] (
+            uint64_t first, T *dst, size_t n) {
+            Math::RandomExponential(stream, first, dst, n, (T) 2);
+        });
+    }
+
+    // Points on the sphere, with uniform z and azimuth.
+    {
+        Math::RandomStream stream = Math::CreateRandomStream(5, 6);
+        std::vector<Vec3> p(count);
+        Math::RandomSphere(stream, 0, p.data(), count);
+
+        std::vector<T> z(count), phi(count);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(std::fabs(Math::Norm(p[i]) - (T) 1) <
+                std::numeric_limits<T>::epsilon() * 16);
+            z[i] = p[i][2];
+            phi[i] = std::atan2(p[i][1], p[i][0]);
+        }
+        REQUIRE(test_distribution_ks(z, [] (double v) {
+            return 0.5 * (v + 1.0);
+        }) < ks_max);
+        REQUIRE(test_distribution_ks(phi, [] (double v) {
+            return 0.5 + 0.5 * v / M_PI;
+        }) < ks_max);
+    }
+
+    // Points in the disk, with radius^2 and azimuth uniform.
+    {
+        Math::RandomStream stream = Math::CreateRandomStream(7, 8);
+        std::vector<Vec2> p(count);
+        Math::RandomDisk(stream, 0, p.data(), count);
+
+        std::vector<T> r2(count), phi(count);
+        for (size_t i = 0; i < count; ++i) {
+            r2[i] = Math::Dot(p[i], p[i]);
+            phi[i] = std::atan2(p[i][1], p[i][0]);
+            REQUIRE(r2[i] < (T) 1 + std::numeric_limits<T>::epsilon() * 4);
+        }
+        REQUIRE(test_distribution_ks(r2, [] (double v) {
+            return v;
+        }) < ks_max);
+        REQUIRE(test_distribution_ks(phi, [] (double v) {
+            return 0.5 + 0.5 * v / M_PI;
+        }) < ks_max);
+    }
+
+    // The last items of the samplers, 2^32 chunks of 1024 items, and the
+    // ranges past them throw.
+    {
+        const uint64_t end = (uint64_t) 1 << 42;
+        const size_t n = 2048;
+        Math::RandomStream stream = Math::CreateRandomStream(9, 10);
+        std::vector<T> x(n), y(1);
+        Math::RandomNormal(stream, end - n, x.data(), n);
+        Math::RandomNormal(stream, end - 1, y.data(), 1);
+        REQUIRE(y[0] == x[n - 1]);
+
+        REQUIRE_THROWS(Math::RandomNormal(stream, end - 1, x.data(), 2));
+        REQUIRE_THROWS(Math::RandomExponential(stream, end, x.data(), 1));
+        REQUIRE_THROWS(Math::RandomExponential(
+            stream, UINT64_MAX, x.data(), 2));
+    }
+}
+
+///
+/// @brief Bounded integers test client. Check the bounds, the uniformity of a
+/// small range with a chi-square statistic, and a range above 2^31, where a
+/// floating point multiplication would be biased.
+///
+inline void test_distribution_bounded_run(const size_t count)
+{
+    Math::RandomStream stream = Math::CreateRandomStream(9, 10);
+
+    // Small range, chi-square of 5 degrees of freedom below its 0.1% level.
+    {
+        const uint32_t range = 6;
+        std::vector<uint32_t> x(count);
+        Math::RandomBounded(stream, 0, x.data(), count, range);
+
+        double hist[range] = {};
+        for (auto &v : x) {
+            REQUIRE(v < range);
+            hist[v] += 1.0;
+        }
+        double expected = (double) count / range;
+        double chi2 = 0.0;
+        for (auto &h : hist) {
+            chi2 += (h - expected) * (h - expected) / expected;
+        }
+        REQUIRE(chi2 < 20.52);
+
+        test_distribution_offsets<uint32_t>(count, [&] (
+            uint64_t first, uint32_t *dst, size_t n) {
+            Math::RandomBounded(stream, first, dst, n, range);
+        });
+    }
+
+    // Large ranges, the values are below the range and their mean is the
+    // centre of the range.
+    {
+        const uint32_t range = (1U << 31) + (1U << 30);
+        std::vector<uint32_t> x(count);
+        Math::RandomBounded(stream, 0, x.data(), count, range);
+        double mean = 0.0;
+        for (auto &v : x) {
+            REQUIRE(v < range);
+            mean += (double) v / range;
+        }
+        REQUIRE(std::fabs(mean / count - 0.5) < 4.0 / std::sqrt(count));
+    }
+
+    {
+        const uint64_t range = 1000000000000000003ULL;
+        std::vector<uint64_t> x(count);
+        Math::RandomBounded(stream, 0, x.data(), count, range);
+        double mean = 0.0;
+        for (auto &v : x) {
+            REQUIRE(v < range);
+            mean += (double) v / range;
+        }
+        REQUIRE(std::fabs(mean / count - 0.5) < 4.0 / std::sqrt(count));
+
+        test_distribution_offsets<uint64_t>(count, [&] (
+            uint64_t first, uint64_t *dst, size_t n) {
+            Math::RandomBounded(stream, first, dst, n, range);
+        });
+    }
+
+    // A zero range is the full range, the numbers of the stream.
+    {
+        std::vector<uint64_t> x(count), y(count);
+        Math::RandomBounded(stream, 0, x.data(), count, (uint64_t) 0);
+        Math::RandomFill(stream, 0, y.data(), count);
+        REQUIRE(x == y);
+    }
+
+    // Scalar samplers of the random engine.
+    {
+        Math::RandomEngine eng = Math::CreateRandomEngine();
+        Math::RandomUniform<int32_t> irand;
+        Math::RandomUniform<uint64_t> urand;
+        Math::RandomUniform<double> drand;
+        for (size_t i = 0; i < count; ++i) {
+            int32_t a = irand(eng, -3, 3);
+            REQUIRE(a >= -3);
+            REQUIRE(a <= 3);
+            REQUIRE(urand(eng, 10, 10) == 10);
+            double d = drand(eng);
+            REQUIRE(d >= 0.0);
+            REQUIRE(d < 1.0);
+        }
+    }
+}
+
+///
+/// @brief Random primes test client. Item i is the largest prime smaller than
+/// or equal to the 64-bit number i of the stream.
+///
+inline void test_distribution_prime_run(const size_t count)
+{
+    Math::RandomStream stream = Math::CreateRandomStream(11, 12);
+    std::vector<uint64_t> x(count);
+    Math::RandomPrime(stream, 0, x.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t number = Math::Random64(stream, i);
+        REQUIRE(x[i] <= number);
+        REQUIRE(Math::IsPrime(x[i]));
+        REQUIRE(Math::PrevPrime(number) == x[i]);
+    }
+
+    test_distribution_offsets<uint64_t>(count, [&] (
+        uint64_t first, uint64_t *dst, size_t n) {
+        Math::RandomPrime(stream, first, dst, n);
+    });
+}
+
+#endif // TEST_MATH_DISTRIBUTION_H_
@@ -0,0 +1,37 @@
+//
+// test-expr.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-expr.h"
+
+///
+/// @brief Expression templates test client. Verify the fused evaluation over
+/// arrays with partial packets and blocks, in the calling thread and over the
+/// thread pool.
+///
+TEST_CASE("Expr") {
+    const size_t counts[] = {0, 1, 7, 33, 4099, 70001};
+
+    SECTION("Serial") {
+        for (auto count : counts) {
+            test_expr_run<float>(count);
+            test_expr_run<double>(count);
+        }
+    }
+
+    SECTION("Parallel") {
+        Base::ThreadPool::Initialize(4);
+        for (auto count : counts) {
+            test_expr_run<float>(count);
+            test_expr_run<double>(count);
+        }
+        Base::ThreadPool::Terminate();
+        REQUIRE(Base::ThreadPool::GetNumThreads() == 0);
+    }
+}
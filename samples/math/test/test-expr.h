@@ -0,0 +1,104 @@
+//
+// test-expr.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_EXPR_H_
+#define TEST_MATH_EXPR_H_
+
+#include <stdexcept>
+#include <vector>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+#include "test-simd.h"
+
+///
+/// @brief Expression templates test client. Evaluate fused expressions of
+/// random vector and scalar arrays into spans, and compare each item with the
+/// long double reference of the same expression.
+///
+template<typename T>
+void test_expr_run(const size_t count)
+{
+    using Vec3 = Math::Vec3<T>;
+    using RefVec3 = Math::Vec3<long double>;
+    using Math::Expr::MakeSpan;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_real_distribution<T> dist_pos(1.0, 2.0);
+
+    std::vector<Vec3, Base::Allocator<Vec3>> x(count), v(count), a(count);
+    std::vector<T, Base::Allocator<T>> m(count);
+    for (size_t i = 0; i < count; ++i) {
+        x[i] = {dist(rng), dist(rng), dist(rng)};
+        v[i] = {dist(rng), dist(rng), dist(rng)};
+        a[i] = {dist(rng), dist(rng), dist(rng)};
+        m[i] = dist_pos(rng);
+    }
+    const T dt = (T) 0.01;
+    const Vec3 g{(T) 0, (T) -9.81, (T) 0};
+    const std::vector<Vec3, Base::Allocator<Vec3>> x0(x), v0(v);
+
+    auto sx = MakeSpan(x);
+    auto sv = MakeSpan(v);
+    auto sa = MakeSpan(a);
+    auto sm = MakeSpan(m);
+
+    // Test the fused update of the positions and velocities.
+    sx += dt * sv + ((T) 0.5 * dt * dt) * sa;
+    sv += (sa / sm + g) * dt;
+    for (size_t i = 0; i < count; ++i) {
+        RefVec3 ref_x = test_simd_cast<RefVec3>(x0[i]);
+        RefVec3 ref_v = test_simd_cast<RefVec3>(v0[i]);
+        RefVec3 ref_a = test_simd_cast<RefVec3>(a[i]);
+        long double ref_m = m[i];
+        long double ref_dt = dt;
+        RefVec3 ref_g = test_simd_cast<RefVec3>(g);
+        test_simd_check<T>(
+            x[i], ref_x + ref_dt * ref_v + (0.5L * ref_dt * ref_dt) * ref_a);
+        test_simd_check<T>(v[i], ref_v + (ref_a / ref_m + ref_g) * ref_dt);
+    }
+
+    // Test the element-wise functions and the scalar expressions.
+    std::vector<Vec3, Base::Allocator<Vec3>> out(count);
+    std::vector<T, Base::Allocator<T>> out_s(count);
+    auto so = MakeSpan(out);
+    auto ss = MakeSpan(out_s);
+    so = Math::Expr::Cross(MakeSpan(x0), sa) - Math::Expr::Abs(-sv);
+    ss = Math::Expr::Sqrt(Math::Expr::Dot(sa, sa)) * sm;
+    for (size_t i = 0; i < count; ++i) {
+        RefVec3 ref_x = test_simd_cast<RefVec3>(x0[i]);
+        RefVec3 ref_v = test_simd_cast<RefVec3>(v[i]);
+        RefVec3 ref_a = test_simd_cast<RefVec3>(a[i]);
+        test_simd_check<T>(
+            out[i], Math::Cross(ref_x, ref_a) - Math::Abs(ref_v));
+        test_simd_check<T>(out_s[i], Math::Norm(ref_a) * m[i]);
+    }
+
+    so = Math::Expr::Min(sa, sv) + Math::Expr::Max(sa, sv);
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(out[i], test_simd_cast<RefVec3>(a[i]) +
+            test_simd_cast<RefVec3>(v[i]));
+    }
+
+    // Test the assignment of a span, which copies the items.
+    so = sa;
+    so *= (T) 2;
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(out[i], test_simd_cast<RefVec3>(a[i]) * 2.0L);
+    }
+
+    // Test the arrays of different sizes.
+    auto sp = Math::Expr::MakeSpan(out.data(), count + 1);
+    REQUIRE_THROWS_AS(sx + sp, std::runtime_error);
+    REQUIRE_THROWS_AS(sp = sx * dt, std::runtime_error);
+}
+
+#endif // TEST_MATH_EXPR_H_
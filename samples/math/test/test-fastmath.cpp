@@ -0,0 +1,44 @@
+//
+// test-fastmath.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-fastmath.h"
+
+///
+/// @brief Fast math test client. Verify the error bounds of both accuracy
+/// tiers over arrays with partial packets and blocks, in the calling thread
+/// and over the thread pool, and the special values of the packet functions.
+///
+TEST_CASE("Fastmath") {
+    const size_t counts[] = {0, 1, 7, 33, 4099, 70001};
+
+    SECTION("Serial") {
+        for (auto count : counts) {
+            test_fastmath_run<float>(count);
+            test_fastmath_run<double>(count);
+        }
+    }
+
+    SECTION("Parallel") {
+        Base::ThreadPool::Initialize(4);
+        for (auto count : counts) {
+            test_fastmath_run<float>(count);
+            test_fastmath_run<double>(count);
+        }
+        Base::ThreadPool::Terminate();
+        REQUIRE(Base::ThreadPool::GetNumThreads() == 0);
+    }
+
+    SECTION("Special") {
+        test_fastmath_special<float>(Math::kAccuracyPrecise);
+        test_fastmath_special<float>(Math::kAccuracyFast);
+        test_fastmath_special<double>(Math::kAccuracyPrecise);
+        test_fastmath_special<double>(Math::kAccuracyFast);
+    }
+}
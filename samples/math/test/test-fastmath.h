@@ -0,0 +1,209 @@
+//
+// test-fastmath.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_FASTMATH_H_
+#define TEST_MATH_FASTMATH_H_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+
+enum {
+    kTestFastmathRsqrt = 0,
+    kTestFastmathExp,
+    kTestFastmathLog,
+    kTestFastmathSinCos,
+    kTestFastmathAtan2
+};
+
+///
+/// @brief Return the error bound of a function of type T, as documented in
+/// fastmath.h. The precise bounds are in ulp, the fast bounds are relative for
+/// Rsqrt and Exp and absolute for Log, SinCos and Atan2.
+///
+template<typename T>
+long double test_fastmath_bound(
+    const Math::Accuracy accuracy,
+    const int function)
+{
+    static const long double precise_float[] = {2, 1, 1, 2, 3};
+    static const long double precise_double[] = {2, 1, 1, 2, 2};
+    static const int fast_float[] = {-21, -18, -14, -14, -15};
+    static const int fast_double[] = {-44, -29, -29, -28, -26};
+
+    const bool is_double = std::is_same<T, double>::value;
+    if (accuracy == Math::kAccuracyPrecise) {
+        return is_double ? precise_double[function] : precise_float[function];
+    }
+    return std::ldexp(1.0L,
+        is_double ? fast_double[function] : fast_float[function]);
+}
+
+///
+/// @brief Return the error of a value with respect to the reference value, in
+/// ulp of the reference for the precise tier, and relative or absolute for
+/// the fast tier.
+///
+template<typename T>
+long double test_fastmath_error(
+    const T value,
+    const long double ref,
+    const Math::Accuracy accuracy,
+    const int function)
+{
+    long double error = std::fabs(value - ref);
+    if (accuracy == Math::kAccuracyPrecise) {
+        T r = std::fabs((T) ref);
+        T ulp = std::nextafter(r, std::numeric_limits<T>::infinity()) - r;
+        return error / ulp;
+    }
+    if (function == kTestFastmathRsqrt || function == kTestFastmathExp) {
+        return error / std::fabs(ref);
+    }
+    return error;
+}
+
+///
+/// @brief Check the maximum error of the values with respect to the reference
+/// values against the error bound of the function.
+///
+template<typename T>
+void test_fastmath_check(
+    const std::vector<T, Base::Allocator<T>> &values,
+    const std::vector<long double> &refs,
+    const Math::Accuracy accuracy,
+    const int function)
+{
+    long double max_error = 0.0L;
+    for (size_t i = 0; i < values.size(); ++i) {
+        max_error = std::max(max_error,
+            test_fastmath_error<T>(values[i], refs[i], accuracy, function));
+    }
+
+    REQUIRE(max_error <= test_fastmath_bound<T>(accuracy, function));
+}
+
+///
+/// @brief Fast math test client. Evaluate the batch elementary functions of
+/// random arrays for both accuracy tiers, and compare them with the long
+/// double std functions.
+///
+template<typename T>
+void test_fastmath_run(const size_t count)
+{
+    using Array = std::vector<T, Base::Allocator<T>>;
+    const bool is_double = std::is_same<T, double>::value;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist_rsqrt(-60.0, 60.0);
+    std::uniform_real_distribution<T> dist_exp(
+        is_double ? -708.0 : -87.0, is_double ? 709.0 : 88.0);
+    std::uniform_real_distribution<T> dist_log(
+        is_double ? -1070.0 : -148.0, is_double ? 1023.0 : 127.0);
+    std::uniform_real_distribution<T> dist_sin(-100.0, 100.0);
+    std::uniform_real_distribution<T> dist_atan(-10.0, 10.0);
+
+    Array a(count), b(count), c(count), d(count), y(count), x(count);
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = std::exp2(dist_rsqrt(rng));
+        b[i] = dist_exp(rng);
+        c[i] = std::exp2(dist_log(rng));
+        d[i] = dist_sin(rng);
+        y[i] = dist_atan(rng);
+        x[i] = dist_atan(rng);
+    }
+
+    std::vector<long double> ref_rsqrt(count), ref_exp(count), ref_log(count);
+    std::vector<long double> ref_sin(count), ref_cos(count), ref_atan(count);
+    for (size_t i = 0; i < count; ++i) {
+        ref_rsqrt[i] = 1.0L / std::sqrt((long double) a[i]);
+        ref_exp[i] = std::exp((long double) b[i]);
+        ref_log[i] = std::log((long double) c[i]);
+        ref_sin[i] = std::sin((long double) d[i]);
+        ref_cos[i] = std::cos((long double) d[i]);
+        ref_atan[i] = std::atan2((long double) y[i], (long double) x[i]);
+    }
+
+    const Math::Accuracy tiers[] = {
+        Math::kAccuracyPrecise, Math::kAccuracyFast};
+    for (auto accuracy : tiers) {
+        Array out(count), sin(count), cos(count);
+
+        Math::Batch::Rsqrt(a.data(), out.data(), count, accuracy);
+        test_fastmath_check(out, ref_rsqrt, accuracy, kTestFastmathRsqrt);
+
+        Math::Batch::Exp(b.data(), out.data(), count, accuracy);
+        test_fastmath_check(out, ref_exp, accuracy, kTestFastmathExp);
+
+        Math::Batch::Log(c.data(), out.data(), count, accuracy);
+        test_fastmath_check(out, ref_log, accuracy, kTestFastmathLog);
+
+        Math::Batch::SinCos(
+            d.data(), sin.data(), cos.data(), count, accuracy);
+        test_fastmath_check(sin, ref_sin, accuracy, kTestFastmathSinCos);
+        test_fastmath_check(cos, ref_cos, accuracy, kTestFastmathSinCos);
+
+        Math::Batch::Atan2(y.data(), x.data(), out.data(), count, accuracy);
+        test_fastmath_check(out, ref_atan, accuracy, kTestFastmathAtan2);
+    }
+}
+
+///
+/// @brief Fast math special values test client. Verify the results of the
+/// packet functions outside their domain and at the signed zeros.
+///
+template<typename T>
+void test_fastmath_special(const Math::Accuracy accuracy)
+{
+    const size_t N = 32 / sizeof(T);
+
+    const T inf = std::numeric_limits<T>::infinity();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    const T pi = (T) 3.14159265358979323846;
+
+    Math::Packet<T,N> u = Math::Broadcast<T,N>(inf);
+    REQUIRE(Math::Exp(u, accuracy).data[0] == inf);
+    REQUIRE(Math::Exp(-u, accuracy).data[0] == (T) 0);
+    REQUIRE(Math::Log(u, accuracy).data[0] == inf);
+
+    u = Math::Broadcast<T,N>((T) 1000);
+    REQUIRE(Math::Exp(u, accuracy).data[0] == inf);
+    REQUIRE(Math::Exp(-u, accuracy).data[0] == (T) 0);
+
+    u = Math::Broadcast<T,N>(nan);
+    REQUIRE(std::isnan(Math::Exp(u, accuracy).data[0]));
+    REQUIRE(std::isnan(Math::Log(u, accuracy).data[0]));
+
+    u = Math::Broadcast<T,N>((T) 0);
+    REQUIRE(Math::Exp(u, accuracy).data[0] == (T) 1);
+    REQUIRE(Math::Log(u, accuracy).data[0] == -inf);
+    REQUIRE(std::isnan(Math::Log(u - (T) 1, accuracy).data[0]));
+
+    u = Math::Broadcast<T,N>((T) 1);
+    REQUIRE(Math::Log(u, accuracy).data[0] == (T) 0);
+    REQUIRE(Math::Log(u * std::numeric_limits<T>::denorm_min(),
+        accuracy).data[0] < (T) 0);
+
+    Math::Packet<T,N> zero = Math::Broadcast<T,N>((T) 0);
+    Math::Packet<T,N> one = Math::Broadcast<T,N>((T) 1);
+    REQUIRE(Math::Atan2(zero, one, accuracy).data[0] == (T) 0);
+    REQUIRE(Math::Atan2(zero, zero, accuracy).data[0] == (T) 0);
+    REQUIRE(Math::Atan2(zero, -one, accuracy).data[0] == pi);
+    REQUIRE(Math::Atan2(-zero, -one, accuracy).data[0] == -pi);
+    REQUIRE(Math::Atan2(one, zero, accuracy).data[0] == pi / (T) 2);
+    REQUIRE(Math::Atan2(-one, zero, accuracy).data[0] == -pi / (T) 2);
+}
+
+#endif // TEST_MATH_FASTMATH_H_
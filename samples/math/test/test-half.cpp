@@ -0,0 +1,32 @@
+//
+// test-half.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-half.h"
+
+///
+/// @brief Half test client. Verify the scalar conversions, the conversion
+/// kernels of every instruction set level supported by the cpu and the packed
+/// half vector conversions.
+///
+TEST_CASE("Half") {
+    const size_t n_iters = 1024;
+
+    test_half_scalar_run();
+
+    for (uint32_t isa = Math::kIsaScalar; isa <= Math::GetMaxIsa(); ++isa) {
+        INFO("isa " << Math::GetIsaName(isa));
+        test_half_kernels_run(Math::GetKernels(isa), n_iters);
+    }
+
+    const size_t counts[] = {0, 1, 7, 8, 33, 4099};
+    for (auto count : counts) {
+        test_half_packed_run(count);
+    }
+}
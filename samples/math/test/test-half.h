@@ -0,0 +1,166 @@
+//
+// test-half.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_HALF_H_
+#define TEST_MATH_HALF_H_
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Return the bits of a float.
+///
+inline uint32_t test_half_bits(const float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+///
+/// @brief Half scalar test client. Convert every half to float and back, and
+/// verify the rounding of the float values at the edges of the half range.
+///
+inline void test_half_scalar_run()
+{
+    for (uint32_t bits = 0; bits <= 0xffff; ++bits) {
+        Math::Half h;
+        h.bits = static_cast<uint16_t>(bits);
+        float value = static_cast<float>(h);
+        if (std::isnan(value)) {
+            REQUIRE(Math::Half(value).bits == (bits | 0x200));
+        } else {
+            REQUIRE(Math::Half(value).bits == bits);
+        }
+    }
+
+    REQUIRE(Math::Half(1.0f).bits == 0x3c00);
+    REQUIRE(Math::Half(-2.0f).bits == 0xc000);
+    REQUIRE(Math::Half(65504.0f).bits == 0x7bff);
+    REQUIRE(Math::Half(65519.0f).bits == 0x7bff);
+    REQUIRE(Math::Half(65520.0f).bits == 0x7c00);
+    REQUIRE(Math::Half(1.0e10f).bits == 0x7c00);
+    REQUIRE(Math::Half(std::ldexp(1.0f, -24)).bits == 0x0001);
+    REQUIRE(Math::Half(std::ldexp(1.0f, -25)).bits == 0x0000);
+    REQUIRE(Math::Half(std::ldexp(3.0f, -26)).bits == 0x0001);
+    REQUIRE(Math::Half(std::ldexp(3.0f, -25)).bits == 0x0002);
+    REQUIRE(Math::Half(1.0f + std::ldexp(1.0f, -11)).bits == 0x3c00);
+    REQUIRE(Math::Half(1.0f + std::ldexp(3.0f, -11)).bits == 0x3c02);
+
+    REQUIRE(Math::BFloat16(1.0f).bits == 0x3f80);
+    REQUIRE(Math::BFloat16(-2.0f).bits == 0xc000);
+    REQUIRE(Math::BFloat16(1.0f + std::ldexp(1.0f, -8)).bits == 0x3f80);
+    REQUIRE(Math::BFloat16(1.0f + std::ldexp(3.0f, -8)).bits == 0x3f82);
+    REQUIRE(Math::BFloat16(INFINITY).bits == 0x7f80);
+    REQUIRE(std::isnan(static_cast<float>(Math::BFloat16(NAN))));
+    REQUIRE(static_cast<float>(Math::BFloat16(3.0e38f)) > 2.9e38f);
+}
+
+///
+/// @brief Half kernels test client. Convert arrays of random float bits, which
+/// include denormals, infinities and NaNs, with the kernels of the specified
+/// instruction set level and compare them bit by bit with the scalar
+/// conversions.
+///
+inline void test_half_kernels_run(
+    const Math::Kernels &kernels,
+    const size_t n_iters)
+{
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_int_distribution<uint32_t> dist_bits;
+    std::uniform_real_distribution<float> dist(-70000.0f, 70000.0f);
+    std::uniform_int_distribution<size_t> dist_count(0, 67);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        const size_t count = dist_count(rng);
+
+        std::vector<float> src(count), dst(count);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t bits = dist_bits(rng);
+            std::memcpy(&src[i], &bits, sizeof(bits));
+            if (i % 2 == 0) {
+                src[i] = dist(rng);
+            }
+        }
+
+        std::vector<Math::Half> h(count);
+        kernels.convertToHalf(src.data(), h.data(), count);
+        kernels.convertFromHalf(h.data(), dst.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(h[i].bits == Math::FloatToHalfBits(src[i]));
+            REQUIRE(test_half_bits(dst[i]) ==
+                test_half_bits(Math::HalfBitsToFloat(h[i].bits)));
+        }
+
+        std::vector<Math::BFloat16> b(count);
+        kernels.convertToBFloat16(src.data(), b.data(), count);
+        kernels.convertFromBFloat16(b.data(), dst.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(b[i].bits == Math::FloatToBFloat16Bits(src[i]));
+            REQUIRE(test_half_bits(dst[i]) == (uint32_t) b[i].bits << 16);
+        }
+    }
+
+    // Convert every half to float.
+    std::vector<Math::Half> h(65536);
+    std::vector<float> dst(65536);
+    for (size_t i = 0; i < h.size(); ++i) {
+        h[i].bits = static_cast<uint16_t>(i);
+    }
+    kernels.convertFromHalf(h.data(), dst.data(), h.size());
+    for (size_t i = 0; i < h.size(); ++i) {
+        REQUIRE(test_half_bits(dst[i]) ==
+            test_half_bits(Math::HalfBitsToFloat(h[i].bits)));
+    }
+}
+
+///
+/// @brief Packed half vector test client. Convert arrays of packed float
+/// vectors to packed half and bfloat16 vectors, and back, and compare them
+/// with the original vectors within the precision of the 16-bit types.
+///
+inline void test_half_packed_run(const size_t count)
+{
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+
+    std::vector<Math::PackedVec3f> src(count), dst(count);
+    for (auto &it : src) {
+        it = {dist(rng), dist(rng), dist(rng)};
+    }
+
+    std::vector<Math::PackedVec3h> h(count);
+    Math::Convert(src.data(), h.data(), count);
+    Math::Convert(h.data(), dst.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            REQUIRE(std::fabs(dst[i][k] - src[i][k]) <=
+                std::ldexp(std::fabs(src[i][k]), -11));
+        }
+    }
+
+    std::vector<Math::PackedVec3bf> b(count);
+    Math::Convert(src.data(), b.data(), count);
+    Math::Convert(b.data(), dst.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            REQUIRE(std::fabs(dst[i][k] - src[i][k]) <=
+                std::ldexp(std::fabs(src[i][k]), -8));
+        }
+    }
+}
+
+#endif // TEST_MATH_HALF_H_
@@ -0,0 +1,28 @@
+//
+// test-integer.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-integer.h"
+
+///
+/// @brief Integer vector test client. Verify the signed and unsigned 32-bit
+/// integer vector specializations and the generic 64-bit templates.
+///
+TEST_CASE("Integer") {
+    const size_t n_iters = 65536;
+
+    test_integer_run<int32_t, Math::Vec2>(n_iters);
+    test_integer_run<int32_t, Math::Vec3>(n_iters);
+    test_integer_run<int32_t, Math::Vec4>(n_iters);
+    test_integer_run<uint32_t, Math::Vec2>(n_iters);
+    test_integer_run<uint32_t, Math::Vec3>(n_iters);
+    test_integer_run<uint32_t, Math::Vec4>(n_iters);
+    test_integer_run<int64_t, Math::Vec3>(n_iters);
+    test_integer_run<uint64_t, Math::Vec3>(n_iters);
+}
@@ -0,0 +1,119 @@
+//
+// test-integer.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_INTEGER_H_
+#define TEST_MATH_INTEGER_H_
+
+#include <random>
+#include <type_traits>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Return a random integer vector. Signed elements are small enough
+/// that the products of two elements do not overflow. Some elements of b are
+/// copied from a, so that the comparisons also find equal elements.
+///
+template<typename T, template<typename> class V>
+void test_integer_random(std::mt19937 &rng, V<T> &a, V<T> &b)
+{
+    using Dist = std::uniform_int_distribution<T>;
+    Dist dist = std::is_signed<T>::value ? Dist((T) -30000, (T) 30000)
+                                         : Dist();
+    for (size_t k = 0; k < V<T>::length; ++k) {
+        a[k] = dist(rng);
+        b[k] = (rng() % 4 == 0) ? a[k] : dist(rng);
+    }
+}
+
+///
+/// @brief Compare the absolute value of a signed integer vector with the
+/// element-wise scalar absolute value. Unsigned vectors have none.
+///
+template<typename T, template<typename> class V>
+void test_integer_abs(const V<T> &a, std::true_type)
+{
+    V<T> abs = Math::Abs(a);
+    for (size_t k = 0; k < V<T>::length; ++k) {
+        REQUIRE(abs[k] == (a[k] < 0 ? (T) -a[k] : a[k]));
+    }
+}
+
+template<typename T, template<typename> class V>
+void test_integer_abs(const V<T> &, std::false_type) {}
+
+///
+/// @brief Integer vector test client. Compare the operators and functions of
+/// random integer vectors with the element-wise scalar operations.
+///
+template<typename T, template<typename> class V>
+void test_integer_run(const size_t n_iters)
+{
+    using U = typename std::make_unsigned<T>::type;
+    const size_t n = V<T>::length;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        V<T> a, b, c;
+        test_integer_random(rng, a, b);
+        test_integer_random(rng, c, c);
+        const T s = b[0];
+        const int count = (int) (rng() % 32);
+
+        V<T> add = a + b, sub = a - b, mul = a * b;
+        V<T> adds = a + s, subs = a - s, muls = a * s;
+        V<T> shl = a << count, shr = a >> count;
+        for (size_t k = 0; k < n; ++k) {
+            REQUIRE(add[k] == (T) (a[k] + b[k]));
+            REQUIRE(sub[k] == (T) (a[k] - b[k]));
+            REQUIRE(mul[k] == (T) (a[k] * b[k]));
+            REQUIRE(adds[k] == (T) (a[k] + s));
+            REQUIRE(subs[k] == (T) (a[k] - s));
+            REQUIRE(muls[k] == (T) (a[k] * s));
+            REQUIRE(shl[k] == (T) ((U) a[k] << count));
+            REQUIRE(shr[k] == (T) (a[k] >> count));
+        }
+
+        V<T> min = Math::Min(a, b), max = Math::Max(a, b);
+        V<T> lo = Math::Min(b, c), hi = Math::Max(b, c);
+        V<T> clamp = Math::Clamp(a, lo, hi);
+        test_integer_abs(a, std::is_signed<T>());
+        for (size_t k = 0; k < n; ++k) {
+            REQUIRE(min[k] == std::min(a[k], b[k]));
+            REQUIRE(max[k] == std::max(a[k], b[k]));
+            REQUIRE(clamp[k] == std::min(std::max(a[k], lo[k]), hi[k]));
+        }
+
+        V<T> eq = Math::Equal(a, b);
+        V<T> lt = Math::Less(a, b);
+        V<T> gt = Math::Greater(a, b);
+        V<T> sel = Math::Select(lt, a, b);
+        for (size_t k = 0; k < n; ++k) {
+            REQUIRE(eq[k] == (T) (a[k] == b[k]));
+            REQUIRE(lt[k] == (T) (a[k] < b[k]));
+            REQUIRE(gt[k] == (T) (a[k] > b[k]));
+            REQUIRE(sel[k] == std::min(a[k], b[k]));
+        }
+
+        V<T> acc = a;
+        acc += b;
+        acc *= s;
+        acc -= a;
+        acc <<= 1;
+        for (size_t k = 0; k < n; ++k) {
+            U ref = (U) (a[k] + b[k]) * (U) s - (U) a[k];
+            REQUIRE(acc[k] == (T) (ref << 1));
+        }
+    }
+}
+
+#endif // TEST_MATH_INTEGER_H_
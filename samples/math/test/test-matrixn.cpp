@@ -0,0 +1,41 @@
+//
+// test-matrixn.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-matrixn.h"
+
+///
+/// @brief Dense matrix test client. Verify the products and factorizations of
+/// matrices with partial tiles and blocks, in the calling thread and over the
+/// thread pool.
+///
+TEST_CASE("MatrixN") {
+    const size_t sizes[] = {1, 7, 33, 130, 300};
+
+    SECTION("Serial") {
+        for (auto n : sizes) {
+            test_matrixn_gemm_run<float>(n, n + 5, n + 2);
+            test_matrixn_gemm_run<double>(n, n + 5, n + 2);
+            test_matrixn_factor_run<float>(n);
+            test_matrixn_factor_run<double>(n);
+        }
+    }
+
+    SECTION("Parallel") {
+        Base::ThreadPool::Initialize(4);
+        for (auto n : sizes) {
+            test_matrixn_gemm_run<float>(n, n + 5, n + 2);
+            test_matrixn_gemm_run<double>(n, n + 5, n + 2);
+            test_matrixn_factor_run<float>(n);
+            test_matrixn_factor_run<double>(n);
+        }
+        Base::ThreadPool::Terminate();
+        REQUIRE(Base::ThreadPool::GetNumThreads() == 0);
+    }
+}
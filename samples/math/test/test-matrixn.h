@@ -0,0 +1,193 @@
+//
+// test-matrixn.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_MATRIXN_H_
+#define TEST_MATH_MATRIXN_H_
+
+#include <algorithm>
+#include <vector>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+#include "test-simd.h"
+
+///
+/// @brief Create a matrix with random elements in [-1, 1].
+///
+template<typename T>
+Math::MatrixN<T> test_matrixn_random(
+    std::mt19937 &rng,
+    const size_t rows,
+    const size_t cols)
+{
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    Math::MatrixN<T> m = Math::MatrixN<T>::Create(rows, cols);
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            m(i, j) = dist(rng);
+        }
+    }
+    return m;
+}
+
+///
+/// @brief Compare the product of a matrix and the solution of a linear system
+/// with the right hand side, at the scale of the matrix times the solution.
+///
+template<typename T>
+void test_matrixn_residual(
+    const Math::MatrixN<T> &a,
+    const Math::MatrixN<T> &x,
+    const Math::MatrixN<T> &b)
+{
+    for (size_t i = 0; i < a.rows; ++i) {
+        for (size_t j = 0; j < x.cols; ++j) {
+            long double sum = 0.0L;
+            long double scale = 0.0L;
+            for (size_t k = 0; k < a.cols; ++k) {
+                sum += (long double) a(i, k) * x(k, j);
+                scale += std::fabs((long double) a(i, k) * x(k, j));
+            }
+            long double rel = std::fabs(sum - b(i, j)) / std::max(1.0L, scale);
+            REQUIRE(test_simd_eq<T>(rel, 0.0L));
+        }
+    }
+}
+
+///
+/// @brief Matrix product test client. Multiply random matrices of m x k and
+/// k x n elements, with and without a previous product in c, and compare them
+/// with the long double reference. Multiply the first matrix by a vector and
+/// compare it with the same reference.
+///
+template<typename T>
+void test_matrixn_gemm_run(const size_t m, const size_t n, const size_t k)
+{
+    std::random_device seed;
+    std::mt19937 rng(seed());
+
+    const T alpha = (T) 0.75;
+    const T beta = (T) -0.5;
+    Math::MatrixN<T> a = test_matrixn_random<T>(rng, m, k);
+    Math::MatrixN<T> b = test_matrixn_random<T>(rng, k, n);
+    Math::MatrixN<T> c = test_matrixn_random<T>(rng, m, n);
+
+    Math::MatrixN<T> d = Math::Dot(a, b);
+    Math::MatrixN<T> e = c;
+    Math::Gemm(alpha, a, b, beta, e);
+    REQUIRE(d.rows == m);
+    REQUIRE(d.cols == n);
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            long double ref = 0.0L;
+            for (size_t p = 0; p < k; ++p) {
+                ref += (long double) a(i, p) * b(p, j);
+            }
+            test_simd_check<T>(d(i, j), ref);
+            test_simd_check<T>(e(i, j), alpha * ref + beta * c(i, j));
+        }
+        for (size_t j = n; j < d.stride; ++j) {
+            REQUIRE(d(i, j) == (T) 0);
+            REQUIRE(e(i, j) == (T) 0);
+        }
+    }
+
+    std::vector<T> x(k), y(m), z(m);
+    for (size_t p = 0; p < k; ++p) {
+        x[p] = b(p, 0);
+    }
+    for (size_t i = 0; i < m; ++i) {
+        y[i] = z[i] = c(i, 0);
+    }
+    Math::Gemv(alpha, a, x.data(), beta, y.data());
+    Math::Gemv((T) 1, a, x.data(), (T) 0, z.data());
+    for (size_t i = 0; i < m; ++i) {
+        test_simd_check<T>(y[i], (long double) e(i, 0));
+        test_simd_check<T>(z[i], (long double) d(i, 0));
+    }
+
+    Math::MatrixN<T> f = Math::MatrixN<T>::Create(m, n + 1);
+    Math::MatrixN<T> g = Math::MatrixN<T>::Create(k + 1, n);
+    REQUIRE_THROWS(Math::Gemm((T) 1, a, b, (T) 0, f));
+    REQUIRE_THROWS(Math::Dot(a, g));
+}
+
+///
+/// @brief Matrix factorization test client. Factor a random matrix, with a
+/// dominant diagonal, and a symmetric positive definite matrix, solve linear
+/// systems with a few right hand sides, and compare the residual with zero.
+/// A matrix with a zero row must be singular and an indefinite matrix must not
+/// be positive definite.
+///
+template<typename T>
+void test_matrixn_factor_run(const size_t n)
+{
+    std::random_device seed;
+    std::mt19937 rng(seed());
+
+    Math::MatrixN<T> a = test_matrixn_random<T>(rng, n, n);
+    Math::MatrixN<T> b = test_matrixn_random<T>(rng, n, 3);
+    for (size_t i = 0; i < n; ++i) {
+        a(i, i) += (T) 4;
+    }
+
+    // LU factorization.
+    {
+        Math::MatrixN<T> lu = a;
+        Math::MatrixN<T> x = b;
+        std::vector<size_t> pivots;
+        REQUIRE(Math::LuFactor(lu, pivots));
+        REQUIRE(pivots.size() == n);
+        Math::LuSolve(lu, pivots, x);
+        test_matrixn_residual(a, x, b);
+
+        if (n > 0) {
+            Math::MatrixN<T> s = a;
+            std::fill(s.Row(n / 2), s.Row(n / 2) + n, (T) 0);
+            REQUIRE(!Math::LuFactor(s, pivots));
+        }
+        Math::MatrixN<T> r = Math::MatrixN<T>::Create(n + 1, n);
+        REQUIRE_THROWS(Math::LuFactor(r, pivots));
+    }
+
+    // Cholesky factorization of a * a^t + n * i.
+    {
+        Math::MatrixN<T> at = Math::MatrixN<T>::Create(n, n);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                at(i, j) = a(j, i);
+            }
+        }
+        Math::MatrixN<T> spd = Math::Dot(a, at);
+        for (size_t i = 0; i < n; ++i) {
+            spd(i, i) += (T) n;
+        }
+
+        Math::MatrixN<T> l = spd;
+        Math::MatrixN<T> x = b;
+        REQUIRE(Math::CholeskyFactor(l));
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = i + 1; j < n; ++j) {
+                REQUIRE(l(i, j) == (T) 0);
+            }
+        }
+        Math::CholeskySolve(l, x);
+        test_matrixn_residual(spd, x, b);
+
+        if (n > 0) {
+            Math::MatrixN<T> s = spd;
+            s(n - 1, n - 1) = -s(n - 1, n - 1);
+            REQUIRE(!Math::CholeskyFactor(s));
+        }
+        Math::MatrixN<T> r = Math::MatrixN<T>::Create(n, n + 1);
+        REQUIRE_THROWS(Math::CholeskyFactor(r));
+    }
+}
+
+#endif // TEST_MATH_MATRIXN_H_
@@ -0,0 +1,26 @@
+//
+// test-packed.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-packed.h"
+
+///
+/// @brief Packed vector test client. Verify the packed vector conversions,
+/// the 256-bit packet specializations and a generic packet width.
+///
+TEST_CASE("Packed") {
+    const size_t counts[] = {0, 1, 7, 8, 33, 4099};
+
+    for (auto count : counts) {
+        test_packed_run<float, 8>(count);
+        test_packed_run<double, 4>(count);
+        test_packed_run<float, 4>(count);
+        test_packed_run<double, 2>(count);
+    }
+}
@@ -0,0 +1,110 @@
+//
+// test-packed.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_PACKED_H_
+#define TEST_MATH_PACKED_H_
+
+#include <vector>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Packed vector test client. Convert arrays of random vectors to
+/// packed vectors and back, load and store them through packets and verify
+/// the batch functions of packed arrays against those of compute arrays.
+///
+template<typename T, size_t N>
+void test_packed_run(const size_t count)
+{
+    using Vec2 = Math::Vec2<T>;
+    using Vec3 = Math::Vec3<T>;
+    using Vec4 = Math::Vec4<T>;
+    using PackedVec3 = Math::PackedVec3<T>;
+    using Vec3Packet = Math::Vec3Packet<T,N>;
+
+    REQUIRE(sizeof(Math::PackedVec2<T>) == 2 * sizeof(T));
+    REQUIRE(sizeof(Math::PackedVec3<T>) == 3 * sizeof(T));
+    REQUIRE(sizeof(Math::PackedVec4<T>) == 4 * sizeof(T));
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+
+    auto eq = [](const Vec3 &a, const Vec3 &b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    };
+
+    // Test conversions
+    std::vector<Vec2, Base::Allocator<Vec2>> v2(count), w2(count);
+    std::vector<Vec3, Base::Allocator<Vec3>> v3(count), w3(count);
+    std::vector<Vec4, Base::Allocator<Vec4>> v4(count), w4(count);
+    for (size_t i = 0; i < count; ++i) {
+        v2[i] = {dist(rng), dist(rng)};
+        v3[i] = {dist(rng), dist(rng), dist(rng)};
+        v4[i] = {dist(rng), dist(rng), dist(rng), dist(rng)};
+    }
+
+    std::vector<Math::PackedVec2<T>> p2(count);
+    std::vector<Math::PackedVec3<T>> p3(count);
+    std::vector<Math::PackedVec4<T>> p4(count);
+    Math::Pack(v2.data(), p2.data(), count);
+    Math::Pack(v3.data(), p3.data(), count);
+    Math::Pack(v4.data(), p4.data(), count);
+    Math::Unpack(p2.data(), w2.data(), count);
+    Math::Unpack(p3.data(), w3.data(), count);
+    Math::Unpack(p4.data(), w4.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        REQUIRE((p3[i].x == v3[i].x && p3[i].y == v3[i].y));
+        REQUIRE(p3[i].z == v3[i].z);
+        REQUIRE((w2[i].x == v2[i].x && w2[i].y == v2[i].y));
+        REQUIRE(eq(w3[i], v3[i]));
+        REQUIRE((w4[i].z == v4[i].z && w4[i].w == v4[i].w));
+        REQUIRE(eq(Math::Unpack(Math::Pack(v3[i])), v3[i]));
+    }
+
+    // Test packet load and store of full and partial packets
+    std::vector<PackedVec3> q3(count);
+    for (size_t i = 0; i < count; i += N) {
+        size_t n = std::min(N, count - i);
+        Vec3Packet pa, pb;
+        Math::Load(pa, &p3[i], n);
+        Math::Load(pb, &v3[i], n);
+        for (size_t k = 0; k < N; ++k) {
+            REQUIRE(eq(Math::Extract(pa, k), Math::Extract(pb, k)));
+        }
+        Math::Store(pa, &q3[i], n);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        REQUIRE(eq(Math::Unpack(q3[i]), v3[i]));
+    }
+
+    // Test batch functions of packed arrays
+    Math::Mat4<T> m = Math::Rotate(Vec3{(T) 1, (T) 2, (T) 3}, (T) 0.5);
+    m = Math::Translate(m, Vec3{(T) 1, (T) -2, (T) 3});
+
+    Math::Batch::Transform(m, v3.data(), w3.data(), count);
+    Math::Batch::Transform(m, p3.data(), q3.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        REQUIRE(eq(Math::Unpack(q3[i]), w3[i]));
+    }
+    Math::Batch::Normalize(v3.data(), w3.data(), count);
+    Math::Batch::Normalize(p3.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        REQUIRE(eq(Math::Unpack(p3[i]), w3[i]));
+    }
+
+    Vec3 lo, hi, ref_lo, ref_hi;
+    Math::Batch::Aabb(w3.data(), count, ref_lo, ref_hi);
+    Math::Batch::Aabb(p3.data(), count, lo, hi);
+    REQUIRE(eq(lo, ref_lo));
+    REQUIRE(eq(hi, ref_hi));
+}
+
+#endif // TEST_MATH_PACKED_H_
@@ -0,0 +1,32 @@
+//
+// test-packet.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-packet.h"
+
+///
+/// @brief Packet test client. Cross-check the 256-bit packet specializations
+/// and a generic packet width against the long double reference.
+///
+TEST_CASE("Packet") {
+    const size_t n_iters = 16384;
+
+    SECTION("Vec3x4d") {
+        test_packet_run<double, 4>(n_iters);
+    }
+
+    SECTION("Vec3x8f") {
+        test_packet_run<float, 8>(n_iters);
+    }
+
+    SECTION("Generic") {
+        test_packet_run<double, 2>(n_iters);
+        test_packet_run<float, 4>(n_iters);
+    }
+}
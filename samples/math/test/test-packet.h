@@ -0,0 +1,235 @@
+//
+// test-packet.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_PACKET_H_
+#define TEST_MATH_PACKET_H_
+
+#include <algorithm>
+#include <cmath>
+#include "minicore/math/math.h"
+#include "common.h"
+#include "test-simd.h"
+
+///
+/// @brief Compare each lane of a packet with the reference value of the lane.
+///
+template<typename T, size_t N, typename Fn>
+void test_packet_check(const Math::Packet<T,N> &u, Fn ref)
+{
+    for (size_t i = 0; i < N; ++i) {
+        REQUIRE(test_simd_eq<T>(u[i], ref(i)));
+    }
+}
+
+template<typename T, size_t N, typename Fn>
+void test_packet_check(const Math::Vec3Packet<T,N> &u, Fn ref)
+{
+    for (size_t i = 0; i < N; ++i) {
+        Math::Vec3<long double> r = ref(i);
+        REQUIRE(test_simd_eq<T>(u.x[i], r.x));
+        REQUIRE(test_simd_eq<T>(u.y[i], r.y));
+        REQUIRE(test_simd_eq<T>(u.z[i], r.z));
+    }
+}
+
+template<typename T, size_t N, typename Fn>
+void test_packet_check(const Math::MaskPacket<T,N> &u, Fn ref)
+{
+    for (size_t i = 0; i < N; ++i) {
+        REQUIRE(u[i] == ref(i));
+        REQUIRE((u.data[i] == 0 || ~u.data[i] == 0));
+    }
+}
+
+///
+/// @brief Packet test client. Load arrays of random vectors into packets and
+/// compare the packet operations with the long double reference of each lane.
+///
+template<typename T, size_t N>
+void test_packet_run(const size_t n_iters)
+{
+    using Vec3 = Math::Vec3<T>;
+    using Ref = Math::Vec3<long double>;
+    using Packet = Math::Packet<T,N>;
+    using Vec3Packet = Math::Vec3Packet<T,N>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_real_distribution<T> dist_pos(1.0, 2.0);
+    std::uniform_int_distribution<size_t> dist_count(0, N);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        Vec3 a[N], b[N], c[N];
+        T s[N], t[N];
+        for (size_t i = 0; i < N; ++i) {
+            a[i] = {dist(rng), dist(rng), dist(rng)};
+            b[i] = {dist(rng), dist(rng), dist(rng)};
+            c[i] = {dist_pos(rng), dist_pos(rng), dist_pos(rng)};
+            s[i] = dist_pos(rng);
+            t[i] = dist(rng);
+        }
+        // Share some lanes to exercise the equality comparisons.
+        t[0] = s[0];
+
+        Vec3Packet pa, pb, pc;
+        Packet ps, pt;
+        Math::Load(pa, a);
+        Math::Load(pb, b);
+        Math::Load(pc, c);
+        Math::Load(ps, s);
+        Math::Load(pt, t);
+
+        auto ref_a = [&](size_t i) { return test_simd_cast<Ref>(a[i]); };
+        auto ref_b = [&](size_t i) { return test_simd_cast<Ref>(b[i]); };
+        auto ref_c = [&](size_t i) { return test_simd_cast<Ref>(c[i]); };
+        auto ref_s = [&](size_t i) { return (long double) s[i]; };
+        auto ref_t = [&](size_t i) { return (long double) t[i]; };
+
+        // Test load, store and broadcast
+        test_packet_check(pa, ref_a);
+        test_packet_check(ps, ref_s);
+        test_packet_check(Math::Broadcast<T,N>(s[0]),
+            [&](size_t) { return ref_s(0); });
+        test_packet_check(Math::Broadcast<T,N>(a[0]),
+            [&](size_t) { return ref_a(0); });
+        for (size_t i = 0; i < N; ++i) {
+            Vec3 u = Math::Extract(pa, i);
+            REQUIRE((u.x == a[i].x && u.y == a[i].y && u.z == a[i].z));
+        }
+
+        {
+            size_t count = dist_count(rng);
+            Vec3Packet pv;
+            Math::Load(pv, a, count);
+            test_packet_check(pv, [&](size_t i) {
+                return i < count ? ref_a(i) : Ref::Zeros; });
+
+            Vec3 v[N];
+            std::fill(v, v + N, c[0]);
+            Math::Store(pa, v, count);
+            for (size_t i = 0; i < N; ++i) {
+                const Vec3 &w = i < count ? a[i] : c[0];
+                REQUIRE((v[i].x == w.x && v[i].y == w.y && v[i].z == w.z));
+            }
+
+            T p[N];
+            std::fill(p, p + N, (T) 0);
+            Math::Store(ps, p, count);
+            Packet pp;
+            Math::Load(pp, p, count);
+            test_packet_check(pp, [&](size_t i) {
+                return i < count ? ref_s(i) : 0.0L; });
+        }
+
+        // Test arithmetic operators
+        test_packet_check(ps + pt, [&](size_t i) { return ref_s(i) + ref_t(i); });
+        test_packet_check(ps - pt, [&](size_t i) { return ref_s(i) - ref_t(i); });
+        test_packet_check(ps * pt, [&](size_t i) { return ref_s(i) * ref_t(i); });
+        test_packet_check(pt / ps, [&](size_t i) { return ref_t(i) / ref_s(i); });
+        test_packet_check(pt + s[0], [&](size_t i) { return ref_t(i) + ref_s(0); });
+        test_packet_check(s[0] - pt, [&](size_t i) { return ref_s(0) - ref_t(i); });
+        test_packet_check(-pt, [&](size_t i) { return -ref_t(i); });
+
+        test_packet_check(pa + pb, [&](size_t i) { return ref_a(i) + ref_b(i); });
+        test_packet_check(pa - pb, [&](size_t i) { return ref_a(i) - ref_b(i); });
+        test_packet_check(pa * pb, [&](size_t i) { return ref_a(i) * ref_b(i); });
+        test_packet_check(pa / pc, [&](size_t i) { return ref_a(i) / ref_c(i); });
+        test_packet_check(pa * ps, [&](size_t i) { return ref_a(i) * ref_s(i); });
+        test_packet_check(pa / ps, [&](size_t i) { return ref_a(i) / ref_s(i); });
+        test_packet_check(pa + s[0], [&](size_t i) { return ref_a(i) + ref_s(0); });
+        test_packet_check(s[0] * pa, [&](size_t i) { return ref_s(0) * ref_a(i); });
+        test_packet_check(-pa, [&](size_t i) { return -ref_a(i); });
+
+        // Test arithmetic functions
+        test_packet_check(Math::MulAdd(ps, pt, pt), [&](size_t i) {
+            return ref_s(i) * ref_t(i) + ref_t(i); });
+        test_packet_check(Math::Sqrt(ps), [&](size_t i) {
+            return std::sqrt(ref_s(i)); });
+        test_packet_check(Math::Abs(pt), [&](size_t i) {
+            return std::fabs(ref_t(i)); });
+        test_packet_check(Math::Floor(pt * (T) 4), [&](size_t i) {
+            return std::floor(ref_t(i) * 4); });
+        test_packet_check(Math::Ceil(pt * (T) 4), [&](size_t i) {
+            return std::ceil(ref_t(i) * 4); });
+        test_packet_check(Math::Min(pt, pa.x), [&](size_t i) {
+            return std::min(ref_t(i), ref_a(i).x); });
+        test_packet_check(Math::Max(pt, pa.x), [&](size_t i) {
+            return std::max(ref_t(i), ref_a(i).x); });
+        test_packet_check(Math::Clamp(pt, pa.x, ps), [&](size_t i) {
+            return Math::Clamp(ref_t(i), ref_a(i).x, ref_s(i)); });
+        test_packet_check(Math::Lerp(pa.x, pb.x, pt), [&](size_t i) {
+            return Math::Lerp(ref_a(i).x, ref_b(i).x, ref_t(i)); });
+
+        test_packet_check(Math::Abs(pa), [&](size_t i) {
+            return Math::Abs(ref_a(i)); });
+        test_packet_check(Math::Floor(pa * (T) 4), [&](size_t i) {
+            return Math::Floor(ref_a(i) * 4.0L); });
+        test_packet_check(Math::Ceil(pa * (T) 4), [&](size_t i) {
+            return Math::Ceil(ref_a(i) * 4.0L); });
+        test_packet_check(Math::Min(pa, pb), [&](size_t i) {
+            return Math::Min(ref_a(i), ref_b(i)); });
+        test_packet_check(Math::Max(pa, pb), [&](size_t i) {
+            return Math::Max(ref_a(i), ref_b(i)); });
+        test_packet_check(Math::Clamp(pa, pb, pc), [&](size_t i) {
+            return Math::Clamp(ref_a(i), ref_b(i), ref_c(i)); });
+        test_packet_check(Math::Lerp(pa, pb, pt), [&](size_t i) {
+            return Math::Lerp(ref_a(i), ref_b(i), Ref{
+                ref_t(i), ref_t(i), ref_t(i)}); });
+
+        // Test algebra functions
+        test_packet_check(Math::Dot(pa, pb), [&](size_t i) {
+            return Math::Dot(ref_a(i), ref_b(i)); });
+        test_packet_check(Math::Norm(pc), [&](size_t i) {
+            return Math::Norm(ref_c(i)); });
+        test_packet_check(Math::Normalize(pc), [&](size_t i) {
+            return Math::Normalize(ref_c(i)); });
+        test_packet_check(Math::Distance(pa, pb), [&](size_t i) {
+            return Math::Distance(ref_a(i), ref_b(i)); });
+        test_packet_check(Math::Cross(pa, pb), [&](size_t i) {
+            return Math::Cross(ref_a(i), ref_b(i)); });
+
+        // Test compare and select functions
+        auto lt = Math::Less(pt, ps);
+        auto gt = Math::Greater(pt, pa.x);
+        test_packet_check(Math::Equal(pt, ps), [&](size_t i) {
+            return t[i] == s[i]; });
+        test_packet_check(Math::NotEqual(pt, ps), [&](size_t i) {
+            return t[i] != s[i]; });
+        test_packet_check(lt, [&](size_t i) { return t[i] < s[i]; });
+        test_packet_check(Math::LessEqual(pt, ps), [&](size_t i) {
+            return t[i] <= s[i]; });
+        test_packet_check(gt, [&](size_t i) { return t[i] > a[i].x; });
+        test_packet_check(Math::GreaterEqual(pt, ps), [&](size_t i) {
+            return t[i] >= s[i]; });
+
+        test_packet_check(lt & gt, [&](size_t i) { return lt[i] && gt[i]; });
+        test_packet_check(lt | gt, [&](size_t i) { return lt[i] || gt[i]; });
+        test_packet_check(lt ^ gt, [&](size_t i) { return lt[i] != gt[i]; });
+        test_packet_check(~gt, [&](size_t i) { return !gt[i]; });
+
+        bool any = false;
+        bool all = true;
+        for (size_t i = 0; i < N; ++i) {
+            any = any || gt[i];
+            all = all && gt[i];
+        }
+        REQUIRE(Math::Any(gt) == any);
+        REQUIRE(Math::All(gt) == all);
+        REQUIRE(!Math::Any(Math::Equal(pt, pt + (T) 8)));
+        REQUIRE(Math::All(Math::Equal(pt, pt)));
+
+        test_packet_check(Math::Select(gt, pt, ps), [&](size_t i) {
+            return gt[i] ? ref_t(i) : ref_s(i); });
+        test_packet_check(Math::Select(gt, pa, pb), [&](size_t i) {
+            return gt[i] ? ref_a(i) : ref_b(i); });
+    }
+}
+
+#endif // TEST_MATH_PACKET_H_
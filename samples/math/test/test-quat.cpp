@@ -0,0 +1,36 @@
+//
+// test-quat.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-quat.h"
+
+///
+/// @brief Quaternion test client. Verify the quaternion functions of random
+/// rotations and the batch rotation of arrays with partial packets and blocks,
+/// in the calling thread and over the thread pool.
+///
+TEST_CASE("Quat") {
+    const size_t n_iters = 4096;
+    const size_t counts[] = {0, 1, 7, 33, 4099, 70001};
+
+    test_quat_run<float>(n_iters);
+    test_quat_run<double>(n_iters);
+
+    for (auto count : counts) {
+        test_quat_batch_run<float>(count);
+        test_quat_batch_run<double>(count);
+    }
+
+    Base::ThreadPool::Initialize(4);
+    for (auto count : counts) {
+        test_quat_batch_run<float>(count);
+        test_quat_batch_run<double>(count);
+    }
+    Base::ThreadPool::Terminate();
+}
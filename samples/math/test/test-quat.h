@@ -0,0 +1,186 @@
+//
+// test-quat.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_QUAT_H_
+#define TEST_MATH_QUAT_H_
+
+#include <vector>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+#include "test-simd.h"
+
+///
+/// @brief Return the quaternion with the sign of the reference. A rotation is
+/// represented by both q and -q.
+///
+template<typename T, typename R>
+Math::Quat<T> test_quat_align(Math::Quat<T> q, const R &ref)
+{
+    long double dot = 0;
+    for (size_t j = 0; j < 4; ++j) {
+        dot += q.data[j] * ref.data[j];
+    }
+    return dot < 0 ? -q : q;
+}
+
+///
+/// @brief Quaternion test client. Compare the quaternion algebra, rotations,
+/// interpolations and conversions of random unit quaternions with the long
+/// double reference and with the rotation matrices of the same axis and angle.
+///
+template<typename T>
+void test_quat_run(const size_t n_iters)
+{
+    using Vec3 = Math::Vec3<T>;
+    using Quat = Math::Quat<T>;
+    using RefVec3 = Math::Vec3<long double>;
+    using RefVec4 = Math::Vec4<long double>;
+    using RefMat3 = Math::Mat3<long double>;
+    using RefMat4 = Math::Mat4<long double>;
+    using RefQuat = Math::Quat<long double>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_real_distribution<T> dist_angle(-M_PI, M_PI);
+    std::uniform_real_distribution<T> dist_t(0.0, 1.0);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        Vec3 n1{dist(rng), dist(rng), dist(rng)};
+        Vec3 n2{dist(rng), dist(rng), dist(rng)};
+        Vec3 v{dist(rng), dist(rng), dist(rng)};
+        T theta1 = dist_angle(rng);
+        T theta2 = dist_angle(rng);
+        T t = dist_t(rng);
+
+        Quat a = Quat::CreateFromAxisAngle(n1, theta1);
+        Quat b = Quat::CreateFromAxisAngle(n2, theta2);
+        RefQuat ref_a = test_simd_cast<RefQuat>(a);
+        RefQuat ref_b = test_simd_cast<RefQuat>(b);
+        RefVec3 ref_v = test_simd_cast<RefVec3>(v);
+
+        // Test the rotation matrix of the axis and angle.
+        RefMat4 ref_m = Math::Rotate(test_simd_cast<RefVec3>(n1),
+            (long double) theta1);
+        test_simd_check<T>(Math::ToMat4(a), ref_m);
+
+        // Test the algebra.
+        test_simd_check<T>(a * b, ref_a * ref_b);
+        test_simd_check<T>(a + b, ref_a + ref_b);
+        test_simd_check<T>(a - b, ref_a - ref_b);
+        test_simd_check<T>(a * t, ref_a * (long double) t);
+        test_simd_check<T>(Math::Dot(a, b), Math::Dot(ref_a, ref_b));
+        test_simd_check<T>(Math::Norm(a), 1.0L);
+        test_simd_check<T>(a * Math::Inverse(a), RefQuat::Identity);
+
+        Quat c = a * (T) 3;
+        test_simd_check<T>(Math::Normalize(c), ref_a);
+        test_simd_check<T>(c * Math::Inverse(c), RefQuat::Identity);
+
+        // Test the rotation of a vector and the composition of rotations.
+        RefVec4 ref_r = Math::Dot(ref_m, RefVec4{ref_v.x, ref_v.y, ref_v.z, 0});
+        test_simd_check<T>(
+            Math::Rotate(a, v), RefVec3{ref_r.x, ref_r.y, ref_r.z});
+        test_simd_check<T>(
+            Math::ToMat3(a * b),
+            Math::Dot(Math::ToMat3(ref_a), Math::ToMat3(ref_b)));
+
+        // Test the interpolation.
+        test_simd_check<T>(Math::Nlerp(a, b, t), Math::Nlerp(ref_a, ref_b,
+            (long double) t));
+        test_simd_check<T>(Math::Slerp(a, b, t), Math::Slerp(ref_a, ref_b,
+            (long double) t));
+        test_simd_check<T>(Math::Slerp(a, b, (T) 0), ref_a);
+        test_simd_check<T>(
+            Math::Slerp(a, b, (T) 1),
+            test_quat_align(ref_b, ref_a));
+        test_simd_check<T>(Math::Slerp(a, a, t), ref_a);
+
+        // Test the conversions from and to matrices and orthonormal bases.
+        test_simd_check<T>(
+            test_quat_align(Quat::CreateFromMat3(Math::ToMat3(a)), ref_a),
+            ref_a);
+        test_simd_check<T>(
+            test_quat_align(Quat::CreateFromMat4(Math::ToMat4(a)), ref_a),
+            ref_a);
+        test_simd_check<T>(
+            test_quat_align(Quat::CreateFromOrtho(Math::ToOrtho(a)), ref_a),
+            ref_a);
+
+        Math::Ortho<T> basis = Math::ToOrtho(a);
+        test_simd_check<T>(
+            basis.LocalToWorld(v), RefVec3{ref_r.x, ref_r.y, ref_r.z});
+
+        Math::Ortho<T> uv = Math::Ortho<T>::CreateFromUV(n1, n2);
+        Math::Ortho<T> vu = Math::ToOrtho(Quat::CreateFromOrtho(uv));
+        test_simd_check<T>(vu.u, test_simd_cast<RefVec3>(uv.u));
+        test_simd_check<T>(vu.v, test_simd_cast<RefVec3>(uv.v));
+        test_simd_check<T>(vu.w, test_simd_cast<RefVec3>(uv.w));
+    }
+
+    // Test the conversion of the rotations by pi around each axis, where
+    // the trace of the matrix is negative.
+    const Vec3 axes[] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 0}};
+    for (auto &axis : axes) {
+        Quat q = Quat::CreateFromAxisAngle(axis, (T) M_PI);
+        RefMat3 ref_m = Math::ToMat3(test_simd_cast<RefQuat>(q));
+        test_simd_check<T>(Math::ToMat3(Quat::CreateFromMat3(
+            Math::ToMat3(q))), ref_m);
+    }
+}
+
+///
+/// @brief Batch rotation test client. Rotate arrays of random vectors and
+/// packed vectors, out-of-place and in-place, and compare them with the long
+/// double reference of each item.
+///
+template<typename T>
+void test_quat_batch_run(const size_t count)
+{
+    using Vec3 = Math::Vec3<T>;
+    using Quat = Math::Quat<T>;
+    using RefVec3 = Math::Vec3<long double>;
+    using RefQuat = Math::Quat<long double>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+
+    Quat q = Quat::CreateFromAxisAngle(
+        Vec3{dist(rng), dist(rng), dist(rng)}, (T) M_PI * dist(rng));
+    RefQuat ref_q = test_simd_cast<RefQuat>(q);
+
+    std::vector<Vec3, Base::Allocator<Vec3>> a(count), out(count);
+    for (auto &v : a) {
+        v = {dist(rng), dist(rng), dist(rng)};
+    }
+
+    Math::Batch::Rotate(q, a.data(), out.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(
+            out[i], Math::Rotate(ref_q, test_simd_cast<RefVec3>(a[i])));
+    }
+
+    std::vector<Vec3, Base::Allocator<Vec3>> vectors(a);
+    Math::Batch::Rotate(q, vectors.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(vectors[i], test_simd_cast<RefVec3>(out[i]));
+    }
+
+    std::vector<Math::PackedVec3<T>> packed(count);
+    Math::Pack(a.data(), packed.data(), count);
+    Math::Batch::Rotate(q, packed.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        test_simd_check<T>(
+            Math::Unpack(packed[i]), test_simd_cast<RefVec3>(out[i]));
+    }
+}
+
+#endif // TEST_MATH_QUAT_H_
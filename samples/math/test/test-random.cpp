@@ -7,6 +7,8 @@
 // https://opensource.org/licenses/MIT.
 //
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -14,11 +16,395 @@
 #include "external/catch2/catch.hpp"
 #include "minicore/math/math.h"
 #include "common.h"
+#include "test-randomtest.h"
 
 ///
 /// @brief Random test client.
 ///
 TEST_CASE("Random")
+{
+    static const size_t n_short_samples   = 32768;
+    static const size_t n_battery_samples = 1 << 22;
+    static const size_t n_engines         = 4;
+
+    // 32-bit random number generator
+    SECTION("random32")
+    {
+        // Each engine of a collection passes the random test battery. The
+        // engines are seeded, so that a failure is reproducible.
+        std::vector<Math::RandomEngine> engine =
+            Math::CreateRandomEngines(n_engines, 2020);
+        for (auto &eng : engine) {
+            std::vector<uint32_t> samples(n_battery_samples, 0);
+            for (auto &v : samples) {
+                v = Math::Random32(eng);
+            }
+            test_randomtest_pass(Math::RandomTestReport(
+                Math::RandomTestRun(samples.data(), samples.size())));
+        }
+    }
+
+    // 64-bit random number generator
+    SECTION("random64")
+    {
+        // Each engine of a collection passes the random test battery, the
+        // 64-bit numbers tested as pairs of 32-bit words.
+        std::vector<Math::RandomEngine> engine =
+            Math::CreateRandomEngines(n_engines, 2021);
+        for (auto &eng : engine) {
+            std::vector<uint64_t> samples(n_battery_samples / 2, 0);
+            for (auto &v : samples) {
+                v = Math::Random64(eng);
+            }
+
+            std::vector<uint32_t> words(n_battery_samples, 0);
+            std::memcpy(words.data(), samples.data(),
+                samples.size() * sizeof(uint64_t));
+            test_randomtest_pass(Math::RandomTestReport(
+                Math::RandomTestRun(words.data(), words.size())));
+        }
+    }
+
+    // Bulk random number generator lanes
+    SECTION("randomfill")
+    {
+        Math::RandomLanes lanes =
+            Math::CreateRandomLanes(Math::CreateRandomEngine(2022));
+
+        // 32-bit and 64-bit numbers pass the random test battery, the
+        // 64-bit numbers tested as pairs of 32-bit words.
+        {
+            std::vector<uint32_t> samples(n_battery_samples, 0);
+            Math::RandomFill(lanes, samples.data(), samples.size());
+            test_randomtest_pass(Math::RandomTestReport(
+                Math::RandomTestRun(samples.data(), samples.size())));
+        }
+
+        {
+            std::vector<uint64_t> samples(n_battery_samples / 2, 0);
+            Math::RandomFill(lanes, samples.data(), samples.size());
+
+            std::vector<uint32_t> words(n_battery_samples, 0);
+            std::memcpy(words.data(), samples.data(),
+                samples.size() * sizeof(uint64_t));
+            test_randomtest_pass(Math::RandomTestReport(
+                Math::RandomTestRun(words.data(), words.size())));
+        }
+
+        // Uniform floating point numbers in [0, 1)
+        {
+            std::vector<float> samples_f(n_short_samples);
+            std::vector<double> samples_d(n_short_samples);
+            Math::RandomFill(lanes, samples_f.data(), samples_f.size());
+            Math::RandomFill(lanes, samples_d.data(), samples_d.size());
+            for (size_t i = 0; i < n_short_samples; ++i) {
+                REQUIRE(samples_f[i] >= 0.0f);
+                REQUIRE(samples_f[i] < 1.0f);
+                REQUIRE(samples_d[i] >= 0.0);
+                REQUIRE(samples_d[i] < 1.0);
+            }
+        }
+    }
+
+    // Counter-based random streams
+    SECTION("randomstream")
+    {
+        // Known answers of the Random123 reference implementation.
+        {
+            const uint32_t zeros[4] = {0, 0, 0, 0};
+            const uint32_t ones[4] = {
+                0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+            const uint32_t pi[4] = {
+                0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+            const uint32_t pi_key[4] = {
+                0xa4093822, 0x299f31d0, 0x082efa98, 0xec4e6c89};
+            const uint32_t ref[6][4] = {
+                {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+                {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+                {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1},
+                {0x9c6ca96a, 0xe17eae66, 0xfc10ecd4, 0x5256a7d8},
+                {0x2a881696, 0x57012287, 0xf6c7446e, 0xa16a6732},
+                {0x59cd1dbb, 0xb8879579, 0x86b5d00c, 0xac8b6d84}};
+
+            uint32_t out[6][4];
+            Math::Philox4x32(zeros, zeros, out[0]);
+            Math::Philox4x32(ones, ones, out[1]);
+            Math::Philox4x32(pi, pi_key, out[2]);
+            Math::Threefry4x32(zeros, zeros, out[3]);
+            Math::Threefry4x32(ones, ones, out[4]);
+            Math::Threefry4x32(pi, pi_key, out[5]);
+            for (size_t i = 0; i < 6; ++i) {
+                for (size_t k = 0; k < 4; ++k) {
+                    REQUIRE(out[i][k] == ref[i][k]);
+                }
+            }
+        }
+
+        // The numbers of a stream do not depend on the partition of the
+        // sequence between threads, nor on the offset of the fill.
+        for (uint32_t generator = Math::kRandomPhilox;
+             generator <= Math::kRandomThreefry;
+             ++generator) {
+            const Math::RandomStream stream =
+                Math::CreateRandomStream(12345, 67, generator);
+
+            std::vector<uint32_t> samples32(n_short_samples, 0);
+            std::vector<uint64_t> samples64(n_short_samples, 0);
+            #pragma omp parallel for default(none) \
+                shared(stream, samples32, samples64) schedule(dynamic, 61)
+            for (size_t i = 0; i < n_short_samples; ++i) {
+                samples32[i] = Math::Random32(stream, i);
+                samples64[i] = Math::Random64(stream, i);
+            }
+
+            for (size_t first : {0, 1, 2, 3, 5, 1021}) {
+                const size_t n = n_short_samples - first;
+                std::vector<uint32_t> fill32(n);
+                std::vector<uint64_t> fill64(n);
+                Math::RandomFill(stream, first, fill32.data(), n);
+                Math::RandomFill(stream, first, fill64.data(), n);
+                for (size_t i = 0; i < n; ++i) {
+                    REQUIRE(fill32[i] == samples32[first + i]);
+                    REQUIRE(fill64[i] == samples64[first + i]);
+                }
+            }
+
+            std::vector<float> samples_f(n_short_samples);
+            std::vector<double> samples_d(n_short_samples);
+            Math::RandomFill(stream, 0, samples_f.data(), samples_f.size());
+            Math::RandomFill(stream, 0, samples_d.data(), samples_d.size());
+            for (size_t i = 0; i < n_short_samples; ++i) {
+                REQUIRE(samples_f[i] >= 0.0f);
+                REQUIRE(samples_f[i] < 1.0f);
+                REQUIRE(samples_d[i] >= 0.0);
+                REQUIRE(samples_d[i] < 1.0);
+            }
+        }
+
+        // Both generators pass the random test battery, with the 32-bit
+        // numbers filled from the stream in chunks.
+        auto fill = [] (uint64_t first, uint32_t *dst, size_t n, void *arg) {
+            const Math::RandomStream *stream =
+                static_cast<const Math::RandomStream *>(arg);
+            Math::RandomFill(*stream, first, dst, n);
+        };
+        for (auto generator : {Math::kRandomPhilox, Math::kRandomThreefry}) {
+            Math::RandomStream stream = Math::CreateRandomStream(
+                2020, 0, generator);
+            test_randomtest_pass(Math::RandomTestReport(
+                Math::RandomTestRun(fill, n_battery_samples, &stream)));
+        }
+    }
+
+    // Jump-ahead and stream splitting
+    SECTION("randomsplit")
+    {
+        auto equal = [] (
+            const Math::RandomEngine &a,
+            const Math::RandomEngine &b) {
+            return a.x == b.x && a.y == b.y &&
+                a.z1 == b.z1 && a.c1 == b.c1 &&
+                a.z2 == b.z2 && a.c2 == b.c2;
+        };
+
+        // Jumps over n steps are equal to n calls of the generator.
+        for (uint64_t n = 0; n < 256; ++n) {
+            Math::RandomEngine eng = Math::CreateRandomEngine();
+            Math::RandomEngine eng32 = eng;
+            Math::RandomEngine eng64 = eng;
+            Math::Jump32(eng32, n);
+            Math::Jump64(eng64, n);
+
+            Math::RandomEngine ref32 = eng;
+            Math::RandomEngine ref64 = eng;
+            for (uint64_t k = 0; k < n; ++k) {
+                Math::Random32(ref32);
+                Math::Random64(ref64);
+            }
+            REQUIRE(equal(eng32, ref32));
+            REQUIRE(equal(eng64, ref64));
+        }
+
+        // Consecutive jumps compose.
+        for (size_t iter = 0; iter < 64; ++iter) {
+            Math::RandomEngine eng = Math::CreateRandomEngine();
+            uint64_t n1 = Math::Random64(eng) >> 1;
+            uint64_t n2 = Math::Random64(eng) >> 1;
+
+            Math::RandomEngine a = eng;
+            Math::RandomEngine b = eng;
+            Math::Jump64(a, n1);
+            Math::Jump64(a, n2);
+            Math::Jump64(b, n1 + n2);
+            REQUIRE(equal(a, b));
+        }
+
+        // Stream k starts k * floor((2^64-1) / n) steps after the engine.
+        {
+            const size_t n_streams = 5;
+            Math::RandomEngine eng = Math::CreateRandomEngine();
+            std::vector<Math::RandomEngine> streams =
+                Math::Split(eng, n_streams);
+            REQUIRE(streams.size() == n_streams);
+            REQUIRE(Math::Split(eng, 0).empty());
+            for (size_t k = 0; k < n_streams; ++k) {
+                Math::RandomEngine ref = eng;
+                Math::Jump64(ref, k * (UINT64_MAX / n_streams));
+                REQUIRE(equal(streams[k], ref));
+            }
+        }
+
+        // The numbers drawn from the streams do not depend on the number of
+        // threads drawing them.
+        {
+            const size_t n_streams = 64;
+            const size_t n_samples = n_short_samples / n_streams;
+            Math::RandomEngine eng = Math::CreateRandomEngine();
+
+            std::vector<uint64_t> serial(n_short_samples, 0);
+            std::vector<Math::RandomEngine> streams =
+                Math::Split(eng, n_streams);
+            for (size_t k = 0; k < n_streams; ++k) {
+                for (size_t i = 0; i < n_samples; ++i) {
+                    serial[k * n_samples + i] = Math::Random64(streams[k]);
+                }
+            }
+
+            std::vector<uint64_t> samples(n_short_samples, 0);
+            streams = Math::Split(eng, n_streams);
+            #pragma omp parallel for default(none) \
+                shared(samples, streams) schedule(dynamic, 1)
+            for (size_t k = 0; k < n_streams; ++k) {
+                for (size_t i = 0; i < n_samples; ++i) {
+                    samples[k * n_samples + i] = Math::Random64(streams[k]);
+                }
+            }
+            REQUIRE(samples == serial);
+
+            // Lanes created from the same engine fill the same numbers.
+            Math::RandomLanes lanes1 = Math::CreateRandomLanes(eng);
+            Math::RandomLanes lanes2 = Math::CreateRandomLanes(eng);
+            std::vector<uint64_t> fill1(n_short_samples);
+            std::vector<uint64_t> fill2(n_short_samples);
+            Math::RandomFill(lanes1, fill1.data(), fill1.size());
+            Math::RandomFill(lanes2, fill2.data(), fill2.size());
+            REQUIRE(fill1 == fill2);
+        }
+    }
+
+    // Seeded and bulk engine creation
+    SECTION("randomseed")
+    {
+        auto equal = [] (
+            const Math::RandomEngine &a,
+            const Math::RandomEngine &b) {
+            return a.x == b.x && a.y == b.y &&
+                a.z1 == b.z1 && a.c1 == b.c1 &&
+                a.z2 == b.z2 && a.c2 == b.c2;
+        };
+
+        // SplitMix64 reference numbers of the seed 1234567.
+        {
+            uint64_t state = 1234567;
+            REQUIRE(Math::SplitMix64(state) == 6457827717110365317ULL);
+            REQUIRE(Math::SplitMix64(state) == 3203168211198807973ULL);
+            REQUIRE(Math::SplitMix64(state) == 9817491932198370423ULL);
+            REQUIRE(Math::SplitMix64(state) == 4593380528125082431ULL);
+            REQUIRE(Math::SplitMix64(state) == 16408922859458223821ULL);
+        }
+
+        // Engines of a seed are reproducible, engine k is the same for any
+        // number of engines, and the engine of a seed is the first engine.
+        const size_t n_engines = 4096;
+        for (uint64_t seed : {0ULL, 1ULL, 2020ULL, 0xffffffffffffffffULL}) {
+            std::vector<Math::RandomEngine> engines =
+                Math::CreateRandomEngines(n_engines, seed);
+            std::vector<Math::RandomEngine> prefix =
+                Math::CreateRandomEngines(n_engines / 2, seed);
+            REQUIRE(engines.size() == n_engines);
+            REQUIRE(equal(engines[0], Math::CreateRandomEngine(seed)));
+            for (size_t k = 0; k < prefix.size(); ++k) {
+                REQUIRE(equal(engines[k], prefix[k]));
+            }
+
+            // Every state is valid and the engines draw distinct numbers.
+            std::vector<uint64_t> first;
+            for (auto &eng : engines) {
+                REQUIRE(eng.x != 0);
+                REQUIRE(eng.y != 0);
+                REQUIRE(eng.z1 != 0);
+                REQUIRE(eng.z2 != 0);
+                REQUIRE(eng.c1 > 0);
+                REQUIRE(eng.c1 < 698769069U);
+                REQUIRE(eng.c2 > 0);
+                REQUIRE(eng.c2 < 698769069U);
+                Math::RandomEngine copy = eng;
+                first.push_back(Math::Random64(copy));
+            }
+            std::sort(first.begin(), first.end());
+            REQUIRE(std::adjacent_find(first.begin(), first.end()) ==
+                first.end());
+        }
+
+        // Jumps apply to the seeded engines.
+        {
+            Math::RandomEngine eng = Math::CreateRandomEngines(8)[7];
+            Math::RandomEngine ref = eng;
+            Math::Jump64(eng, 1000);
+            for (size_t k = 0; k < 1000; ++k) {
+                Math::Random64(ref);
+            }
+            REQUIRE(equal(eng, ref));
+        }
+    }
+
+    // Prime numbers
+    SECTION("randomprime")
+    {
+        // Primality of the small numbers against the sieve of Eratosthenes.
+        const size_t n_sieve = 1 << 16;
+        std::vector<bool> sieve(n_sieve, true);
+        sieve[0] = sieve[1] = false;
+        for (size_t p = 2; p * p < n_sieve; ++p) {
+            for (size_t q = p * p; sieve[p] && q < n_sieve; q += p) {
+                sieve[q] = false;
+            }
+        }
+        uint64_t prev = 0;
+        for (size_t n = 0; n < n_sieve; ++n) {
+            REQUIRE(Math::IsPrime(n) == sieve[n]);
+            prev = sieve[n] ? n : prev;
+            REQUIRE(Math::PrevPrime(n) == prev);
+        }
+
+        // Large primes, and strong pseudoprimes to several bases.
+        REQUIRE(Math::IsPrime(4294967291ULL));
+        REQUIRE(Math::IsPrime(2305843009213693951ULL));
+        REQUIRE(Math::IsPrime(18446744073709551557ULL));
+        REQUIRE(!Math::IsPrime(3215031751ULL));
+        REQUIRE(!Math::IsPrime(3825123056546413051ULL));
+        REQUIRE(!Math::IsPrime(341550071728321ULL));
+        REQUIRE(!Math::IsPrime(4294967291ULL * 4294967279ULL));
+        REQUIRE(!Math::IsPrime(18446744073709551615ULL));
+        REQUIRE(Math::PrevPrime(1ULL << 32) == 4294967291ULL);
+        REQUIRE(Math::PrevPrime(18446744073709551615ULL) ==
+            18446744073709551557ULL);
+
+        // Random primes.
+        Math::RandomDevice device;
+        for (size_t iter = 0; iter < 256; ++iter) {
+            uint64_t p = Math::RandomPrime(device);
+            REQUIRE(Math::IsPrime(p));
+        }
+    }
+}
+
+///
+/// @brief Random output client. Write short and long runs of the 32-bit and
+/// 64-bit random engines to /tmp, for the ent test program and the plots.
+/// Hidden, run with the [.ent] tag.
+///
+TEST_CASE("RandomEnt", "[.ent]")
 {
     static const size_t n_short_runs    = 2048;
     static const size_t n_short_samples = 32768;
@@ -33,15 +419,17 @@ TEST_CASE("Random")
         {
             size_t n_threads = omp_get_num_threads();
             #pragma omp master
-            for (size_t i = 0; i < n_threads; ++i) {
-                engine.push_back(Math::CreateRandomEngine());
-                std::cout << "engine " << engine.size()
-                    << " x "  << engine.back().x << " "
-                    << " y "  << engine.back().y << " "
-                    << " z1 " << engine.back().z1 << " "
-                    << " c1 " << engine.back().c1 << " "
-                    << " z2 " << engine.back().z2 << " "
-                    << " c2 " << engine.back().c2 << "\n";
+            {
+                engine = Math::CreateRandomEngines(n_threads);
+                for (size_t i = 0; i < n_threads; ++i) {
+                    std::cout << "engine " << i + 1
+                        << " x "  << engine[i].x << " "
+                        << " y "  << engine[i].y << " "
+                        << " z1 " << engine[i].z1 << " "
+                        << " c1 " << engine[i].c1 << " "
+                        << " z2 " << engine[i].z2 << " "
+                        << " c2 " << engine[i].c2 << "\n";
+                }
             }
         }
 
@@ -98,15 +486,17 @@ TEST_CASE("Random")
         {
             size_t n_threads = omp_get_num_threads();
             #pragma omp master
-            for (size_t i = 0; i < n_threads; ++i) {
-                engine.push_back(Math::CreateRandomEngine());
-                std::cout << "engine " << engine.size()
-                    << " x "  << engine.back().x << " "
-                    << " y "  << engine.back().y << " "
-                    << " z1 " << engine.back().z1 << " "
-                    << " c1 " << engine.back().c1 << " "
-                    << " z2 " << engine.back().z2 << " "
-                    << " c2 " << engine.back().c2 << "\n";
+            {
+                engine = Math::CreateRandomEngines(n_threads);
+                for (size_t i = 0; i < n_threads; ++i) {
+                    std::cout << "engine " << i + 1
+                        << " x "  << engine[i].x << " "
+                        << " y "  << engine[i].y << " "
+                        << " z1 " << engine[i].z1 << " "
+                        << " c1 " << engine[i].c1 << " "
+                        << " z2 " << engine[i].z2 << " "
+                        << " c2 " << engine[i].c2 << "\n";
+                }
             }
         }
 
@@ -153,4 +543,3 @@ TEST_CASE("Random")
         }
     }
 }
-
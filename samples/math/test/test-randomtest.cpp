@@ -0,0 +1,40 @@
+//
+// test-randomtest.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-randomtest.h"
+
+///
+/// @brief Random test battery client. Run the battery in the calling thread
+/// and over the thread pool, with the same results.
+///
+TEST_CASE("RandomTest") {
+    const size_t count = 1 << 22;
+
+    SECTION("Serial") {
+        test_randomtest_run(count);
+    }
+
+    SECTION("Parallel") {
+        Base::ThreadPool::Initialize(4);
+        test_randomtest_run(count);
+
+        Math::RandomStream stream = Math::CreateRandomStream(1, 2);
+        std::vector<uint32_t> data(count);
+        Math::RandomFill(stream, 0, data.data(), data.size());
+        Math::RandomTest parallel = Math::RandomTestRun(
+            data.data(), data.size());
+
+        Base::ThreadPool::Terminate();
+        REQUIRE(Base::ThreadPool::GetNumThreads() == 0);
+        Math::RandomTest serial = Math::RandomTestRun(
+            data.data(), data.size());
+        test_randomtest_equal(parallel, serial, true);
+    }
+}
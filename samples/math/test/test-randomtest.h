@@ -0,0 +1,165 @@
+//
+// test-randomtest.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_RANDOMTEST_H_
+#define TEST_MATH_RANDOMTEST_H_
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "minicore/base/base.h"
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Verify that the p-values of a random generator do not reject it.
+///
+inline void test_randomtest_pass(const Math::RandomTestResult &result)
+{
+    const double p_min = 1.0e-6;
+    REQUIRE(result.entropy > 7.999);
+    REQUIRE(result.chi_square_p > p_min);
+    REQUIRE(result.chi_square_p < 1.0 - p_min);
+    REQUIRE(result.mean_p > p_min);
+    REQUIRE(std::fabs(result.pi - M_PI) < 1.0e-2);
+    REQUIRE(result.pi_p > p_min);
+    REQUIRE(std::fabs(result.serial) < 1.0e-2);
+    REQUIRE(result.serial_p > p_min);
+    REQUIRE(result.birthday_p > p_min);
+    REQUIRE(result.birthday_p < 1.0 - p_min);
+    REQUIRE(result.gap_p > p_min);
+    REQUIRE(result.gap_p < 1.0 - p_min);
+}
+
+///
+/// @brief Return true if any p-value of a random generator rejects it.
+///
+inline bool test_randomtest_fail(const Math::RandomTestResult &result)
+{
+    const double p_min = 1.0e-6;
+    auto reject = [p_min] (double p) { return p < p_min || p > 1.0 - p_min; };
+    return reject(result.chi_square_p) ||
+        result.mean_p < p_min ||
+        result.pi_p < p_min ||
+        result.serial_p < p_min ||
+        reject(result.birthday_p) ||
+        reject(result.gap_p);
+}
+
+///
+/// @brief Verify that the statistics of two tests of the same sequence are
+/// equal, the floating point sums within a tolerance of their summation
+/// order if not exact.
+///
+inline void test_randomtest_equal(
+    const Math::RandomTest &a,
+    const Math::RandomTest &b,
+    const bool exact)
+{
+    const double tol = exact ? 0.0 : 1.0e-12;
+    REQUIRE(a.count == b.count);
+    REQUIRE(std::equal(&a.bytes[0], &a.bytes[256], &b.bytes[0]));
+    REQUIRE(a.inside == b.inside);
+    REQUIRE(std::fabs(a.sum - b.sum) <= tol * a.sum);
+    REQUIRE(std::fabs(a.sum2 - b.sum2) <= tol * a.sum2);
+    REQUIRE(std::fabs(a.sum12 - b.sum12) <= tol * a.sum12);
+    REQUIRE(a.first == b.first);
+    REQUIRE(a.last == b.last);
+    REQUIRE(std::equal(&a.birthdays[0],
+        &a.birthdays[Math::kRandomTestBirthdays], &b.birthdays[0]));
+    REQUIRE(std::equal(&a.gaps[0],
+        &a.gaps[Math::kRandomTestGaps + 1], &b.gaps[0]));
+    REQUIRE(a.gap_hit == b.gap_hit);
+    REQUIRE(a.gap_prefix == b.gap_prefix);
+    REQUIRE(a.gap_suffix == b.gap_suffix);
+    REQUIRE(a.num_pending == b.num_pending);
+    REQUIRE(std::equal(&a.pending[0], &a.pending[a.num_pending],
+        &b.pending[0]));
+}
+
+///
+/// @brief Random test battery client. Test the random engine, the random
+/// engine lanes and the counter-based random streams, and verify that the
+/// battery rejects a counter and a linear congruential generator.
+///
+inline void test_randomtest_run(const size_t count)
+{
+    // Random engine, with a partial block at the end of the array.
+    {
+        Math::RandomEngine eng = Math::CreateRandomEngine(2020);
+        std::vector<uint32_t> data(count + 100);
+        for (auto &v : data) {
+            v = Math::Random32(eng);
+        }
+        Math::RandomTest test = Math::RandomTestRun(data.data(), data.size());
+        REQUIRE(test.count == count);
+        REQUIRE(test.num_pending == 100);
+        test_randomtest_pass(Math::RandomTestReport(test));
+
+        // Streaming updates in chunks of any size test the same sequence.
+        Math::RandomTest stream = Math::CreateRandomTest();
+        for (size_t i = 0; i < data.size(); i += 1000) {
+            size_t n = std::min((size_t) 1000, data.size() - i);
+            Math::RandomTestUpdate(stream, &data[i], n);
+        }
+        test_randomtest_equal(test, stream, false);
+
+        // Merging into a partial block is an error.
+        REQUIRE_THROWS(Math::RandomTestMerge(stream, test));
+    }
+
+    // Random engine lanes.
+    {
+        Math::RandomLanes lanes = Math::CreateRandomLanes(
+            Math::CreateRandomEngine(7));
+        std::vector<uint32_t> data(count);
+        Math::RandomFill(lanes, data.data(), data.size());
+        test_randomtest_pass(Math::RandomTestReport(
+            Math::RandomTestRun(data.data(), data.size())));
+    }
+
+    // Counter-based random streams, tested from the generator in chunks.
+    auto fill = [] (uint64_t first, uint32_t *dst, size_t n, void *arg) {
+        const Math::RandomStream *stream =
+            static_cast<const Math::RandomStream *>(arg);
+        Math::RandomFill(*stream, first, dst, n);
+    };
+    for (auto generator : {Math::kRandomPhilox, Math::kRandomThreefry}) {
+        Math::RandomStream stream = Math::CreateRandomStream(
+            2020, 1, generator);
+        Math::RandomTest test = Math::RandomTestRun(fill, count, &stream);
+        test_randomtest_pass(Math::RandomTestReport(test));
+
+        std::vector<uint32_t> data(count);
+        Math::RandomFill(stream, 0, data.data(), data.size());
+        test_randomtest_equal(test,
+            Math::RandomTestRun(data.data(), data.size()), true);
+    }
+
+    // A counter and a 32-bit linear congruential generator, whose low byte
+    // has period 256, fail.
+    {
+        std::vector<uint32_t> data(count);
+        for (size_t i = 0; i < count; ++i) {
+            data[i] = (uint32_t) (i * 2654435761U);
+        }
+        REQUIRE(test_randomtest_fail(Math::RandomTestReport(
+            Math::RandomTestRun(data.data(), data.size()))));
+
+        uint32_t x = 1;
+        for (auto &v : data) {
+            x = 1664525U * x + 1013904223U;
+            v = x;
+        }
+        REQUIRE(test_randomtest_fail(Math::RandomTestReport(
+            Math::RandomTestRun(data.data(), data.size()))));
+    }
+}
+
+#endif // TEST_MATH_RANDOMTEST_H_
@@ -0,0 +1,42 @@
+//
+// test-simd.cpp
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#include "external/catch2/catch.hpp"
+#include "test-simd.h"
+
+///
+/// @brief SIMD specializations test client. Cross-check the single and double
+/// precision specializations against the generic long double templates.
+///
+TEST_CASE("Simd") {
+    const size_t n_iters = 65536;
+
+    SECTION("Vector") {
+        test_simd_vector_run<float, Math::Vec2>(n_iters);
+        test_simd_vector_run<float, Math::Vec3>(n_iters);
+        test_simd_vector_run<float, Math::Vec4>(n_iters);
+        test_simd_vector_run<double, Math::Vec2>(n_iters);
+        test_simd_vector_run<double, Math::Vec3>(n_iters);
+        test_simd_vector_run<double, Math::Vec4>(n_iters);
+    }
+
+    SECTION("Matrix") {
+        test_simd_matrix_run<float, Math::Mat2, Math::Vec2>(n_iters);
+        test_simd_matrix_run<float, Math::Mat3, Math::Vec3>(n_iters);
+        test_simd_matrix_run<float, Math::Mat4, Math::Vec4>(n_iters);
+        test_simd_matrix_run<double, Math::Mat2, Math::Vec2>(n_iters);
+        test_simd_matrix_run<double, Math::Mat3, Math::Vec3>(n_iters);
+        test_simd_matrix_run<double, Math::Mat4, Math::Vec4>(n_iters);
+    }
+
+    SECTION("Transform") {
+        test_simd_transform_run<float>(n_iters);
+        test_simd_transform_run<double>(n_iters);
+    }
+}
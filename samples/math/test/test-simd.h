@@ -0,0 +1,197 @@
+//
+// test-simd.h
+//
+// Copyright (c) 2020 Carlos Braga
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the MIT License. See accompanying LICENSE.md or
+// https://opensource.org/licenses/MIT.
+//
+
+#ifndef TEST_MATH_SIMD_H_
+#define TEST_MATH_SIMD_H_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "minicore/math/math.h"
+#include "common.h"
+
+///
+/// @brief Convert a vector or a matrix to a different element type. The long
+/// double types use the generic templates and are used as the reference.
+///
+template<typename R, typename U>
+R test_simd_cast(const U &u)
+{
+    R r{};
+    for (size_t j = 0; j < sizeof(u.data) / sizeof(u.data[0]); ++j) {
+        r.data[j] = u.data[j];
+    }
+    return r;
+}
+
+///
+/// @brief Compare a value with the reference value. The tolerance is absolute
+/// for values smaller than one and relative otherwise, so that results of sums
+/// with cancellation are compared at the scale of their terms.
+///
+template<typename T>
+bool test_simd_eq(const T u, const long double ref)
+{
+    static const long double epsilon =
+        std::sqrt(std::numeric_limits<T>::epsilon());
+    long double scale = std::max(1.0L, std::fabs(ref));
+    return std::fabs(u - ref) <= epsilon * scale;
+}
+
+template<typename T, typename U, typename R>
+void test_simd_check(const U &u, const R &ref)
+{
+    for (size_t j = 0; j < sizeof(u.data) / sizeof(u.data[0]); ++j) {
+        REQUIRE(test_simd_eq<T>(u.data[j], ref.data[j]));
+    }
+}
+
+template<typename T>
+void test_simd_check(const T u, const long double ref)
+{
+    REQUIRE(test_simd_eq<T>(u, ref));
+}
+
+///
+/// @brief Vector specializations test client.
+///
+template<typename T, template<typename> class V>
+void test_simd_vector_run(const size_t n_iters)
+{
+    using Ref = V<long double>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_real_distribution<T> dist_pos(1.0, 2.0);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        V<T> a, b, c;
+        for (size_t j = 0; j < a.length; ++j) {
+            a[j] = dist(rng);
+            b[j] = dist(rng);
+            c[j] = dist_pos(rng);
+        }
+        T s = dist_pos(rng);
+
+        Ref ref_a = test_simd_cast<Ref>(a);
+        Ref ref_b = test_simd_cast<Ref>(b);
+        Ref ref_c = test_simd_cast<Ref>(c);
+        long double ref_s = s;
+
+        // Test arithmetic operators
+        test_simd_check<T>(a + b, ref_a + ref_b);
+        test_simd_check<T>(a - b, ref_a - ref_b);
+        test_simd_check<T>(a * b, ref_a * ref_b);
+        test_simd_check<T>(a / c, ref_a / ref_c);
+        test_simd_check<T>(a + s, ref_a + ref_s);
+        test_simd_check<T>(a - s, ref_a - ref_s);
+        test_simd_check<T>(a * s, ref_a * ref_s);
+        test_simd_check<T>(a / s, ref_a / ref_s);
+        test_simd_check<T>(s + a, ref_s + ref_a);
+        test_simd_check<T>(s - a, ref_s - ref_a);
+        test_simd_check<T>(s * a, ref_s * ref_a);
+        test_simd_check<T>(s / c, ref_s / ref_c);
+        test_simd_check<T>(-a, -ref_a);
+
+        // Test algebra functions
+        test_simd_check<T>(Math::Dot(a, b), Math::Dot(ref_a, ref_b));
+        test_simd_check<T>(Math::Norm(c), Math::Norm(ref_c));
+        test_simd_check<T>(Math::Normalize(c), Math::Normalize(ref_c));
+        test_simd_check<T>(Math::Distance(a, b), Math::Distance(ref_a, ref_b));
+    }
+}
+
+///
+/// @brief Matrix specializations test client. Shift the diagonal of the random
+/// matrices to keep them well conditioned.
+///
+template<typename T, template<typename> class M, template<typename> class V>
+void test_simd_matrix_run(const size_t n_iters)
+{
+    using Ref = M<long double>;
+    using RefVec = V<long double>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_real_distribution<T> dist_pos(1.0, 2.0);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        M<T> a, b, c;
+        V<T> v;
+        for (size_t j = 0; j < a.dim * a.dim; ++j) {
+            a.data[j] = dist(rng);
+            b.data[j] = dist(rng);
+            c.data[j] = dist_pos(rng);
+        }
+        for (size_t j = 0; j < a.dim; ++j) {
+            a.data[j * a.dim + j] += static_cast<T>(a.dim);
+            v[j] = dist(rng);
+        }
+        T s = dist_pos(rng);
+
+        Ref ref_a = test_simd_cast<Ref>(a);
+        Ref ref_b = test_simd_cast<Ref>(b);
+        Ref ref_c = test_simd_cast<Ref>(c);
+        RefVec ref_v = test_simd_cast<RefVec>(v);
+        long double ref_s = s;
+
+        // Test arithmetic operators
+        test_simd_check<T>(a + b, ref_a + ref_b);
+        test_simd_check<T>(a - b, ref_a - ref_b);
+        test_simd_check<T>(a * b, ref_a * ref_b);
+        test_simd_check<T>(a / c, ref_a / ref_c);
+        test_simd_check<T>(a + s, ref_a + ref_s);
+        test_simd_check<T>(a - s, ref_a - ref_s);
+        test_simd_check<T>(a * s, ref_a * ref_s);
+        test_simd_check<T>(a / s, ref_a / ref_s);
+
+        // Test algebra functions
+        test_simd_check<T>(Math::Dot(a, v), Math::Dot(ref_a, ref_v));
+        test_simd_check<T>(Math::Dot(a, b), Math::Dot(ref_a, ref_b));
+        test_simd_check<T>(Math::Transpose(b), Math::Transpose(ref_b));
+        test_simd_check<T>(Math::Determinant(b), Math::Determinant(ref_b));
+        test_simd_check<T>(Math::Determinant(a), Math::Determinant(ref_a));
+        test_simd_check<T>(Math::Inverse(a), Math::Inverse(ref_a));
+        test_simd_check<T>(Math::Dot(a, Math::Inverse(a)), Ref::Eye);
+    }
+}
+
+///
+/// @brief Cross product and rotation specializations test client.
+///
+template<typename T>
+void test_simd_transform_run(const size_t n_iters)
+{
+    using Ref = Math::Vec3<long double>;
+
+    std::random_device seed;
+    std::mt19937 rng(seed());
+    std::uniform_real_distribution<T> dist(-1.0, 1.0);
+    std::uniform_real_distribution<T> dist_pos(1.0, 2.0);
+
+    for (size_t iter = 0; iter < n_iters; ++iter) {
+        Math::Vec3<T> a = {dist(rng), dist(rng), dist(rng)};
+        Math::Vec3<T> b = {dist(rng), dist(rng), dist(rng)};
+        Math::Vec3<T> n = {dist_pos(rng), dist(rng), dist(rng)};
+        T theta = static_cast<T>(M_PI) * dist(rng);
+
+        Ref ref_a = test_simd_cast<Ref>(a);
+        Ref ref_b = test_simd_cast<Ref>(b);
+        Ref ref_n = test_simd_cast<Ref>(n);
+        long double ref_theta = theta;
+
+        test_simd_check<T>(Math::Cross(a, b), Math::Cross(ref_a, ref_b));
+        test_simd_check<T>(
+            Math::Rotate(n, theta), Math::Rotate(ref_n, ref_theta));
+    }
+}
+
+#endif // TEST_MATH_SIMD_H_